@@ -102,6 +102,13 @@ try
     desc.add_options()("help,h", "Produces this help message.")
 
         // test options
+        ("alg_mode",
+         value<rocblas_int>(&argus.alg_mode)->default_value(0),
+            "Algorithm to be used by GETRF, GEQRF or POTRF. 0 = default, 1 = recursive,\n"
+            "                           2 = persistent (only POTRF).\n"
+            "                           Selects the algorithm with rocsolver_set_alg_mode before the tests.\n"
+            "                           ")
+
         ("batch_count",
          value<rocblas_int>(&argus.batch_count)->default_value(1),
             "Number of matrices or problem instances in the batch.\n"
@@ -127,7 +134,8 @@ try
 
         ("mem_query",
          value<rocblas_int>(&argus.mem_query)->default_value(0),
-            "Calculate the required amount of device workspace memory? 0 = No, 1 = Yes.\n"
+            "Calculate the required amount of device workspace memory? 0 = No, 1 = Yes,\n"
+            "                           2 = Yes, also printing the breakdown of the workspace per internal array and call.\n"
             "                           This forces the client to print only the amount of device memory required by\n"
             "                           the function, in bytes.\n"
             "                           ")
@@ -215,6 +223,18 @@ try
             "                           Increment between values in matrices C.\n"
             "                           ")
 
+        ("incd",
+         value<rocblas_int>()->default_value(1),
+            "Matrix/vector increment parameter.\n"
+            "                           Increment between values in vectors D.\n"
+            "                           ")
+
+        ("ince",
+         value<rocblas_int>()->default_value(1),
+            "Matrix/vector increment parameter.\n"
+            "                           Increment between values in vectors E.\n"
+            "                           ")
+
         ("incx",
          value<rocblas_int>()->default_value(1),
             "Matrix/vector increment parameter.\n"
@@ -310,7 +330,8 @@ try
         ("strideF",
          value<rocblas_stride>(),
             "Matrix/vector stride parameter.\n"
-            "                           Stride for vectors ifail.\n"
+            "                           Stride for vectors ifail, or for the reduced blocks F\n"
+            "                           of the block cyclic reduction.\n"
             "                           ")
 
 
@@ -320,6 +341,12 @@ try
             "                           Stride for vectors tauq.\n"
             "                           ")
 
+        ("strideJ",
+         value<rocblas_stride>(),
+            "Matrix/vector stride parameter.\n"
+            "                           Stride for vectors jpvt.\n"
+            "                           ")
+
         ("strideP",
          value<rocblas_stride>(),
             "Matrix/vector stride parameter.\n"
@@ -338,6 +365,12 @@ try
             "                           Stride for matrices/vectors U.\n"
             "                           ")
 
+        ("strideUV",
+         value<rocblas_stride>(),
+            "Matrix/vector stride parameter.\n"
+            "                           Stride for the random butterfly transforms UV.\n"
+            "                           ")
+
         ("strideV",
          value<rocblas_stride>(),
             "Matrix/vector stride parameter.\n"
@@ -497,6 +530,25 @@ try
             "                           Only applicable to block tridiagonal matrix APIs.\n"
             "                           ")
 
+        // band matrix options
+        ("kl",
+         value<rocblas_int>(),
+            "Number of subdiagonals of a general band matrix.\n"
+            "                           Only applicable to gbtrf, gbtrs and gbsv.\n"
+            "                           ")
+
+        ("ku",
+         value<rocblas_int>(),
+            "Number of superdiagonals of a general band matrix.\n"
+            "                           Only applicable to gbtrf, gbtrs and gbsv.\n"
+            "                           ")
+
+        ("kd",
+         value<rocblas_int>(),
+            "Number of superdiagonals (or subdiagonals) of a Hermitian band matrix.\n"
+            "                           Only applicable to pbtrf, pbtrs and pbsv.\n"
+            "                           ")
+
         // partial eigenvalue/singular value decomposition options
         ("il",
          value<rocblas_int>(),
@@ -559,6 +611,18 @@ try
             "                           Used in iterative Jacobi and partial eigenvalue decomposition functions.\n"
             "                           ")
 
+        ("rcond",
+         value<double>(),
+            "Relative tolerance used to determine the numerical rank of A.\n"
+            "                           Used in rank-revealing least-squares solvers.\n"
+            "                           ")
+
+        ("tol",
+         value<double>(),
+            "Relative tolerance used to determine the numerical rank of A.\n"
+            "                           Used in truncated rank-revealing factorizations.\n"
+            "                           ")
+
         ("direct",
          value<char>()->default_value('F'),
             "F = forward, B = backward.\n"
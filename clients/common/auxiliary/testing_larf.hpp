@@ -307,7 +307,7 @@ void testing_larf(Arguments& argus)
         CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
         if(argus.mem_query)
         {
-            rocsolver_bench_inform(inform_mem_query, size);
+            rocsolver_bench_inform_mem_query(handle, size, argus.mem_query > 1);
             return;
         }
 
@@ -0,0 +1,369 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+template <typename T>
+void orgqr_ungqr_tsqr_checkBadArgs(const rocblas_handle handle,
+                                   const rocblas_int m,
+                                   const rocblas_int n,
+                                   T dA,
+                                   const rocblas_int lda,
+                                   T dIpiv)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_orgqr_ungqr_tsqr(nullptr, m, n, dA, lda, dIpiv),
+                          rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_orgqr_ungqr_tsqr(handle, m, n, (T) nullptr, lda, dIpiv),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_orgqr_ungqr_tsqr(handle, m, n, dA, lda, (T) nullptr),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_orgqr_ungqr_tsqr(handle, 0, 0, (T) nullptr, lda, (T) nullptr),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_orgqr_ungqr_tsqr(handle, m, 0, (T) nullptr, lda, (T) nullptr),
+                          rocblas_status_success);
+}
+
+template <typename T>
+void testing_orgqr_ungqr_tsqr_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int m = 1;
+    rocblas_int n = 1;
+    rocblas_int lda = 1;
+
+    // memory allocation
+    device_strided_batch_vector<T> dA(1, 1, 1, 1);
+    device_strided_batch_vector<T> dIpiv(2, 1, 2, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+
+    // check bad arguments
+    orgqr_ungqr_tsqr_checkBadArgs(handle, m, n, dA.data(), lda, dIpiv.data());
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void orgqr_ungqr_tsqr_initData(const rocblas_handle handle,
+                               const rocblas_int m,
+                               const rocblas_int n,
+                               Td& dA,
+                               const rocblas_int lda,
+                               Td& dIpiv,
+                               Th& hA)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+
+        // scale to avoid singularities
+        for(int i = 0; i < m; ++i)
+        {
+            for(int j = 0; j < n; ++j)
+            {
+                if(i == j)
+                    hA[0][i + j * lda] += 400;
+                else
+                    hA[0][i + j * lda] -= 4;
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // copy data from CPU to device
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+        // compute tall-skinny QR factorization
+        // (the format of the Householder vectors of the tree is not available in LAPACK)
+        CHECK_ROCBLAS_ERROR(
+            rocsolver_geqrf_tsqr(false, handle, m, n, dA.data(), lda, 0, dIpiv.data(), 0, 1));
+    }
+}
+
+template <typename T, typename Td, typename Th>
+void orgqr_ungqr_tsqr_getError(const rocblas_handle handle,
+                               const rocblas_int m,
+                               const rocblas_int n,
+                               Td& dA,
+                               const rocblas_int lda,
+                               Td& dIpiv,
+                               Th& hA,
+                               Th& hAr,
+                               double* max_err)
+{
+    std::vector<T> hR(n * n);
+    std::vector<T> hI(n * n);
+    std::vector<T> hQQ(n * n);
+    std::vector<T> hQR(m * n);
+
+    // initialize data
+    orgqr_ungqr_tsqr_initData<true, true, T>(handle, m, n, dA, lda, dIpiv, hA);
+
+    // keep the triangular factor R
+    CHECK_HIP_ERROR(hAr.transfer_from(dA));
+    for(rocblas_int j = 0; j < n; j++)
+    {
+        for(rocblas_int i = 0; i < n; i++)
+        {
+            hR[i + j * n] = (i <= j) ? hAr[0][i + j * lda] : T(0);
+            hI[i + j * n] = (i == j) ? T(1) : T(0);
+        }
+    }
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_orgqr_ungqr_tsqr(handle, m, n, dA.data(), lda, dIpiv.data()));
+    CHECK_HIP_ERROR(hAr.transfer_from(dA));
+
+    // there is no CPU reference for this format; Q must have orthonormal columns and
+    // reproduce the original matrix:
+    // error is max(||I - Q'Q|| / ||I||, ||A - QR|| / ||A||)
+    // using frobenius norm
+    double err;
+    cpu_gemm(rocblas_operation_conjugate_transpose, rocblas_operation_none, n, n, m, T(1), hAr[0],
+             lda, hAr[0], lda, T(0), hQQ.data(), n);
+    *max_err = norm_error('F', n, n, n, hI.data(), hQQ.data());
+
+    cpu_gemm(rocblas_operation_none, rocblas_operation_none, m, n, n, T(1), hAr[0], lda, hR.data(),
+             n, T(0), hQR.data(), m);
+    err = norm_error('F', m, n, lda, hA[0], hQR.data(), m);
+    *max_err = err > *max_err ? err : *max_err;
+}
+
+template <typename T, typename Td, typename Th>
+void orgqr_ungqr_tsqr_getPerfData(const rocblas_handle handle,
+                                  const rocblas_int m,
+                                  const rocblas_int n,
+                                  Td& dA,
+                                  const rocblas_int lda,
+                                  Td& dIpiv,
+                                  Th& hA,
+                                  Th& hIpiv,
+                                  double* gpu_time_used,
+                                  double* cpu_time_used,
+                                  const rocblas_int hot_calls,
+                                  const int profile,
+                                  const bool profile_kernels,
+                                  const bool perf)
+{
+    size_t size_W = size_t(n);
+    std::vector<T> hW(size_W);
+
+    if(!perf)
+    {
+        orgqr_ungqr_tsqr_initData<true, false, T>(handle, m, n, dA, lda, dIpiv, hA);
+
+        // cpu-lapack performance (only if not in perf mode)
+        // (there is no tall-skinny QR in LAPACK; ORGQR is used instead)
+        cpu_geqrf(m, n, hA[0], lda, hIpiv[0], hW.data(), size_W);
+        *cpu_time_used = get_time_us_no_sync();
+        cpu_orgqr_ungqr(m, n, n, hA[0], lda, hIpiv[0], hW.data(), size_W);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    orgqr_ungqr_tsqr_initData<true, false, T>(handle, m, n, dA, lda, dIpiv, hA);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        orgqr_ungqr_tsqr_initData<false, true, T>(handle, m, n, dA, lda, dIpiv, hA);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_orgqr_ungqr_tsqr(handle, m, n, dA.data(), lda, dIpiv.data()));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(int iter = 0; iter < hot_calls; iter++)
+    {
+        orgqr_ungqr_tsqr_initData<false, true, T>(handle, m, n, dA, lda, dIpiv, hA);
+
+        start = get_time_us_sync(stream);
+        rocsolver_orgqr_ungqr_tsqr(handle, m, n, dA.data(), lda, dIpiv.data());
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <typename T>
+void testing_orgqr_ungqr_tsqr(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int m = argus.get<rocblas_int>("m", n);
+    rocblas_int lda = argus.get<rocblas_int>("lda", m);
+
+    rocblas_int hot_calls = argus.iters;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    // (the scalar factors of the tree need an array of size 2*m)
+    size_t size_A = size_t(lda) * n;
+    size_t size_P = size_t(2) * m;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_Ar = (argus.unit_check || argus.norm_check) ? size_A : 0;
+
+    // check invalid sizes
+    bool invalid_size = (m < 0 || n < 0 || lda < m || n > m);
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(
+            rocsolver_orgqr_ungqr_tsqr(handle, m, n, (T*)nullptr, lda, (T*)nullptr),
+            rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        CHECK_ALLOC_QUERY(rocsolver_orgqr_ungqr_tsqr(handle, m, n, (T*)nullptr, lda, (T*)nullptr));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform_mem_query(handle, size, argus.mem_query > 1);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T> hA(size_A, 1, size_A, 1);
+    host_strided_batch_vector<T> hAr(size_Ar, 1, size_Ar, 1);
+    host_strided_batch_vector<T> hIpiv(size_P, 1, size_P, 1);
+    device_strided_batch_vector<T> dA(size_A, 1, size_A, 1);
+    device_strided_batch_vector<T> dIpiv(size_P, 1, size_P, 1);
+    if(size_A)
+        CHECK_HIP_ERROR(dA.memcheck());
+    if(size_P)
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+
+    // check quick return
+    if(n == 0 || m == 0)
+    {
+        EXPECT_ROCBLAS_STATUS(
+            rocsolver_orgqr_ungqr_tsqr(handle, m, n, dA.data(), lda, dIpiv.data()),
+            rocblas_status_success);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_quick_return);
+
+        return;
+    }
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        orgqr_ungqr_tsqr_getError<T>(handle, m, n, dA, lda, dIpiv, hA, hAr, &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        orgqr_ungqr_tsqr_getPerfData<T>(handle, m, n, dA, lda, dIpiv, hA, hIpiv, &gpu_time_used,
+                                        &cpu_time_used, hot_calls, argus.profile,
+                                        argus.profile_kernels, argus.perf);
+
+    // validate results for rocsolver-test
+    // using m * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, m);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            rocsolver_bench_output("m", "n", "lda");
+            rocsolver_bench_output(m, n, lda);
+
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_ORGQR_UNGQR_TSQR(...) \
+    extern template void testing_orgqr_ungqr_tsqr<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_ORGQR_UNGQR_TSQR, FOREACH_SCALAR_TYPE, APPLY_STAMP)
@@ -29,4 +29,8 @@
 
 #define TESTING_ORGXR_UNGXR(...) template void testing_orgxr_ungxr<__VA_ARGS__>(Arguments&);
 
-INSTANTIATE(TESTING_ORGXR_UNGXR, FOREACH_SCALAR_TYPE, FOREACH_BLOCKED_VARIANT, APPLY_STAMP)
+INSTANTIATE(TESTING_ORGXR_UNGXR,
+            FOREACH_SCALAR_TYPE,
+            FOREACH_BLOCKED_VARIANT,
+            FOREACH_INT_TYPE,
+            APPLY_STAMP)
@@ -35,13 +35,13 @@
 #include "common/misc/rocsolver_arguments.hpp"
 #include "common/misc/rocsolver_test.hpp"
 
-template <bool GQR, typename T>
+template <bool GQR, typename T, typename I>
 void orgxr_ungxr_checkBadArgs(const rocblas_handle handle,
-                              const rocblas_int m,
-                              const rocblas_int n,
-                              const rocblas_int k,
+                              const I m,
+                              const I n,
+                              const I k,
                               T dA,
-                              const rocblas_int lda,
+                              const I lda,
                               T dIpiv)
 {
     // handle
@@ -58,21 +58,23 @@ void orgxr_ungxr_checkBadArgs(const rocblas_handle handle,
                           rocblas_status_invalid_pointer);
 
     // quick return with invalid pointers
-    EXPECT_ROCBLAS_STATUS(rocsolver_orgxr_ungxr(GQR, handle, 0, 0, 0, (T) nullptr, lda, (T) nullptr),
+    EXPECT_ROCBLAS_STATUS(rocsolver_orgxr_ungxr(GQR, handle, I(0), I(0), I(0), (T) nullptr, lda,
+                                                (T) nullptr),
                           rocblas_status_success);
-    EXPECT_ROCBLAS_STATUS(rocsolver_orgxr_ungxr(GQR, handle, m, 0, 0, (T) nullptr, lda, (T) nullptr),
+    EXPECT_ROCBLAS_STATUS(rocsolver_orgxr_ungxr(GQR, handle, m, I(0), I(0), (T) nullptr, lda,
+                                                (T) nullptr),
                           rocblas_status_success);
 }
 
-template <typename T, bool GQR>
+template <typename T, bool GQR, typename I>
 void testing_orgxr_ungxr_bad_arg()
 {
     // safe arguments
     rocblas_local_handle handle;
-    rocblas_int k = 1;
-    rocblas_int m = 1;
-    rocblas_int n = 1;
-    rocblas_int lda = 1;
+    I k = 1;
+    I m = 1;
+    I n = 1;
+    I lda = 1;
 
     // memory allocation
     device_strided_batch_vector<T> dA(1, 1, 1, 1);
@@ -84,13 +86,13 @@ void testing_orgxr_ungxr_bad_arg()
     orgxr_ungxr_checkBadArgs<GQR>(handle, m, n, k, dA.data(), lda, dIpiv.data());
 }
 
-template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+template <bool CPU, bool GPU, typename T, typename I, typename Td, typename Th>
 void orgxr_ungxr_initData(const rocblas_handle handle,
-                          const rocblas_int m,
-                          const rocblas_int n,
-                          const rocblas_int k,
+                          const I m,
+                          const I n,
+                          const I k,
                           Td& dA,
-                          const rocblas_int lda,
+                          const I lda,
                           Td& dIpiv,
                           Th& hA,
                           Th& hIpiv,
@@ -103,9 +105,9 @@ void orgxr_ungxr_initData(const rocblas_handle handle,
         rocblas_init<T>(hIpiv, true);
 
         // scale to avoid singularities
-        for(int i = 0; i < m; ++i)
+        for(I i = 0; i < m; ++i)
         {
-            for(int j = 0; j < k; ++j)
+            for(I j = 0; j < k; ++j)
             {
                 if(i == j)
                     hA[0][i + j * lda] += 400;
@@ -126,13 +128,13 @@ void orgxr_ungxr_initData(const rocblas_handle handle,
     }
 }
 
-template <bool GQR, typename T, typename Td, typename Th>
+template <bool GQR, typename T, typename I, typename Td, typename Th>
 void orgxr_ungxr_getError(const rocblas_handle handle,
-                          const rocblas_int m,
-                          const rocblas_int n,
-                          const rocblas_int k,
+                          const I m,
+                          const I n,
+                          const I k,
                           Td& dA,
-                          const rocblas_int lda,
+                          const I lda,
                           Td& dIpiv,
                           Th& hA,
                           Th& hAr,
@@ -161,13 +163,13 @@ void orgxr_ungxr_getError(const rocblas_handle handle,
     *max_err = norm_error('F', m, n, lda, hA[0], hAr[0]);
 }
 
-template <bool GQR, typename T, typename Td, typename Th>
+template <bool GQR, typename T, typename I, typename Td, typename Th>
 void orgxr_ungxr_getPerfData(const rocblas_handle handle,
-                             const rocblas_int m,
-                             const rocblas_int n,
-                             const rocblas_int k,
+                             const I m,
+                             const I n,
+                             const I k,
                              Td& dA,
-                             const rocblas_int lda,
+                             const I lda,
                              Td& dIpiv,
                              Th& hA,
                              Th& hIpiv,
@@ -228,15 +230,15 @@ void orgxr_ungxr_getPerfData(const rocblas_handle handle,
     *gpu_time_used /= hot_calls;
 }
 
-template <typename T, bool GQR>
+template <typename T, bool GQR, typename I>
 void testing_orgxr_ungxr(Arguments& argus)
 {
     // get arguments
     rocblas_local_handle handle;
-    rocblas_int n = argus.get<rocblas_int>("n");
-    rocblas_int m = argus.get<rocblas_int>("m", n);
-    rocblas_int k = argus.get<rocblas_int>("k", n);
-    rocblas_int lda = argus.get<rocblas_int>("lda", m);
+    I n = argus.get<rocblas_int>("n");
+    I m = argus.get<rocblas_int>("m", n);
+    I k = argus.get<rocblas_int>("k", n);
+    I lda = argus.get<rocblas_int>("lda", m);
 
     rocblas_int hot_calls = argus.iters;
 
@@ -274,7 +276,7 @@ void testing_orgxr_ungxr(Arguments& argus)
         CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
         if(argus.mem_query)
         {
-            rocsolver_bench_inform(inform_mem_query, size);
+            rocsolver_bench_inform_mem_query(handle, size, argus.mem_query > 1);
             return;
         }
 
@@ -358,4 +360,8 @@ void testing_orgxr_ungxr(Arguments& argus)
 #define EXTERN_TESTING_ORGXR_UNGXR(...) \
     extern template void testing_orgxr_ungxr<__VA_ARGS__>(Arguments&);
 
-INSTANTIATE(EXTERN_TESTING_ORGXR_UNGXR, FOREACH_SCALAR_TYPE, FOREACH_BLOCKED_VARIANT, APPLY_STAMP)
+INSTANTIATE(EXTERN_TESTING_ORGXR_UNGXR,
+            FOREACH_SCALAR_TYPE,
+            FOREACH_BLOCKED_VARIANT,
+            FOREACH_INT_TYPE,
+            APPLY_STAMP)
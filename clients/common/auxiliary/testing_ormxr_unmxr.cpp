@@ -29,4 +29,8 @@
 
 #define TESTING_ORMXR_UNMXR(...) template void testing_ormxr_unmxr<__VA_ARGS__>(Arguments&);
 
-INSTANTIATE(TESTING_ORMXR_UNMXR, FOREACH_SCALAR_TYPE, FOREACH_BLOCKED_VARIANT, APPLY_STAMP)
+INSTANTIATE(TESTING_ORMXR_UNMXR,
+            FOREACH_SCALAR_TYPE,
+            FOREACH_BLOCKED_VARIANT,
+            FOREACH_INT_TYPE,
+            APPLY_STAMP)
@@ -35,18 +35,18 @@
 #include "common/misc/rocsolver_arguments.hpp"
 #include "common/misc/rocsolver_test.hpp"
 
-template <bool MQR, bool COMPLEX, typename T>
+template <bool MQR, bool COMPLEX, typename T, typename I>
 void ormxr_unmxr_checkBadArgs(const rocblas_handle handle,
                               const rocblas_side side,
                               const rocblas_operation trans,
-                              const rocblas_int m,
-                              const rocblas_int n,
-                              const rocblas_int k,
+                              const I m,
+                              const I n,
+                              const I k,
                               T dA,
-                              const rocblas_int lda,
+                              const I lda,
                               T dIpiv,
                               T dC,
-                              const rocblas_int ldc)
+                              const I ldc)
 {
     // handle
     EXPECT_ROCBLAS_STATUS(
@@ -82,29 +82,29 @@ void ormxr_unmxr_checkBadArgs(const rocblas_handle handle,
         rocblas_status_invalid_pointer);
 
     // quick return with invalid pointers
-    EXPECT_ROCBLAS_STATUS(rocsolver_ormxr_unmxr(MQR, handle, rocblas_side_right, trans, 0, n, k, dA,
-                                                lda, dIpiv, (T) nullptr, ldc),
+    EXPECT_ROCBLAS_STATUS(rocsolver_ormxr_unmxr(MQR, handle, rocblas_side_right, trans, I(0), n, k,
+                                                dA, lda, dIpiv, (T) nullptr, ldc),
                           rocblas_status_success);
-    EXPECT_ROCBLAS_STATUS(rocsolver_ormxr_unmxr(MQR, handle, rocblas_side_left, trans, m, 0, k, dA,
-                                                lda, dIpiv, (T) nullptr, ldc),
+    EXPECT_ROCBLAS_STATUS(rocsolver_ormxr_unmxr(MQR, handle, rocblas_side_left, trans, m, I(0), k,
+                                                dA, lda, dIpiv, (T) nullptr, ldc),
                           rocblas_status_success);
-    EXPECT_ROCBLAS_STATUS(rocsolver_ormxr_unmxr(MQR, handle, rocblas_side_left, trans, m, n, 0,
+    EXPECT_ROCBLAS_STATUS(rocsolver_ormxr_unmxr(MQR, handle, rocblas_side_left, trans, m, n, I(0),
                                                 (T) nullptr, lda, (T) nullptr, dC, ldc),
                           rocblas_status_success);
 }
 
-template <typename T, bool MQR, bool COMPLEX = rocblas_is_complex<T>>
+template <typename T, bool MQR, typename I, bool COMPLEX = rocblas_is_complex<T>>
 void testing_ormxr_unmxr_bad_arg()
 {
     // safe arguments
     rocblas_local_handle handle;
     rocblas_side side = rocblas_side_left;
     rocblas_operation trans = rocblas_operation_none;
-    rocblas_int k = 1;
-    rocblas_int m = 1;
-    rocblas_int n = 1;
-    rocblas_int lda = 1;
-    rocblas_int ldc = 1;
+    I k = 1;
+    I m = 1;
+    I n = 1;
+    I lda = 1;
+    I ldc = 1;
 
     // memory allocation
     device_strided_batch_vector<T> dA(1, 1, 1, 1);
@@ -119,18 +119,18 @@ void testing_ormxr_unmxr_bad_arg()
                                            dIpiv.data(), dC.data(), ldc);
 }
 
-template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+template <bool CPU, bool GPU, typename T, typename I, typename Td, typename Th>
 void ormxr_unmxr_initData(const rocblas_handle handle,
                           const rocblas_side side,
                           const rocblas_operation trans,
-                          const rocblas_int m,
-                          const rocblas_int n,
-                          const rocblas_int k,
+                          const I m,
+                          const I n,
+                          const I k,
                           Td& dA,
-                          const rocblas_int lda,
+                          const I lda,
                           Td& dIpiv,
                           Td& dC,
-                          const rocblas_int ldc,
+                          const I ldc,
                           Th& hA,
                           Th& hIpiv,
                           Th& hC,
@@ -139,16 +139,16 @@ void ormxr_unmxr_initData(const rocblas_handle handle,
 {
     if(CPU)
     {
-        rocblas_int nq = (side == rocblas_side_left) ? m : n;
+        I nq = (side == rocblas_side_left) ? m : n;
 
         rocblas_init<T>(hA, true);
         rocblas_init<T>(hIpiv, true);
         rocblas_init<T>(hC, true);
 
         // scale to avoid singularities
-        for(int i = 0; i < nq; ++i)
+        for(I i = 0; i < nq; ++i)
         {
-            for(int j = 0; j < k; ++j)
+            for(I j = 0; j < k; ++j)
             {
                 if(i == j)
                     hA[0][i + j * lda] += 400;
@@ -170,18 +170,18 @@ void ormxr_unmxr_initData(const rocblas_handle handle,
     }
 }
 
-template <bool MQR, typename T, typename Td, typename Th>
+template <bool MQR, typename T, typename I, typename Td, typename Th>
 void ormxr_unmxr_getError(const rocblas_handle handle,
                           const rocblas_side side,
                           const rocblas_operation trans,
-                          const rocblas_int m,
-                          const rocblas_int n,
-                          const rocblas_int k,
+                          const I m,
+                          const I n,
+                          const I k,
                           Td& dA,
-                          const rocblas_int lda,
+                          const I lda,
                           Td& dIpiv,
                           Td& dC,
-                          const rocblas_int ldc,
+                          const I ldc,
                           Th& hA,
                           Th& hIpiv,
                           Th& hC,
@@ -212,18 +212,18 @@ void ormxr_unmxr_getError(const rocblas_handle handle,
     *max_err = norm_error('F', m, n, ldc, hC[0], hCr[0]);
 }
 
-template <bool MQR, typename T, typename Td, typename Th>
+template <bool MQR, typename T, typename I, typename Td, typename Th>
 void ormxr_unmxr_getPerfData(const rocblas_handle handle,
                              const rocblas_side side,
                              const rocblas_operation trans,
-                             const rocblas_int m,
-                             const rocblas_int n,
-                             const rocblas_int k,
+                             const I m,
+                             const I n,
+                             const I k,
                              Td& dA,
-                             const rocblas_int lda,
+                             const I lda,
                              Td& dIpiv,
                              Td& dC,
-                             const rocblas_int ldc,
+                             const I ldc,
                              Th& hA,
                              Th& hIpiv,
                              Th& hC,
@@ -291,14 +291,14 @@ void ormxr_unmxr_getPerfData(const rocblas_handle handle,
     *gpu_time_used /= hot_calls;
 }
 
-template <typename T, bool MQR, bool COMPLEX = rocblas_is_complex<T>>
+template <typename T, bool MQR, typename I, bool COMPLEX = rocblas_is_complex<T>>
 void testing_ormxr_unmxr(Arguments& argus)
 {
     // get arguments
     rocblas_local_handle handle;
     char sideC = argus.get<char>("side");
     char transC = argus.get<char>("trans");
-    rocblas_int m, n, k;
+    I m, n, k;
     if(sideC == 'L')
     {
         m = argus.get<rocblas_int>("m");
@@ -311,8 +311,8 @@ void testing_ormxr_unmxr(Arguments& argus)
         m = argus.get<rocblas_int>("m", n);
         k = argus.get<rocblas_int>("k", n);
     }
-    rocblas_int lda = argus.get<rocblas_int>("lda", sideC == 'L' ? m : n);
-    rocblas_int ldc = argus.get<rocblas_int>("ldc", m);
+    I lda = argus.get<rocblas_int>("lda", sideC == 'L' ? m : n);
+    I ldc = argus.get<rocblas_int>("ldc", m);
 
     rocblas_side side = char2rocblas_side(sideC);
     rocblas_operation trans = char2rocblas_operation(transC);
@@ -369,7 +369,7 @@ void testing_ormxr_unmxr(Arguments& argus)
         CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
         if(argus.mem_query)
         {
-            rocsolver_bench_inform(inform_mem_query, size);
+            rocsolver_bench_inform_mem_query(handle, size, argus.mem_query > 1);
             return;
         }
 
@@ -417,7 +417,7 @@ void testing_ormxr_unmxr(Arguments& argus)
 
     // validate results for rocsolver-test
     // using s * machine_precision as tolerance
-    rocblas_int s = left ? m : n;
+    I s = left ? m : n;
     if(argus.unit_check)
         ROCSOLVER_TEST_CHECK(T, max_error, s);
 
@@ -459,4 +459,8 @@ void testing_ormxr_unmxr(Arguments& argus)
 #define EXTERN_TESTING_ORMXR_UNMXR(...) \
     extern template void testing_ormxr_unmxr<__VA_ARGS__>(Arguments&);
 
-INSTANTIATE(EXTERN_TESTING_ORMXR_UNMXR, FOREACH_SCALAR_TYPE, FOREACH_BLOCKED_VARIANT, APPLY_STAMP)
+INSTANTIATE(EXTERN_TESTING_ORMXR_UNMXR,
+            FOREACH_SCALAR_TYPE,
+            FOREACH_BLOCKED_VARIANT,
+            FOREACH_INT_TYPE,
+            APPLY_STAMP)
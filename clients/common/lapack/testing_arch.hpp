@@ -0,0 +1,210 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+#pragma once
+
+#include <cstring>
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+// sets arch to the description of the device of the handle with a small LDS
+inline void arch_small_lds(const rocblas_handle handle, rocsolver_arch_info* arch)
+{
+    CHECK_ROCBLAS_ERROR(rocsolver_get_arch_info(handle, arch));
+    std::strncpy(arch->name, "test", sizeof(arch->name) - 1);
+    arch->lds_size = 1024;
+}
+
+inline void testing_arch_bad_arg()
+{
+    rocblas_local_handle handle;
+    rocsolver_arch_info device, arch, fake;
+    arch_small_lds(handle, &fake);
+
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_get_arch_info(nullptr, &arch), rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocsolver_set_arch_info(nullptr, &fake), rocblas_status_invalid_handle);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_get_arch_info(handle, nullptr),
+                          rocblas_status_invalid_pointer);
+
+    // values
+    arch = fake;
+    arch.wavefront_size = 0;
+    EXPECT_ROCBLAS_STATUS(rocsolver_set_arch_info(handle, &arch), rocblas_status_invalid_value);
+    arch = fake;
+    arch.lds_size = -1;
+    EXPECT_ROCBLAS_STATUS(rocsolver_set_arch_info(handle, &arch), rocblas_status_invalid_value);
+    arch = fake;
+    arch.cu_count = 0;
+    EXPECT_ROCBLAS_STATUS(rocsolver_set_arch_info(handle, &arch), rocblas_status_invalid_value);
+
+    // the description of the device is detected and cached
+    CHECK_ROCBLAS_ERROR(rocsolver_get_arch_info(handle, &device));
+    EXPECT_STRNE(device.name, "");
+    EXPECT_TRUE(device.wavefront_size == 32 || device.wavefront_size == 64);
+    EXPECT_GT(device.lds_size, 0);
+    EXPECT_GT(device.cu_count, 0);
+    CHECK_ROCBLAS_ERROR(rocsolver_get_arch_info(handle, &arch));
+    EXPECT_STREQ(arch.name, device.name);
+    EXPECT_EQ(arch.wavefront_size, device.wavefront_size);
+    EXPECT_EQ(arch.lds_size, device.lds_size);
+    EXPECT_EQ(arch.cu_count, device.cu_count);
+    EXPECT_EQ(arch.flags, device.flags);
+
+    // it can be overridden
+    CHECK_ROCBLAS_ERROR(rocsolver_set_arch_info(handle, &fake));
+    CHECK_ROCBLAS_ERROR(rocsolver_get_arch_info(handle, &arch));
+    EXPECT_STREQ(arch.name, fake.name);
+    EXPECT_EQ(arch.lds_size, fake.lds_size);
+
+    // a null description restores the one of the device
+    CHECK_ROCBLAS_ERROR(rocsolver_set_arch_info(handle, nullptr));
+    CHECK_ROCBLAS_ERROR(rocsolver_get_arch_info(handle, &arch));
+    EXPECT_STREQ(arch.name, device.name);
+    EXPECT_EQ(arch.lds_size, device.lds_size);
+
+    // releasing the resources also restores it
+    CHECK_ROCBLAS_ERROR(rocsolver_set_arch_info(handle, &fake));
+    CHECK_ROCBLAS_ERROR(rocsolver_release_handle_resources(handle));
+    CHECK_ROCBLAS_ERROR(rocsolver_get_arch_info(handle, &arch));
+    EXPECT_STREQ(arch.name, device.name);
+}
+
+template <typename T, typename Th>
+void arch_initData(Th& hA, const rocblas_int n, const rocblas_int lda)
+{
+    rocblas_init<T>(hA, true);
+
+    // make the matrices diagonally dominant, so that they are Hermitian positive definite
+    for(rocblas_int b = 0; b < hA.batch_count(); ++b)
+    {
+        for(rocblas_int i = 0; i < n; i++)
+        {
+            for(rocblas_int j = 0; j < n; j++)
+            {
+                if(i == j)
+                    hA[b][i + j * lda] = std::real(hA[b][i + j * lda]) + 400;
+                else
+                    hA[b][i + j * lda] -= 4;
+            }
+        }
+    }
+}
+
+/** The small-size kernel of POTF2 keeps the packed triangular matrix in the LDS, so on a
+    device whose description reports a smaller LDS the general algorithm must be selected, which
+    requires more workspace. Executes the function given by the "function" argument with the
+    description of the device and with the smaller LDS, and compares the results. **/
+template <bool STRIDED, typename T>
+void testing_arch(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    std::string function = argus.get<std::string>("function");
+    char uploC = argus.get<char>("uplo");
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_fill uplo = char2rocblas_fill(uploC);
+    rocblas_int lda = n;
+    rocblas_stride stA = lda * n;
+    rocblas_int bc = argus.batch_count;
+
+    bool POTRF;
+    if(function == "potf2" || function == "potrf")
+        POTRF = (function == "potrf");
+    else
+        FAIL() << "unknown function " << function;
+
+    rocsolver_arch_info device, fake;
+    CHECK_ROCBLAS_ERROR(rocsolver_get_arch_info(handle, &device));
+    arch_small_lds(handle, &fake);
+
+    // memory allocations
+    host_strided_batch_vector<T> hA(stA, 1, stA, bc);
+    host_strided_batch_vector<T> hR(stA, 1, stA, bc);
+    host_strided_batch_vector<T> hRfake(stA, 1, stA, bc);
+    host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hInfofake(1, 1, 1, bc);
+    device_strided_batch_vector<T> dA(stA, 1, stA, bc);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    arch_initData<T>(hA, n, lda);
+
+    auto query = [&](const rocsolver_arch_info* arch, size_t* size) {
+        CHECK_ROCBLAS_ERROR(rocsolver_set_arch_info(handle, arch));
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        CHECK_ALLOC_QUERY(rocsolver_potf2_potrf(STRIDED, POTRF, handle, uplo, n, dA.data(), lda,
+                                                stA, dInfo.data(), bc));
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, size));
+    };
+
+    auto factorize = [&](const rocsolver_arch_info* arch, host_strided_batch_vector<T>& hRes,
+                         host_strided_batch_vector<rocblas_int>& hInfores) {
+        CHECK_ROCBLAS_ERROR(rocsolver_set_arch_info(handle, arch));
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_ROCBLAS_ERROR(rocsolver_potf2_potrf(STRIDED, POTRF, handle, uplo, n, dA.data(), lda,
+                                                  stA, dInfo.data(), bc));
+        CHECK_HIP_ERROR(hRes.transfer_from(dA));
+        CHECK_HIP_ERROR(hInfores.transfer_from(dInfo));
+    };
+
+    // the general algorithm requires more workspace than the small-size kernel
+    if(sizeof(T) * n * (n + 1) / 2 <= size_t(device.lds_size))
+    {
+        size_t size_device, size_fake;
+        query(nullptr, &size_device);
+        query(&fake, &size_fake);
+        EXPECT_GT(size_fake, size_device);
+    }
+
+    factorize(nullptr, hR, hInfo);
+    factorize(&fake, hRfake, hInfofake);
+
+    // the info and the factors must coincide up to round-off
+    // (the other triangle is not referenced)
+    double max_error = 0, err;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        EXPECT_EQ(hInfo[b][0], 0) << "where b = " << b;
+        EXPECT_EQ(hInfofake[b][0], hInfo[b][0]) << "where b = " << b;
+        if(uplo == rocblas_fill_lower)
+            err = norm_error_lowerTr('F', n, n, lda, hR[b], hRfake[b]);
+        else
+            err = norm_error_upperTr('F', n, n, lda, hR[b], hRfake[b]);
+        max_error = std::max(max_error, err);
+    }
+    ROCSOLVER_TEST_CHECK(T, max_error, n);
+}
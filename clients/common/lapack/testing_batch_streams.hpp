@@ -0,0 +1,224 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+inline void testing_batch_streams_bad_arg()
+{
+    rocblas_local_handle handle;
+    rocblas_int count = -1;
+
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_set_batch_streams(nullptr, 4), rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocsolver_get_batch_streams(nullptr, &count),
+                          rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_set_batch_streams(handle, -1), rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_get_batch_streams(handle, nullptr),
+                          rocblas_status_invalid_pointer);
+
+    // disabled by default
+    CHECK_ROCBLAS_ERROR(rocsolver_get_batch_streams(handle, &count));
+    EXPECT_EQ(count, 0);
+
+    CHECK_ROCBLAS_ERROR(rocsolver_set_batch_streams(handle, 4));
+    CHECK_ROCBLAS_ERROR(rocsolver_get_batch_streams(handle, &count));
+    EXPECT_EQ(count, 4);
+
+    // releasing the resources restores the default
+    CHECK_ROCBLAS_ERROR(rocsolver_release_handle_resources(handle));
+    CHECK_ROCBLAS_ERROR(rocsolver_get_batch_streams(handle, &count));
+    EXPECT_EQ(count, 0);
+}
+
+/** Computes the eigenvalues and eigenvectors of the batch with SYEVJ/HEEVJ, without splitting
+    the batch and split across the number of streams given by the "streams" argument, and
+    compares the results. The problems are processed independently, so the results must be
+    identical. The eigenvalues, sweeps and info values are copied on the stream of the handle,
+    which is the only one synchronized. **/
+template <bool STRIDED, typename T, typename Td, typename Th>
+void batch_streams_getError(const rocblas_handle handle,
+                            const hipStream_t stream,
+                            const rocblas_int streams,
+                            const rocblas_int n,
+                            Td& dA,
+                            const rocblas_int lda,
+                            const rocblas_stride stA,
+                            const rocblas_int bc,
+                            Th& hA,
+                            Th& hV,
+                            Th& hVs)
+{
+    using S = decltype(std::real(T{}));
+    rocblas_stride stW = n;
+
+    // memory allocations
+    host_strided_batch_vector<S> hW(stW, 1, stW, bc);
+    host_strided_batch_vector<S> hWs(stW, 1, stW, bc);
+    host_strided_batch_vector<rocblas_int> hSweeps(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hSweepss(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hInfos(1, 1, 1, bc);
+    device_strided_batch_vector<S> dW(stW, 1, stW, bc);
+    device_strided_batch_vector<S> dResidual(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dSweeps(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+    CHECK_HIP_ERROR(dW.memcheck());
+    CHECK_HIP_ERROR(dResidual.memcheck());
+    CHECK_HIP_ERROR(dSweeps.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    auto run = [&]() {
+        return rocsolver_syevj_heevj(STRIDED, handle, rocblas_esort_ascending,
+                                     rocblas_evect_original, rocblas_fill_upper, n, dA.data(),
+                                     lda, stA, S(0), dResidual.data(), 100, dSweeps.data(),
+                                     dW.data(), stW, dInfo.data(), bc);
+    };
+
+    auto execute = [&](Th& hVRes, host_strided_batch_vector<S>& hWRes,
+                       host_strided_batch_vector<rocblas_int>& hSweepsRes,
+                       host_strided_batch_vector<rocblas_int>& hInfoRes) {
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_ROCBLAS_ERROR(run());
+        CHECK_HIP_ERROR(hipMemcpyAsync(hWRes.data(), dW.data(), sizeof(S) * stW * bc,
+                                       hipMemcpyDeviceToHost, stream));
+        CHECK_HIP_ERROR(hipMemcpyAsync(hSweepsRes.data(), dSweeps.data(), sizeof(rocblas_int) * bc,
+                                       hipMemcpyDeviceToHost, stream));
+        CHECK_HIP_ERROR(hipMemcpyAsync(hInfoRes.data(), dInfo.data(), sizeof(rocblas_int) * bc,
+                                       hipMemcpyDeviceToHost, stream));
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+        CHECK_HIP_ERROR(hVRes.transfer_from(dA));
+
+        // the chunks are enqueued with the handle itself, which gets its stream back
+        hipStream_t current;
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &current));
+        EXPECT_EQ(current, stream);
+    };
+
+    auto compare = [&]() {
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            EXPECT_EQ(hInfos[b][0], hInfo[b][0]) << "where b = " << b;
+            EXPECT_EQ(hSweepss[b][0], hSweeps[b][0]) << "where b = " << b;
+            for(rocblas_int i = 0; i < n; i++)
+                EXPECT_EQ(hWs[b][i], hW[b][i]) << "where b = " << b << ", i = " << i;
+            for(rocblas_int j = 0; j < n; j++)
+                for(rocblas_int i = 0; i < n; i++)
+                    ASSERT_EQ(hVs[b][i + j * lda], hV[b][i + j * lda])
+                        << "where b = " << b << ", i = " << i << ", j = " << j;
+        }
+    };
+
+    // reference execution
+    execute(hV, hW, hSweeps, hInfo);
+
+    // every stream carves its own workspace
+    size_t size, size_split;
+    CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+    CHECK_ALLOC_QUERY(run());
+    CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+    CHECK_ROCBLAS_ERROR(rocsolver_set_batch_streams(handle, streams));
+    CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+    CHECK_ALLOC_QUERY(run());
+    CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size_split));
+    EXPECT_GE(size_split, size);
+
+    // the batch is split
+    execute(hVs, hWs, hSweepss, hInfos);
+    compare();
+
+    // the batch is not split in capture-safe mode
+    rocblas_status status = rocsolver_set_capture_safe(handle, true);
+    if(status != rocblas_status_arch_mismatch)
+    {
+        CHECK_ROCBLAS_ERROR(status);
+        execute(hVs, hWs, hSweepss, hInfos);
+        compare();
+        CHECK_ROCBLAS_ERROR(rocsolver_set_capture_safe(handle, false));
+    }
+
+    CHECK_ROCBLAS_ERROR(rocsolver_set_batch_streams(handle, 0));
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_batch_streams(Arguments& argus)
+{
+    // get arguments
+    // (the handle is destroyed before its stream)
+    rocblas_local_stream stream;
+    rocblas_local_handle handle;
+    rocblas_int streams = argus.get<rocblas_int>("streams");
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int lda = n;
+    rocblas_stride stA = lda * n;
+    rocblas_int bc = argus.batch_count;
+
+    CHECK_HIP_ERROR(stream.memcheck());
+    CHECK_ROCBLAS_ERROR(rocblas_set_stream(handle, stream));
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(stA, 1, bc);
+        host_batch_vector<T> hV(stA, 1, bc);
+        host_batch_vector<T> hVs(stA, 1, bc);
+        device_batch_vector<T> dA(stA, 1, bc);
+        CHECK_HIP_ERROR(dA.memcheck());
+
+        rocblas_init<T>(hA, true);
+
+        // check computations
+        batch_streams_getError<STRIDED, T>(handle, stream, streams, n, dA, lda, stA, bc, hA, hV,
+                                           hVs);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(stA, 1, stA, bc);
+        host_strided_batch_vector<T> hV(stA, 1, stA, bc);
+        host_strided_batch_vector<T> hVs(stA, 1, stA, bc);
+        device_strided_batch_vector<T> dA(stA, 1, stA, bc);
+        CHECK_HIP_ERROR(dA.memcheck());
+
+        rocblas_init<T>(hA, true);
+
+        // check computations
+        batch_streams_getError<STRIDED, T>(handle, stream, streams, n, dA, lda, stA, bc, hA, hV,
+                                           hVs);
+    }
+}
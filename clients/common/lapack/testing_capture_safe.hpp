@@ -0,0 +1,507 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+inline void testing_capture_safe_bad_arg()
+{
+    rocblas_local_handle handle;
+
+    // safe arguments
+    bool enable = true;
+    EXPECT_ROCBLAS_STATUS(rocsolver_get_capture_safe(handle, &enable), rocblas_status_success);
+    EXPECT_FALSE(enable);
+
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_set_capture_safe(nullptr, true), rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocsolver_get_capture_safe(nullptr, &enable),
+                          rocblas_status_invalid_handle);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_get_capture_safe(handle, nullptr),
+                          rocblas_status_invalid_pointer);
+
+    // architectures that require synchronizations cannot be set in capture-safe mode
+    rocsolver_arch_info arch;
+    CHECK_ROCBLAS_ERROR(rocsolver_get_arch_info(handle, &arch));
+    if(arch.flags & rocsolver_arch_flag_blas_sync)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_set_capture_safe(handle, true),
+                              rocblas_status_arch_mismatch);
+        CHECK_ROCBLAS_ERROR(rocsolver_get_capture_safe(handle, &enable));
+        EXPECT_FALSE(enable);
+    }
+    else
+    {
+        CHECK_ROCBLAS_ERROR(rocsolver_set_capture_safe(handle, true));
+        CHECK_ROCBLAS_ERROR(rocsolver_get_capture_safe(handle, &enable));
+        EXPECT_TRUE(enable);
+
+        rocsolver_arch_info sync_arch = arch;
+        sync_arch.flags = rocsolver_arch_flag(sync_arch.flags | rocsolver_arch_flag_blas_sync);
+        EXPECT_ROCBLAS_STATUS(rocsolver_set_arch_info(handle, &sync_arch),
+                              rocblas_status_arch_mismatch);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_set_capture_safe(handle, false));
+        CHECK_ROCBLAS_ERROR(rocsolver_get_capture_safe(handle, &enable));
+        EXPECT_FALSE(enable);
+    }
+}
+
+/** The variable-size batched functions read the sizes of the problems on the host, so
+    they cannot be executed in capture-safe mode. **/
+template <typename T>
+void testing_capture_safe_vbatched()
+{
+    rocblas_local_handle handle;
+    rocblas_status status = rocsolver_set_capture_safe(handle, true);
+    if(status == rocblas_status_arch_mismatch)
+        GTEST_SKIP() << "capture-safe mode is not supported on this architecture";
+    CHECK_ROCBLAS_ERROR(status);
+
+    // safe arguments
+    rocblas_int n = 1;
+    rocblas_int bc = 1;
+
+    // memory allocations
+    host_strided_batch_vector<rocblas_int> hN(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dN(1, 1, 1, 1);
+    device_batch_vector<T> dA(1, 1, 1);
+    device_batch_vector<T> dB(1, 1, 1);
+    device_batch_vector<T> dTau(1, 1, 1);
+    device_batch_vector<rocblas_int> dIpiv(1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dN.memcheck());
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dTau.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+    hN[0][0] = n;
+    CHECK_HIP_ERROR(dN.transfer_from(hN));
+
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_vbatched(handle, dN.data(), dN.data(), dA.data(),
+                                                   dN.data(), dIpiv.data(), dInfo.data(), n, n,
+                                                   bc),
+                          rocblas_status_not_implemented);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(handle, rocblas_operation_none, dN.data(),
+                                                   dN.data(), dA.data(), dN.data(),
+                                                   (const rocblas_int* const*)dIpiv.data(),
+                                                   dB.data(), dN.data(), n, n, bc),
+                          rocblas_status_not_implemented);
+    EXPECT_ROCBLAS_STATUS(rocsolver_potrf_vbatched(handle, rocblas_fill_lower, dN.data(),
+                                                   dA.data(), dN.data(), dInfo.data(), n, bc),
+                          rocblas_status_not_implemented);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqrf_vbatched(handle, dN.data(), dN.data(), dA.data(),
+                                                   dN.data(), dTau.data(), n, n, bc),
+                          rocblas_status_not_implemented);
+
+    // the size of the workspace only depends on the largest sizes, so it can still be queried
+    size_t size;
+    CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_vbatched(handle, (rocblas_int*)nullptr,
+                                                   (rocblas_int*)nullptr, (T* const*)nullptr,
+                                                   (rocblas_int*)nullptr,
+                                                   (rocblas_int* const*)nullptr,
+                                                   (rocblas_int*)nullptr, n, n, bc),
+                          rocblas_status_size_increased);
+    CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+    EXPECT_GT(size, 0);
+}
+
+template <typename T, typename Th>
+void capture_safe_initData(Th& hA, const rocblas_int n, const rocblas_int lda, const bool seed)
+{
+    rocblas_init<T>(hA, seed);
+
+    // make the matrices diagonally dominant, so that their lower (or upper) triangular
+    // parts define Hermitian positive definite matrices
+    for(rocblas_int b = 0; b < hA.batch_count(); ++b)
+    {
+        for(rocblas_int i = 0; i < n; i++)
+        {
+            for(rocblas_int j = 0; j < n; j++)
+            {
+                if(i == j)
+                    hA[b][i + j * lda] = std::real(hA[b][i + j * lda]) + 10 * n;
+                else
+                    hA[b][i + j * lda] -= 4;
+            }
+        }
+    }
+}
+
+// appends the values of the given host or device array to out (the real and imaginary parts
+// of complex values separately)
+template <typename U>
+void capture_safe_append(std::vector<double>& out, host_strided_batch_vector<U>& h)
+{
+    for(int64_t b = 0; b < h.batch_count(); ++b)
+    {
+        for(int64_t i = 0; i < h.n(); ++i)
+        {
+            out.push_back(double(std::real(h[b][i])));
+            out.push_back(double(std::imag(h[b][i])));
+        }
+    }
+}
+
+template <typename U>
+void capture_safe_append(std::vector<double>& out, device_strided_batch_vector<U>& d)
+{
+    host_strided_batch_vector<U> h(d.n(), 1, d.n(), d.batch_count());
+    CHECK_HIP_ERROR(h.transfer_from(d));
+    capture_safe_append(out, h);
+}
+
+/** Executes run eagerly, and then captures it into a HIP graph on the stream of the handle
+    and replays it; init sets the inputs before each execution, and the outputs collected by
+    get must coincide. (The eager execution also makes the device memory of the handle large
+    enough before the capture.) **/
+template <typename T, typename I, typename R, typename G>
+void capture_safe_check(const rocblas_handle handle, const rocblas_int n, I init, R run, G get)
+{
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+    std::vector<double> expected, result;
+    init();
+    CHECK_ROCBLAS_ERROR(run());
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    get(expected);
+
+    init();
+    hipGraph_t graph = nullptr;
+    hipGraphExec_t exec = nullptr;
+    CHECK_HIP_ERROR(hipStreamBeginCapture(stream, hipStreamCaptureModeGlobal));
+    rocblas_status status = run();
+    // (the capture is invalidated by any synchronization with the host)
+    CHECK_HIP_ERROR(hipStreamEndCapture(stream, &graph));
+    CHECK_ROCBLAS_ERROR(status);
+
+    CHECK_HIP_ERROR(hipGraphInstantiate(&exec, graph, nullptr, nullptr, 0));
+    CHECK_HIP_ERROR(hipGraphLaunch(exec, stream));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    CHECK_HIP_ERROR(hipGraphExecDestroy(exec));
+    CHECK_HIP_ERROR(hipGraphDestroy(graph));
+    get(result);
+
+    // the replay executes the same kernels on the same inputs
+    ASSERT_EQ(result.size(), expected.size());
+    double max_error = 0;
+    for(size_t i = 0; i < result.size(); ++i)
+        max_error
+            = std::max(max_error, std::abs(result[i] - expected[i]) / (1 + std::abs(expected[i])));
+    ROCSOLVER_TEST_CHECK(T, max_error, n);
+}
+
+template <typename T>
+void testing_capture_safe(Arguments& argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    // (the handle is destroyed before its stream)
+    rocblas_local_stream stream;
+    rocblas_local_handle handle;
+    std::string function = argus.get<std::string>("function");
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int lda = n;
+    rocblas_stride stA = lda * n;
+    rocblas_int bc = argus.batch_count;
+    rocblas_int nrhs = 3;
+
+    CHECK_HIP_ERROR(stream.memcheck());
+    CHECK_ROCBLAS_ERROR(rocblas_set_stream(handle, stream));
+    rocblas_status status = rocsolver_set_capture_safe(handle, true);
+    if(status == rocblas_status_arch_mismatch)
+        GTEST_SKIP() << "capture-safe mode is not supported on this architecture";
+    CHECK_ROCBLAS_ERROR(status);
+
+    // memory allocations
+    // (all the matrices are n-by-n; the right-hand sides are their first nrhs columns)
+    host_strided_batch_vector<T> hA(stA, 1, stA, bc);
+    host_strided_batch_vector<T> hB(stA, 1, stA, bc);
+    host_strided_batch_vector<T> hC(stA, 1, stA, bc);
+    host_strided_batch_vector<T> hD(stA, 1, stA, bc);
+    device_strided_batch_vector<T> dA(stA, 1, stA, bc);
+    device_strided_batch_vector<T> dB(stA, 1, stA, bc);
+    device_strided_batch_vector<T> dC(stA, 1, stA, bc);
+    device_strided_batch_vector<T> dD(stA, 1, stA, bc);
+    device_strided_batch_vector<T> dTau(n, 1, n, bc);
+    device_strided_batch_vector<S> dW(n, 1, n, bc);
+    device_strided_batch_vector<S> dResidual(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dInt(n, 1, n, bc);
+    device_strided_batch_vector<rocblas_int> dInt2(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dInfo2(1, 1, 1, bc);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dC.memcheck());
+    CHECK_HIP_ERROR(dD.memcheck());
+    CHECK_HIP_ERROR(dTau.memcheck());
+    CHECK_HIP_ERROR(dW.memcheck());
+    CHECK_HIP_ERROR(dResidual.memcheck());
+    CHECK_HIP_ERROR(dInt.memcheck());
+    CHECK_HIP_ERROR(dInt2.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+    CHECK_HIP_ERROR(dInfo2.memcheck());
+
+    capture_safe_initData<T>(hA, n, lda, true);
+    capture_safe_initData<T>(hB, n, lda, false);
+    capture_safe_initData<T>(hC, n, lda, false);
+    capture_safe_initData<T>(hD, n, lda, false);
+
+    auto init = [&] {
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+        CHECK_HIP_ERROR(dC.transfer_from(hC));
+        CHECK_HIP_ERROR(dD.transfer_from(hD));
+    };
+
+    if(function == "syevj_heevj")
+    {
+        // the batch is not split across streams in capture-safe mode
+        CHECK_ROCBLAS_ERROR(rocsolver_set_batch_streams(handle, bc));
+        capture_safe_check<T>(
+            handle, n, init,
+            [&] {
+                return rocsolver_syevj_heevj(true, handle, rocblas_esort_ascending,
+                                             rocblas_evect_original, rocblas_fill_upper, n,
+                                             dA.data(), lda, stA, S(0), dResidual.data(), 100,
+                                             dInt2.data(), dW.data(), n, dInfo.data(), bc);
+            },
+            [&](std::vector<double>& out) {
+                capture_safe_append(out, dInfo);
+                capture_safe_append(out, dInt2);
+                capture_safe_append(out, dW);
+                capture_safe_append(out, dA);
+            });
+    }
+    else if(function == "syevdj_heevdj")
+    {
+        capture_safe_check<T>(
+            handle, n, init,
+            [&] {
+                return rocsolver_syevdj_heevdj(true, handle, rocblas_evect_original,
+                                               rocblas_fill_lower, n, dA.data(), lda, stA,
+                                               dW.data(), n, dInfo.data(), bc);
+            },
+            [&](std::vector<double>& out) {
+                capture_safe_append(out, dInfo);
+                capture_safe_append(out, dW);
+            });
+    }
+    else if(function == "sygvj_hegvj")
+    {
+        capture_safe_check<T>(
+            handle, n, init,
+            [&] {
+                return rocsolver_sygvj_hegvj(true, handle, rocblas_eform_ax, rocblas_evect_original,
+                                             rocblas_fill_upper, n, dA.data(), lda, stA, dB.data(),
+                                             lda, stA, S(0), dResidual.data(), 100, dInt2.data(),
+                                             dW.data(), n, dInfo.data(), bc);
+            },
+            [&](std::vector<double>& out) {
+                capture_safe_append(out, dInfo);
+                capture_safe_append(out, dInt2);
+                capture_safe_append(out, dW);
+            });
+    }
+    else if(function == "gesvdj")
+    {
+        capture_safe_check<T>(
+            handle, n, init,
+            [&] {
+                return rocsolver_gesvdj(true, handle, rocblas_svect_none, rocblas_svect_none, n, n,
+                                        dA.data(), lda, stA, S(0), dResidual.data(), 100,
+                                        dInt2.data(), dW.data(), n, dB.data(), lda, stA,
+                                        dC.data(), lda, stA, dInfo.data(), bc);
+            },
+            [&](std::vector<double>& out) {
+                capture_safe_append(out, dInfo);
+                capture_safe_append(out, dInt2);
+                capture_safe_append(out, dW);
+            });
+    }
+    else if(function == "syevdx_heevdx_inplace")
+    {
+        // nev is returned on the device
+        capture_safe_check<T>(
+            handle, n, init,
+            [&] {
+                return rocsolver_syevdx_heevdx_inplace(false, handle, rocblas_evect_original,
+                                                       rocblas_erange_index, rocblas_fill_lower, n,
+                                                       dA.data(), lda, stA, S(0), S(0), 1, 10, S(0),
+                                                       dInt2.data(), dW.data(), n, dInfo.data(), 1);
+            },
+            [&](std::vector<double>& out) {
+                capture_safe_append(out, dInfo);
+                capture_safe_append(out, dInt2);
+                capture_safe_append(out, dW);
+            });
+    }
+    else if(function == "sygvdx_hegvdx_inplace")
+    {
+        // nev is returned on the device
+        capture_safe_check<T>(
+            handle, n, init,
+            [&] {
+                return rocsolver_sygvdx_hegvdx_inplace(
+                    false, handle, rocblas_eform_ax, rocblas_evect_original, rocblas_erange_index,
+                    rocblas_fill_upper, n, dA.data(), lda, stA, dB.data(), lda, stA, S(0), S(0), 1,
+                    10, S(0), dInt2.data(), dW.data(), n, dInfo.data(), 1);
+            },
+            [&](std::vector<double>& out) {
+                capture_safe_append(out, dInfo);
+                capture_safe_append(out, dInt2);
+                capture_safe_append(out, dW);
+            });
+    }
+    else if(function == "geqp3" || function == "gelsy")
+    {
+        // make the matrices rank-deficient, so that the column-pivoted QR is truncated
+        for(rocblas_int b = 0; b < bc; ++b)
+            for(rocblas_int j = n / 2; j < n; ++j)
+                for(rocblas_int i = 0; i < n; ++i)
+                    hA[b][i + j * lda] = hA[b][i + (j - n / 2) * lda];
+
+        if(function == "geqp3")
+            capture_safe_check<T>(
+                handle, n, init,
+                [&] {
+                    return rocsolver_geqp3(true, true, handle, n, n, dA.data(), lda, stA,
+                                           dInt.data(), n, dTau.data(), n, S(n) * get_epsilon<S>(),
+                                           dInt2.data(), bc);
+                },
+                [&](std::vector<double>& out) {
+                    capture_safe_append(out, dInt2);
+                    capture_safe_append(out, dInt);
+                    capture_safe_append(out, dTau);
+                    capture_safe_append(out, dA);
+                });
+        else
+            capture_safe_check<T>(
+                handle, n, init,
+                [&] {
+                    return rocsolver_gelsy(true, handle, n, n, nrhs, dA.data(), lda, stA,
+                                           dB.data(), lda, stA, dInt.data(), n,
+                                           S(n) * get_epsilon<S>(), dInt2.data(), bc);
+                },
+                [&](std::vector<double>& out) {
+                    capture_safe_append(out, dInt2);
+                    capture_safe_append(out, dB);
+                });
+    }
+    else if(function == "getrf_getrs_potrf_potrs" || function == "lookahead")
+    {
+        // a pipeline of several functions can be captured into a single graph; look-ahead
+        // is ignored in capture-safe mode
+        if(function == "lookahead")
+            CHECK_ROCBLAS_ERROR(rocsolver_set_lookahead(handle, true));
+
+        capture_safe_check<T>(
+            handle, n, init,
+            [&] {
+                rocblas_status status;
+                status = rocsolver_getf2_getrf(true, true, handle, n, n, dA.data(), lda, stA,
+                                               dInt.data(), n, dInfo.data(), bc);
+                if(status == rocblas_status_success)
+                    status = rocsolver_getrs(true, handle, rocblas_operation_none, n, nrhs,
+                                             dA.data(), lda, stA, dInt.data(), n, dB.data(), lda,
+                                             stA, bc);
+                if(status == rocblas_status_success)
+                    status = rocsolver_potf2_potrf(true, true, handle, rocblas_fill_lower, n,
+                                                   dC.data(), lda, stA, dInfo2.data(), bc);
+                if(status == rocblas_status_success)
+                    status = rocsolver_potrs(true, handle, rocblas_fill_lower, n, nrhs, dC.data(),
+                                             lda, stA, dD.data(), lda, stA, bc);
+                if(status == rocblas_status_success && function == "lookahead")
+                    status = rocsolver_geqr2_geqrf(true, true, handle, n, n, dA.data(), lda, stA,
+                                                   dTau.data(), n, bc);
+                return status;
+            },
+            [&](std::vector<double>& out) {
+                capture_safe_append(out, dInfo);
+                capture_safe_append(out, dInfo2);
+                capture_safe_append(out, dInt);
+                capture_safe_append(out, dA);
+                capture_safe_append(out, dB);
+                capture_safe_append(out, dD);
+                if(function == "lookahead")
+                    capture_safe_append(out, dTau);
+            });
+    }
+    else if(function == "ooc")
+    {
+        // the out-of-core functions copy the panels of the host matrices on the stream of the
+        // handle, and the host matrices must be pinned to be captured
+        host_strided_batch_vector<T> hAooc(stA, 1, stA, 1);
+        host_strided_batch_vector<T> hCooc(stA, 1, stA, 1);
+        rocblas_local_pinned_host pinA(hAooc.data(), sizeof(T) * stA);
+        rocblas_local_pinned_host pinC(hCooc.data(), sizeof(T) * stA);
+        CHECK_HIP_ERROR(pinA.memcheck());
+        CHECK_HIP_ERROR(pinC.memcheck());
+
+        capture_safe_check<T>(
+            handle, n,
+            [&] {
+                init();
+                memcpy(hAooc[0], hA[0], sizeof(T) * stA);
+                memcpy(hCooc[0], hC[0], sizeof(T) * stA);
+            },
+            [&] {
+                rocblas_status status;
+                status = rocsolver_getrf_ooc(handle, n, n, hAooc.data(), lda, dInt.data(),
+                                             dInfo.data());
+                if(status == rocblas_status_success)
+                    status = rocsolver_getrs_ooc(handle, rocblas_operation_none, n, nrhs,
+                                                 hAooc.data(), lda, dInt.data(), dB.data(), lda);
+                if(status == rocblas_status_success)
+                    status = rocsolver_potrf_ooc(handle, rocblas_fill_lower, n, hCooc.data(), lda,
+                                                 dInfo2.data());
+                if(status == rocblas_status_success)
+                    status = rocsolver_potrs_ooc(handle, rocblas_fill_lower, n, nrhs,
+                                                 hCooc.data(), lda, dD.data(), lda);
+                return status;
+            },
+            [&](std::vector<double>& out) {
+                capture_safe_append(out, hAooc);
+                capture_safe_append(out, hCooc);
+                capture_safe_append(out, dB);
+                capture_safe_append(out, dD);
+            });
+    }
+    else
+        FAIL() << "unknown function " << function;
+}
@@ -0,0 +1,597 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "common/lapack/testing_geblttrf_npvt.hpp"
+#include "common/lapack/testing_geblttrs_npvt_cr.hpp"
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+template <bool STRIDED, typename T, typename S, typename U>
+void geblttrf_npvt_cr_checkBadArgs(const rocblas_handle handle,
+                                   const rocblas_int nb,
+                                   const rocblas_int nblocks,
+                                   T dA,
+                                   const rocblas_int lda,
+                                   const rocblas_stride stA,
+                                   T dB,
+                                   const rocblas_int ldb,
+                                   const rocblas_stride stB,
+                                   T dC,
+                                   const rocblas_int ldc,
+                                   const rocblas_stride stC,
+                                   S dF,
+                                   const rocblas_stride stF,
+                                   U dInfo,
+                                   const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf_npvt_cr(STRIDED, nullptr, nb, nblocks, dA, lda, stA,
+                                                     dB, ldb, stB, dC, ldc, stC, dF, stF, dInfo,
+                                                     bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf_npvt_cr(STRIDED, handle, nb, nblocks, dA, lda, stA,
+                                                         dB, ldb, stB, dC, ldc, stC, dF, stF, dInfo,
+                                                         -1),
+                              rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf_npvt_cr(STRIDED, handle, nb, nblocks, (T) nullptr, lda,
+                                                     stA, dB, ldb, stB, dC, ldc, stC, dF, stF,
+                                                     dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf_npvt_cr(STRIDED, handle, nb, nblocks, dA, lda, stA,
+                                                     (T) nullptr, ldb, stB, dC, ldc, stC, dF, stF,
+                                                     dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf_npvt_cr(STRIDED, handle, nb, nblocks, dA, lda, stA, dB,
+                                                     ldb, stB, (T) nullptr, ldc, stC, dF, stF,
+                                                     dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf_npvt_cr(STRIDED, handle, nb, nblocks, dA, lda, stA, dB,
+                                                     ldb, stB, dC, ldc, stC, (S) nullptr, stF,
+                                                     dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf_npvt_cr(STRIDED, handle, nb, nblocks, dA, lda, stA, dB,
+                                                     ldb, stB, dC, ldc, stC, dF, stF, (U) nullptr,
+                                                     bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf_npvt_cr(STRIDED, handle, 0, nblocks, (T) nullptr, lda,
+                                                     stA, (T) nullptr, ldb, stB, (T) nullptr, ldc,
+                                                     stC, (S) nullptr, stF, dInfo, bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf_npvt_cr(STRIDED, handle, nb, 0, (T) nullptr, lda, stA,
+                                                     (T) nullptr, ldb, stB, (T) nullptr, ldc, stC,
+                                                     (S) nullptr, stF, dInfo, bc),
+                          rocblas_status_success);
+
+    // with a single block there are no coupling blocks; A, C and F are not referenced
+    EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf_npvt_cr(STRIDED, handle, nb, 1, (T) nullptr, lda, stA,
+                                                     dB, ldb, stB, (T) nullptr, ldc, stC,
+                                                     (S) nullptr, stF, dInfo, bc),
+                          rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf_npvt_cr(STRIDED, handle, nb, nblocks, dA, lda, stA,
+                                                         dB, ldb, stB, dC, ldc, stC, dF, stF,
+                                                         (U) nullptr, 0),
+                              rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_geblttrf_npvt_cr_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int nb = 1;
+    rocblas_int nblocks = 2;
+    rocblas_int lda = 1;
+    rocblas_int ldb = 1;
+    rocblas_int ldc = 1;
+    rocblas_stride stA = 2;
+    rocblas_stride stB = 2;
+    rocblas_stride stC = 2;
+    rocblas_stride stF = 2;
+    rocblas_int bc = 1;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dA(1, 1, 1);
+        device_batch_vector<T> dB(1, 1, 1);
+        device_batch_vector<T> dC(1, 1, 1);
+        device_strided_batch_vector<T> dF(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dB.memcheck());
+        CHECK_HIP_ERROR(dC.memcheck());
+        CHECK_HIP_ERROR(dF.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        // check bad arguments
+        geblttrf_npvt_cr_checkBadArgs<STRIDED>(handle, nb, nblocks, dA.data(), lda, stA, dB.data(),
+                                               ldb, stB, dC.data(), ldc, stC, dF.data(), stF,
+                                               dInfo.data(), bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        device_strided_batch_vector<T> dB(1, 1, 1, 1);
+        device_strided_batch_vector<T> dC(1, 1, 1, 1);
+        device_strided_batch_vector<T> dF(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dB.memcheck());
+        CHECK_HIP_ERROR(dC.memcheck());
+        CHECK_HIP_ERROR(dF.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        // check bad arguments
+        geblttrf_npvt_cr_checkBadArgs<STRIDED>(handle, nb, nblocks, dA.data(), lda, stA, dB.data(),
+                                               ldb, stB, dC.data(), ldc, stC, dF.data(), stF,
+                                               dInfo.data(), bc);
+    }
+}
+
+template <bool STRIDED,
+          typename T,
+          typename Td,
+          typename Sd,
+          typename Ud,
+          typename Th,
+          typename Uh>
+void geblttrf_npvt_cr_getError(const rocblas_handle handle,
+                               const rocblas_int nb,
+                               const rocblas_int nblocks,
+                               Td& dA,
+                               const rocblas_int lda,
+                               const rocblas_stride stA,
+                               Td& dB,
+                               const rocblas_int ldb,
+                               const rocblas_stride stB,
+                               Td& dC,
+                               const rocblas_int ldc,
+                               const rocblas_stride stC,
+                               Sd& dF,
+                               const rocblas_stride stF,
+                               Td& dX,
+                               const rocblas_int ldx,
+                               const rocblas_stride stX,
+                               Ud& dInfo,
+                               const rocblas_int bc,
+                               Th& hA,
+                               Th& hB,
+                               Th& hC,
+                               Th& hX,
+                               Th& hXRes,
+                               Uh& hInfoRes,
+                               double* max_err,
+                               const bool singular)
+{
+    // input data initialization
+    // (same matrices, and same singularities, as for geblttrf_npvt)
+    geblttrf_npvt_initData<true, true, T>(handle, nb, nblocks, dA, lda, dB, ldb, dC, ldc, bc, hA,
+                                          hB, hC, singular);
+
+    // the reduced blocks have no LAPACK equivalent; the factorization is validated
+    // by solving the system M * X = R with GEBLTTRS_NPVT_CR for a known X
+    rocblas_init<T>(hX, false);
+    for(rocblas_int b = 0; b < bc; ++b)
+        geblttrs_npvt_cr_multiply(nb, nblocks, 1, hA[b], 1, lda, hB[b], 1, ldb, hC[b], 1, ldc,
+                                  hX[b], 1, ldx, hXRes[b]);
+    CHECK_HIP_ERROR(dX.transfer_from(hXRes));
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_geblttrf_npvt_cr(STRIDED, handle, nb, nblocks, dA.data(), lda,
+                                                   stA, dB.data(), ldb, stB, dC.data(), ldc, stC,
+                                                   dF.data(), stF, dInfo.data(), bc));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    CHECK_ROCBLAS_ERROR(rocsolver_geblttrs_npvt_cr(STRIDED, handle, nb, nblocks, 1, dA.data(), lda,
+                                                   stA, dB.data(), ldb, stB, dC.data(), ldc, stC,
+                                                   dF.data(), stF, dX.data(), ldx, stX, bc));
+    CHECK_HIP_ERROR(hXRes.transfer_from(dX));
+
+    // check info for singularities
+    double err = 0;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        if(singular && (b == bc / 4 || b == bc / 2 || b == bc - 1))
+        {
+            EXPECT_GT(hInfoRes[b][0], 0) << "where b = " << b;
+            if(hInfoRes[b][0] <= 0)
+                err++;
+        }
+        else
+        {
+            EXPECT_EQ(hInfoRes[b][0], 0) << "where b = " << b;
+            if(hInfoRes[b][0] != 0)
+                err++;
+        }
+    }
+    *max_err += err;
+
+    // error is ||hX - hXRes|| / ||hX||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using frobenius norm
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        if(hInfoRes[b][0] == 0)
+        {
+            err = norm_error('F', nb, nblocks, ldx, hX[b], hXRes[b]);
+            *max_err = err > *max_err ? err : *max_err;
+        }
+    }
+}
+
+template <bool STRIDED, typename T, typename Td, typename Sd, typename Ud, typename Th>
+void geblttrf_npvt_cr_getPerfData(const rocblas_handle handle,
+                                  const rocblas_int nb,
+                                  const rocblas_int nblocks,
+                                  Td& dA,
+                                  const rocblas_int lda,
+                                  const rocblas_stride stA,
+                                  Td& dB,
+                                  const rocblas_int ldb,
+                                  const rocblas_stride stB,
+                                  Td& dC,
+                                  const rocblas_int ldc,
+                                  const rocblas_stride stC,
+                                  Sd& dF,
+                                  const rocblas_stride stF,
+                                  Ud& dInfo,
+                                  const rocblas_int bc,
+                                  Th& hA,
+                                  Th& hB,
+                                  Th& hC,
+                                  double* gpu_time_used,
+                                  double* cpu_time_used,
+                                  const rocblas_int hot_calls,
+                                  const int profile,
+                                  const bool profile_kernels,
+                                  const bool perf,
+                                  const bool singular)
+{
+    if(!perf)
+    {
+        // there is no direct CPU/LAPACK equivalent for this function, therefore
+        // we return an invalid CPU time
+        *cpu_time_used = nan("");
+    }
+
+    geblttrf_npvt_initData<true, false, T>(handle, nb, nblocks, dA, lda, dB, ldb, dC, ldc, bc, hA,
+                                           hB, hC, singular);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        geblttrf_npvt_initData<false, true, T>(handle, nb, nblocks, dA, lda, dB, ldb, dC, ldc, bc,
+                                               hA, hB, hC, singular);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_geblttrf_npvt_cr(STRIDED, handle, nb, nblocks, dA.data(), lda,
+                                                       stA, dB.data(), ldb, stB, dC.data(), ldc,
+                                                       stC, dF.data(), stF, dInfo.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        geblttrf_npvt_initData<false, true, T>(handle, nb, nblocks, dA, lda, dB, ldb, dC, ldc, bc,
+                                               hA, hB, hC, singular);
+
+        start = get_time_us_sync(stream);
+        rocsolver_geblttrf_npvt_cr(STRIDED, handle, nb, nblocks, dA.data(), lda, stA, dB.data(),
+                                   ldb, stB, dC.data(), ldc, stC, dF.data(), stF, dInfo.data(), bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_geblttrf_npvt_cr(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int nb = argus.get<rocblas_int>("nb");
+    rocblas_int nblocks = argus.get<rocblas_int>("nblocks");
+    rocblas_int lda = argus.get<rocblas_int>("lda", nb);
+    rocblas_int ldb = argus.get<rocblas_int>("ldb", nb);
+    rocblas_int ldc = argus.get<rocblas_int>("ldc", nb);
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * nb * nblocks);
+    rocblas_stride stB = argus.get<rocblas_stride>("strideB", ldb * nb * nblocks);
+    rocblas_stride stC = argus.get<rocblas_stride>("strideC", ldc * nb * nblocks);
+    rocblas_stride stF
+        = argus.get<rocblas_stride>("strideF", 2 * nb * nb * std::max(nblocks - 1, 0));
+
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    // the solution vectors used to validate the factorization
+    rocblas_int ldx = nb;
+    rocblas_stride stX = (argus.unit_check || argus.norm_check) ? ldx * nblocks : 0;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A = size_t(lda) * nb * nblocks;
+    size_t size_B = size_t(ldb) * nb * nblocks;
+    size_t size_C = size_t(ldc) * nb * nblocks;
+    size_t size_F = stF;
+    size_t size_X = stX;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    // check invalid sizes
+    bool invalid_size = (nb < 0 || nblocks < 0 || lda < nb || ldb < nb || ldc < nb || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf_npvt_cr(
+                                      STRIDED, handle, nb, nblocks, (T* const*)nullptr, lda, stA,
+                                      (T* const*)nullptr, ldb, stB, (T* const*)nullptr, ldc, stC,
+                                      (T*)nullptr, stF, (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf_npvt_cr(STRIDED, handle, nb, nblocks,
+                                                             (T*)nullptr, lda, stA, (T*)nullptr,
+                                                             ldb, stB, (T*)nullptr, ldc, stC,
+                                                             (T*)nullptr, stF,
+                                                             (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_geblttrf_npvt_cr(
+                STRIDED, handle, nb, nblocks, (T* const*)nullptr, lda, stA, (T* const*)nullptr, ldb,
+                stB, (T* const*)nullptr, ldc, stC, (T*)nullptr, stF, (rocblas_int*)nullptr, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_geblttrf_npvt_cr(
+                STRIDED, handle, nb, nblocks, (T*)nullptr, lda, stA, (T*)nullptr, ldb, stB,
+                (T*)nullptr, ldc, stC, (T*)nullptr, stF, (rocblas_int*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform_mem_query(handle, size, argus.mem_query > 1);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(size_A, 1, bc);
+        host_batch_vector<T> hB(size_B, 1, bc);
+        host_batch_vector<T> hC(size_C, 1, bc);
+        host_batch_vector<T> hX(size_X, 1, bc);
+        host_batch_vector<T> hXRes(size_X, 1, bc);
+        host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        device_batch_vector<T> dB(size_B, 1, bc);
+        device_batch_vector<T> dC(size_C, 1, bc);
+        device_strided_batch_vector<T> dF(size_F, 1, stF, bc);
+        device_batch_vector<T> dX(size_X, 1, bc);
+        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_B)
+            CHECK_HIP_ERROR(dB.memcheck());
+        if(size_C)
+            CHECK_HIP_ERROR(dC.memcheck());
+        if(size_F)
+            CHECK_HIP_ERROR(dF.memcheck());
+        if(size_X)
+            CHECK_HIP_ERROR(dX.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        // check quick return
+        if(nb == 0 || nblocks == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf_npvt_cr(STRIDED, handle, nb, nblocks,
+                                                             dA.data(), lda, stA, dB.data(), ldb,
+                                                             stB, dC.data(), ldc, stC, dF.data(),
+                                                             stF, dInfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            geblttrf_npvt_cr_getError<STRIDED, T>(handle, nb, nblocks, dA, lda, stA, dB, ldb, stB,
+                                                  dC, ldc, stC, dF, stF, dX, ldx, stX, dInfo, bc,
+                                                  hA, hB, hC, hX, hXRes, hInfoRes, &max_error,
+                                                  argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            geblttrf_npvt_cr_getPerfData<STRIDED, T>(
+                handle, nb, nblocks, dA, lda, stA, dB, ldb, stB, dC, ldc, stC, dF, stF, dInfo, bc,
+                hA, hB, hC, &gpu_time_used, &cpu_time_used, hot_calls, argus.profile,
+                argus.profile_kernels, argus.perf, argus.singular);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hB(size_B, 1, stB, bc);
+        host_strided_batch_vector<T> hC(size_C, 1, stC, bc);
+        host_strided_batch_vector<T> hX(size_X, 1, stX, bc);
+        host_strided_batch_vector<T> hXRes(size_X, 1, stX, bc);
+        host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        device_strided_batch_vector<T> dB(size_B, 1, stB, bc);
+        device_strided_batch_vector<T> dC(size_C, 1, stC, bc);
+        device_strided_batch_vector<T> dF(size_F, 1, stF, bc);
+        device_strided_batch_vector<T> dX(size_X, 1, stX, bc);
+        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_B)
+            CHECK_HIP_ERROR(dB.memcheck());
+        if(size_C)
+            CHECK_HIP_ERROR(dC.memcheck());
+        if(size_F)
+            CHECK_HIP_ERROR(dF.memcheck());
+        if(size_X)
+            CHECK_HIP_ERROR(dX.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        // check quick return
+        if(nb == 0 || nblocks == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_geblttrf_npvt_cr(STRIDED, handle, nb, nblocks,
+                                                             dA.data(), lda, stA, dB.data(), ldb,
+                                                             stB, dC.data(), ldc, stC, dF.data(),
+                                                             stF, dInfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            geblttrf_npvt_cr_getError<STRIDED, T>(handle, nb, nblocks, dA, lda, stA, dB, ldb, stB,
+                                                  dC, ldc, stC, dF, stF, dX, ldx, stX, dInfo, bc,
+                                                  hA, hB, hC, hX, hXRes, hInfoRes, &max_error,
+                                                  argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            geblttrf_npvt_cr_getPerfData<STRIDED, T>(
+                handle, nb, nblocks, dA, lda, stA, dB, ldb, stB, dC, ldc, stC, dF, stF, dInfo, bc,
+                hA, hB, hC, &gpu_time_used, &cpu_time_used, hot_calls, argus.profile,
+                argus.profile_kernels, argus.perf, argus.singular);
+    }
+
+    // validate results for rocsolver-test
+    // using nb * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, nb);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            if(BATCHED)
+            {
+                rocsolver_bench_output("nb", "nblocks", "lda", "ldb", "ldc", "strideF", "batch_c");
+                rocsolver_bench_output(nb, nblocks, lda, ldb, ldc, stF, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("nb", "nblocks", "lda", "strideA", "ldb", "strideB", "ldc",
+                                       "strideC", "strideF", "batch_c");
+                rocsolver_bench_output(nb, nblocks, lda, stA, ldb, stB, ldc, stC, stF, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("nb", "nblocks", "lda", "ldb", "ldc");
+                rocsolver_bench_output(nb, nblocks, lda, ldb, ldc);
+            }
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_GEBLTTRF_NPVT_CR(...) \
+    extern template void testing_geblttrf_npvt_cr<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_GEBLTTRF_NPVT_CR, FOREACH_MATRIX_DATA_LAYOUT, FOREACH_SCALAR_TYPE, APPLY_STAMP)
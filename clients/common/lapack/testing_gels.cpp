@@ -29,4 +29,8 @@
 
 #define TESTING_GELS(...) template void testing_gels<__VA_ARGS__>(Arguments&);
 
-INSTANTIATE(TESTING_GELS, FOREACH_MATRIX_DATA_LAYOUT, FOREACH_SCALAR_TYPE, APPLY_STAMP)
+INSTANTIATE(TESTING_GELS,
+            FOREACH_MATRIX_DATA_LAYOUT,
+            FOREACH_SCALAR_TYPE,
+            FOREACH_INT_TYPE,
+            APPLY_STAMP)
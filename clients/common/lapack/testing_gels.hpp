@@ -35,20 +35,20 @@
 #include "common/misc/rocsolver_arguments.hpp"
 #include "common/misc/rocsolver_test.hpp"
 
-template <bool BATCHED, bool STRIDED, typename U>
+template <bool BATCHED, bool STRIDED, typename I, typename U>
 void gels_checkBadArgs(const rocblas_handle handle,
                        const rocblas_operation trans,
-                       const rocblas_int m,
-                       const rocblas_int n,
-                       const rocblas_int nrhs,
+                       const I m,
+                       const I n,
+                       const I nrhs,
                        U dA,
-                       const rocblas_int lda,
+                       const I lda,
                        const rocblas_stride stA,
                        U dB,
-                       const rocblas_int ldb,
+                       const I ldb,
                        const rocblas_stride stB,
-                       rocblas_int* info,
-                       const rocblas_int bc)
+                       I* info,
+                       const I bc)
 {
     // handle
     EXPECT_ROCBLAS_STATUS(
@@ -64,7 +64,7 @@ void gels_checkBadArgs(const rocblas_handle handle,
     // sizes (only check batch_count if applicable)
     if(STRIDED)
         EXPECT_ROCBLAS_STATUS(rocsolver_gels(STRIDED, handle, trans, m, n, nrhs, dA, lda, stA, dB,
-                                             ldb, stB, info, -1),
+                                             ldb, stB, info, I(-1)),
                               rocblas_status_invalid_size)
             << "Must report error when batch size is negative";
 
@@ -83,55 +83,55 @@ void gels_checkBadArgs(const rocblas_handle handle,
         << "Should normally report error when info is null";
 
     // quick return with invalid pointers
-    EXPECT_ROCBLAS_STATUS(rocsolver_gels(STRIDED, handle, trans, 0, n, nrhs, (U) nullptr, lda, stA,
-                                         dB, ldb, stB, info, bc),
+    EXPECT_ROCBLAS_STATUS(rocsolver_gels(STRIDED, handle, trans, I(0), n, nrhs, (U) nullptr, lda,
+                                         stA, dB, ldb, stB, info, bc),
                           rocblas_status_success)
         << "Matrix A may be null when m is 0 (empty matrix)";
-    EXPECT_ROCBLAS_STATUS(rocsolver_gels(STRIDED, handle, trans, m, 0, nrhs, (U) nullptr, lda, stA,
-                                         dB, ldb, stB, info, bc),
+    EXPECT_ROCBLAS_STATUS(rocsolver_gels(STRIDED, handle, trans, m, I(0), nrhs, (U) nullptr, lda,
+                                         stA, dB, ldb, stB, info, bc),
                           rocblas_status_success)
         << "Matrix A may be null when n is 0 (empty matrix)";
-    EXPECT_ROCBLAS_STATUS(rocsolver_gels(STRIDED, handle, trans, m, n, 0, dA, lda, stA, (U) nullptr,
-                                         ldb, stB, info, bc),
+    EXPECT_ROCBLAS_STATUS(rocsolver_gels(STRIDED, handle, trans, m, n, I(0), dA, lda, stA,
+                                         (U) nullptr, ldb, stB, info, bc),
                           rocblas_status_success)
         << "Matrix B may be null when nhrs is 0 (empty matrix)";
-    EXPECT_ROCBLAS_STATUS(rocsolver_gels(STRIDED, handle, trans, 0, 0, nrhs, (U) nullptr, lda, stA,
-                                         (U) nullptr, ldb, stB, info, bc),
+    EXPECT_ROCBLAS_STATUS(rocsolver_gels(STRIDED, handle, trans, I(0), I(0), nrhs, (U) nullptr,
+                                         lda, stA, (U) nullptr, ldb, stB, info, bc),
                           rocblas_status_success)
         << "Matrices A and B may be null when m and n are 0 (empty matrix)";
     if(BATCHED)
         EXPECT_ROCBLAS_STATUS(rocsolver_gels(STRIDED, handle, trans, m, n, nrhs, dA, lda, stA, dB,
-                                             ldb, stB, nullptr, 0),
+                                             ldb, stB, nullptr, I(0)),
                               rocblas_status_success)
             << "Info may be null when batch size is 0";
 
     // quick return with zero batch_count if applicable
     if(STRIDED)
-        EXPECT_ROCBLAS_STATUS(
-            rocsolver_gels(STRIDED, handle, trans, m, n, nrhs, dA, lda, stA, dB, ldb, stB, info, 0),
-            rocblas_status_success);
+        EXPECT_ROCBLAS_STATUS(rocsolver_gels(STRIDED, handle, trans, m, n, nrhs, dA, lda, stA, dB,
+                                             ldb, stB, info, I(0)),
+                              rocblas_status_success);
 }
 
-template <bool BATCHED, bool STRIDED, typename T>
+template <bool BATCHED, bool STRIDED, typename T, typename I>
 void testing_gels_bad_arg()
 {
     // safe arguments
     rocblas_local_handle handle;
-    rocblas_int m = 1;
-    rocblas_int n = 1;
-    rocblas_int nrhs = 1;
-    rocblas_int lda = 1;
-    rocblas_int ldb = 1;
+    I m = 1;
+    I n = 1;
+    I nrhs = 1;
+    I lda = 1;
+    I ldb = 1;
     rocblas_stride stA = 1;
     rocblas_stride stB = 1;
-    rocblas_int bc = 1;
+    I bc = 1;
     rocblas_operation trans = rocblas_operation_none;
     if(BATCHED)
     {
         // memory allocations
         device_batch_vector<T> dA(1, 1, 1);
         device_batch_vector<T> dB(1, 1, 1);
-        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+        device_strided_batch_vector<I> dInfo(1, 1, 1, 1);
         CHECK_HIP_ERROR(dA.memcheck());
         CHECK_HIP_ERROR(dB.memcheck());
         CHECK_HIP_ERROR(dInfo.memcheck());
@@ -145,7 +145,7 @@ void testing_gels_bad_arg()
         // memory allocations
         device_strided_batch_vector<T> dA(1, 1, 1, 1);
         device_strided_batch_vector<T> dB(1, 1, 1, 1);
-        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+        device_strided_batch_vector<I> dInfo(1, 1, 1, 1);
         CHECK_HIP_ERROR(dA.memcheck());
         CHECK_HIP_ERROR(dB.memcheck());
         CHECK_HIP_ERROR(dInfo.memcheck());
@@ -156,20 +156,27 @@ void testing_gels_bad_arg()
     }
 }
 
-template <bool CPU, bool GPU, typename T, typename Td, typename Ud, typename Th, typename Uh>
+template <bool CPU,
+          bool GPU,
+          typename T,
+          typename I,
+          typename Td,
+          typename Ud,
+          typename Th,
+          typename Uh>
 void gels_initData(const rocblas_handle handle,
                    const rocblas_operation trans,
-                   const rocblas_int m,
-                   const rocblas_int n,
-                   const rocblas_int nrhs,
+                   const I m,
+                   const I n,
+                   const I nrhs,
                    Td& dA,
-                   const rocblas_int lda,
+                   const I lda,
                    const rocblas_stride stA,
                    Td& dB,
-                   const rocblas_int ldb,
+                   const I ldb,
                    const rocblas_stride stB,
                    Ud& dInfo,
-                   const rocblas_int bc,
+                   const I bc,
                    Th& hA,
                    Th& hB,
                    Uh& hInfo,
@@ -180,16 +187,16 @@ void gels_initData(const rocblas_handle handle,
         rocblas_init<T>(hA, true);
         rocblas_init<T>(hB, true);
 
-        const rocblas_int max_index = std::max(0, std::min(m, n) - 1);
+        const I max_index = std::max(I(0), std::min(m, n) - 1);
         std::uniform_int_distribution<int> sample_index(0, max_index);
         std::bernoulli_distribution coinflip(0.5);
 
         // scale A to avoid singularities
-        for(rocblas_int b = 0; b < bc; ++b)
+        for(I b = 0; b < bc; ++b)
         {
-            for(rocblas_int i = 0; i < m; i++)
+            for(I i = 0; i < m; i++)
             {
-                for(rocblas_int j = 0; j < n; j++)
+                for(I j = 0; j < n; j++)
                 {
                     if(i == j)
                         hA[b][i + j * lda] += 400;
@@ -207,15 +214,15 @@ void gels_initData(const rocblas_handle handle,
                     if(n <= m)
                     {
                         // zero random col
-                        rocblas_int j = sample_index(rocblas_rng);
-                        for(rocblas_int i = 0; i < m; i++)
+                        I j = sample_index(rocblas_rng);
+                        for(I i = 0; i < m; i++)
                             hA[b][i + j * lda] = 0;
                     }
                     else
                     {
                         // zero random row
-                        rocblas_int i = sample_index(rocblas_rng);
-                        for(rocblas_int j = 0; j < n; j++)
+                        I i = sample_index(rocblas_rng);
+                        for(I j = 0; j < n; j++)
                             hA[b][i + j * lda] = 0;
                     }
                 } while(coinflip(rocblas_rng));
@@ -231,29 +238,36 @@ void gels_initData(const rocblas_handle handle,
     }
 }
 
-template <bool STRIDED, typename T, typename Td, typename Ud, typename Th, typename Uh>
+template <bool STRIDED,
+          typename T,
+          typename I,
+          typename Td,
+          typename Ud,
+          typename Th,
+          typename Uh,
+          typename Ih>
 void gels_getError(const rocblas_handle handle,
                    const rocblas_operation trans,
-                   const rocblas_int m,
-                   const rocblas_int n,
-                   const rocblas_int nrhs,
+                   const I m,
+                   const I n,
+                   const I nrhs,
                    Td& dA,
-                   const rocblas_int lda,
+                   const I lda,
                    const rocblas_stride stA,
                    Td& dB,
-                   const rocblas_int ldb,
+                   const I ldb,
                    const rocblas_stride stB,
                    Ud& dInfo,
-                   const rocblas_int bc,
+                   const I bc,
                    Th& hA,
                    Th& hB,
                    Th& hBRes,
                    Uh& hInfo,
-                   Uh& hInfoRes,
+                   Ih& hInfoRes,
                    double* max_err,
                    const bool singular)
 {
-    rocblas_int sizeW = max(1, min(m, n) + max(min(m, n), nrhs));
+    rocblas_int sizeW = max(I(1), min(m, n) + max(min(m, n), nrhs));
     std::vector<T> hW(sizeW);
 
     // input data initialization
@@ -268,7 +282,7 @@ void gels_getError(const rocblas_handle handle,
     CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
 
     // CPU lapack
-    for(rocblas_int b = 0; b < bc; ++b)
+    for(I b = 0; b < bc; ++b)
     {
         cpu_gels(trans, m, n, nrhs, hA[b], lda, hB[b], ldb, hW.data(), sizeW, hInfo[b]);
     }
@@ -279,7 +293,7 @@ void gels_getError(const rocblas_handle handle,
     // using vector-induced infinity norm
     double err;
     *max_err = 0;
-    for(rocblas_int b = 0; b < bc; ++b)
+    for(I b = 0; b < bc; ++b)
     {
         err = norm_error('I', max(m, n), nrhs, ldb, hB[b], hBRes[b]);
         *max_err = err > *max_err ? err : *max_err;
@@ -287,7 +301,7 @@ void gels_getError(const rocblas_handle handle,
 
     // also check info for singularities
     err = 0;
-    for(rocblas_int b = 0; b < bc; ++b)
+    for(I b = 0; b < bc; ++b)
     {
         EXPECT_EQ(hInfo[b][0], hInfoRes[b][0]) << "where b = " << b;
         if(hInfo[b][0] != hInfoRes[b][0])
@@ -296,20 +310,20 @@ void gels_getError(const rocblas_handle handle,
     *max_err += err;
 }
 
-template <bool STRIDED, typename T, typename Td, typename Ud, typename Th, typename Uh>
+template <bool STRIDED, typename T, typename I, typename Td, typename Ud, typename Th, typename Uh>
 void gels_getPerfData(const rocblas_handle handle,
                       const rocblas_operation trans,
-                      const rocblas_int m,
-                      const rocblas_int n,
-                      const rocblas_int nrhs,
+                      const I m,
+                      const I n,
+                      const I nrhs,
                       Td& dA,
-                      const rocblas_int lda,
+                      const I lda,
                       const rocblas_stride stA,
                       Td& dB,
-                      const rocblas_int ldb,
+                      const I ldb,
                       const rocblas_stride stB,
                       Ud& dInfo,
-                      const rocblas_int bc,
+                      const I bc,
                       Th& hA,
                       Th& hB,
                       Uh& hInfo,
@@ -321,7 +335,7 @@ void gels_getPerfData(const rocblas_handle handle,
                       const bool perf,
                       const bool singular)
 {
-    rocblas_int sizeW = max(1, min(m, n) + max(min(m, n), nrhs));
+    rocblas_int sizeW = max(I(1), min(m, n) + max(min(m, n), nrhs));
     std::vector<T> hW(sizeW);
 
     if(!perf)
@@ -330,7 +344,7 @@ void gels_getPerfData(const rocblas_handle handle,
                                       bc, hA, hB, hInfo, singular);
         // cpu-lapack performance (only if not in perf mode)
         *cpu_time_used = get_time_us_no_sync();
-        for(rocblas_int b = 0; b < bc; ++b)
+        for(I b = 0; b < bc; ++b)
         {
             cpu_gels(trans, m, n, nrhs, hA[b], lda, hB[b], ldb, hW.data(), sizeW, hInfo[b]);
         }
@@ -375,22 +389,22 @@ void gels_getPerfData(const rocblas_handle handle,
     *gpu_time_used /= hot_calls;
 }
 
-template <bool BATCHED, bool STRIDED, typename T, bool COMPLEX = rocblas_is_complex<T>>
+template <bool BATCHED, bool STRIDED, typename T, typename I, bool COMPLEX = rocblas_is_complex<T>>
 void testing_gels(Arguments& argus)
 {
     // get arguments
     rocblas_local_handle handle;
     char transC = argus.get<char>("trans");
-    rocblas_int m = argus.get<rocblas_int>("m");
-    rocblas_int n = argus.get<rocblas_int>("n", m);
-    rocblas_int nrhs = argus.get<rocblas_int>("nrhs", n);
-    rocblas_int lda = argus.get<rocblas_int>("lda", m);
-    rocblas_int ldb = argus.get<rocblas_int>("ldb", max(m, n));
+    I m = argus.get<rocblas_int>("m");
+    I n = argus.get<rocblas_int>("n", m);
+    I nrhs = argus.get<rocblas_int>("nrhs", n);
+    I lda = argus.get<rocblas_int>("lda", m);
+    I ldb = argus.get<rocblas_int>("ldb", max(m, n));
     rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * n);
     rocblas_stride stB = argus.get<rocblas_stride>("strideB", ldb * nrhs);
 
     rocblas_operation trans = char2rocblas_operation(transC);
-    rocblas_int bc = argus.batch_count;
+    I bc = argus.batch_count;
     rocblas_int hot_calls = argus.iters;
 
     rocblas_stride stBRes = (argus.unit_check || argus.norm_check) ? stB : 0;
@@ -403,12 +417,12 @@ void testing_gels(Arguments& argus)
         if(BATCHED)
             EXPECT_ROCBLAS_STATUS(rocsolver_gels(STRIDED, handle, trans, m, n, nrhs,
                                                  (T* const*)nullptr, lda, stA, (T* const*)nullptr,
-                                                 ldb, stB, (rocblas_int*)nullptr, bc),
+                                                 ldb, stB, (I*)nullptr, bc),
                                   rocblas_status_invalid_value);
         else
             EXPECT_ROCBLAS_STATUS(rocsolver_gels(STRIDED, handle, trans, m, n, nrhs, (T*)nullptr,
                                                  lda, stA, (T*)nullptr, ldb, stB,
-                                                 (rocblas_int*)nullptr, bc),
+                                                 (I*)nullptr, bc),
                                   rocblas_status_invalid_value);
 
         if(argus.timing)
@@ -431,12 +445,12 @@ void testing_gels(Arguments& argus)
         if(BATCHED)
             EXPECT_ROCBLAS_STATUS(rocsolver_gels(STRIDED, handle, trans, m, n, nrhs,
                                                  (T* const*)nullptr, lda, stA, (T* const*)nullptr,
-                                                 ldb, stB, (rocblas_int*)nullptr, bc),
+                                                 ldb, stB, (I*)nullptr, bc),
                                   rocblas_status_invalid_size);
         else
             EXPECT_ROCBLAS_STATUS(rocsolver_gels(STRIDED, handle, trans, m, n, nrhs, (T*)nullptr,
                                                  lda, stA, (T*)nullptr, ldb, stB,
-                                                 (rocblas_int*)nullptr, bc),
+                                                 (I*)nullptr, bc),
                                   rocblas_status_invalid_size);
 
         if(argus.timing)
@@ -452,16 +466,16 @@ void testing_gels(Arguments& argus)
         if(BATCHED)
             CHECK_ALLOC_QUERY(rocsolver_gels(STRIDED, handle, trans, m, n, nrhs, (T* const*)nullptr,
                                              lda, stA, (T* const*)nullptr, ldb, stB,
-                                             (rocblas_int*)nullptr, bc));
+                                             (I*)nullptr, bc));
         else
             CHECK_ALLOC_QUERY(rocsolver_gels(STRIDED, handle, trans, m, n, nrhs, (T*)nullptr, lda,
-                                             stA, (T*)nullptr, ldb, stB, (rocblas_int*)nullptr, bc));
+                                             stA, (T*)nullptr, ldb, stB, (I*)nullptr, bc));
 
         size_t size;
         CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
         if(argus.mem_query)
         {
-            rocsolver_bench_inform(inform_mem_query, size);
+            rocsolver_bench_inform_mem_query(handle, size, argus.mem_query > 1);
             return;
         }
 
@@ -475,10 +489,10 @@ void testing_gels(Arguments& argus)
         host_batch_vector<T> hB(size_B, 1, bc);
         host_batch_vector<T> hBRes(size_BRes, 1, bc);
         host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
-        host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, bc);
+        host_strided_batch_vector<I> hInfoRes(1, 1, 1, bc);
         device_batch_vector<T> dA(size_A, 1, bc);
         device_batch_vector<T> dB(size_B, 1, bc);
-        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+        device_strided_batch_vector<I> dInfo(1, 1, 1, bc);
         if(size_A)
             CHECK_HIP_ERROR(dA.memcheck());
         if(size_B)
@@ -517,10 +531,10 @@ void testing_gels(Arguments& argus)
         host_strided_batch_vector<T> hB(size_B, 1, stB, bc);
         host_strided_batch_vector<T> hBRes(size_BRes, 1, stBRes, bc);
         host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
-        host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, bc);
+        host_strided_batch_vector<I> hInfoRes(1, 1, 1, bc);
         device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
         device_strided_batch_vector<T> dB(size_B, 1, stB, bc);
-        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+        device_strided_batch_vector<I> dInfo(1, 1, 1, bc);
         if(size_A)
             CHECK_HIP_ERROR(dA.memcheck());
         if(size_B)
@@ -607,4 +621,8 @@ void testing_gels(Arguments& argus)
 
 #define EXTERN_TESTING_GELS(...) extern template void testing_gels<__VA_ARGS__>(Arguments&);
 
-INSTANTIATE(EXTERN_TESTING_GELS, FOREACH_MATRIX_DATA_LAYOUT, FOREACH_SCALAR_TYPE, APPLY_STAMP)
+INSTANTIATE(EXTERN_TESTING_GELS,
+            FOREACH_MATRIX_DATA_LAYOUT,
+            FOREACH_SCALAR_TYPE,
+            FOREACH_INT_TYPE,
+            APPLY_STAMP)
@@ -0,0 +1,693 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+template <bool STRIDED, bool TRUNCATED, typename T, typename S, typename U>
+void geqp3_checkBadArgs(const rocblas_handle handle,
+                        const rocblas_int m,
+                        const rocblas_int n,
+                        T dA,
+                        const rocblas_int lda,
+                        const rocblas_stride stA,
+                        rocblas_int* dJpvt,
+                        const rocblas_stride stJ,
+                        U dIpiv,
+                        const rocblas_stride stP,
+                        const S tol,
+                        rocblas_int* dRank,
+                        const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, TRUNCATED, nullptr, m, n, dA, lda, stA, dJpvt,
+                                          stJ, dIpiv, stP, tol, dRank, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    if(TRUNCATED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, TRUNCATED, handle, m, n, dA, lda, stA, dJpvt,
+                                              stJ, dIpiv, stP, S(-1), dRank, bc),
+                              rocblas_status_invalid_value)
+            << "Must report error when tol is negative";
+
+    // sizes (only check batch_count if applicable)
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, TRUNCATED, handle, m, n, dA, lda, stA, dJpvt,
+                                              stJ, dIpiv, stP, tol, dRank, -1),
+                              rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, TRUNCATED, handle, m, n, (T) nullptr, lda, stA,
+                                          dJpvt, stJ, dIpiv, stP, tol, dRank, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, TRUNCATED, handle, m, n, dA, lda, stA,
+                                          (rocblas_int*)nullptr, stJ, dIpiv, stP, tol, dRank, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, TRUNCATED, handle, m, n, dA, lda, stA, dJpvt,
+                                          stJ, (U) nullptr, stP, tol, dRank, bc),
+                          rocblas_status_invalid_pointer);
+    if(TRUNCATED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, TRUNCATED, handle, m, n, dA, lda, stA, dJpvt,
+                                              stJ, dIpiv, stP, tol, (rocblas_int*)nullptr, bc),
+                              rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, TRUNCATED, handle, 0, n, (T) nullptr, lda, stA,
+                                          dJpvt, stJ, (U) nullptr, stP, tol, dRank, bc),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, TRUNCATED, handle, m, 0, (T) nullptr, lda, stA,
+                                          (rocblas_int*)nullptr, stJ, (U) nullptr, stP, tol, dRank,
+                                          bc),
+                          rocblas_status_success);
+
+    // quick return with zero batch_count if applicable
+    if(STRIDED)
+        EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, TRUNCATED, handle, m, n, dA, lda, stA, dJpvt,
+                                              stJ, dIpiv, stP, tol, (rocblas_int*)nullptr, 0),
+                              rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, bool TRUNCATED, typename T>
+void testing_geqp3_bad_arg()
+{
+    using S = decltype(std::real(T{}));
+
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int m = 1;
+    rocblas_int n = 1;
+    rocblas_int lda = 1;
+    rocblas_stride stA = 1;
+    rocblas_stride stJ = 1;
+    rocblas_stride stP = 1;
+    S tol = 0;
+    rocblas_int bc = 1;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dA(1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dJpvt(1, 1, 1, 1);
+        device_strided_batch_vector<T> dIpiv(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dRank(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dJpvt.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dRank.memcheck());
+
+        // check bad arguments
+        geqp3_checkBadArgs<STRIDED, TRUNCATED>(handle, m, n, dA.data(), lda, stA, dJpvt.data(),
+                                               stJ, dIpiv.data(), stP, tol, dRank.data(), bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dJpvt(1, 1, 1, 1);
+        device_strided_batch_vector<T> dIpiv(1, 1, 1, 1);
+        device_strided_batch_vector<rocblas_int> dRank(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dJpvt.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dRank.memcheck());
+
+        // check bad arguments
+        geqp3_checkBadArgs<STRIDED, TRUNCATED>(handle, m, n, dA.data(), lda, stA, dJpvt.data(),
+                                               stJ, dIpiv.data(), stP, tol, dRank.data(), bc);
+    }
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th, typename Uh>
+void geqp3_initData(const rocblas_handle handle,
+                    const rocblas_int m,
+                    const rocblas_int n,
+                    Td& dA,
+                    const rocblas_int lda,
+                    const rocblas_stride stA,
+                    const rocblas_int bc,
+                    Th& hA,
+                    Uh& hRank,
+                    const bool singular)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+
+        // rank of the rank-deficient matrices
+        rocblas_int k = std::max(1, std::min(m, n) / 2);
+        std::vector<T> hX(size_t(m) * k);
+        std::vector<T> hY(size_t(k) * n);
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            // scale A to avoid singularities
+            for(rocblas_int i = 0; i < m; i++)
+            {
+                for(rocblas_int j = 0; j < n; j++)
+                {
+                    if(i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+                }
+            }
+            hRank[b][0] = std::min(m, n);
+
+            // make some matrices rank-deficient
+            // always the same elements for debugging purposes
+            if(singular && (b == bc / 4 || b == bc / 2 || b == bc - 1))
+            {
+                // A = X * Y, with X m-by-k and Y k-by-n, both well conditioned
+                rocblas_init<T>(hX, m, k, m);
+                rocblas_init<T>(hY, k, n, k);
+                for(rocblas_int i = 0; i < m; i++)
+                {
+                    for(rocblas_int j = 0; j < k; j++)
+                    {
+                        if(i == j)
+                            hX[i + j * m] += 400;
+                        else
+                            hX[i + j * m] -= 4;
+                    }
+                }
+                for(rocblas_int i = 0; i < k; i++)
+                {
+                    for(rocblas_int j = 0; j < n; j++)
+                    {
+                        if(i == j)
+                            hY[i + j * k] += 400;
+                        else
+                            hY[i + j * k] -= 4;
+                    }
+                }
+                cpu_gemm(rocblas_operation_none, rocblas_operation_none, m, n, k, T(1), hX.data(),
+                         m, hY.data(), k, T(0), hA[b], lda);
+                hRank[b][0] = k;
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <bool STRIDED,
+          bool TRUNCATED,
+          typename T,
+          typename S,
+          typename Td,
+          typename Ud,
+          typename Vd,
+          typename Th,
+          typename Uh,
+          typename Vh>
+void geqp3_getError(const rocblas_handle handle,
+                    const rocblas_int m,
+                    const rocblas_int n,
+                    Td& dA,
+                    const rocblas_int lda,
+                    const rocblas_stride stA,
+                    Ud& dJpvt,
+                    const rocblas_stride stJ,
+                    Vd& dIpiv,
+                    const rocblas_stride stP,
+                    const S tol,
+                    Ud& dRank,
+                    const rocblas_int bc,
+                    Th& hA,
+                    Th& hARes,
+                    Uh& hJpvtRes,
+                    Vh& hIpivRes,
+                    Uh& hRank,
+                    Uh& hRankRes,
+                    double* max_err,
+                    const bool singular)
+{
+    rocblas_int dim = std::min(m, n);
+    std::vector<T> hW(n);
+    std::vector<T> hAP(size_t(lda) * n);
+    std::vector<T> hM(size_t(lda) * n);
+    std::vector<rocblas_int> hPerm(n);
+
+    // input data initialization
+    geqp3_initData<true, true, T>(handle, m, n, dA, lda, stA, bc, hA, hRank, singular);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_geqp3(STRIDED, TRUNCATED, handle, m, n, dA.data(), lda, stA,
+                                        dJpvt.data(), stJ, dIpiv.data(), stP, tol, dRank.data(),
+                                        bc));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hJpvtRes.transfer_from(dJpvt));
+    CHECK_HIP_ERROR(hIpivRes.transfer_from(dIpiv));
+    if(TRUNCATED)
+        CHECK_HIP_ERROR(hRankRes.transfer_from(dRank));
+
+    // the choice of pivots depends on rounding, so the results are not compared with
+    // LAPACK; instead, the factorization A*P = Q*R and the pivoting strategy are verified.
+    // error is ||A*P - Q*R|| / ||A*P||
+    // using frobenius norm
+    double err, nerr = 0;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        // jpvt must be a permutation
+        std::copy(hJpvtRes[b], hJpvtRes[b] + n, hPerm.begin());
+        std::sort(hPerm.begin(), hPerm.end());
+        bool is_perm = true;
+        for(rocblas_int j = 0; j < n; j++)
+            is_perm = is_perm && (hPerm[j] == j + 1);
+        EXPECT_TRUE(is_perm) << "where b = " << b;
+        if(!is_perm)
+        {
+            nerr++;
+            continue;
+        }
+
+        // the numerical rank must be the rank of the generated matrix
+        if(TRUNCATED)
+        {
+            EXPECT_EQ(hRank[b][0], hRankRes[b][0]) << "where b = " << b;
+            if(hRank[b][0] != hRankRes[b][0])
+                nerr++;
+        }
+
+        // M = Q'*A*P is R, plus the partially updated trailing columns of the steps that
+        // were not executed (which have zero Householder scalars)
+        for(rocblas_int j = 0; j < n; j++)
+        {
+            for(rocblas_int i = 0; i < m; i++)
+            {
+                hAP[i + j * lda] = hA[b][i + (hJpvtRes[b][j] - 1) * lda];
+                hM[i + j * lda] = (i > j && j < dim && hIpivRes[b][j] != T(0))
+                    ? T(0)
+                    : hARes[b][i + j * lda];
+            }
+        }
+
+        // at every step j, |R(j,j)| is the largest partial norm of the remaining columns
+        // (up to the accuracy of the downdated norms, and only up to the rank of A)
+        rocblas_int npiv = 0;
+        for(rocblas_int k = 1; k < n; k++)
+        {
+            double pnorm = 0;
+            for(rocblas_int i = m - 1; i >= 0; i--)
+            {
+                pnorm += std::abs(hM[i + k * lda]) * std::abs(hM[i + k * lda]);
+                if(i < k && i < hRank[b][0]
+                   && pnorm > 1.01 * std::abs(hM[i + i * lda]) * std::abs(hM[i + i * lda]))
+                    npiv++;
+            }
+        }
+        EXPECT_EQ(npiv, 0) << "where b = " << b;
+        if(npiv)
+            nerr++;
+
+        cpu_ormqr_unmqr(rocblas_side_left, rocblas_operation_none, m, n, dim, hARes[b], lda,
+                        hIpivRes[b], hM.data(), lda, hW.data(), n);
+        err = norm_error('F', m, n, lda, hAP.data(), hM.data());
+        *max_err = err > *max_err ? err : *max_err;
+    }
+    *max_err += nerr;
+}
+
+template <bool STRIDED,
+          bool TRUNCATED,
+          typename T,
+          typename S,
+          typename Td,
+          typename Ud,
+          typename Vd,
+          typename Th,
+          typename Uh,
+          typename Vh>
+void geqp3_getPerfData(const rocblas_handle handle,
+                       const rocblas_int m,
+                       const rocblas_int n,
+                       Td& dA,
+                       const rocblas_int lda,
+                       const rocblas_stride stA,
+                       Ud& dJpvt,
+                       const rocblas_stride stJ,
+                       Vd& dIpiv,
+                       const rocblas_stride stP,
+                       const S tol,
+                       Ud& dRank,
+                       const rocblas_int bc,
+                       Th& hA,
+                       Uh& hJpvt,
+                       Vh& hIpiv,
+                       Uh& hRank,
+                       double* gpu_time_used,
+                       double* cpu_time_used,
+                       const rocblas_int hot_calls,
+                       const int profile,
+                       const bool profile_kernels,
+                       const bool perf,
+                       const bool singular)
+{
+    rocblas_int sizeW = 3 * n + 1;
+    std::vector<T> hW(sizeW);
+    std::vector<S> hRW(2 * n);
+    rocblas_int info;
+
+    if(!perf)
+    {
+        geqp3_initData<true, false, T>(handle, m, n, dA, lda, stA, bc, hA, hRank, singular);
+
+        // all the columns are free columns
+        for(rocblas_int b = 0; b < bc; ++b)
+            std::fill(hJpvt[b], hJpvt[b] + n, 0);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            cpu_geqp3(m, n, hA[b], lda, hJpvt[b], hIpiv[b], hW.data(), sizeW, hRW.data(), &info);
+        }
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    geqp3_initData<true, false, T>(handle, m, n, dA, lda, stA, bc, hA, hRank, singular);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        geqp3_initData<false, true, T>(handle, m, n, dA, lda, stA, bc, hA, hRank, singular);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_geqp3(STRIDED, TRUNCATED, handle, m, n, dA.data(), lda, stA,
+                                            dJpvt.data(), stJ, dIpiv.data(), stP, tol,
+                                            dRank.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        geqp3_initData<false, true, T>(handle, m, n, dA, lda, stA, bc, hA, hRank, singular);
+
+        start = get_time_us_sync(stream);
+        rocsolver_geqp3(STRIDED, TRUNCATED, handle, m, n, dA.data(), lda, stA, dJpvt.data(), stJ,
+                        dIpiv.data(), stP, tol, dRank.data(), bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, bool TRUNCATED, typename T>
+void testing_geqp3(Arguments& argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int m = argus.get<rocblas_int>("m");
+    rocblas_int n = argus.get<rocblas_int>("n", m);
+    rocblas_int lda = argus.get<rocblas_int>("lda", m);
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * n);
+    rocblas_stride stJ = argus.get<rocblas_stride>("strideJ", n);
+    rocblas_stride stP = argus.get<rocblas_stride>("strideP", min(m, n));
+    S tol = TRUNCATED ? S(argus.get<double>("tol", std::sqrt(get_epsilon<S>()))) : S(0);
+
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    rocblas_stride stARes = (argus.unit_check || argus.norm_check) ? stA : 0;
+
+    // check non-supported values
+    bool invalid_value = (TRUNCATED && tol < 0);
+    if(invalid_value)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, TRUNCATED, handle, m, n,
+                                                  (T* const*)nullptr, lda, stA,
+                                                  (rocblas_int*)nullptr, stJ, (T*)nullptr, stP, tol,
+                                                  (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_value);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, TRUNCATED, handle, m, n, (T*)nullptr,
+                                                  lda, stA, (rocblas_int*)nullptr, stJ, (T*)nullptr,
+                                                  stP, tol, (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_value);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_args);
+
+        return;
+    }
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_J = size_t(n);
+    size_t size_P = size_t(min(m, n));
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
+
+    // check invalid sizes
+    bool invalid_size = (m < 0 || n < 0 || lda < m || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, TRUNCATED, handle, m, n,
+                                                  (T* const*)nullptr, lda, stA,
+                                                  (rocblas_int*)nullptr, stJ, (T*)nullptr, stP, tol,
+                                                  (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, TRUNCATED, handle, m, n, (T*)nullptr,
+                                                  lda, stA, (rocblas_int*)nullptr, stJ, (T*)nullptr,
+                                                  stP, tol, (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_geqp3(STRIDED, TRUNCATED, handle, m, n, (T* const*)nullptr,
+                                              lda, stA, (rocblas_int*)nullptr, stJ, (T*)nullptr,
+                                              stP, tol, (rocblas_int*)nullptr, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_geqp3(STRIDED, TRUNCATED, handle, m, n, (T*)nullptr, lda,
+                                              stA, (rocblas_int*)nullptr, stJ, (T*)nullptr, stP,
+                                              tol, (rocblas_int*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform_mem_query(handle, size, argus.mem_query > 1);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations (all cases)
+    // host
+    host_strided_batch_vector<rocblas_int> hJpvt(size_J, 1, stJ, bc);
+    host_strided_batch_vector<T> hIpiv(size_P, 1, stP, bc);
+    host_strided_batch_vector<rocblas_int> hRank(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hRankRes(1, 1, 1, bc);
+    // device
+    device_strided_batch_vector<rocblas_int> dJpvt(size_J, 1, stJ, bc);
+    device_strided_batch_vector<T> dIpiv(size_P, 1, stP, bc);
+    device_strided_batch_vector<rocblas_int> dRank(1, 1, 1, bc);
+    if(size_J)
+        CHECK_HIP_ERROR(dJpvt.memcheck());
+    if(size_P)
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+    if(bc)
+        CHECK_HIP_ERROR(dRank.memcheck());
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(size_A, 1, bc);
+        host_batch_vector<T> hARes(size_ARes, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(m == 0 || n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, TRUNCATED, handle, m, n, dA.data(), lda,
+                                                  stA, dJpvt.data(), stJ, dIpiv.data(), stP, tol,
+                                                  dRank.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            geqp3_getError<STRIDED, TRUNCATED, T>(handle, m, n, dA, lda, stA, dJpvt, stJ, dIpiv,
+                                                  stP, tol, dRank, bc, hA, hARes, hJpvt, hIpiv,
+                                                  hRank, hRankRes, &max_error, argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            geqp3_getPerfData<STRIDED, TRUNCATED, T>(
+                handle, m, n, dA, lda, stA, dJpvt, stJ, dIpiv, stP, tol, dRank, bc, hA, hJpvt,
+                hIpiv, hRank, &gpu_time_used, &cpu_time_used, hot_calls, argus.profile,
+                argus.profile_kernels, argus.perf, argus.singular);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hARes(size_ARes, 1, stARes, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(m == 0 || n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_geqp3(STRIDED, TRUNCATED, handle, m, n, dA.data(), lda,
+                                                  stA, dJpvt.data(), stJ, dIpiv.data(), stP, tol,
+                                                  dRank.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            geqp3_getError<STRIDED, TRUNCATED, T>(handle, m, n, dA, lda, stA, dJpvt, stJ, dIpiv,
+                                                  stP, tol, dRank, bc, hA, hARes, hJpvt, hIpiv,
+                                                  hRank, hRankRes, &max_error, argus.singular);
+
+        // collect performance data
+        if(argus.timing)
+            geqp3_getPerfData<STRIDED, TRUNCATED, T>(
+                handle, m, n, dA, lda, stA, dJpvt, stJ, dIpiv, stP, tol, dRank, bc, hA, hJpvt,
+                hIpiv, hRank, &gpu_time_used, &cpu_time_used, hot_calls, argus.profile,
+                argus.profile_kernels, argus.perf, argus.singular);
+    }
+
+    // validate results for rocsolver-test
+    // using m * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, m);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            if(BATCHED)
+            {
+                rocsolver_bench_output("m", "n", "lda", "strideJ", "strideP", "batch_c");
+                rocsolver_bench_output(m, n, lda, stJ, stP, bc);
+            }
+            else if(STRIDED)
+            {
+                rocsolver_bench_output("m", "n", "lda", "strideA", "strideJ", "strideP", "batch_c");
+                rocsolver_bench_output(m, n, lda, stA, stJ, stP, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("m", "n", "lda");
+                rocsolver_bench_output(m, n, lda);
+            }
+            if(TRUNCATED)
+            {
+                rocsolver_bench_output("tol");
+                rocsolver_bench_output(tol);
+            }
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_GEQP3(...) extern template void testing_geqp3<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_GEQP3,
+            FOREACH_MATRIX_DATA_LAYOUT,
+            FOREACH_BLOCKED_VARIANT,
+            FOREACH_SCALAR_TYPE,
+            APPLY_STAMP)
@@ -33,4 +33,5 @@ INSTANTIATE(TESTING_GEQR2_GEQRF,
             FOREACH_MATRIX_DATA_LAYOUT,
             FOREACH_BLOCKED_VARIANT,
             FOREACH_SCALAR_TYPE,
+            FOREACH_INT_TYPE,
             APPLY_STAMP)
@@ -325,6 +325,12 @@ void testing_getf2_getrf_npvt(Arguments& argus)
     I bc = argus.batch_count;
     int hot_calls = argus.iters;
 
+    // select the algorithm to be tested (alg_mode is the offset from the default mode)
+    if(GETRF && argus.alg_mode)
+        CHECK_ROCBLAS_ERROR(rocsolver_set_alg_mode(
+            handle, rocsolver_function_getrf,
+            rocsolver_alg_mode(rocsolver_alg_mode_default + argus.alg_mode)));
+
     rocblas_stride stARes = (argus.unit_check || argus.norm_check) ? stA : 0;
 
     // check non-supported values
@@ -372,7 +378,7 @@ void testing_getf2_getrf_npvt(Arguments& argus)
         CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
         if(argus.mem_query)
         {
-            rocsolver_bench_inform(inform_mem_query, size);
+            rocsolver_bench_inform_mem_query(handle, size, argus.mem_query > 1);
             return;
         }
 
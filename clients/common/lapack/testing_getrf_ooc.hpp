@@ -0,0 +1,428 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+template <typename Th, typename Id>
+void getrf_ooc_checkBadArgs(const rocblas_handle handle,
+                            const rocblas_int m,
+                            const rocblas_int n,
+                            Th hA,
+                            const rocblas_int lda,
+                            Id dIpiv,
+                            Id dInfo)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_ooc(nullptr, m, n, hA, lda, dIpiv, dInfo),
+                          rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes (only check batch_count if applicable)
+    // N/A
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_ooc(handle, m, n, (Th) nullptr, lda, dIpiv, dInfo),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_ooc(handle, m, n, hA, lda, (Id) nullptr, dInfo),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_ooc(handle, m, n, hA, lda, dIpiv, (Id) nullptr),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_ooc(handle, 0, n, (Th) nullptr, lda, (Id) nullptr, dInfo),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_ooc(handle, m, 0, (Th) nullptr, lda, (Id) nullptr, dInfo),
+                          rocblas_status_success);
+}
+
+template <typename T>
+void testing_getrf_ooc_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int m = 1;
+    rocblas_int n = 1;
+    rocblas_int lda = 1;
+
+    // memory allocations
+    // (the matrix is on the host)
+    host_strided_batch_vector<T> hA(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dIpiv(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // check bad arguments
+    getrf_ooc_checkBadArgs(handle, m, n, hA.data(), lda, dIpiv.data(), dInfo.data());
+}
+
+template <bool CPU, bool GPU, typename T, typename Th>
+void getrf_ooc_initData(const rocblas_handle handle,
+                        const rocblas_int m,
+                        const rocblas_int n,
+                        Th& hARes,
+                        const rocblas_int lda,
+                        Th& hA,
+                        const bool singular)
+{
+    if(CPU)
+    {
+        T tmp;
+        rocblas_init<T>(hA, true);
+
+        // scale A to avoid singularities
+        for(rocblas_int i = 0; i < m; i++)
+        {
+            for(rocblas_int j = 0; j < n; j++)
+            {
+                if(i == j)
+                    hA[0][i + j * lda] += 400;
+                else
+                    hA[0][i + j * lda] -= 4;
+            }
+        }
+
+        // shuffle rows to test pivoting
+        // always the same permuation for debugging purposes
+        for(rocblas_int i = 0; i < m / 2; i++)
+        {
+            for(rocblas_int j = 0; j < n; j++)
+            {
+                tmp = hA[0][i + j * lda];
+                hA[0][i + j * lda] = hA[0][m - 1 - i + j * lda];
+                hA[0][m - 1 - i + j * lda] = tmp;
+            }
+        }
+
+        if(singular)
+        {
+            // When required, add some singularities
+            // (always the same elements for debugging purposes).
+            // The algorithm must detect the first zero pivot, which is in a
+            // later panel when n is large enough
+            for(rocblas_int i = 0; i < m; i++)
+            {
+                hA[0][i + (n / 4) * lda] = 0;
+                hA[0][i + (n / 2) * lda] = 0;
+                hA[0][i + (n - 1) * lda] = 0;
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy data to the host matrix processed by the GPU
+        // (it is overwritten with the factors)
+        std::copy(hA[0], hA[0] + size_t(lda) * n, hARes[0]);
+    }
+}
+
+template <typename T, typename Th, typename Id, typename Uh>
+void getrf_ooc_getError(const rocblas_handle handle,
+                        const rocblas_int m,
+                        const rocblas_int n,
+                        Th& hARes,
+                        const rocblas_int lda,
+                        Id& dIpiv,
+                        Id& dInfo,
+                        Th& hA,
+                        Uh& hIpiv,
+                        Uh& hIpivRes,
+                        Uh& hInfo,
+                        Uh& hInfoRes,
+                        double* max_err,
+                        const bool singular)
+{
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+    // input data initialization
+    getrf_ooc_initData<true, true, T>(handle, m, n, hARes, lda, hA, singular);
+
+    // execute computations
+    // GPU lapack
+    // (the host matrix is updated asynchronously)
+    CHECK_ROCBLAS_ERROR(rocsolver_getrf_ooc(handle, m, n, hARes.data(), lda, dIpiv.data(),
+                                            dInfo.data()));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    CHECK_HIP_ERROR(hIpivRes.transfer_from(dIpiv));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // CPU lapack
+    cpu_getrf(m, n, hA[0], lda, hIpiv[0], hInfo[0]);
+
+    // expecting original matrix to be non-singular
+    // error is ||hA - hARes|| / ||hA|| (ideally ||LU - Lres Ures|| / ||LU||)
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using frobenius norm
+    double err;
+    *max_err = norm_error('F', m, n, lda, hA[0], hARes[0]);
+
+    // also check pivoting (count the number of incorrect pivots)
+    err = 0;
+    for(rocblas_int i = 0; i < min(m, n); ++i)
+    {
+        EXPECT_EQ(hIpiv[0][i], hIpivRes[0][i]) << "where i = " << i;
+        if(hIpiv[0][i] != hIpivRes[0][i])
+            err++;
+    }
+    *max_err = err > *max_err ? err : *max_err;
+
+    // the rows of the padding are not modified
+    err = 0;
+    for(rocblas_int j = 0; j < n; j++)
+    {
+        for(rocblas_int i = m; i < lda; i++)
+        {
+            if(hA[0][i + j * lda] != hARes[0][i + j * lda])
+                err++;
+        }
+    }
+    EXPECT_EQ(err, 0) << "elements modified outside of the matrix";
+    *max_err += err;
+
+    // also check info for singularities
+    EXPECT_EQ(hInfo[0][0], hInfoRes[0][0]);
+    if(hInfo[0][0] != hInfoRes[0][0])
+        *max_err += 1;
+}
+
+template <typename T, typename Th, typename Id, typename Uh>
+void getrf_ooc_getPerfData(const rocblas_handle handle,
+                           const rocblas_int m,
+                           const rocblas_int n,
+                           Th& hARes,
+                           const rocblas_int lda,
+                           Id& dIpiv,
+                           Id& dInfo,
+                           Th& hA,
+                           Uh& hIpiv,
+                           Uh& hInfo,
+                           double* gpu_time_used,
+                           double* cpu_time_used,
+                           const int hot_calls,
+                           const int profile,
+                           const bool profile_kernels,
+                           const bool perf,
+                           const bool singular)
+{
+    if(!perf)
+    {
+        getrf_ooc_initData<true, false, T>(handle, m, n, hARes, lda, hA, singular);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        cpu_getrf(m, n, hA[0], lda, hIpiv[0], hInfo[0]);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    getrf_ooc_initData<true, false, T>(handle, m, n, hARes, lda, hA, singular);
+
+    // gpu-lapack performance
+    // (the stream must be synchronized before the host matrix is initialized again)
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        getrf_ooc_initData<false, true, T>(handle, m, n, hARes, lda, hA, singular);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_getrf_ooc(handle, m, n, hARes.data(), lda, dIpiv.data(),
+                                                dInfo.data()));
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    }
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(int iter = 0; iter < hot_calls; iter++)
+    {
+        getrf_ooc_initData<false, true, T>(handle, m, n, hARes, lda, hA, singular);
+
+        start = get_time_us_sync(stream);
+        rocsolver_getrf_ooc(handle, m, n, hARes.data(), lda, dIpiv.data(), dInfo.data());
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <typename T>
+void testing_getrf_ooc(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int m = argus.get<rocblas_int>("m");
+    rocblas_int n = argus.get<rocblas_int>("n", m);
+    rocblas_int lda = argus.get<rocblas_int>("lda", m);
+
+    int hot_calls = argus.iters;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_P = size_t(min(m, n));
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_PRes = (argus.unit_check || argus.norm_check) ? size_P : 0;
+
+    // check invalid sizes
+    bool invalid_size = (m < 0 || n < 0 || lda < m);
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_getrf_ooc(handle, m, n, (T*)nullptr, lda,
+                                                  (rocblas_int*)nullptr, (rocblas_int*)nullptr),
+                              rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        CHECK_ALLOC_QUERY(rocsolver_getrf_ooc(handle, m, n, (T*)nullptr, lda, (rocblas_int*)nullptr,
+                                              (rocblas_int*)nullptr));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform_mem_query(handle, size, argus.mem_query > 1);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations
+    // (the matrix processed by the GPU is on the host, and it is pinned so that its transfers
+    // are overlapped with the computations)
+    host_strided_batch_vector<T> hA(size_A, 1, size_A, 1);
+    host_strided_batch_vector<T> hARes(size_A, 1, size_A, 1);
+    host_strided_batch_vector<rocblas_int> hIpiv(size_P, 1, size_P, 1);
+    host_strided_batch_vector<rocblas_int> hIpivRes(size_PRes, 1, size_PRes, 1);
+    host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, 1);
+    host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dIpiv(size_P, 1, size_P, 1);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+    rocblas_local_pinned_host pinned(hARes.data(), sizeof(T) * size_A);
+    CHECK_HIP_ERROR(pinned.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+    if(size_P)
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+
+    // check quick return
+    if(m == 0 || n == 0)
+    {
+        EXPECT_ROCBLAS_STATUS(
+            rocsolver_getrf_ooc(handle, m, n, hARes.data(), lda, dIpiv.data(), dInfo.data()),
+            rocblas_status_success);
+        if(argus.timing)
+            rocsolver_bench_inform(inform_quick_return);
+
+        return;
+    }
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        getrf_ooc_getError<T>(handle, m, n, hARes, lda, dIpiv, dInfo, hA, hIpiv, hIpivRes, hInfo,
+                              hInfoRes, &max_error, argus.singular);
+
+    // collect performance data
+    if(argus.timing)
+        getrf_ooc_getPerfData<T>(handle, m, n, hARes, lda, dIpiv, dInfo, hA, hIpiv, hInfo,
+                                 &gpu_time_used, &cpu_time_used, hot_calls, argus.profile,
+                                 argus.profile_kernels, argus.perf, argus.singular);
+
+    // validate results for rocsolver-test
+    // using min(m,n) * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, min(m, n));
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            rocsolver_bench_output("m", "n", "lda");
+            rocsolver_bench_output(m, n, lda);
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_GETRF_OOC(...) \
+    extern template void testing_getrf_ooc<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_GETRF_OOC, FOREACH_SCALAR_TYPE, APPLY_STAMP)
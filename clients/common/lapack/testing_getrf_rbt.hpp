@@ -0,0 +1,547 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+/** Overwrites the n-by-n matrix A with U'*A*V, where U and V are the depth-2 recursive
+    butterflies stored in UV as returned by GETRF_RBT (the levels of U followed by the levels of
+    V, n values per level). This mirrors the transforms applied on the device. **/
+template <typename T, typename S>
+void getrf_rbt_transform(const rocblas_int n, T* A, const rocblas_int lda, const S* UV)
+{
+    const rocblas_int depth = 2;
+    const S s = S(1) / std::sqrt(S(2));
+
+    // the columns of A are transformed by U and the rows by V
+    for(rocblas_int side = 0; side < 2; ++side)
+    {
+        const rocblas_int incx = (side == 0) ? 1 : lda;
+        const rocblas_int ldv = (side == 0) ? lda : 1;
+
+        // W' = W_0'*W_1'*...*W_(depth-1)' is applied starting with the finest level
+        for(rocblas_int level = depth - 1; level >= 0; --level)
+        {
+            const S* r = UV + (side * depth + level) * n;
+            for(rocblas_int b = 0; b < (1 << level); ++b)
+            {
+                const rocblas_int start = (b * n) >> level;
+                const rocblas_int h = ((((b + 1) * n) >> level) - start) / 2;
+                for(rocblas_int i = start; i < start + h; ++i)
+                {
+                    for(rocblas_int j = 0; j < n; ++j)
+                    {
+                        T* x1 = A + i * incx + j * ldv;
+                        T* x2 = A + (i + h) * incx + j * ldv;
+                        const T a = *x1;
+                        const T c = *x2;
+                        *x1 = (a + c) * T(r[i] * s);
+                        *x2 = (a - c) * T(r[i + h] * s);
+                    }
+                }
+            }
+        }
+    }
+}
+
+template <bool STRIDED, typename Td, typename Sd, typename Id>
+void getrf_rbt_checkBadArgs(const rocblas_handle handle,
+                            const rocblas_int n,
+                            Td dA,
+                            const rocblas_int lda,
+                            const rocblas_stride stA,
+                            Sd dUV,
+                            const rocblas_stride stUV,
+                            Id dInfo,
+                            const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_getrf_rbt(STRIDED, nullptr, n, dA, lda, stA, dUV, stUV, dInfo, bc),
+        rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_getrf_rbt(STRIDED, handle, n, dA, lda, stA, dUV, 4 * n - 1, dInfo, bc),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_getrf_rbt(STRIDED, handle, n, dA, lda, stA, dUV, stUV, dInfo, -1),
+        rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_getrf_rbt(STRIDED, handle, n, (Td) nullptr, lda, stA, dUV, stUV, dInfo, bc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_getrf_rbt(STRIDED, handle, n, dA, lda, stA, (Sd) nullptr, stUV, dInfo, bc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_getrf_rbt(STRIDED, handle, n, dA, lda, stA, dUV, stUV, (Id) nullptr, bc),
+        rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_rbt(STRIDED, handle, 0, (Td) nullptr, lda, stA,
+                                              (Sd) nullptr, stUV, dInfo, bc),
+                          rocblas_status_success);
+
+    // quick return with zero batch_count
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_rbt(STRIDED, handle, n, (Td) nullptr, lda, stA,
+                                              (Sd) nullptr, stUV, (Id) nullptr, 0),
+                          rocblas_status_success);
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_getrf_rbt_bad_arg()
+{
+    using S = decltype(std::real(T{}));
+
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int n = 1;
+    rocblas_int lda = 1;
+    rocblas_stride stA = 1;
+    rocblas_stride stUV = 4;
+    rocblas_int bc = 1;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T> dA(1, 1, 1);
+        device_strided_batch_vector<S> dUV(4, 1, 4, 1);
+        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dUV.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        // check bad arguments
+        getrf_rbt_checkBadArgs<STRIDED>(handle, n, dA.data(), lda, stA, dUV.data(), stUV,
+                                        dInfo.data(), bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T> dA(1, 1, 1, 1);
+        device_strided_batch_vector<S> dUV(4, 1, 4, 1);
+        device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dUV.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        // check bad arguments
+        getrf_rbt_checkBadArgs<STRIDED>(handle, n, dA.data(), lda, stA, dUV.data(), stUV,
+                                        dInfo.data(), bc);
+    }
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void getrf_rbt_initData(const rocblas_handle handle,
+                        const rocblas_int n,
+                        Td& dA,
+                        const rocblas_int lda,
+                        const rocblas_stride stA,
+                        const rocblas_int bc,
+                        Th& hA)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+
+        // scale A to avoid singularities
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            for(rocblas_int i = 0; i < n; i++)
+            {
+                for(rocblas_int j = 0; j < n; j++)
+                {
+                    if(i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+                }
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy data to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <bool STRIDED,
+          typename T,
+          typename Td,
+          typename Sd,
+          typename Ud,
+          typename Th,
+          typename Sh,
+          typename Uh>
+void getrf_rbt_getError(const rocblas_handle handle,
+                        const rocblas_int n,
+                        Td& dA,
+                        const rocblas_int lda,
+                        const rocblas_stride stA,
+                        Sd& dUV,
+                        const rocblas_stride stUV,
+                        Ud& dInfo,
+                        const rocblas_int bc,
+                        Th& hA,
+                        Th& hARes,
+                        Sh& hUV,
+                        Uh& hInfoRes,
+                        double* max_err)
+{
+    std::vector<T> hLR(size_t(lda) * n);
+
+    // input data initialization
+    getrf_rbt_initData<true, true, T>(handle, n, dA, lda, stA, bc, hA);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_getrf_rbt(STRIDED, handle, n, dA.data(), lda, stA, dUV.data(),
+                                            stUV, dInfo.data(), bc));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hUV.transfer_from(dUV));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // the transformed matrices are expected to be factorized without breakdown
+    double err = 0;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        EXPECT_EQ(hInfoRes[b][0], 0) << "where b = " << b;
+        if(hInfoRes[b][0] != 0)
+            err++;
+    }
+    *max_err += err;
+
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        // apply the returned transforms to the original matrix on the CPU
+        getrf_rbt_transform(n, hA[b], lda, hUV[b]);
+
+        // reconstruct the transformed matrix from the factors L and R
+        for(rocblas_int i = 0; i < n; i++)
+        {
+            for(rocblas_int j = 0; j < n; j++)
+                hLR[i + j * lda] = (i <= j) ? hARes[b][i + j * lda] : T(0);
+        }
+        cpu_trmm(rocblas_side_left, rocblas_fill_lower, rocblas_operation_none,
+                 rocblas_diagonal_unit, n, n, T(1), hARes[b], lda, hLR.data(), lda);
+
+        // error is ||U'AV - LR|| / ||U'AV||
+        // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+        // IT MIGHT BE REVISITED IN THE FUTURE)
+        // using frobenius norm
+        err = norm_error('F', n, n, lda, hA[b], hLR.data());
+        *max_err = err > *max_err ? err : *max_err;
+    }
+}
+
+template <bool STRIDED, typename T, typename Td, typename Sd, typename Ud, typename Th, typename Uh>
+void getrf_rbt_getPerfData(const rocblas_handle handle,
+                           const rocblas_int n,
+                           Td& dA,
+                           const rocblas_int lda,
+                           const rocblas_stride stA,
+                           Sd& dUV,
+                           const rocblas_stride stUV,
+                           Ud& dInfo,
+                           const rocblas_int bc,
+                           Th& hA,
+                           Uh& hIpiv,
+                           Uh& hInfo,
+                           double* gpu_time_used,
+                           double* cpu_time_used,
+                           const rocblas_int hot_calls,
+                           const int profile,
+                           const bool profile_kernels,
+                           const bool perf)
+{
+    if(!perf)
+    {
+        getrf_rbt_initData<true, false, T>(handle, n, dA, lda, stA, bc, hA);
+
+        // cpu-lapack performance (only if not in perf mode)
+        // (the reference is the LU factorization with partial pivoting)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            cpu_getrf(n, n, hA[b], lda, hIpiv[b], hInfo[b]);
+        }
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    getrf_rbt_initData<true, false, T>(handle, n, dA, lda, stA, bc, hA);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        getrf_rbt_initData<false, true, T>(handle, n, dA, lda, stA, bc, hA);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_getrf_rbt(STRIDED, handle, n, dA.data(), lda, stA,
+                                                dUV.data(), stUV, dInfo.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        getrf_rbt_initData<false, true, T>(handle, n, dA, lda, stA, bc, hA);
+
+        start = get_time_us_sync(stream);
+        rocsolver_getrf_rbt(STRIDED, handle, n, dA.data(), lda, stA, dUV.data(), stUV,
+                            dInfo.data(), bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_getrf_rbt(Arguments& argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int lda = argus.get<rocblas_int>("lda", n);
+    rocblas_stride stA = argus.get<rocblas_stride>("strideA", lda * n);
+    rocblas_stride stUV = argus.get<rocblas_stride>("strideUV", 4 * n);
+
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    rocblas_stride stARes = (argus.unit_check || argus.norm_check) ? stA : 0;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_UV = size_t(4) * n;
+    size_t size_P = size_t(n);
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || lda < n || stUV < 4 * n || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+            EXPECT_ROCBLAS_STATUS(rocsolver_getrf_rbt(STRIDED, handle, n, (T* const*)nullptr, lda,
+                                                      stA, (S*)nullptr, stUV,
+                                                      (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_getrf_rbt(STRIDED, handle, n, (T*)nullptr, lda, stA,
+                                                      (S*)nullptr, stUV, (rocblas_int*)nullptr, bc),
+                                  rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        if(BATCHED)
+            CHECK_ALLOC_QUERY(rocsolver_getrf_rbt(STRIDED, handle, n, (T* const*)nullptr, lda, stA,
+                                                  (S*)nullptr, stUV, (rocblas_int*)nullptr, bc));
+        else
+            CHECK_ALLOC_QUERY(rocsolver_getrf_rbt(STRIDED, handle, n, (T*)nullptr, lda, stA,
+                                                  (S*)nullptr, stUV, (rocblas_int*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform_mem_query(handle, size, argus.mem_query > 1);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations (all cases)
+    host_strided_batch_vector<S> hUV(size_UV, 1, stUV, bc);
+    host_strided_batch_vector<rocblas_int> hIpiv(size_P, 1, size_P, bc);
+    host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, bc);
+    device_strided_batch_vector<S> dUV(size_UV, 1, stUV, bc);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+    if(size_UV)
+        CHECK_HIP_ERROR(dUV.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(size_A, 1, bc);
+        host_batch_vector<T> hARes(size_ARes, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_getrf_rbt(STRIDED, handle, n, dA.data(), lda, stA,
+                                                      dUV.data(), stUV, dInfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            getrf_rbt_getError<STRIDED, T>(handle, n, dA, lda, stA, dUV, stUV, dInfo, bc, hA,
+                                           hARes, hUV, hInfoRes, &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            getrf_rbt_getPerfData<STRIDED, T>(handle, n, dA, lda, stA, dUV, stUV, dInfo, bc, hA,
+                                              hIpiv, hInfo, &gpu_time_used, &cpu_time_used,
+                                              hot_calls, argus.profile, argus.profile_kernels,
+                                              argus.perf);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T> hARes(size_ARes, 1, stARes, bc);
+        device_strided_batch_vector<T> dA(size_A, 1, stA, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check quick return
+        if(n == 0 || bc == 0)
+        {
+            EXPECT_ROCBLAS_STATUS(rocsolver_getrf_rbt(STRIDED, handle, n, dA.data(), lda, stA,
+                                                      dUV.data(), stUV, dInfo.data(), bc),
+                                  rocblas_status_success);
+            if(argus.timing)
+                rocsolver_bench_inform(inform_quick_return);
+
+            return;
+        }
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            getrf_rbt_getError<STRIDED, T>(handle, n, dA, lda, stA, dUV, stUV, dInfo, bc, hA,
+                                           hARes, hUV, hInfoRes, &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            getrf_rbt_getPerfData<STRIDED, T>(handle, n, dA, lda, stA, dUV, stUV, dInfo, bc, hA,
+                                              hIpiv, hInfo, &gpu_time_used, &cpu_time_used,
+                                              hot_calls, argus.profile, argus.profile_kernels,
+                                              argus.perf);
+    }
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            if(BATCHED)
+            {
+                rocsolver_bench_output("n", "lda", "strideUV", "batch_c");
+                rocsolver_bench_output(n, lda, stUV, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("n", "lda", "strideA", "strideUV", "batch_c");
+                rocsolver_bench_output(n, lda, stA, stUV, bc);
+            }
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_GETRF_RBT(...) \
+    extern template void testing_getrf_rbt<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_GETRF_RBT, FOREACH_BATCHED_DATA_LAYOUT, FOREACH_SCALAR_TYPE, APPLY_STAMP)
@@ -0,0 +1,572 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+/** Returns the size of problem b of a variable-size batch whose largest size is max. The sizes
+    cycle through max, 3*max/4, max/2 and max/4, reduced by (b/4) % 3, so that the batch has
+    repeated sizes as well as different sizes in the same size class. **/
+inline rocblas_int vbatched_size(const rocblas_int max, const rocblas_int b)
+{
+    return std::max(max - (max * (b % 4)) / 4 - (b / 4) % 3, 0);
+}
+
+/** Returns the leading dimension of a problem of the given size in a variable-size batch,
+    where ld is the leading dimension of the problems of the largest size max. **/
+inline rocblas_int vbatched_ld(const rocblas_int ld, const rocblas_int max, const rocblas_int size)
+{
+    return std::max(ld - max + size, 1);
+}
+
+template <typename Td, typename Ud, typename Id>
+void getrf_vbatched_checkBadArgs(const rocblas_handle handle,
+                                 const Ud dM,
+                                 const Ud dN,
+                                 Td dA,
+                                 const Ud dLda,
+                                 Id dIpiv,
+                                 Ud dInfo,
+                                 const rocblas_int max_m,
+                                 const rocblas_int max_n,
+                                 const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_getrf_vbatched(nullptr, dM, dN, dA, dLda, dIpiv, dInfo, max_m, max_n, bc),
+        rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes (if applicable)
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_getrf_vbatched(handle, dM, dN, dA, dLda, dIpiv, dInfo, -1, max_n, bc),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_getrf_vbatched(handle, dM, dN, dA, dLda, dIpiv, dInfo, max_m, -1, bc),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_getrf_vbatched(handle, dM, dN, dA, dLda, dIpiv, dInfo, max_m, max_n, -1),
+        rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_vbatched(handle, (Ud) nullptr, dN, dA, dLda, dIpiv, dInfo,
+                                                   max_m, max_n, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_vbatched(handle, dM, (Ud) nullptr, dA, dLda, dIpiv, dInfo,
+                                                   max_m, max_n, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_vbatched(handle, dM, dN, (Td) nullptr, dLda, dIpiv, dInfo,
+                                                   max_m, max_n, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_getrf_vbatched(handle, dM, dN, dA, (Ud) nullptr, dIpiv, dInfo, max_m, max_n, bc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_getrf_vbatched(handle, dM, dN, dA, dLda, (Id) nullptr, dInfo, max_m, max_n, bc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_getrf_vbatched(handle, dM, dN, dA, dLda, dIpiv, (Ud) nullptr, max_m, max_n, bc),
+        rocblas_status_invalid_pointer);
+
+    // sizes of the problems (checked once they are read from the device)
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_getrf_vbatched(handle, dM, dN, dA, dLda, dIpiv, dInfo, 0, max_n, bc),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_getrf_vbatched(handle, dM, dN, dA, dLda, dIpiv, dInfo, max_m, 0, bc),
+        rocblas_status_invalid_size);
+
+    // quick return with zero batch_count
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrf_vbatched(handle, (Ud) nullptr, (Ud) nullptr, (Td) nullptr,
+                                                   (Ud) nullptr, (Id) nullptr, (Ud) nullptr, max_m,
+                                                   max_n, 0),
+                          rocblas_status_success);
+}
+
+template <typename T>
+void testing_getrf_vbatched_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int max_m = 1;
+    rocblas_int max_n = 1;
+    rocblas_int bc = 1;
+
+    // memory allocations
+    host_strided_batch_vector<rocblas_int> hSize(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dM(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dN(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dLda(1, 1, 1, 1);
+    device_batch_vector<T> dA(1, 1, 1);
+    device_batch_vector<rocblas_int> dIpiv(1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dM.memcheck());
+    CHECK_HIP_ERROR(dN.memcheck());
+    CHECK_HIP_ERROR(dLda.memcheck());
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // the single problem of the batch is 1-by-1
+    hSize[0][0] = 1;
+    CHECK_HIP_ERROR(dM.transfer_from(hSize));
+    CHECK_HIP_ERROR(dN.transfer_from(hSize));
+    CHECK_HIP_ERROR(dLda.transfer_from(hSize));
+
+    // check bad arguments
+    getrf_vbatched_checkBadArgs(handle, dM.data(), dN.data(), dA.data(), dLda.data(), dIpiv.data(),
+                                dInfo.data(), max_m, max_n, bc);
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Uh, typename Th>
+void getrf_vbatched_initData(const rocblas_handle handle,
+                             Uh& hM,
+                             Uh& hN,
+                             Td& dA,
+                             Uh& hLda,
+                             const rocblas_int bc,
+                             Th& hA,
+                             const bool singular)
+{
+    if(CPU)
+    {
+        T tmp;
+        rocblas_init<T>(hA, true);
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            rocblas_int m = hM[b][0];
+            rocblas_int n = hN[b][0];
+            rocblas_int lda = hLda[b][0];
+
+            // scale A to avoid singularities
+            for(rocblas_int i = 0; i < m; i++)
+            {
+                for(rocblas_int j = 0; j < n; j++)
+                {
+                    if(i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+                }
+            }
+
+            // shuffle rows to test pivoting
+            // always the same permuation for debugging purposes
+            for(rocblas_int i = 0; i < m / 2; i++)
+            {
+                for(rocblas_int j = 0; j < n; j++)
+                {
+                    tmp = hA[b][i + j * lda];
+                    hA[b][i + j * lda] = hA[b][m - 1 - i + j * lda];
+                    hA[b][m - 1 - i + j * lda] = tmp;
+                }
+            }
+
+            if(singular && n > 0 && (b == bc / 4 || b == bc / 2 || b == bc - 1))
+            {
+                // When required, add some singularities
+                // (always the same elements for debugging purposes).
+                // The algorithm must detect the first zero pivot in those
+                // matrices in the batch that are singular
+                rocblas_int j = n / 4 + b;
+                j -= (j / n) * n;
+                for(rocblas_int i = 0; i < m; i++)
+                    hA[b][i + j * lda] = 0;
+                j = n / 2 + b;
+                j -= (j / n) * n;
+                for(rocblas_int i = 0; i < m; i++)
+                    hA[b][i + j * lda] = 0;
+                j = n - 1 + b;
+                j -= (j / n) * n;
+                for(rocblas_int i = 0; i < m; i++)
+                    hA[b][i + j * lda] = 0;
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy data to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <typename T, typename Td, typename Id, typename Ud, typename Th, typename Ih, typename Uh>
+void getrf_vbatched_getError(const rocblas_handle handle,
+                             Ud& dM,
+                             Ud& dN,
+                             Td& dA,
+                             Ud& dLda,
+                             Id& dIpiv,
+                             Ud& dInfo,
+                             const rocblas_int max_m,
+                             const rocblas_int max_n,
+                             const rocblas_int bc,
+                             Uh& hM,
+                             Uh& hN,
+                             Uh& hLda,
+                             Th& hA,
+                             Th& hARes,
+                             Ih& hIpiv,
+                             Ih& hIpivRes,
+                             Uh& hInfo,
+                             Uh& hInfoRes,
+                             double* max_err,
+                             const bool singular)
+{
+    // input data initialization
+    getrf_vbatched_initData<true, true, T>(handle, hM, hN, dA, hLda, bc, hA, singular);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_getrf_vbatched(handle, dM.data(), dN.data(), dA.data(),
+                                                 dLda.data(), dIpiv.data(), dInfo.data(), max_m,
+                                                 max_n, bc));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hIpivRes.transfer_from(dIpiv));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // CPU lapack
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        cpu_getrf(hM[b][0], hN[b][0], hA[b], hLda[b][0], hIpiv[b], hInfo[b]);
+    }
+
+    // expecting original matrix to be non-singular
+    // error is ||hA - hARes|| / ||hA|| (ideally ||LU - Lres Ures|| / ||LU||)
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using frobenius norm
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        rocblas_int m = hM[b][0];
+        rocblas_int n = hN[b][0];
+
+        // (empty problems are left untouched)
+        if(m == 0 || n == 0)
+            continue;
+
+        err = norm_error('F', m, n, hLda[b][0], hA[b], hARes[b]);
+        *max_err = err > *max_err ? err : *max_err;
+
+        // also check pivoting (count the number of incorrect pivots)
+        err = 0;
+        for(rocblas_int i = 0; i < min(m, n); ++i)
+        {
+            EXPECT_EQ(hIpiv[b][i], hIpivRes[b][i]) << "where b = " << b << ", i = " << i;
+            if(hIpiv[b][i] != hIpivRes[b][i])
+                err++;
+        }
+        *max_err = err > *max_err ? err : *max_err;
+    }
+
+    // also check info for singularities
+    err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        EXPECT_EQ(hInfo[b][0], hInfoRes[b][0]) << "where b = " << b;
+        if(hInfo[b][0] != hInfoRes[b][0])
+            err++;
+    }
+    *max_err += err;
+}
+
+template <typename T, typename Td, typename Id, typename Ud, typename Th, typename Ih, typename Uh>
+void getrf_vbatched_getPerfData(const rocblas_handle handle,
+                                Ud& dM,
+                                Ud& dN,
+                                Td& dA,
+                                Ud& dLda,
+                                Id& dIpiv,
+                                Ud& dInfo,
+                                const rocblas_int max_m,
+                                const rocblas_int max_n,
+                                const rocblas_int bc,
+                                Uh& hM,
+                                Uh& hN,
+                                Uh& hLda,
+                                Th& hA,
+                                Ih& hIpiv,
+                                Uh& hInfo,
+                                double* gpu_time_used,
+                                double* cpu_time_used,
+                                const rocblas_int hot_calls,
+                                const int profile,
+                                const bool profile_kernels,
+                                const bool perf,
+                                const bool singular)
+{
+    if(!perf)
+    {
+        getrf_vbatched_initData<true, false, T>(handle, hM, hN, dA, hLda, bc, hA, singular);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            cpu_getrf(hM[b][0], hN[b][0], hA[b], hLda[b][0], hIpiv[b], hInfo[b]);
+        }
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    getrf_vbatched_initData<true, false, T>(handle, hM, hN, dA, hLda, bc, hA, singular);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        getrf_vbatched_initData<false, true, T>(handle, hM, hN, dA, hLda, bc, hA, singular);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_getrf_vbatched(handle, dM.data(), dN.data(), dA.data(),
+                                                     dLda.data(), dIpiv.data(), dInfo.data(), max_m,
+                                                     max_n, bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        getrf_vbatched_initData<false, true, T>(handle, hM, hN, dA, hLda, bc, hA, singular);
+
+        start = get_time_us_sync(stream);
+        rocsolver_getrf_vbatched(handle, dM.data(), dN.data(), dA.data(), dLda.data(), dIpiv.data(),
+                                 dInfo.data(), max_m, max_n, bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <typename T>
+void testing_getrf_vbatched(Arguments& argus)
+{
+    // get arguments
+    // (m, n and lda are the sizes and the leading dimension of the largest problems; problem b
+    // is vbatched_size(m, b)-by-vbatched_size(n, b), with leading dimension lda reduced by the
+    // same number of rows)
+    rocblas_local_handle handle;
+    rocblas_int m = argus.get<rocblas_int>("m");
+    rocblas_int n = argus.get<rocblas_int>("n", m);
+    rocblas_int lda = argus.get<rocblas_int>("lda", m);
+
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    // check non-supported values
+    // N/A
+
+    // check invalid sizes
+    bool invalid_size = (m < 0 || n < 0 || bc < 0);
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_getrf_vbatched(handle, (rocblas_int*)nullptr,
+                                                       (rocblas_int*)nullptr, (T* const*)nullptr,
+                                                       (rocblas_int*)nullptr,
+                                                       (rocblas_int* const*)nullptr,
+                                                       (rocblas_int*)nullptr, m, n, bc),
+                              rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // determine sizes
+    // (every problem fits in the space of the largest one, which is allocated even if it is
+    // empty, as the arrays of pointers cannot be null)
+    size_t size_A = size_t(std::max(lda, 1)) * std::max(n, 1);
+    size_t size_P = size_t(std::max(min(m, n), 1));
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
+    size_t size_PRes = (argus.unit_check || argus.norm_check) ? size_P : 0;
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        CHECK_ALLOC_QUERY(rocsolver_getrf_vbatched(handle, (rocblas_int*)nullptr,
+                                                   (rocblas_int*)nullptr, (T* const*)nullptr,
+                                                   (rocblas_int*)nullptr,
+                                                   (rocblas_int* const*)nullptr,
+                                                   (rocblas_int*)nullptr, m, n, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform_mem_query(handle, size, argus.mem_query > 1);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations
+    host_strided_batch_vector<rocblas_int> hM(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hN(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hLda(1, 1, 1, bc);
+    host_batch_vector<T> hA(size_A, 1, bc);
+    host_batch_vector<T> hARes(size_ARes, 1, bc);
+    host_batch_vector<rocblas_int> hIpiv(size_P, 1, bc);
+    host_batch_vector<rocblas_int> hIpivRes(size_PRes, 1, bc);
+    host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dM(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dN(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dLda(1, 1, 1, bc);
+    device_batch_vector<T> dA(size_A, 1, bc);
+    device_batch_vector<rocblas_int> dIpiv(size_P, 1, bc);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+    CHECK_HIP_ERROR(dM.memcheck());
+    CHECK_HIP_ERROR(dN.memcheck());
+    CHECK_HIP_ERROR(dLda.memcheck());
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // sizes of the problems
+    bool invalid_lda = false;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        hM[b][0] = vbatched_size(m, b);
+        hN[b][0] = vbatched_size(n, b);
+        hLda[b][0] = vbatched_ld(lda, m, hM[b][0]);
+        invalid_lda = invalid_lda || hLda[b][0] < hM[b][0];
+    }
+    CHECK_HIP_ERROR(dM.transfer_from(hM));
+    CHECK_HIP_ERROR(dN.transfer_from(hN));
+    CHECK_HIP_ERROR(dLda.transfer_from(hLda));
+
+    // check invalid sizes of the problems
+    // (they are only checked once they are read from the device)
+    if(invalid_lda)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_getrf_vbatched(handle, dM.data(), dN.data(), dA.data(),
+                                                       dLda.data(), dIpiv.data(), dInfo.data(), m,
+                                                       n, bc),
+                              rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // check quick return
+    if(bc == 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_getrf_vbatched(handle, dM.data(), dN.data(), dA.data(),
+                                                       dLda.data(), dIpiv.data(), dInfo.data(), m,
+                                                       n, bc),
+                              rocblas_status_success);
+        if(argus.timing)
+            rocsolver_bench_inform(inform_quick_return);
+
+        return;
+    }
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        getrf_vbatched_getError<T>(handle, dM, dN, dA, dLda, dIpiv, dInfo, m, n, bc, hM, hN, hLda,
+                                   hA, hARes, hIpiv, hIpivRes, hInfo, hInfoRes, &max_error,
+                                   argus.singular);
+
+    // collect performance data
+    if(argus.timing)
+        getrf_vbatched_getPerfData<T>(handle, dM, dN, dA, dLda, dIpiv, dInfo, m, n, bc, hM, hN,
+                                      hLda, hA, hIpiv, hInfo, &gpu_time_used, &cpu_time_used,
+                                      hot_calls, argus.profile, argus.profile_kernels, argus.perf,
+                                      argus.singular);
+
+    // validate results for rocsolver-test
+    // using min(m,n) * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, min(m, n));
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            rocsolver_bench_output("max_m", "max_n", "lda", "batch_c");
+            rocsolver_bench_output(m, n, lda, bc);
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_GETRF_VBATCHED(...) \
+    extern template void testing_getrf_vbatched<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_GETRF_VBATCHED, FOREACH_SCALAR_TYPE, APPLY_STAMP)
@@ -0,0 +1,389 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+template <typename Th, typename Td, typename Id>
+void getrs_ooc_checkBadArgs(const rocblas_handle handle,
+                            const rocblas_operation trans,
+                            const rocblas_int n,
+                            const rocblas_int nrhs,
+                            Th hA,
+                            const rocblas_int lda,
+                            Id dIpiv,
+                            Td dB,
+                            const rocblas_int ldb)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_ooc(nullptr, trans, n, nrhs, hA, lda, dIpiv, dB, ldb),
+                          rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_getrs_ooc(handle, rocblas_operation(0), n, nrhs, hA, lda, dIpiv, dB, ldb),
+        rocblas_status_invalid_value);
+
+    // sizes (only check batch_count if applicable)
+    // N/A
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_getrs_ooc(handle, trans, n, nrhs, (Th) nullptr, lda, dIpiv, dB, ldb),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_getrs_ooc(handle, trans, n, nrhs, hA, lda, (Id) nullptr, dB, ldb),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_getrs_ooc(handle, trans, n, nrhs, hA, lda, dIpiv, (Td) nullptr, ldb),
+        rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_ooc(handle, trans, 0, nrhs, (Th) nullptr, lda,
+                                              (Id) nullptr, (Td) nullptr, ldb),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_getrs_ooc(handle, trans, n, 0, hA, lda, dIpiv, (Td) nullptr, ldb),
+        rocblas_status_success);
+}
+
+template <typename T>
+void testing_getrs_ooc_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int n = 1;
+    rocblas_int nrhs = 1;
+    rocblas_int lda = 1;
+    rocblas_int ldb = 1;
+    rocblas_operation trans = rocblas_operation_none;
+
+    // memory allocations
+    // (the matrix A is on the host)
+    host_strided_batch_vector<T> hA(1, 1, 1, 1);
+    device_strided_batch_vector<T> dB(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dIpiv(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+
+    // check bad arguments
+    getrs_ooc_checkBadArgs(handle, trans, n, nrhs, hA.data(), lda, dIpiv.data(), dB.data(), ldb);
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Id, typename Th, typename Uh>
+void getrs_ooc_initData(const rocblas_handle handle,
+                        const rocblas_operation trans,
+                        const rocblas_int n,
+                        const rocblas_int nrhs,
+                        const rocblas_int lda,
+                        Id& dIpiv,
+                        Td& dB,
+                        const rocblas_int ldb,
+                        Th& hA,
+                        Uh& hIpiv,
+                        Th& hB)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+        rocblas_init<T>(hB, true);
+
+        // scale A to avoid singularities
+        for(rocblas_int i = 0; i < n; i++)
+        {
+            for(rocblas_int j = 0; j < n; j++)
+            {
+                if(i == j)
+                    hA[0][i + j * lda] += 400;
+                else
+                    hA[0][i + j * lda] -= 4;
+            }
+        }
+
+        // do the LU decomposition of matrix A w/ the reference LAPACK routine
+        // (the factors stay on the host)
+        int info;
+        cpu_getrf(n, n, hA[0], lda, hIpiv[0], &info);
+    }
+
+    if(GPU)
+    {
+        // now copy pivoting indices and right hand sides to the GPU
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+        CHECK_HIP_ERROR(dIpiv.transfer_from(hIpiv));
+    }
+}
+
+template <typename T, typename Td, typename Id, typename Th, typename Uh>
+void getrs_ooc_getError(const rocblas_handle handle,
+                        const rocblas_operation trans,
+                        const rocblas_int n,
+                        const rocblas_int nrhs,
+                        const rocblas_int lda,
+                        Id& dIpiv,
+                        Td& dB,
+                        const rocblas_int ldb,
+                        Th& hA,
+                        Uh& hIpiv,
+                        Th& hB,
+                        Th& hBRes,
+                        double* max_err)
+{
+    // input data initialization
+    getrs_ooc_initData<true, true, T>(handle, trans, n, nrhs, lda, dIpiv, dB, ldb, hA, hIpiv, hB);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_getrs_ooc(handle, trans, n, nrhs, hA.data(), lda, dIpiv.data(),
+                                            dB.data(), ldb));
+    CHECK_HIP_ERROR(hBRes.transfer_from(dB));
+
+    // CPU lapack
+    cpu_getrs(trans, n, nrhs, hA[0], lda, hIpiv[0], hB[0], ldb);
+
+    // error is ||hB - hBRes|| / ||hB||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using vector-induced infinity norm
+    *max_err = norm_error('I', n, nrhs, ldb, hB[0], hBRes[0]);
+}
+
+template <typename T, typename Td, typename Id, typename Th, typename Uh>
+void getrs_ooc_getPerfData(const rocblas_handle handle,
+                           const rocblas_operation trans,
+                           const rocblas_int n,
+                           const rocblas_int nrhs,
+                           const rocblas_int lda,
+                           Id& dIpiv,
+                           Td& dB,
+                           const rocblas_int ldb,
+                           Th& hA,
+                           Uh& hIpiv,
+                           Th& hB,
+                           double* gpu_time_used,
+                           double* cpu_time_used,
+                           const int hot_calls,
+                           const int profile,
+                           const bool profile_kernels,
+                           const bool perf)
+{
+    if(!perf)
+    {
+        getrs_ooc_initData<true, false, T>(handle, trans, n, nrhs, lda, dIpiv, dB, ldb, hA, hIpiv,
+                                           hB);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        cpu_getrs(trans, n, nrhs, hA[0], lda, hIpiv[0], hB[0], ldb);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    getrs_ooc_initData<true, false, T>(handle, trans, n, nrhs, lda, dIpiv, dB, ldb, hA, hIpiv, hB);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        getrs_ooc_initData<false, true, T>(handle, trans, n, nrhs, lda, dIpiv, dB, ldb, hA, hIpiv,
+                                           hB);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_getrs_ooc(handle, trans, n, nrhs, hA.data(), lda,
+                                                dIpiv.data(), dB.data(), ldb));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(int iter = 0; iter < hot_calls; iter++)
+    {
+        getrs_ooc_initData<false, true, T>(handle, trans, n, nrhs, lda, dIpiv, dB, ldb, hA, hIpiv,
+                                           hB);
+
+        start = get_time_us_sync(stream);
+        rocsolver_getrs_ooc(handle, trans, n, nrhs, hA.data(), lda, dIpiv.data(), dB.data(), ldb);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <typename T>
+void testing_getrs_ooc(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    char transC = argus.get<char>("trans");
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int nrhs = argus.get<rocblas_int>("nrhs", n);
+    rocblas_int lda = argus.get<rocblas_int>("lda", n);
+    rocblas_int ldb = argus.get<rocblas_int>("ldb", n);
+
+    rocblas_operation trans = char2rocblas_operation(transC);
+    int hot_calls = argus.iters;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_B = size_t(ldb) * nrhs;
+    size_t size_P = size_t(n);
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_BRes = (argus.unit_check || argus.norm_check) ? size_B : 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || nrhs < 0 || lda < n || ldb < n);
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_getrs_ooc(handle, trans, n, nrhs, (T*)nullptr, lda,
+                                                  (rocblas_int*)nullptr, (T*)nullptr, ldb),
+                              rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        CHECK_ALLOC_QUERY(rocsolver_getrs_ooc(handle, trans, n, nrhs, (T*)nullptr, lda,
+                                              (rocblas_int*)nullptr, (T*)nullptr, ldb));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform_mem_query(handle, size, argus.mem_query > 1);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations
+    // (the matrix A is on the host, and it is pinned so that its transfers are overlapped with
+    // the computations)
+    host_strided_batch_vector<T> hA(size_A, 1, size_A, 1);
+    host_strided_batch_vector<T> hB(size_B, 1, size_B, 1);
+    host_strided_batch_vector<T> hBRes(size_BRes, 1, size_BRes, 1);
+    host_strided_batch_vector<rocblas_int> hIpiv(size_P, 1, size_P, 1);
+    device_strided_batch_vector<T> dB(size_B, 1, size_B, 1);
+    device_strided_batch_vector<rocblas_int> dIpiv(size_P, 1, size_P, 1);
+    rocblas_local_pinned_host pinned(hA.data(), sizeof(T) * size_A);
+    CHECK_HIP_ERROR(pinned.memcheck());
+    if(size_B)
+        CHECK_HIP_ERROR(dB.memcheck());
+    if(size_P)
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+
+    // check quick return
+    if(n == 0 || nrhs == 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_getrs_ooc(handle, trans, n, nrhs, hA.data(), lda,
+                                                  dIpiv.data(), dB.data(), ldb),
+                              rocblas_status_success);
+        if(argus.timing)
+            rocsolver_bench_inform(inform_quick_return);
+
+        return;
+    }
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        getrs_ooc_getError<T>(handle, trans, n, nrhs, lda, dIpiv, dB, ldb, hA, hIpiv, hB, hBRes,
+                              &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        getrs_ooc_getPerfData<T>(handle, trans, n, nrhs, lda, dIpiv, dB, ldb, hA, hIpiv, hB,
+                                 &gpu_time_used, &cpu_time_used, hot_calls, argus.profile,
+                                 argus.profile_kernels, argus.perf);
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            rocsolver_bench_output("trans", "n", "nrhs", "lda", "ldb");
+            rocsolver_bench_output(transC, n, nrhs, lda, ldb);
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_GETRS_OOC(...) \
+    extern template void testing_getrs_ooc<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_GETRS_OOC, FOREACH_SCALAR_TYPE, APPLY_STAMP)
@@ -0,0 +1,540 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "common/lapack/testing_getrf_vbatched.hpp"
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+template <typename Td, typename Ud, typename Id>
+void getrs_vbatched_checkBadArgs(const rocblas_handle handle,
+                                 const rocblas_operation trans,
+                                 const Ud dN,
+                                 const Ud dNrhs,
+                                 Td dA,
+                                 const Ud dLda,
+                                 Id dIpiv,
+                                 Td dB,
+                                 const Ud dLdb,
+                                 const rocblas_int max_n,
+                                 const rocblas_int max_nrhs,
+                                 const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(nullptr, trans, dN, dNrhs, dA, dLda, dIpiv, dB,
+                                                   dLdb, max_n, max_nrhs, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(handle, rocblas_operation(0), dN, dNrhs, dA,
+                                                   dLda, dIpiv, dB, dLdb, max_n, max_nrhs, bc),
+                          rocblas_status_invalid_value);
+
+    // sizes (if applicable)
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(handle, trans, dN, dNrhs, dA, dLda, dIpiv, dB,
+                                                   dLdb, -1, max_nrhs, bc),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(handle, trans, dN, dNrhs, dA, dLda, dIpiv, dB,
+                                                   dLdb, max_n, -1, bc),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(handle, trans, dN, dNrhs, dA, dLda, dIpiv, dB,
+                                                   dLdb, max_n, max_nrhs, -1),
+                          rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(handle, trans, (Ud) nullptr, dNrhs, dA, dLda,
+                                                   dIpiv, dB, dLdb, max_n, max_nrhs, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(handle, trans, dN, (Ud) nullptr, dA, dLda, dIpiv,
+                                                   dB, dLdb, max_n, max_nrhs, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(handle, trans, dN, dNrhs, (Td) nullptr, dLda,
+                                                   dIpiv, dB, dLdb, max_n, max_nrhs, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(handle, trans, dN, dNrhs, dA, (Ud) nullptr,
+                                                   dIpiv, dB, dLdb, max_n, max_nrhs, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(handle, trans, dN, dNrhs, dA, dLda, (Id) nullptr,
+                                                   dB, dLdb, max_n, max_nrhs, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(handle, trans, dN, dNrhs, dA, dLda, dIpiv,
+                                                   (Td) nullptr, dLdb, max_n, max_nrhs, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(handle, trans, dN, dNrhs, dA, dLda, dIpiv, dB,
+                                                   (Ud) nullptr, max_n, max_nrhs, bc),
+                          rocblas_status_invalid_pointer);
+
+    // sizes of the problems (checked once they are read from the device)
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(handle, trans, dN, dNrhs, dA, dLda, dIpiv, dB,
+                                                   dLdb, 0, max_nrhs, bc),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_getrs_vbatched(handle, trans, dN, dNrhs, dA, dLda, dIpiv, dB, dLdb, max_n, 0, bc),
+        rocblas_status_invalid_size);
+
+    // quick return with zero batch_count
+    EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(handle, trans, (Ud) nullptr, (Ud) nullptr,
+                                                   (Td) nullptr, (Ud) nullptr, (Id) nullptr,
+                                                   (Td) nullptr, (Ud) nullptr, max_n, max_nrhs, 0),
+                          rocblas_status_success);
+}
+
+template <typename T>
+void testing_getrs_vbatched_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int max_n = 1;
+    rocblas_int max_nrhs = 1;
+    rocblas_int bc = 1;
+    rocblas_operation trans = rocblas_operation_none;
+
+    // memory allocations
+    host_strided_batch_vector<rocblas_int> hSize(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dN(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dNrhs(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dLda(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dLdb(1, 1, 1, 1);
+    device_batch_vector<T> dA(1, 1, 1);
+    device_batch_vector<T> dB(1, 1, 1);
+    device_batch_vector<rocblas_int> dIpiv(1, 1, 1);
+    CHECK_HIP_ERROR(dN.memcheck());
+    CHECK_HIP_ERROR(dNrhs.memcheck());
+    CHECK_HIP_ERROR(dLda.memcheck());
+    CHECK_HIP_ERROR(dLdb.memcheck());
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+
+    // the single system of the batch has order 1 and one right-hand side
+    hSize[0][0] = 1;
+    CHECK_HIP_ERROR(dN.transfer_from(hSize));
+    CHECK_HIP_ERROR(dNrhs.transfer_from(hSize));
+    CHECK_HIP_ERROR(dLda.transfer_from(hSize));
+    CHECK_HIP_ERROR(dLdb.transfer_from(hSize));
+
+    // check bad arguments
+    getrs_vbatched_checkBadArgs(handle, trans, dN.data(), dNrhs.data(), dA.data(), dLda.data(),
+                                dIpiv.data(), dB.data(), dLdb.data(), max_n, max_nrhs, bc);
+}
+
+template <bool CPU,
+          bool GPU,
+          typename T,
+          typename Td,
+          typename Id,
+          typename Uh,
+          typename Th,
+          typename Ih>
+void getrs_vbatched_initData(const rocblas_handle handle,
+                             Uh& hN,
+                             Uh& hNrhs,
+                             Td& dA,
+                             Uh& hLda,
+                             Id& dIpiv,
+                             Td& dB,
+                             Uh& hLdb,
+                             const rocblas_int bc,
+                             Th& hA,
+                             Ih& hIpiv,
+                             Th& hB)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+        rocblas_init<T>(hB, true);
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            rocblas_int n = hN[b][0];
+            rocblas_int lda = hLda[b][0];
+
+            // scale A to avoid singularities
+            for(rocblas_int i = 0; i < n; i++)
+            {
+                for(rocblas_int j = 0; j < n; j++)
+                {
+                    if(i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+                }
+            }
+
+            // do the LU decomposition of matrix A w/ the reference LAPACK routine
+            rocblas_int info;
+            cpu_getrf(n, n, hA[b], lda, hIpiv[b], &info);
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy pivoting indices and matrices to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+        CHECK_HIP_ERROR(dIpiv.transfer_from(hIpiv));
+    }
+}
+
+template <typename T, typename Td, typename Id, typename Ud, typename Th, typename Ih, typename Uh>
+void getrs_vbatched_getError(const rocblas_handle handle,
+                             const rocblas_operation trans,
+                             Ud& dN,
+                             Ud& dNrhs,
+                             Td& dA,
+                             Ud& dLda,
+                             Id& dIpiv,
+                             Td& dB,
+                             Ud& dLdb,
+                             const rocblas_int max_n,
+                             const rocblas_int max_nrhs,
+                             const rocblas_int bc,
+                             Uh& hN,
+                             Uh& hNrhs,
+                             Uh& hLda,
+                             Uh& hLdb,
+                             Th& hA,
+                             Ih& hIpiv,
+                             Th& hB,
+                             Th& hBRes,
+                             double* max_err)
+{
+    // input data initialization
+    getrs_vbatched_initData<true, true, T>(handle, hN, hNrhs, dA, hLda, dIpiv, dB, hLdb, bc, hA,
+                                           hIpiv, hB);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_getrs_vbatched(handle, trans, dN.data(), dNrhs.data(), dA.data(),
+                                                 dLda.data(), dIpiv.data(), dB.data(), dLdb.data(),
+                                                 max_n, max_nrhs, bc));
+    CHECK_HIP_ERROR(hBRes.transfer_from(dB));
+
+    // CPU lapack
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        cpu_getrs(trans, hN[b][0], hNrhs[b][0], hA[b], hLda[b][0], hIpiv[b], hB[b], hLdb[b][0]);
+    }
+
+    // error is ||hB - hBRes|| / ||hB||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using vector-induced infinity norm
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        // (empty problems are left untouched)
+        if(hN[b][0] == 0 || hNrhs[b][0] == 0)
+            continue;
+
+        err = norm_error('I', hN[b][0], hNrhs[b][0], hLdb[b][0], hB[b], hBRes[b]);
+        *max_err = err > *max_err ? err : *max_err;
+    }
+}
+
+template <typename T, typename Td, typename Id, typename Ud, typename Th, typename Ih, typename Uh>
+void getrs_vbatched_getPerfData(const rocblas_handle handle,
+                                const rocblas_operation trans,
+                                Ud& dN,
+                                Ud& dNrhs,
+                                Td& dA,
+                                Ud& dLda,
+                                Id& dIpiv,
+                                Td& dB,
+                                Ud& dLdb,
+                                const rocblas_int max_n,
+                                const rocblas_int max_nrhs,
+                                const rocblas_int bc,
+                                Uh& hN,
+                                Uh& hNrhs,
+                                Uh& hLda,
+                                Uh& hLdb,
+                                Th& hA,
+                                Ih& hIpiv,
+                                Th& hB,
+                                double* gpu_time_used,
+                                double* cpu_time_used,
+                                const rocblas_int hot_calls,
+                                const int profile,
+                                const bool profile_kernels,
+                                const bool perf)
+{
+    if(!perf)
+    {
+        getrs_vbatched_initData<true, false, T>(handle, hN, hNrhs, dA, hLda, dIpiv, dB, hLdb, bc,
+                                                hA, hIpiv, hB);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            cpu_getrs(trans, hN[b][0], hNrhs[b][0], hA[b], hLda[b][0], hIpiv[b], hB[b], hLdb[b][0]);
+        }
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    getrs_vbatched_initData<true, false, T>(handle, hN, hNrhs, dA, hLda, dIpiv, dB, hLdb, bc, hA,
+                                            hIpiv, hB);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        getrs_vbatched_initData<false, true, T>(handle, hN, hNrhs, dA, hLda, dIpiv, dB, hLdb, bc,
+                                                hA, hIpiv, hB);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_getrs_vbatched(handle, trans, dN.data(), dNrhs.data(),
+                                                     dA.data(), dLda.data(), dIpiv.data(),
+                                                     dB.data(), dLdb.data(), max_n, max_nrhs, bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        getrs_vbatched_initData<false, true, T>(handle, hN, hNrhs, dA, hLda, dIpiv, dB, hLdb, bc,
+                                                hA, hIpiv, hB);
+
+        start = get_time_us_sync(stream);
+        rocsolver_getrs_vbatched(handle, trans, dN.data(), dNrhs.data(), dA.data(), dLda.data(),
+                                 dIpiv.data(), dB.data(), dLdb.data(), max_n, max_nrhs, bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <typename T>
+void testing_getrs_vbatched(Arguments& argus)
+{
+    // get arguments
+    // (n, nrhs, lda and ldb are the sizes and the leading dimensions of the largest systems;
+    // system b has order vbatched_size(n, b) and vbatched_size(nrhs, b) right-hand sides, see
+    // testing_getrf_vbatched)
+    rocblas_local_handle handle;
+    char transC = argus.get<char>("trans");
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int nrhs = argus.get<rocblas_int>("nrhs", n);
+    rocblas_int lda = argus.get<rocblas_int>("lda", n);
+    rocblas_int ldb = argus.get<rocblas_int>("ldb", n);
+
+    rocblas_operation trans = char2rocblas_operation(transC);
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    // check non-supported values
+    // N/A
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || nrhs < 0 || bc < 0);
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(handle, trans, (rocblas_int*)nullptr,
+                                                       (rocblas_int*)nullptr, (T* const*)nullptr,
+                                                       (rocblas_int*)nullptr,
+                                                       (rocblas_int* const*)nullptr,
+                                                       (T* const*)nullptr, (rocblas_int*)nullptr, n,
+                                                       nrhs, bc),
+                              rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // determine sizes
+    // (every problem fits in the space of the largest one, which is allocated even if it is
+    // empty, as the arrays of pointers cannot be null)
+    size_t size_A = size_t(std::max(lda, 1)) * std::max(n, 1);
+    size_t size_B = size_t(std::max(ldb, 1)) * std::max(nrhs, 1);
+    size_t size_P = size_t(std::max(n, 1));
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_BRes = (argus.unit_check || argus.norm_check) ? size_B : 0;
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        CHECK_ALLOC_QUERY(rocsolver_getrs_vbatched(handle, trans, (rocblas_int*)nullptr,
+                                                   (rocblas_int*)nullptr, (T* const*)nullptr,
+                                                   (rocblas_int*)nullptr,
+                                                   (rocblas_int* const*)nullptr, (T* const*)nullptr,
+                                                   (rocblas_int*)nullptr, n, nrhs, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform_mem_query(handle, size, argus.mem_query > 1);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations
+    host_strided_batch_vector<rocblas_int> hN(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hNrhs(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hLda(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hLdb(1, 1, 1, bc);
+    host_batch_vector<T> hA(size_A, 1, bc);
+    host_batch_vector<T> hB(size_B, 1, bc);
+    host_batch_vector<T> hBRes(size_BRes, 1, bc);
+    host_batch_vector<rocblas_int> hIpiv(size_P, 1, bc);
+    device_strided_batch_vector<rocblas_int> dN(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dNrhs(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dLda(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dLdb(1, 1, 1, bc);
+    device_batch_vector<T> dA(size_A, 1, bc);
+    device_batch_vector<T> dB(size_B, 1, bc);
+    device_batch_vector<rocblas_int> dIpiv(size_P, 1, bc);
+    CHECK_HIP_ERROR(dN.memcheck());
+    CHECK_HIP_ERROR(dNrhs.memcheck());
+    CHECK_HIP_ERROR(dLda.memcheck());
+    CHECK_HIP_ERROR(dLdb.memcheck());
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+
+    // sizes of the problems
+    bool invalid_ld = false;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        hN[b][0] = vbatched_size(n, b);
+        hNrhs[b][0] = vbatched_size(nrhs, b);
+        hLda[b][0] = vbatched_ld(lda, n, hN[b][0]);
+        hLdb[b][0] = vbatched_ld(ldb, n, hN[b][0]);
+        invalid_ld = invalid_ld || hLda[b][0] < hN[b][0] || hLdb[b][0] < hN[b][0];
+    }
+    CHECK_HIP_ERROR(dN.transfer_from(hN));
+    CHECK_HIP_ERROR(dNrhs.transfer_from(hNrhs));
+    CHECK_HIP_ERROR(dLda.transfer_from(hLda));
+    CHECK_HIP_ERROR(dLdb.transfer_from(hLdb));
+
+    // check invalid sizes of the problems
+    // (they are only checked once they are read from the device)
+    if(invalid_ld)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(handle, trans, dN.data(), dNrhs.data(),
+                                                       dA.data(), dLda.data(), dIpiv.data(),
+                                                       dB.data(), dLdb.data(), n, nrhs, bc),
+                              rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // check quick return
+    if(bc == 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_getrs_vbatched(handle, trans, dN.data(), dNrhs.data(),
+                                                       dA.data(), dLda.data(), dIpiv.data(),
+                                                       dB.data(), dLdb.data(), n, nrhs, bc),
+                              rocblas_status_success);
+        if(argus.timing)
+            rocsolver_bench_inform(inform_quick_return);
+
+        return;
+    }
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        getrs_vbatched_getError<T>(handle, trans, dN, dNrhs, dA, dLda, dIpiv, dB, dLdb, n, nrhs,
+                                   bc, hN, hNrhs, hLda, hLdb, hA, hIpiv, hB, hBRes, &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        getrs_vbatched_getPerfData<T>(handle, trans, dN, dNrhs, dA, dLda, dIpiv, dB, dLdb, n, nrhs,
+                                      bc, hN, hNrhs, hLda, hLdb, hA, hIpiv, hB, &gpu_time_used,
+                                      &cpu_time_used, hot_calls, argus.profile,
+                                      argus.profile_kernels, argus.perf);
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            rocsolver_bench_output("trans", "max_n", "max_nrhs", "lda", "ldb", "batch_c");
+            rocsolver_bench_output(transC, n, nrhs, lda, ldb, bc);
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_GETRS_VBATCHED(...) \
+    extern template void testing_getrs_vbatched<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_GETRS_VBATCHED, FOREACH_SCALAR_TYPE, APPLY_STAMP)
@@ -0,0 +1,562 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+template <bool INTERLEAVED, typename T, typename U>
+void gtsv_nopivot_checkBadArgs(const rocblas_handle handle,
+                               const rocblas_int n,
+                               const rocblas_int nrhs,
+                               T dDL,
+                               const rocblas_int incdl,
+                               const rocblas_stride stDL,
+                               T dD,
+                               const rocblas_int incd,
+                               const rocblas_stride stD,
+                               T dDU,
+                               const rocblas_int incdu,
+                               const rocblas_stride stDU,
+                               T dB,
+                               const rocblas_int incb,
+                               const rocblas_int ldb,
+                               const rocblas_stride stB,
+                               U dInfo,
+                               const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_gtsv_nopivot(INTERLEAVED, nullptr, n, nrhs, dDL, incdl, stDL,
+                                                 dD, incd, stD, dDU, incdu, stDU, dB, incb, ldb,
+                                                 stB, dInfo, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes
+    EXPECT_ROCBLAS_STATUS(rocsolver_gtsv_nopivot(INTERLEAVED, handle, n, nrhs, dDL, incdl, stDL, dD,
+                                                 incd, stD, dDU, incdu, stDU, dB, incb, ldb, stB,
+                                                 dInfo, -1),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gtsv_nopivot(INTERLEAVED, handle, n, nrhs, dDL, incdl, stDL, dD,
+                                                 incd, stD, dDU, incdu, stDU, dB, incb, n - 1, stB,
+                                                 dInfo, bc),
+                          rocblas_status_invalid_size);
+    if(INTERLEAVED)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_gtsv_nopivot(INTERLEAVED, handle, n, nrhs, dDL, 0, stDL, dD,
+                                                     incd, stD, dDU, incdu, stDU, dB, incb, ldb,
+                                                     stB, dInfo, bc),
+                              rocblas_status_invalid_size);
+        EXPECT_ROCBLAS_STATUS(rocsolver_gtsv_nopivot(INTERLEAVED, handle, n, nrhs, dDL, incdl, stDL,
+                                                     dD, 0, stD, dDU, incdu, stDU, dB, incb, ldb,
+                                                     stB, dInfo, bc),
+                              rocblas_status_invalid_size);
+        EXPECT_ROCBLAS_STATUS(rocsolver_gtsv_nopivot(INTERLEAVED, handle, n, nrhs, dDL, incdl, stDL,
+                                                     dD, incd, stD, dDU, 0, stDU, dB, incb, ldb,
+                                                     stB, dInfo, bc),
+                              rocblas_status_invalid_size);
+        EXPECT_ROCBLAS_STATUS(rocsolver_gtsv_nopivot(INTERLEAVED, handle, n, nrhs, dDL, incdl, stDL,
+                                                     dD, incd, stD, dDU, incdu, stDU, dB, 0, ldb,
+                                                     stB, dInfo, bc),
+                              rocblas_status_invalid_size);
+    }
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_gtsv_nopivot(INTERLEAVED, handle, n, nrhs, (T) nullptr, incdl,
+                                                 stDL, dD, incd, stD, dDU, incdu, stDU, dB, incb,
+                                                 ldb, stB, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gtsv_nopivot(INTERLEAVED, handle, n, nrhs, dDL, incdl, stDL,
+                                                 (T) nullptr, incd, stD, dDU, incdu, stDU, dB, incb,
+                                                 ldb, stB, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gtsv_nopivot(INTERLEAVED, handle, n, nrhs, dDL, incdl, stDL, dD,
+                                                 incd, stD, (T) nullptr, incdu, stDU, dB, incb, ldb,
+                                                 stB, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gtsv_nopivot(INTERLEAVED, handle, n, nrhs, dDL, incdl, stDL, dD,
+                                                 incd, stD, dDU, incdu, stDU, (T) nullptr, incb,
+                                                 ldb, stB, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_gtsv_nopivot(INTERLEAVED, handle, n, nrhs, dDL, incdl, stDL, dD,
+                                                 incd, stD, dDU, incdu, stDU, dB, incb, ldb, stB,
+                                                 (U) nullptr, bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_gtsv_nopivot(INTERLEAVED, handle, 0, nrhs, (T) nullptr, incdl,
+                                                 stDL, (T) nullptr, incd, stD, (T) nullptr, incdu,
+                                                 stDU, (T) nullptr, incb, 1, stB, dInfo, bc),
+                          rocblas_status_success);
+
+    // with a single equation there are no off-diagonal elements
+    EXPECT_ROCBLAS_STATUS(rocsolver_gtsv_nopivot(INTERLEAVED, handle, 1, nrhs, (T) nullptr, incdl,
+                                                 stDL, dD, incd, stD, (T) nullptr, incdu, stDU, dB,
+                                                 incb, 1, stB, dInfo, bc),
+                          rocblas_status_success);
+
+    // quick return with zero batch_count
+    EXPECT_ROCBLAS_STATUS(rocsolver_gtsv_nopivot(INTERLEAVED, handle, n, nrhs, dDL, incdl, stDL, dD,
+                                                 incd, stD, dDU, incdu, stDU, dB, incb, ldb, stB,
+                                                 (U) nullptr, 0),
+                          rocblas_status_success);
+}
+
+template <bool INTERLEAVED, typename T>
+void testing_gtsv_nopivot_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int n = 2;
+    rocblas_int nrhs = 1;
+    rocblas_int incd = 1;
+    rocblas_int incb = 1;
+    rocblas_int ldb = 2;
+    rocblas_stride stD = 2;
+    rocblas_stride stB = 2;
+    rocblas_int bc = 1;
+
+    // memory allocations
+    device_strided_batch_vector<T> dDL(1, 1, 1, 1);
+    device_strided_batch_vector<T> dD(1, 1, 1, 1);
+    device_strided_batch_vector<T> dDU(1, 1, 1, 1);
+    device_strided_batch_vector<T> dB(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dDL.memcheck());
+    CHECK_HIP_ERROR(dD.memcheck());
+    CHECK_HIP_ERROR(dDU.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // check bad arguments
+    gtsv_nopivot_checkBadArgs<INTERLEAVED>(handle, n, nrhs, dDL.data(), incd, stD, dD.data(), incd,
+                                           stD, dDU.data(), incd, stD, dB.data(), incb, ldb, stB,
+                                           dInfo.data(), bc);
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void gtsv_nopivot_initData(const rocblas_handle handle,
+                           const rocblas_int n,
+                           const rocblas_int nrhs,
+                           Td& dDL,
+                           Td& dD,
+                           Td& dDU,
+                           const rocblas_int incd,
+                           const rocblas_stride stD,
+                           Td& dB,
+                           const rocblas_int incb,
+                           const rocblas_int ldb,
+                           const rocblas_stride stB,
+                           const rocblas_int bc,
+                           Th& hDL,
+                           Th& hD,
+                           Th& hDU,
+                           Th& hB)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hDL, true);
+        rocblas_init<T>(hD, false);
+        rocblas_init<T>(hDU, false);
+        rocblas_init<T>(hB, false);
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            T* DL = hDL[0] + b * stD;
+            T* D = hD[0] + b * stD;
+            T* DU = hDU[0] + b * stD;
+
+            // scale to avoid singularities
+            // leaving the matrices diagonally dominant so that pivoting is not required
+            for(rocblas_int i = 0; i < n; i++)
+                D[i * incd] += 400;
+        }
+    }
+
+    // now copy data to the GPU
+    if(GPU)
+    {
+        CHECK_HIP_ERROR(dDL.transfer_from(hDL));
+        CHECK_HIP_ERROR(dD.transfer_from(hD));
+        CHECK_HIP_ERROR(dDU.transfer_from(hDU));
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+    }
+}
+
+template <bool INTERLEAVED, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void gtsv_nopivot_getError(const rocblas_handle handle,
+                           const rocblas_int n,
+                           const rocblas_int nrhs,
+                           Td& dDL,
+                           Td& dD,
+                           Td& dDU,
+                           const rocblas_int incd,
+                           const rocblas_stride stD,
+                           Td& dB,
+                           const rocblas_int incb,
+                           const rocblas_int ldb,
+                           const rocblas_stride stB,
+                           Ud& dInfo,
+                           const rocblas_int bc,
+                           Th& hDL,
+                           Th& hD,
+                           Th& hDU,
+                           Th& hB,
+                           Th& hBRes,
+                           Uh& hInfo,
+                           Uh& hInfoRes,
+                           double* max_err)
+{
+    std::vector<T> DL(n), D(n), DU(n), B(size_t(n) * nrhs), BRes(size_t(n) * nrhs);
+
+    // input data initialization
+    gtsv_nopivot_initData<true, true, T>(handle, n, nrhs, dDL, dD, dDU, incd, stD, dB, incb, ldb,
+                                         stB, bc, hDL, hD, hDU, hB);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_gtsv_nopivot(INTERLEAVED, handle, n, nrhs, dDL.data(), incd, stD,
+                                               dD.data(), incd, stD, dDU.data(), incd, stD,
+                                               dB.data(), incb, ldb, stB, dInfo.data(), bc));
+    CHECK_HIP_ERROR(hBRes.transfer_from(dB));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // CPU lapack
+    // (as the matrices are diagonally dominant, gtsv does not interchange rows)
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        // gather the diagonals and right-hand sides of the b-th system
+        for(rocblas_int i = 0; i < n; i++)
+        {
+            DL[i] = hDL[0][i * incd + b * stD];
+            D[i] = hD[0][i * incd + b * stD];
+            DU[i] = hDU[0][i * incd + b * stD];
+            for(rocblas_int j = 0; j < nrhs; j++)
+            {
+                B[i + j * n] = hB[0][i * incb + j * ldb + b * stB];
+                BRes[i + j * n] = hBRes[0][i * incb + j * ldb + b * stB];
+            }
+        }
+
+        cpu_gtsv(n, nrhs, DL.data(), D.data(), DU.data(), B.data(), n, hInfo[b]);
+
+        // error is ||B - BRes|| / ||B||
+        // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+        // IT MIGHT BE REVISITED IN THE FUTURE)
+        // using vector-induced infinity norm
+        err = norm_error('I', n, nrhs, n, B.data(), BRes.data());
+        *max_err = err > *max_err ? err : *max_err;
+    }
+
+    // also check info
+    err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        EXPECT_EQ(hInfoRes[b][0], 0) << "where b = " << b;
+        if(hInfoRes[b][0] != 0)
+            err++;
+    }
+    *max_err += err;
+}
+
+template <bool INTERLEAVED, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void gtsv_nopivot_getPerfData(const rocblas_handle handle,
+                              const rocblas_int n,
+                              const rocblas_int nrhs,
+                              Td& dDL,
+                              Td& dD,
+                              Td& dDU,
+                              const rocblas_int incd,
+                              const rocblas_stride stD,
+                              Td& dB,
+                              const rocblas_int incb,
+                              const rocblas_int ldb,
+                              const rocblas_stride stB,
+                              Ud& dInfo,
+                              const rocblas_int bc,
+                              Th& hDL,
+                              Th& hD,
+                              Th& hDU,
+                              Th& hB,
+                              Uh& hInfo,
+                              double* gpu_time_used,
+                              double* cpu_time_used,
+                              const rocblas_int hot_calls,
+                              const int profile,
+                              const bool profile_kernels,
+                              const bool perf)
+{
+    if(!perf)
+    {
+        std::vector<T> DL(n), D(n), DU(n), B(size_t(n) * nrhs);
+
+        gtsv_nopivot_initData<true, false, T>(handle, n, nrhs, dDL, dD, dDU, incd, stD, dB, incb,
+                                              ldb, stB, bc, hDL, hD, hDU, hB);
+
+        // cpu-lapack performance (only if not in perf mode)
+        // (the systems are gathered out of the timed region)
+        *cpu_time_used = 0;
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            for(rocblas_int i = 0; i < n; i++)
+            {
+                DL[i] = hDL[0][i * incd + b * stD];
+                D[i] = hD[0][i * incd + b * stD];
+                DU[i] = hDU[0][i * incd + b * stD];
+                for(rocblas_int j = 0; j < nrhs; j++)
+                    B[i + j * n] = hB[0][i * incb + j * ldb + b * stB];
+            }
+
+            double start = get_time_us_no_sync();
+            cpu_gtsv(n, nrhs, DL.data(), D.data(), DU.data(), B.data(), n, hInfo[b]);
+            *cpu_time_used += get_time_us_no_sync() - start;
+        }
+    }
+
+    gtsv_nopivot_initData<true, false, T>(handle, n, nrhs, dDL, dD, dDU, incd, stD, dB, incb, ldb,
+                                          stB, bc, hDL, hD, hDU, hB);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        gtsv_nopivot_initData<false, true, T>(handle, n, nrhs, dDL, dD, dDU, incd, stD, dB, incb,
+                                              ldb, stB, bc, hDL, hD, hDU, hB);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_gtsv_nopivot(INTERLEAVED, handle, n, nrhs, dDL.data(), incd,
+                                                   stD, dD.data(), incd, stD, dDU.data(), incd, stD,
+                                                   dB.data(), incb, ldb, stB, dInfo.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        gtsv_nopivot_initData<false, true, T>(handle, n, nrhs, dDL, dD, dDU, incd, stD, dB, incb,
+                                              ldb, stB, bc, hDL, hD, hDU, hB);
+
+        start = get_time_us_sync(stream);
+        rocsolver_gtsv_nopivot(INTERLEAVED, handle, n, nrhs, dDL.data(), incd, stD, dD.data(), incd,
+                               stD, dDU.data(), incd, stD, dB.data(), incb, ldb, stB, dInfo.data(),
+                               bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool INTERLEAVED, typename T>
+void testing_gtsv_nopivot(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int nrhs = argus.get<rocblas_int>("nrhs", n);
+    rocblas_int bc = argus.batch_count;
+    rocblas_int incd = INTERLEAVED ? argus.get<rocblas_int>("incd", bc) : 1;
+    rocblas_int incb = INTERLEAVED ? argus.get<rocblas_int>("incb", bc) : 1;
+    rocblas_int ldb = argus.get<rocblas_int>("ldb", incb * n);
+    rocblas_stride stD = argus.get<rocblas_stride>("strideD", INTERLEAVED ? 1 : n);
+    rocblas_stride stB = argus.get<rocblas_stride>("strideB", INTERLEAVED ? 1 : ldb * nrhs);
+
+    rocblas_int hot_calls = argus.iters;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    // (all the diagonals are stored with the same increment and stride)
+    size_t size_D = (n > 0 && bc > 0) ? size_t(incd) * (n - 1) + stD * (bc - 1) + 1 : 0;
+    size_t size_B = (n > 0 && nrhs > 0 && bc > 0)
+        ? size_t(incb) * (n - 1) + size_t(ldb) * (nrhs - 1) + stB * (bc - 1) + 1
+        : 0;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_BRes = (argus.unit_check || argus.norm_check) ? size_B : 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || nrhs < 0 || bc < 0 || incd < 1 || incb < 1 || ldb < incb * n);
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_gtsv_nopivot(INTERLEAVED, handle, n, nrhs, (T*)nullptr,
+                                                     incd, stD, (T*)nullptr, incd, stD, (T*)nullptr,
+                                                     incd, stD, (T*)nullptr, incb, ldb, stB,
+                                                     (rocblas_int*)nullptr, bc),
+                              rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        CHECK_ALLOC_QUERY(rocsolver_gtsv_nopivot(INTERLEAVED, handle, n, nrhs, (T*)nullptr, incd,
+                                                 stD, (T*)nullptr, incd, stD, (T*)nullptr, incd,
+                                                 stD, (T*)nullptr, incb, ldb, stB,
+                                                 (rocblas_int*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform_mem_query(handle, size, argus.mem_query > 1);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T> hDL(size_D, 1, size_D, 1);
+    host_strided_batch_vector<T> hD(size_D, 1, size_D, 1);
+    host_strided_batch_vector<T> hDU(size_D, 1, size_D, 1);
+    host_strided_batch_vector<T> hB(size_B, 1, size_B, 1);
+    host_strided_batch_vector<T> hBRes(size_BRes, 1, size_BRes, 1);
+    host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, bc);
+    device_strided_batch_vector<T> dDL(size_D, 1, size_D, 1);
+    device_strided_batch_vector<T> dD(size_D, 1, size_D, 1);
+    device_strided_batch_vector<T> dDU(size_D, 1, size_D, 1);
+    device_strided_batch_vector<T> dB(size_B, 1, size_B, 1);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+    if(size_D)
+    {
+        CHECK_HIP_ERROR(dDL.memcheck());
+        CHECK_HIP_ERROR(dD.memcheck());
+        CHECK_HIP_ERROR(dDU.memcheck());
+    }
+    if(size_B)
+        CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // check quick return
+    if(n == 0 || nrhs == 0 || bc == 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_gtsv_nopivot(INTERLEAVED, handle, n, nrhs, dDL.data(), incd,
+                                                     stD, dD.data(), incd, stD, dDU.data(), incd,
+                                                     stD, dB.data(), incb, ldb, stB, dInfo.data(),
+                                                     bc),
+                              rocblas_status_success);
+        if(argus.timing)
+            rocsolver_bench_inform(inform_quick_return);
+
+        return;
+    }
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        gtsv_nopivot_getError<INTERLEAVED, T>(handle, n, nrhs, dDL, dD, dDU, incd, stD, dB, incb,
+                                              ldb, stB, dInfo, bc, hDL, hD, hDU, hB, hBRes, hInfo,
+                                              hInfoRes, &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        gtsv_nopivot_getPerfData<INTERLEAVED, T>(handle, n, nrhs, dDL, dD, dDU, incd, stD, dB, incb,
+                                                 ldb, stB, dInfo, bc, hDL, hD, hDU, hB, hInfo,
+                                                 &gpu_time_used, &cpu_time_used, hot_calls,
+                                                 argus.profile, argus.profile_kernels, argus.perf);
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            if(INTERLEAVED)
+            {
+                rocsolver_bench_output("n", "nrhs", "incd", "strideD", "incb", "ldb", "strideB",
+                                       "batch_c");
+                rocsolver_bench_output(n, nrhs, incd, stD, incb, ldb, stB, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("n", "nrhs", "strideD", "ldb", "strideB", "batch_c");
+                rocsolver_bench_output(n, nrhs, stD, ldb, stB, bc);
+            }
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_GTSV_NOPIVOT(...) \
+    extern template void testing_gtsv_nopivot<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_GTSV_NOPIVOT,
+            FOREACH_INTERLEAVED_DATA_LAYOUT,
+            FOREACH_SCALAR_TYPE,
+            APPLY_STAMP)
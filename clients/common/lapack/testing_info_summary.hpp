@@ -0,0 +1,293 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+inline void testing_info_summary_bad_arg()
+{
+    rocblas_local_handle handle;
+    device_strided_batch_vector<rocblas_int> dSummary(2, 1, 2, 1);
+    CHECK_HIP_ERROR(dSummary.memcheck());
+    rocblas_int* summary = dSummary.data();
+    bool enable = true;
+
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_set_info_summary(nullptr, dSummary.data()),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocsolver_get_info_summary(nullptr, &summary),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocsolver_set_early_abort(nullptr, true), rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocsolver_get_early_abort(nullptr, &enable),
+                          rocblas_status_invalid_handle);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_get_info_summary(handle, nullptr),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_get_early_abort(handle, nullptr),
+                          rocblas_status_invalid_pointer);
+    // (the summary must be a device array)
+    rocblas_int hSummary[2];
+    EXPECT_ROCBLAS_STATUS(rocsolver_set_info_summary(handle, hSummary),
+                          rocblas_status_invalid_pointer);
+
+    // disabled by default
+    CHECK_ROCBLAS_ERROR(rocsolver_get_info_summary(handle, &summary));
+    EXPECT_EQ(summary, nullptr);
+    CHECK_ROCBLAS_ERROR(rocsolver_get_early_abort(handle, &enable));
+    EXPECT_FALSE(enable);
+
+    CHECK_ROCBLAS_ERROR(rocsolver_set_info_summary(handle, dSummary.data()));
+    CHECK_ROCBLAS_ERROR(rocsolver_get_info_summary(handle, &summary));
+    EXPECT_EQ(summary, dSummary.data());
+    CHECK_ROCBLAS_ERROR(rocsolver_set_early_abort(handle, true));
+    CHECK_ROCBLAS_ERROR(rocsolver_get_early_abort(handle, &enable));
+    EXPECT_TRUE(enable);
+
+    // releasing the resources restores the defaults
+    CHECK_ROCBLAS_ERROR(rocsolver_release_handle_resources(handle));
+    CHECK_ROCBLAS_ERROR(rocsolver_get_info_summary(handle, &summary));
+    EXPECT_EQ(summary, nullptr);
+    CHECK_ROCBLAS_ERROR(rocsolver_get_early_abort(handle, &enable));
+    EXPECT_FALSE(enable);
+}
+
+/** The lower triangular parts of the matrices define positive definite matrices, except for
+    the problems in failed: for POTRF they get a zero diagonal element, and for GETRF a zero
+    first column. **/
+template <typename T, typename Th>
+void info_summary_initData(Th& hA,
+                           const std::string function,
+                           const rocblas_int n,
+                           const rocblas_int lda,
+                           const std::vector<rocblas_int>& failed)
+{
+    rocblas_init<T>(hA, true);
+
+    for(rocblas_int b = 0; b < hA.batch_count(); ++b)
+    {
+        // scale to ensure positive definiteness
+        for(rocblas_int i = 0; i < n; i++)
+            hA[b][i + i * lda] = hA[b][i + i * lda] * sconj(hA[b][i + i * lda]) * 400;
+    }
+
+    for(rocblas_int k = 0; k < rocblas_int(failed.size()); ++k)
+    {
+        rocblas_int b = failed[k];
+        if(function == "getrf")
+        {
+            for(rocblas_int i = 0; i < n; i++)
+                hA[b][i] = 0;
+        }
+        else
+        {
+            rocblas_int i = (n / 4) * (k + 1) % n;
+            hA[b][i + i * lda] = 0;
+        }
+    }
+}
+
+template <bool STRIDED, typename T, typename Td, typename Th>
+void info_summary_getError(const rocblas_handle handle,
+                           const std::string function,
+                           const rocblas_int n,
+                           Td& dA,
+                           const rocblas_int lda,
+                           const rocblas_stride stA,
+                           const rocblas_int bc,
+                           const std::vector<rocblas_int>& failed,
+                           Th& hA,
+                           Th& hR,
+                           Th& hRea,
+                           double* max_err)
+{
+    rocblas_stride stP = n;
+
+    // memory allocations
+    host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hInfoea(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hSummary(2, 1, 2, 1);
+    device_strided_batch_vector<rocblas_int> dIpiv(stP, 1, stP, bc);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dSummary(2, 1, 2, 1);
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+    CHECK_HIP_ERROR(dSummary.memcheck());
+
+    auto run = [&](const rocblas_int nn) {
+        if(function == "getrf")
+            return rocsolver_getf2_getrf(STRIDED, true, handle, nn, nn, dA.data(), lda, stA,
+                                         dIpiv.data(), stP, dInfo.data(), bc);
+        else
+            return rocsolver_potf2_potrf(STRIDED, true, handle, rocblas_fill_lower, nn,
+                                         dA.data(), lda, stA, dInfo.data(), bc);
+    };
+
+    auto execute = [&](Th& hRes, host_strided_batch_vector<rocblas_int>& hInfoRes) {
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(hipMemset(dSummary.data(), -1, sizeof(rocblas_int) * 2));
+        CHECK_ROCBLAS_ERROR(run(n));
+        CHECK_HIP_ERROR(hRes.transfer_from(dA));
+        CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+        CHECK_HIP_ERROR(hSummary.transfer_from(dSummary));
+    };
+
+    CHECK_ROCBLAS_ERROR(rocsolver_set_info_summary(handle, dSummary.data()));
+    execute(hR, hInfo);
+
+    // the summary holds the number of failed problems and the index of the first one
+    rocblas_int count = 0, first = bc;
+    for(rocblas_int b = bc - 1; b >= 0; --b)
+    {
+        if(hInfo[b][0] != 0)
+        {
+            count++;
+            first = b;
+        }
+    }
+    EXPECT_EQ(count, rocblas_int(failed.size()));
+    EXPECT_EQ(hSummary[0][0], count);
+    EXPECT_EQ(hSummary[0][1], first);
+
+    // with early abort, the info values and the factors of the problems that succeed do not
+    // change
+    *max_err = 0;
+    if(function == "potrf_early_abort")
+    {
+        CHECK_ROCBLAS_ERROR(rocsolver_set_early_abort(handle, true));
+        execute(hRea, hInfoea);
+        EXPECT_EQ(hSummary[0][0], count);
+        EXPECT_EQ(hSummary[0][1], first);
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            EXPECT_EQ(hInfoea[b][0], hInfo[b][0]) << "where b = " << b;
+            if(hInfo[b][0] == 0)
+                *max_err
+                    = std::max(*max_err, norm_error_lowerTr('F', n, n, lda, hR[b], hRea[b]));
+        }
+        CHECK_ROCBLAS_ERROR(rocsolver_set_early_abort(handle, false));
+    }
+
+    // all the problems succeed
+    CHECK_ROCBLAS_ERROR(run(0));
+    CHECK_HIP_ERROR(hSummary.transfer_from(dSummary));
+    EXPECT_EQ(hSummary[0][0], 0);
+    EXPECT_EQ(hSummary[0][1], bc);
+
+    // a stale array is not written
+    {
+        device_strided_batch_vector<rocblas_int> dTemp(2, 1, 2, 1);
+        CHECK_HIP_ERROR(dTemp.memcheck());
+        CHECK_ROCBLAS_ERROR(rocsolver_set_info_summary(handle, dTemp.data()));
+    }
+    EXPECT_ROCBLAS_STATUS(run(n), rocblas_status_invalid_pointer);
+    CHECK_ROCBLAS_ERROR(rocsolver_set_info_summary(handle, nullptr));
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_info_summary(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    std::string function = argus.get<std::string>("function");
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int lda = n;
+    rocblas_stride stA = lda * n;
+    rocblas_int bc = argus.batch_count;
+    double max_error = 0;
+
+    if(function != "getrf" && function != "potrf" && function != "potrf_early_abort")
+        FAIL() << "unknown function " << function;
+    const std::vector<rocblas_int> failed
+        = (function == "getrf") ? std::vector<rocblas_int>{3, 11}
+                                : std::vector<rocblas_int>{5, 6, 17};
+
+    // the summary cannot aggregate more than INT32_MAX problems
+    if(STRIDED)
+    {
+        device_strided_batch_vector<rocblas_int> dSummary(2, 1, 2, 1);
+        CHECK_HIP_ERROR(dSummary.memcheck());
+        CHECK_ROCBLAS_ERROR(rocsolver_set_info_summary(handle, dSummary.data()));
+        const int64_t bc64 = int64_t(INT32_MAX) + 1;
+        if(function == "getrf")
+            EXPECT_ROCBLAS_STATUS(rocsolver_getf2_getrf(STRIDED, true, handle, int64_t(n),
+                                                        int64_t(n), (T*)nullptr, int64_t(lda),
+                                                        stA, (int64_t*)nullptr, n,
+                                                        (int64_t*)nullptr, bc64),
+                                  rocblas_status_invalid_size);
+        else
+            EXPECT_ROCBLAS_STATUS(rocsolver_potf2_potrf(STRIDED, true, handle,
+                                                        rocblas_fill_lower, int64_t(n),
+                                                        (T*)nullptr, int64_t(lda), stA,
+                                                        (int64_t*)nullptr, bc64),
+                                  rocblas_status_invalid_size);
+        CHECK_ROCBLAS_ERROR(rocsolver_set_info_summary(handle, nullptr));
+    }
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(stA, 1, bc);
+        host_batch_vector<T> hR(stA, 1, bc);
+        host_batch_vector<T> hRea(stA, 1, bc);
+        device_batch_vector<T> dA(stA, 1, bc);
+        CHECK_HIP_ERROR(dA.memcheck());
+
+        info_summary_initData<T>(hA, function, n, lda, failed);
+
+        // check computations
+        info_summary_getError<STRIDED, T>(handle, function, n, dA, lda, stA, bc, failed, hA, hR,
+                                          hRea, &max_error);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(stA, 1, stA, bc);
+        host_strided_batch_vector<T> hR(stA, 1, stA, bc);
+        host_strided_batch_vector<T> hRea(stA, 1, stA, bc);
+        device_strided_batch_vector<T> dA(stA, 1, stA, bc);
+        CHECK_HIP_ERROR(dA.memcheck());
+
+        info_summary_initData<T>(hA, function, n, lda, failed);
+
+        // check computations
+        info_summary_getError<STRIDED, T>(handle, function, n, dA, lda, stA, bc, failed, hA, hR,
+                                          hRea, &max_error);
+    }
+
+    // validate results
+    ROCSOLVER_TEST_CHECK(T, max_error, n);
+}
@@ -0,0 +1,243 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+inline void testing_lookahead_bad_arg()
+{
+    rocblas_local_handle handle;
+    bool enable = true;
+    rocsolver_alg_mode mode = rocsolver_alg_mode_recursive;
+
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_set_lookahead(nullptr, true), rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocsolver_get_lookahead(nullptr, &enable),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_set_alg_mode(nullptr, rocsolver_function_getrf, rocsolver_alg_mode_default),
+        rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocsolver_get_alg_mode(nullptr, rocsolver_function_getrf, &mode),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocsolver_release_handle_resources(nullptr),
+                          rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_set_alg_mode(handle, rocsolver_function(0), rocsolver_alg_mode_default),
+        rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(rocsolver_get_alg_mode(handle, rocsolver_function(0), &mode),
+                          rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_set_alg_mode(handle, rocsolver_function_getrf, rocsolver_alg_mode(0)),
+        rocblas_status_invalid_value);
+    // (the persistent kernel is only available for potrf)
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_set_alg_mode(handle, rocsolver_function_getrf, rocsolver_alg_mode_persistent),
+        rocblas_status_invalid_value);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_set_alg_mode(handle, rocsolver_function_geqrf, rocsolver_alg_mode_persistent),
+        rocblas_status_invalid_value);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_get_lookahead(handle, nullptr),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_get_alg_mode(handle, rocsolver_function_getrf, nullptr),
+                          rocblas_status_invalid_pointer);
+
+    // look-ahead is disabled and the default algorithms are used by default
+    CHECK_ROCBLAS_ERROR(rocsolver_get_lookahead(handle, &enable));
+    EXPECT_FALSE(enable);
+    for(rocsolver_function func :
+        {rocsolver_function_getrf, rocsolver_function_geqrf, rocsolver_function_potrf})
+    {
+        CHECK_ROCBLAS_ERROR(rocsolver_get_alg_mode(handle, func, &mode));
+        EXPECT_EQ(mode, rocsolver_alg_mode_default);
+    }
+
+    // the modes are independent per function
+    CHECK_ROCBLAS_ERROR(rocsolver_set_lookahead(handle, true));
+    CHECK_ROCBLAS_ERROR(
+        rocsolver_set_alg_mode(handle, rocsolver_function_getrf, rocsolver_alg_mode_recursive));
+    CHECK_ROCBLAS_ERROR(
+        rocsolver_set_alg_mode(handle, rocsolver_function_potrf, rocsolver_alg_mode_persistent));
+    CHECK_ROCBLAS_ERROR(rocsolver_get_lookahead(handle, &enable));
+    EXPECT_TRUE(enable);
+    CHECK_ROCBLAS_ERROR(rocsolver_get_alg_mode(handle, rocsolver_function_getrf, &mode));
+    EXPECT_EQ(mode, rocsolver_alg_mode_recursive);
+    CHECK_ROCBLAS_ERROR(rocsolver_get_alg_mode(handle, rocsolver_function_potrf, &mode));
+    EXPECT_EQ(mode, rocsolver_alg_mode_persistent);
+    CHECK_ROCBLAS_ERROR(rocsolver_get_alg_mode(handle, rocsolver_function_geqrf, &mode));
+    EXPECT_EQ(mode, rocsolver_alg_mode_default);
+
+    // releasing the resources restores the defaults
+    CHECK_ROCBLAS_ERROR(rocsolver_release_handle_resources(handle));
+    CHECK_ROCBLAS_ERROR(rocsolver_get_lookahead(handle, &enable));
+    EXPECT_FALSE(enable);
+    CHECK_ROCBLAS_ERROR(rocsolver_get_alg_mode(handle, rocsolver_function_getrf, &mode));
+    EXPECT_EQ(mode, rocsolver_alg_mode_default);
+    CHECK_ROCBLAS_ERROR(rocsolver_get_alg_mode(handle, rocsolver_function_potrf, &mode));
+    EXPECT_EQ(mode, rocsolver_alg_mode_default);
+}
+
+template <typename T, typename Th>
+void lookahead_initData(Th& hA, const rocblas_int n, const rocblas_int lda)
+{
+    rocblas_init<T>(hA, true);
+
+    // make the matrices diagonally dominant, so that their lower (or upper) triangular
+    // parts define Hermitian positive definite matrices
+    for(rocblas_int b = 0; b < hA.batch_count(); ++b)
+    {
+        for(rocblas_int i = 0; i < n; i++)
+        {
+            for(rocblas_int j = 0; j < n; j++)
+            {
+                if(i == j)
+                    hA[b][i + j * lda] = std::real(hA[b][i + j * lda]) + 400;
+                else
+                    hA[b][i + j * lda] -= 4;
+            }
+        }
+    }
+}
+
+/** Executes the factorization given by the "function" argument without and with look-ahead,
+    using the algorithm given by the "alg_mode" argument, and compares the results. (Look-ahead
+    only changes the order in which the updates of the trailing matrix are enqueued.) **/
+template <bool STRIDED, typename T>
+void testing_lookahead(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    std::string function = argus.get<std::string>("function");
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocsolver_alg_mode mode = rocsolver_alg_mode(argus.get<rocblas_int>("alg_mode"));
+    rocblas_int lda = n;
+    rocblas_stride stA = lda * n;
+    rocblas_stride stP = n;
+    rocblas_int bc = argus.batch_count;
+
+    rocsolver_function func;
+    rocblas_fill uplo = rocblas_fill_full;
+    if(function == "getrf")
+        func = rocsolver_function_getrf;
+    else if(function == "geqrf")
+        func = rocsolver_function_geqrf;
+    else if(function == "potrf_lower" || function == "potrf_upper")
+    {
+        func = rocsolver_function_potrf;
+        uplo = (function == "potrf_lower") ? rocblas_fill_lower : rocblas_fill_upper;
+    }
+    else
+        FAIL() << "unknown function " << function;
+    CHECK_ROCBLAS_ERROR(rocsolver_set_alg_mode(handle, func, mode));
+
+    // memory allocations
+    host_strided_batch_vector<T> hA(stA, 1, stA, bc);
+    host_strided_batch_vector<T> hAla(stA, 1, stA, bc);
+    host_strided_batch_vector<T> hR(stA, 1, stA, bc);
+    host_strided_batch_vector<T> hTau(stP, 1, stP, bc);
+    host_strided_batch_vector<T> hTaula(stP, 1, stP, bc);
+    host_strided_batch_vector<rocblas_int> hIpiv(stP, 1, stP, bc);
+    host_strided_batch_vector<rocblas_int> hIpivla(stP, 1, stP, bc);
+    host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hInfola(1, 1, 1, bc);
+    device_strided_batch_vector<T> dA(stA, 1, stA, bc);
+    device_strided_batch_vector<T> dTau(stP, 1, stP, bc);
+    device_strided_batch_vector<rocblas_int> dIpiv(stP, 1, stP, bc);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dTau.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    lookahead_initData<T>(hA, n, lda);
+
+    auto factorize = [&](const bool lookahead, host_strided_batch_vector<T>& hAres,
+                         host_strided_batch_vector<T>& hTaures,
+                         host_strided_batch_vector<rocblas_int>& hIpivres,
+                         host_strided_batch_vector<rocblas_int>& hInfores) {
+        CHECK_ROCBLAS_ERROR(rocsolver_set_lookahead(handle, lookahead));
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+        if(func == rocsolver_function_getrf)
+        {
+            CHECK_ROCBLAS_ERROR(rocsolver_getf2_getrf(STRIDED, true, handle, n, n, dA.data(), lda,
+                                                      stA, dIpiv.data(), stP, dInfo.data(), bc));
+            CHECK_HIP_ERROR(hIpivres.transfer_from(dIpiv));
+            CHECK_HIP_ERROR(hInfores.transfer_from(dInfo));
+        }
+        else if(func == rocsolver_function_potrf)
+        {
+            CHECK_ROCBLAS_ERROR(rocsolver_potf2_potrf(STRIDED, true, handle, uplo, n, dA.data(),
+                                                      lda, stA, dInfo.data(), bc));
+            CHECK_HIP_ERROR(hInfores.transfer_from(dInfo));
+        }
+        else
+        {
+            CHECK_ROCBLAS_ERROR(rocsolver_geqr2_geqrf(STRIDED, true, handle, n, n, dA.data(), lda,
+                                                      stA, dTau.data(), stP, bc));
+            CHECK_HIP_ERROR(hTaures.transfer_from(dTau));
+        }
+        CHECK_HIP_ERROR(hAres.transfer_from(dA));
+    };
+
+    factorize(false, hR, hTau, hIpiv, hInfo);
+    factorize(true, hAla, hTaula, hIpivla, hInfola);
+
+    // the pivots and info must coincide, and the factors must coincide up to round-off
+    double max_error = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        if(func != rocsolver_function_geqrf)
+            EXPECT_EQ(hInfola[b][0], hInfo[b][0]) << "where b = " << b;
+        if(func == rocsolver_function_getrf)
+            for(rocblas_int i = 0; i < n; i++)
+                EXPECT_EQ(hIpivla[b][i], hIpiv[b][i]) << "where b = " << b << ", i = " << i;
+        if(func == rocsolver_function_geqrf)
+            max_error = std::max(max_error, norm_error('F', 1, n, 1, hTau[b], hTaula[b]));
+
+        // (potrf does not reference the other triangle)
+        double err;
+        if(uplo == rocblas_fill_lower)
+            err = norm_error_lowerTr('F', n, n, lda, hR[b], hAla[b]);
+        else if(uplo == rocblas_fill_upper)
+            err = norm_error_upperTr('F', n, n, lda, hR[b], hAla[b]);
+        else
+            err = norm_error('F', n, n, lda, hR[b], hAla[b]);
+        max_error = std::max(max_error, err);
+    }
+    ROCSOLVER_TEST_CHECK(T, max_error, n);
+}
@@ -0,0 +1,283 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+/** The main kernels of the blocked SYEVJ/HEEVJ and of BDSQR are persistent: they process the
+    batch instances read from a device-side work queue. The batches mix instances that need very
+    different amounts of work: instance b is diagonal if b % 3 == 0, has small off-diagonal
+    entries if b % 3 == 1, and random off-diagonal entries otherwise. The diagonal entries are
+    well separated. **/
+template <typename T, typename Th>
+void persistent_queue_initData(Th& hA, const rocblas_int n, const rocblas_int lda)
+{
+    using S = decltype(std::real(T{}));
+    rocblas_init<T>(hA, true);
+
+    for(rocblas_int b = 0; b < hA.batch_count(); ++b)
+    {
+        S scale = (b % 3 == 0 ? 0 : (b % 3 == 1 ? S(1e-4) : 1));
+        for(rocblas_int j = 0; j < n; j++)
+        {
+            for(rocblas_int i = 0; i < j; i++)
+            {
+                hA[b][i + j * lda] = (hA[b][i + j * lda] - T(5)) * scale / 5;
+                hA[b][j + i * lda] = sconj(hA[b][i + j * lda]);
+            }
+            hA[b][j + j * lda] = 2 * j + (std::real(hA[b][j + j * lda]) - 5) / 10;
+        }
+    }
+}
+
+/** Executes the function given by the "function" argument on the whole batch and on each
+    instance on its own, and compares the results. For "syevj_heevj_capture_safe" the
+    batch is also executed in capture-safe mode (the host does not check for convergence, so
+    every sweep is enqueued and the queues of the later sweeps empty out on the device), both
+    eagerly and replayed from a HIP graph. **/
+template <bool STRIDED, typename T, typename Td, typename Th>
+void persistent_queue_getError(const rocblas_handle handle,
+                               const hipStream_t stream,
+                               const std::string function,
+                               const rocblas_int n,
+                               Td& dA,
+                               const rocblas_int lda,
+                               const rocblas_stride stA,
+                               const rocblas_int bc,
+                               Th& hA,
+                               Th& hR,
+                               Th& hRref,
+                               double* max_err)
+{
+    using S = decltype(std::real(T{}));
+    rocblas_stride stW = n;
+    const bool capture = (function == "syevj_heevj_capture_safe");
+    const rocblas_int max_sweeps = capture ? 20 : 100;
+
+    // memory allocations
+    host_strided_batch_vector<S> hW(stW, 1, stW, bc);
+    host_strided_batch_vector<S> hWref(stW, 1, stW, bc);
+    host_strided_batch_vector<rocblas_int> hSweeps(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hSweepsref(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hInforef(1, 1, 1, bc);
+    device_strided_batch_vector<S> dW(stW, 1, stW, bc);
+    device_strided_batch_vector<S> dE(stW, 1, stW, bc);
+    device_strided_batch_vector<S> dResidual(1, 1, 1, bc);
+    device_strided_batch_vector<T> dU(stA, 1, stA, bc);
+    device_strided_batch_vector<T> dV(stA, 1, stA, bc);
+    device_strided_batch_vector<rocblas_int> dSweeps(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+    CHECK_HIP_ERROR(dW.memcheck());
+    CHECK_HIP_ERROR(dE.memcheck());
+    CHECK_HIP_ERROR(dResidual.memcheck());
+    CHECK_HIP_ERROR(dU.memcheck());
+    CHECK_HIP_ERROR(dV.memcheck());
+    CHECK_HIP_ERROR(dSweeps.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    auto run = [&]() {
+        if(function == "gesvd")
+            return rocsolver_gesvd(STRIDED, handle, rocblas_svect_all, rocblas_svect_all, n, n,
+                                   dA.data(), lda, stA, dW.data(), stW, dU.data(), lda, stA,
+                                   dV.data(), lda, stA, dE.data(), stW, rocblas_outofplace,
+                                   dInfo.data(), bc);
+        else
+            return rocsolver_syevj_heevj(STRIDED, handle, rocblas_esort_ascending,
+                                         rocblas_evect_original, rocblas_fill_upper, n,
+                                         dA.data(), lda, stA, S(0), dResidual.data(), max_sweeps,
+                                         dSweeps.data(), dW.data(), stW, dInfo.data(), bc);
+    };
+
+    auto run_each = [&]() {
+        rocblas_status status = rocblas_status_success;
+        for(rocblas_int b = 0; b < bc && status == rocblas_status_success; b++)
+        {
+            if(function == "gesvd")
+                status = rocsolver_gesvd(false, handle, rocblas_svect_all, rocblas_svect_all, n,
+                                         n, dA[b], lda, stA, dW[b], stW, dU[b], lda, stA, dV[b],
+                                         lda, stA, dE[b], stW, rocblas_outofplace, dInfo[b], 1);
+            else
+                status = rocsolver_syevj_heevj(false, handle, rocblas_esort_ascending,
+                                               rocblas_evect_original, rocblas_fill_upper, n,
+                                               dA[b], lda, stA, S(0), dResidual[b], max_sweeps,
+                                               dSweeps[b], dW[b], stW, dInfo[b], 1);
+        }
+        return status;
+    };
+
+    auto get = [&](Th& hRes, host_strided_batch_vector<S>& hWRes,
+                   host_strided_batch_vector<rocblas_int>& hSweepsRes,
+                   host_strided_batch_vector<rocblas_int>& hInfoRes) {
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+        CHECK_HIP_ERROR(hRes.transfer_from(dA));
+        CHECK_HIP_ERROR(hWRes.transfer_from(dW));
+        CHECK_HIP_ERROR(hSweepsRes.transfer_from(dSweeps));
+        CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+    };
+
+    // every instance goes through the same sweeps as on its own
+    // (the singular vectors are also computed, so that BDSQR applies its rotations to them, but
+    // the bidiagonalization of the batch may be blocked differently, so only the singular
+    // values are compared)
+    auto compare = [&]() {
+        double err;
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            EXPECT_EQ(hInfo[b][0], hInforef[b][0]) << "where b = " << b;
+            err = norm_error('F', 1, n, 1, hWref[b], hW[b]);
+            *max_err = std::max(*max_err, err);
+            if(function == "gesvd")
+                continue;
+
+            EXPECT_EQ(hSweeps[b][0], hSweepsref[b][0]) << "where b = " << b;
+            err = norm_error('F', n, n, lda, hRref[b], hR[b]);
+            *max_err = std::max(*max_err, err);
+        }
+    };
+
+    *max_err = 0;
+
+    // reference, with each instance on its own
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_ROCBLAS_ERROR(run_each());
+    get(hRref, hWref, hSweepsref, hInforef);
+
+    // the whole batch
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_ROCBLAS_ERROR(run());
+    get(hR, hW, hSweeps, hInfo);
+    compare();
+
+    if(function != "gesvd")
+    {
+        // the batch needs several sweeps, and some instances converge long before the others
+        rocblas_int min_sweeps = max_sweeps, max_used = 0;
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            min_sweeps = std::min(min_sweeps, hSweepsref[b][0]);
+            max_used = std::max(max_used, hSweepsref[b][0]);
+        }
+        EXPECT_EQ(min_sweeps, 0);
+        EXPECT_GT(max_used, 2);
+        EXPECT_LT(max_used, max_sweeps);
+    }
+
+    if(capture)
+    {
+        rocblas_status status = rocsolver_set_capture_safe(handle, true);
+        if(status == rocblas_status_arch_mismatch)
+            GTEST_SKIP() << "capture-safe mode is not supported on this architecture";
+        CHECK_ROCBLAS_ERROR(status);
+
+        // executed eagerly
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_ROCBLAS_ERROR(run());
+        get(hR, hW, hSweeps, hInfo);
+        compare();
+
+        // and replayed from a graph
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        hipGraph_t graph = nullptr;
+        hipGraphExec_t exec = nullptr;
+        CHECK_HIP_ERROR(hipStreamBeginCapture(stream, hipStreamCaptureModeGlobal));
+        status = run();
+        CHECK_HIP_ERROR(hipStreamEndCapture(stream, &graph));
+        CHECK_ROCBLAS_ERROR(status);
+        CHECK_HIP_ERROR(hipGraphInstantiate(&exec, graph, nullptr, nullptr, 0));
+        CHECK_HIP_ERROR(hipGraphLaunch(exec, stream));
+        get(hR, hW, hSweeps, hInfo);
+        CHECK_HIP_ERROR(hipGraphExecDestroy(exec));
+        CHECK_HIP_ERROR(hipGraphDestroy(graph));
+        compare();
+
+        CHECK_ROCBLAS_ERROR(rocsolver_set_capture_safe(handle, false));
+    }
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_persistent_queue(Arguments& argus)
+{
+    // get arguments
+    // (the handle is destroyed before its stream)
+    rocblas_local_stream stream;
+    rocblas_local_handle handle;
+    std::string function = argus.get<std::string>("function");
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int lda = n;
+    rocblas_stride stA = lda * n;
+    rocblas_int bc = argus.batch_count;
+    double max_error = 0;
+
+    if(function != "syevj_heevj" && function != "syevj_heevj_capture_safe" && function != "gesvd")
+        FAIL() << "unknown function " << function;
+
+    CHECK_HIP_ERROR(stream.memcheck());
+    CHECK_ROCBLAS_ERROR(rocblas_set_stream(handle, stream));
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(stA, 1, bc);
+        host_batch_vector<T> hR(stA, 1, bc);
+        host_batch_vector<T> hRref(stA, 1, bc);
+        device_batch_vector<T> dA(stA, 1, bc);
+        CHECK_HIP_ERROR(dA.memcheck());
+
+        persistent_queue_initData<T>(hA, n, lda);
+
+        // check computations
+        persistent_queue_getError<STRIDED, T>(handle, stream, function, n, dA, lda, stA, bc, hA,
+                                              hR, hRref, &max_error);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(stA, 1, stA, bc);
+        host_strided_batch_vector<T> hR(stA, 1, stA, bc);
+        host_strided_batch_vector<T> hRref(stA, 1, stA, bc);
+        device_strided_batch_vector<T> dA(stA, 1, stA, bc);
+        CHECK_HIP_ERROR(dA.memcheck());
+
+        persistent_queue_initData<T>(hA, n, lda);
+
+        // check computations
+        persistent_queue_getError<STRIDED, T>(handle, stream, function, n, dA, lda, stA, bc, hA,
+                                              hR, hRref, &max_error);
+    }
+
+    // validate results
+    ROCSOLVER_TEST_CHECK(T, max_error, n);
+}
@@ -0,0 +1,370 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+template <typename Th, typename U>
+void potrf_ooc_checkBadArgs(const rocblas_handle handle,
+                            const rocblas_fill uplo,
+                            const rocblas_int n,
+                            Th hA,
+                            const rocblas_int lda,
+                            U dInfo)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_potrf_ooc(nullptr, uplo, n, hA, lda, dInfo),
+                          rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_potrf_ooc(handle, rocblas_fill_full, n, hA, lda, dInfo),
+                          rocblas_status_invalid_value);
+
+    // sizes (only check batch_count if applicable)
+    // N/A
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_potrf_ooc(handle, uplo, n, (Th) nullptr, lda, dInfo),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_potrf_ooc(handle, uplo, n, hA, lda, (U) nullptr),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_potrf_ooc(handle, uplo, 0, (Th) nullptr, lda, dInfo),
+                          rocblas_status_success);
+}
+
+template <typename T>
+void testing_potrf_ooc_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int n = 1;
+    rocblas_int lda = 1;
+    rocblas_fill uplo = rocblas_fill_upper;
+
+    // memory allocations
+    // (the matrix is on the host)
+    host_strided_batch_vector<T> hA(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // check bad arguments
+    potrf_ooc_checkBadArgs(handle, uplo, n, hA.data(), lda, dInfo.data());
+}
+
+template <bool CPU, bool GPU, typename T, typename Th>
+void potrf_ooc_initData(const rocblas_handle handle,
+                        const rocblas_fill uplo,
+                        const rocblas_int n,
+                        Th& hARes,
+                        const rocblas_int lda,
+                        Th& hA,
+                        const bool singular)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+
+        // scale to ensure positive definiteness
+        for(rocblas_int i = 0; i < n; i++)
+            hA[0][i + i * lda] = hA[0][i + i * lda] * sconj(hA[0][i + i * lda]) * 400;
+
+        if(singular)
+        {
+            // make the matrix not positive definite
+            // always the same elements for debugging purposes
+            // the algorithm must detect the lower order of the principal minors <= 0,
+            // which is in a later panel when n is large enough
+            hA[0][(n / 4) + (n / 4) * lda] = 0;
+            hA[0][(n / 2) + (n / 2) * lda] = 0;
+            hA[0][(n - 1) + (n - 1) * lda] = 0;
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy data to the host matrix processed by the GPU
+        // (it is overwritten with the factor)
+        std::copy(hA[0], hA[0] + size_t(lda) * n, hARes[0]);
+    }
+}
+
+template <typename T, typename Th, typename Ud, typename Uh>
+void potrf_ooc_getError(const rocblas_handle handle,
+                        const rocblas_fill uplo,
+                        const rocblas_int n,
+                        Th& hARes,
+                        const rocblas_int lda,
+                        Ud& dInfo,
+                        Th& hA,
+                        Uh& hInfo,
+                        Uh& hInfoRes,
+                        double* max_err,
+                        const bool singular)
+{
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+    // input data initialization
+    potrf_ooc_initData<true, true, T>(handle, uplo, n, hARes, lda, hA, singular);
+
+    // execute computations
+    // GPU lapack
+    // (the host matrix is updated asynchronously)
+    CHECK_ROCBLAS_ERROR(rocsolver_potrf_ooc(handle, uplo, n, hARes.data(), lda, dInfo.data()));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // CPU lapack
+    cpu_potrf(uplo, n, hA[0], lda, hInfo[0]);
+
+    // error is ||hA - hARes|| / ||hA|| (ideally ||LL' - Lres Lres'|| / ||LL'||)
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using frobenius norm
+    // (only the principal nn-by-nn submatrix is checked when the matrix is not positive definite)
+    rocblas_int nn = hInfoRes[0][0] == 0 ? n : hInfoRes[0][0];
+    *max_err = (uplo == rocblas_fill_lower) ? norm_error_lowerTr('F', nn, nn, lda, hA[0], hARes[0])
+                                            : norm_error_upperTr('F', nn, nn, lda, hA[0], hARes[0]);
+
+    // also check info for non positive definite cases
+    EXPECT_EQ(hInfo[0][0], hInfoRes[0][0]);
+    if(hInfo[0][0] != hInfoRes[0][0])
+        *max_err += 1;
+}
+
+template <typename T, typename Th, typename Ud, typename Uh>
+void potrf_ooc_getPerfData(const rocblas_handle handle,
+                           const rocblas_fill uplo,
+                           const rocblas_int n,
+                           Th& hARes,
+                           const rocblas_int lda,
+                           Ud& dInfo,
+                           Th& hA,
+                           Uh& hInfo,
+                           double* gpu_time_used,
+                           double* cpu_time_used,
+                           const int hot_calls,
+                           const int profile,
+                           const bool profile_kernels,
+                           const bool perf,
+                           const bool singular)
+{
+    if(!perf)
+    {
+        potrf_ooc_initData<true, false, T>(handle, uplo, n, hARes, lda, hA, singular);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        cpu_potrf(uplo, n, hA[0], lda, hInfo[0]);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    potrf_ooc_initData<true, false, T>(handle, uplo, n, hARes, lda, hA, singular);
+
+    // gpu-lapack performance
+    // (the stream must be synchronized before the host matrix is initialized again)
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        potrf_ooc_initData<false, true, T>(handle, uplo, n, hARes, lda, hA, singular);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_potrf_ooc(handle, uplo, n, hARes.data(), lda, dInfo.data()));
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    }
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(int iter = 0; iter < hot_calls; iter++)
+    {
+        potrf_ooc_initData<false, true, T>(handle, uplo, n, hARes, lda, hA, singular);
+
+        start = get_time_us_sync(stream);
+        rocsolver_potrf_ooc(handle, uplo, n, hARes.data(), lda, dInfo.data());
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <typename T>
+void testing_potrf_ooc(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    char uploC = argus.get<char>("uplo");
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int lda = argus.get<rocblas_int>("lda", n);
+
+    rocblas_fill uplo = char2rocblas_fill(uploC);
+    int hot_calls = argus.iters;
+
+    // check non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+    {
+        EXPECT_ROCBLAS_STATUS(
+            rocsolver_potrf_ooc(handle, uplo, n, (T*)nullptr, lda, (rocblas_int*)nullptr),
+            rocblas_status_invalid_value);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_args);
+
+        return;
+    }
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || lda < n);
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(
+            rocsolver_potrf_ooc(handle, uplo, n, (T*)nullptr, lda, (rocblas_int*)nullptr),
+            rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        CHECK_ALLOC_QUERY(rocsolver_potrf_ooc(handle, uplo, n, (T*)nullptr, lda,
+                                              (rocblas_int*)nullptr));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform_mem_query(handle, size, argus.mem_query > 1);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations
+    // (the matrix processed by the GPU is on the host, and it is pinned so that its transfers
+    // are overlapped with the computations)
+    host_strided_batch_vector<T> hA(size_A, 1, size_A, 1);
+    host_strided_batch_vector<T> hARes(size_A, 1, size_A, 1);
+    host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, 1);
+    host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+    rocblas_local_pinned_host pinned(hARes.data(), sizeof(T) * size_A);
+    CHECK_HIP_ERROR(pinned.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // check quick return
+    if(n == 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_potrf_ooc(handle, uplo, n, hARes.data(), lda, dInfo.data()),
+                              rocblas_status_success);
+        if(argus.timing)
+            rocsolver_bench_inform(inform_quick_return);
+
+        return;
+    }
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        potrf_ooc_getError<T>(handle, uplo, n, hARes, lda, dInfo, hA, hInfo, hInfoRes, &max_error,
+                              argus.singular);
+
+    // collect performance data
+    if(argus.timing)
+        potrf_ooc_getPerfData<T>(handle, uplo, n, hARes, lda, dInfo, hA, hInfo, &gpu_time_used,
+                                 &cpu_time_used, hot_calls, argus.profile, argus.profile_kernels,
+                                 argus.perf, argus.singular);
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            rocsolver_bench_output("uplo", "n", "lda");
+            rocsolver_bench_output(uploC, n, lda);
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_POTRF_OOC(...) \
+    extern template void testing_potrf_ooc<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_POTRF_OOC, FOREACH_SCALAR_TYPE, APPLY_STAMP)
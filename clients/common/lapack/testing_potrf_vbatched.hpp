@@ -0,0 +1,474 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "common/lapack/testing_getrf_vbatched.hpp"
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+template <typename Td, typename Ud>
+void potrf_vbatched_checkBadArgs(const rocblas_handle handle,
+                                 const rocblas_fill uplo,
+                                 const Ud dN,
+                                 Td dA,
+                                 const Ud dLda,
+                                 Ud dInfo,
+                                 const rocblas_int max_n,
+                                 const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_potrf_vbatched(nullptr, uplo, dN, dA, dLda, dInfo, max_n, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_potrf_vbatched(handle, rocblas_fill_full, dN, dA, dLda, dInfo, max_n, bc),
+        rocblas_status_invalid_value);
+
+    // sizes (if applicable)
+    EXPECT_ROCBLAS_STATUS(rocsolver_potrf_vbatched(handle, uplo, dN, dA, dLda, dInfo, -1, bc),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocsolver_potrf_vbatched(handle, uplo, dN, dA, dLda, dInfo, max_n, -1),
+                          rocblas_status_invalid_size);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_potrf_vbatched(handle, uplo, (Ud) nullptr, dA, dLda, dInfo, max_n, bc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_potrf_vbatched(handle, uplo, dN, (Td) nullptr, dLda, dInfo, max_n, bc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_potrf_vbatched(handle, uplo, dN, dA, (Ud) nullptr, dInfo, max_n, bc),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_potrf_vbatched(handle, uplo, dN, dA, dLda, (Ud) nullptr, max_n, bc),
+        rocblas_status_invalid_pointer);
+
+    // sizes of the problems (checked once they are read from the device)
+    EXPECT_ROCBLAS_STATUS(rocsolver_potrf_vbatched(handle, uplo, dN, dA, dLda, dInfo, 0, bc),
+                          rocblas_status_invalid_size);
+
+    // quick return with zero batch_count
+    EXPECT_ROCBLAS_STATUS(rocsolver_potrf_vbatched(handle, uplo, (Ud) nullptr, (Td) nullptr,
+                                                   (Ud) nullptr, (Ud) nullptr, max_n, 0),
+                          rocblas_status_success);
+}
+
+template <typename T>
+void testing_potrf_vbatched_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_fill uplo = rocblas_fill_upper;
+    rocblas_int max_n = 1;
+    rocblas_int bc = 1;
+
+    // memory allocations
+    host_strided_batch_vector<rocblas_int> hSize(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dN(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dLda(1, 1, 1, 1);
+    device_batch_vector<T> dA(1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dN.memcheck());
+    CHECK_HIP_ERROR(dLda.memcheck());
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // the single problem of the batch is 1-by-1
+    hSize[0][0] = 1;
+    CHECK_HIP_ERROR(dN.transfer_from(hSize));
+    CHECK_HIP_ERROR(dLda.transfer_from(hSize));
+
+    // check bad arguments
+    potrf_vbatched_checkBadArgs(handle, uplo, dN.data(), dA.data(), dLda.data(), dInfo.data(),
+                                max_n, bc);
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Uh, typename Th>
+void potrf_vbatched_initData(const rocblas_handle handle,
+                             const rocblas_fill uplo,
+                             Uh& hN,
+                             Td& dA,
+                             Uh& hLda,
+                             const rocblas_int bc,
+                             Th& hA,
+                             const bool singular)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            rocblas_int n = hN[b][0];
+            rocblas_int lda = hLda[b][0];
+
+            // scale to ensure positive definiteness
+            for(rocblas_int i = 0; i < n; i++)
+                hA[b][i + i * lda] = hA[b][i + i * lda] * sconj(hA[b][i + i * lda]) * 400;
+
+            if(singular && n > 0 && (b == bc / 4 || b == bc / 2 || b == bc - 1))
+            {
+                // make some matrices not positive definite
+                // always the same elements for debugging purposes
+                // the algorithm must detect the lower order of the principal minors <= 0
+                // in those matrices in the batch that are non positive definite
+                rocblas_int i = n / 4 + b;
+                i -= (i / n) * n;
+                hA[b][i + i * lda] = 0;
+                i = n / 2 + b;
+                i -= (i / n) * n;
+                hA[b][i + i * lda] = 0;
+                i = n - 1 + b;
+                i -= (i / n) * n;
+                hA[b][i + i * lda] = 0;
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy data to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+void potrf_vbatched_getError(const rocblas_handle handle,
+                             const rocblas_fill uplo,
+                             Ud& dN,
+                             Td& dA,
+                             Ud& dLda,
+                             Ud& dInfo,
+                             const rocblas_int max_n,
+                             const rocblas_int bc,
+                             Uh& hN,
+                             Uh& hLda,
+                             Th& hA,
+                             Th& hARes,
+                             Uh& hInfo,
+                             Uh& hInfoRes,
+                             double* max_err,
+                             const bool singular)
+{
+    // input data initialization
+    potrf_vbatched_initData<true, true, T>(handle, uplo, hN, dA, hLda, bc, hA, singular);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_potrf_vbatched(handle, uplo, dN.data(), dA.data(), dLda.data(),
+                                                 dInfo.data(), max_n, bc));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // CPU lapack
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        cpu_potrf(uplo, hN[b][0], hA[b], hLda[b][0], hInfo[b]);
+    }
+
+    // error is ||hA - hARes|| / ||hA|| (ideally ||LL' - Lres Lres'|| / ||LL'||)
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using frobenius norm
+    double err;
+    rocblas_int nn;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        // (the algorithm may modify the whole input matrix even when it is not positive
+        // definite, so only the principal nn-by-nn submatrix is checked)
+        nn = hInfoRes[b][0] == 0 ? hN[b][0] : hInfoRes[b][0];
+
+        // (empty problems are left untouched)
+        if(nn == 0)
+            continue;
+
+        err = (uplo == rocblas_fill_lower)
+            ? norm_error_lowerTr('F', nn, nn, hLda[b][0], hA[b], hARes[b])
+            : norm_error_upperTr('F', nn, nn, hLda[b][0], hA[b], hARes[b]);
+        *max_err = err > *max_err ? err : *max_err;
+    }
+
+    // also check info for non positive definite cases
+    err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        EXPECT_EQ(hInfo[b][0], hInfoRes[b][0]) << "where b = " << b;
+        if(hInfo[b][0] != hInfoRes[b][0])
+            err++;
+    }
+    *max_err += err;
+}
+
+template <typename T, typename Td, typename Ud, typename Th, typename Uh>
+void potrf_vbatched_getPerfData(const rocblas_handle handle,
+                                const rocblas_fill uplo,
+                                Ud& dN,
+                                Td& dA,
+                                Ud& dLda,
+                                Ud& dInfo,
+                                const rocblas_int max_n,
+                                const rocblas_int bc,
+                                Uh& hN,
+                                Uh& hLda,
+                                Th& hA,
+                                Uh& hInfo,
+                                double* gpu_time_used,
+                                double* cpu_time_used,
+                                const rocblas_int hot_calls,
+                                const int profile,
+                                const bool profile_kernels,
+                                const bool perf,
+                                const bool singular)
+{
+    if(!perf)
+    {
+        potrf_vbatched_initData<true, false, T>(handle, uplo, hN, dA, hLda, bc, hA, singular);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            cpu_potrf(uplo, hN[b][0], hA[b], hLda[b][0], hInfo[b]);
+        }
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    potrf_vbatched_initData<true, false, T>(handle, uplo, hN, dA, hLda, bc, hA, singular);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        potrf_vbatched_initData<false, true, T>(handle, uplo, hN, dA, hLda, bc, hA, singular);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_potrf_vbatched(handle, uplo, dN.data(), dA.data(),
+                                                     dLda.data(), dInfo.data(), max_n, bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        potrf_vbatched_initData<false, true, T>(handle, uplo, hN, dA, hLda, bc, hA, singular);
+
+        start = get_time_us_sync(stream);
+        rocsolver_potrf_vbatched(handle, uplo, dN.data(), dA.data(), dLda.data(), dInfo.data(),
+                                 max_n, bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <typename T>
+void testing_potrf_vbatched(Arguments& argus)
+{
+    // get arguments
+    // (n and lda are the size and the leading dimension of the largest problems; problem b is
+    // of order vbatched_size(n, b), see testing_getrf_vbatched)
+    rocblas_local_handle handle;
+    char uploC = argus.get<char>("uplo");
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int lda = argus.get<rocblas_int>("lda", n);
+
+    rocblas_fill uplo = char2rocblas_fill(uploC);
+    rocblas_int bc = argus.batch_count;
+    rocblas_int hot_calls = argus.iters;
+
+    // check non-supported values
+    // N/A
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || bc < 0);
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_potrf_vbatched(handle, uplo, (rocblas_int*)nullptr,
+                                                       (T* const*)nullptr, (rocblas_int*)nullptr,
+                                                       (rocblas_int*)nullptr, n, bc),
+                              rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // determine sizes
+    // (every problem fits in the space of the largest one, which is allocated even if it is
+    // empty, as the arrays of pointers cannot be null)
+    size_t size_A = size_t(std::max(lda, 1)) * std::max(n, 1);
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        CHECK_ALLOC_QUERY(rocsolver_potrf_vbatched(handle, uplo, (rocblas_int*)nullptr,
+                                                   (T* const*)nullptr, (rocblas_int*)nullptr,
+                                                   (rocblas_int*)nullptr, n, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform_mem_query(handle, size, argus.mem_query > 1);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations
+    host_strided_batch_vector<rocblas_int> hN(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hLda(1, 1, 1, bc);
+    host_batch_vector<T> hA(size_A, 1, bc);
+    host_batch_vector<T> hARes(size_ARes, 1, bc);
+    host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dN(1, 1, 1, bc);
+    device_strided_batch_vector<rocblas_int> dLda(1, 1, 1, bc);
+    device_batch_vector<T> dA(size_A, 1, bc);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+    CHECK_HIP_ERROR(dN.memcheck());
+    CHECK_HIP_ERROR(dLda.memcheck());
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // sizes of the problems
+    bool invalid_lda = false;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        hN[b][0] = vbatched_size(n, b);
+        hLda[b][0] = vbatched_ld(lda, n, hN[b][0]);
+        invalid_lda = invalid_lda || hLda[b][0] < hN[b][0];
+    }
+    CHECK_HIP_ERROR(dN.transfer_from(hN));
+    CHECK_HIP_ERROR(dLda.transfer_from(hLda));
+
+    // check invalid sizes of the problems
+    // (they are only checked once they are read from the device)
+    if(invalid_lda)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_potrf_vbatched(handle, uplo, dN.data(), dA.data(),
+                                                       dLda.data(), dInfo.data(), n, bc),
+                              rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // check quick return
+    if(bc == 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_potrf_vbatched(handle, uplo, dN.data(), dA.data(),
+                                                       dLda.data(), dInfo.data(), n, bc),
+                              rocblas_status_success);
+        if(argus.timing)
+            rocsolver_bench_inform(inform_quick_return);
+
+        return;
+    }
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        potrf_vbatched_getError<T>(handle, uplo, dN, dA, dLda, dInfo, n, bc, hN, hLda, hA, hARes,
+                                   hInfo, hInfoRes, &max_error, argus.singular);
+
+    // collect performance data
+    if(argus.timing)
+        potrf_vbatched_getPerfData<T>(handle, uplo, dN, dA, dLda, dInfo, n, bc, hN, hLda, hA,
+                                      hInfo, &gpu_time_used, &cpu_time_used, hot_calls,
+                                      argus.profile, argus.profile_kernels, argus.perf,
+                                      argus.singular);
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            rocsolver_bench_output("uplo", "max_n", "lda", "batch_c");
+            rocsolver_bench_output(uploC, n, lda, bc);
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_POTRF_VBATCHED(...) \
+    extern template void testing_potrf_vbatched<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_POTRF_VBATCHED, FOREACH_SCALAR_TYPE, APPLY_STAMP)
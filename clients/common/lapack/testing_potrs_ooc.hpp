@@ -0,0 +1,364 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+template <typename T>
+void potrs_ooc_checkBadArgs(const rocblas_handle handle,
+                            const rocblas_fill uplo,
+                            const rocblas_int n,
+                            const rocblas_int nrhs,
+                            T hA,
+                            const rocblas_int lda,
+                            T dB,
+                            const rocblas_int ldb)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_potrs_ooc(nullptr, uplo, n, nrhs, hA, lda, dB, ldb),
+                          rocblas_status_invalid_handle);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(rocsolver_potrs_ooc(handle, rocblas_fill_full, n, nrhs, hA, lda, dB, ldb),
+                          rocblas_status_invalid_value);
+
+    // sizes (only check batch_count if applicable)
+    // N/A
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_potrs_ooc(handle, uplo, n, nrhs, (T) nullptr, lda, dB, ldb),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_potrs_ooc(handle, uplo, n, nrhs, hA, lda, (T) nullptr, ldb),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_potrs_ooc(handle, uplo, 0, nrhs, (T) nullptr, lda, (T) nullptr, ldb),
+        rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_potrs_ooc(handle, uplo, n, 0, hA, lda, (T) nullptr, ldb),
+                          rocblas_status_success);
+}
+
+template <typename T>
+void testing_potrs_ooc_bad_arg()
+{
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int n = 1;
+    rocblas_int nrhs = 1;
+    rocblas_int lda = 1;
+    rocblas_int ldb = 1;
+    rocblas_fill uplo = rocblas_fill_upper;
+
+    // memory allocations
+    // (the matrix A is on the host)
+    host_strided_batch_vector<T> hA(1, 1, 1, 1);
+    device_strided_batch_vector<T> dB(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dB.memcheck());
+
+    // check bad arguments
+    potrs_ooc_checkBadArgs(handle, uplo, n, nrhs, hA.data(), lda, dB.data(), ldb);
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+void potrs_ooc_initData(const rocblas_handle handle,
+                        const rocblas_fill uplo,
+                        const rocblas_int n,
+                        const rocblas_int nrhs,
+                        const rocblas_int lda,
+                        Td& dB,
+                        const rocblas_int ldb,
+                        Th& hA,
+                        Th& hB)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+        rocblas_init<T>(hB, true);
+        int info;
+
+        // scale to ensure positive definiteness
+        for(rocblas_int i = 0; i < n; i++)
+            hA[0][i + i * lda] = hA[0][i + i * lda] * sconj(hA[0][i + i * lda]) * 400;
+
+        // do the Cholesky factorization of matrix A w/ the reference LAPACK routine
+        // (the factor stays on the host)
+        cpu_potrf(uplo, n, hA[0], lda, &info);
+    }
+
+    if(GPU)
+    {
+        // now copy right hand sides to the GPU
+        CHECK_HIP_ERROR(dB.transfer_from(hB));
+    }
+}
+
+template <typename T, typename Td, typename Th>
+void potrs_ooc_getError(const rocblas_handle handle,
+                        const rocblas_fill uplo,
+                        const rocblas_int n,
+                        const rocblas_int nrhs,
+                        const rocblas_int lda,
+                        Td& dB,
+                        const rocblas_int ldb,
+                        Th& hA,
+                        Th& hB,
+                        Th& hBRes,
+                        double* max_err)
+{
+    // input data initialization
+    potrs_ooc_initData<true, true, T>(handle, uplo, n, nrhs, lda, dB, ldb, hA, hB);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_potrs_ooc(handle, uplo, n, nrhs, hA.data(), lda, dB.data(), ldb));
+    CHECK_HIP_ERROR(hBRes.transfer_from(dB));
+
+    // CPU lapack
+    cpu_potrs(uplo, n, nrhs, hA[0], lda, hB[0], ldb);
+
+    // error is ||hB - hBRes|| / ||hB||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using vector-induced infinity norm
+    *max_err = norm_error('I', n, nrhs, ldb, hB[0], hBRes[0]);
+}
+
+template <typename T, typename Td, typename Th>
+void potrs_ooc_getPerfData(const rocblas_handle handle,
+                           const rocblas_fill uplo,
+                           const rocblas_int n,
+                           const rocblas_int nrhs,
+                           const rocblas_int lda,
+                           Td& dB,
+                           const rocblas_int ldb,
+                           Th& hA,
+                           Th& hB,
+                           double* gpu_time_used,
+                           double* cpu_time_used,
+                           const int hot_calls,
+                           const int profile,
+                           const bool profile_kernels,
+                           const bool perf)
+{
+    if(!perf)
+    {
+        potrs_ooc_initData<true, false, T>(handle, uplo, n, nrhs, lda, dB, ldb, hA, hB);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        cpu_potrs(uplo, n, nrhs, hA[0], lda, hB[0], ldb);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    potrs_ooc_initData<true, false, T>(handle, uplo, n, nrhs, lda, dB, ldb, hA, hB);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        potrs_ooc_initData<false, true, T>(handle, uplo, n, nrhs, lda, dB, ldb, hA, hB);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_potrs_ooc(handle, uplo, n, nrhs, hA.data(), lda, dB.data(),
+                                                ldb));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(int iter = 0; iter < hot_calls; iter++)
+    {
+        potrs_ooc_initData<false, true, T>(handle, uplo, n, nrhs, lda, dB, ldb, hA, hB);
+
+        start = get_time_us_sync(stream);
+        rocsolver_potrs_ooc(handle, uplo, n, nrhs, hA.data(), lda, dB.data(), ldb);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <typename T>
+void testing_potrs_ooc(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    char uploC = argus.get<char>("uplo");
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int nrhs = argus.get<rocblas_int>("nrhs", n);
+    rocblas_int lda = argus.get<rocblas_int>("lda", n);
+    rocblas_int ldb = argus.get<rocblas_int>("ldb", n);
+
+    rocblas_fill uplo = char2rocblas_fill(uploC);
+    int hot_calls = argus.iters;
+
+    // check non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+    {
+        EXPECT_ROCBLAS_STATUS(
+            rocsolver_potrs_ooc(handle, uplo, n, nrhs, (T*)nullptr, lda, (T*)nullptr, ldb),
+            rocblas_status_invalid_value);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_args);
+
+        return;
+    }
+
+    // determine sizes
+    size_t size_A = size_t(lda) * n;
+    size_t size_B = size_t(ldb) * nrhs;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_BRes = (argus.unit_check || argus.norm_check) ? size_B : 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || nrhs < 0 || lda < n || ldb < n);
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(
+            rocsolver_potrs_ooc(handle, uplo, n, nrhs, (T*)nullptr, lda, (T*)nullptr, ldb),
+            rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        CHECK_ALLOC_QUERY(rocsolver_potrs_ooc(handle, uplo, n, nrhs, (T*)nullptr, lda, (T*)nullptr,
+                                              ldb));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform_mem_query(handle, size, argus.mem_query > 1);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations
+    // (the matrix A is on the host, and it is pinned so that its transfers are overlapped with
+    // the computations)
+    host_strided_batch_vector<T> hA(size_A, 1, size_A, 1);
+    host_strided_batch_vector<T> hB(size_B, 1, size_B, 1);
+    host_strided_batch_vector<T> hBRes(size_BRes, 1, size_BRes, 1);
+    device_strided_batch_vector<T> dB(size_B, 1, size_B, 1);
+    rocblas_local_pinned_host pinned(hA.data(), sizeof(T) * size_A);
+    CHECK_HIP_ERROR(pinned.memcheck());
+    if(size_B)
+        CHECK_HIP_ERROR(dB.memcheck());
+
+    // check quick return
+    if(n == 0 || nrhs == 0)
+    {
+        EXPECT_ROCBLAS_STATUS(
+            rocsolver_potrs_ooc(handle, uplo, n, nrhs, hA.data(), lda, dB.data(), ldb),
+            rocblas_status_success);
+        if(argus.timing)
+            rocsolver_bench_inform(inform_quick_return);
+
+        return;
+    }
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        potrs_ooc_getError<T>(handle, uplo, n, nrhs, lda, dB, ldb, hA, hB, hBRes, &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        potrs_ooc_getPerfData<T>(handle, uplo, n, nrhs, lda, dB, ldb, hA, hB, &gpu_time_used,
+                                 &cpu_time_used, hot_calls, argus.profile, argus.profile_kernels,
+                                 argus.perf);
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            rocsolver_bench_output("uplo", "n", "nrhs", "lda", "ldb");
+            rocsolver_bench_output(uploC, n, nrhs, lda, ldb);
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_POTRS_OOC(...) \
+    extern template void testing_potrs_ooc<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_POTRS_OOC, FOREACH_SCALAR_TYPE, APPLY_STAMP)
@@ -0,0 +1,235 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+#pragma once
+
+#include <algorithm>
+#if __has_include(<filesystem>)
+#include <filesystem>
+namespace fs = std::filesystem;
+#else
+#include <experimental/filesystem>
+namespace fs = std::experimental::filesystem;
+#endif
+#include <fstream>
+
+#include <fmt/format.h>
+
+#include "common/misc/client_environment_helpers.hpp"
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+// counts the calls to the given function in the trace log, and the launches of get_array
+// nested in them
+inline void ptr_array_cache_count_launches(const fs::path& filepath,
+                                           const std::string& func,
+                                           int* calls,
+                                           int* launches)
+{
+    std::ifstream logfile(filepath);
+    ASSERT_TRUE(logfile.good()) << "which implies a failure to open " << filepath;
+
+    // names of the functions enclosing the current line, by level of indentation
+    std::vector<std::string> stack;
+    std::string line;
+    *calls = 0;
+    *launches = 0;
+    while(std::getline(logfile, line))
+    {
+        size_t indent = line.find_first_not_of(' ');
+        if(indent == std::string::npos || line.find("trace tree") != std::string::npos)
+            continue;
+
+        std::string name = line.substr(indent, line.find(' ', indent) - indent);
+        stack.resize(std::min(stack.size(), indent / 4));
+        if(name == func)
+            (*calls)++;
+        if(name == "get_array")
+            for(const std::string& s : stack)
+                if(s == func)
+                    (*launches)++;
+        stack.push_back(name);
+    }
+}
+
+/** Factorizes the problems first, ..., first + count - 1 of hA with geqrf_batched (the
+    array of pointers is built on the host) and with geqrf_strided_batched, and compares the
+    results. **/
+template <typename T>
+void ptr_array_cache_getError(const rocblas_handle handle,
+                              const rocblas_int m,
+                              const rocblas_int n,
+                              const rocblas_int lda,
+                              const rocblas_stride stA,
+                              const rocblas_int first,
+                              const rocblas_int count,
+                              device_strided_batch_vector<T>& dA,
+                              device_strided_batch_vector<T>& dR,
+                              device_strided_batch_vector<T>& dTau,
+                              device_strided_batch_vector<T>& dTauR,
+                              device_strided_batch_vector<T*>& dAarr,
+                              host_strided_batch_vector<T>& hA,
+                              double* max_err)
+{
+    rocblas_int bc = hA.batch_count();
+    rocblas_stride stP = n;
+    host_strided_batch_vector<T> hX(stA, 1, stA, bc);
+    host_strided_batch_vector<T> hR(stA, 1, stA, bc);
+    host_strided_batch_vector<T> hTau(stP, 1, stP, bc);
+    host_strided_batch_vector<T> hTauR(stP, 1, stP, bc);
+    host_strided_batch_vector<T*> hAarr(bc, 1, bc, 1);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dR.transfer_from(hA));
+    for(rocblas_int b = 0; b < count; ++b)
+        hAarr[0][b] = dA[first + b];
+    CHECK_HIP_ERROR(dAarr.transfer_from(hAarr));
+
+    CHECK_ROCBLAS_ERROR(rocsolver_geqr2_geqrf(false, true, handle, m, n, dAarr.data(), lda, stA,
+                                              dTau.data(), stP, count));
+    CHECK_ROCBLAS_ERROR(rocsolver_geqr2_geqrf(true, true, handle, m, n, dR[first], lda, stA,
+                                              dTauR.data(), stP, count));
+
+    CHECK_HIP_ERROR(hX.transfer_from(dA));
+    CHECK_HIP_ERROR(hR.transfer_from(dR));
+    CHECK_HIP_ERROR(hTau.transfer_from(dTau));
+    CHECK_HIP_ERROR(hTauR.transfer_from(dTauR));
+
+    // the problems that are not referenced must not change
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        if(b < first || b >= first + count)
+        {
+            *max_err = std::max(*max_err, norm_error('F', m, n, lda, hA[b], hX[b]));
+            continue;
+        }
+        *max_err = std::max(*max_err, norm_error('F', m, n, lda, hR[b], hX[b]));
+        *max_err
+            = std::max(*max_err, norm_error('F', 1, n, 1, hTauR[b - first], hTau[b - first]));
+    }
+}
+
+/** The arrays of pointers to the problems of a strided batch are built once per scope and
+    reused while their content does not change. The "test" argument selects between checking
+    in the trace log that the launches are skipped, and executing with the same workspace
+    (user-managed device memory) on different base pointers and batch sizes. **/
+template <typename T>
+void testing_ptr_array_cache(Arguments& argus)
+{
+    // get arguments
+    rocblas_local_handle handle;
+    std::string test = argus.get<std::string>("test");
+    rocblas_int m = argus.get<rocblas_int>("m");
+    rocblas_int n = argus.get<rocblas_int>("n", m);
+    rocblas_int lda = m;
+    rocblas_stride stA = lda * n;
+    rocblas_stride stP = n;
+    rocblas_int bc = argus.batch_count;
+    double max_error = 0, err;
+
+    // memory allocations
+    host_strided_batch_vector<T> hA(stA, 1, stA, bc);
+    device_strided_batch_vector<T> dA(stA, 1, stA, bc);
+    device_strided_batch_vector<T> dR(stA, 1, stA, bc);
+    device_strided_batch_vector<T> dTau(stP, 1, stP, bc);
+    device_strided_batch_vector<T> dTauR(stP, 1, stP, bc);
+    device_strided_batch_vector<T*> dAarr(bc, 1, bc, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dR.memcheck());
+    CHECK_HIP_ERROR(dTau.memcheck());
+    CHECK_HIP_ERROR(dTauR.memcheck());
+    CHECK_HIP_ERROR(dAarr.memcheck());
+
+    rocblas_init<T>(hA, true);
+
+    if(test == "launches_skipped")
+    {
+        const ::testing::TestInfo* info = ::testing::UnitTest::GetInstance()->current_test_info();
+        std::string name = fmt::format("{}.{}", info->test_suite_name(), info->name());
+        std::replace(name.begin(), name.end(), '/', '_');
+        fs::path log_filepath = fs::temp_directory_path() / fmt::format("{}.log", name);
+
+        {
+            scoped_envvar logpath_variable("ROCSOLVER_LOG_TRACE_PATH",
+                                           log_filepath.generic_string().c_str());
+            CHECK_ROCBLAS_ERROR(rocsolver_log_begin());
+            CHECK_ROCBLAS_ERROR(rocsolver_log_set_layer_mode(rocblas_layer_mode_log_trace
+                                                             | rocblas_layer_mode_ex_log_kernel));
+            CHECK_ROCBLAS_ERROR(rocsolver_log_set_max_levels(16));
+            ptr_array_cache_getError<T>(handle, m, n, lda, stA, 0, bc, dA, dR, dTau, dTauR, dAarr,
+                                        hA, &max_error);
+            CHECK_ROCBLAS_ERROR(rocsolver_log_end());
+        }
+
+        // the pointers to the triangular factor are built once for the whole factorization
+        int calls, launches;
+        ptr_array_cache_count_launches(log_filepath, "rocsolver_larft_template", &calls,
+                                       &launches);
+        EXPECT_GT(calls, 1);
+        EXPECT_EQ(launches, 1);
+
+        // the pointers to the temporary array of LARFB change with its stride, but they are
+        // built once for all the products of each call
+        ptr_array_cache_count_launches(log_filepath, "rocsolver_larfb_template", &calls,
+                                       &launches);
+        EXPECT_GT(calls, 1);
+        EXPECT_LE(launches, calls);
+
+        EXPECT_TRUE(fs::remove(log_filepath));
+    }
+    else if(test == "pointers_change")
+    {
+        // with user-managed device memory, every call gets the same workspace, which holds
+        // the arrays of pointers built in the previous call
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        CHECK_ALLOC_QUERY(rocsolver_geqr2_geqrf(false, true, handle, m, n, dAarr.data(), lda,
+                                                stA, dTau.data(), stP, bc));
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+
+        // different base pointers and batch counts with the same workspace
+        const rocblas_int cases[][2] = {{0, bc}, {1, bc - 1}, {0, bc - 2}, {2, 2}, {0, bc}};
+        for(const auto& c : cases)
+        {
+            ptr_array_cache_getError<T>(handle, m, n, lda, stA, c[0], c[1], dA, dR, dTau, dTauR,
+                                        dAarr, hA, &err);
+            max_error = std::max(max_error, err);
+        }
+    }
+    else
+        FAIL() << "unknown test " << test;
+
+    // validate results
+    ROCSOLVER_TEST_CHECK(T, max_error, m);
+}
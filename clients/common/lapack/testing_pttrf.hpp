@@ -0,0 +1,507 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/lapack_host_reference.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+template <bool INTERLEAVED, typename S, typename T, typename U>
+void pttrf_checkBadArgs(const rocblas_handle handle,
+                        const rocblas_int n,
+                        S dD,
+                        const rocblas_int incd,
+                        const rocblas_stride stD,
+                        T dE,
+                        const rocblas_int ince,
+                        const rocblas_stride stE,
+                        U dInfo,
+                        const rocblas_int bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_pttrf(INTERLEAVED, nullptr, n, dD, incd, stD, dE, ince, stE,
+                                          dInfo, bc),
+                          rocblas_status_invalid_handle);
+
+    // values
+    // N/A
+
+    // sizes
+    EXPECT_ROCBLAS_STATUS(rocsolver_pttrf(INTERLEAVED, handle, n, dD, incd, stD, dE, ince, stE,
+                                          dInfo, -1),
+                          rocblas_status_invalid_size);
+    if(INTERLEAVED)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_pttrf(INTERLEAVED, handle, n, dD, 0, stD, dE, ince, stE,
+                                              dInfo, bc),
+                              rocblas_status_invalid_size);
+        EXPECT_ROCBLAS_STATUS(rocsolver_pttrf(INTERLEAVED, handle, n, dD, incd, stD, dE, 0, stE,
+                                              dInfo, bc),
+                              rocblas_status_invalid_size);
+    }
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_pttrf(INTERLEAVED, handle, n, (S) nullptr, incd, stD, dE, ince,
+                                          stE, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_pttrf(INTERLEAVED, handle, n, dD, incd, stD, (T) nullptr, ince,
+                                          stE, dInfo, bc),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_pttrf(INTERLEAVED, handle, n, dD, incd, stD, dE, ince, stE,
+                                          (U) nullptr, bc),
+                          rocblas_status_invalid_pointer);
+
+    // quick return with invalid pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_pttrf(INTERLEAVED, handle, 0, (S) nullptr, incd, stD,
+                                          (T) nullptr, ince, stE, dInfo, bc),
+                          rocblas_status_success);
+
+    // with a single equation there are no off-diagonal elements
+    EXPECT_ROCBLAS_STATUS(rocsolver_pttrf(INTERLEAVED, handle, 1, dD, incd, stD, (T) nullptr, ince,
+                                          stE, dInfo, bc),
+                          rocblas_status_success);
+
+    // quick return with zero batch_count
+    EXPECT_ROCBLAS_STATUS(rocsolver_pttrf(INTERLEAVED, handle, n, dD, incd, stD, dE, ince, stE,
+                                          (U) nullptr, 0),
+                          rocblas_status_success);
+}
+
+template <bool INTERLEAVED, typename T>
+void testing_pttrf_bad_arg()
+{
+    using S = decltype(std::real(T{}));
+
+    // safe arguments
+    rocblas_local_handle handle;
+    rocblas_int n = 2;
+    rocblas_int incd = 1;
+    rocblas_int ince = 1;
+    rocblas_stride stD = 2;
+    rocblas_stride stE = 2;
+    rocblas_int bc = 1;
+
+    // memory allocations
+    device_strided_batch_vector<S> dD(1, 1, 1, 1);
+    device_strided_batch_vector<T> dE(1, 1, 1, 1);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dD.memcheck());
+    CHECK_HIP_ERROR(dE.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // check bad arguments
+    pttrf_checkBadArgs<INTERLEAVED>(handle, n, dD.data(), incd, stD, dE.data(), ince, stE,
+                                    dInfo.data(), bc);
+}
+
+template <bool CPU, bool GPU, typename T, typename Sd, typename Td, typename Sh, typename Th>
+void pttrf_initData(const rocblas_handle handle,
+                    const rocblas_int n,
+                    Sd& dD,
+                    const rocblas_int incd,
+                    const rocblas_stride stD,
+                    Td& dE,
+                    const rocblas_int ince,
+                    const rocblas_stride stE,
+                    const rocblas_int bc,
+                    Sh& hD,
+                    Th& hE,
+                    const bool singular)
+{
+    if(CPU)
+    {
+        using S = decltype(std::real(T{}));
+
+        rocblas_init<S>(hD, true);
+        rocblas_init<T>(hE, false);
+
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            S* D = hD[0] + b * stD;
+
+            // scale to avoid singularities
+            // leaving the matrices diagonally dominant so that they are positive definite
+            for(rocblas_int i = 0; i < n; i++)
+                D[i * incd] += 400;
+
+            if(singular && (b == bc / 4 || b == bc / 2 || b == bc - 1))
+            {
+                // When required, add some indefiniteness
+                // (always the same elements for debugging purposes)
+                rocblas_int j = n / 2 + b;
+                j -= (j / n) * n;
+
+                // the leading minor of order j+1 is not positive definite
+                D[j * incd] = -D[j * incd];
+            }
+        }
+    }
+
+    // now copy data to the GPU
+    if(GPU)
+    {
+        CHECK_HIP_ERROR(dD.transfer_from(hD));
+        CHECK_HIP_ERROR(dE.transfer_from(hE));
+    }
+}
+
+template <bool INTERLEAVED,
+          typename T,
+          typename Sd,
+          typename Td,
+          typename Ud,
+          typename Sh,
+          typename Th,
+          typename Uh>
+void pttrf_getError(const rocblas_handle handle,
+                    const rocblas_int n,
+                    Sd& dD,
+                    const rocblas_int incd,
+                    const rocblas_stride stD,
+                    Td& dE,
+                    const rocblas_int ince,
+                    const rocblas_stride stE,
+                    Ud& dInfo,
+                    const rocblas_int bc,
+                    Sh& hD,
+                    Sh& hDRes,
+                    Th& hE,
+                    Th& hERes,
+                    Uh& hInfo,
+                    Uh& hInfoRes,
+                    double* max_err,
+                    const bool singular)
+{
+    using S = decltype(std::real(T{}));
+    std::vector<S> D(n), DRes(n);
+    std::vector<T> E(n), ERes(n);
+
+    // input data initialization
+    pttrf_initData<true, true, T>(handle, n, dD, incd, stD, dE, ince, stE, bc, hD, hE, singular);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(rocsolver_pttrf(INTERLEAVED, handle, n, dD.data(), incd, stD, dE.data(),
+                                        ince, stE, dInfo.data(), bc));
+    CHECK_HIP_ERROR(hDRes.transfer_from(dD));
+    CHECK_HIP_ERROR(hERes.transfer_from(dE));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // CPU lapack
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        // gather the b-th system
+        for(rocblas_int i = 0; i < n; i++)
+        {
+            D[i] = hD[0][i * incd + b * stD];
+            E[i] = hE[0][i * ince + b * stE];
+            DRes[i] = hDRes[0][i * incd + b * stD];
+            ERes[i] = hERes[0][i * ince + b * stE];
+        }
+
+        cpu_pttrf(n, D.data(), E.data(), hInfo[b]);
+
+        // error is ||D - DRes|| / ||D|| and ||E - ERes|| / ||E||
+        // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+        // IT MIGHT BE REVISITED IN THE FUTURE)
+        // using frobenius norm
+        // (the factorization is not completed for non positive definite matrices)
+        if(hInfo[b][0] == 0)
+        {
+            err = norm_error('F', 1, n, 1, D.data(), DRes.data());
+            *max_err = err > *max_err ? err : *max_err;
+            if(n > 1)
+            {
+                err = norm_error('F', 1, n - 1, 1, E.data(), ERes.data());
+                *max_err = err > *max_err ? err : *max_err;
+            }
+        }
+    }
+
+    // also check info for non positive definite cases
+    err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        EXPECT_EQ(hInfo[b][0], hInfoRes[b][0]) << "where b = " << b;
+        if(hInfo[b][0] != hInfoRes[b][0])
+            err++;
+    }
+    *max_err += err;
+}
+
+template <bool INTERLEAVED,
+          typename T,
+          typename Sd,
+          typename Td,
+          typename Ud,
+          typename Sh,
+          typename Th,
+          typename Uh>
+void pttrf_getPerfData(const rocblas_handle handle,
+                       const rocblas_int n,
+                       Sd& dD,
+                       const rocblas_int incd,
+                       const rocblas_stride stD,
+                       Td& dE,
+                       const rocblas_int ince,
+                       const rocblas_stride stE,
+                       Ud& dInfo,
+                       const rocblas_int bc,
+                       Sh& hD,
+                       Th& hE,
+                       Uh& hInfo,
+                       double* gpu_time_used,
+                       double* cpu_time_used,
+                       const rocblas_int hot_calls,
+                       const int profile,
+                       const bool profile_kernels,
+                       const bool perf,
+                       const bool singular)
+{
+    if(!perf)
+    {
+        using S = decltype(std::real(T{}));
+        std::vector<S> D(n);
+        std::vector<T> E(n);
+
+        pttrf_initData<true, false, T>(handle, n, dD, incd, stD, dE, ince, stE, bc, hD, hE,
+                                       singular);
+
+        // cpu-lapack performance (only if not in perf mode)
+        // (the systems are gathered out of the timed region)
+        *cpu_time_used = 0;
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            for(rocblas_int i = 0; i < n; i++)
+            {
+                D[i] = hD[0][i * incd + b * stD];
+                E[i] = hE[0][i * ince + b * stE];
+            }
+
+            double start = get_time_us_no_sync();
+            cpu_pttrf(n, D.data(), E.data(), hInfo[b]);
+            *cpu_time_used += get_time_us_no_sync() - start;
+        }
+    }
+
+    pttrf_initData<true, false, T>(handle, n, dD, incd, stD, dE, ince, stE, bc, hD, hE, singular);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        pttrf_initData<false, true, T>(handle, n, dD, incd, stD, dE, ince, stE, bc, hD, hE,
+                                       singular);
+
+        CHECK_ROCBLAS_ERROR(rocsolver_pttrf(INTERLEAVED, handle, n, dD.data(), incd, stD, dE.data(),
+                                            ince, stE, dInfo.data(), bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    double start;
+
+    if(profile > 0)
+    {
+        if(profile_kernels)
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile
+                                         | rocblas_layer_mode_ex_log_kernel);
+        else
+            rocsolver_log_set_layer_mode(rocblas_layer_mode_log_profile);
+        rocsolver_log_set_max_levels(profile);
+    }
+
+    for(rocblas_int iter = 0; iter < hot_calls; iter++)
+    {
+        pttrf_initData<false, true, T>(handle, n, dD, incd, stD, dE, ince, stE, bc, hD, hE,
+                                       singular);
+
+        start = get_time_us_sync(stream);
+        rocsolver_pttrf(INTERLEAVED, handle, n, dD.data(), incd, stD, dE.data(), ince, stE,
+                        dInfo.data(), bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <bool INTERLEAVED, typename T>
+void testing_pttrf(Arguments& argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    rocblas_local_handle handle;
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int bc = argus.batch_count;
+    rocblas_int incd = INTERLEAVED ? argus.get<rocblas_int>("incd", bc) : 1;
+    rocblas_int ince = INTERLEAVED ? argus.get<rocblas_int>("ince", bc) : 1;
+    rocblas_stride stD = argus.get<rocblas_stride>("strideD", INTERLEAVED ? 1 : n);
+    rocblas_stride stE = argus.get<rocblas_stride>("strideE", INTERLEAVED ? 1 : n);
+
+    rocblas_int hot_calls = argus.iters;
+
+    // check non-supported values
+    // N/A
+
+    // determine sizes
+    size_t size_D = (n > 0 && bc > 0) ? size_t(incd) * (n - 1) + stD * (bc - 1) + 1 : 0;
+    size_t size_E = (n > 0 && bc > 0) ? size_t(ince) * (n - 1) + stE * (bc - 1) + 1 : 0;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_DRes = (argus.unit_check || argus.norm_check) ? size_D : 0;
+    size_t size_ERes = (argus.unit_check || argus.norm_check) ? size_E : 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || bc < 0 || incd < 1 || ince < 1);
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_pttrf(INTERLEAVED, handle, n, (S*)nullptr, incd, stD,
+                                              (T*)nullptr, ince, stE, (rocblas_int*)nullptr, bc),
+                              rocblas_status_invalid_size);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    if(argus.mem_query || !USE_ROCBLAS_REALLOC_ON_DEMAND)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+        CHECK_ALLOC_QUERY(rocsolver_pttrf(INTERLEAVED, handle, n, (S*)nullptr, incd, stD,
+                                          (T*)nullptr, ince, stE, (rocblas_int*)nullptr, bc));
+
+        size_t size;
+        CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform_mem_query(handle, size, argus.mem_query > 1);
+            return;
+        }
+
+        CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size));
+    }
+
+    // memory allocations
+    host_strided_batch_vector<S> hD(size_D, 1, size_D, 1);
+    host_strided_batch_vector<S> hDRes(size_DRes, 1, size_DRes, 1);
+    host_strided_batch_vector<T> hE(size_E, 1, size_E, 1);
+    host_strided_batch_vector<T> hERes(size_ERes, 1, size_ERes, 1);
+    host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hInfoRes(1, 1, 1, bc);
+    device_strided_batch_vector<S> dD(size_D, 1, size_D, 1);
+    device_strided_batch_vector<T> dE(size_E, 1, size_E, 1);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+    if(size_D)
+        CHECK_HIP_ERROR(dD.memcheck());
+    if(size_E)
+        CHECK_HIP_ERROR(dE.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    // check quick return
+    if(n == 0 || bc == 0)
+    {
+        EXPECT_ROCBLAS_STATUS(rocsolver_pttrf(INTERLEAVED, handle, n, dD.data(), incd, stD,
+                                              dE.data(), ince, stE, dInfo.data(), bc),
+                              rocblas_status_success);
+        if(argus.timing)
+            rocsolver_bench_inform(inform_quick_return);
+
+        return;
+    }
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        pttrf_getError<INTERLEAVED, T>(handle, n, dD, incd, stD, dE, ince, stE, dInfo, bc, hD,
+                                       hDRes, hE, hERes, hInfo, hInfoRes, &max_error,
+                                       argus.singular);
+
+    // collect performance data
+    if(argus.timing)
+        pttrf_getPerfData<INTERLEAVED, T>(handle, n, dD, incd, stD, dE, ince, stE, dInfo, bc, hD,
+                                          hE, hInfo, &gpu_time_used, &cpu_time_used, hot_calls,
+                                          argus.profile, argus.profile_kernels, argus.perf,
+                                          argus.singular);
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            rocsolver_bench_header("Arguments:");
+            if(INTERLEAVED)
+            {
+                rocsolver_bench_output("n", "incd", "strideD", "ince", "strideE", "batch_c");
+                rocsolver_bench_output(n, incd, stD, ince, stE, bc);
+            }
+            else
+            {
+                rocsolver_bench_output("n", "strideD", "strideE", "batch_c");
+                rocsolver_bench_output(n, stD, stE, bc);
+            }
+            rocsolver_bench_header("Results:");
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time_us", "gpu_time_us");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            rocsolver_bench_endl();
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
+
+#define EXTERN_TESTING_PTTRF(...) extern template void testing_pttrf<__VA_ARGS__>(Arguments&);
+
+INSTANTIATE(EXTERN_TESTING_PTTRF, FOREACH_INTERLEAVED_DATA_LAYOUT, FOREACH_SCALAR_TYPE, APPLY_STAMP)
@@ -0,0 +1,263 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+#pragma once
+
+#include "common/misc/client_util.hpp"
+#include "common/misc/clientcommon.hpp"
+#include "common/misc/norm.hpp"
+#include "common/misc/rocsolver.hpp"
+#include "common/misc/rocsolver_arguments.hpp"
+#include "common/misc/rocsolver_test.hpp"
+
+inline void testing_workspace_budget_bad_arg()
+{
+    rocblas_local_handle handle;
+    size_t size = 1;
+
+    // handle
+    EXPECT_ROCBLAS_STATUS(rocsolver_set_workspace_budget(nullptr, 1000),
+                          rocblas_status_invalid_handle);
+    EXPECT_ROCBLAS_STATUS(rocsolver_get_workspace_budget(nullptr, &size),
+                          rocblas_status_invalid_handle);
+
+    // pointers
+    EXPECT_ROCBLAS_STATUS(rocsolver_get_workspace_budget(handle, nullptr),
+                          rocblas_status_invalid_pointer);
+
+    // no budget by default
+    CHECK_ROCBLAS_ERROR(rocsolver_get_workspace_budget(handle, &size));
+    EXPECT_EQ(size, 0);
+
+    CHECK_ROCBLAS_ERROR(rocsolver_set_workspace_budget(handle, 1000));
+    CHECK_ROCBLAS_ERROR(rocsolver_get_workspace_budget(handle, &size));
+    EXPECT_EQ(size, 1000);
+
+    // releasing the resources restores the defaults
+    CHECK_ROCBLAS_ERROR(rocsolver_release_handle_resources(handle));
+    CHECK_ROCBLAS_ERROR(rocsolver_get_workspace_budget(handle, &size));
+    EXPECT_EQ(size, 0);
+}
+
+template <typename T, typename Th>
+void workspace_budget_initData(Th& hA, const rocblas_int n, const rocblas_int lda)
+{
+    rocblas_init<T>(hA, true);
+
+    // make the matrices diagonally dominant and Hermitian, so that they are well
+    // conditioned for the factorizations and the eigensolver
+    for(rocblas_int b = 0; b < hA.batch_count(); ++b)
+    {
+        for(rocblas_int i = 0; i < n; i++)
+        {
+            for(rocblas_int j = 0; j < i; j++)
+                hA[b][j + i * lda] = sconj(hA[b][i + j * lda]);
+            hA[b][i + i * lda] = std::real(hA[b][i + i * lda]) + 400;
+        }
+    }
+}
+
+/** Executes the function given by the "function" argument on the whole batch with the
+    memory managed by rocBLAS, and then with a fixed device memory that only fits half of
+    the batch. Without a workspace budget the second execution must fail, and with it the batch
+    must be split in chunks that produce the same results. **/
+template <bool STRIDED, typename T, typename Td, typename Th>
+void workspace_budget_getError(const rocblas_handle handle,
+                               const std::string function,
+                               const rocblas_int n,
+                               Td& dA,
+                               const rocblas_int lda,
+                               const rocblas_stride stA,
+                               const rocblas_int bc,
+                               Th& hA,
+                               Th& hR,
+                               Th& hRb,
+                               double* max_err)
+{
+    using S = decltype(std::real(T{}));
+    rocblas_stride stP = n;
+
+    // memory allocations
+    host_strided_batch_vector<T> hTau(stP, 1, stP, bc);
+    host_strided_batch_vector<T> hTaub(stP, 1, stP, bc);
+    host_strided_batch_vector<S> hD(stP, 1, stP, bc);
+    host_strided_batch_vector<S> hDb(stP, 1, stP, bc);
+    host_strided_batch_vector<rocblas_int> hIpiv(stP, 1, stP, bc);
+    host_strided_batch_vector<rocblas_int> hIpivb(stP, 1, stP, bc);
+    host_strided_batch_vector<rocblas_int> hInfo(1, 1, 1, bc);
+    host_strided_batch_vector<rocblas_int> hInfob(1, 1, 1, bc);
+    device_strided_batch_vector<T> dTau(stP, 1, stP, bc);
+    device_strided_batch_vector<S> dD(stP, 1, stP, bc);
+    device_strided_batch_vector<S> dE(stP, 1, stP, bc);
+    device_strided_batch_vector<rocblas_int> dIpiv(stP, 1, stP, bc);
+    device_strided_batch_vector<rocblas_int> dInfo(1, 1, 1, bc);
+    CHECK_HIP_ERROR(dTau.memcheck());
+    CHECK_HIP_ERROR(dD.memcheck());
+    CHECK_HIP_ERROR(dE.memcheck());
+    CHECK_HIP_ERROR(dIpiv.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    auto run = [&](const rocblas_int count) {
+        if(function == "getrf")
+            return rocsolver_getf2_getrf(STRIDED, true, handle, n, n, dA.data(), lda, stA,
+                                         dIpiv.data(), stP, dInfo.data(), count);
+        else if(function == "geqrf")
+            return rocsolver_geqr2_geqrf(STRIDED, true, handle, n, n, dA.data(), lda, stA,
+                                         dTau.data(), stP, count);
+        else
+            return rocsolver_syevd_heevd(STRIDED, handle, rocblas_evect_original,
+                                         rocblas_fill_lower, n, dA.data(), lda, stA, dD.data(),
+                                         stP, dE.data(), stP, dInfo.data(), count);
+    };
+
+    auto execute = [&](Th& hRes, host_strided_batch_vector<T>& hTauRes,
+                       host_strided_batch_vector<S>& hDRes,
+                       host_strided_batch_vector<rocblas_int>& hIpivRes,
+                       host_strided_batch_vector<rocblas_int>& hInfoRes) {
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        // (geqrf does not write info)
+        CHECK_HIP_ERROR(hipMemset(dInfo.data(), 0, sizeof(rocblas_int) * bc));
+        CHECK_ROCBLAS_ERROR(run(bc));
+        CHECK_HIP_ERROR(hRes.transfer_from(dA));
+        CHECK_HIP_ERROR(hTauRes.transfer_from(dTau));
+        CHECK_HIP_ERROR(hDRes.transfer_from(dD));
+        CHECK_HIP_ERROR(hIpivRes.transfer_from(dIpiv));
+        CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+    };
+
+    // reference execution
+    execute(hR, hTau, hD, hIpiv, hInfo);
+
+    // workspace sizes for the whole batch and for half of it
+    size_t size, size_half;
+    CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+    CHECK_ALLOC_QUERY(run(bc));
+    CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size));
+    CHECK_ROCBLAS_ERROR(rocblas_start_device_memory_size_query(handle));
+    CHECK_ALLOC_QUERY(run(bc / 2));
+    CHECK_ROCBLAS_ERROR(rocblas_stop_device_memory_size_query(handle, &size_half));
+    ASSERT_LT(size_half, size);
+
+    // a fixed device memory that does not fit the whole batch is not enough
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+    CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, size_half));
+    EXPECT_ROCBLAS_STATUS(run(bc), rocblas_status_memory_error);
+
+    // unless the batch is split in chunks
+    CHECK_ROCBLAS_ERROR(rocsolver_set_workspace_budget(handle, SIZE_MAX));
+    CHECK_HIP_ERROR(hipMemset(dInfo.data(), -1, sizeof(rocblas_int) * bc));
+    execute(hRb, hTaub, hDb, hIpivb, hInfob);
+
+    // the memory size has not changed
+    CHECK_ROCBLAS_ERROR(rocblas_get_device_memory_size(handle, &size));
+    EXPECT_EQ(size, size_half);
+
+    // the pivots and info must coincide, and the results must coincide up to round-off
+    double err;
+    *max_err = 0;
+    for(rocblas_int b = 0; b < bc; ++b)
+    {
+        EXPECT_EQ(hInfo[b][0], 0) << "where b = " << b;
+        EXPECT_EQ(hInfob[b][0], hInfo[b][0]) << "where b = " << b;
+
+        if(function == "getrf")
+        {
+            for(rocblas_int i = 0; i < n; i++)
+                EXPECT_EQ(hIpivb[b][i], hIpiv[b][i]) << "where b = " << b << ", i = " << i;
+            err = norm_error('F', n, n, lda, hR[b], hRb[b]);
+        }
+        else if(function == "geqrf")
+        {
+            err = norm_error('F', n, n, lda, hR[b], hRb[b]);
+            *max_err = std::max(*max_err, norm_error('F', 1, n, 1, hTau[b], hTaub[b]));
+        }
+        else
+            err = norm_error('F', 1, n, 1, hD[b], hDb[b]);
+        *max_err = std::max(*max_err, err);
+    }
+
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+    CHECK_ROCBLAS_ERROR(rocblas_set_device_memory_size(handle, 0));
+    CHECK_ROCBLAS_ERROR(rocsolver_set_workspace_budget(handle, 0));
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void testing_workspace_budget(Arguments& argus)
+{
+    // the device memory of the handle is set by the test
+    if(char* envvar = getenv("ROCBLAS_DEVICE_MEMORY_SIZE"))
+        GTEST_SKIP() << "Cannot execute in dirty environment; ROCBLAS_DEVICE_MEMORY_SIZE="
+                     << envvar;
+
+    // get arguments
+    rocblas_local_handle handle;
+    std::string function = argus.get<std::string>("function");
+    rocblas_int n = argus.get<rocblas_int>("n");
+    rocblas_int lda = n;
+    rocblas_stride stA = lda * n;
+    rocblas_int bc = argus.batch_count;
+    double max_error = 0;
+
+    if(function != "getrf" && function != "geqrf" && function != "syevd_heevd")
+        FAIL() << "unknown function " << function;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T> hA(stA, 1, bc);
+        host_batch_vector<T> hR(stA, 1, bc);
+        host_batch_vector<T> hRb(stA, 1, bc);
+        device_batch_vector<T> dA(stA, 1, bc);
+        CHECK_HIP_ERROR(dA.memcheck());
+
+        workspace_budget_initData<T>(hA, n, lda);
+
+        // check computations
+        workspace_budget_getError<STRIDED, T>(handle, function, n, dA, lda, stA, bc, hA, hR, hRb,
+                                              &max_error);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T> hA(stA, 1, stA, bc);
+        host_strided_batch_vector<T> hR(stA, 1, stA, bc);
+        host_strided_batch_vector<T> hRb(stA, 1, stA, bc);
+        device_strided_batch_vector<T> dA(stA, 1, stA, bc);
+        CHECK_HIP_ERROR(dA.memcheck());
+
+        workspace_budget_initData<T>(hA, n, lda);
+
+        // check computations
+        workspace_budget_getError<STRIDED, T>(handle, function, n, dA, lda, stA, bc, hA, hR, hRb,
+                                              &max_error);
+    }
+
+    // validate results
+    ROCSOLVER_TEST_CHECK(T, max_error, n);
+}
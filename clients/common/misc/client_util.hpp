@@ -70,10 +70,19 @@
     F(STAMP, ##__VA_ARGS__, double)                \
     F(STAMP, ##__VA_ARGS__, rocblas_float_complex) \
     F(STAMP, ##__VA_ARGS__, rocblas_double_complex)
+/* Layouts are (BATCHED, STRIDED): single, batched and strided_batched */
 #define FOREACH_MATRIX_DATA_LAYOUT(STAMP, F, ...) \
-    F(STAMP, ##__VA_ARGS__, false, false) // single  \
-    F(STAMP, ##__VA_ARGS__, true, true)   // batched \
-    F(STAMP, ##__VA_ARGS__, false, true)  // strided_batched
+    F(STAMP, ##__VA_ARGS__, false, false)         \
+    F(STAMP, ##__VA_ARGS__, true, true)           \
+    F(STAMP, ##__VA_ARGS__, false, true)
+/* For functions that only have batched and strided_batched versions */
+#define FOREACH_BATCHED_DATA_LAYOUT(STAMP, F, ...) \
+    F(STAMP, ##__VA_ARGS__, true, true)            \
+    F(STAMP, ##__VA_ARGS__, false, true)
+/* For functions that only have strided_batched (false) and interleaved_batched (true) versions */
+#define FOREACH_INTERLEAVED_DATA_LAYOUT(STAMP, F, ...) \
+    F(STAMP, ##__VA_ARGS__, false)                     \
+    F(STAMP, ##__VA_ARGS__, true)
 
 /*  This macro is not strictly necessary. It's does the same thing as any of the FOREACH
     functions, but it doesn't append any values. It exists as the top-level function of the
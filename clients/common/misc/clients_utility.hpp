@@ -30,6 +30,7 @@
 #include <cstdio>
 #include <iostream>
 #include <rocblas/rocblas.h>
+#include <rocsolver/rocsolver.h>
 #include <string>
 #include <type_traits>
 #include <vector>
@@ -67,6 +68,8 @@ public:
     }
     ~rocblas_local_handle()
     {
+        // the configuration kept by rocSOLVER must not outlive the handle
+        rocsolver_release_handle_resources(m_handle);
         rocblas_destroy_handle(m_handle);
     }
 
@@ -86,6 +89,75 @@ public:
     }
 };
 
+/* ============================================================================================
+ */
+/*! \brief  local stream which is automatically destroyed, e.g. to be set as the stream of a
+    handle that is captured into a HIP graph (the default stream cannot be captured) */
+class rocblas_local_stream
+{
+    hipStream_t m_stream;
+    hipError_t m_status;
+
+public:
+    rocblas_local_stream()
+        : m_stream(nullptr)
+        , m_status(hipStreamCreate(&m_stream))
+    {
+    }
+    ~rocblas_local_stream()
+    {
+        if(m_status == hipSuccess)
+            (void)hipStreamDestroy(m_stream);
+    }
+
+    rocblas_local_stream(const rocblas_local_stream&) = delete;
+    rocblas_local_stream(rocblas_local_stream&&) = delete;
+    rocblas_local_stream& operator=(const rocblas_local_stream&) = delete;
+    rocblas_local_stream& operator=(rocblas_local_stream&&) = delete;
+
+    operator hipStream_t() const
+    {
+        return m_stream;
+    }
+
+    // to be checked like the memcheck of the host and device vectors
+    hipError_t memcheck() const
+    {
+        return m_status;
+    }
+};
+
+/*! \brief  host memory which is pinned (page-locked) while the object is alive, so that the
+    functions working on host arrays can overlap their transfers with the computations */
+class rocblas_local_pinned_host
+{
+    void* m_ptr;
+    hipError_t m_status;
+
+public:
+    rocblas_local_pinned_host(void* ptr, size_t bytes)
+        : m_ptr(bytes ? ptr : nullptr)
+        , m_status(m_ptr ? hipHostRegister(m_ptr, bytes, hipHostRegisterDefault) : hipSuccess)
+    {
+    }
+    ~rocblas_local_pinned_host()
+    {
+        if(m_ptr && m_status == hipSuccess)
+            (void)hipHostUnregister(m_ptr);
+    }
+
+    rocblas_local_pinned_host(const rocblas_local_pinned_host&) = delete;
+    rocblas_local_pinned_host(rocblas_local_pinned_host&&) = delete;
+    rocblas_local_pinned_host& operator=(const rocblas_local_pinned_host&) = delete;
+    rocblas_local_pinned_host& operator=(rocblas_local_pinned_host&&) = delete;
+
+    // to be checked like the memcheck of the host and device vectors
+    hipError_t memcheck() const
+    {
+        return m_status;
+    }
+};
+
 /* ============================================================================================
  */
 /*  device query and print out their ID and name */
@@ -504,6 +504,250 @@ void zgesv_(int* n,
             int* ldb,
             int* info);
 
+void sgbtrf_(int* m, int* n, int* kl, int* ku, float* A, int* lda, int* ipiv, int* info);
+void dgbtrf_(int* m, int* n, int* kl, int* ku, double* A, int* lda, int* ipiv, int* info);
+void cgbtrf_(int* m,
+             int* n,
+             int* kl,
+             int* ku,
+             rocblas_float_complex* A,
+             int* lda,
+             int* ipiv,
+             int* info);
+void zgbtrf_(int* m,
+             int* n,
+             int* kl,
+             int* ku,
+             rocblas_double_complex* A,
+             int* lda,
+             int* ipiv,
+             int* info);
+
+void sgbtrs_(char* trans,
+             int* n,
+             int* kl,
+             int* ku,
+             int* nrhs,
+             float* A,
+             int* lda,
+             int* ipiv,
+             float* B,
+             int* ldb,
+             int* info);
+void dgbtrs_(char* trans,
+             int* n,
+             int* kl,
+             int* ku,
+             int* nrhs,
+             double* A,
+             int* lda,
+             int* ipiv,
+             double* B,
+             int* ldb,
+             int* info);
+void cgbtrs_(char* trans,
+             int* n,
+             int* kl,
+             int* ku,
+             int* nrhs,
+             rocblas_float_complex* A,
+             int* lda,
+             int* ipiv,
+             rocblas_float_complex* B,
+             int* ldb,
+             int* info);
+void zgbtrs_(char* trans,
+             int* n,
+             int* kl,
+             int* ku,
+             int* nrhs,
+             rocblas_double_complex* A,
+             int* lda,
+             int* ipiv,
+             rocblas_double_complex* B,
+             int* ldb,
+             int* info);
+
+void sgbsv_(int* n,
+            int* kl,
+            int* ku,
+            int* nrhs,
+            float* A,
+            int* lda,
+            int* ipiv,
+            float* B,
+            int* ldb,
+            int* info);
+void dgbsv_(int* n,
+            int* kl,
+            int* ku,
+            int* nrhs,
+            double* A,
+            int* lda,
+            int* ipiv,
+            double* B,
+            int* ldb,
+            int* info);
+void cgbsv_(int* n,
+            int* kl,
+            int* ku,
+            int* nrhs,
+            rocblas_float_complex* A,
+            int* lda,
+            int* ipiv,
+            rocblas_float_complex* B,
+            int* ldb,
+            int* info);
+void zgbsv_(int* n,
+            int* kl,
+            int* ku,
+            int* nrhs,
+            rocblas_double_complex* A,
+            int* lda,
+            int* ipiv,
+            rocblas_double_complex* B,
+            int* ldb,
+            int* info);
+
+void spbtrf_(char* uplo, int* n, int* kd, float* A, int* lda, int* info);
+void dpbtrf_(char* uplo, int* n, int* kd, double* A, int* lda, int* info);
+void cpbtrf_(char* uplo, int* n, int* kd, rocblas_float_complex* A, int* lda, int* info);
+void zpbtrf_(char* uplo, int* n, int* kd, rocblas_double_complex* A, int* lda, int* info);
+
+void spbtrs_(char* uplo,
+             int* n,
+             int* kd,
+             int* nrhs,
+             float* A,
+             int* lda,
+             float* B,
+             int* ldb,
+             int* info);
+void dpbtrs_(char* uplo,
+             int* n,
+             int* kd,
+             int* nrhs,
+             double* A,
+             int* lda,
+             double* B,
+             int* ldb,
+             int* info);
+void cpbtrs_(char* uplo,
+             int* n,
+             int* kd,
+             int* nrhs,
+             rocblas_float_complex* A,
+             int* lda,
+             rocblas_float_complex* B,
+             int* ldb,
+             int* info);
+void zpbtrs_(char* uplo,
+             int* n,
+             int* kd,
+             int* nrhs,
+             rocblas_double_complex* A,
+             int* lda,
+             rocblas_double_complex* B,
+             int* ldb,
+             int* info);
+
+void spbsv_(char* uplo,
+            int* n,
+            int* kd,
+            int* nrhs,
+            float* A,
+            int* lda,
+            float* B,
+            int* ldb,
+            int* info);
+void dpbsv_(char* uplo,
+            int* n,
+            int* kd,
+            int* nrhs,
+            double* A,
+            int* lda,
+            double* B,
+            int* ldb,
+            int* info);
+void cpbsv_(char* uplo,
+            int* n,
+            int* kd,
+            int* nrhs,
+            rocblas_float_complex* A,
+            int* lda,
+            rocblas_float_complex* B,
+            int* ldb,
+            int* info);
+void zpbsv_(char* uplo,
+            int* n,
+            int* kd,
+            int* nrhs,
+            rocblas_double_complex* A,
+            int* lda,
+            rocblas_double_complex* B,
+            int* ldb,
+            int* info);
+
+void sgtsv_(int* n, int* nrhs, float* dl, float* d, float* du, float* B, int* ldb, int* info);
+void dgtsv_(int* n, int* nrhs, double* dl, double* d, double* du, double* B, int* ldb, int* info);
+void cgtsv_(int* n,
+            int* nrhs,
+            rocblas_float_complex* dl,
+            rocblas_float_complex* d,
+            rocblas_float_complex* du,
+            rocblas_float_complex* B,
+            int* ldb,
+            int* info);
+void zgtsv_(int* n,
+            int* nrhs,
+            rocblas_double_complex* dl,
+            rocblas_double_complex* d,
+            rocblas_double_complex* du,
+            rocblas_double_complex* B,
+            int* ldb,
+            int* info);
+
+void spttrf_(int* n, float* D, float* E, int* info);
+void dpttrf_(int* n, double* D, double* E, int* info);
+void cpttrf_(int* n, float* D, rocblas_float_complex* E, int* info);
+void zpttrf_(int* n, double* D, rocblas_double_complex* E, int* info);
+
+void spttrs_(int* n, int* nrhs, float* D, float* E, float* B, int* ldb, int* info);
+void dpttrs_(int* n, int* nrhs, double* D, double* E, double* B, int* ldb, int* info);
+void cpttrs_(char* uplo,
+             int* n,
+             int* nrhs,
+             float* D,
+             rocblas_float_complex* E,
+             rocblas_float_complex* B,
+             int* ldb,
+             int* info);
+void zpttrs_(char* uplo,
+             int* n,
+             int* nrhs,
+             double* D,
+             rocblas_double_complex* E,
+             rocblas_double_complex* B,
+             int* ldb,
+             int* info);
+
+void sptsv_(int* n, int* nrhs, float* D, float* E, float* B, int* ldb, int* info);
+void dptsv_(int* n, int* nrhs, double* D, double* E, double* B, int* ldb, int* info);
+void cptsv_(int* n,
+            int* nrhs,
+            float* D,
+            rocblas_float_complex* E,
+            rocblas_float_complex* B,
+            int* ldb,
+            int* info);
+void zptsv_(int* n,
+            int* nrhs,
+            double* D,
+            rocblas_double_complex* E,
+            rocblas_double_complex* B,
+            int* ldb,
+            int* info);
+
 void sgels_(char* trans,
             int* m,
             int* n,
@@ -549,6 +793,100 @@ void zgels_(char* trans,
             int* lwork,
             int* info);
 
+void sgeqp3_(int* m,
+             int* n,
+             float* A,
+             int* lda,
+             int* jpvt,
+             float* ipiv,
+             float* work,
+             int* lwork,
+             int* info);
+void dgeqp3_(int* m,
+             int* n,
+             double* A,
+             int* lda,
+             int* jpvt,
+             double* ipiv,
+             double* work,
+             int* lwork,
+             int* info);
+void cgeqp3_(int* m,
+             int* n,
+             rocblas_float_complex* A,
+             int* lda,
+             int* jpvt,
+             rocblas_float_complex* ipiv,
+             rocblas_float_complex* work,
+             int* lwork,
+             float* rwork,
+             int* info);
+void zgeqp3_(int* m,
+             int* n,
+             rocblas_double_complex* A,
+             int* lda,
+             int* jpvt,
+             rocblas_double_complex* ipiv,
+             rocblas_double_complex* work,
+             int* lwork,
+             double* rwork,
+             int* info);
+
+void sgelsy_(int* m,
+             int* n,
+             int* nrhs,
+             float* A,
+             int* lda,
+             float* B,
+             int* ldb,
+             int* jpvt,
+             float* rcond,
+             int* rank,
+             float* work,
+             int* lwork,
+             int* info);
+void dgelsy_(int* m,
+             int* n,
+             int* nrhs,
+             double* A,
+             int* lda,
+             double* B,
+             int* ldb,
+             int* jpvt,
+             double* rcond,
+             int* rank,
+             double* work,
+             int* lwork,
+             int* info);
+void cgelsy_(int* m,
+             int* n,
+             int* nrhs,
+             rocblas_float_complex* A,
+             int* lda,
+             rocblas_float_complex* B,
+             int* ldb,
+             int* jpvt,
+             float* rcond,
+             int* rank,
+             rocblas_float_complex* work,
+             int* lwork,
+             float* rwork,
+             int* info);
+void zgelsy_(int* m,
+             int* n,
+             int* nrhs,
+             rocblas_double_complex* A,
+             int* lda,
+             rocblas_double_complex* B,
+             int* ldb,
+             int* jpvt,
+             double* rcond,
+             int* rank,
+             rocblas_double_complex* work,
+             int* lwork,
+             double* rwork,
+             int* info);
+
 void sgetri_(int* n, float* A, int* lda, int* ipiv, float* work, int* lwork, int* info);
 void dgetri_(int* n, double* A, int* lda, int* ipiv, double* work, int* lwork, int* info);
 void cgetri_(int* n,
@@ -5655,21 +5993,561 @@ void cpu_gesv<rocblas_double_complex>(rocblas_int n,
     zgesv_(&n, &nrhs, A, &lda, ipiv, B, &ldb, info);
 }
 
-// gels
+// gbtrf
 template <>
-void cpu_gels<float>(rocblas_operation transR,
-                     rocblas_int m,
-                     rocblas_int n,
-                     rocblas_int nrhs,
-                     float* A,
-                     rocblas_int lda,
-                     float* B,
-                     rocblas_int ldb,
-                     float* work,
-                     rocblas_int lwork,
-                     rocblas_int* info)
+void cpu_gbtrf<float>(rocblas_int m,
+                      rocblas_int n,
+                      rocblas_int kl,
+                      rocblas_int ku,
+                      float* A,
+                      rocblas_int lda,
+                      rocblas_int* ipiv,
+                      rocblas_int* info)
 {
-    char trans = rocblas2char_operation(transR);
+    sgbtrf_(&m, &n, &kl, &ku, A, &lda, ipiv, info);
+}
+
+template <>
+void cpu_gbtrf<double>(rocblas_int m,
+                       rocblas_int n,
+                       rocblas_int kl,
+                       rocblas_int ku,
+                       double* A,
+                       rocblas_int lda,
+                       rocblas_int* ipiv,
+                       rocblas_int* info)
+{
+    dgbtrf_(&m, &n, &kl, &ku, A, &lda, ipiv, info);
+}
+
+template <>
+void cpu_gbtrf<rocblas_float_complex>(rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_int* ipiv,
+                                      rocblas_int* info)
+{
+    cgbtrf_(&m, &n, &kl, &ku, A, &lda, ipiv, info);
+}
+
+template <>
+void cpu_gbtrf<rocblas_double_complex>(rocblas_int m,
+                                       rocblas_int n,
+                                       rocblas_int kl,
+                                       rocblas_int ku,
+                                       rocblas_double_complex* A,
+                                       rocblas_int lda,
+                                       rocblas_int* ipiv,
+                                       rocblas_int* info)
+{
+    zgbtrf_(&m, &n, &kl, &ku, A, &lda, ipiv, info);
+}
+
+// gbtrs
+template <>
+void cpu_gbtrs<float>(rocblas_operation trans,
+                      rocblas_int n,
+                      rocblas_int kl,
+                      rocblas_int ku,
+                      rocblas_int nrhs,
+                      float* A,
+                      rocblas_int lda,
+                      rocblas_int* ipiv,
+                      float* B,
+                      rocblas_int ldb)
+{
+    rocblas_int info;
+    char transC = rocblas2char_operation(trans);
+    sgbtrs_(&transC, &n, &kl, &ku, &nrhs, A, &lda, ipiv, B, &ldb, &info);
+}
+
+template <>
+void cpu_gbtrs<double>(rocblas_operation trans,
+                       rocblas_int n,
+                       rocblas_int kl,
+                       rocblas_int ku,
+                       rocblas_int nrhs,
+                       double* A,
+                       rocblas_int lda,
+                       rocblas_int* ipiv,
+                       double* B,
+                       rocblas_int ldb)
+{
+    rocblas_int info;
+    char transC = rocblas2char_operation(trans);
+    dgbtrs_(&transC, &n, &kl, &ku, &nrhs, A, &lda, ipiv, B, &ldb, &info);
+}
+
+template <>
+void cpu_gbtrs<rocblas_float_complex>(rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_int* ipiv,
+                                      rocblas_float_complex* B,
+                                      rocblas_int ldb)
+{
+    rocblas_int info;
+    char transC = rocblas2char_operation(trans);
+    cgbtrs_(&transC, &n, &kl, &ku, &nrhs, A, &lda, ipiv, B, &ldb, &info);
+}
+
+template <>
+void cpu_gbtrs<rocblas_double_complex>(rocblas_operation trans,
+                                       rocblas_int n,
+                                       rocblas_int kl,
+                                       rocblas_int ku,
+                                       rocblas_int nrhs,
+                                       rocblas_double_complex* A,
+                                       rocblas_int lda,
+                                       rocblas_int* ipiv,
+                                       rocblas_double_complex* B,
+                                       rocblas_int ldb)
+{
+    rocblas_int info;
+    char transC = rocblas2char_operation(trans);
+    zgbtrs_(&transC, &n, &kl, &ku, &nrhs, A, &lda, ipiv, B, &ldb, &info);
+}
+
+// gbsv
+template <>
+void cpu_gbsv<float>(rocblas_int n,
+                     rocblas_int kl,
+                     rocblas_int ku,
+                     rocblas_int nrhs,
+                     float* A,
+                     rocblas_int lda,
+                     rocblas_int* ipiv,
+                     float* B,
+                     rocblas_int ldb,
+                     rocblas_int* info)
+{
+    sgbsv_(&n, &kl, &ku, &nrhs, A, &lda, ipiv, B, &ldb, info);
+}
+
+template <>
+void cpu_gbsv<double>(rocblas_int n,
+                      rocblas_int kl,
+                      rocblas_int ku,
+                      rocblas_int nrhs,
+                      double* A,
+                      rocblas_int lda,
+                      rocblas_int* ipiv,
+                      double* B,
+                      rocblas_int ldb,
+                      rocblas_int* info)
+{
+    dgbsv_(&n, &kl, &ku, &nrhs, A, &lda, ipiv, B, &ldb, info);
+}
+
+template <>
+void cpu_gbsv<rocblas_float_complex>(rocblas_int n,
+                                     rocblas_int kl,
+                                     rocblas_int ku,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* A,
+                                     rocblas_int lda,
+                                     rocblas_int* ipiv,
+                                     rocblas_float_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_int* info)
+{
+    cgbsv_(&n, &kl, &ku, &nrhs, A, &lda, ipiv, B, &ldb, info);
+}
+
+template <>
+void cpu_gbsv<rocblas_double_complex>(rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_int* ipiv,
+                                      rocblas_double_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_int* info)
+{
+    zgbsv_(&n, &kl, &ku, &nrhs, A, &lda, ipiv, B, &ldb, info);
+}
+
+// pbtrf
+template <>
+void cpu_pbtrf<float>(rocblas_fill uplo,
+                      rocblas_int n,
+                      rocblas_int kd,
+                      float* A,
+                      rocblas_int lda,
+                      rocblas_int* info)
+{
+    char uploC = rocblas2char_fill(uplo);
+    spbtrf_(&uploC, &n, &kd, A, &lda, info);
+}
+
+template <>
+void cpu_pbtrf<double>(rocblas_fill uplo,
+                       rocblas_int n,
+                       rocblas_int kd,
+                       double* A,
+                       rocblas_int lda,
+                       rocblas_int* info)
+{
+    char uploC = rocblas2char_fill(uplo);
+    dpbtrf_(&uploC, &n, &kd, A, &lda, info);
+}
+
+template <>
+void cpu_pbtrf<rocblas_float_complex>(rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int kd,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_int* info)
+{
+    char uploC = rocblas2char_fill(uplo);
+    cpbtrf_(&uploC, &n, &kd, A, &lda, info);
+}
+
+template <>
+void cpu_pbtrf<rocblas_double_complex>(rocblas_fill uplo,
+                                       rocblas_int n,
+                                       rocblas_int kd,
+                                       rocblas_double_complex* A,
+                                       rocblas_int lda,
+                                       rocblas_int* info)
+{
+    char uploC = rocblas2char_fill(uplo);
+    zpbtrf_(&uploC, &n, &kd, A, &lda, info);
+}
+
+// pbtrs
+template <>
+void cpu_pbtrs<float>(rocblas_fill uplo,
+                      rocblas_int n,
+                      rocblas_int kd,
+                      rocblas_int nrhs,
+                      float* A,
+                      rocblas_int lda,
+                      float* B,
+                      rocblas_int ldb)
+{
+    rocblas_int info;
+    char uploC = rocblas2char_fill(uplo);
+    spbtrs_(&uploC, &n, &kd, &nrhs, A, &lda, B, &ldb, &info);
+}
+
+template <>
+void cpu_pbtrs<double>(rocblas_fill uplo,
+                       rocblas_int n,
+                       rocblas_int kd,
+                       rocblas_int nrhs,
+                       double* A,
+                       rocblas_int lda,
+                       double* B,
+                       rocblas_int ldb)
+{
+    rocblas_int info;
+    char uploC = rocblas2char_fill(uplo);
+    dpbtrs_(&uploC, &n, &kd, &nrhs, A, &lda, B, &ldb, &info);
+}
+
+template <>
+void cpu_pbtrs<rocblas_float_complex>(rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int kd,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_float_complex* B,
+                                      rocblas_int ldb)
+{
+    rocblas_int info;
+    char uploC = rocblas2char_fill(uplo);
+    cpbtrs_(&uploC, &n, &kd, &nrhs, A, &lda, B, &ldb, &info);
+}
+
+template <>
+void cpu_pbtrs<rocblas_double_complex>(rocblas_fill uplo,
+                                       rocblas_int n,
+                                       rocblas_int kd,
+                                       rocblas_int nrhs,
+                                       rocblas_double_complex* A,
+                                       rocblas_int lda,
+                                       rocblas_double_complex* B,
+                                       rocblas_int ldb)
+{
+    rocblas_int info;
+    char uploC = rocblas2char_fill(uplo);
+    zpbtrs_(&uploC, &n, &kd, &nrhs, A, &lda, B, &ldb, &info);
+}
+
+// pbsv
+template <>
+void cpu_pbsv<float>(rocblas_fill uplo,
+                     rocblas_int n,
+                     rocblas_int kd,
+                     rocblas_int nrhs,
+                     float* A,
+                     rocblas_int lda,
+                     float* B,
+                     rocblas_int ldb,
+                     rocblas_int* info)
+{
+    char uploC = rocblas2char_fill(uplo);
+    spbsv_(&uploC, &n, &kd, &nrhs, A, &lda, B, &ldb, info);
+}
+
+template <>
+void cpu_pbsv<double>(rocblas_fill uplo,
+                      rocblas_int n,
+                      rocblas_int kd,
+                      rocblas_int nrhs,
+                      double* A,
+                      rocblas_int lda,
+                      double* B,
+                      rocblas_int ldb,
+                      rocblas_int* info)
+{
+    char uploC = rocblas2char_fill(uplo);
+    dpbsv_(&uploC, &n, &kd, &nrhs, A, &lda, B, &ldb, info);
+}
+
+template <>
+void cpu_pbsv<rocblas_float_complex>(rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int kd,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* A,
+                                     rocblas_int lda,
+                                     rocblas_float_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_int* info)
+{
+    char uploC = rocblas2char_fill(uplo);
+    cpbsv_(&uploC, &n, &kd, &nrhs, A, &lda, B, &ldb, info);
+}
+
+template <>
+void cpu_pbsv<rocblas_double_complex>(rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int kd,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_double_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_int* info)
+{
+    char uploC = rocblas2char_fill(uplo);
+    zpbsv_(&uploC, &n, &kd, &nrhs, A, &lda, B, &ldb, info);
+}
+
+// gtsv
+template <>
+void cpu_gtsv<float>(rocblas_int n,
+                     rocblas_int nrhs,
+                     float* dl,
+                     float* d,
+                     float* du,
+                     float* B,
+                     rocblas_int ldb,
+                     rocblas_int* info)
+{
+    sgtsv_(&n, &nrhs, dl, d, du, B, &ldb, info);
+}
+
+template <>
+void cpu_gtsv<double>(rocblas_int n,
+                      rocblas_int nrhs,
+                      double* dl,
+                      double* d,
+                      double* du,
+                      double* B,
+                      rocblas_int ldb,
+                      rocblas_int* info)
+{
+    dgtsv_(&n, &nrhs, dl, d, du, B, &ldb, info);
+}
+
+template <>
+void cpu_gtsv<rocblas_float_complex>(rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* dl,
+                                     rocblas_float_complex* d,
+                                     rocblas_float_complex* du,
+                                     rocblas_float_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_int* info)
+{
+    cgtsv_(&n, &nrhs, dl, d, du, B, &ldb, info);
+}
+
+template <>
+void cpu_gtsv<rocblas_double_complex>(rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* dl,
+                                      rocblas_double_complex* d,
+                                      rocblas_double_complex* du,
+                                      rocblas_double_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_int* info)
+{
+    zgtsv_(&n, &nrhs, dl, d, du, B, &ldb, info);
+}
+
+// pttrf
+template <>
+void cpu_pttrf<float, float>(rocblas_int n, float* D, float* E, rocblas_int* info)
+{
+    spttrf_(&n, D, E, info);
+}
+
+template <>
+void cpu_pttrf<double, double>(rocblas_int n, double* D, double* E, rocblas_int* info)
+{
+    dpttrf_(&n, D, E, info);
+}
+
+template <>
+void cpu_pttrf<rocblas_float_complex, float>(rocblas_int n,
+                                             float* D,
+                                             rocblas_float_complex* E,
+                                             rocblas_int* info)
+{
+    cpttrf_(&n, D, E, info);
+}
+
+template <>
+void cpu_pttrf<rocblas_double_complex, double>(rocblas_int n,
+                                               double* D,
+                                               rocblas_double_complex* E,
+                                               rocblas_int* info)
+{
+    zpttrf_(&n, D, E, info);
+}
+
+// pttrs
+template <>
+void cpu_pttrs<float, float>(rocblas_int n,
+                             rocblas_int nrhs,
+                             float* D,
+                             float* E,
+                             float* B,
+                             rocblas_int ldb)
+{
+    int info;
+    spttrs_(&n, &nrhs, D, E, B, &ldb, &info);
+}
+
+template <>
+void cpu_pttrs<double, double>(rocblas_int n,
+                               rocblas_int nrhs,
+                               double* D,
+                               double* E,
+                               double* B,
+                               rocblas_int ldb)
+{
+    int info;
+    dpttrs_(&n, &nrhs, D, E, B, &ldb, &info);
+}
+
+template <>
+void cpu_pttrs<rocblas_float_complex, float>(rocblas_int n,
+                                             rocblas_int nrhs,
+                                             float* D,
+                                             rocblas_float_complex* E,
+                                             rocblas_float_complex* B,
+                                             rocblas_int ldb)
+{
+    // E contains the sub-diagonal of the unit lower bidiagonal factor L
+    char uplo = 'L';
+    int info;
+    cpttrs_(&uplo, &n, &nrhs, D, E, B, &ldb, &info);
+}
+
+template <>
+void cpu_pttrs<rocblas_double_complex, double>(rocblas_int n,
+                                               rocblas_int nrhs,
+                                               double* D,
+                                               rocblas_double_complex* E,
+                                               rocblas_double_complex* B,
+                                               rocblas_int ldb)
+{
+    // E contains the sub-diagonal of the unit lower bidiagonal factor L
+    char uplo = 'L';
+    int info;
+    zpttrs_(&uplo, &n, &nrhs, D, E, B, &ldb, &info);
+}
+
+// ptsv
+template <>
+void cpu_ptsv<float, float>(rocblas_int n,
+                            rocblas_int nrhs,
+                            float* D,
+                            float* E,
+                            float* B,
+                            rocblas_int ldb,
+                            rocblas_int* info)
+{
+    sptsv_(&n, &nrhs, D, E, B, &ldb, info);
+}
+
+template <>
+void cpu_ptsv<double, double>(rocblas_int n,
+                              rocblas_int nrhs,
+                              double* D,
+                              double* E,
+                              double* B,
+                              rocblas_int ldb,
+                              rocblas_int* info)
+{
+    dptsv_(&n, &nrhs, D, E, B, &ldb, info);
+}
+
+template <>
+void cpu_ptsv<rocblas_float_complex, float>(rocblas_int n,
+                                            rocblas_int nrhs,
+                                            float* D,
+                                            rocblas_float_complex* E,
+                                            rocblas_float_complex* B,
+                                            rocblas_int ldb,
+                                            rocblas_int* info)
+{
+    cptsv_(&n, &nrhs, D, E, B, &ldb, info);
+}
+
+template <>
+void cpu_ptsv<rocblas_double_complex, double>(rocblas_int n,
+                                              rocblas_int nrhs,
+                                              double* D,
+                                              rocblas_double_complex* E,
+                                              rocblas_double_complex* B,
+                                              rocblas_int ldb,
+                                              rocblas_int* info)
+{
+    zptsv_(&n, &nrhs, D, E, B, &ldb, info);
+}
+
+// gels
+template <>
+void cpu_gels<float>(rocblas_operation transR,
+                     rocblas_int m,
+                     rocblas_int n,
+                     rocblas_int nrhs,
+                     float* A,
+                     rocblas_int lda,
+                     float* B,
+                     rocblas_int ldb,
+                     float* work,
+                     rocblas_int lwork,
+                     rocblas_int* info)
+{
+    char trans = rocblas2char_operation(transR);
     sgels_(&trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
 }
 
@@ -5724,6 +6602,144 @@ void cpu_gels<rocblas_double_complex>(rocblas_operation transR,
     zgels_(&trans, &m, &n, &nrhs, A, &lda, B, &ldb, work, &lwork, info);
 }
 
+// geqp3
+template <>
+void cpu_geqp3<float, float>(rocblas_int m,
+                             rocblas_int n,
+                             float* A,
+                             rocblas_int lda,
+                             rocblas_int* jpvt,
+                             float* ipiv,
+                             float* work,
+                             rocblas_int lwork,
+                             float* rwork,
+                             rocblas_int* info)
+{
+    sgeqp3_(&m, &n, A, &lda, jpvt, ipiv, work, &lwork, info);
+}
+
+template <>
+void cpu_geqp3<double, double>(rocblas_int m,
+                               rocblas_int n,
+                               double* A,
+                               rocblas_int lda,
+                               rocblas_int* jpvt,
+                               double* ipiv,
+                               double* work,
+                               rocblas_int lwork,
+                               double* rwork,
+                               rocblas_int* info)
+{
+    dgeqp3_(&m, &n, A, &lda, jpvt, ipiv, work, &lwork, info);
+}
+
+template <>
+void cpu_geqp3<rocblas_float_complex, float>(rocblas_int m,
+                                             rocblas_int n,
+                                             rocblas_float_complex* A,
+                                             rocblas_int lda,
+                                             rocblas_int* jpvt,
+                                             rocblas_float_complex* ipiv,
+                                             rocblas_float_complex* work,
+                                             rocblas_int lwork,
+                                             float* rwork,
+                                             rocblas_int* info)
+{
+    cgeqp3_(&m, &n, A, &lda, jpvt, ipiv, work, &lwork, rwork, info);
+}
+
+template <>
+void cpu_geqp3<rocblas_double_complex, double>(rocblas_int m,
+                                               rocblas_int n,
+                                               rocblas_double_complex* A,
+                                               rocblas_int lda,
+                                               rocblas_int* jpvt,
+                                               rocblas_double_complex* ipiv,
+                                               rocblas_double_complex* work,
+                                               rocblas_int lwork,
+                                               double* rwork,
+                                               rocblas_int* info)
+{
+    zgeqp3_(&m, &n, A, &lda, jpvt, ipiv, work, &lwork, rwork, info);
+}
+
+// gelsy
+template <>
+void cpu_gelsy<float, float>(rocblas_int m,
+                             rocblas_int n,
+                             rocblas_int nrhs,
+                             float* A,
+                             rocblas_int lda,
+                             float* B,
+                             rocblas_int ldb,
+                             rocblas_int* jpvt,
+                             float rcond,
+                             rocblas_int* rank,
+                             float* work,
+                             rocblas_int lwork,
+                             float* rwork,
+                             rocblas_int* info)
+{
+    sgelsy_(&m, &n, &nrhs, A, &lda, B, &ldb, jpvt, &rcond, rank, work, &lwork, info);
+}
+
+template <>
+void cpu_gelsy<double, double>(rocblas_int m,
+                               rocblas_int n,
+                               rocblas_int nrhs,
+                               double* A,
+                               rocblas_int lda,
+                               double* B,
+                               rocblas_int ldb,
+                               rocblas_int* jpvt,
+                               double rcond,
+                               rocblas_int* rank,
+                               double* work,
+                               rocblas_int lwork,
+                               double* rwork,
+                               rocblas_int* info)
+{
+    dgelsy_(&m, &n, &nrhs, A, &lda, B, &ldb, jpvt, &rcond, rank, work, &lwork, info);
+}
+
+template <>
+void cpu_gelsy<rocblas_float_complex, float>(rocblas_int m,
+                                             rocblas_int n,
+                                             rocblas_int nrhs,
+                                             rocblas_float_complex* A,
+                                             rocblas_int lda,
+                                             rocblas_float_complex* B,
+                                             rocblas_int ldb,
+                                             rocblas_int* jpvt,
+                                             float rcond,
+                                             rocblas_int* rank,
+                                             rocblas_float_complex* work,
+                                             rocblas_int lwork,
+                                             float* rwork,
+                                             rocblas_int* info)
+{
+    cgelsy_(&m, &n, &nrhs, A, &lda, B, &ldb, jpvt, &rcond, rank, work, &lwork, rwork, info);
+}
+
+template <>
+void cpu_gelsy<rocblas_double_complex, double>(rocblas_int m,
+                                               rocblas_int n,
+                                               rocblas_int nrhs,
+                                               rocblas_double_complex* A,
+                                               rocblas_int lda,
+                                               rocblas_double_complex* B,
+                                               rocblas_int ldb,
+                                               rocblas_int* jpvt,
+                                               double rcond,
+                                               rocblas_int* rank,
+                                               rocblas_double_complex* work,
+                                               rocblas_int lwork,
+                                               double* rwork,
+                                               rocblas_int* info)
+{
+    zgelsy_(&m, &n, &nrhs, A, &lda, B, &ldb, jpvt, &rcond, rank, work, &lwork, rwork, info);
+}
+
 // trtri
 template <>
 void cpu_trtri<float>(rocblas_fill uplo,
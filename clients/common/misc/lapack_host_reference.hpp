@@ -225,6 +225,94 @@ void cpu_gesv(rocblas_int n,
               rocblas_int ldb,
               rocblas_int* info);
 
+template <typename T>
+void cpu_gbtrf(rocblas_int m,
+               rocblas_int n,
+               rocblas_int kl,
+               rocblas_int ku,
+               T* A,
+               rocblas_int lda,
+               rocblas_int* ipiv,
+               rocblas_int* info);
+
+template <typename T>
+void cpu_gbtrs(rocblas_operation trans,
+               rocblas_int n,
+               rocblas_int kl,
+               rocblas_int ku,
+               rocblas_int nrhs,
+               T* A,
+               rocblas_int lda,
+               rocblas_int* ipiv,
+               T* B,
+               rocblas_int ldb);
+
+template <typename T>
+void cpu_gbsv(rocblas_int n,
+              rocblas_int kl,
+              rocblas_int ku,
+              rocblas_int nrhs,
+              T* A,
+              rocblas_int lda,
+              rocblas_int* ipiv,
+              T* B,
+              rocblas_int ldb,
+              rocblas_int* info);
+
+template <typename T>
+void cpu_pbtrf(rocblas_fill uplo,
+               rocblas_int n,
+               rocblas_int kd,
+               T* A,
+               rocblas_int lda,
+               rocblas_int* info);
+
+template <typename T>
+void cpu_pbtrs(rocblas_fill uplo,
+               rocblas_int n,
+               rocblas_int kd,
+               rocblas_int nrhs,
+               T* A,
+               rocblas_int lda,
+               T* B,
+               rocblas_int ldb);
+
+template <typename T>
+void cpu_pbsv(rocblas_fill uplo,
+              rocblas_int n,
+              rocblas_int kd,
+              rocblas_int nrhs,
+              T* A,
+              rocblas_int lda,
+              T* B,
+              rocblas_int ldb,
+              rocblas_int* info);
+
+template <typename T>
+void cpu_gtsv(rocblas_int n,
+              rocblas_int nrhs,
+              T* dl,
+              T* d,
+              T* du,
+              T* B,
+              rocblas_int ldb,
+              rocblas_int* info);
+
+template <typename T, typename S>
+void cpu_pttrf(rocblas_int n, S* D, T* E, rocblas_int* info);
+
+template <typename T, typename S>
+void cpu_pttrs(rocblas_int n, rocblas_int nrhs, S* D, T* E, T* B, rocblas_int ldb);
+
+template <typename T, typename S>
+void cpu_ptsv(rocblas_int n,
+              rocblas_int nrhs,
+              S* D,
+              T* E,
+              T* B,
+              rocblas_int ldb,
+              rocblas_int* info);
+
 template <typename T>
 void cpu_gels(rocblas_operation transR,
               rocblas_int m,
@@ -238,6 +326,34 @@ void cpu_gels(rocblas_operation transR,
               rocblas_int lwork,
               rocblas_int* info);
 
+template <typename T, typename W>
+void cpu_geqp3(rocblas_int m,
+               rocblas_int n,
+               T* A,
+               rocblas_int lda,
+               rocblas_int* jpvt,
+               T* ipiv,
+               T* work,
+               rocblas_int lwork,
+               W* rwork,
+               rocblas_int* info);
+
+template <typename T, typename W>
+void cpu_gelsy(rocblas_int m,
+               rocblas_int n,
+               rocblas_int nrhs,
+               T* A,
+               rocblas_int lda,
+               T* B,
+               rocblas_int ldb,
+               rocblas_int* jpvt,
+               W rcond,
+               rocblas_int* rank,
+               T* work,
+               rocblas_int lwork,
+               W* rwork,
+               rocblas_int* info);
+
 template <typename T>
 void cpu_getri(rocblas_int n,
                T* A,
@@ -1432,6 +1432,100 @@ inline rocblas_status rocsolver_orgxr_ungxr(bool GQR,
     return GQR ? rocsolver_zungqr(handle, m, n, k, A, lda, Ipiv)
                : rocsolver_zung2r(handle, m, n, k, A, lda, Ipiv);
 }
+
+inline rocblas_status rocsolver_orgxr_ungxr(bool GQR,
+                                            rocblas_handle handle,
+                                            int64_t m,
+                                            int64_t n,
+                                            int64_t k,
+                                            float* A,
+                                            int64_t lda,
+                                            float* Ipiv)
+{
+    return GQR ? rocsolver_sorgqr_64(handle, m, n, k, A, lda, Ipiv)
+               : rocblas_status_not_implemented;
+}
+
+inline rocblas_status rocsolver_orgxr_ungxr(bool GQR,
+                                            rocblas_handle handle,
+                                            int64_t m,
+                                            int64_t n,
+                                            int64_t k,
+                                            double* A,
+                                            int64_t lda,
+                                            double* Ipiv)
+{
+    return GQR ? rocsolver_dorgqr_64(handle, m, n, k, A, lda, Ipiv)
+               : rocblas_status_not_implemented;
+}
+
+inline rocblas_status rocsolver_orgxr_ungxr(bool GQR,
+                                            rocblas_handle handle,
+                                            int64_t m,
+                                            int64_t n,
+                                            int64_t k,
+                                            rocblas_float_complex* A,
+                                            int64_t lda,
+                                            rocblas_float_complex* Ipiv)
+{
+    return GQR ? rocsolver_cungqr_64(handle, m, n, k, A, lda, Ipiv)
+               : rocblas_status_not_implemented;
+}
+
+inline rocblas_status rocsolver_orgxr_ungxr(bool GQR,
+                                            rocblas_handle handle,
+                                            int64_t m,
+                                            int64_t n,
+                                            int64_t k,
+                                            rocblas_double_complex* A,
+                                            int64_t lda,
+                                            rocblas_double_complex* Ipiv)
+{
+    return GQR ? rocsolver_zungqr_64(handle, m, n, k, A, lda, Ipiv)
+               : rocblas_status_not_implemented;
+}
+/***************************************************************/
+
+/******************** ORGQR_UNGQR_TSQR ********************/
+inline rocblas_status rocsolver_orgqr_ungqr_tsqr(rocblas_handle handle,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 float* A,
+                                                 rocblas_int lda,
+                                                 float* Ipiv)
+{
+    return rocsolver_sorgqr_tsqr(handle, m, n, A, lda, Ipiv);
+}
+
+inline rocblas_status rocsolver_orgqr_ungqr_tsqr(rocblas_handle handle,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 double* A,
+                                                 rocblas_int lda,
+                                                 double* Ipiv)
+{
+    return rocsolver_dorgqr_tsqr(handle, m, n, A, lda, Ipiv);
+}
+
+inline rocblas_status rocsolver_orgqr_ungqr_tsqr(rocblas_handle handle,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 rocblas_float_complex* A,
+                                                 rocblas_int lda,
+                                                 rocblas_float_complex* Ipiv)
+{
+    return rocsolver_cungqr_tsqr(handle, m, n, A, lda, Ipiv);
+}
+
+inline rocblas_status rocsolver_orgqr_ungqr_tsqr(rocblas_handle handle,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 rocblas_double_complex* A,
+                                                 rocblas_int lda,
+                                                 rocblas_double_complex* Ipiv)
+{
+    return rocsolver_zungqr_tsqr(handle, m, n, A, lda, Ipiv);
+}
 /***************************************************************/
 
 /******************** ORGLx_UNGLx ********************/
@@ -1702,6 +1796,136 @@ inline rocblas_status rocsolver_ormxr_unmxr(bool MQR,
     return MQR ? rocsolver_zunmqr(handle, side, trans, m, n, k, A, lda, Ipiv, C, ldc)
                : rocsolver_zunm2r(handle, side, trans, m, n, k, A, lda, Ipiv, C, ldc);
 }
+
+inline rocblas_status rocsolver_ormxr_unmxr(bool MQR,
+                                            rocblas_handle handle,
+                                            rocblas_side side,
+                                            rocblas_operation trans,
+                                            int64_t m,
+                                            int64_t n,
+                                            int64_t k,
+                                            float* A,
+                                            int64_t lda,
+                                            float* Ipiv,
+                                            float* C,
+                                            int64_t ldc)
+{
+    return MQR ? rocsolver_sormqr_64(handle, side, trans, m, n, k, A, lda, Ipiv, C, ldc)
+               : rocblas_status_not_implemented;
+}
+
+inline rocblas_status rocsolver_ormxr_unmxr(bool MQR,
+                                            rocblas_handle handle,
+                                            rocblas_side side,
+                                            rocblas_operation trans,
+                                            int64_t m,
+                                            int64_t n,
+                                            int64_t k,
+                                            double* A,
+                                            int64_t lda,
+                                            double* Ipiv,
+                                            double* C,
+                                            int64_t ldc)
+{
+    return MQR ? rocsolver_dormqr_64(handle, side, trans, m, n, k, A, lda, Ipiv, C, ldc)
+               : rocblas_status_not_implemented;
+}
+
+inline rocblas_status rocsolver_ormxr_unmxr(bool MQR,
+                                            rocblas_handle handle,
+                                            rocblas_side side,
+                                            rocblas_operation trans,
+                                            int64_t m,
+                                            int64_t n,
+                                            int64_t k,
+                                            rocblas_float_complex* A,
+                                            int64_t lda,
+                                            rocblas_float_complex* Ipiv,
+                                            rocblas_float_complex* C,
+                                            int64_t ldc)
+{
+    return MQR ? rocsolver_cunmqr_64(handle, side, trans, m, n, k, A, lda, Ipiv, C, ldc)
+               : rocblas_status_not_implemented;
+}
+
+inline rocblas_status rocsolver_ormxr_unmxr(bool MQR,
+                                            rocblas_handle handle,
+                                            rocblas_side side,
+                                            rocblas_operation trans,
+                                            int64_t m,
+                                            int64_t n,
+                                            int64_t k,
+                                            rocblas_double_complex* A,
+                                            int64_t lda,
+                                            rocblas_double_complex* Ipiv,
+                                            rocblas_double_complex* C,
+                                            int64_t ldc)
+{
+    return MQR ? rocsolver_zunmqr_64(handle, side, trans, m, n, k, A, lda, Ipiv, C, ldc)
+               : rocblas_status_not_implemented;
+}
+/***************************************************************/
+
+/******************** ORMQR_UNMQR_TSQR ********************/
+inline rocblas_status rocsolver_ormqr_unmqr_tsqr(rocblas_handle handle,
+                                                 rocblas_side side,
+                                                 rocblas_operation trans,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 rocblas_int k,
+                                                 float* A,
+                                                 rocblas_int lda,
+                                                 float* Ipiv,
+                                                 float* C,
+                                                 rocblas_int ldc)
+{
+    return rocsolver_sormqr_tsqr(handle, side, trans, m, n, k, A, lda, Ipiv, C, ldc);
+}
+
+inline rocblas_status rocsolver_ormqr_unmqr_tsqr(rocblas_handle handle,
+                                                 rocblas_side side,
+                                                 rocblas_operation trans,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 rocblas_int k,
+                                                 double* A,
+                                                 rocblas_int lda,
+                                                 double* Ipiv,
+                                                 double* C,
+                                                 rocblas_int ldc)
+{
+    return rocsolver_dormqr_tsqr(handle, side, trans, m, n, k, A, lda, Ipiv, C, ldc);
+}
+
+inline rocblas_status rocsolver_ormqr_unmqr_tsqr(rocblas_handle handle,
+                                                 rocblas_side side,
+                                                 rocblas_operation trans,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 rocblas_int k,
+                                                 rocblas_float_complex* A,
+                                                 rocblas_int lda,
+                                                 rocblas_float_complex* Ipiv,
+                                                 rocblas_float_complex* C,
+                                                 rocblas_int ldc)
+{
+    return rocsolver_cunmqr_tsqr(handle, side, trans, m, n, k, A, lda, Ipiv, C, ldc);
+}
+
+inline rocblas_status rocsolver_ormqr_unmqr_tsqr(rocblas_handle handle,
+                                                 rocblas_side side,
+                                                 rocblas_operation trans,
+                                                 rocblas_int m,
+                                                 rocblas_int n,
+                                                 rocblas_int k,
+                                                 rocblas_double_complex* A,
+                                                 rocblas_int lda,
+                                                 rocblas_double_complex* Ipiv,
+                                                 rocblas_double_complex* C,
+                                                 rocblas_int ldc)
+{
+    return rocsolver_zunmqr_tsqr(handle, side, trans, m, n, k, A, lda, Ipiv, C, ldc);
+}
 /***************************************************************/
 
 /******************** ORMLx_UNMLx ********************/
@@ -2430,6 +2654,86 @@ inline rocblas_status rocsolver_potf2_potrf(bool STRIDED,
                      : rocsolver_zpotf2(handle, uplo, n, A, lda, info);
 }
 
+inline rocblas_status rocsolver_potf2_potrf(bool STRIDED,
+                                            bool POTRF,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            int64_t n,
+                                            float* A,
+                                            int64_t lda,
+                                            rocblas_stride stA,
+                                            int64_t* info,
+                                            int64_t batch_count)
+{
+    if(!POTRF)
+        return rocblas_status_not_implemented;
+
+    if(STRIDED)
+        return rocsolver_spotrf_strided_batched_64(handle, uplo, n, A, lda, stA, info, batch_count);
+    else
+        return rocsolver_spotrf_64(handle, uplo, n, A, lda, info);
+}
+
+inline rocblas_status rocsolver_potf2_potrf(bool STRIDED,
+                                            bool POTRF,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            int64_t n,
+                                            double* A,
+                                            int64_t lda,
+                                            rocblas_stride stA,
+                                            int64_t* info,
+                                            int64_t batch_count)
+{
+    if(!POTRF)
+        return rocblas_status_not_implemented;
+
+    if(STRIDED)
+        return rocsolver_dpotrf_strided_batched_64(handle, uplo, n, A, lda, stA, info, batch_count);
+    else
+        return rocsolver_dpotrf_64(handle, uplo, n, A, lda, info);
+}
+
+inline rocblas_status rocsolver_potf2_potrf(bool STRIDED,
+                                            bool POTRF,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            int64_t n,
+                                            rocblas_float_complex* A,
+                                            int64_t lda,
+                                            rocblas_stride stA,
+                                            int64_t* info,
+                                            int64_t batch_count)
+{
+    if(!POTRF)
+        return rocblas_status_not_implemented;
+
+    if(STRIDED)
+        return rocsolver_cpotrf_strided_batched_64(handle, uplo, n, A, lda, stA, info, batch_count);
+    else
+        return rocsolver_cpotrf_64(handle, uplo, n, A, lda, info);
+}
+
+inline rocblas_status rocsolver_potf2_potrf(bool STRIDED,
+                                            bool POTRF,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            int64_t n,
+                                            rocblas_double_complex* A,
+                                            int64_t lda,
+                                            rocblas_stride stA,
+                                            int64_t* info,
+                                            int64_t batch_count)
+{
+    if(!POTRF)
+        return rocblas_status_not_implemented;
+
+    if(STRIDED)
+        return rocsolver_zpotrf_strided_batched_64(handle, uplo, n, A, lda, stA, info, batch_count);
+    else
+        return rocsolver_zpotrf_64(handle, uplo, n, A, lda, info);
+}
+
 // batched
 inline rocblas_status rocsolver_potf2_potrf(bool STRIDED,
                                             bool POTRF,
@@ -2490,42 +2794,102 @@ inline rocblas_status rocsolver_potf2_potrf(bool STRIDED,
     return POTRF ? rocsolver_zpotrf_batched(handle, uplo, n, A, lda, info, batch_count)
                  : rocsolver_zpotf2_batched(handle, uplo, n, A, lda, info, batch_count);
 }
-/********************************************************/
 
-/******************** POTRS ********************/
-// normal and strided_batched
-inline rocblas_status rocsolver_potrs(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_fill uplo,
-                                      rocblas_int n,
-                                      rocblas_int nrhs,
-                                      float* A,
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      float* B,
-                                      rocblas_int ldb,
-                                      rocblas_stride stB,
-                                      rocblas_int batch_count)
+inline rocblas_status rocsolver_potf2_potrf(bool STRIDED,
+                                            bool POTRF,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            int64_t n,
+                                            float* const A[],
+                                            int64_t lda,
+                                            rocblas_stride stA,
+                                            int64_t* info,
+                                            int64_t batch_count)
 {
-    if(STRIDED)
-        return rocsolver_spotrs_strided_batched(handle, uplo, n, nrhs, A, lda, stA, B, ldb, stB,
-                                                batch_count);
-    else
-        return rocsolver_spotrs(handle, uplo, n, nrhs, A, lda, B, ldb);
+    return POTRF ? rocsolver_spotrf_batched_64(handle, uplo, n, A, lda, info, batch_count)
+                 : rocblas_status_not_implemented;
 }
 
-inline rocblas_status rocsolver_potrs(bool STRIDED,
-                                      rocblas_handle handle,
-                                      rocblas_fill uplo,
-                                      rocblas_int n,
-                                      rocblas_int nrhs,
-                                      double* A,
-                                      rocblas_int lda,
-                                      rocblas_stride stA,
-                                      double* B,
-                                      rocblas_int ldb,
-                                      rocblas_stride stB,
-                                      rocblas_int batch_count)
+inline rocblas_status rocsolver_potf2_potrf(bool STRIDED,
+                                            bool POTRF,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            int64_t n,
+                                            double* const A[],
+                                            int64_t lda,
+                                            rocblas_stride stA,
+                                            int64_t* info,
+                                            int64_t batch_count)
+{
+    return POTRF ? rocsolver_dpotrf_batched_64(handle, uplo, n, A, lda, info, batch_count)
+                 : rocblas_status_not_implemented;
+}
+
+inline rocblas_status rocsolver_potf2_potrf(bool STRIDED,
+                                            bool POTRF,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            int64_t n,
+                                            rocblas_float_complex* const A[],
+                                            int64_t lda,
+                                            rocblas_stride stA,
+                                            int64_t* info,
+                                            int64_t batch_count)
+{
+    return POTRF ? rocsolver_cpotrf_batched_64(handle, uplo, n, A, lda, info, batch_count)
+                 : rocblas_status_not_implemented;
+}
+
+inline rocblas_status rocsolver_potf2_potrf(bool STRIDED,
+                                            bool POTRF,
+                                            rocblas_handle handle,
+                                            rocblas_fill uplo,
+                                            int64_t n,
+                                            rocblas_double_complex* const A[],
+                                            int64_t lda,
+                                            rocblas_stride stA,
+                                            int64_t* info,
+                                            int64_t batch_count)
+{
+    return POTRF ? rocsolver_zpotrf_batched_64(handle, uplo, n, A, lda, info, batch_count)
+                 : rocblas_status_not_implemented;
+}
+/********************************************************/
+
+/******************** POTRS ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_potrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int batch_count)
+{
+    if(STRIDED)
+        return rocsolver_spotrs_strided_batched(handle, uplo, n, nrhs, A, lda, stA, B, ldb, stB,
+                                                batch_count);
+    else
+        return rocsolver_spotrs(handle, uplo, n, nrhs, A, lda, B, ldb);
+}
+
+inline rocblas_status rocsolver_potrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int batch_count)
 {
     if(STRIDED)
         return rocsolver_dpotrs_strided_batched(handle, uplo, n, nrhs, A, lda, stA, B, ldb, stB,
@@ -2574,6 +2938,86 @@ inline rocblas_status rocsolver_potrs(bool STRIDED,
         return rocsolver_zpotrs(handle, uplo, n, nrhs, A, lda, B, ldb);
 }
 
+inline rocblas_status rocsolver_potrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      int64_t n,
+                                      int64_t nrhs,
+                                      float* A,
+                                      int64_t lda,
+                                      rocblas_stride stA,
+                                      float* B,
+                                      int64_t ldb,
+                                      rocblas_stride stB,
+                                      int64_t batch_count)
+{
+    if(STRIDED)
+        return rocsolver_spotrs_strided_batched_64(handle, uplo, n, nrhs, A, lda, stA, B, ldb, stB,
+                                                   batch_count);
+    else
+        return rocsolver_spotrs_64(handle, uplo, n, nrhs, A, lda, B, ldb);
+}
+
+inline rocblas_status rocsolver_potrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      int64_t n,
+                                      int64_t nrhs,
+                                      double* A,
+                                      int64_t lda,
+                                      rocblas_stride stA,
+                                      double* B,
+                                      int64_t ldb,
+                                      rocblas_stride stB,
+                                      int64_t batch_count)
+{
+    if(STRIDED)
+        return rocsolver_dpotrs_strided_batched_64(handle, uplo, n, nrhs, A, lda, stA, B, ldb, stB,
+                                                   batch_count);
+    else
+        return rocsolver_dpotrs_64(handle, uplo, n, nrhs, A, lda, B, ldb);
+}
+
+inline rocblas_status rocsolver_potrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      int64_t n,
+                                      int64_t nrhs,
+                                      rocblas_float_complex* A,
+                                      int64_t lda,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* B,
+                                      int64_t ldb,
+                                      rocblas_stride stB,
+                                      int64_t batch_count)
+{
+    if(STRIDED)
+        return rocsolver_cpotrs_strided_batched_64(handle, uplo, n, nrhs, A, lda, stA, B, ldb, stB,
+                                                   batch_count);
+    else
+        return rocsolver_cpotrs_64(handle, uplo, n, nrhs, A, lda, B, ldb);
+}
+
+inline rocblas_status rocsolver_potrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      int64_t n,
+                                      int64_t nrhs,
+                                      rocblas_double_complex* A,
+                                      int64_t lda,
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* B,
+                                      int64_t ldb,
+                                      rocblas_stride stB,
+                                      int64_t batch_count)
+{
+    if(STRIDED)
+        return rocsolver_zpotrs_strided_batched_64(handle, uplo, n, nrhs, A, lda, stA, B, ldb, stB,
+                                                   batch_count);
+    else
+        return rocsolver_zpotrs_64(handle, uplo, n, nrhs, A, lda, B, ldb);
+}
+
 // batched
 inline rocblas_status rocsolver_potrs(bool STRIDED,
                                       rocblas_handle handle,
@@ -2638,6 +3082,70 @@ inline rocblas_status rocsolver_potrs(bool STRIDED,
 {
     return rocsolver_zpotrs_batched(handle, uplo, n, nrhs, A, lda, B, ldb, batch_count);
 }
+
+inline rocblas_status rocsolver_potrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      int64_t n,
+                                      int64_t nrhs,
+                                      float* const A[],
+                                      int64_t lda,
+                                      rocblas_stride stA,
+                                      float* const B[],
+                                      int64_t ldb,
+                                      rocblas_stride stB,
+                                      int64_t batch_count)
+{
+    return rocsolver_spotrs_batched_64(handle, uplo, n, nrhs, A, lda, B, ldb, batch_count);
+}
+
+inline rocblas_status rocsolver_potrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      int64_t n,
+                                      int64_t nrhs,
+                                      double* const A[],
+                                      int64_t lda,
+                                      rocblas_stride stA,
+                                      double* const B[],
+                                      int64_t ldb,
+                                      rocblas_stride stB,
+                                      int64_t batch_count)
+{
+    return rocsolver_dpotrs_batched_64(handle, uplo, n, nrhs, A, lda, B, ldb, batch_count);
+}
+
+inline rocblas_status rocsolver_potrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      int64_t n,
+                                      int64_t nrhs,
+                                      rocblas_float_complex* const A[],
+                                      int64_t lda,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* const B[],
+                                      int64_t ldb,
+                                      rocblas_stride stB,
+                                      int64_t batch_count)
+{
+    return rocsolver_cpotrs_batched_64(handle, uplo, n, nrhs, A, lda, B, ldb, batch_count);
+}
+
+inline rocblas_status rocsolver_potrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      int64_t n,
+                                      int64_t nrhs,
+                                      rocblas_double_complex* const A[],
+                                      int64_t lda,
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* const B[],
+                                      int64_t ldb,
+                                      rocblas_stride stB,
+                                      int64_t batch_count)
+{
+    return rocsolver_zpotrs_batched_64(handle, uplo, n, nrhs, A, lda, B, ldb, batch_count);
+}
 /********************************************************/
 
 /******************** POSV ********************/
@@ -2916,6 +3424,114 @@ inline rocblas_status rocsolver_potri(bool STRIDED,
 }
 /********************************************************/
 
+/******************** POTRI_DIRECT ********************/
+// strided_batched
+inline rocblas_status rocsolver_potri_direct(bool STRIDED,
+                                             rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             float* A,
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return rocsolver_spotri_direct_strided_batched(handle, uplo, n, A, lda, stA, info, bc);
+}
+
+inline rocblas_status rocsolver_potri_direct(bool STRIDED,
+                                             rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             double* A,
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return rocsolver_dpotri_direct_strided_batched(handle, uplo, n, A, lda, stA, info, bc);
+}
+
+inline rocblas_status rocsolver_potri_direct(bool STRIDED,
+                                             rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             rocblas_float_complex* A,
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return rocsolver_cpotri_direct_strided_batched(handle, uplo, n, A, lda, stA, info, bc);
+}
+
+inline rocblas_status rocsolver_potri_direct(bool STRIDED,
+                                             rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             rocblas_double_complex* A,
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return rocsolver_zpotri_direct_strided_batched(handle, uplo, n, A, lda, stA, info, bc);
+}
+
+// batched
+inline rocblas_status rocsolver_potri_direct(bool STRIDED,
+                                             rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             float* const A[],
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return rocsolver_spotri_direct_batched(handle, uplo, n, A, lda, info, bc);
+}
+
+inline rocblas_status rocsolver_potri_direct(bool STRIDED,
+                                             rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             double* const A[],
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return rocsolver_dpotri_direct_batched(handle, uplo, n, A, lda, info, bc);
+}
+
+inline rocblas_status rocsolver_potri_direct(bool STRIDED,
+                                             rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             rocblas_float_complex* const A[],
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return rocsolver_cpotri_direct_batched(handle, uplo, n, A, lda, info, bc);
+}
+
+inline rocblas_status rocsolver_potri_direct(bool STRIDED,
+                                             rocblas_handle handle,
+                                             rocblas_fill uplo,
+                                             rocblas_int n,
+                                             rocblas_double_complex* const A[],
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return rocsolver_zpotri_direct_batched(handle, uplo, n, A, lda, info, bc);
+}
+/********************************************************/
+
 /******************** GETF2_GETRF_NPVT ********************/
 // normal and strided_batched
 inline rocblas_status rocsolver_getf2_getrf_npvt(bool STRIDED,
@@ -5415,42 +6031,2504 @@ inline rocblas_status rocsolver_gesv_outofplace(bool STRIDED,
 }
 /********************************************************/
 
-/******************** GETRI_OUTOFPLACE ********************/
-// normal and strided_batched
-inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
-                                                 rocblas_handle handle,
-                                                 rocblas_int n,
-                                                 float* A,
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* ipiv,
-                                                 rocblas_stride stP,
-                                                 float* C,
-                                                 rocblas_int ldc,
-                                                 rocblas_stride stC,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
+/******************** GETRF_RBT ********************/
+// strided_batched
+inline rocblas_status rocsolver_getrf_rbt(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_int n,
+                                          float* A,
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          float* UV,
+                                          rocblas_stride stUV,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
 {
-    return STRIDED ? rocsolver_sgetri_outofplace_strided_batched(handle, n, A, lda, stA, ipiv, stP,
-                                                                 C, ldc, stC, info, bc)
-                   : rocsolver_sgetri_outofplace(handle, n, A, lda, ipiv, C, ldc, info);
+    return rocsolver_sgetrf_rbt_strided_batched(handle, n, A, lda, stA, UV, stUV, info, bc);
 }
 
-inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
-                                                 rocblas_handle handle,
-                                                 rocblas_int n,
-                                                 double* A,
-                                                 rocblas_int lda,
-                                                 rocblas_stride stA,
-                                                 rocblas_int* ipiv,
-                                                 rocblas_stride stP,
-                                                 double* C,
-                                                 rocblas_int ldc,
-                                                 rocblas_stride stC,
-                                                 rocblas_int* info,
-                                                 rocblas_int bc)
+inline rocblas_status rocsolver_getrf_rbt(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_int n,
+                                          double* A,
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          double* UV,
+                                          rocblas_stride stUV,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
 {
-    return STRIDED ? rocsolver_dgetri_outofplace_strided_batched(handle, n, A, lda, stA, ipiv, stP,
+    return rocsolver_dgetrf_rbt_strided_batched(handle, n, A, lda, stA, UV, stUV, info, bc);
+}
+
+inline rocblas_status rocsolver_getrf_rbt(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_int n,
+                                          rocblas_float_complex* A,
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          float* UV,
+                                          rocblas_stride stUV,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    return rocsolver_cgetrf_rbt_strided_batched(handle, n, A, lda, stA, UV, stUV, info, bc);
+}
+
+inline rocblas_status rocsolver_getrf_rbt(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_int n,
+                                          rocblas_double_complex* A,
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          double* UV,
+                                          rocblas_stride stUV,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    return rocsolver_zgetrf_rbt_strided_batched(handle, n, A, lda, stA, UV, stUV, info, bc);
+}
+
+// batched
+inline rocblas_status rocsolver_getrf_rbt(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_int n,
+                                          float* const A[],
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          float* UV,
+                                          rocblas_stride stUV,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    return rocsolver_sgetrf_rbt_batched(handle, n, A, lda, UV, stUV, info, bc);
+}
+
+inline rocblas_status rocsolver_getrf_rbt(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_int n,
+                                          double* const A[],
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          double* UV,
+                                          rocblas_stride stUV,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    return rocsolver_dgetrf_rbt_batched(handle, n, A, lda, UV, stUV, info, bc);
+}
+
+inline rocblas_status rocsolver_getrf_rbt(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_int n,
+                                          rocblas_float_complex* const A[],
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          float* UV,
+                                          rocblas_stride stUV,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    return rocsolver_cgetrf_rbt_batched(handle, n, A, lda, UV, stUV, info, bc);
+}
+
+inline rocblas_status rocsolver_getrf_rbt(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_int n,
+                                          rocblas_double_complex* const A[],
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          double* UV,
+                                          rocblas_stride stUV,
+                                          rocblas_int* info,
+                                          rocblas_int bc)
+{
+    return rocsolver_zgetrf_rbt_batched(handle, n, A, lda, UV, stUV, info, bc);
+}
+/********************************************************/
+
+/******************** GETRS_RBT ********************/
+// strided_batched
+inline rocblas_status rocsolver_getrs_rbt(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_operation trans,
+                                          rocblas_int n,
+                                          rocblas_int nrhs,
+                                          float* A,
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          const float* UV,
+                                          rocblas_stride stUV,
+                                          float* B,
+                                          rocblas_int ldb,
+                                          rocblas_stride stB,
+                                          rocblas_int bc)
+{
+    return rocsolver_sgetrs_rbt_strided_batched(handle, trans, n, nrhs, A, lda, stA, UV, stUV, B,
+                                                ldb, stB, bc);
+}
+
+inline rocblas_status rocsolver_getrs_rbt(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_operation trans,
+                                          rocblas_int n,
+                                          rocblas_int nrhs,
+                                          double* A,
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          const double* UV,
+                                          rocblas_stride stUV,
+                                          double* B,
+                                          rocblas_int ldb,
+                                          rocblas_stride stB,
+                                          rocblas_int bc)
+{
+    return rocsolver_dgetrs_rbt_strided_batched(handle, trans, n, nrhs, A, lda, stA, UV, stUV, B,
+                                                ldb, stB, bc);
+}
+
+inline rocblas_status rocsolver_getrs_rbt(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_operation trans,
+                                          rocblas_int n,
+                                          rocblas_int nrhs,
+                                          rocblas_float_complex* A,
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          const float* UV,
+                                          rocblas_stride stUV,
+                                          rocblas_float_complex* B,
+                                          rocblas_int ldb,
+                                          rocblas_stride stB,
+                                          rocblas_int bc)
+{
+    return rocsolver_cgetrs_rbt_strided_batched(handle, trans, n, nrhs, A, lda, stA, UV, stUV, B,
+                                                ldb, stB, bc);
+}
+
+inline rocblas_status rocsolver_getrs_rbt(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_operation trans,
+                                          rocblas_int n,
+                                          rocblas_int nrhs,
+                                          rocblas_double_complex* A,
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          const double* UV,
+                                          rocblas_stride stUV,
+                                          rocblas_double_complex* B,
+                                          rocblas_int ldb,
+                                          rocblas_stride stB,
+                                          rocblas_int bc)
+{
+    return rocsolver_zgetrs_rbt_strided_batched(handle, trans, n, nrhs, A, lda, stA, UV, stUV, B,
+                                                ldb, stB, bc);
+}
+
+// batched
+inline rocblas_status rocsolver_getrs_rbt(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_operation trans,
+                                          rocblas_int n,
+                                          rocblas_int nrhs,
+                                          float* const A[],
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          const float* UV,
+                                          rocblas_stride stUV,
+                                          float* const B[],
+                                          rocblas_int ldb,
+                                          rocblas_stride stB,
+                                          rocblas_int bc)
+{
+    return rocsolver_sgetrs_rbt_batched(handle, trans, n, nrhs, A, lda, UV, stUV, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_getrs_rbt(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_operation trans,
+                                          rocblas_int n,
+                                          rocblas_int nrhs,
+                                          double* const A[],
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          const double* UV,
+                                          rocblas_stride stUV,
+                                          double* const B[],
+                                          rocblas_int ldb,
+                                          rocblas_stride stB,
+                                          rocblas_int bc)
+{
+    return rocsolver_dgetrs_rbt_batched(handle, trans, n, nrhs, A, lda, UV, stUV, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_getrs_rbt(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_operation trans,
+                                          rocblas_int n,
+                                          rocblas_int nrhs,
+                                          rocblas_float_complex* const A[],
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          const float* UV,
+                                          rocblas_stride stUV,
+                                          rocblas_float_complex* const B[],
+                                          rocblas_int ldb,
+                                          rocblas_stride stB,
+                                          rocblas_int bc)
+{
+    return rocsolver_cgetrs_rbt_batched(handle, trans, n, nrhs, A, lda, UV, stUV, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_getrs_rbt(bool STRIDED,
+                                          rocblas_handle handle,
+                                          rocblas_operation trans,
+                                          rocblas_int n,
+                                          rocblas_int nrhs,
+                                          rocblas_double_complex* const A[],
+                                          rocblas_int lda,
+                                          rocblas_stride stA,
+                                          const double* UV,
+                                          rocblas_stride stUV,
+                                          rocblas_double_complex* const B[],
+                                          rocblas_int ldb,
+                                          rocblas_stride stB,
+                                          rocblas_int bc)
+{
+    return rocsolver_zgetrs_rbt_batched(handle, trans, n, nrhs, A, lda, UV, stUV, B, ldb, bc);
+}
+/********************************************************/
+
+/******************** GESV_RBT ********************/
+// strided_batched
+inline rocblas_status rocsolver_gesv_rbt(bool STRIDED,
+                                         rocblas_handle handle,
+                                         rocblas_int n,
+                                         rocblas_int nrhs,
+                                         float* A,
+                                         rocblas_int lda,
+                                         rocblas_stride stA,
+                                         float* UV,
+                                         rocblas_stride stUV,
+                                         float* B,
+                                         rocblas_int ldb,
+                                         rocblas_stride stB,
+                                         rocblas_int* info,
+                                         rocblas_int bc)
+{
+    return rocsolver_sgesv_rbt_strided_batched(handle, n, nrhs, A, lda, stA, UV, stUV, B, ldb, stB,
+                                               info, bc);
+}
+
+inline rocblas_status rocsolver_gesv_rbt(bool STRIDED,
+                                         rocblas_handle handle,
+                                         rocblas_int n,
+                                         rocblas_int nrhs,
+                                         double* A,
+                                         rocblas_int lda,
+                                         rocblas_stride stA,
+                                         double* UV,
+                                         rocblas_stride stUV,
+                                         double* B,
+                                         rocblas_int ldb,
+                                         rocblas_stride stB,
+                                         rocblas_int* info,
+                                         rocblas_int bc)
+{
+    return rocsolver_dgesv_rbt_strided_batched(handle, n, nrhs, A, lda, stA, UV, stUV, B, ldb, stB,
+                                               info, bc);
+}
+
+inline rocblas_status rocsolver_gesv_rbt(bool STRIDED,
+                                         rocblas_handle handle,
+                                         rocblas_int n,
+                                         rocblas_int nrhs,
+                                         rocblas_float_complex* A,
+                                         rocblas_int lda,
+                                         rocblas_stride stA,
+                                         float* UV,
+                                         rocblas_stride stUV,
+                                         rocblas_float_complex* B,
+                                         rocblas_int ldb,
+                                         rocblas_stride stB,
+                                         rocblas_int* info,
+                                         rocblas_int bc)
+{
+    return rocsolver_cgesv_rbt_strided_batched(handle, n, nrhs, A, lda, stA, UV, stUV, B, ldb, stB,
+                                               info, bc);
+}
+
+inline rocblas_status rocsolver_gesv_rbt(bool STRIDED,
+                                         rocblas_handle handle,
+                                         rocblas_int n,
+                                         rocblas_int nrhs,
+                                         rocblas_double_complex* A,
+                                         rocblas_int lda,
+                                         rocblas_stride stA,
+                                         double* UV,
+                                         rocblas_stride stUV,
+                                         rocblas_double_complex* B,
+                                         rocblas_int ldb,
+                                         rocblas_stride stB,
+                                         rocblas_int* info,
+                                         rocblas_int bc)
+{
+    return rocsolver_zgesv_rbt_strided_batched(handle, n, nrhs, A, lda, stA, UV, stUV, B, ldb, stB,
+                                               info, bc);
+}
+
+// batched
+inline rocblas_status rocsolver_gesv_rbt(bool STRIDED,
+                                         rocblas_handle handle,
+                                         rocblas_int n,
+                                         rocblas_int nrhs,
+                                         float* const A[],
+                                         rocblas_int lda,
+                                         rocblas_stride stA,
+                                         float* UV,
+                                         rocblas_stride stUV,
+                                         float* const B[],
+                                         rocblas_int ldb,
+                                         rocblas_stride stB,
+                                         rocblas_int* info,
+                                         rocblas_int bc)
+{
+    return rocsolver_sgesv_rbt_batched(handle, n, nrhs, A, lda, UV, stUV, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_gesv_rbt(bool STRIDED,
+                                         rocblas_handle handle,
+                                         rocblas_int n,
+                                         rocblas_int nrhs,
+                                         double* const A[],
+                                         rocblas_int lda,
+                                         rocblas_stride stA,
+                                         double* UV,
+                                         rocblas_stride stUV,
+                                         double* const B[],
+                                         rocblas_int ldb,
+                                         rocblas_stride stB,
+                                         rocblas_int* info,
+                                         rocblas_int bc)
+{
+    return rocsolver_dgesv_rbt_batched(handle, n, nrhs, A, lda, UV, stUV, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_gesv_rbt(bool STRIDED,
+                                         rocblas_handle handle,
+                                         rocblas_int n,
+                                         rocblas_int nrhs,
+                                         rocblas_float_complex* const A[],
+                                         rocblas_int lda,
+                                         rocblas_stride stA,
+                                         float* UV,
+                                         rocblas_stride stUV,
+                                         rocblas_float_complex* const B[],
+                                         rocblas_int ldb,
+                                         rocblas_stride stB,
+                                         rocblas_int* info,
+                                         rocblas_int bc)
+{
+    return rocsolver_cgesv_rbt_batched(handle, n, nrhs, A, lda, UV, stUV, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_gesv_rbt(bool STRIDED,
+                                         rocblas_handle handle,
+                                         rocblas_int n,
+                                         rocblas_int nrhs,
+                                         rocblas_double_complex* const A[],
+                                         rocblas_int lda,
+                                         rocblas_stride stA,
+                                         double* UV,
+                                         rocblas_stride stUV,
+                                         rocblas_double_complex* const B[],
+                                         rocblas_int ldb,
+                                         rocblas_stride stB,
+                                         rocblas_int* info,
+                                         rocblas_int bc)
+{
+    return rocsolver_zgesv_rbt_batched(handle, n, nrhs, A, lda, UV, stUV, B, ldb, info, bc);
+}
+/********************************************************/
+
+/******************** GETRF_VBATCHED ********************/
+inline rocblas_status rocsolver_getrf_vbatched(rocblas_handle handle,
+                                               const rocblas_int* m,
+                                               const rocblas_int* n,
+                                               float* const A[],
+                                               const rocblas_int* lda,
+                                               rocblas_int* const ipiv[],
+                                               rocblas_int* info,
+                                               rocblas_int max_m,
+                                               rocblas_int max_n,
+                                               rocblas_int bc)
+{
+    return rocsolver_sgetrf_vbatched(handle, m, n, A, lda, ipiv, info, max_m, max_n, bc);
+}
+
+inline rocblas_status rocsolver_getrf_vbatched(rocblas_handle handle,
+                                               const rocblas_int* m,
+                                               const rocblas_int* n,
+                                               double* const A[],
+                                               const rocblas_int* lda,
+                                               rocblas_int* const ipiv[],
+                                               rocblas_int* info,
+                                               rocblas_int max_m,
+                                               rocblas_int max_n,
+                                               rocblas_int bc)
+{
+    return rocsolver_dgetrf_vbatched(handle, m, n, A, lda, ipiv, info, max_m, max_n, bc);
+}
+
+inline rocblas_status rocsolver_getrf_vbatched(rocblas_handle handle,
+                                               const rocblas_int* m,
+                                               const rocblas_int* n,
+                                               rocblas_float_complex* const A[],
+                                               const rocblas_int* lda,
+                                               rocblas_int* const ipiv[],
+                                               rocblas_int* info,
+                                               rocblas_int max_m,
+                                               rocblas_int max_n,
+                                               rocblas_int bc)
+{
+    return rocsolver_cgetrf_vbatched(handle, m, n, A, lda, ipiv, info, max_m, max_n, bc);
+}
+
+inline rocblas_status rocsolver_getrf_vbatched(rocblas_handle handle,
+                                               const rocblas_int* m,
+                                               const rocblas_int* n,
+                                               rocblas_double_complex* const A[],
+                                               const rocblas_int* lda,
+                                               rocblas_int* const ipiv[],
+                                               rocblas_int* info,
+                                               rocblas_int max_m,
+                                               rocblas_int max_n,
+                                               rocblas_int bc)
+{
+    return rocsolver_zgetrf_vbatched(handle, m, n, A, lda, ipiv, info, max_m, max_n, bc);
+}
+/********************************************************/
+
+/******************** GETRS_VBATCHED ********************/
+inline rocblas_status rocsolver_getrs_vbatched(rocblas_handle handle,
+                                               rocblas_operation trans,
+                                               const rocblas_int* n,
+                                               const rocblas_int* nrhs,
+                                               float* const A[],
+                                               const rocblas_int* lda,
+                                               const rocblas_int* const ipiv[],
+                                               float* const B[],
+                                               const rocblas_int* ldb,
+                                               rocblas_int max_n,
+                                               rocblas_int max_nrhs,
+                                               rocblas_int bc)
+{
+    return rocsolver_sgetrs_vbatched(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, max_n, max_nrhs,
+                                     bc);
+}
+
+inline rocblas_status rocsolver_getrs_vbatched(rocblas_handle handle,
+                                               rocblas_operation trans,
+                                               const rocblas_int* n,
+                                               const rocblas_int* nrhs,
+                                               double* const A[],
+                                               const rocblas_int* lda,
+                                               const rocblas_int* const ipiv[],
+                                               double* const B[],
+                                               const rocblas_int* ldb,
+                                               rocblas_int max_n,
+                                               rocblas_int max_nrhs,
+                                               rocblas_int bc)
+{
+    return rocsolver_dgetrs_vbatched(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, max_n, max_nrhs,
+                                     bc);
+}
+
+inline rocblas_status rocsolver_getrs_vbatched(rocblas_handle handle,
+                                               rocblas_operation trans,
+                                               const rocblas_int* n,
+                                               const rocblas_int* nrhs,
+                                               rocblas_float_complex* const A[],
+                                               const rocblas_int* lda,
+                                               const rocblas_int* const ipiv[],
+                                               rocblas_float_complex* const B[],
+                                               const rocblas_int* ldb,
+                                               rocblas_int max_n,
+                                               rocblas_int max_nrhs,
+                                               rocblas_int bc)
+{
+    return rocsolver_cgetrs_vbatched(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, max_n, max_nrhs,
+                                     bc);
+}
+
+inline rocblas_status rocsolver_getrs_vbatched(rocblas_handle handle,
+                                               rocblas_operation trans,
+                                               const rocblas_int* n,
+                                               const rocblas_int* nrhs,
+                                               rocblas_double_complex* const A[],
+                                               const rocblas_int* lda,
+                                               const rocblas_int* const ipiv[],
+                                               rocblas_double_complex* const B[],
+                                               const rocblas_int* ldb,
+                                               rocblas_int max_n,
+                                               rocblas_int max_nrhs,
+                                               rocblas_int bc)
+{
+    return rocsolver_zgetrs_vbatched(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, max_n, max_nrhs,
+                                     bc);
+}
+/********************************************************/
+
+/******************** POTRF_VBATCHED ********************/
+inline rocblas_status rocsolver_potrf_vbatched(rocblas_handle handle,
+                                               rocblas_fill uplo,
+                                               const rocblas_int* n,
+                                               float* const A[],
+                                               const rocblas_int* lda,
+                                               rocblas_int* info,
+                                               rocblas_int max_n,
+                                               rocblas_int bc)
+{
+    return rocsolver_spotrf_vbatched(handle, uplo, n, A, lda, info, max_n, bc);
+}
+
+inline rocblas_status rocsolver_potrf_vbatched(rocblas_handle handle,
+                                               rocblas_fill uplo,
+                                               const rocblas_int* n,
+                                               double* const A[],
+                                               const rocblas_int* lda,
+                                               rocblas_int* info,
+                                               rocblas_int max_n,
+                                               rocblas_int bc)
+{
+    return rocsolver_dpotrf_vbatched(handle, uplo, n, A, lda, info, max_n, bc);
+}
+
+inline rocblas_status rocsolver_potrf_vbatched(rocblas_handle handle,
+                                               rocblas_fill uplo,
+                                               const rocblas_int* n,
+                                               rocblas_float_complex* const A[],
+                                               const rocblas_int* lda,
+                                               rocblas_int* info,
+                                               rocblas_int max_n,
+                                               rocblas_int bc)
+{
+    return rocsolver_cpotrf_vbatched(handle, uplo, n, A, lda, info, max_n, bc);
+}
+
+inline rocblas_status rocsolver_potrf_vbatched(rocblas_handle handle,
+                                               rocblas_fill uplo,
+                                               const rocblas_int* n,
+                                               rocblas_double_complex* const A[],
+                                               const rocblas_int* lda,
+                                               rocblas_int* info,
+                                               rocblas_int max_n,
+                                               rocblas_int bc)
+{
+    return rocsolver_zpotrf_vbatched(handle, uplo, n, A, lda, info, max_n, bc);
+}
+/********************************************************/
+
+/******************** GEQRF_VBATCHED ********************/
+inline rocblas_status rocsolver_geqrf_vbatched(rocblas_handle handle,
+                                               const rocblas_int* m,
+                                               const rocblas_int* n,
+                                               float* const A[],
+                                               const rocblas_int* lda,
+                                               float* const ipiv[],
+                                               rocblas_int max_m,
+                                               rocblas_int max_n,
+                                               rocblas_int bc)
+{
+    return rocsolver_sgeqrf_vbatched(handle, m, n, A, lda, ipiv, max_m, max_n, bc);
+}
+
+inline rocblas_status rocsolver_geqrf_vbatched(rocblas_handle handle,
+                                               const rocblas_int* m,
+                                               const rocblas_int* n,
+                                               double* const A[],
+                                               const rocblas_int* lda,
+                                               double* const ipiv[],
+                                               rocblas_int max_m,
+                                               rocblas_int max_n,
+                                               rocblas_int bc)
+{
+    return rocsolver_dgeqrf_vbatched(handle, m, n, A, lda, ipiv, max_m, max_n, bc);
+}
+
+inline rocblas_status rocsolver_geqrf_vbatched(rocblas_handle handle,
+                                               const rocblas_int* m,
+                                               const rocblas_int* n,
+                                               rocblas_float_complex* const A[],
+                                               const rocblas_int* lda,
+                                               rocblas_float_complex* const ipiv[],
+                                               rocblas_int max_m,
+                                               rocblas_int max_n,
+                                               rocblas_int bc)
+{
+    return rocsolver_cgeqrf_vbatched(handle, m, n, A, lda, ipiv, max_m, max_n, bc);
+}
+
+inline rocblas_status rocsolver_geqrf_vbatched(rocblas_handle handle,
+                                               const rocblas_int* m,
+                                               const rocblas_int* n,
+                                               rocblas_double_complex* const A[],
+                                               const rocblas_int* lda,
+                                               rocblas_double_complex* const ipiv[],
+                                               rocblas_int max_m,
+                                               rocblas_int max_n,
+                                               rocblas_int bc)
+{
+    return rocsolver_zgeqrf_vbatched(handle, m, n, A, lda, ipiv, max_m, max_n, bc);
+}
+/********************************************************/
+
+/******************** GETRF_OOC ********************/
+inline rocblas_status rocsolver_getrf_ooc(rocblas_handle handle,
+                                          rocblas_int m,
+                                          rocblas_int n,
+                                          float* A,
+                                          rocblas_int lda,
+                                          rocblas_int* ipiv,
+                                          rocblas_int* info)
+{
+    return rocsolver_sgetrf_ooc(handle, m, n, A, lda, ipiv, info);
+}
+
+inline rocblas_status rocsolver_getrf_ooc(rocblas_handle handle,
+                                          rocblas_int m,
+                                          rocblas_int n,
+                                          double* A,
+                                          rocblas_int lda,
+                                          rocblas_int* ipiv,
+                                          rocblas_int* info)
+{
+    return rocsolver_dgetrf_ooc(handle, m, n, A, lda, ipiv, info);
+}
+
+inline rocblas_status rocsolver_getrf_ooc(rocblas_handle handle,
+                                          rocblas_int m,
+                                          rocblas_int n,
+                                          rocblas_float_complex* A,
+                                          rocblas_int lda,
+                                          rocblas_int* ipiv,
+                                          rocblas_int* info)
+{
+    return rocsolver_cgetrf_ooc(handle, m, n, A, lda, ipiv, info);
+}
+
+inline rocblas_status rocsolver_getrf_ooc(rocblas_handle handle,
+                                          rocblas_int m,
+                                          rocblas_int n,
+                                          rocblas_double_complex* A,
+                                          rocblas_int lda,
+                                          rocblas_int* ipiv,
+                                          rocblas_int* info)
+{
+    return rocsolver_zgetrf_ooc(handle, m, n, A, lda, ipiv, info);
+}
+/********************************************************/
+
+/******************** GETRS_OOC ********************/
+inline rocblas_status rocsolver_getrs_ooc(rocblas_handle handle,
+                                          rocblas_operation trans,
+                                          rocblas_int n,
+                                          rocblas_int nrhs,
+                                          float* A,
+                                          rocblas_int lda,
+                                          const rocblas_int* ipiv,
+                                          float* B,
+                                          rocblas_int ldb)
+{
+    return rocsolver_sgetrs_ooc(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolver_getrs_ooc(rocblas_handle handle,
+                                          rocblas_operation trans,
+                                          rocblas_int n,
+                                          rocblas_int nrhs,
+                                          double* A,
+                                          rocblas_int lda,
+                                          const rocblas_int* ipiv,
+                                          double* B,
+                                          rocblas_int ldb)
+{
+    return rocsolver_dgetrs_ooc(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolver_getrs_ooc(rocblas_handle handle,
+                                          rocblas_operation trans,
+                                          rocblas_int n,
+                                          rocblas_int nrhs,
+                                          rocblas_float_complex* A,
+                                          rocblas_int lda,
+                                          const rocblas_int* ipiv,
+                                          rocblas_float_complex* B,
+                                          rocblas_int ldb)
+{
+    return rocsolver_cgetrs_ooc(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolver_getrs_ooc(rocblas_handle handle,
+                                          rocblas_operation trans,
+                                          rocblas_int n,
+                                          rocblas_int nrhs,
+                                          rocblas_double_complex* A,
+                                          rocblas_int lda,
+                                          const rocblas_int* ipiv,
+                                          rocblas_double_complex* B,
+                                          rocblas_int ldb)
+{
+    return rocsolver_zgetrs_ooc(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+/********************************************************/
+
+/******************** POTRF_OOC ********************/
+inline rocblas_status rocsolver_potrf_ooc(rocblas_handle handle,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          float* A,
+                                          rocblas_int lda,
+                                          rocblas_int* info)
+{
+    return rocsolver_spotrf_ooc(handle, uplo, n, A, lda, info);
+}
+
+inline rocblas_status rocsolver_potrf_ooc(rocblas_handle handle,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          double* A,
+                                          rocblas_int lda,
+                                          rocblas_int* info)
+{
+    return rocsolver_dpotrf_ooc(handle, uplo, n, A, lda, info);
+}
+
+inline rocblas_status rocsolver_potrf_ooc(rocblas_handle handle,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          rocblas_float_complex* A,
+                                          rocblas_int lda,
+                                          rocblas_int* info)
+{
+    return rocsolver_cpotrf_ooc(handle, uplo, n, A, lda, info);
+}
+
+inline rocblas_status rocsolver_potrf_ooc(rocblas_handle handle,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          rocblas_double_complex* A,
+                                          rocblas_int lda,
+                                          rocblas_int* info)
+{
+    return rocsolver_zpotrf_ooc(handle, uplo, n, A, lda, info);
+}
+/********************************************************/
+
+/******************** POTRS_OOC ********************/
+inline rocblas_status rocsolver_potrs_ooc(rocblas_handle handle,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          rocblas_int nrhs,
+                                          float* A,
+                                          rocblas_int lda,
+                                          float* B,
+                                          rocblas_int ldb)
+{
+    return rocsolver_spotrs_ooc(handle, uplo, n, nrhs, A, lda, B, ldb);
+}
+
+inline rocblas_status rocsolver_potrs_ooc(rocblas_handle handle,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          rocblas_int nrhs,
+                                          double* A,
+                                          rocblas_int lda,
+                                          double* B,
+                                          rocblas_int ldb)
+{
+    return rocsolver_dpotrs_ooc(handle, uplo, n, nrhs, A, lda, B, ldb);
+}
+
+inline rocblas_status rocsolver_potrs_ooc(rocblas_handle handle,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          rocblas_int nrhs,
+                                          rocblas_float_complex* A,
+                                          rocblas_int lda,
+                                          rocblas_float_complex* B,
+                                          rocblas_int ldb)
+{
+    return rocsolver_cpotrs_ooc(handle, uplo, n, nrhs, A, lda, B, ldb);
+}
+
+inline rocblas_status rocsolver_potrs_ooc(rocblas_handle handle,
+                                          rocblas_fill uplo,
+                                          rocblas_int n,
+                                          rocblas_int nrhs,
+                                          rocblas_double_complex* A,
+                                          rocblas_int lda,
+                                          rocblas_double_complex* B,
+                                          rocblas_int ldb)
+{
+    return rocsolver_zpotrs_ooc(handle, uplo, n, nrhs, A, lda, B, ldb);
+}
+/********************************************************/
+
+/******************** GBTRF ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gbtrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_sgbtrf_strided_batched(handle, m, n, kl, ku, A, lda, stA, ipiv, stP, info,
+                                                bc);
+    else
+        return rocsolver_sgbtrf(handle, m, n, kl, ku, A, lda, ipiv, info);
+}
+
+inline rocblas_status rocsolver_gbtrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dgbtrf_strided_batched(handle, m, n, kl, ku, A, lda, stA, ipiv, stP, info,
+                                                bc);
+    else
+        return rocsolver_dgbtrf(handle, m, n, kl, ku, A, lda, ipiv, info);
+}
+
+inline rocblas_status rocsolver_gbtrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_cgbtrf_strided_batched(handle, m, n, kl, ku, A, lda, stA, ipiv, stP, info,
+                                                bc);
+    else
+        return rocsolver_cgbtrf(handle, m, n, kl, ku, A, lda, ipiv, info);
+}
+
+inline rocblas_status rocsolver_gbtrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zgbtrf_strided_batched(handle, m, n, kl, ku, A, lda, stA, ipiv, stP, info,
+                                                bc);
+    else
+        return rocsolver_zgbtrf(handle, m, n, kl, ku, A, lda, ipiv, info);
+}
+
+// batched
+inline rocblas_status rocsolver_gbtrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_sgbtrf_batched(handle, m, n, kl, ku, A, lda, ipiv, stP, info, bc);
+}
+
+inline rocblas_status rocsolver_gbtrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_dgbtrf_batched(handle, m, n, kl, ku, A, lda, ipiv, stP, info, bc);
+}
+
+inline rocblas_status rocsolver_gbtrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_cgbtrf_batched(handle, m, n, kl, ku, A, lda, ipiv, stP, info, bc);
+}
+
+inline rocblas_status rocsolver_gbtrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_zgbtrf_batched(handle, m, n, kl, ku, A, lda, ipiv, stP, info, bc);
+}
+/********************************************************/
+
+/******************** GBTRS ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gbtrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      rocblas_int nrhs,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      const rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      float* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_sgbtrs_strided_batched(handle, trans, n, kl, ku, nrhs, A, lda, stA, ipiv,
+                                                stP, B, ldb, stB, bc);
+    else
+        return rocsolver_sgbtrs(handle, trans, n, kl, ku, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolver_gbtrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      rocblas_int nrhs,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      const rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      double* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dgbtrs_strided_batched(handle, trans, n, kl, ku, nrhs, A, lda, stA, ipiv,
+                                                stP, B, ldb, stB, bc);
+    else
+        return rocsolver_dgbtrs(handle, trans, n, kl, ku, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolver_gbtrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      const rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_float_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_cgbtrs_strided_batched(handle, trans, n, kl, ku, nrhs, A, lda, stA, ipiv,
+                                                stP, B, ldb, stB, bc);
+    else
+        return rocsolver_cgbtrs(handle, trans, n, kl, ku, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status rocsolver_gbtrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      const rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_double_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zgbtrs_strided_batched(handle, trans, n, kl, ku, nrhs, A, lda, stA, ipiv,
+                                                stP, B, ldb, stB, bc);
+    else
+        return rocsolver_zgbtrs(handle, trans, n, kl, ku, nrhs, A, lda, ipiv, B, ldb);
+}
+
+// batched
+inline rocblas_status rocsolver_gbtrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      rocblas_int nrhs,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      const rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      float* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return rocsolver_sgbtrs_batched(handle, trans, n, kl, ku, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_gbtrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      rocblas_int nrhs,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      const rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      double* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return rocsolver_dgbtrs_batched(handle, trans, n, kl, ku, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_gbtrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      const rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_float_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return rocsolver_cgbtrs_batched(handle, trans, n, kl, ku, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_gbtrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_operation trans,
+                                      rocblas_int n,
+                                      rocblas_int kl,
+                                      rocblas_int ku,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      const rocblas_int* ipiv,
+                                      rocblas_stride stP,
+                                      rocblas_double_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return rocsolver_zgbtrs_batched(handle, trans, n, kl, ku, nrhs, A, lda, ipiv, stP, B, ldb, bc);
+}
+/********************************************************/
+
+/******************** GBSV ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gbsv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int kl,
+                                     rocblas_int ku,
+                                     rocblas_int nrhs,
+                                     float* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     float* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_sgbsv_strided_batched(handle, n, kl, ku, nrhs, A, lda, stA, ipiv, stP, B,
+                                               ldb, stB, info, bc);
+    else
+        return rocsolver_sgbsv(handle, n, kl, ku, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_gbsv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int kl,
+                                     rocblas_int ku,
+                                     rocblas_int nrhs,
+                                     double* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     double* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dgbsv_strided_batched(handle, n, kl, ku, nrhs, A, lda, stA, ipiv, stP, B,
+                                               ldb, stB, info, bc);
+    else
+        return rocsolver_dgbsv(handle, n, kl, ku, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_gbsv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int kl,
+                                     rocblas_int ku,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     rocblas_float_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_cgbsv_strided_batched(handle, n, kl, ku, nrhs, A, lda, stA, ipiv, stP, B,
+                                               ldb, stB, info, bc);
+    else
+        return rocsolver_cgbsv(handle, n, kl, ku, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_gbsv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int kl,
+                                     rocblas_int ku,
+                                     rocblas_int nrhs,
+                                     rocblas_double_complex* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     rocblas_double_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zgbsv_strided_batched(handle, n, kl, ku, nrhs, A, lda, stA, ipiv, stP, B,
+                                               ldb, stB, info, bc);
+    else
+        return rocsolver_zgbsv(handle, n, kl, ku, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+// batched
+inline rocblas_status rocsolver_gbsv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int kl,
+                                     rocblas_int ku,
+                                     rocblas_int nrhs,
+                                     float* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     float* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_sgbsv_batched(handle, n, kl, ku, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_gbsv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int kl,
+                                     rocblas_int ku,
+                                     rocblas_int nrhs,
+                                     double* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     double* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_dgbsv_batched(handle, n, kl, ku, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_gbsv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int kl,
+                                     rocblas_int ku,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     rocblas_float_complex* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_cgbsv_batched(handle, n, kl, ku, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_gbsv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int kl,
+                                     rocblas_int ku,
+                                     rocblas_int nrhs,
+                                     rocblas_double_complex* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_int* ipiv,
+                                     rocblas_stride stP,
+                                     rocblas_double_complex* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_zgbsv_batched(handle, n, kl, ku, nrhs, A, lda, ipiv, stP, B, ldb, info, bc);
+}
+/********************************************************/
+
+/******************** PBTRF ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_pbtrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int kd,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_spbtrf_strided_batched(handle, uplo, n, kd, A, lda, stA, info, bc);
+    else
+        return rocsolver_spbtrf(handle, uplo, n, kd, A, lda, info);
+}
+
+inline rocblas_status rocsolver_pbtrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int kd,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dpbtrf_strided_batched(handle, uplo, n, kd, A, lda, stA, info, bc);
+    else
+        return rocsolver_dpbtrf(handle, uplo, n, kd, A, lda, info);
+}
+
+inline rocblas_status rocsolver_pbtrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int kd,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_cpbtrf_strided_batched(handle, uplo, n, kd, A, lda, stA, info, bc);
+    else
+        return rocsolver_cpbtrf(handle, uplo, n, kd, A, lda, info);
+}
+
+inline rocblas_status rocsolver_pbtrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int kd,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zpbtrf_strided_batched(handle, uplo, n, kd, A, lda, stA, info, bc);
+    else
+        return rocsolver_zpbtrf(handle, uplo, n, kd, A, lda, info);
+}
+
+// batched
+inline rocblas_status rocsolver_pbtrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int kd,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_spbtrf_batched(handle, uplo, n, kd, A, lda, info, bc);
+}
+
+inline rocblas_status rocsolver_pbtrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int kd,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_dpbtrf_batched(handle, uplo, n, kd, A, lda, info, bc);
+}
+
+inline rocblas_status rocsolver_pbtrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int kd,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_cpbtrf_batched(handle, uplo, n, kd, A, lda, info, bc);
+}
+
+inline rocblas_status rocsolver_pbtrf(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int kd,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    return rocsolver_zpbtrf_batched(handle, uplo, n, kd, A, lda, info, bc);
+}
+/********************************************************/
+
+/******************** PBTRS ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_pbtrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int kd,
+                                      rocblas_int nrhs,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_spbtrs_strided_batched(handle, uplo, n, kd, nrhs, A, lda, stA, B, ldb, stB,
+                                                bc);
+    else
+        return rocsolver_spbtrs(handle, uplo, n, kd, nrhs, A, lda, B, ldb);
+}
+
+inline rocblas_status rocsolver_pbtrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int kd,
+                                      rocblas_int nrhs,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dpbtrs_strided_batched(handle, uplo, n, kd, nrhs, A, lda, stA, B, ldb, stB,
+                                                bc);
+    else
+        return rocsolver_dpbtrs(handle, uplo, n, kd, nrhs, A, lda, B, ldb);
+}
+
+inline rocblas_status rocsolver_pbtrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int kd,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_cpbtrs_strided_batched(handle, uplo, n, kd, nrhs, A, lda, stA, B, ldb, stB,
+                                                bc);
+    else
+        return rocsolver_cpbtrs(handle, uplo, n, kd, nrhs, A, lda, B, ldb);
+}
+
+inline rocblas_status rocsolver_pbtrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int kd,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zpbtrs_strided_batched(handle, uplo, n, kd, nrhs, A, lda, stA, B, ldb, stB,
+                                                bc);
+    else
+        return rocsolver_zpbtrs(handle, uplo, n, kd, nrhs, A, lda, B, ldb);
+}
+
+// batched
+inline rocblas_status rocsolver_pbtrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int kd,
+                                      rocblas_int nrhs,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return rocsolver_spbtrs_batched(handle, uplo, n, kd, nrhs, A, lda, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_pbtrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int kd,
+                                      rocblas_int nrhs,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return rocsolver_dpbtrs_batched(handle, uplo, n, kd, nrhs, A, lda, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_pbtrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int kd,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return rocsolver_cpbtrs_batched(handle, uplo, n, kd, nrhs, A, lda, B, ldb, bc);
+}
+
+inline rocblas_status rocsolver_pbtrs(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_fill uplo,
+                                      rocblas_int n,
+                                      rocblas_int kd,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    return rocsolver_zpbtrs_batched(handle, uplo, n, kd, nrhs, A, lda, B, ldb, bc);
+}
+/********************************************************/
+
+/******************** PBSV ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_pbsv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int kd,
+                                     rocblas_int nrhs,
+                                     float* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     float* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_spbsv_strided_batched(handle, uplo, n, kd, nrhs, A, lda, stA, B, ldb, stB,
+                                               info, bc);
+    else
+        return rocsolver_spbsv(handle, uplo, n, kd, nrhs, A, lda, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_pbsv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int kd,
+                                     rocblas_int nrhs,
+                                     double* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     double* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dpbsv_strided_batched(handle, uplo, n, kd, nrhs, A, lda, stA, B, ldb, stB,
+                                               info, bc);
+    else
+        return rocsolver_dpbsv(handle, uplo, n, kd, nrhs, A, lda, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_pbsv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int kd,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_float_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_cpbsv_strided_batched(handle, uplo, n, kd, nrhs, A, lda, stA, B, ldb, stB,
+                                               info, bc);
+    else
+        return rocsolver_cpbsv(handle, uplo, n, kd, nrhs, A, lda, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_pbsv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int kd,
+                                     rocblas_int nrhs,
+                                     rocblas_double_complex* A,
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_double_complex* B,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zpbsv_strided_batched(handle, uplo, n, kd, nrhs, A, lda, stA, B, ldb, stB,
+                                               info, bc);
+    else
+        return rocsolver_zpbsv(handle, uplo, n, kd, nrhs, A, lda, B, ldb, info);
+}
+
+// batched
+inline rocblas_status rocsolver_pbsv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int kd,
+                                     rocblas_int nrhs,
+                                     float* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     float* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_spbsv_batched(handle, uplo, n, kd, nrhs, A, lda, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_pbsv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int kd,
+                                     rocblas_int nrhs,
+                                     double* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     double* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_dpbsv_batched(handle, uplo, n, kd, nrhs, A, lda, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_pbsv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int kd,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_float_complex* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_cpbsv_batched(handle, uplo, n, kd, nrhs, A, lda, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_pbsv(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_fill uplo,
+                                     rocblas_int n,
+                                     rocblas_int kd,
+                                     rocblas_int nrhs,
+                                     rocblas_double_complex* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_double_complex* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_zpbsv_batched(handle, uplo, n, kd, nrhs, A, lda, B, ldb, info, bc);
+}
+/********************************************************/
+
+/******************** GTSV ********************/
+// strided_batched and interleaved_batched
+inline rocblas_status rocsolver_gtsv(bool INTERLEAVED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     float* dl,
+                                     rocblas_int incdl,
+                                     rocblas_stride stDL,
+                                     float* d,
+                                     rocblas_int incd,
+                                     rocblas_stride stD,
+                                     float* du,
+                                     rocblas_int incdu,
+                                     rocblas_stride stDU,
+                                     float* B,
+                                     rocblas_int incb,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(INTERLEAVED)
+        return rocsolver_sgtsv_interleaved_batched(handle, n, nrhs, dl, incdl, stDL, d, incd, stD,
+                                                   du, incdu, stDU, B, incb, ldb, stB, info, bc);
+    else
+        return rocsolver_sgtsv_strided_batched(handle, n, nrhs, dl, stDL, d, stD, du, stDU, B, ldb,
+                                               stB, info, bc);
+}
+
+inline rocblas_status rocsolver_gtsv(bool INTERLEAVED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     double* dl,
+                                     rocblas_int incdl,
+                                     rocblas_stride stDL,
+                                     double* d,
+                                     rocblas_int incd,
+                                     rocblas_stride stD,
+                                     double* du,
+                                     rocblas_int incdu,
+                                     rocblas_stride stDU,
+                                     double* B,
+                                     rocblas_int incb,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(INTERLEAVED)
+        return rocsolver_dgtsv_interleaved_batched(handle, n, nrhs, dl, incdl, stDL, d, incd, stD,
+                                                   du, incdu, stDU, B, incb, ldb, stB, info, bc);
+    else
+        return rocsolver_dgtsv_strided_batched(handle, n, nrhs, dl, stDL, d, stD, du, stDU, B, ldb,
+                                               stB, info, bc);
+}
+
+inline rocblas_status rocsolver_gtsv(bool INTERLEAVED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* dl,
+                                     rocblas_int incdl,
+                                     rocblas_stride stDL,
+                                     rocblas_float_complex* d,
+                                     rocblas_int incd,
+                                     rocblas_stride stD,
+                                     rocblas_float_complex* du,
+                                     rocblas_int incdu,
+                                     rocblas_stride stDU,
+                                     rocblas_float_complex* B,
+                                     rocblas_int incb,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(INTERLEAVED)
+        return rocsolver_cgtsv_interleaved_batched(handle, n, nrhs, dl, incdl, stDL, d, incd, stD,
+                                                   du, incdu, stDU, B, incb, ldb, stB, info, bc);
+    else
+        return rocsolver_cgtsv_strided_batched(handle, n, nrhs, dl, stDL, d, stD, du, stDU, B, ldb,
+                                               stB, info, bc);
+}
+
+inline rocblas_status rocsolver_gtsv(bool INTERLEAVED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_double_complex* dl,
+                                     rocblas_int incdl,
+                                     rocblas_stride stDL,
+                                     rocblas_double_complex* d,
+                                     rocblas_int incd,
+                                     rocblas_stride stD,
+                                     rocblas_double_complex* du,
+                                     rocblas_int incdu,
+                                     rocblas_stride stDU,
+                                     rocblas_double_complex* B,
+                                     rocblas_int incb,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(INTERLEAVED)
+        return rocsolver_zgtsv_interleaved_batched(handle, n, nrhs, dl, incdl, stDL, d, incd, stD,
+                                                   du, incdu, stDU, B, incb, ldb, stB, info, bc);
+    else
+        return rocsolver_zgtsv_strided_batched(handle, n, nrhs, dl, stDL, d, stD, du, stDU, B, ldb,
+                                               stB, info, bc);
+}
+/********************************************************/
+
+/******************** GTSV_NOPIVOT ********************/
+// strided_batched and interleaved_batched
+inline rocblas_status rocsolver_gtsv_nopivot(bool INTERLEAVED,
+                                             rocblas_handle handle,
+                                             rocblas_int n,
+                                             rocblas_int nrhs,
+                                             float* dl,
+                                             rocblas_int incdl,
+                                             rocblas_stride stDL,
+                                             float* d,
+                                             rocblas_int incd,
+                                             rocblas_stride stD,
+                                             float* du,
+                                             rocblas_int incdu,
+                                             rocblas_stride stDU,
+                                             float* B,
+                                             rocblas_int incb,
+                                             rocblas_int ldb,
+                                             rocblas_stride stB,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    if(INTERLEAVED)
+        return rocsolver_sgtsv_nopivot_interleaved_batched(handle, n, nrhs, dl, incdl, stDL, d,
+                                                           incd, stD, du, incdu, stDU, B, incb, ldb,
+                                                           stB, info, bc);
+    else
+        return rocsolver_sgtsv_nopivot_strided_batched(handle, n, nrhs, dl, stDL, d, stD, du, stDU,
+                                                       B, ldb, stB, info, bc);
+}
+
+inline rocblas_status rocsolver_gtsv_nopivot(bool INTERLEAVED,
+                                             rocblas_handle handle,
+                                             rocblas_int n,
+                                             rocblas_int nrhs,
+                                             double* dl,
+                                             rocblas_int incdl,
+                                             rocblas_stride stDL,
+                                             double* d,
+                                             rocblas_int incd,
+                                             rocblas_stride stD,
+                                             double* du,
+                                             rocblas_int incdu,
+                                             rocblas_stride stDU,
+                                             double* B,
+                                             rocblas_int incb,
+                                             rocblas_int ldb,
+                                             rocblas_stride stB,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    if(INTERLEAVED)
+        return rocsolver_dgtsv_nopivot_interleaved_batched(handle, n, nrhs, dl, incdl, stDL, d,
+                                                           incd, stD, du, incdu, stDU, B, incb, ldb,
+                                                           stB, info, bc);
+    else
+        return rocsolver_dgtsv_nopivot_strided_batched(handle, n, nrhs, dl, stDL, d, stD, du, stDU,
+                                                       B, ldb, stB, info, bc);
+}
+
+inline rocblas_status rocsolver_gtsv_nopivot(bool INTERLEAVED,
+                                             rocblas_handle handle,
+                                             rocblas_int n,
+                                             rocblas_int nrhs,
+                                             rocblas_float_complex* dl,
+                                             rocblas_int incdl,
+                                             rocblas_stride stDL,
+                                             rocblas_float_complex* d,
+                                             rocblas_int incd,
+                                             rocblas_stride stD,
+                                             rocblas_float_complex* du,
+                                             rocblas_int incdu,
+                                             rocblas_stride stDU,
+                                             rocblas_float_complex* B,
+                                             rocblas_int incb,
+                                             rocblas_int ldb,
+                                             rocblas_stride stB,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    if(INTERLEAVED)
+        return rocsolver_cgtsv_nopivot_interleaved_batched(handle, n, nrhs, dl, incdl, stDL, d,
+                                                           incd, stD, du, incdu, stDU, B, incb, ldb,
+                                                           stB, info, bc);
+    else
+        return rocsolver_cgtsv_nopivot_strided_batched(handle, n, nrhs, dl, stDL, d, stD, du, stDU,
+                                                       B, ldb, stB, info, bc);
+}
+
+inline rocblas_status rocsolver_gtsv_nopivot(bool INTERLEAVED,
+                                             rocblas_handle handle,
+                                             rocblas_int n,
+                                             rocblas_int nrhs,
+                                             rocblas_double_complex* dl,
+                                             rocblas_int incdl,
+                                             rocblas_stride stDL,
+                                             rocblas_double_complex* d,
+                                             rocblas_int incd,
+                                             rocblas_stride stD,
+                                             rocblas_double_complex* du,
+                                             rocblas_int incdu,
+                                             rocblas_stride stDU,
+                                             rocblas_double_complex* B,
+                                             rocblas_int incb,
+                                             rocblas_int ldb,
+                                             rocblas_stride stB,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    if(INTERLEAVED)
+        return rocsolver_zgtsv_nopivot_interleaved_batched(handle, n, nrhs, dl, incdl, stDL, d,
+                                                           incd, stD, du, incdu, stDU, B, incb, ldb,
+                                                           stB, info, bc);
+    else
+        return rocsolver_zgtsv_nopivot_strided_batched(handle, n, nrhs, dl, stDL, d, stD, du, stDU,
+                                                       B, ldb, stB, info, bc);
+}
+/********************************************************/
+
+/******************** PTTRF ********************/
+// strided_batched and interleaved_batched
+inline rocblas_status rocsolver_pttrf(bool INTERLEAVED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      float* D,
+                                      rocblas_int incd,
+                                      rocblas_stride stD,
+                                      float* E,
+                                      rocblas_int ince,
+                                      rocblas_stride stE,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    if(INTERLEAVED)
+        return rocsolver_spttrf_interleaved_batched(handle, n, D, incd, stD, E, ince, stE, info,
+                                                    bc);
+    else
+        return rocsolver_spttrf_strided_batched(handle, n, D, stD, E, stE, info, bc);
+}
+
+inline rocblas_status rocsolver_pttrf(bool INTERLEAVED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      double* D,
+                                      rocblas_int incd,
+                                      rocblas_stride stD,
+                                      double* E,
+                                      rocblas_int ince,
+                                      rocblas_stride stE,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    if(INTERLEAVED)
+        return rocsolver_dpttrf_interleaved_batched(handle, n, D, incd, stD, E, ince, stE, info,
+                                                    bc);
+    else
+        return rocsolver_dpttrf_strided_batched(handle, n, D, stD, E, stE, info, bc);
+}
+
+inline rocblas_status rocsolver_pttrf(bool INTERLEAVED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      float* D,
+                                      rocblas_int incd,
+                                      rocblas_stride stD,
+                                      rocblas_float_complex* E,
+                                      rocblas_int ince,
+                                      rocblas_stride stE,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    if(INTERLEAVED)
+        return rocsolver_cpttrf_interleaved_batched(handle, n, D, incd, stD, E, ince, stE, info,
+                                                    bc);
+    else
+        return rocsolver_cpttrf_strided_batched(handle, n, D, stD, E, stE, info, bc);
+}
+
+inline rocblas_status rocsolver_pttrf(bool INTERLEAVED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      double* D,
+                                      rocblas_int incd,
+                                      rocblas_stride stD,
+                                      rocblas_double_complex* E,
+                                      rocblas_int ince,
+                                      rocblas_stride stE,
+                                      rocblas_int* info,
+                                      rocblas_int bc)
+{
+    if(INTERLEAVED)
+        return rocsolver_zpttrf_interleaved_batched(handle, n, D, incd, stD, E, ince, stE, info,
+                                                    bc);
+    else
+        return rocsolver_zpttrf_strided_batched(handle, n, D, stD, E, stE, info, bc);
+}
+/********************************************************/
+
+/******************** PTTRS ********************/
+// strided_batched and interleaved_batched
+inline rocblas_status rocsolver_pttrs(bool INTERLEAVED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      float* D,
+                                      rocblas_int incd,
+                                      rocblas_stride stD,
+                                      float* E,
+                                      rocblas_int ince,
+                                      rocblas_stride stE,
+                                      float* B,
+                                      rocblas_int incb,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    if(INTERLEAVED)
+        return rocsolver_spttrs_interleaved_batched(handle, n, nrhs, D, incd, stD, E, ince, stE, B,
+                                                    incb, ldb, stB, bc);
+    else
+        return rocsolver_spttrs_strided_batched(handle, n, nrhs, D, stD, E, stE, B, ldb, stB, bc);
+}
+
+inline rocblas_status rocsolver_pttrs(bool INTERLEAVED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      double* D,
+                                      rocblas_int incd,
+                                      rocblas_stride stD,
+                                      double* E,
+                                      rocblas_int ince,
+                                      rocblas_stride stE,
+                                      double* B,
+                                      rocblas_int incb,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    if(INTERLEAVED)
+        return rocsolver_dpttrs_interleaved_batched(handle, n, nrhs, D, incd, stD, E, ince, stE, B,
+                                                    incb, ldb, stB, bc);
+    else
+        return rocsolver_dpttrs_strided_batched(handle, n, nrhs, D, stD, E, stE, B, ldb, stB, bc);
+}
+
+inline rocblas_status rocsolver_pttrs(bool INTERLEAVED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      float* D,
+                                      rocblas_int incd,
+                                      rocblas_stride stD,
+                                      rocblas_float_complex* E,
+                                      rocblas_int ince,
+                                      rocblas_stride stE,
+                                      rocblas_float_complex* B,
+                                      rocblas_int incb,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    if(INTERLEAVED)
+        return rocsolver_cpttrs_interleaved_batched(handle, n, nrhs, D, incd, stD, E, ince, stE, B,
+                                                    incb, ldb, stB, bc);
+    else
+        return rocsolver_cpttrs_strided_batched(handle, n, nrhs, D, stD, E, stE, B, ldb, stB, bc);
+}
+
+inline rocblas_status rocsolver_pttrs(bool INTERLEAVED,
+                                      rocblas_handle handle,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      double* D,
+                                      rocblas_int incd,
+                                      rocblas_stride stD,
+                                      rocblas_double_complex* E,
+                                      rocblas_int ince,
+                                      rocblas_stride stE,
+                                      rocblas_double_complex* B,
+                                      rocblas_int incb,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int bc)
+{
+    if(INTERLEAVED)
+        return rocsolver_zpttrs_interleaved_batched(handle, n, nrhs, D, incd, stD, E, ince, stE, B,
+                                                    incb, ldb, stB, bc);
+    else
+        return rocsolver_zpttrs_strided_batched(handle, n, nrhs, D, stD, E, stE, B, ldb, stB, bc);
+}
+/********************************************************/
+
+/******************** PTSV ********************/
+// strided_batched and interleaved_batched
+inline rocblas_status rocsolver_ptsv(bool INTERLEAVED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     float* D,
+                                     rocblas_int incd,
+                                     rocblas_stride stD,
+                                     float* E,
+                                     rocblas_int ince,
+                                     rocblas_stride stE,
+                                     float* B,
+                                     rocblas_int incb,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(INTERLEAVED)
+        return rocsolver_sptsv_interleaved_batched(handle, n, nrhs, D, incd, stD, E, ince, stE, B,
+                                                   incb, ldb, stB, info, bc);
+    else
+        return rocsolver_sptsv_strided_batched(handle, n, nrhs, D, stD, E, stE, B, ldb, stB, info,
+                                               bc);
+}
+
+inline rocblas_status rocsolver_ptsv(bool INTERLEAVED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     double* D,
+                                     rocblas_int incd,
+                                     rocblas_stride stD,
+                                     double* E,
+                                     rocblas_int ince,
+                                     rocblas_stride stE,
+                                     double* B,
+                                     rocblas_int incb,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(INTERLEAVED)
+        return rocsolver_dptsv_interleaved_batched(handle, n, nrhs, D, incd, stD, E, ince, stE, B,
+                                                   incb, ldb, stB, info, bc);
+    else
+        return rocsolver_dptsv_strided_batched(handle, n, nrhs, D, stD, E, stE, B, ldb, stB, info,
+                                               bc);
+}
+
+inline rocblas_status rocsolver_ptsv(bool INTERLEAVED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     float* D,
+                                     rocblas_int incd,
+                                     rocblas_stride stD,
+                                     rocblas_float_complex* E,
+                                     rocblas_int ince,
+                                     rocblas_stride stE,
+                                     rocblas_float_complex* B,
+                                     rocblas_int incb,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(INTERLEAVED)
+        return rocsolver_cptsv_interleaved_batched(handle, n, nrhs, D, incd, stD, E, ince, stE, B,
+                                                   incb, ldb, stB, info, bc);
+    else
+        return rocsolver_cptsv_strided_batched(handle, n, nrhs, D, stD, E, stE, B, ldb, stB, info,
+                                               bc);
+}
+
+inline rocblas_status rocsolver_ptsv(bool INTERLEAVED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     double* D,
+                                     rocblas_int incd,
+                                     rocblas_stride stD,
+                                     rocblas_double_complex* E,
+                                     rocblas_int ince,
+                                     rocblas_stride stE,
+                                     rocblas_double_complex* B,
+                                     rocblas_int incb,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(INTERLEAVED)
+        return rocsolver_zptsv_interleaved_batched(handle, n, nrhs, D, incd, stD, E, ince, stE, B,
+                                                   incb, ldb, stB, info, bc);
+    else
+        return rocsolver_zptsv_strided_batched(handle, n, nrhs, D, stD, E, stE, B, ldb, stB, info,
+                                               bc);
+}
+/********************************************************/
+
+/******************** GPSV ********************/
+// strided_batched and interleaved_batched
+inline rocblas_status rocsolver_gpsv(bool INTERLEAVED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     float* ds,
+                                     rocblas_int incds,
+                                     rocblas_stride stDS,
+                                     float* dl,
+                                     rocblas_int incdl,
+                                     rocblas_stride stDL,
+                                     float* d,
+                                     rocblas_int incd,
+                                     rocblas_stride stD,
+                                     float* du,
+                                     rocblas_int incdu,
+                                     rocblas_stride stDU,
+                                     float* dw,
+                                     rocblas_int incdw,
+                                     rocblas_stride stDW,
+                                     float* B,
+                                     rocblas_int incb,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(INTERLEAVED)
+        return rocsolver_sgpsv_interleaved_batched(handle, n, nrhs, ds, incds, stDS, dl, incdl,
+                                                   stDL, d, incd, stD, du, incdu, stDU, dw, incdw,
+                                                   stDW, B, incb, ldb, stB, info, bc);
+    else
+        return rocsolver_sgpsv_strided_batched(handle, n, nrhs, ds, stDS, dl, stDL, d, stD, du,
+                                               stDU, dw, stDW, B, ldb, stB, info, bc);
+}
+
+inline rocblas_status rocsolver_gpsv(bool INTERLEAVED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     double* ds,
+                                     rocblas_int incds,
+                                     rocblas_stride stDS,
+                                     double* dl,
+                                     rocblas_int incdl,
+                                     rocblas_stride stDL,
+                                     double* d,
+                                     rocblas_int incd,
+                                     rocblas_stride stD,
+                                     double* du,
+                                     rocblas_int incdu,
+                                     rocblas_stride stDU,
+                                     double* dw,
+                                     rocblas_int incdw,
+                                     rocblas_stride stDW,
+                                     double* B,
+                                     rocblas_int incb,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(INTERLEAVED)
+        return rocsolver_dgpsv_interleaved_batched(handle, n, nrhs, ds, incds, stDS, dl, incdl,
+                                                   stDL, d, incd, stD, du, incdu, stDU, dw, incdw,
+                                                   stDW, B, incb, ldb, stB, info, bc);
+    else
+        return rocsolver_dgpsv_strided_batched(handle, n, nrhs, ds, stDS, dl, stDL, d, stD, du,
+                                               stDU, dw, stDW, B, ldb, stB, info, bc);
+}
+
+inline rocblas_status rocsolver_gpsv(bool INTERLEAVED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* ds,
+                                     rocblas_int incds,
+                                     rocblas_stride stDS,
+                                     rocblas_float_complex* dl,
+                                     rocblas_int incdl,
+                                     rocblas_stride stDL,
+                                     rocblas_float_complex* d,
+                                     rocblas_int incd,
+                                     rocblas_stride stD,
+                                     rocblas_float_complex* du,
+                                     rocblas_int incdu,
+                                     rocblas_stride stDU,
+                                     rocblas_float_complex* dw,
+                                     rocblas_int incdw,
+                                     rocblas_stride stDW,
+                                     rocblas_float_complex* B,
+                                     rocblas_int incb,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(INTERLEAVED)
+        return rocsolver_cgpsv_interleaved_batched(handle, n, nrhs, ds, incds, stDS, dl, incdl,
+                                                   stDL, d, incd, stD, du, incdu, stDU, dw, incdw,
+                                                   stDW, B, incb, ldb, stB, info, bc);
+    else
+        return rocsolver_cgpsv_strided_batched(handle, n, nrhs, ds, stDS, dl, stDL, d, stD, du,
+                                               stDU, dw, stDW, B, ldb, stB, info, bc);
+}
+
+inline rocblas_status rocsolver_gpsv(bool INTERLEAVED,
+                                     rocblas_handle handle,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_double_complex* ds,
+                                     rocblas_int incds,
+                                     rocblas_stride stDS,
+                                     rocblas_double_complex* dl,
+                                     rocblas_int incdl,
+                                     rocblas_stride stDL,
+                                     rocblas_double_complex* d,
+                                     rocblas_int incd,
+                                     rocblas_stride stD,
+                                     rocblas_double_complex* du,
+                                     rocblas_int incdu,
+                                     rocblas_stride stDU,
+                                     rocblas_double_complex* dw,
+                                     rocblas_int incdw,
+                                     rocblas_stride stDW,
+                                     rocblas_double_complex* B,
+                                     rocblas_int incb,
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    if(INTERLEAVED)
+        return rocsolver_zgpsv_interleaved_batched(handle, n, nrhs, ds, incds, stDS, dl, incdl,
+                                                   stDL, d, incd, stD, du, incdu, stDU, dw, incdw,
+                                                   stDW, B, incb, ldb, stB, info, bc);
+    else
+        return rocsolver_zgpsv_strided_batched(handle, n, nrhs, ds, stDS, dl, stDL, d, stD, du,
+                                               stDU, dw, stDW, B, ldb, stB, info, bc);
+}
+/********************************************************/
+
+/******************** GETRI_OUTOFPLACE ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 float* A,
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* ipiv,
+                                                 rocblas_stride stP,
+                                                 float* C,
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return STRIDED ? rocsolver_sgetri_outofplace_strided_batched(handle, n, A, lda, stA, ipiv, stP,
+                                                                 C, ldc, stC, info, bc)
+                   : rocsolver_sgetri_outofplace(handle, n, A, lda, ipiv, C, ldc, info);
+}
+
+inline rocblas_status rocsolver_getri_outofplace(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int n,
+                                                 double* A,
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_int* ipiv,
+                                                 rocblas_stride stP,
+                                                 double* C,
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dgetri_outofplace_strided_batched(handle, n, A, lda, stA, ipiv, stP,
                                                                  C, ldc, stC, info, bc)
                    : rocsolver_dgetri_outofplace(handle, n, A, lda, ipiv, C, ldc, info);
 }
@@ -5919,6 +8997,106 @@ inline rocblas_status rocsolver_getri_npvt(bool STRIDED,
 }
 /********************************************************/
 
+/******************** GETRI_DIRECT ********************/
+// strided_batched
+inline rocblas_status rocsolver_getri_direct(bool STRIDED,
+                                             rocblas_handle handle,
+                                             rocblas_int n,
+                                             float* A,
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return rocsolver_sgetri_direct_strided_batched(handle, n, A, lda, stA, info, bc);
+}
+
+inline rocblas_status rocsolver_getri_direct(bool STRIDED,
+                                             rocblas_handle handle,
+                                             rocblas_int n,
+                                             double* A,
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return rocsolver_dgetri_direct_strided_batched(handle, n, A, lda, stA, info, bc);
+}
+
+inline rocblas_status rocsolver_getri_direct(bool STRIDED,
+                                             rocblas_handle handle,
+                                             rocblas_int n,
+                                             rocblas_float_complex* A,
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return rocsolver_cgetri_direct_strided_batched(handle, n, A, lda, stA, info, bc);
+}
+
+inline rocblas_status rocsolver_getri_direct(bool STRIDED,
+                                             rocblas_handle handle,
+                                             rocblas_int n,
+                                             rocblas_double_complex* A,
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return rocsolver_zgetri_direct_strided_batched(handle, n, A, lda, stA, info, bc);
+}
+
+// batched
+inline rocblas_status rocsolver_getri_direct(bool STRIDED,
+                                             rocblas_handle handle,
+                                             rocblas_int n,
+                                             float* const A[],
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return rocsolver_sgetri_direct_batched(handle, n, A, lda, info, bc);
+}
+
+inline rocblas_status rocsolver_getri_direct(bool STRIDED,
+                                             rocblas_handle handle,
+                                             rocblas_int n,
+                                             double* const A[],
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return rocsolver_dgetri_direct_batched(handle, n, A, lda, info, bc);
+}
+
+inline rocblas_status rocsolver_getri_direct(bool STRIDED,
+                                             rocblas_handle handle,
+                                             rocblas_int n,
+                                             rocblas_float_complex* const A[],
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return rocsolver_cgetri_direct_batched(handle, n, A, lda, info, bc);
+}
+
+inline rocblas_status rocsolver_getri_direct(bool STRIDED,
+                                             rocblas_handle handle,
+                                             rocblas_int n,
+                                             rocblas_double_complex* const A[],
+                                             rocblas_int lda,
+                                             rocblas_stride stA,
+                                             rocblas_int* info,
+                                             rocblas_int bc)
+{
+    return rocsolver_zgetri_direct_batched(handle, n, A, lda, info, bc);
+}
+/********************************************************/
+
 /******************** TRTRI ********************/
 // normal and strided_batched
 inline rocblas_status rocsolver_trtri(bool STRIDED,
@@ -6094,31 +9272,115 @@ inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
                                             rocblas_int bc)
 {
     if(STRIDED)
-        return GEQRF ? rocsolver_cgeqrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_cgeqr2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+        return GEQRF ? rocsolver_cgeqrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_cgeqr2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GEQRF ? rocsolver_cgeqrf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_cgeqr2(handle, m, n, A, lda, ipiv);
+}
+
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_double_complex* A,
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_double_complex* ipiv,
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    if(STRIDED)
+        return GEQRF ? rocsolver_zgeqrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
+                     : rocsolver_zgeqr2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return GEQRF ? rocsolver_zgeqrf(handle, m, n, A, lda, ipiv)
+                     : rocsolver_zgeqr2(handle, m, n, A, lda, ipiv);
+}
+
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            int64_t m,
+                                            int64_t n,
+                                            float* A,
+                                            int64_t lda,
+                                            rocblas_stride stA,
+                                            float* ipiv,
+                                            rocblas_stride stP,
+                                            int64_t bc)
+{
+    if(!GEQRF)
+        return rocblas_status_not_implemented;
+
+    if(STRIDED)
+        return rocsolver_sgeqrf_strided_batched_64(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return rocsolver_sgeqrf_64(handle, m, n, A, lda, ipiv);
+}
+
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            int64_t m,
+                                            int64_t n,
+                                            double* A,
+                                            int64_t lda,
+                                            rocblas_stride stA,
+                                            double* ipiv,
+                                            rocblas_stride stP,
+                                            int64_t bc)
+{
+    if(!GEQRF)
+        return rocblas_status_not_implemented;
+
+    if(STRIDED)
+        return rocsolver_dgeqrf_strided_batched_64(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return rocsolver_dgeqrf_64(handle, m, n, A, lda, ipiv);
+}
+
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            int64_t m,
+                                            int64_t n,
+                                            rocblas_float_complex* A,
+                                            int64_t lda,
+                                            rocblas_stride stA,
+                                            rocblas_float_complex* ipiv,
+                                            rocblas_stride stP,
+                                            int64_t bc)
+{
+    if(!GEQRF)
+        return rocblas_status_not_implemented;
+
+    if(STRIDED)
+        return rocsolver_cgeqrf_strided_batched_64(handle, m, n, A, lda, stA, ipiv, stP, bc);
     else
-        return GEQRF ? rocsolver_cgeqrf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_cgeqr2(handle, m, n, A, lda, ipiv);
+        return rocsolver_cgeqrf_64(handle, m, n, A, lda, ipiv);
 }
 
 inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
                                             bool GEQRF,
                                             rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
+                                            int64_t m,
+                                            int64_t n,
                                             rocblas_double_complex* A,
-                                            rocblas_int lda,
+                                            int64_t lda,
                                             rocblas_stride stA,
                                             rocblas_double_complex* ipiv,
                                             rocblas_stride stP,
-                                            rocblas_int bc)
+                                            int64_t bc)
 {
+    if(!GEQRF)
+        return rocblas_status_not_implemented;
+
     if(STRIDED)
-        return GEQRF ? rocsolver_zgeqrf_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc)
-                     : rocsolver_zgeqr2_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+        return rocsolver_zgeqrf_strided_batched_64(handle, m, n, A, lda, stA, ipiv, stP, bc);
     else
-        return GEQRF ? rocsolver_zgeqrf(handle, m, n, A, lda, ipiv)
-                     : rocsolver_zgeqr2(handle, m, n, A, lda, ipiv);
+        return rocsolver_zgeqrf_64(handle, m, n, A, lda, ipiv);
 }
 
 // batched
@@ -6186,6 +9448,70 @@ inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
                  : rocsolver_zgeqr2_batched(handle, m, n, A, lda, ipiv, stP, bc);
 }
 
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            int64_t m,
+                                            int64_t n,
+                                            float* const A[],
+                                            int64_t lda,
+                                            rocblas_stride stA,
+                                            float* ipiv,
+                                            rocblas_stride stP,
+                                            int64_t bc)
+{
+    return GEQRF ? rocsolver_sgeqrf_batched_64(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocblas_status_not_implemented;
+}
+
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            int64_t m,
+                                            int64_t n,
+                                            double* const A[],
+                                            int64_t lda,
+                                            rocblas_stride stA,
+                                            double* ipiv,
+                                            rocblas_stride stP,
+                                            int64_t bc)
+{
+    return GEQRF ? rocsolver_dgeqrf_batched_64(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocblas_status_not_implemented;
+}
+
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            int64_t m,
+                                            int64_t n,
+                                            rocblas_float_complex* const A[],
+                                            int64_t lda,
+                                            rocblas_stride stA,
+                                            rocblas_float_complex* ipiv,
+                                            rocblas_stride stP,
+                                            int64_t bc)
+{
+    return GEQRF ? rocsolver_cgeqrf_batched_64(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocblas_status_not_implemented;
+}
+
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            int64_t m,
+                                            int64_t n,
+                                            rocblas_double_complex* const A[],
+                                            int64_t lda,
+                                            rocblas_stride stA,
+                                            rocblas_double_complex* ipiv,
+                                            rocblas_stride stP,
+                                            int64_t bc)
+{
+    return GEQRF ? rocsolver_zgeqrf_batched_64(handle, m, n, A, lda, ipiv, stP, bc)
+                 : rocblas_status_not_implemented;
+}
+
 // ptr_batched
 inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
                                             bool GEQRF,
@@ -6231,24 +9557,350 @@ inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
                                             rocblas_stride stP,
                                             rocblas_int bc)
 {
-    return GEQRF ? rocsolver_cgeqrf_ptr_batched(handle, m, n, A, lda, ipiv, bc)
-                 : rocblas_status_not_implemented;
+    return GEQRF ? rocsolver_cgeqrf_ptr_batched(handle, m, n, A, lda, ipiv, bc)
+                 : rocblas_status_not_implemented;
+}
+
+inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
+                                            bool GEQRF,
+                                            rocblas_handle handle,
+                                            rocblas_int m,
+                                            rocblas_int n,
+                                            rocblas_double_complex* const A[],
+                                            rocblas_int lda,
+                                            rocblas_stride stA,
+                                            rocblas_double_complex* const ipiv[],
+                                            rocblas_stride stP,
+                                            rocblas_int bc)
+{
+    return GEQRF ? rocsolver_zgeqrf_ptr_batched(handle, m, n, A, lda, ipiv, bc)
+                 : rocblas_status_not_implemented;
+}
+/********************************************************/
+
+/******************** GEQRF_TSQR ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_geqrf_tsqr(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_int m,
+                                           rocblas_int n,
+                                           float* A,
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           float* ipiv,
+                                           rocblas_stride stP,
+                                           rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_sgeqrf_tsqr_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return rocsolver_sgeqrf_tsqr(handle, m, n, A, lda, ipiv);
+}
+
+inline rocblas_status rocsolver_geqrf_tsqr(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_int m,
+                                           rocblas_int n,
+                                           double* A,
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           double* ipiv,
+                                           rocblas_stride stP,
+                                           rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dgeqrf_tsqr_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return rocsolver_dgeqrf_tsqr(handle, m, n, A, lda, ipiv);
+}
+
+inline rocblas_status rocsolver_geqrf_tsqr(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_int m,
+                                           rocblas_int n,
+                                           rocblas_float_complex* A,
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_float_complex* ipiv,
+                                           rocblas_stride stP,
+                                           rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_cgeqrf_tsqr_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return rocsolver_cgeqrf_tsqr(handle, m, n, A, lda, ipiv);
+}
+
+inline rocblas_status rocsolver_geqrf_tsqr(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_int m,
+                                           rocblas_int n,
+                                           rocblas_double_complex* A,
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_double_complex* ipiv,
+                                           rocblas_stride stP,
+                                           rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zgeqrf_tsqr_strided_batched(handle, m, n, A, lda, stA, ipiv, stP, bc);
+    else
+        return rocsolver_zgeqrf_tsqr(handle, m, n, A, lda, ipiv);
+}
+
+
+// batched
+inline rocblas_status rocsolver_geqrf_tsqr(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_int m,
+                                           rocblas_int n,
+                                           float* const A[],
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           float* ipiv,
+                                           rocblas_stride stP,
+                                           rocblas_int bc)
+{
+    return rocsolver_sgeqrf_tsqr_batched(handle, m, n, A, lda, ipiv, stP, bc);
+}
+
+inline rocblas_status rocsolver_geqrf_tsqr(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_int m,
+                                           rocblas_int n,
+                                           double* const A[],
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           double* ipiv,
+                                           rocblas_stride stP,
+                                           rocblas_int bc)
+{
+    return rocsolver_dgeqrf_tsqr_batched(handle, m, n, A, lda, ipiv, stP, bc);
+}
+
+inline rocblas_status rocsolver_geqrf_tsqr(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_int m,
+                                           rocblas_int n,
+                                           rocblas_float_complex* const A[],
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_float_complex* ipiv,
+                                           rocblas_stride stP,
+                                           rocblas_int bc)
+{
+    return rocsolver_cgeqrf_tsqr_batched(handle, m, n, A, lda, ipiv, stP, bc);
+}
+
+inline rocblas_status rocsolver_geqrf_tsqr(bool STRIDED,
+                                           rocblas_handle handle,
+                                           rocblas_int m,
+                                           rocblas_int n,
+                                           rocblas_double_complex* const A[],
+                                           rocblas_int lda,
+                                           rocblas_stride stA,
+                                           rocblas_double_complex* ipiv,
+                                           rocblas_stride stP,
+                                           rocblas_int bc)
+{
+    return rocsolver_zgeqrf_tsqr_batched(handle, m, n, A, lda, ipiv, stP, bc);
+}
+/********************************************************/
+
+/******************** GEQP3 ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
+                                      bool TRUNCATED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      float* ipiv,
+                                      rocblas_stride stP,
+                                      float tol,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return TRUNCATED ? rocsolver_sgeqp3_truncated_strided_batched(handle, m, n, A, lda, stA,
+                                                                      jpvt, stJ, ipiv, stP, tol,
+                                                                      rank, bc)
+                         : rocsolver_sgeqp3_strided_batched(handle, m, n, A, lda, stA, jpvt, stJ,
+                                                            ipiv, stP, bc);
+    else
+        return TRUNCATED ? rocsolver_sgeqp3_truncated(handle, m, n, A, lda, jpvt, ipiv, tol, rank)
+                         : rocsolver_sgeqp3(handle, m, n, A, lda, jpvt, ipiv);
+}
+
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
+                                      bool TRUNCATED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      double* ipiv,
+                                      rocblas_stride stP,
+                                      double tol,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return TRUNCATED ? rocsolver_dgeqp3_truncated_strided_batched(handle, m, n, A, lda, stA,
+                                                                      jpvt, stJ, ipiv, stP, tol,
+                                                                      rank, bc)
+                         : rocsolver_dgeqp3_strided_batched(handle, m, n, A, lda, stA, jpvt, stJ,
+                                                            ipiv, stP, bc);
+    else
+        return TRUNCATED ? rocsolver_dgeqp3_truncated(handle, m, n, A, lda, jpvt, ipiv, tol, rank)
+                         : rocsolver_dgeqp3(handle, m, n, A, lda, jpvt, ipiv);
+}
+
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
+                                      bool TRUNCATED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      rocblas_float_complex* ipiv,
+                                      rocblas_stride stP,
+                                      float tol,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return TRUNCATED ? rocsolver_cgeqp3_truncated_strided_batched(handle, m, n, A, lda, stA,
+                                                                      jpvt, stJ, ipiv, stP, tol,
+                                                                      rank, bc)
+                         : rocsolver_cgeqp3_strided_batched(handle, m, n, A, lda, stA, jpvt, stJ,
+                                                            ipiv, stP, bc);
+    else
+        return TRUNCATED ? rocsolver_cgeqp3_truncated(handle, m, n, A, lda, jpvt, ipiv, tol, rank)
+                         : rocsolver_cgeqp3(handle, m, n, A, lda, jpvt, ipiv);
+}
+
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
+                                      bool TRUNCATED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      rocblas_double_complex* ipiv,
+                                      rocblas_stride stP,
+                                      double tol,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return TRUNCATED ? rocsolver_zgeqp3_truncated_strided_batched(handle, m, n, A, lda, stA,
+                                                                      jpvt, stJ, ipiv, stP, tol,
+                                                                      rank, bc)
+                         : rocsolver_zgeqp3_strided_batched(handle, m, n, A, lda, stA, jpvt, stJ,
+                                                            ipiv, stP, bc);
+    else
+        return TRUNCATED ? rocsolver_zgeqp3_truncated(handle, m, n, A, lda, jpvt, ipiv, tol, rank)
+                         : rocsolver_zgeqp3(handle, m, n, A, lda, jpvt, ipiv);
+}
+
+
+// batched
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
+                                      bool TRUNCATED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      float* ipiv,
+                                      rocblas_stride stP,
+                                      float tol,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
+{
+    return TRUNCATED ? rocsolver_sgeqp3_truncated_batched(handle, m, n, A, lda, jpvt, stJ, ipiv,
+                                                          stP, tol, rank, bc)
+                     : rocsolver_sgeqp3_batched(handle, m, n, A, lda, jpvt, stJ, ipiv, stP, bc);
+}
+
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
+                                      bool TRUNCATED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      double* ipiv,
+                                      rocblas_stride stP,
+                                      double tol,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
+{
+    return TRUNCATED ? rocsolver_dgeqp3_truncated_batched(handle, m, n, A, lda, jpvt, stJ, ipiv,
+                                                          stP, tol, rank, bc)
+                     : rocsolver_dgeqp3_batched(handle, m, n, A, lda, jpvt, stJ, ipiv, stP, bc);
 }
 
-inline rocblas_status rocsolver_geqr2_geqrf(bool STRIDED,
-                                            bool GEQRF,
-                                            rocblas_handle handle,
-                                            rocblas_int m,
-                                            rocblas_int n,
-                                            rocblas_double_complex* const A[],
-                                            rocblas_int lda,
-                                            rocblas_stride stA,
-                                            rocblas_double_complex* const ipiv[],
-                                            rocblas_stride stP,
-                                            rocblas_int bc)
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
+                                      bool TRUNCATED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      rocblas_float_complex* ipiv,
+                                      rocblas_stride stP,
+                                      float tol,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
 {
-    return GEQRF ? rocsolver_zgeqrf_ptr_batched(handle, m, n, A, lda, ipiv, bc)
-                 : rocblas_status_not_implemented;
+    return TRUNCATED ? rocsolver_cgeqp3_truncated_batched(handle, m, n, A, lda, jpvt, stJ, ipiv,
+                                                          stP, tol, rank, bc)
+                     : rocsolver_cgeqp3_batched(handle, m, n, A, lda, jpvt, stJ, ipiv, stP, bc);
+}
+
+inline rocblas_status rocsolver_geqp3(bool STRIDED,
+                                      bool TRUNCATED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      rocblas_double_complex* ipiv,
+                                      rocblas_stride stP,
+                                      double tol,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
+{
+    return TRUNCATED ? rocsolver_zgeqp3_truncated_batched(handle, m, n, A, lda, jpvt, stJ, ipiv,
+                                                          stP, tol, rank, bc)
+                     : rocsolver_zgeqp3_batched(handle, m, n, A, lda, jpvt, stJ, ipiv, stP, bc);
 }
 /********************************************************/
 
@@ -6820,43 +10472,386 @@ inline rocblas_status rocsolver_gels(bool STRIDED,
                                      rocblas_int* info,
                                      rocblas_int bc)
 {
-    return rocsolver_dgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+    return rocsolver_dgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_gels(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_float_complex* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_float_complex* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_cgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_gels(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     rocblas_int m,
+                                     rocblas_int n,
+                                     rocblas_int nrhs,
+                                     rocblas_double_complex* const A[],
+                                     rocblas_int lda,
+                                     rocblas_stride stA,
+                                     rocblas_double_complex* const B[],
+                                     rocblas_int ldb,
+                                     rocblas_stride stB,
+                                     rocblas_int* info,
+                                     rocblas_int bc)
+{
+    return rocsolver_zgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+}
+
+// normal and strided_batched (64-bit)
+inline rocblas_status rocsolver_gels(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     int64_t m,
+                                     int64_t n,
+                                     int64_t nrhs,
+                                     float* A,
+                                     int64_t lda,
+                                     rocblas_stride stA,
+                                     float* B,
+                                     int64_t ldb,
+                                     rocblas_stride stB,
+                                     int64_t* info,
+                                     int64_t bc)
+{
+    if(STRIDED)
+        return rocsolver_sgels_strided_batched_64(handle, trans, m, n, nrhs, A, lda, stA, B, ldb,
+                                                  stB, info, bc);
+    else
+        return rocsolver_sgels_64(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_gels(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     int64_t m,
+                                     int64_t n,
+                                     int64_t nrhs,
+                                     double* A,
+                                     int64_t lda,
+                                     rocblas_stride stA,
+                                     double* B,
+                                     int64_t ldb,
+                                     rocblas_stride stB,
+                                     int64_t* info,
+                                     int64_t bc)
+{
+    if(STRIDED)
+        return rocsolver_dgels_strided_batched_64(handle, trans, m, n, nrhs, A, lda, stA, B, ldb,
+                                                  stB, info, bc);
+    else
+        return rocsolver_dgels_64(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_gels(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     int64_t m,
+                                     int64_t n,
+                                     int64_t nrhs,
+                                     rocblas_float_complex* A,
+                                     int64_t lda,
+                                     rocblas_stride stA,
+                                     rocblas_float_complex* B,
+                                     int64_t ldb,
+                                     rocblas_stride stB,
+                                     int64_t* info,
+                                     int64_t bc)
+{
+    if(STRIDED)
+        return rocsolver_cgels_strided_batched_64(handle, trans, m, n, nrhs, A, lda, stA, B, ldb,
+                                                  stB, info, bc);
+    else
+        return rocsolver_cgels_64(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
+}
+
+inline rocblas_status rocsolver_gels(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     int64_t m,
+                                     int64_t n,
+                                     int64_t nrhs,
+                                     rocblas_double_complex* A,
+                                     int64_t lda,
+                                     rocblas_stride stA,
+                                     rocblas_double_complex* B,
+                                     int64_t ldb,
+                                     rocblas_stride stB,
+                                     int64_t* info,
+                                     int64_t bc)
+{
+    if(STRIDED)
+        return rocsolver_zgels_strided_batched_64(handle, trans, m, n, nrhs, A, lda, stA, B, ldb,
+                                                  stB, info, bc);
+    else
+        return rocsolver_zgels_64(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
+}
+
+// batched (64-bit)
+inline rocblas_status rocsolver_gels(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     int64_t m,
+                                     int64_t n,
+                                     int64_t nrhs,
+                                     float* const A[],
+                                     int64_t lda,
+                                     rocblas_stride stA,
+                                     float* const B[],
+                                     int64_t ldb,
+                                     rocblas_stride stB,
+                                     int64_t* info,
+                                     int64_t bc)
+{
+    return rocsolver_sgels_batched_64(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_gels(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     int64_t m,
+                                     int64_t n,
+                                     int64_t nrhs,
+                                     double* const A[],
+                                     int64_t lda,
+                                     rocblas_stride stA,
+                                     double* const B[],
+                                     int64_t ldb,
+                                     rocblas_stride stB,
+                                     int64_t* info,
+                                     int64_t bc)
+{
+    return rocsolver_dgels_batched_64(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_gels(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     int64_t m,
+                                     int64_t n,
+                                     int64_t nrhs,
+                                     rocblas_float_complex* const A[],
+                                     int64_t lda,
+                                     rocblas_stride stA,
+                                     rocblas_float_complex* const B[],
+                                     int64_t ldb,
+                                     rocblas_stride stB,
+                                     int64_t* info,
+                                     int64_t bc)
+{
+    return rocsolver_cgels_batched_64(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+}
+
+inline rocblas_status rocsolver_gels(bool STRIDED,
+                                     rocblas_handle handle,
+                                     rocblas_operation trans,
+                                     int64_t m,
+                                     int64_t n,
+                                     int64_t nrhs,
+                                     rocblas_double_complex* const A[],
+                                     int64_t lda,
+                                     rocblas_stride stA,
+                                     rocblas_double_complex* const B[],
+                                     int64_t ldb,
+                                     rocblas_stride stB,
+                                     int64_t* info,
+                                     int64_t bc)
+{
+    return rocsolver_zgels_batched_64(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+}
+/********************************************************/
+
+/******************** GELSY ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      float* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      float rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_sgelsy_strided_batched(handle, m, n, nrhs, A, lda, stA, B, ldb, stB, jpvt,
+                                                stJ, rcond, rank, bc);
+    else
+        return rocsolver_sgelsy(handle, m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank);
+}
+
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      double* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      double rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_dgelsy_strided_batched(handle, m, n, nrhs, A, lda, stA, B, ldb, stB, jpvt,
+                                                stJ, rcond, rank, bc);
+    else
+        return rocsolver_dgelsy(handle, m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank);
+}
+
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      float rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_cgelsy_strided_batched(handle, m, n, nrhs, A, lda, stA, B, ldb, stB, jpvt,
+                                                stJ, rcond, rank, bc);
+    else
+        return rocsolver_cgelsy(handle, m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank);
+}
+
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* A,
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* B,
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      double rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
+{
+    if(STRIDED)
+        return rocsolver_zgelsy_strided_batched(handle, m, n, nrhs, A, lda, stA, B, ldb, stB, jpvt,
+                                                stJ, rcond, rank, bc);
+    else
+        return rocsolver_zgelsy(handle, m, n, nrhs, A, lda, B, ldb, jpvt, rcond, rank);
+}
+
+
+// batched
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      float* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      float* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      float rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
+{
+    return rocsolver_sgelsy_batched(handle, m, n, nrhs, A, lda, B, ldb, jpvt, stJ, rcond, rank, bc);
+}
+
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      double* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      double* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      double rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
+{
+    return rocsolver_dgelsy_batched(handle, m, n, nrhs, A, lda, B, ldb, jpvt, stJ, rcond, rank, bc);
 }
 
-inline rocblas_status rocsolver_gels(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_operation trans,
-                                     rocblas_int m,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     rocblas_float_complex* const A[],
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     rocblas_float_complex* const B[],
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_float_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_float_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      float rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
 {
-    return rocsolver_cgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+    return rocsolver_cgelsy_batched(handle, m, n, nrhs, A, lda, B, ldb, jpvt, stJ, rcond, rank, bc);
 }
 
-inline rocblas_status rocsolver_gels(bool STRIDED,
-                                     rocblas_handle handle,
-                                     rocblas_operation trans,
-                                     rocblas_int m,
-                                     rocblas_int n,
-                                     rocblas_int nrhs,
-                                     rocblas_double_complex* const A[],
-                                     rocblas_int lda,
-                                     rocblas_stride stA,
-                                     rocblas_double_complex* const B[],
-                                     rocblas_int ldb,
-                                     rocblas_stride stB,
-                                     rocblas_int* info,
-                                     rocblas_int bc)
+inline rocblas_status rocsolver_gelsy(bool STRIDED,
+                                      rocblas_handle handle,
+                                      rocblas_int m,
+                                      rocblas_int n,
+                                      rocblas_int nrhs,
+                                      rocblas_double_complex* const A[],
+                                      rocblas_int lda,
+                                      rocblas_stride stA,
+                                      rocblas_double_complex* const B[],
+                                      rocblas_int ldb,
+                                      rocblas_stride stB,
+                                      rocblas_int* jpvt,
+                                      rocblas_stride stJ,
+                                      double rcond,
+                                      rocblas_int* rank,
+                                      rocblas_int bc)
 {
-    return rocsolver_zgels_batched(handle, trans, m, n, nrhs, A, lda, B, ldb, info, bc);
+    return rocsolver_zgelsy_batched(handle, m, n, nrhs, A, lda, B, ldb, jpvt, stJ, rcond, rank, bc);
 }
 /********************************************************/
 
@@ -10738,6 +14733,636 @@ inline rocblas_status rocsolver_geblttrs_npvt_interleaved(rocblas_handle handle,
 }
 /********************************************************/
 
+/******************** GEBLTTRF_NPVT_CR ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_geblttrf_npvt_cr(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int nb,
+                                                 rocblas_int nblocks,
+                                                 float* A,
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 float* B,
+                                                 rocblas_int ldb,
+                                                 rocblas_stride stB,
+                                                 float* C,
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 float* F,
+                                                 rocblas_stride stF,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return STRIDED ? rocsolver_sgeblttrf_npvt_cr_strided_batched(handle, nb, nblocks, A, lda, stA,
+                                                                 B, ldb, stB, C, ldc, stC, F, stF,
+                                                                 info, bc)
+                   : rocsolver_sgeblttrf_npvt_cr(handle, nb, nblocks, A, lda, B, ldb, C, ldc, F,
+                                                 info);
+}
+
+inline rocblas_status rocsolver_geblttrf_npvt_cr(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int nb,
+                                                 rocblas_int nblocks,
+                                                 double* A,
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 double* B,
+                                                 rocblas_int ldb,
+                                                 rocblas_stride stB,
+                                                 double* C,
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 double* F,
+                                                 rocblas_stride stF,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dgeblttrf_npvt_cr_strided_batched(handle, nb, nblocks, A, lda, stA,
+                                                                 B, ldb, stB, C, ldc, stC, F, stF,
+                                                                 info, bc)
+                   : rocsolver_dgeblttrf_npvt_cr(handle, nb, nblocks, A, lda, B, ldb, C, ldc, F,
+                                                 info);
+}
+
+inline rocblas_status rocsolver_geblttrf_npvt_cr(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int nb,
+                                                 rocblas_int nblocks,
+                                                 rocblas_float_complex* A,
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_float_complex* B,
+                                                 rocblas_int ldb,
+                                                 rocblas_stride stB,
+                                                 rocblas_float_complex* C,
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 rocblas_float_complex* F,
+                                                 rocblas_stride stF,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return STRIDED ? rocsolver_cgeblttrf_npvt_cr_strided_batched(handle, nb, nblocks, A, lda, stA,
+                                                                 B, ldb, stB, C, ldc, stC, F, stF,
+                                                                 info, bc)
+                   : rocsolver_cgeblttrf_npvt_cr(handle, nb, nblocks, A, lda, B, ldb, C, ldc, F,
+                                                 info);
+}
+
+inline rocblas_status rocsolver_geblttrf_npvt_cr(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int nb,
+                                                 rocblas_int nblocks,
+                                                 rocblas_double_complex* A,
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_double_complex* B,
+                                                 rocblas_int ldb,
+                                                 rocblas_stride stB,
+                                                 rocblas_double_complex* C,
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 rocblas_double_complex* F,
+                                                 rocblas_stride stF,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zgeblttrf_npvt_cr_strided_batched(handle, nb, nblocks, A, lda, stA,
+                                                                 B, ldb, stB, C, ldc, stC, F, stF,
+                                                                 info, bc)
+                   : rocsolver_zgeblttrf_npvt_cr(handle, nb, nblocks, A, lda, B, ldb, C, ldc, F,
+                                                 info);
+}
+
+// batched
+inline rocblas_status rocsolver_geblttrf_npvt_cr(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int nb,
+                                                 rocblas_int nblocks,
+                                                 float* const A[],
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 float* const B[],
+                                                 rocblas_int ldb,
+                                                 rocblas_stride stB,
+                                                 float* const C[],
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 float* F,
+                                                 rocblas_stride stF,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return rocsolver_sgeblttrf_npvt_cr_batched(handle, nb, nblocks, A, lda, B, ldb, C, ldc, F, stF,
+                                               info, bc);
+}
+
+inline rocblas_status rocsolver_geblttrf_npvt_cr(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int nb,
+                                                 rocblas_int nblocks,
+                                                 double* const A[],
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 double* const B[],
+                                                 rocblas_int ldb,
+                                                 rocblas_stride stB,
+                                                 double* const C[],
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 double* F,
+                                                 rocblas_stride stF,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return rocsolver_dgeblttrf_npvt_cr_batched(handle, nb, nblocks, A, lda, B, ldb, C, ldc, F, stF,
+                                               info, bc);
+}
+
+inline rocblas_status rocsolver_geblttrf_npvt_cr(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int nb,
+                                                 rocblas_int nblocks,
+                                                 rocblas_float_complex* const A[],
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_float_complex* const B[],
+                                                 rocblas_int ldb,
+                                                 rocblas_stride stB,
+                                                 rocblas_float_complex* const C[],
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 rocblas_float_complex* F,
+                                                 rocblas_stride stF,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return rocsolver_cgeblttrf_npvt_cr_batched(handle, nb, nblocks, A, lda, B, ldb, C, ldc, F, stF,
+                                               info, bc);
+}
+
+inline rocblas_status rocsolver_geblttrf_npvt_cr(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int nb,
+                                                 rocblas_int nblocks,
+                                                 rocblas_double_complex* const A[],
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_double_complex* const B[],
+                                                 rocblas_int ldb,
+                                                 rocblas_stride stB,
+                                                 rocblas_double_complex* const C[],
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 rocblas_double_complex* F,
+                                                 rocblas_stride stF,
+                                                 rocblas_int* info,
+                                                 rocblas_int bc)
+{
+    return rocsolver_zgeblttrf_npvt_cr_batched(handle, nb, nblocks, A, lda, B, ldb, C, ldc, F, stF,
+                                               info, bc);
+}
+/********************************************************/
+
+/******************** GEBLTTRF_NPVT_CR_INTERLEAVED ********************/
+// interleaved_batched
+inline rocblas_status rocsolver_geblttrf_npvt_cr_interleaved(rocblas_handle handle,
+                                                             rocblas_int nb,
+                                                             rocblas_int nblocks,
+                                                             float* A,
+                                                             rocblas_int inca,
+                                                             rocblas_int lda,
+                                                             rocblas_stride stA,
+                                                             float* B,
+                                                             rocblas_int incb,
+                                                             rocblas_int ldb,
+                                                             rocblas_stride stB,
+                                                             float* C,
+                                                             rocblas_int incc,
+                                                             rocblas_int ldc,
+                                                             rocblas_stride stC,
+                                                             float* F,
+                                                             rocblas_stride stF,
+                                                             rocblas_int* info,
+                                                             rocblas_int bc)
+{
+    return rocsolver_sgeblttrf_npvt_cr_interleaved_batched(handle, nb, nblocks, A, inca, lda, stA,
+                                                           B, incb, ldb, stB, C, incc, ldc, stC, F,
+                                                           stF, info, bc);
+}
+
+inline rocblas_status rocsolver_geblttrf_npvt_cr_interleaved(rocblas_handle handle,
+                                                             rocblas_int nb,
+                                                             rocblas_int nblocks,
+                                                             double* A,
+                                                             rocblas_int inca,
+                                                             rocblas_int lda,
+                                                             rocblas_stride stA,
+                                                             double* B,
+                                                             rocblas_int incb,
+                                                             rocblas_int ldb,
+                                                             rocblas_stride stB,
+                                                             double* C,
+                                                             rocblas_int incc,
+                                                             rocblas_int ldc,
+                                                             rocblas_stride stC,
+                                                             double* F,
+                                                             rocblas_stride stF,
+                                                             rocblas_int* info,
+                                                             rocblas_int bc)
+{
+    return rocsolver_dgeblttrf_npvt_cr_interleaved_batched(handle, nb, nblocks, A, inca, lda, stA,
+                                                           B, incb, ldb, stB, C, incc, ldc, stC, F,
+                                                           stF, info, bc);
+}
+
+inline rocblas_status rocsolver_geblttrf_npvt_cr_interleaved(rocblas_handle handle,
+                                                             rocblas_int nb,
+                                                             rocblas_int nblocks,
+                                                             rocblas_float_complex* A,
+                                                             rocblas_int inca,
+                                                             rocblas_int lda,
+                                                             rocblas_stride stA,
+                                                             rocblas_float_complex* B,
+                                                             rocblas_int incb,
+                                                             rocblas_int ldb,
+                                                             rocblas_stride stB,
+                                                             rocblas_float_complex* C,
+                                                             rocblas_int incc,
+                                                             rocblas_int ldc,
+                                                             rocblas_stride stC,
+                                                             rocblas_float_complex* F,
+                                                             rocblas_stride stF,
+                                                             rocblas_int* info,
+                                                             rocblas_int bc)
+{
+    return rocsolver_cgeblttrf_npvt_cr_interleaved_batched(handle, nb, nblocks, A, inca, lda, stA,
+                                                           B, incb, ldb, stB, C, incc, ldc, stC, F,
+                                                           stF, info, bc);
+}
+
+inline rocblas_status rocsolver_geblttrf_npvt_cr_interleaved(rocblas_handle handle,
+                                                             rocblas_int nb,
+                                                             rocblas_int nblocks,
+                                                             rocblas_double_complex* A,
+                                                             rocblas_int inca,
+                                                             rocblas_int lda,
+                                                             rocblas_stride stA,
+                                                             rocblas_double_complex* B,
+                                                             rocblas_int incb,
+                                                             rocblas_int ldb,
+                                                             rocblas_stride stB,
+                                                             rocblas_double_complex* C,
+                                                             rocblas_int incc,
+                                                             rocblas_int ldc,
+                                                             rocblas_stride stC,
+                                                             rocblas_double_complex* F,
+                                                             rocblas_stride stF,
+                                                             rocblas_int* info,
+                                                             rocblas_int bc)
+{
+    return rocsolver_zgeblttrf_npvt_cr_interleaved_batched(handle, nb, nblocks, A, inca, lda, stA,
+                                                           B, incb, ldb, stB, C, incc, ldc, stC, F,
+                                                           stF, info, bc);
+}
+/********************************************************/
+
+/******************** GEBLTTRS_NPVT_CR ********************/
+// normal and strided_batched
+inline rocblas_status rocsolver_geblttrs_npvt_cr(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int nb,
+                                                 rocblas_int nblocks,
+                                                 rocblas_int nrhs,
+                                                 float* A,
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 float* B,
+                                                 rocblas_int ldb,
+                                                 rocblas_stride stB,
+                                                 float* C,
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 float* F,
+                                                 rocblas_stride stF,
+                                                 float* X,
+                                                 rocblas_int ldx,
+                                                 rocblas_stride stX,
+                                                 rocblas_int bc)
+{
+    return STRIDED ? rocsolver_sgeblttrs_npvt_cr_strided_batched(handle, nb, nblocks, nrhs, A, lda,
+                                                                 stA, B, ldb, stB, C, ldc, stC, F,
+                                                                 stF, X, ldx, stX, bc)
+                   : rocsolver_sgeblttrs_npvt_cr(handle, nb, nblocks, nrhs, A, lda, B, ldb, C, ldc,
+                                                 F, X, ldx);
+}
+
+inline rocblas_status rocsolver_geblttrs_npvt_cr(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int nb,
+                                                 rocblas_int nblocks,
+                                                 rocblas_int nrhs,
+                                                 double* A,
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 double* B,
+                                                 rocblas_int ldb,
+                                                 rocblas_stride stB,
+                                                 double* C,
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 double* F,
+                                                 rocblas_stride stF,
+                                                 double* X,
+                                                 rocblas_int ldx,
+                                                 rocblas_stride stX,
+                                                 rocblas_int bc)
+{
+    return STRIDED ? rocsolver_dgeblttrs_npvt_cr_strided_batched(handle, nb, nblocks, nrhs, A, lda,
+                                                                 stA, B, ldb, stB, C, ldc, stC, F,
+                                                                 stF, X, ldx, stX, bc)
+                   : rocsolver_dgeblttrs_npvt_cr(handle, nb, nblocks, nrhs, A, lda, B, ldb, C, ldc,
+                                                 F, X, ldx);
+}
+
+inline rocblas_status rocsolver_geblttrs_npvt_cr(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int nb,
+                                                 rocblas_int nblocks,
+                                                 rocblas_int nrhs,
+                                                 rocblas_float_complex* A,
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_float_complex* B,
+                                                 rocblas_int ldb,
+                                                 rocblas_stride stB,
+                                                 rocblas_float_complex* C,
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 rocblas_float_complex* F,
+                                                 rocblas_stride stF,
+                                                 rocblas_float_complex* X,
+                                                 rocblas_int ldx,
+                                                 rocblas_stride stX,
+                                                 rocblas_int bc)
+{
+    return STRIDED ? rocsolver_cgeblttrs_npvt_cr_strided_batched(handle, nb, nblocks, nrhs, A, lda,
+                                                                 stA, B, ldb, stB, C, ldc, stC, F,
+                                                                 stF, X, ldx, stX, bc)
+                   : rocsolver_cgeblttrs_npvt_cr(handle, nb, nblocks, nrhs, A, lda, B, ldb, C, ldc,
+                                                 F, X, ldx);
+}
+
+inline rocblas_status rocsolver_geblttrs_npvt_cr(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int nb,
+                                                 rocblas_int nblocks,
+                                                 rocblas_int nrhs,
+                                                 rocblas_double_complex* A,
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_double_complex* B,
+                                                 rocblas_int ldb,
+                                                 rocblas_stride stB,
+                                                 rocblas_double_complex* C,
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 rocblas_double_complex* F,
+                                                 rocblas_stride stF,
+                                                 rocblas_double_complex* X,
+                                                 rocblas_int ldx,
+                                                 rocblas_stride stX,
+                                                 rocblas_int bc)
+{
+    return STRIDED ? rocsolver_zgeblttrs_npvt_cr_strided_batched(handle, nb, nblocks, nrhs, A, lda,
+                                                                 stA, B, ldb, stB, C, ldc, stC, F,
+                                                                 stF, X, ldx, stX, bc)
+                   : rocsolver_zgeblttrs_npvt_cr(handle, nb, nblocks, nrhs, A, lda, B, ldb, C, ldc,
+                                                 F, X, ldx);
+}
+
+// batched
+inline rocblas_status rocsolver_geblttrs_npvt_cr(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int nb,
+                                                 rocblas_int nblocks,
+                                                 rocblas_int nrhs,
+                                                 float* const A[],
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 float* const B[],
+                                                 rocblas_int ldb,
+                                                 rocblas_stride stB,
+                                                 float* const C[],
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 float* F,
+                                                 rocblas_stride stF,
+                                                 float* const X[],
+                                                 rocblas_int ldx,
+                                                 rocblas_stride stX,
+                                                 rocblas_int bc)
+{
+    return rocsolver_sgeblttrs_npvt_cr_batched(handle, nb, nblocks, nrhs, A, lda, B, ldb, C, ldc, F,
+                                               stF, X, ldx, bc);
+}
+
+inline rocblas_status rocsolver_geblttrs_npvt_cr(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int nb,
+                                                 rocblas_int nblocks,
+                                                 rocblas_int nrhs,
+                                                 double* const A[],
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 double* const B[],
+                                                 rocblas_int ldb,
+                                                 rocblas_stride stB,
+                                                 double* const C[],
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 double* F,
+                                                 rocblas_stride stF,
+                                                 double* const X[],
+                                                 rocblas_int ldx,
+                                                 rocblas_stride stX,
+                                                 rocblas_int bc)
+{
+    return rocsolver_dgeblttrs_npvt_cr_batched(handle, nb, nblocks, nrhs, A, lda, B, ldb, C, ldc, F,
+                                               stF, X, ldx, bc);
+}
+
+inline rocblas_status rocsolver_geblttrs_npvt_cr(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int nb,
+                                                 rocblas_int nblocks,
+                                                 rocblas_int nrhs,
+                                                 rocblas_float_complex* const A[],
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_float_complex* const B[],
+                                                 rocblas_int ldb,
+                                                 rocblas_stride stB,
+                                                 rocblas_float_complex* const C[],
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 rocblas_float_complex* F,
+                                                 rocblas_stride stF,
+                                                 rocblas_float_complex* const X[],
+                                                 rocblas_int ldx,
+                                                 rocblas_stride stX,
+                                                 rocblas_int bc)
+{
+    return rocsolver_cgeblttrs_npvt_cr_batched(handle, nb, nblocks, nrhs, A, lda, B, ldb, C, ldc, F,
+                                               stF, X, ldx, bc);
+}
+
+inline rocblas_status rocsolver_geblttrs_npvt_cr(bool STRIDED,
+                                                 rocblas_handle handle,
+                                                 rocblas_int nb,
+                                                 rocblas_int nblocks,
+                                                 rocblas_int nrhs,
+                                                 rocblas_double_complex* const A[],
+                                                 rocblas_int lda,
+                                                 rocblas_stride stA,
+                                                 rocblas_double_complex* const B[],
+                                                 rocblas_int ldb,
+                                                 rocblas_stride stB,
+                                                 rocblas_double_complex* const C[],
+                                                 rocblas_int ldc,
+                                                 rocblas_stride stC,
+                                                 rocblas_double_complex* F,
+                                                 rocblas_stride stF,
+                                                 rocblas_double_complex* const X[],
+                                                 rocblas_int ldx,
+                                                 rocblas_stride stX,
+                                                 rocblas_int bc)
+{
+    return rocsolver_zgeblttrs_npvt_cr_batched(handle, nb, nblocks, nrhs, A, lda, B, ldb, C, ldc, F,
+                                               stF, X, ldx, bc);
+}
+/********************************************************/
+
+/******************** GEBLTTRS_NPVT_CR_INTERLEAVED ********************/
+// interleaved_batched
+inline rocblas_status rocsolver_geblttrs_npvt_cr_interleaved(rocblas_handle handle,
+                                                             rocblas_int nb,
+                                                             rocblas_int nblocks,
+                                                             rocblas_int nrhs,
+                                                             float* A,
+                                                             rocblas_int inca,
+                                                             rocblas_int lda,
+                                                             rocblas_stride stA,
+                                                             float* B,
+                                                             rocblas_int incb,
+                                                             rocblas_int ldb,
+                                                             rocblas_stride stB,
+                                                             float* C,
+                                                             rocblas_int incc,
+                                                             rocblas_int ldc,
+                                                             rocblas_stride stC,
+                                                             float* F,
+                                                             rocblas_stride stF,
+                                                             float* X,
+                                                             rocblas_int incx,
+                                                             rocblas_int ldx,
+                                                             rocblas_stride stX,
+                                                             rocblas_int bc)
+{
+    return rocsolver_sgeblttrs_npvt_cr_interleaved_batched(handle, nb, nblocks, nrhs, A, inca, lda,
+                                                           stA, B, incb, ldb, stB, C, incc, ldc,
+                                                           stC, F, stF, X, incx, ldx, stX, bc);
+}
+
+inline rocblas_status rocsolver_geblttrs_npvt_cr_interleaved(rocblas_handle handle,
+                                                             rocblas_int nb,
+                                                             rocblas_int nblocks,
+                                                             rocblas_int nrhs,
+                                                             double* A,
+                                                             rocblas_int inca,
+                                                             rocblas_int lda,
+                                                             rocblas_stride stA,
+                                                             double* B,
+                                                             rocblas_int incb,
+                                                             rocblas_int ldb,
+                                                             rocblas_stride stB,
+                                                             double* C,
+                                                             rocblas_int incc,
+                                                             rocblas_int ldc,
+                                                             rocblas_stride stC,
+                                                             double* F,
+                                                             rocblas_stride stF,
+                                                             double* X,
+                                                             rocblas_int incx,
+                                                             rocblas_int ldx,
+                                                             rocblas_stride stX,
+                                                             rocblas_int bc)
+{
+    return rocsolver_dgeblttrs_npvt_cr_interleaved_batched(handle, nb, nblocks, nrhs, A, inca, lda,
+                                                           stA, B, incb, ldb, stB, C, incc, ldc,
+                                                           stC, F, stF, X, incx, ldx, stX, bc);
+}
+
+inline rocblas_status rocsolver_geblttrs_npvt_cr_interleaved(rocblas_handle handle,
+                                                             rocblas_int nb,
+                                                             rocblas_int nblocks,
+                                                             rocblas_int nrhs,
+                                                             rocblas_float_complex* A,
+                                                             rocblas_int inca,
+                                                             rocblas_int lda,
+                                                             rocblas_stride stA,
+                                                             rocblas_float_complex* B,
+                                                             rocblas_int incb,
+                                                             rocblas_int ldb,
+                                                             rocblas_stride stB,
+                                                             rocblas_float_complex* C,
+                                                             rocblas_int incc,
+                                                             rocblas_int ldc,
+                                                             rocblas_stride stC,
+                                                             rocblas_float_complex* F,
+                                                             rocblas_stride stF,
+                                                             rocblas_float_complex* X,
+                                                             rocblas_int incx,
+                                                             rocblas_int ldx,
+                                                             rocblas_stride stX,
+                                                             rocblas_int bc)
+{
+    return rocsolver_cgeblttrs_npvt_cr_interleaved_batched(handle, nb, nblocks, nrhs, A, inca, lda,
+                                                           stA, B, incb, ldb, stB, C, incc, ldc,
+                                                           stC, F, stF, X, incx, ldx, stX, bc);
+}
+
+inline rocblas_status rocsolver_geblttrs_npvt_cr_interleaved(rocblas_handle handle,
+                                                             rocblas_int nb,
+                                                             rocblas_int nblocks,
+                                                             rocblas_int nrhs,
+                                                             rocblas_double_complex* A,
+                                                             rocblas_int inca,
+                                                             rocblas_int lda,
+                                                             rocblas_stride stA,
+                                                             rocblas_double_complex* B,
+                                                             rocblas_int incb,
+                                                             rocblas_int ldb,
+                                                             rocblas_stride stB,
+                                                             rocblas_double_complex* C,
+                                                             rocblas_int incc,
+                                                             rocblas_int ldc,
+                                                             rocblas_stride stC,
+                                                             rocblas_double_complex* F,
+                                                             rocblas_stride stF,
+                                                             rocblas_double_complex* X,
+                                                             rocblas_int incx,
+                                                             rocblas_int ldx,
+                                                             rocblas_stride stX,
+                                                             rocblas_int bc)
+{
+    return rocsolver_zgeblttrs_npvt_cr_interleaved_batched(handle, nb, nblocks, nrhs, A, inca, lda,
+                                                           stA, B, incb, ldb, stB, C, incc, ldc,
+                                                           stC, F, stF, X, incx, ldx, stX, bc);
+}
+/********************************************************/
+
 /*************** CREATE_ DESTROY_ RFINFO ****************/
 // local rocsolver_rfinfo; automatically created and destroyed
 class rocsolver_local_rfinfo
@@ -58,6 +58,7 @@ public:
     rocblas_int profile = 0;
     rocblas_int profile_kernels = 0;
     rocblas_int batch_count = 1;
+    rocblas_int alg_mode = 0;
 
     // get and set function arguments
     template <typename T>
@@ -107,6 +108,7 @@ public:
 
         // remove test arguments
         to_consume.erase("help");
+        to_consume.erase("alg_mode");
         to_consume.erase("function");
         to_consume.erase("precision");
         to_consume.erase("batch_count");
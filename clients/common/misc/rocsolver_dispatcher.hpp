@@ -49,11 +49,13 @@
 #include "common/auxiliary/testing_orglx_unglx.hpp"
 #include "common/auxiliary/testing_orgtr_ungtr.hpp"
 #include "common/auxiliary/testing_orgxl_ungxl.hpp"
+#include "common/auxiliary/testing_orgqr_ungqr_tsqr.hpp"
 #include "common/auxiliary/testing_orgxr_ungxr.hpp"
 #include "common/auxiliary/testing_ormbr_unmbr.hpp"
 #include "common/auxiliary/testing_ormlx_unmlx.hpp"
 #include "common/auxiliary/testing_ormtr_unmtr.hpp"
 #include "common/auxiliary/testing_ormxl_unmxl.hpp"
+#include "common/auxiliary/testing_ormqr_unmqr_tsqr.hpp"
 #include "common/auxiliary/testing_ormxr_unmxr.hpp"
 #include "common/auxiliary/testing_stebz.hpp"
 #include "common/auxiliary/testing_stedc.hpp"
@@ -63,29 +65,59 @@
 #include "common/auxiliary/testing_sterf.hpp"
 
 // lapack
+#include "common/lapack/testing_gbsv.hpp"
+#include "common/lapack/testing_gbtrf.hpp"
+#include "common/lapack/testing_gbtrs.hpp"
 #include "common/lapack/testing_gebd2_gebrd.hpp"
 #include "common/lapack/testing_geblttrf_npvt.hpp"
+#include "common/lapack/testing_geblttrf_npvt_cr.hpp"
 #include "common/lapack/testing_geblttrs_npvt.hpp"
+#include "common/lapack/testing_geblttrs_npvt_cr.hpp"
 #include "common/lapack/testing_gelq2_gelqf.hpp"
 #include "common/lapack/testing_gels.hpp"
+#include "common/lapack/testing_gelsy.hpp"
 #include "common/lapack/testing_geql2_geqlf.hpp"
+#include "common/lapack/testing_geqp3.hpp"
 #include "common/lapack/testing_geqr2_geqrf.hpp"
+#include "common/lapack/testing_geqrf_tsqr.hpp"
+#include "common/lapack/testing_geqrf_vbatched.hpp"
 #include "common/lapack/testing_gerq2_gerqf.hpp"
 #include "common/lapack/testing_gesv.hpp"
+#include "common/lapack/testing_gesv_rbt.hpp"
 #include "common/lapack/testing_gesvd.hpp"
 #include "common/lapack/testing_gesvdj.hpp"
 #include "common/lapack/testing_gesvdx.hpp"
 #include "common/lapack/testing_getf2_getrf.hpp"
 #include "common/lapack/testing_getf2_getrf_npvt.hpp"
+#include "common/lapack/testing_getrf_ooc.hpp"
+#include "common/lapack/testing_getrf_rbt.hpp"
+#include "common/lapack/testing_getrf_vbatched.hpp"
 #include "common/lapack/testing_getri.hpp"
+#include "common/lapack/testing_getri_direct.hpp"
 #include "common/lapack/testing_getri_npvt.hpp"
 #include "common/lapack/testing_getri_npvt_outofplace.hpp"
 #include "common/lapack/testing_getri_outofplace.hpp"
 #include "common/lapack/testing_getrs.hpp"
+#include "common/lapack/testing_getrs_ooc.hpp"
+#include "common/lapack/testing_getrs_rbt.hpp"
+#include "common/lapack/testing_getrs_vbatched.hpp"
+#include "common/lapack/testing_gpsv.hpp"
+#include "common/lapack/testing_gtsv.hpp"
+#include "common/lapack/testing_gtsv_nopivot.hpp"
+#include "common/lapack/testing_pbsv.hpp"
+#include "common/lapack/testing_pbtrf.hpp"
+#include "common/lapack/testing_pbtrs.hpp"
 #include "common/lapack/testing_posv.hpp"
 #include "common/lapack/testing_potf2_potrf.hpp"
+#include "common/lapack/testing_potrf_ooc.hpp"
+#include "common/lapack/testing_potrf_vbatched.hpp"
 #include "common/lapack/testing_potri.hpp"
+#include "common/lapack/testing_potri_direct.hpp"
 #include "common/lapack/testing_potrs.hpp"
+#include "common/lapack/testing_potrs_ooc.hpp"
+#include "common/lapack/testing_ptsv.hpp"
+#include "common/lapack/testing_pttrf.hpp"
+#include "common/lapack/testing_pttrs.hpp"
 #include "common/lapack/testing_syev_heev.hpp"
 #include "common/lapack/testing_syevd_heevd.hpp"
 #include "common/lapack/testing_syevdj_heevdj.hpp"
@@ -143,24 +175,54 @@ class rocsolver_dispatcher
             {"lasyf", testing_lasyf<T>},
             {"lauum", testing_lauum<T>},
             // potrf
-            {"potf2", testing_potf2_potrf<false, false, 0, T>},
-            {"potf2_batched", testing_potf2_potrf<true, true, 0, T>},
-            {"potf2_strided_batched", testing_potf2_potrf<false, true, 0, T>},
-            {"potrf", testing_potf2_potrf<false, false, 1, T>},
-            {"potrf_batched", testing_potf2_potrf<true, true, 1, T>},
-            {"potrf_strided_batched", testing_potf2_potrf<false, true, 1, T>},
+            {"potf2", testing_potf2_potrf<false, false, 0, T, rocblas_int>},
+            {"potf2_batched", testing_potf2_potrf<true, true, 0, T, rocblas_int>},
+            {"potf2_strided_batched", testing_potf2_potrf<false, true, 0, T, rocblas_int>},
+            {"potrf", testing_potf2_potrf<false, false, 1, T, rocblas_int>},
+            {"potrf_batched", testing_potf2_potrf<true, true, 1, T, rocblas_int>},
+            {"potrf_strided_batched", testing_potf2_potrf<false, true, 1, T, rocblas_int>},
+            {"potrf_64", testing_potf2_potrf<false, false, 1, T, int64_t>},
+            {"potrf_batched_64", testing_potf2_potrf<true, true, 1, T, int64_t>},
+            {"potrf_strided_batched_64", testing_potf2_potrf<false, true, 1, T, int64_t>},
             // potrs
-            {"potrs", testing_potrs<false, false, T>},
-            {"potrs_batched", testing_potrs<true, true, T>},
-            {"potrs_strided_batched", testing_potrs<false, true, T>},
+            {"potrs", testing_potrs<false, false, T, rocblas_int>},
+            {"potrs_batched", testing_potrs<true, true, T, rocblas_int>},
+            {"potrs_strided_batched", testing_potrs<false, true, T, rocblas_int>},
+            {"potrs_64", testing_potrs<false, false, T, int64_t>},
+            {"potrs_batched_64", testing_potrs<true, true, T, int64_t>},
+            {"potrs_strided_batched_64", testing_potrs<false, true, T, int64_t>},
             // posv
             {"posv", testing_posv<false, false, T>},
             {"posv_batched", testing_posv<true, true, T>},
             {"posv_strided_batched", testing_posv<false, true, T>},
+            // pbtrf
+            {"pbtrf", testing_pbtrf<false, false, T>},
+            {"pbtrf_batched", testing_pbtrf<true, true, T>},
+            {"pbtrf_strided_batched", testing_pbtrf<false, true, T>},
+            // pbtrs
+            {"pbtrs", testing_pbtrs<false, false, T>},
+            {"pbtrs_batched", testing_pbtrs<true, true, T>},
+            {"pbtrs_strided_batched", testing_pbtrs<false, true, T>},
+            // pbsv
+            {"pbsv", testing_pbsv<false, false, T>},
+            {"pbsv_batched", testing_pbsv<true, true, T>},
+            {"pbsv_strided_batched", testing_pbsv<false, true, T>},
+            // pttrf
+            {"pttrf_strided_batched", testing_pttrf<false, T>},
+            {"pttrf_interleaved_batched", testing_pttrf<true, T>},
+            // pttrs
+            {"pttrs_strided_batched", testing_pttrs<false, T>},
+            {"pttrs_interleaved_batched", testing_pttrs<true, T>},
+            // ptsv
+            {"ptsv_strided_batched", testing_ptsv<false, T>},
+            {"ptsv_interleaved_batched", testing_ptsv<true, T>},
             // potri
             {"potri", testing_potri<false, false, T>},
             {"potri_batched", testing_potri<true, true, T>},
             {"potri_strided_batched", testing_potri<false, true, T>},
+            // potri_direct
+            {"potri_direct_batched", testing_potri_direct<true, true, T>},
+            {"potri_direct_strided_batched", testing_potri_direct<false, true, T>},
             // getrf_npvt
             {"getf2_npvt", testing_getf2_getrf_npvt<false, false, 0, T, rocblas_int>},
             {"getf2_npvt_batched", testing_getf2_getrf_npvt<true, true, 0, T, rocblas_int>},
@@ -182,13 +244,27 @@ class rocsolver_dispatcher
             {"getf2_batched_64", testing_getf2_getrf<true, true, 0, T, int64_t>},
             {"getf2_strided_batched_64", testing_getf2_getrf<false, true, 0, T, int64_t>},
             // geqrf
-            {"geqr2", testing_geqr2_geqrf<false, false, 0, T>},
-            {"geqr2_batched", testing_geqr2_geqrf<true, true, 0, T>},
-            {"geqr2_strided_batched", testing_geqr2_geqrf<false, true, 0, T>},
-            {"geqrf", testing_geqr2_geqrf<false, false, 1, T>},
-            {"geqrf_batched", testing_geqr2_geqrf<true, true, 1, T>},
-            {"geqrf_strided_batched", testing_geqr2_geqrf<false, true, 1, T>},
-            {"geqrf_ptr_batched", testing_geqr2_geqrf<true, false, 1, T>},
+            {"geqr2", testing_geqr2_geqrf<false, false, 0, T, rocblas_int>},
+            {"geqr2_batched", testing_geqr2_geqrf<true, true, 0, T, rocblas_int>},
+            {"geqr2_strided_batched", testing_geqr2_geqrf<false, true, 0, T, rocblas_int>},
+            {"geqrf", testing_geqr2_geqrf<false, false, 1, T, rocblas_int>},
+            {"geqrf_batched", testing_geqr2_geqrf<true, true, 1, T, rocblas_int>},
+            {"geqrf_strided_batched", testing_geqr2_geqrf<false, true, 1, T, rocblas_int>},
+            {"geqrf_ptr_batched", testing_geqr2_geqrf<true, false, 1, T, rocblas_int>},
+            {"geqrf_64", testing_geqr2_geqrf<false, false, 1, T, int64_t>},
+            {"geqrf_batched_64", testing_geqr2_geqrf<true, true, 1, T, int64_t>},
+            {"geqrf_strided_batched_64", testing_geqr2_geqrf<false, true, 1, T, int64_t>},
+            // geqrf_tsqr
+            {"geqrf_tsqr", testing_geqrf_tsqr<false, false, T>},
+            {"geqrf_tsqr_batched", testing_geqrf_tsqr<true, true, T>},
+            {"geqrf_tsqr_strided_batched", testing_geqrf_tsqr<false, true, T>},
+            // geqp3
+            {"geqp3", testing_geqp3<false, false, 0, T>},
+            {"geqp3_batched", testing_geqp3<true, true, 0, T>},
+            {"geqp3_strided_batched", testing_geqp3<false, true, 0, T>},
+            {"geqp3_truncated", testing_geqp3<false, false, 1, T>},
+            {"geqp3_truncated_batched", testing_geqp3<true, true, 1, T>},
+            {"geqp3_truncated_strided_batched", testing_geqp3<false, true, 1, T>},
             // gerqf
             {"gerq2", testing_gerq2_gerqf<false, false, 0, T>},
             {"gerq2_batched", testing_gerq2_gerqf<true, true, 0, T>},
@@ -221,6 +297,44 @@ class rocsolver_dispatcher
             {"gesv", testing_gesv<false, false, T>},
             {"gesv_batched", testing_gesv<true, true, T>},
             {"gesv_strided_batched", testing_gesv<false, true, T>},
+            // gbtrf
+            {"gbtrf", testing_gbtrf<false, false, T>},
+            {"gbtrf_batched", testing_gbtrf<true, true, T>},
+            {"gbtrf_strided_batched", testing_gbtrf<false, true, T>},
+            // gbtrs
+            {"gbtrs", testing_gbtrs<false, false, T>},
+            {"gbtrs_batched", testing_gbtrs<true, true, T>},
+            {"gbtrs_strided_batched", testing_gbtrs<false, true, T>},
+            // gbsv
+            {"gbsv", testing_gbsv<false, false, T>},
+            {"gbsv_batched", testing_gbsv<true, true, T>},
+            {"gbsv_strided_batched", testing_gbsv<false, true, T>},
+            // gtsv
+            {"gtsv_strided_batched", testing_gtsv<false, T>},
+            {"gtsv_interleaved_batched", testing_gtsv<true, T>},
+            // gtsv_nopivot
+            {"gtsv_nopivot_strided_batched", testing_gtsv_nopivot<false, T>},
+            {"gtsv_nopivot_interleaved_batched", testing_gtsv_nopivot<true, T>},
+            // gpsv
+            {"gpsv_strided_batched", testing_gpsv<false, T>},
+            {"gpsv_interleaved_batched", testing_gpsv<true, T>},
+            // randomized butterfly transforms
+            {"getrf_rbt_batched", testing_getrf_rbt<true, true, T>},
+            {"getrf_rbt_strided_batched", testing_getrf_rbt<false, true, T>},
+            {"getrs_rbt_batched", testing_getrs_rbt<true, true, T>},
+            {"getrs_rbt_strided_batched", testing_getrs_rbt<false, true, T>},
+            {"gesv_rbt_batched", testing_gesv_rbt<true, true, T>},
+            {"gesv_rbt_strided_batched", testing_gesv_rbt<false, true, T>},
+            // variable-size batches
+            {"getrf_vbatched", testing_getrf_vbatched<T>},
+            {"getrs_vbatched", testing_getrs_vbatched<T>},
+            {"potrf_vbatched", testing_potrf_vbatched<T>},
+            {"geqrf_vbatched", testing_geqrf_vbatched<T>},
+            // out-of-core factorizations and solvers
+            {"getrf_ooc", testing_getrf_ooc<T>},
+            {"getrs_ooc", testing_getrs_ooc<T>},
+            {"potrf_ooc", testing_potrf_ooc<T>},
+            {"potrs_ooc", testing_potrs_ooc<T>},
             // gesvd
             {"gesvd", testing_gesvd<false, false, T>},
             {"gesvd_batched", testing_gesvd<true, true, T>},
@@ -253,10 +367,20 @@ class rocsolver_dispatcher
             {"getri_npvt_outofplace", testing_getri_npvt_outofplace<false, false, T>},
             {"getri_npvt_outofplace_batched", testing_getri_npvt_outofplace<true, true, T>},
             {"getri_npvt_outofplace_strided_batched", testing_getri_npvt_outofplace<false, true, T>},
+            // getri_direct
+            {"getri_direct_batched", testing_getri_direct<true, true, T>},
+            {"getri_direct_strided_batched", testing_getri_direct<false, true, T>},
             // gels
-            {"gels", testing_gels<false, false, T>},
-            {"gels_batched", testing_gels<true, true, T>},
-            {"gels_strided_batched", testing_gels<false, true, T>},
+            {"gels", testing_gels<false, false, T, rocblas_int>},
+            {"gels_batched", testing_gels<true, true, T, rocblas_int>},
+            {"gels_strided_batched", testing_gels<false, true, T, rocblas_int>},
+            {"gels_64", testing_gels<false, false, T, int64_t>},
+            {"gels_batched_64", testing_gels<true, true, T, int64_t>},
+            {"gels_strided_batched_64", testing_gels<false, true, T, int64_t>},
+            // gelsy
+            {"gelsy", testing_gelsy<false, false, T>},
+            {"gelsy_batched", testing_gelsy<true, true, T>},
+            {"gelsy_strided_batched", testing_gelsy<false, true, T>},
             // gebrd
             {"gebd2", testing_gebd2_gebrd<false, false, 0, T>},
             {"gebd2_batched", testing_gebd2_gebrd<true, true, 0, T>},
@@ -279,6 +403,14 @@ class rocsolver_dispatcher
             {"geblttrs_npvt", testing_geblttrs_npvt<false, false, T>},
             {"geblttrs_npvt_batched", testing_geblttrs_npvt<true, true, T>},
             {"geblttrs_npvt_strided_batched", testing_geblttrs_npvt<false, true, T>},
+            // geblttrf_npvt_cr
+            {"geblttrf_npvt_cr", testing_geblttrf_npvt_cr<false, false, T>},
+            {"geblttrf_npvt_cr_batched", testing_geblttrf_npvt_cr<true, true, T>},
+            {"geblttrf_npvt_cr_strided_batched", testing_geblttrf_npvt_cr<false, true, T>},
+            // geblttrs_npvt_cr
+            {"geblttrs_npvt_cr", testing_geblttrs_npvt_cr<false, false, T>},
+            {"geblttrs_npvt_cr_batched", testing_geblttrs_npvt_cr<true, true, T>},
+            {"geblttrs_npvt_cr_strided_batched", testing_geblttrs_npvt_cr<false, true, T>},
         };
 
         // Grab function from the map and execute
@@ -301,23 +433,27 @@ class rocsolver_dispatcher
             {"stebz", testing_stebz<T>},
             {"bdsvdx", testing_bdsvdx<T>},
             // orgxx
-            {"org2r", testing_orgxr_ungxr<T, 0>},
-            {"orgqr", testing_orgxr_ungxr<T, 1>},
+            {"org2r", testing_orgxr_ungxr<T, 0, rocblas_int>},
+            {"orgqr", testing_orgxr_ungxr<T, 1, rocblas_int>},
+            {"orgqr_64", testing_orgxr_ungxr<T, 1, int64_t>},
             {"org2l", testing_orgxl_ungxl<T, 0>},
             {"orgql", testing_orgxl_ungxl<T, 1>},
             {"orgl2", testing_orglx_unglx<T, 0>},
             {"orglq", testing_orglx_unglx<T, 1>},
             {"orgbr", testing_orgbr_ungbr<T>},
             {"orgtr", testing_orgtr_ungtr<T>},
+            {"orgqr_tsqr", testing_orgqr_ungqr_tsqr<T>},
             // ormxx
-            {"orm2r", testing_ormxr_unmxr<T, 0>},
-            {"ormqr", testing_ormxr_unmxr<T, 1>},
+            {"orm2r", testing_ormxr_unmxr<T, 0, rocblas_int>},
+            {"ormqr", testing_ormxr_unmxr<T, 1, rocblas_int>},
+            {"ormqr_64", testing_ormxr_unmxr<T, 1, int64_t>},
             {"orm2l", testing_ormxl_unmxl<T, 0>},
             {"ormql", testing_ormxl_unmxl<T, 1>},
             {"orml2", testing_ormlx_unmlx<T, 0>},
             {"ormlq", testing_ormlx_unmlx<T, 1>},
             {"ormbr", testing_ormbr_unmbr<T>},
             {"ormtr", testing_ormtr_unmtr<T>},
+            {"ormqr_tsqr", testing_ormqr_unmqr_tsqr<T>},
             // sytrd
             {"sytd2", testing_sytxx_hetxx<false, false, 0, T>},
             {"sytd2_batched", testing_sytxx_hetxx<true, true, 0, T>},
@@ -399,23 +535,27 @@ class rocsolver_dispatcher
         static const func_map map_complex = {
             {"lacgv", testing_lacgv<T>},
             // ungxx
-            {"ung2r", testing_orgxr_ungxr<T, 0>},
-            {"ungqr", testing_orgxr_ungxr<T, 1>},
+            {"ung2r", testing_orgxr_ungxr<T, 0, rocblas_int>},
+            {"ungqr", testing_orgxr_ungxr<T, 1, rocblas_int>},
+            {"ungqr_64", testing_orgxr_ungxr<T, 1, int64_t>},
             {"ung2l", testing_orgxl_ungxl<T, 0>},
             {"ungql", testing_orgxl_ungxl<T, 1>},
             {"ungl2", testing_orglx_unglx<T, 0>},
             {"unglq", testing_orglx_unglx<T, 1>},
             {"ungbr", testing_orgbr_ungbr<T>},
             {"ungtr", testing_orgtr_ungtr<T>},
+            {"ungqr_tsqr", testing_orgqr_ungqr_tsqr<T>},
             // unmxx
-            {"unm2r", testing_ormxr_unmxr<T, 0>},
-            {"unmqr", testing_ormxr_unmxr<T, 1>},
+            {"unm2r", testing_ormxr_unmxr<T, 0, rocblas_int>},
+            {"unmqr", testing_ormxr_unmxr<T, 1, rocblas_int>},
+            {"unmqr_64", testing_ormxr_unmxr<T, 1, int64_t>},
             {"unm2l", testing_ormxl_unmxl<T, 0>},
             {"unmql", testing_ormxl_unmxl<T, 1>},
             {"unml2", testing_ormlx_unmlx<T, 0>},
             {"unmlq", testing_ormlx_unmlx<T, 1>},
             {"unmbr", testing_ormbr_unmbr<T>},
             {"unmtr", testing_ormtr_unmtr<T>},
+            {"unmqr_tsqr", testing_ormqr_unmqr_tsqr<T>},
             // hetrd
             {"hetd2", testing_sytxx_hetxx<false, false, 0, T>},
             {"hetd2_batched", testing_sytxx_hetxx<true, true, 0, T>},
@@ -27,11 +27,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdarg>
 #include <cstdio>
 #include <cstdlib>
 #include <ostream>
 #include <stdexcept>
+#include <vector>
 
 #if __has_include(<filesystem>)
 #include <filesystem>
@@ -45,6 +47,7 @@ namespace fs = std::experimental::filesystem;
 #include <fmt/ostream.h>
 #include <fmt/ranges.h>
 #include <rocblas/rocblas.h>
+#include <rocsolver/rocsolver.h>
 
 // If USE_ROCBLAS_REALLOC_ON_DEMAND is false, automatic reallocation is disable and we will manually
 // reallocate workspace
@@ -78,6 +81,24 @@ inline void rocsolver_bench_inform(rocsolver_inform_type it, size_t arg = 0)
     std::fflush(stdout);
 }
 
+// informs the result of a device memory size query, followed by the breakdown of the
+// workspace recorded in the handle if requested
+inline void rocsolver_bench_inform_mem_query(rocblas_handle handle, size_t size, bool breakdown)
+{
+    rocblas_int count = 0;
+    if(breakdown && rocsolver_get_workspace_breakdown(handle, nullptr, &count) == 0 && count > 0)
+    {
+        std::vector<rocsolver_workspace_node> nodes(count);
+        rocsolver_get_workspace_breakdown(handle, nodes.data(), &count);
+        fmt::print("Workspace breakdown (bytes):\n");
+        for(auto& node : nodes)
+            fmt::print("{:>{}}{:<{}} {}\n", "", 2 * node.depth, node.name,
+                       std::max(40 - 2 * node.depth, 1), node.size);
+    }
+    rocsolver_clear_workspace_breakdown(handle);
+    rocsolver_bench_inform(inform_mem_query, size);
+}
+
 // recursive format function (base case)
 inline void format_bench_table(std::string&) {}
 
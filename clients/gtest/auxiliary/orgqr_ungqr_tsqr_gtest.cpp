@@ -0,0 +1,152 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "common/auxiliary/testing_orgqr_ungqr_tsqr.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, int> orgqr_tsqr_tuple;
+
+// each m_size_range vector is a {M, lda}
+
+// case when m = 0 and n = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> m_size_range = {
+    // quick return
+    {0, 1},
+    // always invalid
+    {-1, 1},
+    {20, 5},
+    // normal (valid) samples
+    // (matrices with more than TSQR_BLOCKSIZE rows are split in several blocks)
+    {50, 50},
+    {300, 320},
+    {1000, 1000},
+    {2000, 2000}};
+
+const vector<int> n_size_range = {
+    // quick return
+    0,
+    // invalid
+    -1,
+    // normal (valid) samples
+    // (n > m is also invalid)
+    1, 16, 40};
+
+// for daily_lapack tests
+const vector<vector<int>> large_m_size_range = {{4000, 4000}, {10000, 10010}, {50000, 50000}};
+
+const vector<int> large_n_size_range = {16, 64, 128};
+
+Arguments orgqr_tsqr_setup_arguments(orgqr_tsqr_tuple tup)
+{
+    vector<int> m_size = std::get<0>(tup);
+    int n_size = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("m", m_size[0]);
+    arg.set<rocblas_int>("lda", m_size[1]);
+
+    arg.set<rocblas_int>("n", n_size);
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class ORGQR_UNGQR_TSQR : public ::TestWithParam<orgqr_tsqr_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = orgqr_tsqr_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("m") == 0 && arg.peek<rocblas_int>("n") == 0)
+            testing_orgqr_ungqr_tsqr_bad_arg<T>();
+
+        testing_orgqr_ungqr_tsqr<T>(arg);
+    }
+};
+
+class ORGQR_TSQR : public ORGQR_UNGQR_TSQR
+{
+};
+
+class UNGQR_TSQR : public ORGQR_UNGQR_TSQR
+{
+};
+
+// non-batch tests
+
+TEST_P(ORGQR_TSQR, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(ORGQR_TSQR, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(UNGQR_TSQR, __float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(UNGQR_TSQR, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         ORGQR_TSQR,
+                         Combine(ValuesIn(large_m_size_range), ValuesIn(large_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         ORGQR_TSQR,
+                         Combine(ValuesIn(m_size_range), ValuesIn(n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         UNGQR_TSQR,
+                         Combine(ValuesIn(large_m_size_range), ValuesIn(large_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         UNGQR_TSQR,
+                         Combine(ValuesIn(m_size_range), ValuesIn(n_size_range)));
@@ -93,7 +93,7 @@ Arguments orgqr_setup_arguments(orgqr_tuple tup)
     return arg;
 }
 
-template <bool BLOCKED>
+template <bool BLOCKED, typename I>
 class ORGXR_UNGXR : public ::TestWithParam<orgqr_tuple>
 {
 protected:
@@ -108,25 +108,33 @@ protected:
         Arguments arg = orgqr_setup_arguments(GetParam());
 
         if(arg.peek<rocblas_int>("m") == 0 && arg.peek<rocblas_int>("n") == 0)
-            testing_orgxr_ungxr_bad_arg<T, BLOCKED>();
+            testing_orgxr_ungxr_bad_arg<T, BLOCKED, I>();
 
-        testing_orgxr_ungxr<T, BLOCKED>(arg);
+        testing_orgxr_ungxr<T, BLOCKED, I>(arg);
     }
 };
 
-class ORG2R : public ORGXR_UNGXR<false>
+class ORG2R : public ORGXR_UNGXR<false, rocblas_int>
 {
 };
 
-class UNG2R : public ORGXR_UNGXR<false>
+class UNG2R : public ORGXR_UNGXR<false, rocblas_int>
 {
 };
 
-class ORGQR : public ORGXR_UNGXR<true>
+class ORGQR : public ORGXR_UNGXR<true, rocblas_int>
 {
 };
 
-class UNGQR : public ORGXR_UNGXR<true>
+class ORGQR_64 : public ORGXR_UNGXR<true, int64_t>
+{
+};
+
+class UNGQR : public ORGXR_UNGXR<true, rocblas_int>
+{
+};
+
+class UNGQR_64 : public ORGXR_UNGXR<true, int64_t>
 {
 };
 
@@ -172,6 +180,26 @@ TEST_P(UNGQR, __double_complex)
     run_tests<rocblas_double_complex>();
 }
 
+TEST_P(ORGQR_64, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(ORGQR_64, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(UNGQR_64, __float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(UNGQR_64, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
 INSTANTIATE_TEST_SUITE_P(daily_lapack,
                          ORG2R,
                          Combine(ValuesIn(large_m_size_range), ValuesIn(large_n_size_range)));
@@ -203,3 +231,69 @@ INSTANTIATE_TEST_SUITE_P(daily_lapack,
 INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          UNGQR,
                          Combine(ValuesIn(m_size_range), ValuesIn(n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         ORGQR_64,
+                         Combine(ValuesIn(large_m_size_range), ValuesIn(large_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         ORGQR_64,
+                         Combine(ValuesIn(m_size_range), ValuesIn(n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         UNGQR_64,
+                         Combine(ValuesIn(large_m_size_range), ValuesIn(large_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         UNGQR_64,
+                         Combine(ValuesIn(m_size_range), ValuesIn(n_size_range)));
+
+// host-side tests of the 64-bit API with dimensions above 2^31 (only the argument checks
+// and the workspace queries are exercised, so no kernels are launched)
+
+template <typename T, typename I>
+void orgqr_workspace(rocblas_handle handle, I m, I n, I k, size_t* size)
+{
+    EXPECT_ROCBLAS_STATUS(rocblas_start_device_memory_size_query(handle), rocblas_status_success);
+    CHECK_ALLOC_QUERY(rocsolver_orgxr_ungxr(true, handle, m, n, k, (T*)nullptr, m, (T*)nullptr));
+    EXPECT_ROCBLAS_STATUS(rocblas_stop_device_memory_size_query(handle, size),
+                          rocblas_status_success);
+}
+
+TEST(checkin_lapack_ORGQR_64, large_sizes)
+{
+    rocblas_local_handle handle;
+    const int64_t big = int64_t(1) << 32;
+
+    // the sizes are not truncated to 32 bits (truncated, lda would be smaller than m,
+    // or n would be larger than m)
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_dorgqr_64(handle, big + 10, 0, 0, nullptr, 2 * big + 5, nullptr),
+        rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_dorgqr_64(handle, big + 10, 20, 0, nullptr, big + 10, nullptr),
+                          rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(rocsolver_zungqr_64(handle, big + 1, 1, 0, nullptr, big, nullptr),
+                          rocblas_status_invalid_size);
+}
+
+TEST(checkin_lapack_ORGQR_64, workspace)
+{
+    rocblas_local_handle handle;
+    size_t size_32, size_64, size_strip, size_large;
+
+    // same workspace as the 32-bit API for matrices that fit 32-bit indexing
+    orgqr_workspace<double, rocblas_int>(handle, 1024, 1024, 1024, &size_32);
+    orgqr_workspace<double, int64_t>(handle, 1024, 1024, 1024, &size_64);
+    EXPECT_EQ(size_64, size_32);
+
+    // if m*n is larger than 2^31, the block reflectors are applied to strips of w columns
+    // that can be addressed with 32-bit indices, so the workspace does not grow with n
+    const int64_t m = int64_t(1) << 20;
+    const int64_t k = 1024;
+    const int64_t nb = 64; // (xxGQx_BLOCKSIZE)
+    const int64_t w = (INT_MAX - 1) / m;
+    orgqr_workspace<double, int64_t>(handle, m, w + nb, k, &size_strip);
+    orgqr_workspace<double, int64_t>(handle, m, 4 * w, k, &size_large);
+    EXPECT_EQ(size_large, size_strip);
+    EXPECT_LT(size_large, sizeof(double) * nb * (4 * w - nb));
+}
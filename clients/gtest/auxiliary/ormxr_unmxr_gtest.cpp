@@ -116,7 +116,7 @@ Arguments ormqr_setup_arguments(ormqr_tuple tup)
     return arg;
 }
 
-template <bool BLOCKED>
+template <bool BLOCKED, typename I>
 class ORMXR_UNMXR : public ::TestWithParam<ormqr_tuple>
 {
 protected:
@@ -132,25 +132,33 @@ protected:
 
         if(arg.peek<rocblas_int>("m") == 0 && arg.peek<char>("side") == 'L'
            && arg.peek<char>("trans") == 'T')
-            testing_ormxr_unmxr_bad_arg<T, BLOCKED>();
+            testing_ormxr_unmxr_bad_arg<T, BLOCKED, I>();
 
-        testing_ormxr_unmxr<T, BLOCKED>(arg);
+        testing_ormxr_unmxr<T, BLOCKED, I>(arg);
     }
 };
 
-class ORM2R : public ORMXR_UNMXR<false>
+class ORM2R : public ORMXR_UNMXR<false, rocblas_int>
 {
 };
 
-class UNM2R : public ORMXR_UNMXR<false>
+class UNM2R : public ORMXR_UNMXR<false, rocblas_int>
 {
 };
 
-class ORMQR : public ORMXR_UNMXR<true>
+class ORMQR : public ORMXR_UNMXR<true, rocblas_int>
 {
 };
 
-class UNMQR : public ORMXR_UNMXR<true>
+class ORMQR_64 : public ORMXR_UNMXR<true, int64_t>
+{
+};
+
+class UNMQR : public ORMXR_UNMXR<true, rocblas_int>
+{
+};
+
+class UNMQR_64 : public ORMXR_UNMXR<true, int64_t>
 {
 };
 
@@ -196,6 +204,26 @@ TEST_P(UNMQR, __double_complex)
     run_tests<rocblas_double_complex>();
 }
 
+TEST_P(ORMQR_64, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(ORMQR_64, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(UNMQR_64, __float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(UNMQR_64, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
 INSTANTIATE_TEST_SUITE_P(daily_lapack, ORM2R, Combine(ValuesIn(large_size_range), ValuesIn(op_range)));
 
 INSTANTIATE_TEST_SUITE_P(checkin_lapack, ORM2R, Combine(ValuesIn(size_range), ValuesIn(op_range)));
@@ -211,3 +239,75 @@ INSTANTIATE_TEST_SUITE_P(checkin_lapack, ORMQR, Combine(ValuesIn(size_range), Va
 INSTANTIATE_TEST_SUITE_P(daily_lapack, UNMQR, Combine(ValuesIn(large_size_range), ValuesIn(op_range)));
 
 INSTANTIATE_TEST_SUITE_P(checkin_lapack, UNMQR, Combine(ValuesIn(size_range), ValuesIn(op_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         ORMQR_64,
+                         Combine(ValuesIn(large_size_range), ValuesIn(op_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         ORMQR_64,
+                         Combine(ValuesIn(size_range), ValuesIn(op_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         UNMQR_64,
+                         Combine(ValuesIn(large_size_range), ValuesIn(op_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         UNMQR_64,
+                         Combine(ValuesIn(size_range), ValuesIn(op_range)));
+
+// host-side tests of the 64-bit API with dimensions above 2^31 (only the argument checks
+// and the workspace queries are exercised, so no kernels are launched)
+
+template <typename T, typename I>
+void ormqr_workspace(rocblas_handle handle, I m, I n, I k, size_t* size)
+{
+    EXPECT_ROCBLAS_STATUS(rocblas_start_device_memory_size_query(handle), rocblas_status_success);
+    CHECK_ALLOC_QUERY(rocsolver_ormxr_unmxr(true, handle, rocblas_side_left,
+                                            rocblas_operation_transpose, m, n, k, (T*)nullptr, m,
+                                            (T*)nullptr, (T*)nullptr, m));
+    EXPECT_ROCBLAS_STATUS(rocblas_stop_device_memory_size_query(handle, size),
+                          rocblas_status_success);
+}
+
+TEST(checkin_lapack_ORMQR_64, large_sizes)
+{
+    rocblas_local_handle handle;
+    const int64_t big = int64_t(1) << 32;
+    const rocblas_side left = rocblas_side_left;
+    const rocblas_side right = rocblas_side_right;
+    const rocblas_operation none = rocblas_operation_none;
+
+    // the sizes are not truncated to 32 bits (truncated, the results of the size checks
+    // would be the opposite)
+    EXPECT_ROCBLAS_STATUS(rocsolver_dormqr_64(handle, left, none, big + 10, 0, 0, nullptr,
+                                              2 * big + 5, nullptr, nullptr, 2 * big + 5),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_dormqr_64(handle, right, none, big + 5, 1, 0, nullptr, 1, nullptr, nullptr, 10),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocsolver_zunmqr_64(handle, right, none, 5, big + 10, 0, nullptr, 20,
+                                              nullptr, nullptr, 5),
+                          rocblas_status_invalid_size);
+}
+
+TEST(checkin_lapack_ORMQR_64, workspace)
+{
+    rocblas_local_handle handle;
+    size_t size_32, size_64, size_strip, size_large;
+
+    // same workspace as the 32-bit API for matrices that fit 32-bit indexing
+    ormqr_workspace<double, rocblas_int>(handle, 1024, 1024, 1024, &size_32);
+    ormqr_workspace<double, int64_t>(handle, 1024, 1024, 1024, &size_64);
+    EXPECT_EQ(size_64, size_32);
+
+    // if ldc*n is larger than 2^31, C is updated from the left in strips of w columns that
+    // can be addressed with 32-bit indices, so the workspace does not grow with n
+    const int64_t m = 1024;
+    const int64_t nb = 64; // (xxMQx_BLOCKSIZE)
+    const int64_t w = (INT_MAX - 1) / m;
+    ormqr_workspace<double, int64_t>(handle, m, w + nb, m, &size_strip);
+    ormqr_workspace<double, int64_t>(handle, m, 4 * w, m, &size_large);
+    EXPECT_EQ(size_large, size_strip);
+    EXPECT_LT(size_large, sizeof(double) * nb * 4 * w);
+}
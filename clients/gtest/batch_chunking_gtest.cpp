@@ -0,0 +1,138 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include <algorithm>
+#include <cstdint>
+
+#include <gtest/gtest.h>
+#include <rocblas/rocblas.h>
+#include <rocsolver/rocsolver.h>
+
+#include "rocsolver_batch_chunking.hpp"
+
+TEST(checkin_misc_BATCH_CHUNKING, workspace_size)
+{
+    // every array is padded, and empty arrays count as one chunk
+    EXPECT_EQ(rocsolver_workspace_size({}), 0);
+    EXPECT_EQ(rocsolver_workspace_size({0}), ROCSOLVER_WORKSPACE_ALIGNMENT);
+    EXPECT_EQ(rocsolver_workspace_size({1, ROCSOLVER_WORKSPACE_ALIGNMENT}),
+              2 * ROCSOLVER_WORKSPACE_ALIGNMENT);
+    EXPECT_EQ(rocsolver_workspace_size({ROCSOLVER_WORKSPACE_ALIGNMENT + 1}),
+              2 * ROCSOLVER_WORKSPACE_ALIGNMENT);
+}
+
+TEST(checkin_misc_BATCH_CHUNKING, plan)
+{
+    // fixed part plus a part proportional to the batch size
+    auto linear = [](auto bc) { return size_t(1000) + size_t(100) * bc; };
+
+    // whole batch fits
+    EXPECT_EQ(rocsolver_plan_batch_chunk(size_t(2000), rocblas_int(10), linear), 10);
+    EXPECT_EQ(rocsolver_plan_batch_chunk(size_t(0), rocblas_int(0), linear), 0);
+
+    // not even one problem fits
+    EXPECT_EQ(rocsolver_plan_batch_chunk(size_t(1099), rocblas_int(10), linear), 0);
+
+    // exactly one problem fits
+    EXPECT_EQ(rocsolver_plan_batch_chunk(size_t(1100), rocblas_int(10), linear), 1);
+
+    // up to 7 problems fit; the batch of 10 is split in 2 balanced chunks of 5
+    EXPECT_EQ(rocsolver_plan_batch_chunk(size_t(1700), rocblas_int(10), linear), 5);
+
+    // up to 4 problems fit; the batch of 10 is split in 3 chunks of at most 4
+    EXPECT_EQ(rocsolver_plan_batch_chunk(size_t(1450), rocblas_int(10), linear), 4);
+
+    // large 64-bit batches
+    EXPECT_EQ(rocsolver_plan_batch_chunk(size_t(1000) + 100 * 1000000, int64_t(3000000), linear),
+              1000000);
+}
+
+TEST(checkin_misc_BATCH_CHUNKING, plan_steps)
+{
+    // workspace that grows in steps of 8 problems
+    auto steps = [](rocblas_int bc) { return size_t(64) * ((bc + 7) / 8); };
+
+    for(rocblas_int bc = 1; bc <= 100; ++bc)
+    {
+        for(size_t budget = 64; budget <= 1024; budget += 32)
+        {
+            rocblas_int chunk = rocsolver_plan_batch_chunk(budget, bc, steps);
+            ASSERT_GE(chunk, 1);
+            ASSERT_LE(chunk, bc);
+            EXPECT_LE(steps(chunk), budget);
+
+            // no smaller number of chunks would fit
+            rocblas_int nchunks = (bc - 1) / chunk + 1;
+            if(nchunks > 1)
+                EXPECT_GT(steps((bc - 1) / (nchunks - 1) + 1), budget);
+        }
+    }
+}
+
+TEST(checkin_misc_BATCH_STREAMS, plan)
+{
+    // splitting disabled
+    EXPECT_EQ(rocsolver_plan_stream_split(rocblas_int(64), 0, rocblas_int(4)), 64);
+    EXPECT_EQ(rocsolver_plan_stream_split(rocblas_int(64), 1, rocblas_int(4)), 64);
+    EXPECT_EQ(rocsolver_plan_stream_split(rocblas_int(0), 4, rocblas_int(4)), 0);
+
+    // batch too small to be split
+    EXPECT_EQ(rocsolver_plan_stream_split(rocblas_int(7), 4, rocblas_int(4)), 7);
+
+    // balanced chunks
+    EXPECT_EQ(rocsolver_plan_stream_split(rocblas_int(64), 4, rocblas_int(4)), 16);
+    EXPECT_EQ(rocsolver_plan_stream_split(rocblas_int(10), 4, rocblas_int(1)), 3);
+    EXPECT_EQ(rocsolver_plan_stream_split(rocblas_int(10), 4, rocblas_int(4)), 5);
+    EXPECT_EQ(rocsolver_plan_stream_split(int64_t(1) << 33, 8, int64_t(4)), int64_t(1) << 30);
+
+    EXPECT_EQ(rocsolver_stream_split_count(rocblas_int(64), rocblas_int(16)), 4);
+    EXPECT_EQ(rocsolver_stream_split_count(rocblas_int(10), rocblas_int(3)), 4);
+    EXPECT_EQ(rocsolver_stream_split_count(rocblas_int(0), rocblas_int(0)), 1);
+}
+
+TEST(checkin_misc_BATCH_STREAMS, plan_bounds)
+{
+    for(rocblas_int bc = 1; bc <= 100; ++bc)
+    {
+        for(int streams = 0; streams <= 9; ++streams)
+        {
+            for(rocblas_int min_chunk = 0; min_chunk <= 5; ++min_chunk)
+            {
+                rocblas_int chunk = rocsolver_plan_stream_split(bc, streams, min_chunk);
+                int count = rocsolver_stream_split_count(bc, chunk);
+
+                // the whole batch is covered, every stream has work, and the limits are honored
+                ASSERT_GE(chunk, 1);
+                ASSERT_GE(rocblas_int(count) * chunk, bc);
+                ASSERT_LT(rocblas_int(count - 1) * chunk, bc);
+                ASSERT_LE(count, std::max(streams, 1));
+                if(count > 1)
+                    ASSERT_GE(chunk, min_chunk);
+            }
+        }
+    }
+}
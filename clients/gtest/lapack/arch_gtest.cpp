@@ -0,0 +1,137 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+#include "common/lapack/testing_arch.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<string, int, printable_char> arch_tuple;
+
+// each function_range is the function whose kernel selection depends on the architecture
+// description of the handle
+// each size_range is the order n of the matrices (the packed triangular matrices fit in the
+// LDS of the device for all precisions, but not in the smaller LDS of the description used
+// for the tests)
+// each uplo_range is a {uplo}
+
+// case when function = "potf2" and uplo = L also executes the bad arguments test
+// (detection and override of the architecture description)
+
+const vector<string> function_range = {"potf2", "potrf"};
+
+const vector<printable_char> uplo_range = {'L', 'U'};
+
+// for checkin_lapack tests
+const vector<int> size_range = {20, 64};
+
+Arguments arch_setup_arguments(arch_tuple tup)
+{
+    Arguments arg;
+
+    arg.set<string>("function", std::get<0>(tup));
+    arg.set<rocblas_int>("n", std::get<1>(tup));
+    arg.set<char>("uplo", std::get<2>(tup));
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class ARCH : public ::TestWithParam<arch_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = arch_setup_arguments(GetParam());
+
+        if(arg.peek<string>("function") == function_range[0] && arg.peek<char>("uplo") == 'L')
+            testing_arch_bad_arg();
+
+        arg.batch_count = (STRIDED ? 3 : 1);
+        testing_arch<STRIDED, T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(ARCH, __float)
+{
+    run_tests<false, float>();
+}
+
+TEST_P(ARCH, __double)
+{
+    run_tests<false, double>();
+}
+
+TEST_P(ARCH, __float_complex)
+{
+    run_tests<false, rocblas_float_complex>();
+}
+
+TEST_P(ARCH, __double_complex)
+{
+    run_tests<false, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(ARCH, strided_batched__float)
+{
+    run_tests<true, float>();
+}
+
+TEST_P(ARCH, strided_batched__double)
+{
+    run_tests<true, double>();
+}
+
+TEST_P(ARCH, strided_batched__float_complex)
+{
+    run_tests<true, rocblas_float_complex>();
+}
+
+TEST_P(ARCH, strided_batched__double_complex)
+{
+    run_tests<true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         ARCH,
+                         Combine(ValuesIn(function_range),
+                                 ValuesIn(size_range),
+                                 ValuesIn(uplo_range)));
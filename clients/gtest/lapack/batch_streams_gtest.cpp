@@ -0,0 +1,129 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+#include "common/lapack/testing_batch_streams.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<int, int> batch_streams_tuple;
+
+// each streams_range is the number of streams across which the batch of SYEVJ/HEEVJ is split
+// (22 problems with 4 streams give chunks of 6, 6, 6 and 4)
+// each size_range is the order n of the matrices (the blocked algorithm is used when n > 32)
+
+// case when streams = 2 and n = 20 also executes the bad arguments test
+// (configuration of the number of streams)
+
+const vector<int> streams_range = {2, 4, 7};
+
+// for checkin_lapack tests
+const vector<int> size_range = {20, 100};
+
+Arguments batch_streams_setup_arguments(batch_streams_tuple tup)
+{
+    Arguments arg;
+
+    arg.set<rocblas_int>("streams", std::get<0>(tup));
+    arg.set<rocblas_int>("n", std::get<1>(tup));
+
+    arg.timing = 0;
+    arg.batch_count = 22;
+
+    return arg;
+}
+
+class BATCH_STREAMS : public ::TestWithParam<batch_streams_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = batch_streams_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("streams") == 2 && arg.peek<rocblas_int>("n") == 20)
+            testing_batch_streams_bad_arg();
+
+        testing_batch_streams<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+// batched tests
+
+TEST_P(BATCH_STREAMS, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(BATCH_STREAMS, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(BATCH_STREAMS, batched__float_complex)
+{
+    run_tests<true, false, rocblas_float_complex>();
+}
+
+TEST_P(BATCH_STREAMS, batched__double_complex)
+{
+    run_tests<true, false, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(BATCH_STREAMS, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(BATCH_STREAMS, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(BATCH_STREAMS, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(BATCH_STREAMS, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         BATCH_STREAMS,
+                         Combine(ValuesIn(streams_range), ValuesIn(size_range)));
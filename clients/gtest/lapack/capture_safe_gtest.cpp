@@ -0,0 +1,121 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "common/lapack/testing_capture_safe.hpp"
+
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<string, int> capture_safe_tuple;
+
+// each function_range tuple is a {function, n}, where function is the function (or the
+// group of functions) that is captured into a graph and replayed on n-by-n matrices
+
+// the first function also executes the bad arguments test
+// (configuration of capture-safe mode)
+
+// for checkin_lapack tests
+const vector<capture_safe_tuple> function_range = {
+    // host-side convergence checks (the blocked SYEVJ needs n > 32)
+    {"syevj_heevj", 100},
+    {"syevdj_heevdj", 100},
+    {"sygvj_hegvj", 100},
+    {"gesvdj", 100},
+    {"geqp3", 100},
+    {"gelsy", 100},
+    // number of eigenvalues returned on the device
+    {"syevdx_heevdx_inplace", 100},
+    {"sygvdx_hegvdx_inplace", 100},
+    // pipelines of factorizations and solvers (with look-ahead requested)
+    {"getrf_getrs_potrf_potrs", 100},
+    {"lookahead", 300},
+    // copies of the host matrix (in more than one panel)
+    {"ooc", 600},
+    // not supported
+    {"vbatched", 1},
+};
+
+Arguments capture_safe_setup_arguments(capture_safe_tuple tup)
+{
+    Arguments arg;
+
+    arg.set<string>("function", std::get<0>(tup));
+    arg.set<rocblas_int>("n", std::get<1>(tup));
+
+    arg.timing = 0;
+    arg.batch_count = 4;
+
+    return arg;
+}
+
+class CAPTURE_SAFE : public ::TestWithParam<capture_safe_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = capture_safe_setup_arguments(GetParam());
+
+        if(arg.peek<string>("function") == std::get<0>(function_range[0]))
+            testing_capture_safe_bad_arg();
+
+        if(arg.peek<string>("function") == "vbatched")
+            testing_capture_safe_vbatched<T>();
+        else
+            testing_capture_safe<T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(CAPTURE_SAFE, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(CAPTURE_SAFE, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(CAPTURE_SAFE, __float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(CAPTURE_SAFE, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, CAPTURE_SAFE, ValuesIn(function_range));
@@ -56,6 +56,10 @@ const vector<vector<int>> matrix_size_range = {
     {16, 2, 20, 16, 16, 1},
     {10, 7, 10, 20, 10, 0},
     {10, 10, 10, 10, 20, 1},
+    // small block sizes (fused kernel)
+    {1, 12, 1, 1, 1, 0},
+    {4, 9, 4, 6, 4, 0},
+    {8, 6, 8, 8, 10, 1},
 };
 
 // for daily_lapack tests
@@ -57,6 +57,10 @@ const vector<vector<int>> matrix_size_range = {
     {16, 2, 10, 20, 16, 16, 16},
     {10, 7, 20, 10, 20, 10, 10},
     {10, 10, 20, 10, 10, 20, 20},
+    // small block sizes (fused kernel)
+    {1, 12, 5, 1, 1, 1, 1},
+    {4, 9, 10, 4, 6, 4, 4},
+    {8, 6, 3, 8, 8, 10, 12},
 };
 
 // for daily_lapack tests
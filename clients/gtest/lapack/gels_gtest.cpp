@@ -62,6 +62,8 @@ const vector<gels_params_A> matrix_sizeA_range = {
     {20, 30, 30, 40, 0},
     {40, 20, 40, 40, 1},
     {20, 40, 40, 40, 1},
+    // tall-skinny sample (GELS uses GEQRF_TSQR when m >= GELS_TSQR_RATIO * n)
+    {1300, 20, 1300, 1300, 0},
 };
 const vector<gels_params_B> matrix_sizeB_range = {
     // quick return
@@ -117,7 +119,8 @@ Arguments gels_setup_arguments(gels_tuple tup, bool outofplace)
     return arg;
 }
 
-class GELS : public ::TestWithParam<gels_tuple>
+template <typename I>
+class GELS_BASE : public ::TestWithParam<gels_tuple>
 {
 protected:
     void TearDown() override
@@ -131,17 +134,25 @@ protected:
         Arguments arg = gels_setup_arguments(GetParam(), false);
 
         if(arg.peek<rocblas_int>("n") == 0 && arg.peek<rocblas_int>("nrhs") == 0)
-            testing_gels_bad_arg<BATCHED, STRIDED, T>();
+            testing_gels_bad_arg<BATCHED, STRIDED, T, I>();
 
         arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
         if(arg.singular == 1)
-            testing_gels<BATCHED, STRIDED, T>(arg);
+            testing_gels<BATCHED, STRIDED, T, I>(arg);
 
         arg.singular = 0;
-        testing_gels<BATCHED, STRIDED, T>(arg);
+        testing_gels<BATCHED, STRIDED, T, I>(arg);
     }
 };
 
+class GELS : public GELS_BASE<rocblas_int>
+{
+};
+
+class GELS_64 : public GELS_BASE<int64_t>
+{
+};
+
 class GELS_OUTOFPLACE : public ::TestWithParam<gels_tuple>
 {
 protected:
@@ -189,6 +200,26 @@ TEST_P(GELS, __double_complex)
     run_tests<false, false, rocblas_double_complex>();
 }
 
+TEST_P(GELS_64, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GELS_64, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GELS_64, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GELS_64, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
 TEST_P(GELS_OUTOFPLACE, __float)
 {
     run_tests<false, false, float>();
@@ -231,6 +262,26 @@ TEST_P(GELS, batched__double_complex)
     run_tests<true, true, rocblas_double_complex>();
 }
 
+TEST_P(GELS_64, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GELS_64, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GELS_64, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GELS_64, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
 // strided_batched tests
 
 TEST_P(GELS, strided_batched__float)
@@ -253,6 +304,26 @@ TEST_P(GELS, strided_batched__double_complex)
     run_tests<false, true, rocblas_double_complex>();
 }
 
+TEST_P(GELS_64, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GELS_64, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GELS_64, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GELS_64, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
 INSTANTIATE_TEST_SUITE_P(daily_lapack,
                          GELS,
                          Combine(ValuesIn(large_matrix_sizeA_range),
@@ -262,6 +333,15 @@ INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          GELS,
                          Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
 
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GELS_64,
+                         Combine(ValuesIn(large_matrix_sizeA_range),
+                                 ValuesIn(large_matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GELS_64,
+                         Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
+
 INSTANTIATE_TEST_SUITE_P(daily_lapack,
                          GELS_OUTOFPLACE,
                          Combine(ValuesIn(large_matrix_sizeA_range),
@@ -270,3 +350,61 @@ INSTANTIATE_TEST_SUITE_P(daily_lapack,
 INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          GELS_OUTOFPLACE,
                          Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
+
+// host-side tests of the 64-bit API with dimensions above 2^31 (only the argument checks
+// and the workspace queries are exercised, so no kernels are launched)
+
+template <typename T, typename I>
+void gels_workspace(rocblas_handle handle, I m, I n, I nrhs, size_t* size)
+{
+    EXPECT_ROCBLAS_STATUS(rocblas_start_device_memory_size_query(handle), rocblas_status_success);
+    CHECK_ALLOC_QUERY(rocsolver_gels(false, handle, rocblas_operation_none, m, n, nrhs,
+                                     (T*)nullptr, m, 0, (T*)nullptr, std::max(m, n), 0,
+                                     (I*)nullptr, I(1)));
+    EXPECT_ROCBLAS_STATUS(rocblas_stop_device_memory_size_query(handle, size),
+                          rocblas_status_success);
+}
+
+TEST(checkin_lapack_GELS_64, large_sizes)
+{
+    rocblas_local_handle handle;
+    const int64_t big = int64_t(1) << 32;
+    const rocblas_operation none = rocblas_operation_none;
+
+    // the sizes are not truncated to 32 bits (truncated, the results of the argument checks
+    // would be different)
+    EXPECT_ROCBLAS_STATUS(rocsolver_dgels_strided_batched_64(handle, none, big + 10, 0, 0, nullptr,
+                                                             2 * big + 5, 0, nullptr, 2 * big + 5,
+                                                             0, nullptr, 0),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_dgels_64(handle, none, 5, 1, 0, nullptr, 5, nullptr, big + 1, nullptr),
+        rocblas_status_invalid_pointer);
+    EXPECT_ROCBLAS_STATUS(
+        rocsolver_zgels_64(handle, none, 5, big + 10, 0, nullptr, 5, nullptr, 20, nullptr),
+        rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocsolver_sgels_strided_batched_64(handle, none, 5, 5, 1, nullptr, 5, 25,
+                                                             nullptr, 5, 5, nullptr, -big),
+                          rocblas_status_invalid_size);
+}
+
+TEST(checkin_lapack_GELS_64, workspace)
+{
+    rocblas_local_handle handle;
+    size_t size_32, size_64;
+
+    // same workspace as the 32-bit API for matrices that fit 32-bit indexing
+    gels_workspace<double, rocblas_int>(handle, 1024, 1024, 64, &size_32);
+    gels_workspace<double, int64_t>(handle, 1024, 1024, 64, &size_64);
+    EXPECT_EQ(size_64, size_32);
+
+    // the tall-skinny QR is 32-bit only, so the 64-bit API also reserves the workspace of
+    // GEQRF and ORMQR for tall-skinny matrices
+    gels_workspace<double, rocblas_int>(handle, 1 << 16, 16, 16, &size_32);
+    gels_workspace<double, int64_t>(handle, 1 << 16, 16, 16, &size_64);
+    EXPECT_GE(size_64, size_32);
+
+    // matrices with more than INT32_MAX rows cannot have a valid leading dimension
+    gels_workspace<double, int64_t>(handle, int64_t(INT_MAX) + 1, 16, 16, &size_64);
+    EXPECT_EQ(size_64, size_t(0));
+}
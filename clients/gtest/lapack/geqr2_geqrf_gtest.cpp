@@ -70,6 +70,34 @@ const vector<vector<int>> large_matrix_size_range = {
 
 const vector<int> large_n_size_range = {64, 98, 130, 220, 400};
 
+// for checkin_lapack tests of the recursive algorithm (the blocks are factorized
+// recursively only when min(m, n) is larger than GEQxF_GEQx2_SWITCHSIZE)
+const vector<vector<int>> recursive_matrix_size_range = {
+    {150, 150},
+    {300, 320},
+};
+
+const vector<int> recursive_n_size_range = {130, 200};
+
+// for tests of the fused panel-apply kernels of the batched algorithm (used when
+// min(m, n) is between PANEL_APPLY_MIN_SIZE and PANEL_APPLY_MAX_SIZE, 128 and 512, and
+// batch_count >= PANEL_APPLY_MIN_BATCH, 64); the sizes and batch counts are on both
+// sides of the thresholds
+const vector<vector<int>> panel_apply_matrix_size_range = {
+    {127, 127},
+    {128, 130},
+    {200, 200},
+};
+
+const vector<int> panel_apply_n_size_range = {128, 200};
+
+const vector<vector<int>> large_panel_apply_matrix_size_range = {
+    {512, 512},
+    {513, 520},
+};
+
+const vector<int> large_panel_apply_n_size_range = {512, 513};
+
 Arguments geqrf_setup_arguments(geqrf_tuple tup)
 {
     vector<int> matrix_size = std::get<0>(tup);
@@ -88,7 +116,7 @@ Arguments geqrf_setup_arguments(geqrf_tuple tup)
     return arg;
 }
 
-template <bool BLOCKED>
+template <bool BLOCKED, typename I, rocblas_int MODE = 0, rocblas_int BC = 3>
 class GEQR2_GEQRF : public ::TestWithParam<geqrf_tuple>
 {
 protected:
@@ -101,20 +129,37 @@ protected:
     void run_tests()
     {
         Arguments arg = geqrf_setup_arguments(GetParam());
+        arg.alg_mode = MODE;
 
         if(arg.peek<rocblas_int>("m") == 0 && arg.peek<rocblas_int>("n") == 0)
-            testing_geqr2_geqrf_bad_arg<BATCHED, STRIDED, BLOCKED, T>();
+            testing_geqr2_geqrf_bad_arg<BATCHED, STRIDED, BLOCKED, T, I>();
 
-        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
-        testing_geqr2_geqrf<BATCHED, STRIDED, BLOCKED, T>(arg);
+        arg.batch_count = (BATCHED || STRIDED ? BC : 1);
+        testing_geqr2_geqrf<BATCHED, STRIDED, BLOCKED, T, I>(arg);
     }
 };
 
-class GEQR2 : public GEQR2_GEQRF<false>
+class GEQR2 : public GEQR2_GEQRF<false, rocblas_int>
+{
+};
+
+class GEQRF : public GEQR2_GEQRF<true, rocblas_int>
+{
+};
+
+class GEQRF_64 : public GEQR2_GEQRF<true, int64_t>
 {
 };
 
-class GEQRF : public GEQR2_GEQRF<true>
+class GEQRF_RECURSIVE : public GEQR2_GEQRF<true, rocblas_int, 1>
+{
+};
+
+class GEQRF_PANEL_APPLY : public GEQR2_GEQRF<true, rocblas_int, 0, 64>
+{
+};
+
+class GEQRF_NO_PANEL_APPLY : public GEQR2_GEQRF<true, rocblas_int, 0, 63>
 {
 };
 
@@ -160,6 +205,26 @@ TEST_P(GEQRF, __double_complex)
     run_tests<false, false, rocblas_double_complex>();
 }
 
+TEST_P(GEQRF_64, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GEQRF_64, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GEQRF_64, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GEQRF_64, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
 // batched tests
 
 TEST_P(GEQR2, batched__float)
@@ -202,6 +267,26 @@ TEST_P(GEQRF, batched__double_complex)
     run_tests<true, true, rocblas_double_complex>();
 }
 
+TEST_P(GEQRF_64, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GEQRF_64, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GEQRF_64, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GEQRF_64, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
 // strided_batched cases
 
 TEST_P(GEQR2, strided_batched__float)
@@ -244,6 +329,26 @@ TEST_P(GEQRF, strided_batched__double_complex)
     run_tests<false, true, rocblas_double_complex>();
 }
 
+TEST_P(GEQRF_64, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GEQRF_64, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GEQRF_64, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GEQRF_64, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
 // ptr_batched tests
 
 TEST_P(GEQRF, ptr_batched__float)
@@ -281,3 +386,224 @@ INSTANTIATE_TEST_SUITE_P(daily_lapack,
 INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          GEQRF,
                          Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GEQRF_64,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GEQRF_64,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
+
+// host-side tests of the 64-bit API with dimensions above 2^31 (only the argument checks
+// and the workspace queries are exercised, so no kernels are launched)
+
+template <typename T, typename I>
+void geqrf_workspace(rocblas_handle handle, I m, I n, I lda, size_t* size)
+{
+    EXPECT_ROCBLAS_STATUS(rocblas_start_device_memory_size_query(handle), rocblas_status_success);
+    CHECK_ALLOC_QUERY(rocsolver_geqr2_geqrf(false, true, handle, m, n, (T*)nullptr, lda, 0,
+                                            (T*)nullptr, 0, I(1)));
+    EXPECT_ROCBLAS_STATUS(rocblas_stop_device_memory_size_query(handle, size),
+                          rocblas_status_success);
+}
+
+TEST(checkin_lapack_GEQRF_64, large_sizes)
+{
+    rocblas_local_handle handle;
+    const int64_t big = int64_t(1) << 32;
+
+    // the sizes are not truncated to 32 bits (truncated, lda would be smaller than m)
+    EXPECT_ROCBLAS_STATUS(rocsolver_dgeqrf_64(handle, big + 10, 0, nullptr, 2 * big + 5, nullptr),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_dgeqrf_64(handle, 5, 0, nullptr, big + 1, nullptr),
+                          rocblas_status_success);
+    EXPECT_ROCBLAS_STATUS(rocsolver_dgeqrf_64(handle, big + 1, 1, nullptr, big, nullptr),
+                          rocblas_status_invalid_size);
+    EXPECT_ROCBLAS_STATUS(rocsolver_dgeqrf_strided_batched_64(handle, 5, 5, nullptr, 5, 25,
+                                                              nullptr, 5, -big),
+                          rocblas_status_invalid_size);
+}
+
+TEST(checkin_lapack_GEQRF_64, workspace)
+{
+    rocblas_local_handle handle;
+    size_t size_32, size_64, size_strip, size_large;
+
+    // same workspace as the 32-bit API for matrices that fit 32-bit indexing
+    geqrf_workspace<double, rocblas_int>(handle, 1024, 1024, 1024, &size_32);
+    geqrf_workspace<double, int64_t>(handle, 1024, 1024, 1024, &size_64);
+    EXPECT_EQ(size_64, size_32);
+
+    // if lda*n is larger than 2^31, the trailing matrix is updated in strips of w columns
+    // that can be addressed with 32-bit indices, so the workspace does not grow with n
+    const int64_t m = 1024;
+    const int64_t nb = 64; // (GEQxF_BLOCKSIZE)
+    const int64_t w = (INT_MAX - 1) / m;
+    geqrf_workspace<double, int64_t>(handle, m, w + nb, m, &size_strip);
+    geqrf_workspace<double, int64_t>(handle, m, 4 * w, m, &size_large);
+    EXPECT_EQ(size_large, size_strip);
+    EXPECT_LT(size_large, sizeof(double) * nb * (4 * w - nb));
+}
+
+// recursive algorithm tests
+TEST_P(GEQRF_RECURSIVE, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GEQRF_RECURSIVE, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GEQRF_RECURSIVE, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GEQRF_RECURSIVE, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+TEST_P(GEQRF_RECURSIVE, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GEQRF_RECURSIVE, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GEQRF_RECURSIVE, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GEQRF_RECURSIVE, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+TEST_P(GEQRF_RECURSIVE, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GEQRF_RECURSIVE, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GEQRF_RECURSIVE, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GEQRF_RECURSIVE, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GEQRF_RECURSIVE,
+                         Combine(ValuesIn(recursive_matrix_size_range),
+                                 ValuesIn(recursive_n_size_range)));
+
+// panel-apply tests
+TEST_P(GEQRF_PANEL_APPLY, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(GEQRF_PANEL_APPLY, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(GEQRF_PANEL_APPLY, batched__float_complex)
+{
+    run_tests<true, false, rocblas_float_complex>();
+}
+
+TEST_P(GEQRF_PANEL_APPLY, batched__double_complex)
+{
+    run_tests<true, false, rocblas_double_complex>();
+}
+
+TEST_P(GEQRF_PANEL_APPLY, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GEQRF_PANEL_APPLY, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GEQRF_PANEL_APPLY, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GEQRF_PANEL_APPLY, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+TEST_P(GEQRF_NO_PANEL_APPLY, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(GEQRF_NO_PANEL_APPLY, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(GEQRF_NO_PANEL_APPLY, batched__float_complex)
+{
+    run_tests<true, false, rocblas_float_complex>();
+}
+
+TEST_P(GEQRF_NO_PANEL_APPLY, batched__double_complex)
+{
+    run_tests<true, false, rocblas_double_complex>();
+}
+
+TEST_P(GEQRF_NO_PANEL_APPLY, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GEQRF_NO_PANEL_APPLY, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GEQRF_NO_PANEL_APPLY, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GEQRF_NO_PANEL_APPLY, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GEQRF_PANEL_APPLY,
+                         Combine(ValuesIn(large_panel_apply_matrix_size_range),
+                                 ValuesIn(large_panel_apply_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GEQRF_PANEL_APPLY,
+                         Combine(ValuesIn(panel_apply_matrix_size_range),
+                                 ValuesIn(panel_apply_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GEQRF_NO_PANEL_APPLY,
+                         Combine(ValuesIn(panel_apply_matrix_size_range),
+                                 ValuesIn(panel_apply_n_size_range)));
@@ -0,0 +1,142 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "common/lapack/testing_geqrf_vbatched.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, int> geqrf_vbatched_tuple;
+
+// each matrix_size_range vector is a {max_m, lda}
+
+// the sizes of the problems in the batch are derived from max_m and max_n (see vbatched_size)
+
+// case when max_m = max_n = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // empty problems
+    {0, 1},
+    // invalid
+    {-1, 1},
+    {20, 5},
+    // normal (valid) samples
+    {50, 50},
+    {70, 100},
+    {130, 130},
+};
+
+const vector<int> n_size_range = {
+    // empty problems
+    0,
+    // invalid
+    -1,
+    // normal (valid) samples
+    16,
+    20,
+    130,
+};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range = {
+    {152, 152}, {640, 640}, {1000, 1024},
+};
+
+const vector<int> large_n_size_range = {64, 98, 130, 220};
+
+Arguments geqrf_vbatched_setup_arguments(geqrf_vbatched_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    int n_size = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("m", matrix_size[0]);
+    arg.set<rocblas_int>("n", n_size);
+    arg.set<rocblas_int>("lda", matrix_size[1]);
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class GEQRF_VBATCHED : public ::TestWithParam<geqrf_vbatched_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = geqrf_vbatched_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("m") == 0 && arg.peek<rocblas_int>("n") == 0)
+            testing_geqrf_vbatched_bad_arg<T>();
+
+        // (a full cycle of the sizes given by vbatched_size)
+        arg.batch_count = 12;
+        testing_geqrf_vbatched<T>(arg);
+    }
+};
+
+// vbatched tests
+
+TEST_P(GEQRF_VBATCHED, vbatched__float)
+{
+    run_tests<float>();
+}
+
+TEST_P(GEQRF_VBATCHED, vbatched__double)
+{
+    run_tests<double>();
+}
+
+TEST_P(GEQRF_VBATCHED, vbatched__float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(GEQRF_VBATCHED, vbatched__double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GEQRF_VBATCHED,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GEQRF_VBATCHED,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
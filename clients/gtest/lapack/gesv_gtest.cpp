@@ -68,6 +68,18 @@ const vector<int> matrix_sizeB_range = {
     30,
 };
 
+// for checkin_lapack tests on both sides of GESV_SMALL_SWITCHSIZE (the matrices that are not
+// larger are factorized and solved by a single kernel, with one thread per row of A and per
+// right-hand side)
+const vector<vector<int>> small_matrix_sizeA_range = {
+    {31, 31, 31, 0},
+    {32, 32, 40, 1},
+    {32, 40, 32, 0},
+    {33, 33, 33, 1},
+    {33, 40, 40, 0},
+};
+const vector<int> small_matrix_sizeB_range = {1, 32, 33};
+
 // for daily_lapack tests
 const vector<vector<int>> large_matrix_sizeA_range = {{70, 70, 100, 0},
                                                       {192, 192, 192, 1},
@@ -246,6 +258,11 @@ INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          GESV,
                          Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
 
+INSTANTIATE_TEST_SUITE_P(checkin_lapack_small,
+                         GESV,
+                         Combine(ValuesIn(small_matrix_sizeA_range),
+                                 ValuesIn(small_matrix_sizeB_range)));
+
 INSTANTIATE_TEST_SUITE_P(daily_lapack,
                          GESV_OUTOFPLACE,
                          Combine(ValuesIn(large_matrix_sizeA_range),
@@ -254,3 +271,8 @@ INSTANTIATE_TEST_SUITE_P(daily_lapack,
 INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          GESV_OUTOFPLACE,
                          Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack_small,
+                         GESV_OUTOFPLACE,
+                         Combine(ValuesIn(small_matrix_sizeA_range),
+                                 ValuesIn(small_matrix_sizeB_range)));
@@ -0,0 +1,169 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "common/lapack/testing_gesv_rbt.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, int> gesv_rbt_tuple;
+
+// each A_range vector is a {N, lda, ldb};
+
+// each B_range value is nrhs
+
+// case when N = nrhs = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_sizeA_range = {
+    // quick return
+    {0, 1, 1},
+    // invalid
+    {-1, 1, 1},
+    {10, 2, 10},
+    {10, 10, 2},
+    /// normal (valid) samples
+    {1, 1, 1},
+    {20, 20, 20},
+    {33, 50, 33},
+    {50, 60, 60},
+    {100, 100, 100}};
+const vector<int> matrix_sizeB_range = {
+    // quick return
+    0,
+    // invalid
+    -1,
+    // normal (valid) samples
+    1,
+    10,
+    30,
+};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_sizeA_range
+    = {{192, 192, 192}, {600, 700, 645}, {1000, 1000, 1000}};
+const vector<int> large_matrix_sizeB_range = {
+    100,
+    524,
+};
+
+Arguments gesv_rbt_setup_arguments(gesv_rbt_tuple tup)
+{
+    vector<int> matrix_sizeA = std::get<0>(tup);
+    int matrix_sizeB = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", matrix_sizeA[0]);
+    arg.set<rocblas_int>("nrhs", matrix_sizeB);
+    arg.set<rocblas_int>("lda", matrix_sizeA[1]);
+    arg.set<rocblas_int>("ldb", matrix_sizeA[2]);
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class GESV_RBT : public ::TestWithParam<gesv_rbt_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = gesv_rbt_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("n") == 0 && arg.peek<rocblas_int>("nrhs") == 0)
+            testing_gesv_rbt_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = 3;
+        testing_gesv_rbt<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+// batched tests
+
+TEST_P(GESV_RBT, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GESV_RBT, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GESV_RBT, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GESV_RBT, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(GESV_RBT, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GESV_RBT, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GESV_RBT, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GESV_RBT, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GESV_RBT,
+                         Combine(ValuesIn(large_matrix_sizeA_range),
+                                 ValuesIn(large_matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GESV_RBT,
+                         Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
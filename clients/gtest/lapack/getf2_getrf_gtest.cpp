@@ -77,6 +77,35 @@ const vector<int> large_n_size_range = {
     45, 64, 520, 1024, 2000,
 };
 
+// for checkin_lapack tests of the recursive algorithm (the panels are factorized
+// recursively only when they have more than GETRF_RECURSIVE_PANEL_MINSIZE columns)
+const vector<vector<int>> recursive_matrix_size_range = {
+    {70, 70, 0},
+    {150, 150, 1},
+    {600, 600, 0},
+};
+
+const vector<int> recursive_n_size_range = {80, 150, 600};
+
+// for tests of the fused panel-apply kernels of the batched algorithm (used when
+// min(m, n) is between PANEL_APPLY_MIN_SIZE and PANEL_APPLY_MAX_SIZE, 128 and 512, and
+// batch_count >= PANEL_APPLY_MIN_BATCH, 64); the sizes and batch counts are on both
+// sides of the thresholds
+const vector<vector<int>> panel_apply_matrix_size_range = {
+    {127, 127, 0},
+    {128, 130, 1},
+    {200, 200, 0},
+};
+
+const vector<int> panel_apply_n_size_range = {128, 200};
+
+const vector<vector<int>> large_panel_apply_matrix_size_range = {
+    {512, 512, 1},
+    {513, 520, 0},
+};
+
+const vector<int> large_panel_apply_n_size_range = {512, 513};
+
 Arguments getrf_setup_arguments(getrf_tuple tup)
 {
     vector<int> matrix_size = std::get<0>(tup);
@@ -96,7 +125,7 @@ Arguments getrf_setup_arguments(getrf_tuple tup)
     return arg;
 }
 
-template <bool BLOCKED, typename I>
+template <bool BLOCKED, typename I, rocblas_int MODE = 0, rocblas_int BC = 3>
 class GETF2_GETRF : public ::TestWithParam<getrf_tuple>
 {
 protected:
@@ -109,11 +138,12 @@ protected:
     void run_tests()
     {
         Arguments arg = getrf_setup_arguments(GetParam());
+        arg.alg_mode = MODE;
 
         if(arg.peek<rocblas_int>("m") == 0 && arg.peek<rocblas_int>("n") == 0)
             testing_getf2_getrf_bad_arg<BATCHED, STRIDED, BLOCKED, T, I>();
 
-        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        arg.batch_count = (BATCHED || STRIDED ? BC : 1);
         if(arg.singular == 1)
             testing_getf2_getrf<BATCHED, STRIDED, BLOCKED, T, I>(arg);
 
@@ -122,7 +152,7 @@ protected:
     }
 };
 
-template <bool BLOCKED, typename I>
+template <bool BLOCKED, typename I, rocblas_int MODE = 0, rocblas_int BC = 3>
 class GETF2_GETRF_NPVT : public ::TestWithParam<getrf_tuple>
 {
 protected:
@@ -135,11 +165,12 @@ protected:
     void run_tests()
     {
         Arguments arg = getrf_setup_arguments(GetParam());
+        arg.alg_mode = MODE;
 
         if(arg.peek<rocblas_int>("m") == 0 && arg.peek<rocblas_int>("n") == 0)
             testing_getf2_getrf_npvt_bad_arg<BATCHED, STRIDED, BLOCKED, T, I>();
 
-        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        arg.batch_count = (BATCHED || STRIDED ? BC : 1);
         if(arg.singular == 1)
             testing_getf2_getrf_npvt<BATCHED, STRIDED, BLOCKED, T, I>(arg);
 
@@ -180,6 +211,30 @@ class GETRF_NPVT_64 : public GETF2_GETRF_NPVT<true, int64_t>
 {
 };
 
+class GETRF_RECURSIVE : public GETF2_GETRF<true, rocblas_int, 1>
+{
+};
+
+class GETRF_NPVT_RECURSIVE : public GETF2_GETRF_NPVT<true, rocblas_int, 1>
+{
+};
+
+class GETRF_PANEL_APPLY : public GETF2_GETRF<true, rocblas_int, 0, 64>
+{
+};
+
+class GETRF_NPVT_PANEL_APPLY : public GETF2_GETRF_NPVT<true, rocblas_int, 0, 64>
+{
+};
+
+class GETRF_NO_PANEL_APPLY : public GETF2_GETRF<true, rocblas_int, 0, 63>
+{
+};
+
+class GETRF_NPVT_NO_PANEL_APPLY : public GETF2_GETRF_NPVT<true, rocblas_int, 0, 63>
+{
+};
+
 // non-batch tests
 TEST_P(GETF2_NPVT, __float)
 {
@@ -726,3 +781,325 @@ INSTANTIATE_TEST_SUITE_P(daily_lapack,
 INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          GETRF_64,
                          Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
+
+// recursive algorithm tests
+TEST_P(GETRF_NPVT_RECURSIVE, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GETRF_NPVT_RECURSIVE, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GETRF_NPVT_RECURSIVE, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GETRF_NPVT_RECURSIVE, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+TEST_P(GETRF_NPVT_RECURSIVE, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GETRF_NPVT_RECURSIVE, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GETRF_NPVT_RECURSIVE, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GETRF_NPVT_RECURSIVE, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+TEST_P(GETRF_NPVT_RECURSIVE, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GETRF_NPVT_RECURSIVE, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GETRF_NPVT_RECURSIVE, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GETRF_NPVT_RECURSIVE, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+TEST_P(GETRF_RECURSIVE, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GETRF_RECURSIVE, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GETRF_RECURSIVE, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GETRF_RECURSIVE, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+TEST_P(GETRF_RECURSIVE, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GETRF_RECURSIVE, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GETRF_RECURSIVE, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GETRF_RECURSIVE, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+TEST_P(GETRF_RECURSIVE, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GETRF_RECURSIVE, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GETRF_RECURSIVE, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GETRF_RECURSIVE, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GETRF_NPVT_RECURSIVE,
+                         Combine(ValuesIn(recursive_matrix_size_range),
+                                 ValuesIn(recursive_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GETRF_RECURSIVE,
+                         Combine(ValuesIn(recursive_matrix_size_range),
+                                 ValuesIn(recursive_n_size_range)));
+
+// panel-apply tests
+TEST_P(GETRF_PANEL_APPLY, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(GETRF_PANEL_APPLY, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(GETRF_PANEL_APPLY, batched__float_complex)
+{
+    run_tests<true, false, rocblas_float_complex>();
+}
+
+TEST_P(GETRF_PANEL_APPLY, batched__double_complex)
+{
+    run_tests<true, false, rocblas_double_complex>();
+}
+
+TEST_P(GETRF_PANEL_APPLY, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GETRF_PANEL_APPLY, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GETRF_PANEL_APPLY, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GETRF_PANEL_APPLY, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+TEST_P(GETRF_NPVT_PANEL_APPLY, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(GETRF_NPVT_PANEL_APPLY, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(GETRF_NPVT_PANEL_APPLY, batched__float_complex)
+{
+    run_tests<true, false, rocblas_float_complex>();
+}
+
+TEST_P(GETRF_NPVT_PANEL_APPLY, batched__double_complex)
+{
+    run_tests<true, false, rocblas_double_complex>();
+}
+
+TEST_P(GETRF_NPVT_PANEL_APPLY, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GETRF_NPVT_PANEL_APPLY, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GETRF_NPVT_PANEL_APPLY, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GETRF_NPVT_PANEL_APPLY, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+TEST_P(GETRF_NO_PANEL_APPLY, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(GETRF_NO_PANEL_APPLY, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(GETRF_NO_PANEL_APPLY, batched__float_complex)
+{
+    run_tests<true, false, rocblas_float_complex>();
+}
+
+TEST_P(GETRF_NO_PANEL_APPLY, batched__double_complex)
+{
+    run_tests<true, false, rocblas_double_complex>();
+}
+
+TEST_P(GETRF_NO_PANEL_APPLY, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GETRF_NO_PANEL_APPLY, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GETRF_NO_PANEL_APPLY, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GETRF_NO_PANEL_APPLY, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+TEST_P(GETRF_NPVT_NO_PANEL_APPLY, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(GETRF_NPVT_NO_PANEL_APPLY, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(GETRF_NPVT_NO_PANEL_APPLY, batched__float_complex)
+{
+    run_tests<true, false, rocblas_float_complex>();
+}
+
+TEST_P(GETRF_NPVT_NO_PANEL_APPLY, batched__double_complex)
+{
+    run_tests<true, false, rocblas_double_complex>();
+}
+
+TEST_P(GETRF_NPVT_NO_PANEL_APPLY, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GETRF_NPVT_NO_PANEL_APPLY, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GETRF_NPVT_NO_PANEL_APPLY, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GETRF_NPVT_NO_PANEL_APPLY, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GETRF_PANEL_APPLY,
+                         Combine(ValuesIn(large_panel_apply_matrix_size_range),
+                                 ValuesIn(large_panel_apply_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GETRF_PANEL_APPLY,
+                         Combine(ValuesIn(panel_apply_matrix_size_range),
+                                 ValuesIn(panel_apply_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GETRF_NPVT_PANEL_APPLY,
+                         Combine(ValuesIn(large_panel_apply_matrix_size_range),
+                                 ValuesIn(large_panel_apply_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GETRF_NPVT_PANEL_APPLY,
+                         Combine(ValuesIn(panel_apply_matrix_size_range),
+                                 ValuesIn(panel_apply_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GETRF_NO_PANEL_APPLY,
+                         Combine(ValuesIn(panel_apply_matrix_size_range),
+                                 ValuesIn(panel_apply_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GETRF_NPVT_NO_PANEL_APPLY,
+                         Combine(ValuesIn(panel_apply_matrix_size_range),
+                                 ValuesIn(panel_apply_n_size_range)));
@@ -0,0 +1,148 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "common/lapack/testing_getrf_ooc.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, int> getrf_ooc_tuple;
+
+// each matrix_size_range vector is a {m, lda, singular}
+// if singular = 1, then the used matrix for the tests is singular
+
+// the matrix is processed by panels of OOC_BLOCKSIZE (512) columns, so that the larger sizes
+// span several panels, the last one incomplete
+
+// case when m = n = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0, 1, 0},
+    // invalid
+    {-1, 1, 0},
+    {20, 5, 0},
+    // normal (valid) samples
+    {50, 50, 1},
+    {600, 600, 1},
+    {1100, 1103, 0}};
+
+const vector<int> n_size_range = {
+    // quick return
+    0,
+    // invalid
+    -1,
+    // normal (valid) samples
+    20,
+    600,
+    1100,
+    // (the first zero pivot of a singular matrix is in the second panel)
+    2100,
+};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range = {
+    {1536, 1536, 0}, {3000, 3072, 1},
+};
+
+const vector<int> large_n_size_range = {1536, 3000};
+
+Arguments getrf_ooc_setup_arguments(getrf_ooc_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    int n_size = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("m", matrix_size[0]);
+    arg.set<rocblas_int>("n", n_size);
+    arg.set<rocblas_int>("lda", matrix_size[1]);
+
+    arg.timing = 0;
+    arg.singular = matrix_size[2];
+
+    return arg;
+}
+
+class GETRF_OOC : public ::TestWithParam<getrf_ooc_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = getrf_ooc_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("m") == 0 && arg.peek<rocblas_int>("n") == 0)
+            testing_getrf_ooc_bad_arg<T>();
+
+        if(arg.singular == 1)
+            testing_getrf_ooc<T>(arg);
+
+        arg.singular = 0;
+        testing_getrf_ooc<T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(GETRF_OOC, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(GETRF_OOC, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(GETRF_OOC, __float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(GETRF_OOC, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GETRF_OOC,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GETRF_OOC,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
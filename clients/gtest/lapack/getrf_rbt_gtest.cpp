@@ -0,0 +1,160 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "common/lapack/testing_getrf_rbt.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, int> getrf_rbt_tuple;
+
+// each matrix_size_range vector is a {n, lda}
+
+// each uv_padding_range value is the extra space between consecutive transforms
+// (strideUV = 4*n + padding)
+
+// case when n = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0, 1},
+    // invalid
+    {-1, 1},
+    {20, 5},
+    // normal (valid) samples
+    {1, 1},
+    {3, 3},
+    {32, 32},
+    {50, 60},
+    {100, 100}};
+
+const vector<int> uv_padding_range = {0, 7};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range = {
+    {192, 192},
+    {500, 600},
+    {1024, 1024},
+};
+
+Arguments getrf_rbt_setup_arguments(getrf_rbt_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    int uv_padding = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", matrix_size[0]);
+    arg.set<rocblas_int>("lda", matrix_size[1]);
+
+    if(uv_padding > 0)
+        arg.set<rocblas_stride>("strideUV", 4 * matrix_size[0] + uv_padding);
+
+    // only testing standard use case/defaults for the other strides
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class GETRF_RBT : public ::TestWithParam<getrf_rbt_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = getrf_rbt_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("n") == 0)
+            testing_getrf_rbt_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = 3;
+        testing_getrf_rbt<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+// batched tests
+
+TEST_P(GETRF_RBT, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GETRF_RBT, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GETRF_RBT, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GETRF_RBT, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(GETRF_RBT, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GETRF_RBT, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GETRF_RBT, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GETRF_RBT, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GETRF_RBT,
+                         Combine(ValuesIn(large_matrix_size_range), Values(0)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GETRF_RBT,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(uv_padding_range)));
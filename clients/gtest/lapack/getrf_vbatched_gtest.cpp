@@ -0,0 +1,148 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "common/lapack/testing_getrf_vbatched.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, int> getrf_vbatched_tuple;
+
+// each matrix_size_range vector is a {max_m, lda, singular}
+// if singular = 1, then the used matrices for the tests are singular
+
+// the sizes of the problems in the batch are derived from max_m and max_n (see vbatched_size),
+// so that there are problems of repeated sizes and of different sizes in the same size class
+
+// case when max_m = max_n = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // empty problems
+    {0, 1, 0},
+    // invalid
+    {-1, 1, 0},
+    {20, 5, 0},
+    // normal (valid) samples
+    {1, 1, 0},
+    {40, 40, 1},
+    {90, 100, 0}};
+
+const vector<int> n_size_range = {
+    // empty problems
+    0,
+    // invalid
+    -1,
+    // normal (valid) samples
+    12,
+    40,
+    90,
+};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range = {
+    {192, 192, 0}, {640, 640, 1}, {1000, 1024, 0},
+};
+
+const vector<int> large_n_size_range = {64, 520, 1024};
+
+Arguments getrf_vbatched_setup_arguments(getrf_vbatched_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    int n_size = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("m", matrix_size[0]);
+    arg.set<rocblas_int>("n", n_size);
+    arg.set<rocblas_int>("lda", matrix_size[1]);
+
+    arg.timing = 0;
+    arg.singular = matrix_size[2];
+
+    return arg;
+}
+
+class GETRF_VBATCHED : public ::TestWithParam<getrf_vbatched_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = getrf_vbatched_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("m") == 0 && arg.peek<rocblas_int>("n") == 0)
+            testing_getrf_vbatched_bad_arg<T>();
+
+        // (a full cycle of the sizes given by vbatched_size)
+        arg.batch_count = 12;
+        if(arg.singular == 1)
+            testing_getrf_vbatched<T>(arg);
+
+        arg.singular = 0;
+        testing_getrf_vbatched<T>(arg);
+    }
+};
+
+// vbatched tests
+
+TEST_P(GETRF_VBATCHED, vbatched__float)
+{
+    run_tests<float>();
+}
+
+TEST_P(GETRF_VBATCHED, vbatched__double)
+{
+    run_tests<double>();
+}
+
+TEST_P(GETRF_VBATCHED, vbatched__float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(GETRF_VBATCHED, vbatched__double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         GETRF_VBATCHED,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_n_size_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GETRF_VBATCHED,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(n_size_range)));
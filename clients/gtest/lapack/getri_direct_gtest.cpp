@@ -0,0 +1,149 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "common/lapack/testing_getri_direct.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef vector<int> getri_direct_tuple;
+
+// each matrix_size_range vector is a {n, lda, singular}
+// if singular = 1, then the used matrix for the tests is singular
+
+// case when n = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+// (only matrices with n <= 32 are supported)
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0, 1, 0},
+    // invalid
+    {-1, 1, 0},
+    {20, 5, 0},
+    {33, 33, 0},
+    // normal (valid) samples
+    {1, 1, 0},
+    {2, 2, 1},
+    {5, 8, 0},
+    {10, 10, 1},
+    {17, 20, 1},
+    {31, 31, 0},
+    {32, 32, 1},
+    {32, 40, 0}};
+
+Arguments getri_direct_setup_arguments(getri_direct_tuple tup)
+{
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", tup[0]);
+    arg.set<rocblas_int>("lda", tup[1]);
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+    arg.singular = tup[2];
+
+    return arg;
+}
+
+class GETRI_DIRECT : public ::TestWithParam<getri_direct_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = getri_direct_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("n") == 0)
+            testing_getri_direct_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = 3;
+        if(arg.singular == 1)
+            testing_getri_direct<BATCHED, STRIDED, T>(arg);
+
+        arg.singular = 0;
+        testing_getri_direct<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+// batched tests
+
+TEST_P(GETRI_DIRECT, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(GETRI_DIRECT, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(GETRI_DIRECT, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(GETRI_DIRECT, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(GETRI_DIRECT, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GETRI_DIRECT, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GETRI_DIRECT, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GETRI_DIRECT, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+// checkin_lapack tests normal execution with small sizes, invalid sizes,
+// quick returns, and corner cases
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, GETRI_DIRECT, ValuesIn(matrix_size_range));
@@ -0,0 +1,171 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "common/lapack/testing_gtsv_nopivot.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef vector<int> gtsv_nopivot_tuple;
+
+// each matrix_size_range vector is a {n, nrhs, ldb}
+
+// case when n = nrhs = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0, 0, 1},
+    {20, 0, 20},
+    // invalid
+    {-1, 1, 1},
+    {10, -1, 10},
+    {10, 1, 2},
+    // normal (valid) samples
+    {1, 1, 1},
+    {2, 3, 2},
+    {20, 10, 20},
+    {37, 2, 40},
+    // large enough to be solved with parallel cyclic reduction
+    // (when the equations fit in the LDS)
+    {150, 30, 150},
+    {500, 2, 512},
+    {1000, 1, 1000}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range = {
+    {300, 10, 300},
+    {640, 30, 700},
+    {2000, 64, 2000},
+};
+
+Arguments gtsv_nopivot_setup_arguments(gtsv_nopivot_tuple tup, bool interleaved)
+{
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", tup[0]);
+    arg.set<rocblas_int>("nrhs", tup[1]);
+
+    if(!interleaved)
+    {
+        arg.set<rocblas_int>("ldb", tup[2]);
+
+        // only testing standard use case/defaults for strides
+    }
+    else
+    {
+        // normal use case is covered by strided_batched tests
+        rocblas_int bc = 3;
+
+        arg.set<rocblas_int>("incd", bc);
+        arg.set<rocblas_int>("incb", bc);
+        arg.set<rocblas_int>("ldb", bc * tup[2]);
+
+        arg.set<rocblas_stride>("strideD", 1);
+        arg.set<rocblas_stride>("strideB", 1);
+    }
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class GTSV_NOPIVOT : public ::TestWithParam<gtsv_nopivot_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <bool INTERLEAVED, typename T>
+    void run_tests()
+    {
+        Arguments arg = gtsv_nopivot_setup_arguments(GetParam(), INTERLEAVED);
+
+        if(arg.peek<rocblas_int>("n") == 0 && arg.peek<rocblas_int>("nrhs") == 0)
+            testing_gtsv_nopivot_bad_arg<INTERLEAVED, T>();
+
+        arg.batch_count = 3;
+        testing_gtsv_nopivot<INTERLEAVED, T>(arg);
+    }
+};
+
+// strided_batched tests
+
+TEST_P(GTSV_NOPIVOT, strided_batched__float)
+{
+    run_tests<false, float>();
+}
+
+TEST_P(GTSV_NOPIVOT, strided_batched__double)
+{
+    run_tests<false, double>();
+}
+
+TEST_P(GTSV_NOPIVOT, strided_batched__float_complex)
+{
+    run_tests<false, rocblas_float_complex>();
+}
+
+TEST_P(GTSV_NOPIVOT, strided_batched__double_complex)
+{
+    run_tests<false, rocblas_double_complex>();
+}
+
+// interleaved_batched tests
+
+TEST_P(GTSV_NOPIVOT, interleaved_batched__float)
+{
+    run_tests<true, float>();
+}
+
+TEST_P(GTSV_NOPIVOT, interleaved_batched__double)
+{
+    run_tests<true, double>();
+}
+
+TEST_P(GTSV_NOPIVOT, interleaved_batched__float_complex)
+{
+    run_tests<true, rocblas_float_complex>();
+}
+
+TEST_P(GTSV_NOPIVOT, interleaved_batched__double_complex)
+{
+    run_tests<true, rocblas_double_complex>();
+}
+
+// daily_lapack tests normal execution with medium to large sizes
+INSTANTIATE_TEST_SUITE_P(daily_lapack, GTSV_NOPIVOT, ValuesIn(large_matrix_size_range));
+
+// checkin_lapack tests normal execution with small sizes, invalid sizes,
+// quick returns, and corner cases
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, GTSV_NOPIVOT, ValuesIn(matrix_size_range));
@@ -0,0 +1,145 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+#include "common/lapack/testing_lookahead.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<string, int, int> lookahead_tuple;
+
+// each function_range is the factorization that is executed with and without look-ahead
+// each size_range is the order n of the matrices (look-ahead is only used when there is more
+// than one block panel)
+// each mode_range is the rocsolver_alg_mode used for the factorization
+
+// case when function = "getrf" and mode = default also executes the bad arguments test
+// (configuration of look-ahead and algorithm modes)
+
+const vector<string> function_range = {"getrf", "potrf_lower", "potrf_upper", "geqrf"};
+
+const vector<int> mode_range = {rocsolver_alg_mode_default, rocsolver_alg_mode_recursive};
+
+// for checkin_lapack tests
+const vector<int> size_range = {20, 300};
+
+// for daily_lapack tests
+const vector<int> large_size_range = {1100};
+
+Arguments lookahead_setup_arguments(lookahead_tuple tup)
+{
+    Arguments arg;
+
+    arg.set<string>("function", std::get<0>(tup));
+    arg.set<rocblas_int>("n", std::get<1>(tup));
+    arg.set<rocblas_int>("alg_mode", std::get<2>(tup));
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class LOOKAHEAD : public ::TestWithParam<lookahead_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = lookahead_setup_arguments(GetParam());
+
+        if(arg.peek<string>("function") == function_range[0]
+           && arg.peek<rocblas_int>("alg_mode") == rocsolver_alg_mode_default)
+            testing_lookahead_bad_arg();
+
+        arg.batch_count = (STRIDED ? 3 : 1);
+        testing_lookahead<STRIDED, T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(LOOKAHEAD, __float)
+{
+    run_tests<false, float>();
+}
+
+TEST_P(LOOKAHEAD, __double)
+{
+    run_tests<false, double>();
+}
+
+TEST_P(LOOKAHEAD, __float_complex)
+{
+    run_tests<false, rocblas_float_complex>();
+}
+
+TEST_P(LOOKAHEAD, __double_complex)
+{
+    run_tests<false, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(LOOKAHEAD, strided_batched__float)
+{
+    run_tests<true, float>();
+}
+
+TEST_P(LOOKAHEAD, strided_batched__double)
+{
+    run_tests<true, double>();
+}
+
+TEST_P(LOOKAHEAD, strided_batched__float_complex)
+{
+    run_tests<true, rocblas_float_complex>();
+}
+
+TEST_P(LOOKAHEAD, strided_batched__double_complex)
+{
+    run_tests<true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         LOOKAHEAD,
+                         Combine(ValuesIn(function_range),
+                                 ValuesIn(large_size_range),
+                                 ValuesIn(mode_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         LOOKAHEAD,
+                         Combine(ValuesIn(function_range),
+                                 ValuesIn(size_range),
+                                 ValuesIn(mode_range)));
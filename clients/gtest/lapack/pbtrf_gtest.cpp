@@ -0,0 +1,211 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "common/lapack/testing_pbtrf.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<int>> pbtrf_tuple;
+
+// each matrix_size_range vector is a {n, singular}
+// if singular = 1, then the used matrix for the tests is not positive definite
+
+// each band_range vector is a {kd, ld, uplo}
+// where the leading dimension is lda = kd + 1 + ld
+// (ld < 0 gives an invalid leading dimension);
+// if uplo = 0 then upper
+// if uplo = 1 then lower
+
+// case when n = 0 and uplo = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0, 0},
+    // invalid
+    {-1, 0},
+    // normal (valid) samples
+    {10, 0},
+    {20, 1},
+    {50, 0},
+    {150, 1}};
+
+const vector<vector<int>> band_range = {
+    // invalid
+    {-1, 0, 0},
+    {3, -1, 1},
+    // normal (valid) samples
+    {0, 0, 0},
+    {1, 0, 1},
+    {5, 2, 0},
+    {16, 0, 1}};
+
+// for checkin_lapack tests with bands too wide for the window of the factorization to fit
+// in the LDS; the band storage is then factorized directly in global memory
+const vector<vector<int>> global_matrix_size_range = {{200, 0}, {300, 1}};
+
+const vector<vector<int>> global_band_range = {{130, 0, 0}, {140, 1, 1}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range = {{300, 0}, {640, 1}, {1000, 0}};
+
+const vector<vector<int>> large_band_range = {{20, 0, 0}, {64, 3, 1}, {130, 0, 0}};
+
+Arguments pbtrf_setup_arguments(pbtrf_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    vector<int> band = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", matrix_size[0]);
+    arg.set<rocblas_int>("kd", band[0]);
+    arg.set<rocblas_int>("lda", band[0] + 1 + band[1]);
+
+    if(band[2] == 0)
+        arg.set<char>("uplo", 'U');
+    else
+        arg.set<char>("uplo", 'L');
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+    arg.singular = matrix_size[1];
+
+    return arg;
+}
+
+class PBTRF : public ::TestWithParam<pbtrf_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = pbtrf_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("n") == 0 && arg.peek<char>("uplo") == 'U')
+            testing_pbtrf_bad_arg<BATCHED, STRIDED, T>();
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        if(arg.singular == 1)
+            testing_pbtrf<BATCHED, STRIDED, T>(arg);
+
+        arg.singular = 0;
+        testing_pbtrf<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(PBTRF, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(PBTRF, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(PBTRF, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(PBTRF, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// batched tests
+
+TEST_P(PBTRF, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(PBTRF, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(PBTRF, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(PBTRF, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(PBTRF, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(PBTRF, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(PBTRF, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(PBTRF, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+// daily_lapack tests normal execution with medium to large sizes
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         PBTRF,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_band_range)));
+
+// checkin_lapack tests normal execution with small sizes, invalid sizes,
+// quick returns, and corner cases
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         PBTRF,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(band_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack_global,
+                         PBTRF,
+                         Combine(ValuesIn(global_matrix_size_range), ValuesIn(global_band_range)));
@@ -0,0 +1,124 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+#include "common/lapack/testing_persistent_queue.hpp"
+
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<string, int> persistent_queue_tuple;
+
+// each function_range is a {function, n}, where function is the batched function whose main
+// kernel is persistent, and n is the order of the matrices (SYEVJ/HEEVJ must use the blocked
+// algorithm, n > SYEVJ_BLOCKED_SWITCH)
+
+// for checkin_lapack tests
+const vector<persistent_queue_tuple> function_range = {
+    {"syevj_heevj", 80},
+    {"syevj_heevj_capture_safe", 80},
+    {"gesvd", 40},
+};
+
+Arguments persistent_queue_setup_arguments(persistent_queue_tuple tup)
+{
+    Arguments arg;
+
+    arg.set<string>("function", std::get<0>(tup));
+    arg.set<rocblas_int>("n", std::get<1>(tup));
+
+    arg.timing = 0;
+
+    // more instances than the concurrent work items of the persistent kernels on small
+    // devices, so that the thread-groups loop over the queue
+    arg.batch_count = 300;
+
+    return arg;
+}
+
+class PERSISTENT_QUEUE : public ::TestWithParam<persistent_queue_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = persistent_queue_setup_arguments(GetParam());
+        testing_persistent_queue<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+// batched tests
+
+TEST_P(PERSISTENT_QUEUE, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(PERSISTENT_QUEUE, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(PERSISTENT_QUEUE, batched__float_complex)
+{
+    run_tests<true, false, rocblas_float_complex>();
+}
+
+TEST_P(PERSISTENT_QUEUE, batched__double_complex)
+{
+    run_tests<true, false, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(PERSISTENT_QUEUE, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(PERSISTENT_QUEUE, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(PERSISTENT_QUEUE, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(PERSISTENT_QUEUE, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack, PERSISTENT_QUEUE, ValuesIn(function_range));
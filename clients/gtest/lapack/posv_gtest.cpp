@@ -69,6 +69,19 @@ const vector<vector<int>> matrix_sizeB_range = {
     {30, 1},
 };
 
+// for checkin_lapack tests on both sides of POTF2_MAX_SMALL_SIZE for each precision (90 for
+// double complex, 127 for double and float complex, and 180 for float); the matrices that
+// are not larger are factorized and solved by a single kernel
+const vector<vector<int>> small_matrix_sizeA_range = {
+    {90, 90, 90, 1},
+    {91, 100, 91, 0},
+    {127, 127, 130, 0},
+    {128, 128, 128, 1},
+    {180, 190, 180, 0},
+    {181, 181, 181, 1},
+};
+const vector<vector<int>> small_matrix_sizeB_range = {{1, 1}, {40, 0}};
+
 // for daily_lapack tests
 const vector<vector<int>> large_matrix_sizeA_range = {{70, 70, 100, 0},
                                                       {192, 192, 192, 1},
@@ -206,3 +219,8 @@ INSTANTIATE_TEST_SUITE_P(daily_lapack,
 INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          POSV,
                          Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack_small,
+                         POSV,
+                         Combine(ValuesIn(small_matrix_sizeA_range),
+                                 ValuesIn(small_matrix_sizeB_range)));
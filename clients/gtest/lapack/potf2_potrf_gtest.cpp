@@ -58,11 +58,55 @@ const vector<vector<int>> matrix_size_range = {
     {50, 50, 1},
     {70, 80, 0}};
 
+// for checkin_lapack tests of the small-size kernel, on both sides of POTF2_MAX_SMALL_SIZE for
+// each precision; the largest sizes use blocks of several wavefronts, which must all read each
+// diagonal entry before it is overwritten with its square root
+const vector<vector<int>> small_matrix_size_range = {
+    {90, 90, 1},
+    {91, 100, 0},
+    {127, 127, 0},
+    {128, 130, 1},
+    {180, 180, 0},
+    {181, 190, 1},
+};
+
 // for daily_lapack tests
 const vector<vector<int>> large_matrix_size_range = {
     {192, 192, 0}, {640, 960, 1}, {1000, 1000, 0}, {1024, 1024, 1}, {2000, 2000, 0},
 };
 
+// for checkin_lapack tests of the recursive algorithm (the matrix is split only when
+// n is larger than POTRF_BLOCKSIZE)
+const vector<vector<int>> recursive_matrix_size_range = {
+    {200, 200, 0},
+    {300, 320, 1},
+    {400, 400, 0},
+};
+
+// for checkin_lapack tests of the persistent kernel (used for single matrices larger than
+// POTRF_POTF2_SWITCHSIZE; the non positive definite cases check the returned info)
+const vector<vector<int>> persistent_matrix_size_range = {
+    {200, 200, 0},
+    {300, 320, 1},
+    {520, 520, 1},
+    {700, 700, 0},
+};
+
+// for tests of the fused panel-apply kernels of the batched algorithm (used when n is
+// between PANEL_APPLY_MIN_SIZE and PANEL_APPLY_MAX_SIZE, 128 and 512, and
+// batch_count >= PANEL_APPLY_MIN_BATCH, 64); the sizes and batch counts are on both
+// sides of the thresholds
+const vector<vector<int>> panel_apply_matrix_size_range = {
+    {127, 127, 0},
+    {128, 130, 1},
+    {200, 200, 1},
+};
+
+const vector<vector<int>> large_panel_apply_matrix_size_range = {
+    {512, 512, 1},
+    {513, 520, 0},
+};
+
 Arguments potrf_setup_arguments(potrf_tuple tup)
 {
     vector<int> matrix_size = std::get<0>(tup);
@@ -83,7 +127,7 @@ Arguments potrf_setup_arguments(potrf_tuple tup)
     return arg;
 }
 
-template <bool BLOCKED>
+template <bool BLOCKED, typename I, rocblas_int MODE = 0, rocblas_int BC = 3>
 class POTF2_POTRF : public ::TestWithParam<potrf_tuple>
 {
 protected:
@@ -96,24 +140,45 @@ protected:
     void run_tests()
     {
         Arguments arg = potrf_setup_arguments(GetParam());
+        arg.alg_mode = MODE;
 
         if(arg.peek<char>("uplo") == 'L' && arg.peek<rocblas_int>("n") == 0)
-            testing_potf2_potrf_bad_arg<BATCHED, STRIDED, BLOCKED, T>();
+            testing_potf2_potrf_bad_arg<BATCHED, STRIDED, BLOCKED, T, I>();
 
-        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        arg.batch_count = (BATCHED || STRIDED ? BC : 1);
         if(arg.singular == 1)
-            testing_potf2_potrf<BATCHED, STRIDED, BLOCKED, T>(arg);
+            testing_potf2_potrf<BATCHED, STRIDED, BLOCKED, T, I>(arg);
 
         arg.singular = 0;
-        testing_potf2_potrf<BATCHED, STRIDED, BLOCKED, T>(arg);
+        testing_potf2_potrf<BATCHED, STRIDED, BLOCKED, T, I>(arg);
     }
 };
 
-class POTF2 : public POTF2_POTRF<false>
+class POTF2 : public POTF2_POTRF<false, rocblas_int>
 {
 };
 
-class POTRF : public POTF2_POTRF<true>
+class POTRF : public POTF2_POTRF<true, rocblas_int>
+{
+};
+
+class POTRF_64 : public POTF2_POTRF<true, int64_t>
+{
+};
+
+class POTRF_RECURSIVE : public POTF2_POTRF<true, rocblas_int, 1>
+{
+};
+
+class POTRF_PERSISTENT : public POTF2_POTRF<true, rocblas_int, 2>
+{
+};
+
+class POTRF_PANEL_APPLY : public POTF2_POTRF<true, rocblas_int, 0, 64>
+{
+};
+
+class POTRF_NO_PANEL_APPLY : public POTF2_POTRF<true, rocblas_int, 0, 63>
 {
 };
 
@@ -159,6 +224,26 @@ TEST_P(POTRF, __double_complex)
     run_tests<false, false, rocblas_double_complex>();
 }
 
+TEST_P(POTRF_64, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(POTRF_64, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(POTRF_64, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(POTRF_64, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
 // batched tests
 
 TEST_P(POTF2, batched__float)
@@ -201,6 +286,26 @@ TEST_P(POTRF, batched__double_complex)
     run_tests<true, true, rocblas_double_complex>();
 }
 
+TEST_P(POTRF_64, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(POTRF_64, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(POTRF_64, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(POTRF_64, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
 // strided_batched cases
 
 TEST_P(POTF2, strided_batched__float)
@@ -243,6 +348,26 @@ TEST_P(POTRF, strided_batched__double_complex)
     run_tests<false, true, rocblas_double_complex>();
 }
 
+TEST_P(POTRF_64, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(POTRF_64, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(POTRF_64, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(POTRF_64, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
 INSTANTIATE_TEST_SUITE_P(daily_lapack,
                          POTF2,
                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(uplo_range)));
@@ -251,6 +376,10 @@ INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          POTF2,
                          Combine(ValuesIn(matrix_size_range), ValuesIn(uplo_range)));
 
+INSTANTIATE_TEST_SUITE_P(checkin_lapack_small,
+                         POTF2,
+                         Combine(ValuesIn(small_matrix_size_range), ValuesIn(uplo_range)));
+
 INSTANTIATE_TEST_SUITE_P(daily_lapack,
                          POTRF,
                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(uplo_range)));
@@ -258,3 +387,195 @@ INSTANTIATE_TEST_SUITE_P(daily_lapack,
 INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          POTRF,
                          Combine(ValuesIn(matrix_size_range), ValuesIn(uplo_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         POTRF_64,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(uplo_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         POTRF_64,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(uplo_range)));
+
+// recursive algorithm tests
+TEST_P(POTRF_RECURSIVE, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(POTRF_RECURSIVE, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(POTRF_RECURSIVE, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(POTRF_RECURSIVE, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+TEST_P(POTRF_RECURSIVE, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(POTRF_RECURSIVE, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(POTRF_RECURSIVE, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(POTRF_RECURSIVE, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
+TEST_P(POTRF_RECURSIVE, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(POTRF_RECURSIVE, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(POTRF_RECURSIVE, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(POTRF_RECURSIVE, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         POTRF_RECURSIVE,
+                         Combine(ValuesIn(recursive_matrix_size_range), ValuesIn(uplo_range)));
+
+// persistent kernel tests (only for single matrices)
+TEST_P(POTRF_PERSISTENT, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(POTRF_PERSISTENT, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(POTRF_PERSISTENT, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(POTRF_PERSISTENT, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         POTRF_PERSISTENT,
+                         Combine(ValuesIn(persistent_matrix_size_range), ValuesIn(uplo_range)));
+
+// panel-apply tests
+TEST_P(POTRF_PANEL_APPLY, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(POTRF_PANEL_APPLY, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(POTRF_PANEL_APPLY, batched__float_complex)
+{
+    run_tests<true, false, rocblas_float_complex>();
+}
+
+TEST_P(POTRF_PANEL_APPLY, batched__double_complex)
+{
+    run_tests<true, false, rocblas_double_complex>();
+}
+
+TEST_P(POTRF_PANEL_APPLY, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(POTRF_PANEL_APPLY, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(POTRF_PANEL_APPLY, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(POTRF_PANEL_APPLY, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+TEST_P(POTRF_NO_PANEL_APPLY, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(POTRF_NO_PANEL_APPLY, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(POTRF_NO_PANEL_APPLY, batched__float_complex)
+{
+    run_tests<true, false, rocblas_float_complex>();
+}
+
+TEST_P(POTRF_NO_PANEL_APPLY, batched__double_complex)
+{
+    run_tests<true, false, rocblas_double_complex>();
+}
+
+TEST_P(POTRF_NO_PANEL_APPLY, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(POTRF_NO_PANEL_APPLY, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(POTRF_NO_PANEL_APPLY, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(POTRF_NO_PANEL_APPLY, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         POTRF_PANEL_APPLY,
+                         Combine(ValuesIn(large_panel_apply_matrix_size_range),
+                                 ValuesIn(uplo_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         POTRF_PANEL_APPLY,
+                         Combine(ValuesIn(panel_apply_matrix_size_range), ValuesIn(uplo_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         POTRF_NO_PANEL_APPLY,
+                         Combine(ValuesIn(panel_apply_matrix_size_range), ValuesIn(uplo_range)));
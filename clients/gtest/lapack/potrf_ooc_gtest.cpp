@@ -0,0 +1,140 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "common/lapack/testing_potrf_ooc.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, printable_char> potrf_ooc_tuple;
+
+// each size_range vector is a {N, lda, singular}
+// if singular = 1, then the used matrix for the tests is not positive definite
+
+// each uplo_range is a {uplo}
+
+// the matrix is processed by panels of OOC_BLOCKSIZE (512) columns, so that the larger sizes
+// span several panels, the last one incomplete
+
+// case when n = 0 and uplo = L will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+const vector<printable_char> uplo_range = {'L', 'U'};
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // quick return
+    {0, 1, 0},
+    // invalid
+    {-1, 1, 0},
+    {10, 2, 0},
+    // normal (valid) samples
+    {20, 30, 1},
+    {600, 600, 0},
+    {1100, 1103, 1},
+    // (the first non positive minor is in the second panel)
+    {2100, 2100, 1}};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_size_range = {
+    {3000, 3072, 0}, {4000, 4000, 1},
+};
+
+Arguments potrf_ooc_setup_arguments(potrf_ooc_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    char uplo = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", matrix_size[0]);
+    arg.set<rocblas_int>("lda", matrix_size[1]);
+
+    arg.set<char>("uplo", uplo);
+
+    arg.timing = 0;
+    arg.singular = matrix_size[2];
+
+    return arg;
+}
+
+class POTRF_OOC : public ::TestWithParam<potrf_ooc_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = potrf_ooc_setup_arguments(GetParam());
+
+        if(arg.peek<char>("uplo") == 'L' && arg.peek<rocblas_int>("n") == 0)
+            testing_potrf_ooc_bad_arg<T>();
+
+        if(arg.singular == 1)
+            testing_potrf_ooc<T>(arg);
+
+        arg.singular = 0;
+        testing_potrf_ooc<T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(POTRF_OOC, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(POTRF_OOC, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(POTRF_OOC, __float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(POTRF_OOC, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         POTRF_OOC,
+                         Combine(ValuesIn(large_matrix_size_range), ValuesIn(uplo_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         POTRF_OOC,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(uplo_range)));
@@ -99,7 +99,8 @@ Arguments potrs_setup_arguments(potrs_tuple tup)
     return arg;
 }
 
-class POTRS : public ::TestWithParam<potrs_tuple>
+template <typename I>
+class POTRS_BASE : public ::TestWithParam<potrs_tuple>
 {
 protected:
     void TearDown() override
@@ -113,13 +114,21 @@ protected:
         Arguments arg = potrs_setup_arguments(GetParam());
 
         if(arg.peek<rocblas_int>("n") == 0 && arg.peek<rocblas_int>("nrhs") == 0)
-            testing_potrs_bad_arg<BATCHED, STRIDED, T>();
+            testing_potrs_bad_arg<BATCHED, STRIDED, T, I>();
 
         arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
-        testing_potrs<BATCHED, STRIDED, T>(arg);
+        testing_potrs<BATCHED, STRIDED, T, I>(arg);
     }
 };
 
+class POTRS : public POTRS_BASE<rocblas_int>
+{
+};
+
+class POTRS_64 : public POTRS_BASE<int64_t>
+{
+};
+
 // non-batch tests
 
 TEST_P(POTRS, __float)
@@ -142,6 +151,26 @@ TEST_P(POTRS, __double_complex)
     run_tests<false, false, rocblas_double_complex>();
 }
 
+TEST_P(POTRS_64, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(POTRS_64, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(POTRS_64, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(POTRS_64, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
 // batched tests
 
 TEST_P(POTRS, batched__float)
@@ -164,6 +193,26 @@ TEST_P(POTRS, batched__double_complex)
     run_tests<true, true, rocblas_double_complex>();
 }
 
+TEST_P(POTRS_64, batched__float)
+{
+    run_tests<true, true, float>();
+}
+
+TEST_P(POTRS_64, batched__double)
+{
+    run_tests<true, true, double>();
+}
+
+TEST_P(POTRS_64, batched__float_complex)
+{
+    run_tests<true, true, rocblas_float_complex>();
+}
+
+TEST_P(POTRS_64, batched__double_complex)
+{
+    run_tests<true, true, rocblas_double_complex>();
+}
+
 // strided_batched tests
 
 TEST_P(POTRS, strided_batched__float)
@@ -186,6 +235,26 @@ TEST_P(POTRS, strided_batched__double_complex)
     run_tests<false, true, rocblas_double_complex>();
 }
 
+TEST_P(POTRS_64, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(POTRS_64, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(POTRS_64, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(POTRS_64, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
 // daily_lapack tests normal execution with medium to large sizes
 INSTANTIATE_TEST_SUITE_P(daily_lapack,
                          POTRS,
@@ -197,3 +266,12 @@ INSTANTIATE_TEST_SUITE_P(daily_lapack,
 INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          POTRS,
                          Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         POTRS_64,
+                         Combine(ValuesIn(large_matrix_sizeA_range),
+                                 ValuesIn(large_matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         POTRS_64,
+                         Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
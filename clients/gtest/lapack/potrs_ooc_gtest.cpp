@@ -0,0 +1,150 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "common/lapack/testing_potrs_ooc.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<int>> potrs_ooc_tuple;
+
+// each A_range vector is a {N, lda, ldb};
+
+// each B_range vector is a {nrhs, uplo};
+// if uplo = 0 then upper
+// if uplo = 1 then lower
+
+// the matrix is processed by panels of OOC_BLOCKSIZE (512) columns, so that the larger sizes
+// span several panels, the last one incomplete
+
+// case when N = nrhs = 0 will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_sizeA_range = {
+    // quick return
+    {0, 1, 1},
+    // invalid
+    {-1, 1, 1},
+    {10, 2, 10},
+    {10, 10, 2},
+    /// normal (valid) samples
+    {20, 20, 20},
+    {600, 650, 600},
+    {1100, 1103, 1101}};
+const vector<vector<int>> matrix_sizeB_range = {
+    // quick return
+    {0, 0},
+    // invalid
+    {-1, 0},
+    // normal (valid) samples
+    {3, 0},
+    {20, 1},
+    {30, 1},
+};
+
+// for daily_lapack tests
+const vector<vector<int>> large_matrix_sizeA_range = {{2000, 2000, 2000}, {3000, 3072, 3000}};
+const vector<vector<int>> large_matrix_sizeB_range = {
+    {100, 0}, {200, 1}, {500, 0},
+};
+
+Arguments potrs_ooc_setup_arguments(potrs_ooc_tuple tup)
+{
+    vector<int> matrix_sizeA = std::get<0>(tup);
+    vector<int> matrix_sizeB = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", matrix_sizeA[0]);
+    arg.set<rocblas_int>("nrhs", matrix_sizeB[0]);
+    arg.set<rocblas_int>("lda", matrix_sizeA[1]);
+    arg.set<rocblas_int>("ldb", matrix_sizeA[2]);
+
+    if(matrix_sizeB[1] == 0)
+        arg.set<char>("uplo", 'U');
+    else
+        arg.set<char>("uplo", 'L');
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+class POTRS_OOC : public ::TestWithParam<potrs_ooc_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = potrs_ooc_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("n") == 0 && arg.peek<rocblas_int>("nrhs") == 0)
+            testing_potrs_ooc_bad_arg<T>();
+
+        testing_potrs_ooc<T>(arg);
+    }
+};
+
+// non-batch tests
+
+TEST_P(POTRS_OOC, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(POTRS_OOC, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(POTRS_OOC, __float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(POTRS_OOC, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(daily_lapack,
+                         POTRS_OOC,
+                         Combine(ValuesIn(large_matrix_sizeA_range),
+                                 ValuesIn(large_matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         POTRS_OOC,
+                         Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
@@ -0,0 +1,100 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+#include "common/lapack/testing_ptr_array_cache.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<string, int> ptr_array_cache_tuple;
+
+// each test_range is the behavior of the cache that is tested with geqrf_batched
+// each size_range is the order n of the matrices (large enough for several blocked steps of
+// geqrf)
+
+// for checkin_lapack tests
+const vector<string> test_range = {"launches_skipped", "pointers_change"};
+
+const vector<int> size_range = {320};
+
+Arguments ptr_array_cache_setup_arguments(ptr_array_cache_tuple tup)
+{
+    Arguments arg;
+
+    arg.set<string>("test", std::get<0>(tup));
+    arg.set<rocblas_int>("m", std::get<1>(tup));
+
+    arg.timing = 0;
+    arg.batch_count = 4;
+
+    return arg;
+}
+
+class PTR_ARRAY_CACHE : public ::TestWithParam<ptr_array_cache_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = ptr_array_cache_setup_arguments(GetParam());
+        testing_ptr_array_cache<T>(arg);
+    }
+};
+
+// batched tests
+
+TEST_P(PTR_ARRAY_CACHE, batched__float)
+{
+    run_tests<float>();
+}
+
+TEST_P(PTR_ARRAY_CACHE, batched__double)
+{
+    run_tests<double>();
+}
+
+TEST_P(PTR_ARRAY_CACHE, batched__float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(PTR_ARRAY_CACHE, batched__double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         PTR_ARRAY_CACHE,
+                         Combine(ValuesIn(test_range), ValuesIn(size_range)));
@@ -0,0 +1,130 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+#include "common/lapack/testing_workspace_budget.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<string, int> workspace_budget_tuple;
+
+// each function_range is a batched function that splits the batch in chunks when the
+// workspace for the whole batch exceeds the device memory of the handle
+// each size_range is the order n of the matrices (the workspace for half of the batch must be
+// smaller than for the whole batch)
+
+// case when function = "getrf" also executes the bad arguments test
+// (configuration of the workspace budget)
+
+const vector<string> function_range = {"getrf", "geqrf", "syevd_heevd"};
+
+// for checkin_lapack tests
+const vector<int> size_range = {300};
+
+Arguments workspace_budget_setup_arguments(workspace_budget_tuple tup)
+{
+    Arguments arg;
+
+    arg.set<string>("function", std::get<0>(tup));
+    arg.set<rocblas_int>("n", std::get<1>(tup));
+
+    arg.timing = 0;
+    arg.batch_count = 8;
+
+    return arg;
+}
+
+class WORKSPACE_BUDGET : public ::TestWithParam<workspace_budget_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = workspace_budget_setup_arguments(GetParam());
+
+        if(arg.peek<string>("function") == function_range[0])
+            testing_workspace_budget_bad_arg();
+
+        testing_workspace_budget<BATCHED, STRIDED, T>(arg);
+    }
+};
+
+// batched tests
+
+TEST_P(WORKSPACE_BUDGET, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(WORKSPACE_BUDGET, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(WORKSPACE_BUDGET, batched__float_complex)
+{
+    run_tests<true, false, rocblas_float_complex>();
+}
+
+TEST_P(WORKSPACE_BUDGET, batched__double_complex)
+{
+    run_tests<true, false, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(WORKSPACE_BUDGET, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(WORKSPACE_BUDGET, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(WORKSPACE_BUDGET, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(WORKSPACE_BUDGET, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         WORKSPACE_BUDGET,
+                         Combine(ValuesIn(function_range), ValuesIn(size_range)));
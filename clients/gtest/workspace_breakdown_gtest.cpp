@@ -0,0 +1,237 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "common/misc/rocsolver.hpp"
+
+class checkin_misc_WORKSPACE_BREAKDOWN : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ASSERT_EQ(rocblas_create_handle(&handle), rocblas_status_success);
+        ASSERT_EQ(hipMalloc(&dA, sizeof(rocblas_double_complex) * stA * bc), hipSuccess);
+        ASSERT_EQ(hipMalloc(&dB, sizeof(rocblas_double_complex) * stA * bc), hipSuccess);
+        ASSERT_EQ(hipMalloc(&dC, sizeof(rocblas_double_complex) * stA * bc), hipSuccess);
+        ASSERT_EQ(hipMalloc(&dD, sizeof(double) * stD * bc), hipSuccess);
+        ASSERT_EQ(hipMalloc(&dE, sizeof(double) * stD * bc), hipSuccess);
+        ASSERT_EQ(hipMalloc(&dinfo, sizeof(rocblas_int) * bc), hipSuccess);
+    }
+
+    void TearDown() override
+    {
+        EXPECT_EQ(rocsolver_release_handle_resources(handle), rocblas_status_success);
+        EXPECT_EQ(rocblas_destroy_handle(handle), rocblas_status_success);
+        EXPECT_EQ(hipFree(dA), hipSuccess);
+        EXPECT_EQ(hipFree(dB), hipSuccess);
+        EXPECT_EQ(hipFree(dC), hipSuccess);
+        EXPECT_EQ(hipFree(dD), hipSuccess);
+        EXPECT_EQ(hipFree(dE), hipSuccess);
+        EXPECT_EQ(hipFree(dinfo), hipSuccess);
+    }
+
+    // executes the given function in device memory size query mode, and returns the
+    // workspace size and the recorded breakdown
+    template <typename F>
+    std::vector<rocsolver_workspace_node> query(F&& run, size_t* size)
+    {
+        rocblas_int count;
+        rocblas_start_device_memory_size_query(handle);
+        EXPECT_EQ(run(), rocblas_status_size_increased);
+        rocblas_stop_device_memory_size_query(handle, size);
+
+        EXPECT_EQ(rocsolver_get_workspace_breakdown(handle, nullptr, &count),
+                  rocblas_status_success);
+        std::vector<rocsolver_workspace_node> nodes(count);
+        EXPECT_EQ(rocsolver_get_workspace_breakdown(handle, nodes.data(), &count),
+                  rocblas_status_success);
+        EXPECT_EQ(count, nodes.size());
+        return nodes;
+    }
+
+    // checks that the nodes form a tree in pre-order whose root is the called function,
+    // and that the given internal calls are direct children of the root
+    void check_tree(const std::vector<rocsolver_workspace_node>& nodes,
+                    const std::string& name,
+                    size_t size,
+                    const std::vector<std::string>& subcalls)
+    {
+        ASSERT_GT(nodes.size(), 1);
+        EXPECT_EQ(std::string(nodes[0].name), name);
+        EXPECT_EQ(nodes[0].depth, 0);
+        EXPECT_EQ(nodes[0].size, size);
+
+        std::vector<bool> found(subcalls.size(), false);
+        for(size_t i = 1; i < nodes.size(); ++i)
+        {
+            EXPECT_GT(nodes[i].depth, 0);
+            EXPECT_LE(nodes[i].depth, nodes[i - 1].depth + 1);
+            for(size_t j = 0; j < subcalls.size(); ++j)
+                found[j] = found[j] || (nodes[i].depth == 1 && subcalls[j] == nodes[i].name);
+        }
+        for(size_t j = 0; j < subcalls.size(); ++j)
+            EXPECT_TRUE(found[j]) << "missing sub-call " << subcalls[j] << " in " << name;
+    }
+
+    template <typename T>
+    void syevd_heevd(const std::string& name)
+    {
+        using S = decltype(std::real(T{}));
+        auto run = [&] {
+            return rocsolver_syevd_heevd(true, handle, rocblas_evect_original, rocblas_fill_lower,
+                                         n, (T*)dA, lda, stA, (S*)dD, stD, (S*)dE, stD, dinfo, bc);
+        };
+        size_t size, size2;
+
+        std::vector<rocsolver_workspace_node> nodes = query(run, &size);
+        check_tree(nodes, "rocsolver_" + name + "_strided_batched", size, {"sytrd_hetrd", "stedc"});
+
+        // a repeated query replaces the previous breakdown
+        std::vector<rocsolver_workspace_node> nodes2 = query(run, &size2);
+        EXPECT_EQ(size2, size);
+        EXPECT_EQ(nodes2.size(), nodes.size());
+    }
+
+    template <typename T>
+    void gels(const std::string& name)
+    {
+        auto run = [&] {
+            return rocsolver_gels(true, handle, rocblas_operation_none, n, n, nrhs, (T*)dA, lda,
+                                  stA, (T*)dB, lda, stA, dinfo, bc);
+        };
+        size_t size;
+
+        std::vector<rocsolver_workspace_node> nodes = query(run, &size);
+        check_tree(nodes, "rocsolver_" + name + "_strided_batched", size,
+                   {"geqrf", "ormqr_unmqr", "trsm"});
+    }
+
+    template <typename T>
+    void gesvd(const std::string& name)
+    {
+        using S = decltype(std::real(T{}));
+        auto run = [&] {
+            return rocsolver_gesvd(true, handle, rocblas_svect_all, rocblas_svect_all, n, n,
+                                   (T*)dA, lda, stA, (S*)dD, stD, (T*)dB, lda, stA, (T*)dC, lda,
+                                   stA, (S*)dE, stD, rocblas_outofplace, dinfo, bc);
+        };
+        size_t size;
+
+        std::vector<rocsolver_workspace_node> nodes = query(run, &size);
+        check_tree(nodes, "rocsolver_" + name + "_strided_batched", size,
+                   {"gebrd", "bdsqr", "orgbr_ungbr"});
+    }
+
+    rocblas_handle handle;
+    void *dA, *dB, *dC, *dD, *dE;
+    rocblas_int* dinfo;
+
+    const rocblas_int n = 100;
+    const rocblas_int lda = n;
+    const rocblas_int nrhs = 10;
+    const rocblas_stride stA = lda * n;
+    const rocblas_stride stD = n;
+    const rocblas_int bc = 4;
+};
+
+TEST_F(checkin_misc_WORKSPACE_BREAKDOWN, arguments)
+{
+    rocblas_int count = 1;
+    rocsolver_workspace_node node;
+
+    EXPECT_EQ(rocsolver_get_workspace_breakdown(nullptr, nullptr, &count),
+              rocblas_status_invalid_handle);
+    EXPECT_EQ(rocsolver_get_workspace_breakdown(handle, nullptr, nullptr),
+              rocblas_status_invalid_pointer);
+    count = -1;
+    EXPECT_EQ(rocsolver_get_workspace_breakdown(handle, &node, &count),
+              rocblas_status_invalid_size);
+    EXPECT_EQ(rocsolver_clear_workspace_breakdown(nullptr), rocblas_status_invalid_handle);
+}
+
+TEST_F(checkin_misc_WORKSPACE_BREAKDOWN, syevd_heevd)
+{
+    syevd_heevd<float>("ssyevd");
+    syevd_heevd<double>("dsyevd");
+    syevd_heevd<rocblas_float_complex>("cheevd");
+    syevd_heevd<rocblas_double_complex>("zheevd");
+}
+
+TEST_F(checkin_misc_WORKSPACE_BREAKDOWN, gels)
+{
+    gels<float>("sgels");
+    gels<double>("dgels");
+    gels<rocblas_float_complex>("cgels");
+    gels<rocblas_double_complex>("zgels");
+}
+
+TEST_F(checkin_misc_WORKSPACE_BREAKDOWN, gesvd)
+{
+    gesvd<float>("sgesvd");
+    gesvd<double>("dgesvd");
+    gesvd<rocblas_float_complex>("cgesvd");
+    gesvd<rocblas_double_complex>("zgesvd");
+}
+
+TEST_F(checkin_misc_WORKSPACE_BREAKDOWN, replaced_and_cleared)
+{
+    rocblas_int count;
+    rocsolver_workspace_node node;
+    size_t size;
+
+    // nothing is recorded outside of a size query
+    ASSERT_EQ(rocsolver_dsyevd_strided_batched(handle, rocblas_evect_none, rocblas_fill_lower, n,
+                                               (double*)dA, lda, stA, (double*)dD, stD,
+                                               (double*)dE, stD, dinfo, bc),
+              rocblas_status_success);
+    EXPECT_EQ(rocsolver_get_workspace_breakdown(handle, nullptr, &count), rocblas_status_success);
+    EXPECT_EQ(count, 0);
+
+    // the breakdown describes the last function queried
+    syevd_heevd<double>("dsyevd");
+    std::vector<rocsolver_workspace_node> nodes = query(
+        [&] {
+            return rocsolver_gels(true, handle, rocblas_operation_none, n, n, nrhs, (double*)dA,
+                                  lda, stA, (double*)dB, lda, stA, dinfo, bc);
+        },
+        &size);
+    check_tree(nodes, "rocsolver_dgels_strided_batched", size, {"geqrf"});
+
+    // a smaller output array only receives the first nodes
+    count = 1;
+    EXPECT_EQ(rocsolver_get_workspace_breakdown(handle, &node, &count), rocblas_status_success);
+    EXPECT_EQ(count, 1);
+    EXPECT_EQ(node.size, size);
+
+    EXPECT_EQ(rocsolver_clear_workspace_breakdown(handle), rocblas_status_success);
+    EXPECT_EQ(rocsolver_get_workspace_breakdown(handle, nullptr, &count), rocblas_status_success);
+    EXPECT_EQ(count, 0);
+}
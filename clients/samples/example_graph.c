@@ -80,6 +80,9 @@ int main() {
   hipStreamCreate(&stream);
   rocblas_set_stream(handle, stream);
 
+  // make sure that rocsolver does not synchronize with the host during the capture
+  rocsolver_set_capture_safe(handle, true);
+
   // create graph management objects
   hipGraph_t graph;
   rocblas_int graph_ready = 0;
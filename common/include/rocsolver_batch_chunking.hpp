@@ -0,0 +1,117 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+
+/*
+ * ===========================================================================
+ *    host-only planning of batched executions under a workspace budget.
+ *    These helpers do not touch the device, so that they can be used by
+ *    the library and unit-tested by the clients.
+ * ===========================================================================
+ */
+
+// granularity of the chunks carved out of the device memory of a rocBLAS handle
+#define ROCSOLVER_WORKSPACE_ALIGNMENT 64
+
+/*! \brief Returns the amount of device memory needed to allocate the given
+    workspace arrays at once with rocblas_device_malloc.
+    \details Each array is rounded up to the allocation granularity; empty
+    arrays are counted as one chunk so that the estimate never falls below the
+    size actually requested from the handle. */
+inline size_t rocsolver_workspace_size(std::initializer_list<size_t> sizes)
+{
+    constexpr size_t align = ROCSOLVER_WORKSPACE_ALIGNMENT;
+
+    size_t total = 0;
+    for(size_t s : sizes)
+        total += (std::max(s, align) + align - 1) / align * align;
+    return total;
+}
+
+/*! \brief Returns the number of problems to process at once so that a batch of
+    batch_count problems can be executed within the given workspace budget.
+    \details size_of(bc) must return the workspace required to process bc
+    problems at once, and must be non-decreasing in bc. If the whole batch fits,
+    batch_count is returned. Otherwise, the batch is split into the smallest
+    number of chunks whose size fits, and the returned chunk size balances the
+    work among them. Returns 0 if not even one problem fits in the budget. */
+template <typename I, typename F>
+I rocsolver_plan_batch_chunk(const size_t budget, const I batch_count, F size_of)
+{
+    if(batch_count <= 0 || size_of(batch_count) <= budget)
+        return batch_count;
+    if(size_of(I(1)) > budget)
+        return 0;
+
+    // binary search for the largest chunk that fits (lo always fits, hi never does)
+    I lo = 1;
+    I hi = batch_count;
+    while(hi - lo > 1)
+    {
+        I mid = lo + (hi - lo) / 2;
+        if(size_of(mid) <= budget)
+            lo = mid;
+        else
+            hi = mid;
+    }
+
+    // balance the chunks (a smaller chunk also fits)
+    I nchunks = (batch_count - 1) / lo + 1;
+    return (batch_count - 1) / nchunks + 1;
+}
+
+/*! \brief Returns the number of problems assigned to each stream when a batch of
+    batch_count problems is split across a pool of at most max_streams streams.
+    \details No stream gets fewer than min_chunk problems, and all the streams but
+    the last one get the same number of problems. The number of streams actually
+    used is given by rocsolver_stream_split_count. Returns batch_count if the batch
+    should not be split (max_streams <= 1, or the batch is too small). */
+template <typename I>
+I rocsolver_plan_stream_split(const I batch_count, const int max_streams, const I min_chunk)
+{
+    if(batch_count <= 0 || max_streams <= 1)
+        return batch_count;
+
+    I nstreams = std::min(I(max_streams), batch_count / std::max(min_chunk, I(1)));
+    if(nstreams <= 1)
+        return batch_count;
+
+    return (batch_count - 1) / nstreams + 1;
+}
+
+/*! \brief Returns the number of streams used to execute a batch of batch_count
+    problems in chunks of the given size (at least 1). */
+template <typename I>
+int rocsolver_stream_split_count(const I batch_count, const I chunk)
+{
+    return (batch_count > 0 && chunk > 0) ? int((batch_count - 1) / chunk + 1) : 1;
+}
@@ -28,6 +28,7 @@
 #ifndef ROCSOLVER_EXTRA_TYPES_H
 #define ROCSOLVER_EXTRA_TYPES_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 /*! \brief Used to specify the logging layer mode using a bitwise combination
@@ -164,4 +165,70 @@ typedef enum rocsolver_rfinfo_mode_
     = 272, /**< To work with Cholesky factorization (for symmetric positive definite sparse matrices). */
 } rocsolver_rfinfo_mode;
 
+/*! \brief Used to specify the function whose algorithm is selected with
+ *\ref rocsolver_set_alg_mode.
+ ********************************************************************************/
+typedef enum rocsolver_function_
+{
+    rocsolver_function_getrf = 281, /**< GETRF and its batched and strided_batched versions. */
+    rocsolver_function_geqrf = 282, /**< GEQRF and its batched and strided_batched versions. */
+    rocsolver_function_potrf = 283, /**< POTRF and its batched and strided_batched versions. */
+} rocsolver_function;
+
+/*! \brief Used to select the algorithm executed by a function.
+ ********************************************************************************/
+typedef enum rocsolver_alg_mode_
+{
+    rocsolver_alg_mode_default
+    = 291, /**< The algorithm is selected from the problem size (this is the default mode). */
+    rocsolver_alg_mode_recursive
+    = 292, /**< The block panels (GETRF, GEQRF) or the whole matrix (POTRF) are factorized
+                recursively. */
+    rocsolver_alg_mode_persistent
+    = 293, /**< The matrix is factorized by a single persistent kernel (POTRF only, when
+                batch_count = 1). */
+} rocsolver_alg_mode;
+
+/*! \brief Used to specify the features of a device architecture using a bitwise combination
+ *of rocsolver_arch_flag values.
+ ********************************************************************************/
+typedef uint32_t rocsolver_arch_flags;
+
+/*! \brief Used to specify the features of a device architecture that are relevant to
+ *rocSOLVER.
+ ********************************************************************************/
+typedef enum rocsolver_arch_flag_
+{
+    rocsolver_arch_flag_none = 0x0, /**< No special features. */
+    rocsolver_arch_flag_xnack = 0x1, /**< XNACK is enabled. */
+    rocsolver_arch_flag_sramecc = 0x2, /**< SRAM ECC is enabled. */
+    rocsolver_arch_flag_blas_sync
+    = 0x4, /**< rocSOLVER kernels must be synchronized with interleaved rocBLAS kernels. */
+} rocsolver_arch_flag;
+
+/*! \brief Describes the properties of a device architecture that rocSOLVER uses to
+ *select its kernels and their launch configurations.
+ ********************************************************************************/
+typedef struct rocsolver_arch_info_
+{
+    char name[64]; /**< Name of the architecture (e.g. gfx90a), without target features. */
+    int wavefront_size; /**< Number of threads in a wavefront. */
+    int lds_size; /**< Amount of shared memory (LDS) available to a thread-block, in bytes. */
+    int cu_count; /**< Number of compute units. */
+    rocsolver_arch_flags flags; /**< Bitwise combination of rocsolver_arch_flag values. */
+} rocsolver_arch_info;
+
+/*! \brief Describes a node of the workspace breakdown of a rocSOLVER function.
+ *
+ * \details The nodes of the breakdown form a tree that is stored in pre-order;
+ *the parent of a node is the closest preceding node with a smaller depth.
+ *At depth 0, every node corresponds to a function called during a device memory size query.
+ ********************************************************************************/
+typedef struct rocsolver_workspace_node_
+{
+    char name[64]; /**< Name of the function, internal sub-call or workspace array. */
+    size_t size; /**< Size in bytes. For functions and sub-calls, the total size of their arrays. */
+    int depth; /**< Depth of the node in the tree. */
+} rocsolver_workspace_node;
+
 #endif /* ROCSOLVER_EXTRA_TYPES_H */
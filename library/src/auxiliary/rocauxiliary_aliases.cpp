@@ -26,6 +26,7 @@
  * *************************************************************************/
 
 #include "rocsolver/rocsolver.h"
+#include "rocsolver_handle_state.hpp"
 
 // We need to include extern definitions for these inline functions to ensure
 // that librocsolver.so will contain these symbols for FFI or when inlining
@@ -44,11 +45,15 @@ rocsolver_status rocsolver_create_handle(rocsolver_handle* handle)
     {
         return stat;
     }
+    // forget any state left by a destroyed handle that had the same address
+    rocsolver_handle_state_map::release(*handle);
     return rocblas_set_pointer_mode(*handle, rocblas_pointer_mode_device);
 }
 
 rocsolver_status rocsolver_destroy_handle(rocsolver_handle handle)
 {
+    // the state kept by rocSOLVER must not outlive the handle
+    rocsolver_handle_state_map::release(handle);
     return rocblas_destroy_handle(handle);
 }
 
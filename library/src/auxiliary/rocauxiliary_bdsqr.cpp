@@ -75,7 +75,7 @@ rocblas_status rocsolver_bdsqr_impl(rocblas_handle handle,
     rocsolver_bdsqr_getMemorySize<S>(n, nv, nu, nc, batch_count, &size_splits_map, &size_work);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_splits_map, size_work);
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_splits_map, size_work);
 
     // memory workspace allocation
     void *splits_map, *work;
@@ -35,6 +35,7 @@
 #include "lapack_device_functions.hpp"
 #include "rocblas.hpp"
 #include "rocsolver/rocsolver.h"
+#include "rocsolver_handle_state.hpp"
 
 #include <cmath>
 
@@ -314,7 +315,12 @@ __device__ void bdsqr_b2tQRstep(const rocblas_int tid,
 }
 
 /** BDSQR_KERNEL implements the main loop of the bdsqr algorithm
-    to compute the SVD of an upper bidiagonal matrix given by D and E **/
+    to compute the SVD of an upper bidiagonal matrix given by D and E.
+
+    This is a persistent kernel: call it with any number of groups (see rocsolver_queue_groups).
+    The groups pull the diagonal blocks of the instances in the queue (those without NaNs or
+    Infs in the input) dynamically, so that the instances requiring more QR steps do not
+    leave groups idle. **/
 template <typename T, typename S, typename W1, typename W2, typename W3>
 ROCSOLVER_KERNEL void bdsqr_kernel(const rocblas_int n,
                                    const rocblas_int nv,
@@ -336,7 +342,6 @@ ROCSOLVER_KERNEL void bdsqr_kernel(const rocblas_int n,
                                    const rocblas_int shiftC,
                                    const rocblas_int ldc,
                                    const rocblas_stride strideC,
-                                   rocblas_int* info,
                                    const rocblas_int maxiter,
                                    const S eps,
                                    const S sfm,
@@ -345,30 +350,10 @@ ROCSOLVER_KERNEL void bdsqr_kernel(const rocblas_int n,
                                    rocblas_int* splitsA,
                                    S* workA,
                                    const rocblas_int incW,
-                                   const rocblas_stride strideW)
+                                   const rocblas_stride strideW,
+                                   rocblas_int* queue)
 {
     rocblas_int tid = hipThreadIdx_x;
-    rocblas_int sid = hipBlockIdx_y;
-    rocblas_int bid = hipBlockIdx_z;
-
-    // if a NaN or Inf was detected in the input, return
-    if(info[bid] != 0)
-        return;
-
-    // select batch instance to work with
-    // (avoiding arithmetics with possible nullptrs)
-    T *V, *U, *C;
-    S* D = DD + bid * strideD;
-    S* E = EE + bid * strideE;
-    if(VV)
-        V = load_ptr_batch<T>(VV, bid, shiftV, strideV);
-    if(UU)
-        U = load_ptr_batch<T>(UU, bid, shiftU, strideU);
-    if(CC)
-        C = load_ptr_batch<T>(CC, bid, shiftC, strideC);
-    rocblas_int* splits = splitsA + bid * n;
-    S* work = workA + bid * strideW;
-    S* rots = work + 2;
 
     // shared variables
     __shared__ bool applyqr;
@@ -377,108 +362,134 @@ ROCSOLVER_KERNEL void bdsqr_kernel(const rocblas_int n,
     __shared__ rocblas_int i, k, start;
     __shared__ rocblas_int iter;
 
-    // get convergence threshold
-    if(tid == 0)
-    {
-        smin = work[0];
-        thresh = work[1];
-    }
-
-    // main loop
-    // iterate over each diagonal block
-    while(2 * sid + 1 < n && splits[2 * sid + 1] > 0)
+    // pull work items until all the queued instances have been processed; the work item q
+    // corresponds to the slot q % BDSQR_SPLIT_GROUPS of the instance q / BDSQR_SPLIT_GROUPS
+    // in the queue, and processes every BDSQR_SPLIT_GROUPS-th diagonal block of the instance
+    // starting from that slot
+    rocblas_int items = rocsolver_queue_size(queue) * BDSQR_SPLIT_GROUPS;
+    for(rocblas_int q = rocsolver_queue_pull(queue); q < items; q = rocsolver_queue_pull(queue))
     {
+        rocblas_int bid = rocsolver_queue_entry(queue, q / BDSQR_SPLIT_GROUPS);
+        rocblas_int sid = q % BDSQR_SPLIT_GROUPS;
+
+        // select batch instance to work with
+        // (avoiding arithmetics with possible nullptrs)
+        T *V, *U, *C;
+        S* D = DD + bid * strideD;
+        S* E = EE + bid * strideE;
+        if(VV)
+            V = load_ptr_batch<T>(VV, bid, shiftV, strideV);
+        if(UU)
+            U = load_ptr_batch<T>(UU, bid, shiftU, strideU);
+        if(CC)
+            C = load_ptr_batch<T>(CC, bid, shiftC, strideC);
+        rocblas_int* splits = splitsA + bid * n;
+        S* work = workA + bid * strideW;
+        S* rots = work + 2;
+
+        // get convergence threshold
         if(tid == 0)
         {
-            // read diagonal block endpoints
-            i = start = splits[2 * sid];
-            k = splits[2 * sid + 1];
-
-            // number of iterations (QR steps) applied to current block
-            iter = 0;
+            smin = work[0];
+            thresh = work[1];
         }
-        __syncthreads();
 
-        // iterate while diagonal block has not converged
-        while(k > start && iter < maxiter)
+        // main loop
+        // iterate over each diagonal block
+        while(2 * sid + 1 < n && splits[2 * sid + 1] > 0)
         {
             if(tid == 0)
             {
-                applyqr = false;
-
-                // current block goes from i until k
-                // determine shift for the QR step
-                // (apply convergence test to find gaps)
-                if(std::abs(D[i]) >= std::abs(D[k]))
-                {
-                    t2b = 1;
-                    sh = std::abs(D[i]);
-                }
-                else
-                {
-                    t2b = 0;
-                    sh = std::abs(D[k]);
-                }
-
-                // shift
-                smin = bdsqr_estimate<S>(k - i + 1, D + i, E + i, t2b, tol, 1);
-                // estimate of the largest singular value in the block
-                smax = find_max_tridiag(i, k, D, E);
-
-                // check for gaps, if none then continue
-                if(smin >= 0)
-                {
-                    if(smin / smax <= minshift)
-                        smin = 0; // shift set to zero if less than accepted value
-                    else if(sh > 0)
-                    {
-                        if(smin * smin / sh / sh < eps)
-                            smin = 0; // shift set to zero if negligible
-                    }
+                // read diagonal block endpoints
+                i = start = splits[2 * sid];
+                k = splits[2 * sid + 1];
 
-                    applyqr = true;
-                }
+                // number of iterations (QR steps) applied to current block
+                iter = 0;
             }
             __syncthreads();
 
-            // apply QR step
-            if(applyqr)
+            // iterate while diagonal block has not converged
+            while(k > start && iter < maxiter)
             {
                 if(tid == 0)
-                    iter += k - i;
+                {
+                    applyqr = false;
 
-                if(t2b)
-                    bdsqr_t2bQRstep(tid, k - i + 1, nv, nu, nc, D + i, E + i, V + i, ldv,
-                                    U + i * ldu, ldu, C + i, ldc, smin, rots + incW * i);
-                else
-                    bdsqr_b2tQRstep(tid, k - i + 1, nv, nu, nc, D + i, E + i, V + i, ldv,
-                                    U + i * ldu, ldu, C + i, ldc, smin, rots + incW * i);
+                    // current block goes from i until k
+                    // determine shift for the QR step
+                    // (apply convergence test to find gaps)
+                    if(std::abs(D[i]) >= std::abs(D[k]))
+                    {
+                        t2b = 1;
+                        sh = std::abs(D[i]);
+                    }
+                    else
+                    {
+                        t2b = 0;
+                        sh = std::abs(D[k]);
+                    }
+
+                    // shift
+                    smin = bdsqr_estimate<S>(k - i + 1, D + i, E + i, t2b, tol, 1);
+                    // estimate of the largest singular value in the block
+                    smax = find_max_tridiag(i, k, D, E);
 
+                    // check for gaps, if none then continue
+                    if(smin >= 0)
+                    {
+                        if(smin / smax <= minshift)
+                            smin = 0; // shift set to zero if less than accepted value
+                        else if(sh > 0)
+                        {
+                            if(smin * smin / sh / sh < eps)
+                                smin = 0; // shift set to zero if negligible
+                        }
+
+                        applyqr = true;
+                    }
+                }
                 __syncthreads();
-            }
 
-            // update current block endpoints
-            if(tid == 0)
-            {
-                while(k - 1 >= start && std::abs(E[k - 1]) < thresh)
+                // apply QR step
+                if(applyqr)
                 {
-                    E[k - 1] = 0;
-                    k--;
+                    if(tid == 0)
+                        iter += k - i;
+
+                    if(t2b)
+                        bdsqr_t2bQRstep(tid, k - i + 1, nv, nu, nc, D + i, E + i, V + i, ldv,
+                                        U + i * ldu, ldu, C + i, ldc, smin, rots + incW * i);
+                    else
+                        bdsqr_b2tQRstep(tid, k - i + 1, nv, nu, nc, D + i, E + i, V + i, ldv,
+                                        U + i * ldu, ldu, C + i, ldc, smin, rots + incW * i);
+
+                    __syncthreads();
                 }
 
-                for(i = k - 1; i >= start; i--)
+                // update current block endpoints
+                if(tid == 0)
                 {
-                    if(std::abs(E[i]) < thresh)
+                    while(k - 1 >= start && std::abs(E[k - 1]) < thresh)
+                    {
+                        E[k - 1] = 0;
+                        k--;
+                    }
+
+                    for(i = k - 1; i >= start; i--)
                     {
-                        E[i] = 0;
-                        break;
+                        if(std::abs(E[i]) < thresh)
+                        {
+                            E[i] = 0;
+                            break;
+                        }
                     }
+                    i++;
                 }
-                i++;
             }
-        }
 
-        sid += hipGridDim_y;
+            sid += BDSQR_SPLIT_GROUPS;
+        }
     }
 }
 
@@ -588,7 +599,8 @@ ROCSOLVER_KERNEL void bdsqr_lower2upper(const rocblas_int n,
 
 /** BDSQR_INIT kernel checks if there are any NaNs or Infs in the input, calculates the
     convergence threshold and initial estimate for the smallest singular value, and splits
-    the matrix into diagonal blocks. **/
+    the matrix into diagonal blocks. The instances without NaNs or Infs are pushed into the
+    queue (which must have been reset). **/
 template <typename T, typename S>
 ROCSOLVER_KERNEL void bdsqr_init(const rocblas_int n,
                                  S* DD,
@@ -602,7 +614,8 @@ ROCSOLVER_KERNEL void bdsqr_init(const rocblas_int n,
                                  rocblas_int* splitsA,
                                  S* workA,
                                  const rocblas_int incW,
-                                 const rocblas_stride strideW)
+                                 const rocblas_stride strideW,
+                                 rocblas_int* queue)
 {
     rocblas_int bid = hipBlockIdx_y;
 
@@ -676,7 +689,10 @@ ROCSOLVER_KERNEL void bdsqr_init(const rocblas_int n,
         info[bid] = n;
     }
     else
+    {
         info[bid] = 0;
+        rocsolver_queue_push(queue, bid);
+    }
 }
 
 /**
@@ -951,8 +967,8 @@ void rocsolver_bdsqr_getMemorySize(const rocblas_int n,
         return;
     }
 
-    // size of split indices array
-    *size_splits_map = sizeof(rocblas_int) * n * batch_count;
+    // size of split indices array, followed by the queue of the instances to process
+    *size_splits_map = sizeof(rocblas_int) * (n * batch_count + 2 + batch_count);
 
     // size of workspace
     rocblas_int incW = 0;
@@ -1067,15 +1083,23 @@ rocblas_status rocsolver_bdsqr_template(rocblas_handle handle,
     rocblas_int nuc_max = std::max(nu, nc);
     rocblas_int nvuc_max = std::max(nv, nuc_max);
 
+    rocblas_int groups = rocsolver_queue_groups(
+        BDSQR_SPLIT_GROUPS * batch_count, 1, rocsolver_handle_state_map::get_arch(handle).cu_count);
+
     dim3 grid1(1, batch_count, 1);
-    dim3 grid2(1, BDSQR_SPLIT_GROUPS, batch_count);
+    dim3 grid2(groups, 1, 1);
     dim3 threads1(1, 1, 1);
     dim3 threads2((nu || nc ? std::min(nuc_max, BS1) : 1), 1, 1);
     dim3 threads3((nv || nu || nc ? std::min(nvuc_max, BS1) : 1), 1, 1);
 
+    // the instances without NaNs or Infs are processed by the persistent main kernel, which
+    // pulls them from a queue stored after the split indices
+    rocblas_int* queue = splits_map + n * batch_count;
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(1, 1, 1), dim3(2, 1, 1), 0, stream, queue, 2, 0);
+
     // check for NaNs and Infs in input
     ROCSOLVER_LAUNCH_KERNEL((bdsqr_init<T>), grid1, threads1, 0, stream, n, D, strideD, E, strideE,
-                            info, maxiter, sfm, tol, splits_map, work, incW, strideW);
+                            info, maxiter, sfm, tol, splits_map, work, incW, strideW, queue);
 
     if(n > 1)
     {
@@ -1090,8 +1114,8 @@ rocblas_status rocsolver_bdsqr_template(rocblas_handle handle,
         // main computation of SVD
         ROCSOLVER_LAUNCH_KERNEL((bdsqr_kernel<T>), grid2, threads3, 0, stream, n, nv, nu, nc, D,
                                 strideD, E, strideE, V, shiftV, ldv, strideV, U, shiftU, ldu,
-                                strideU, C, shiftC, ldc, strideC, info, maxiter, eps, sfm, tol,
-                                minshift, splits_map, work, incW, strideW);
+                                strideU, C, shiftC, ldc, strideC, maxiter, eps, sfm, tol, minshift,
+                                splits_map, work, incW, strideW, queue);
     }
 
     // sort the singular values and vectors
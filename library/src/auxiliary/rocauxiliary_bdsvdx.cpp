@@ -80,7 +80,7 @@ rocblas_status rocsolver_bdsvdx_impl(rocblas_handle handle,
                                       &size_Etgk, &size_Stmp);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(
             handle, size_work1_iwork, size_work2_pivmin, size_Esqr, size_bounds, size_inter,
             size_ninter, size_nsplit, size_iblock, size_isplit_map, size_Dtgk, size_Etgk, size_Stmp);
 
@@ -39,7 +39,7 @@ template <typename T, typename U, std::enable_if_t<!rocblas_is_complex<T>, int>
 ROCSOLVER_KERNEL void conj_in_place(const rocblas_int m,
                                     const rocblas_int n,
                                     U A,
-                                    const rocblas_int shifta,
+                                    const rocblas_stride shifta,
                                     const rocblas_int lda,
                                     const rocblas_stride stridea)
 {
@@ -50,7 +50,7 @@ template <typename T, typename U, std::enable_if_t<rocblas_is_complex<T>, int> =
 ROCSOLVER_KERNEL void conj_in_place(const rocblas_int m,
                                     const rocblas_int n,
                                     U A,
-                                    const rocblas_int shifta,
+                                    const rocblas_stride shifta,
                                     const rocblas_int lda,
                                     const rocblas_stride stridea)
 {
@@ -61,7 +61,7 @@ ROCSOLVER_KERNEL void conj_in_place(const rocblas_int m,
     T* Ap = load_ptr_batch<T>(A, b, shifta, stridea);
 
     if(i < m && j < n)
-        Ap[i + j * lda] = conj(Ap[i + j * lda]);
+        Ap[i + j * rocblas_stride(lda)] = conj(Ap[i + j * rocblas_stride(lda)]);
 }
 
 template <typename T>
@@ -92,7 +92,7 @@ template <typename T, typename U, bool COMPLEX = rocblas_is_complex<T>>
 rocblas_status rocsolver_lacgv_template(rocblas_handle handle,
                                         const rocblas_int n,
                                         U x,
-                                        const rocblas_int shiftx,
+                                        const rocblas_stride shiftx,
                                         const rocblas_int incx,
                                         const rocblas_stride stridex,
                                         const rocblas_int batch_count)
@@ -107,7 +107,7 @@ rocblas_status rocsolver_lacgv_template(rocblas_handle handle,
     rocblas_get_stream(handle, &stream);
 
     // handle negative increments
-    rocblas_int offset = incx < 0 ? shiftx - (n - 1) * incx : shiftx;
+    rocblas_stride offset = incx < 0 ? shiftx - (n - 1) * rocblas_stride(incx) : shiftx;
 
     // conjugate x
     rocblas_int blocks = (n - 1) / 64 + 1;
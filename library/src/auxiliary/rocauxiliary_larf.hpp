@@ -111,13 +111,13 @@ rocblas_status rocsolver_larf_template(rocblas_handle handle,
                                        const rocblas_int m,
                                        const rocblas_int n,
                                        U x,
-                                       const rocblas_int shiftx,
+                                       const rocblas_stride shiftx,
                                        const rocblas_int incx,
                                        const rocblas_stride stridex,
                                        const T* alpha,
                                        const rocblas_stride stridep,
                                        U A,
-                                       const rocblas_int shiftA,
+                                       const rocblas_stride shiftA,
                                        const rocblas_int lda,
                                        const rocblas_stride stridea,
                                        const rocblas_int batch_count,
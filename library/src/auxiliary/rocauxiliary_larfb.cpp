@@ -75,7 +75,7 @@ rocblas_status rocsolver_larfb_impl(rocblas_handle handle,
     rocsolver_larfb_getMemorySize<false, T>(side, m, n, k, batch_count, &size_tmptr, &size_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_tmptr, size_workArr);
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_tmptr, size_workArr);
 
     // memory workspace allocation
     void *tmptr, *workArr;
@@ -39,7 +39,7 @@ template <typename T, typename U>
 ROCSOLVER_KERNEL void copymatA1(const rocblas_int ldw,
                                 const rocblas_int order,
                                 U A,
-                                const rocblas_int shiftA,
+                                const rocblas_stride shiftA,
                                 const rocblas_int lda,
                                 const rocblas_stride strideA,
                                 T* tmptr)
@@ -65,7 +65,7 @@ template <typename T, typename U>
 ROCSOLVER_KERNEL void addmatA1(const rocblas_int ldw,
                                const rocblas_int order,
                                U A,
-                               const rocblas_int shiftA,
+                               const rocblas_stride shiftA,
                                const rocblas_int lda,
                                const rocblas_stride strideA,
                                T* tmptr)
@@ -179,20 +179,21 @@ rocblas_status rocsolver_larfb_template(rocblas_handle handle,
                                         const rocblas_int n,
                                         const rocblas_int k,
                                         U V,
-                                        const rocblas_int shiftV,
+                                        const rocblas_stride shiftV,
                                         const rocblas_int ldv,
                                         const rocblas_stride strideV,
                                         T* F,
-                                        const rocblas_int shiftF,
+                                        const rocblas_stride shiftF,
                                         const rocblas_int ldf,
                                         const rocblas_stride strideF,
                                         U A,
-                                        const rocblas_int shiftA,
+                                        const rocblas_stride shiftA,
                                         const rocblas_int lda,
                                         const rocblas_stride strideA,
                                         const rocblas_int batch_count,
                                         T* tmptr,
-                                        T** workArr)
+                                        T** workArr,
+                                        const rocblas_int strip = 0)
 {
     ROCSOLVER_ENTER("larfb", "side:", side, "trans:", trans, "direct:", direct, "storev:", storev,
                     "m:", m, "n:", n, "k:", k, "shiftV:", shiftV, "ldv:", ldv, "shiftF:", shiftF,
@@ -206,6 +207,9 @@ rocblas_status rocsolver_larfb_template(rocblas_handle handle,
     rocblas_get_stream(handle, &stream);
     T *Vp, *Fp;
 
+    // workArr only holds the pointers to tmptr; build them once for all the products
+    rocsolver_ptr_array_scope ptr_arrays(handle, workArr, batch_count);
+
     // everything must be executed with scalars on the host
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
@@ -309,6 +313,11 @@ rocblas_status rocsolver_larfb_template(rocblas_handle handle,
     rocblas_stride strideW = rocblas_stride(ldw) * order;
     uploT = (forward ? rocblas_fill_upper : rocblas_fill_lower);
 
+    // if side is right, the columns of A2 are multiplied in strips of at most w columns
+    // (the 64-bit APIs pass a strip width that keeps every rocBLAS call addressable with
+    // 32-bit indices; on the left side, the callers split A by columns instead)
+    const rocblas_int w = (strip > 0 ? strip : n);
+
     // copy A1 to tmptr
     rocblas_int blocksx = (order - 1) / 32 + 1;
     rocblas_int blocksy = (ldw - 1) / 32 + 1;
@@ -329,9 +338,13 @@ rocblas_status rocsolver_larfb_template(rocblas_handle handle,
                              offsetV2, ldv, strideV, A, offsetA2, lda, strideA, &one, tmptr, 0, ldw,
                              strideW, batch_count, workArr);
         else
-            rocblasCall_gemm(handle, rocblas_operation_none, transp, ldw, order, n - k, &one, A,
-                             offsetA2, lda, strideA, V, offsetV2, ldv, strideV, &one, tmptr, 0, ldw,
-                             strideW, batch_count, workArr);
+        {
+            for(rocblas_int c = 0; c < n - k; c += w)
+                rocblasCall_gemm(handle, rocblas_operation_none, transp, ldw, order,
+                                 std::min(n - k - c, w), &one, A, offsetA2 + idx2D(0, c, lda), lda,
+                                 strideA, V, offsetV2 + (colwise ? c : idx2D(0, c, ldv)), ldv,
+                                 strideV, &one, tmptr, 0, ldw, strideW, batch_count, workArr);
+        }
     }
 
     // compute: trans(T) * (V1' * A1 + V2' * A2)
@@ -353,9 +366,13 @@ rocblas_status rocsolver_larfb_template(rocblas_handle handle,
                              offsetV2, ldv, strideV, tmptr, 0, ldw, strideW, &one, A, offsetA2, lda,
                              strideA, batch_count, workArr);
         else
-            rocblasCall_gemm(handle, rocblas_operation_none, transp, ldw, n - k, order, &minone,
-                             tmptr, 0, ldw, strideW, V, offsetV2, ldv, strideV, &one, A, offsetA2,
-                             lda, strideA, batch_count, workArr);
+        {
+            for(rocblas_int c = 0; c < n - k; c += w)
+                rocblasCall_gemm(handle, rocblas_operation_none, transp, ldw,
+                                 std::min(n - k - c, w), order, &minone, tmptr, 0, ldw, strideW, V,
+                                 offsetV2 + (colwise ? c : idx2D(0, c, ldv)), ldv, strideV, &one, A,
+                                 offsetA2 + idx2D(0, c, lda), lda, strideA, batch_count, workArr);
+        }
     }
 
     // compute: V1 * trans(T) * (V1' * A1 + V2' * A2)
@@ -63,7 +63,7 @@ rocblas_status rocsolver_larfg_impl(rocblas_handle handle,
     rocsolver_larfg_getMemorySize<T>(n, batch_count, &size_work, &size_norms);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_work, size_norms);
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_work, size_norms);
 
     // memory workspace allocation
     void *work, *norms;
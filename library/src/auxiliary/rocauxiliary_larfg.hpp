@@ -40,7 +40,7 @@ ROCSOLVER_KERNEL void set_taubeta(T* tau,
                                   const rocblas_stride strideP,
                                   T* norms,
                                   U alpha,
-                                  const rocblas_int shifta,
+                                  const rocblas_stride shifta,
                                   const rocblas_stride stride)
 {
     int b = hipBlockIdx_x;
@@ -74,7 +74,7 @@ ROCSOLVER_KERNEL void set_taubeta(T* tau,
                                   const rocblas_stride strideP,
                                   T* norms,
                                   U alpha,
-                                  const rocblas_int shifta,
+                                  const rocblas_stride shifta,
                                   const rocblas_stride stride)
 {
     using S = decltype(std::real(T{}));
@@ -173,9 +173,9 @@ template <typename T, typename U, bool COMPLEX = rocblas_is_complex<T>>
 rocblas_status rocsolver_larfg_template(rocblas_handle handle,
                                         const rocblas_int n,
                                         U alpha,
-                                        const rocblas_int shifta,
+                                        const rocblas_stride shifta,
                                         U x,
-                                        const rocblas_int shiftx,
+                                        const rocblas_stride shiftx,
                                         const rocblas_int incx,
                                         const rocblas_stride stridex,
                                         T* tau,
@@ -70,7 +70,7 @@ rocblas_status rocsolver_larft_impl(rocblas_handle handle,
                                             &size_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work, size_workArr);
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_scalars, size_work, size_workArr);
 
     // memory workspace allocation
     void *scalars, *work, *workArr;
@@ -40,7 +40,7 @@ template <typename T, typename U, std::enable_if_t<!rocblas_is_complex<T>, int>
 ROCSOLVER_KERNEL void set_triangular(const rocblas_int n,
                                      const rocblas_int k,
                                      U V,
-                                     const rocblas_int shiftV,
+                                     const rocblas_stride shiftV,
                                      const rocblas_int ldv,
                                      const rocblas_stride strideV,
                                      T* tau,
@@ -95,7 +95,7 @@ template <typename T, typename U, std::enable_if_t<rocblas_is_complex<T>, int> =
 ROCSOLVER_KERNEL void set_triangular(const rocblas_int n,
                                      const rocblas_int k,
                                      U V,
-                                     const rocblas_int shiftV,
+                                     const rocblas_stride shiftV,
                                      const rocblas_int ldv,
                                      const rocblas_stride strideV,
                                      T* tau,
@@ -234,7 +234,7 @@ rocblas_status rocsolver_larft_template(rocblas_handle handle,
                                         const rocblas_int n,
                                         const rocblas_int k,
                                         U V,
-                                        const rocblas_int shiftV,
+                                        const rocblas_stride shiftV,
                                         const rocblas_int ldv,
                                         const rocblas_stride strideV,
                                         T* tau,
@@ -257,6 +257,9 @@ rocblas_status rocsolver_larft_template(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
+    // workArr only holds the pointers to F; build them once for all the columns
+    rocsolver_ptr_array_scope ptr_arrays(handle, workArr, batch_count);
+
     // everything must be executed with scalars on the device
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
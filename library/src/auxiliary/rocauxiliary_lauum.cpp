@@ -56,7 +56,7 @@ rocblas_status rocsolver_lauum_impl(rocblas_handle handle,
     rocsolver_lauum_getMemorySize<U>(n, batch_count, &size_work);
 
     if(rocblas_is_device_memory_size_query(handle))
-        rocblas_set_optimal_device_memory_size(handle, size_work);
+        ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_work);
 
     void* work;
     rocblas_device_malloc mem(handle, size_work);
@@ -36,20 +36,20 @@
 #include "rocblas.hpp"
 #include "rocsolver/rocsolver.h"
 
-template <typename T, typename U>
-ROCSOLVER_KERNEL void org2r_init_ident(const rocblas_int m,
-                                       const rocblas_int n,
-                                       const rocblas_int k,
+template <typename T, typename I, typename U>
+ROCSOLVER_KERNEL void org2r_init_ident(const I m,
+                                       const I n,
+                                       const I k,
                                        U A,
-                                       const rocblas_int shiftA,
-                                       const rocblas_int lda,
+                                       const rocblas_stride shiftA,
+                                       const I lda,
                                        const rocblas_stride strideA)
 {
     const auto blocksizex = hipBlockDim_x;
     const auto blocksizey = hipBlockDim_y;
     const auto b = hipBlockIdx_z;
-    const auto j = hipBlockIdx_y * blocksizey + hipThreadIdx_y;
-    const auto i = hipBlockIdx_x * blocksizex + hipThreadIdx_x;
+    const I j = hipBlockIdx_y * static_cast<I>(blocksizey) + hipThreadIdx_y;
+    const I i = hipBlockIdx_x * static_cast<I>(blocksizex) + hipThreadIdx_x;
 
     if(i < m && j < n)
     {
@@ -67,10 +67,10 @@ ROCSOLVER_KERNEL void org2r_init_ident(const rocblas_int m,
     }
 }
 
-template <bool BATCHED, typename T>
-void rocsolver_org2r_ung2r_getMemorySize(const rocblas_int m,
-                                         const rocblas_int n,
-                                         const rocblas_int batch_count,
+template <bool BATCHED, typename T, typename I>
+void rocsolver_org2r_ung2r_getMemorySize(const I m,
+                                         const I n,
+                                         const I batch_count,
                                          size_t* size_scalars,
                                          size_t* size_Abyx,
                                          size_t* size_workArr)
@@ -85,16 +85,18 @@ void rocsolver_org2r_ung2r_getMemorySize(const rocblas_int m,
     }
 
     // memory requirements to call larf
-    rocsolver_larf_getMemorySize<BATCHED, T>(rocblas_side_left, m, n, batch_count, size_scalars,
+    // (the reflectors are applied to strips of at most w columns)
+    const I w = rocsolver_column_strip(n, m);
+    rocsolver_larf_getMemorySize<BATCHED, T>(rocblas_side_left, m, w, batch_count, size_scalars,
                                              size_Abyx, size_workArr);
 }
 
-template <typename T, typename U>
+template <typename T, typename I, typename U>
 rocblas_status rocsolver_org2r_orgqr_argCheck(rocblas_handle handle,
-                                              const rocblas_int m,
-                                              const rocblas_int n,
-                                              const rocblas_int k,
-                                              const rocblas_int lda,
+                                              const I m,
+                                              const I n,
+                                              const I k,
+                                              const I lda,
                                               T A,
                                               U ipiv)
 {
@@ -118,18 +120,18 @@ rocblas_status rocsolver_org2r_orgqr_argCheck(rocblas_handle handle,
     return rocblas_status_continue;
 }
 
-template <typename T, typename U>
+template <typename T, typename I, typename U>
 rocblas_status rocsolver_org2r_ung2r_template(rocblas_handle handle,
-                                              const rocblas_int m,
-                                              const rocblas_int n,
-                                              const rocblas_int k,
+                                              const I m,
+                                              const I n,
+                                              const I k,
                                               U A,
-                                              const rocblas_int shiftA,
-                                              const rocblas_int lda,
+                                              const rocblas_stride shiftA,
+                                              const I lda,
                                               const rocblas_stride strideA,
                                               T* ipiv,
                                               const rocblas_stride strideP,
-                                              const rocblas_int batch_count,
+                                              const I batch_count,
                                               T* scalars,
                                               T* Abyx,
                                               T** workArr)
@@ -144,25 +146,34 @@ rocblas_status rocsolver_org2r_ung2r_template(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
+    // the 32-bit interface of rocBLAS requires the leading dimension and the batch size to
+    // fit in rocblas_int
+    if(std::is_same<I, int64_t>::value && (lda >= INT_MAX || batch_count >= INT_MAX))
+        return rocblas_status_not_implemented;
+
+    // the reflectors are applied to strips of at most w columns
+    const I w = rocsolver_column_strip(n, lda);
+
     // everything must be executed with scalars on the device
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
     rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device);
 
     // Initialize identity matrix (non used columns)
-    rocblas_int blocksx = (m - 1) / 32 + 1;
-    rocblas_int blocksy = (n - 1) / 32 + 1;
+    I blocksx = (m - 1) / 32 + 1;
+    I blocksy = (n - 1) / 32 + 1;
     ROCSOLVER_LAUNCH_KERNEL(org2r_init_ident<T>, dim3(blocksx, blocksy, batch_count), dim3(32, 32),
                             0, stream, m, n, k, A, shiftA, lda, strideA);
 
-    for(rocblas_int j = k - 1; j >= 0; --j)
+    for(I j = k - 1; j >= 0; --j)
     {
         // apply H(i) to Q(i:m,i:n) from the left
-        if(j < n - 1)
+        // (in strips of at most w columns)
+        for(I c = j + 1; c < n; c += w)
         {
-            rocsolver_larf_template<T>(handle, rocblas_side_left, m - j, n - j - 1, A,
+            rocsolver_larf_template<T>(handle, rocblas_side_left, m - j, std::min(n - c, w), A,
                                        shiftA + idx2D(j, j, lda), 1, strideA, (ipiv + j), strideP,
-                                       A, shiftA + idx2D(j, j + 1, lda), lda, strideA, batch_count,
+                                       A, shiftA + idx2D(j, c, lda), lda, strideA, batch_count,
                                        scalars, Abyx, workArr);
         }
 
@@ -173,7 +184,7 @@ rocblas_status rocsolver_org2r_ung2r_template(rocblas_handle handle,
         // update i-th column -corresponding to H(i)-
         if(j < m - 1)
             rocblasCall_scal<T>(handle, m - j - 1, ipiv + j, strideP, A,
-                                shiftA + idx2D(j + 1, j, lda), 1, strideA, batch_count);
+                                shiftA + idx2D(j + 1, j, lda), I(1), strideA, batch_count);
     }
 
     // restore values of tau
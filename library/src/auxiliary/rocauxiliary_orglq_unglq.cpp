@@ -70,7 +70,7 @@ rocblas_status rocsolver_orglq_unglq_impl(rocblas_handle handle,
                                                   &size_Abyx_tmptr, &size_trfact, &size_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work,
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_scalars, size_work,
                                                       size_Abyx_tmptr, size_trfact, size_workArr);
 
     // memory workspace allocation
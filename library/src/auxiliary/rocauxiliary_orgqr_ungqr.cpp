@@ -27,13 +27,13 @@
 
 #include "rocauxiliary_orgqr_ungqr.hpp"
 
-template <typename T>
+template <typename T, typename I>
 rocblas_status rocsolver_orgqr_ungqr_impl(rocblas_handle handle,
-                                          const rocblas_int m,
-                                          const rocblas_int n,
-                                          const rocblas_int k,
+                                          const I m,
+                                          const I n,
+                                          const I k,
                                           T* A,
-                                          const rocblas_int lda,
+                                          const I lda,
                                           T* ipiv)
 {
     const char* name = (!rocblas_is_complex<T> ? "orgqr" : "ungqr");
@@ -48,12 +48,12 @@ rocblas_status rocsolver_orgqr_ungqr_impl(rocblas_handle handle,
         return st;
 
     // working with unshifted arrays
-    rocblas_int shiftA = 0;
+    rocblas_stride shiftA = 0;
 
     // normal (non-batched non-strided) execution
     rocblas_stride strideA = 0;
     rocblas_stride strideP = 0;
-    rocblas_int batch_count = 1;
+    I batch_count = 1;
 
     // memory workspace sizes:
     // size for constants in rocblas calls
@@ -70,7 +70,7 @@ rocblas_status rocsolver_orgqr_ungqr_impl(rocblas_handle handle,
                                                   &size_Abyx_tmptr, &size_trfact, &size_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work,
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_scalars, size_work,
                                                       size_Abyx_tmptr, size_trfact, size_workArr);
 
     // memory workspace allocation
@@ -146,4 +146,48 @@ rocblas_status rocsolver_zungqr(rocblas_handle handle,
     return rocsolver_orgqr_ungqr_impl<rocblas_double_complex>(handle, m, n, k, A, lda, ipiv);
 }
 
+rocblas_status rocsolver_sorgqr_64(rocblas_handle handle,
+                                   const int64_t m,
+                                   const int64_t n,
+                                   const int64_t k,
+                                   float* A,
+                                   const int64_t lda,
+                                   float* ipiv)
+{
+    return rocsolver_orgqr_ungqr_impl<float>(handle, m, n, k, A, lda, ipiv);
+}
+
+rocblas_status rocsolver_dorgqr_64(rocblas_handle handle,
+                                   const int64_t m,
+                                   const int64_t n,
+                                   const int64_t k,
+                                   double* A,
+                                   const int64_t lda,
+                                   double* ipiv)
+{
+    return rocsolver_orgqr_ungqr_impl<double>(handle, m, n, k, A, lda, ipiv);
+}
+
+rocblas_status rocsolver_cungqr_64(rocblas_handle handle,
+                                   const int64_t m,
+                                   const int64_t n,
+                                   const int64_t k,
+                                   rocblas_float_complex* A,
+                                   const int64_t lda,
+                                   rocblas_float_complex* ipiv)
+{
+    return rocsolver_orgqr_ungqr_impl<rocblas_float_complex>(handle, m, n, k, A, lda, ipiv);
+}
+
+rocblas_status rocsolver_zungqr_64(rocblas_handle handle,
+                                   const int64_t m,
+                                   const int64_t n,
+                                   const int64_t k,
+                                   rocblas_double_complex* A,
+                                   const int64_t lda,
+                                   rocblas_double_complex* ipiv)
+{
+    return rocsolver_orgqr_ungqr_impl<rocblas_double_complex>(handle, m, n, k, A, lda, ipiv);
+}
+
 } // extern C
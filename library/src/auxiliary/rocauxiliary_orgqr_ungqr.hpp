@@ -38,11 +38,11 @@
 #include "rocblas.hpp"
 #include "rocsolver/rocsolver.h"
 
-template <bool BATCHED, typename T>
-void rocsolver_orgqr_ungqr_getMemorySize(const rocblas_int m,
-                                         const rocblas_int n,
-                                         const rocblas_int k,
-                                         const rocblas_int batch_count,
+template <bool BATCHED, typename T, typename I>
+void rocsolver_orgqr_ungqr_getMemorySize(const I m,
+                                         const I n,
+                                         const I k,
+                                         const I batch_count,
                                          size_t* size_scalars,
                                          size_t* size_work,
                                          size_t* size_Abyx_tmptr,
@@ -72,15 +72,16 @@ void rocsolver_orgqr_ungqr_getMemorySize(const rocblas_int m,
 
     else
     {
-        rocblas_int jb = xxGQx_BLOCKSIZE;
-        rocblas_int j = ((k - xxGQx_xxGQx2_SWITCHSIZE - 1) / jb) * jb;
-        rocblas_int kk = std::min(k, j + jb);
+        I jb = xxGQx_BLOCKSIZE;
+
+        // the block reflectors are applied to strips of at most w columns
+        I w = std::min(n - jb, rocsolver_column_strip(n, m));
 
         // size of workspace is maximum of what is needed by larft and larfb.
         // size of Abyx_tmptr is maximum of what is needed by org2r/ung2r and larfb.
         rocsolver_larft_getMemorySize<BATCHED, T>(m, jb, batch_count, &unused, size_work, &unused);
-        rocsolver_larfb_getMemorySize<BATCHED, T>(rocblas_side_left, m, n - jb, jb, batch_count,
-                                                  &temp, &unused);
+        rocsolver_larfb_getMemorySize<BATCHED, T>(rocblas_side_left, m, w, jb, batch_count, &temp,
+                                                  &unused);
 
         *size_Abyx_tmptr = *size_Abyx_tmptr >= temp ? *size_Abyx_tmptr : temp;
 
@@ -89,18 +90,18 @@ void rocsolver_orgqr_ungqr_getMemorySize(const rocblas_int m,
     }
 }
 
-template <bool BATCHED, bool STRIDED, typename T, typename U>
+template <bool BATCHED, bool STRIDED, typename T, typename I, typename U>
 rocblas_status rocsolver_orgqr_ungqr_template(rocblas_handle handle,
-                                              const rocblas_int m,
-                                              const rocblas_int n,
-                                              const rocblas_int k,
+                                              const I m,
+                                              const I n,
+                                              const I k,
                                               U A,
-                                              const rocblas_int shiftA,
-                                              const rocblas_int lda,
+                                              const rocblas_stride shiftA,
+                                              const I lda,
                                               const rocblas_stride strideA,
                                               T* ipiv,
                                               const rocblas_stride strideP,
-                                              const rocblas_int batch_count,
+                                              const I batch_count,
                                               T* scalars,
                                               T* work,
                                               T* Abyx_tmptr,
@@ -117,22 +118,27 @@ rocblas_status rocsolver_orgqr_ungqr_template(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    // if the matrix is small, use the unblocked variant of the algorithm
-    if(k <= xxGQx_xxGQx2_SWITCHSIZE)
+    // the block reflectors are applied to strips of at most w columns, so that every rocBLAS
+    // call can be addressed with 32-bit indices (w = n if the whole matrix can)
+    const I w = rocsolver_column_strip(n, lda);
+
+    // if the matrix is small, or if the strips cannot hold a whole block, use the unblocked
+    // variant of the algorithm
+    if(k <= xxGQx_xxGQx2_SWITCHSIZE || w < xxGQx_BLOCKSIZE)
         return rocsolver_org2r_ung2r_template<T>(handle, m, n, k, A, shiftA, lda, strideA, ipiv,
                                                  strideP, batch_count, scalars, Abyx_tmptr, workArr);
 
-    rocblas_int ldw = xxGQx_BLOCKSIZE;
+    I ldw = xxGQx_BLOCKSIZE;
     rocblas_stride strideW = rocblas_stride(ldw) * ldw;
 
     // start of first blocked block
-    rocblas_int jb = ldw;
-    rocblas_int j = ((k - xxGQx_xxGQx2_SWITCHSIZE - 1) / jb) * jb;
+    I jb = ldw;
+    I j = ((k - xxGQx_xxGQx2_SWITCHSIZE - 1) / jb) * jb;
 
     // start of the unblocked block
-    rocblas_int kk = std::min(k, j + jb);
+    I kk = std::min(k, j + jb);
 
-    rocblas_int blocksy, blocksx;
+    I blocksy, blocksx;
 
     // compute the unblockled part and set to zero the
     // corresponding top submatrix
@@ -160,11 +166,12 @@ rocblas_status rocsolver_orgqr_ungqr_template(rocblas_handle handle,
                                         (ipiv + j), strideP, trfact, ldw, strideW, batch_count,
                                         scalars, work, workArr);
 
-            rocsolver_larfb_template<BATCHED, STRIDED, T>(
-                handle, rocblas_side_left, rocblas_operation_none, rocblas_forward_direction,
-                rocblas_column_wise, m - j, n - j - jb, jb, A, shiftA + idx2D(j, j, lda), lda,
-                strideA, trfact, 0, ldw, strideW, A, shiftA + idx2D(j, j + jb, lda), lda, strideA,
-                batch_count, Abyx_tmptr, workArr);
+            for(I c = j + jb; c < n; c += w)
+                rocsolver_larfb_template<BATCHED, STRIDED, T>(
+                    handle, rocblas_side_left, rocblas_operation_none, rocblas_forward_direction,
+                    rocblas_column_wise, m - j, std::min(n - c, w), jb, A,
+                    shiftA + idx2D(j, j, lda), lda, strideA, trfact, 0, ldw, strideW, A,
+                    shiftA + idx2D(j, c, lda), lda, strideA, batch_count, Abyx_tmptr, workArr);
         }
 
         // now compute the current block and set to zero
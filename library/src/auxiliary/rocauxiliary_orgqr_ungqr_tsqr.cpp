@@ -0,0 +1,129 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "rocauxiliary_orgqr_ungqr_tsqr.hpp"
+
+template <typename T>
+rocblas_status rocsolver_orgqr_ungqr_tsqr_impl(rocblas_handle handle,
+                                               const rocblas_int m,
+                                               const rocblas_int n,
+                                               T* A,
+                                               const rocblas_int lda,
+                                               T* ipiv)
+{
+    const char* name = (!rocblas_is_complex<T> ? "orgqr_tsqr" : "ungqr_tsqr");
+    ROCSOLVER_ENTER_TOP(name, "-m", m, "-n", n, "--lda", lda);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_org2r_orgqr_argCheck(handle, m, n, n, lda, A, ipiv);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideP = 0;
+    rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // size of the blocks of the tree orthogonal factor
+    size_t size_W;
+    // size of the staging area for the rows of A (if they do not fit in shared memory)
+    size_t size_scratch;
+    rocsolver_orgqr_ungqr_tsqr_getMemorySize<T>(m, n, batch_count, &size_W, &size_scratch);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_W, size_scratch);
+
+    // memory workspace allocation
+    void *W, *scratch;
+    rocblas_device_malloc mem(handle, size_W, size_scratch);
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    W = mem[0];
+    scratch = mem[1];
+
+    // execution
+    return rocsolver_orgqr_ungqr_tsqr_template<T>(handle, m, n, A, shiftA, lda, strideA, ipiv,
+                                                  strideP, batch_count, (T*)W, (T*)scratch);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sorgqr_tsqr(rocblas_handle handle,
+                                     const rocblas_int m,
+                                     const rocblas_int n,
+                                     float* A,
+                                     const rocblas_int lda,
+                                     float* ipiv)
+{
+    return rocsolver_orgqr_ungqr_tsqr_impl<float>(handle, m, n, A, lda, ipiv);
+}
+
+rocblas_status rocsolver_dorgqr_tsqr(rocblas_handle handle,
+                                     const rocblas_int m,
+                                     const rocblas_int n,
+                                     double* A,
+                                     const rocblas_int lda,
+                                     double* ipiv)
+{
+    return rocsolver_orgqr_ungqr_tsqr_impl<double>(handle, m, n, A, lda, ipiv);
+}
+
+rocblas_status rocsolver_cungqr_tsqr(rocblas_handle handle,
+                                     const rocblas_int m,
+                                     const rocblas_int n,
+                                     rocblas_float_complex* A,
+                                     const rocblas_int lda,
+                                     rocblas_float_complex* ipiv)
+{
+    return rocsolver_orgqr_ungqr_tsqr_impl<rocblas_float_complex>(handle, m, n, A, lda, ipiv);
+}
+
+rocblas_status rocsolver_zungqr_tsqr(rocblas_handle handle,
+                                     const rocblas_int m,
+                                     const rocblas_int n,
+                                     rocblas_double_complex* A,
+                                     const rocblas_int lda,
+                                     rocblas_double_complex* ipiv)
+{
+    return rocsolver_orgqr_ungqr_tsqr_impl<rocblas_double_complex>(handle, m, n, A, lda, ipiv);
+}
+
+} // extern C
@@ -0,0 +1,250 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+
+#pragma once
+
+#include "rocauxiliary_org2r_ung2r.hpp"
+#include "rocauxiliary_ormqr_unmqr_tsqr.hpp"
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+/** TSQR_LEAF_GENERATE overwrites every block of rows of A with the first n columns
+    of the orthogonal factor of its QR factorization (as in ORG2R). There is a thread-block
+    per block of rows. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) tsqr_leaf_generate(const rocblas_int m,
+                                                                const rocblas_int n,
+                                                                const rocblas_int mb,
+                                                                const rocblas_int nblocks,
+                                                                U A,
+                                                                const rocblas_int shiftA,
+                                                                const rocblas_int lda,
+                                                                const rocblas_stride strideA,
+                                                                T* ipiv,
+                                                                const rocblas_stride strideP)
+{
+    const rocblas_int bid = hipBlockIdx_y;
+    const rocblas_int blk = hipBlockIdx_x;
+    const rocblas_int tid = hipThreadIdx_x;
+    const rocblas_int rows = (blk == nblocks - 1) ? m - blk * mb : mb;
+
+    __shared__ T sdot[BS1];
+
+    T* a = load_ptr_batch<T>(A, bid, shiftA, strideA) + blk * mb;
+    T* tau = ipiv + bid * strideP + blk * n;
+
+    for(rocblas_int j = n - 1; j >= 0; j--)
+    {
+        const T t = tau[j];
+
+        // apply H(j) to columns j+1 to n-1
+        for(rocblas_int c = j + 1; c < n; c++)
+        {
+            T d = (tid == 0) ? a[j + c * lda] : T(0);
+            for(rocblas_int i = j + 1 + tid; i < rows; i += BS1)
+                d += conj(a[i + j * lda]) * a[i + c * lda];
+            d = block_sum<BS1>(tid, d, sdot) * t;
+
+            if(tid == 0)
+                a[j + c * lda] -= d;
+            for(rocblas_int i = j + 1 + tid; i < rows; i += BS1)
+                a[i + c * lda] -= a[i + j * lda] * d;
+        }
+        __syncthreads();
+
+        // column j of the orthogonal factor
+        for(rocblas_int i = tid; i < rows; i += BS1)
+        {
+            if(i < j)
+                a[i + j * lda] = 0;
+            else if(i == j)
+                a[i + j * lda] = T(1) - t;
+            else
+                a[i + j * lda] *= -t;
+        }
+        __syncthreads();
+    }
+}
+
+/** TSQR_LEAF_MULTIPLY overwrites every block of rows A_b of A with A_b * G_b, where G_b
+    is the n-by-n block b of the matrix G. The rows of A_b are staged (R at a time) in
+    the dynamic shared memory or, if they do not fit, in the workspace. There is a thread-block
+    per block of rows. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) tsqr_leaf_multiply(const rocblas_int m,
+                                                                const rocblas_int n,
+                                                                const rocblas_int mb,
+                                                                const rocblas_int nblocks,
+                                                                const rocblas_int R,
+                                                                U A,
+                                                                const rocblas_int shiftA,
+                                                                const rocblas_int lda,
+                                                                const rocblas_stride strideA,
+                                                                T* G,
+                                                                const rocblas_int ldg,
+                                                                const rocblas_stride strideG,
+                                                                T* scratch)
+{
+    const rocblas_int bid = hipBlockIdx_y;
+    const rocblas_int blk = hipBlockIdx_x;
+    const rocblas_int tid = hipThreadIdx_x;
+    const rocblas_int rows = (blk == nblocks - 1) ? m - blk * mb : mb;
+
+    extern __shared__ double lmem[];
+    T* w = scratch ? scratch + (bid * nblocks + blk) * R * n : reinterpret_cast<T*>(lmem);
+
+    T* a = load_ptr_batch<T>(A, bid, shiftA, strideA) + blk * mb;
+    T* g = G + bid * strideG + blk * n;
+
+    for(rocblas_int r0 = 0; r0 < rows; r0 += R)
+    {
+        const rocblas_int nr = std::min(R, rows - r0);
+
+        // stage the rows
+        for(rocblas_int k = tid; k < nr * n; k += BS1)
+            w[k] = a[r0 + (k % nr) + (k / nr) * lda];
+        __syncthreads();
+
+        for(rocblas_int k = tid; k < nr * n; k += BS1)
+        {
+            const rocblas_int i = k % nr;
+            const rocblas_int j = k / nr;
+
+            T s = 0;
+            for(rocblas_int l = 0; l < n; l++)
+                s += w[i + l * nr] * g[l + j * ldg];
+            a[r0 + i + j * lda] = s;
+        }
+        __syncthreads();
+    }
+}
+
+template <typename T>
+void rocsolver_orgqr_ungqr_tsqr_getMemorySize(const rocblas_int m,
+                                              const rocblas_int n,
+                                              const rocblas_int batch_count,
+                                              size_t* size_W,
+                                              size_t* size_scratch)
+{
+    // if quick return no workspace needed
+    if(m == 0 || n == 0 || batch_count == 0)
+    {
+        *size_W = 0;
+        *size_scratch = 0;
+        return;
+    }
+
+    rocblas_int mb, nblocks;
+    rocsolver_tsqr_blocks(m, n, &mb, &nblocks);
+
+    // size of the matrix formed by the n-by-n blocks G_b
+    *size_W = sizeof(T) * nblocks * n * n * batch_count;
+
+    // size of the staging area for the rows of A if they do not fit in shared memory
+    if(n * sizeof(T) <= TSQR_LDS_SIZE)
+        *size_scratch = 0;
+    else
+        *size_scratch = sizeof(T) * BS2 * n * nblocks * batch_count;
+}
+
+/** ORGQR_TSQR_TEMPLATE generates the first n columns of the orthogonal matrix Q of a
+    tall-skinny QR factorization (see GEQRF_TSQR_TEMPLATE). The tree reflectors are first
+    applied to the nblocks*n-by-n matrix [I; 0; ...; 0] to obtain the blocks G_b, and then
+    every block of rows is overwritten by its own orthogonal factor times G_b. **/
+template <typename T, typename U>
+rocblas_status rocsolver_orgqr_ungqr_tsqr_template(rocblas_handle handle,
+                                                   const rocblas_int m,
+                                                   const rocblas_int n,
+                                                   U A,
+                                                   const rocblas_int shiftA,
+                                                   const rocblas_int lda,
+                                                   const rocblas_stride strideA,
+                                                   T* ipiv,
+                                                   const rocblas_stride strideP,
+                                                   const rocblas_int batch_count,
+                                                   T* W,
+                                                   T* scratch)
+{
+    ROCSOLVER_ENTER("orgqr_ungqr_tsqr", "m:", m, "n:", n, "shiftA:", shiftA, "lda:", lda,
+                    "bc:", batch_count);
+
+    // quick return
+    if(!n || !m || !batch_count)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int mb, nblocks;
+    rocsolver_tsqr_blocks(m, n, &mb, &nblocks);
+
+    const rocblas_int ldw = nblocks * n;
+    const rocblas_stride strideW = rocblas_stride(ldw) * n;
+
+    // G = Q_1 * ... * Q_L * [I; 0; ...; 0]
+    rocblas_int blocksx = (ldw - 1) / BS2 + 1;
+    rocblas_int blocksy = (n - 1) / BS2 + 1;
+    ROCSOLVER_LAUNCH_KERNEL(init_ident<T>, dim3(blocksx, blocksy, batch_count), dim3(BS2, BS2), 0,
+                            stream, ldw, n, W, 0, ldw, strideW);
+
+    rocblas_int levels = 0;
+    while((1 << levels) < nblocks)
+        levels++;
+
+    for(rocblas_int level = levels - 1; level >= 0; level--)
+    {
+        rocblas_int pairs = (nblocks - 1) / (2 << level) + 1;
+        ROCSOLVER_LAUNCH_KERNEL((tsqr_tree_apply<T>), dim3(pairs, batch_count, 1), dim3(BS1, 1, 1),
+                                0, stream, true, false, n, n, mb, nblocks, level, A, shiftA, lda,
+                                strideA, ipiv, strideP, n, W, 0, ldw, strideW);
+    }
+
+    // overwrite the blocks of rows with their orthogonal factors
+    ROCSOLVER_LAUNCH_KERNEL((tsqr_leaf_generate<T>), dim3(nblocks, batch_count, 1),
+                            dim3(BS1, 1, 1), 0, stream, m, n, mb, nblocks, A, shiftA, lda, strideA,
+                            ipiv, strideP);
+
+    // Q = Q_0 * G
+    rocblas_int R;
+    size_t lmemsize;
+    if(scratch)
+    {
+        R = BS2;
+        lmemsize = 0;
+    }
+    else
+    {
+        R = std::min(BS2, rocblas_int(TSQR_LDS_SIZE / (n * sizeof(T))));
+        lmemsize = sizeof(T) * R * n;
+    }
+    ROCSOLVER_LAUNCH_KERNEL((tsqr_leaf_multiply<T>), dim3(nblocks, batch_count, 1),
+                            dim3(BS1, 1, 1), lmemsize, stream, m, n, mb, nblocks, R, A, shiftA,
+                            lda, strideA, W, ldw, strideW, scratch);
+
+    return rocblas_status_success;
+}
@@ -37,12 +37,12 @@
 #include "rocblas.hpp"
 #include "rocsolver/rocsolver.h"
 
-template <bool BATCHED, typename T>
+template <bool BATCHED, typename T, typename I>
 void rocsolver_orm2r_unm2r_getMemorySize(const rocblas_side side,
-                                         const rocblas_int m,
-                                         const rocblas_int n,
-                                         const rocblas_int k,
-                                         const rocblas_int batch_count,
+                                         const I m,
+                                         const I n,
+                                         const I k,
+                                         const I batch_count,
                                          size_t* size_scalars,
                                          size_t* size_Abyx,
                                          size_t* size_diag,
@@ -62,19 +62,21 @@ void rocsolver_orm2r_unm2r_getMemorySize(const rocblas_side side,
     *size_diag = sizeof(T) * batch_count;
 
     // extra memory requirements for calling LARF
-    rocsolver_larf_getMemorySize<BATCHED, T>(side, m, n, batch_count, size_scalars, size_Abyx,
+    // (from the left, the reflectors are applied to strips of at most w columns)
+    const I w = (side == rocblas_side_left ? rocsolver_column_strip(n, m) : n);
+    rocsolver_larf_getMemorySize<BATCHED, T>(side, m, w, batch_count, size_scalars, size_Abyx,
                                              size_workArr);
 }
 
-template <bool COMPLEX, typename T, typename U>
+template <bool COMPLEX, typename T, typename I, typename U>
 rocblas_status rocsolver_orm2r_ormqr_argCheck(rocblas_handle handle,
                                               const rocblas_side side,
                                               const rocblas_operation trans,
-                                              const rocblas_int m,
-                                              const rocblas_int n,
-                                              const rocblas_int k,
-                                              const rocblas_int lda,
-                                              const rocblas_int ldc,
+                                              const I m,
+                                              const I n,
+                                              const I k,
+                                              const I lda,
+                                              const I ldc,
                                               T A,
                                               T C,
                                               U ipiv)
@@ -111,24 +113,24 @@ rocblas_status rocsolver_orm2r_ormqr_argCheck(rocblas_handle handle,
     return rocblas_status_continue;
 }
 
-template <typename T, typename U, bool COMPLEX = rocblas_is_complex<T>>
+template <typename T, typename I, typename U, bool COMPLEX = rocblas_is_complex<T>>
 rocblas_status rocsolver_orm2r_unm2r_template(rocblas_handle handle,
                                               const rocblas_side side,
                                               const rocblas_operation trans,
-                                              const rocblas_int m,
-                                              const rocblas_int n,
-                                              const rocblas_int k,
+                                              const I m,
+                                              const I n,
+                                              const I k,
                                               U A,
-                                              const rocblas_int shiftA,
-                                              const rocblas_int lda,
+                                              const rocblas_stride shiftA,
+                                              const I lda,
                                               const rocblas_stride strideA,
                                               T* ipiv,
                                               const rocblas_stride strideP,
                                               U C,
-                                              const rocblas_int shiftC,
-                                              const rocblas_int ldc,
+                                              const rocblas_stride shiftC,
+                                              const I ldc,
                                               const rocblas_stride strideC,
-                                              const rocblas_int batch_count,
+                                              const I batch_count,
                                               T* scalars,
                                               T* Abyx,
                                               T* diag,
@@ -148,7 +150,13 @@ rocblas_status rocsolver_orm2r_unm2r_template(rocblas_handle handle,
     // determine limits and indices
     bool left = (side == rocblas_side_left);
     bool transpose = (trans != rocblas_operation_none);
-    rocblas_int start, step, ncol, nrow, ic, jc;
+    I start, step, ncol, nrow, ic, jc;
+
+    // from the left, the reflectors are applied to strips of at most w columns of C; from the
+    // right, C must be addressable with 32-bit indices
+    const I w = rocsolver_column_strip(n, ldc);
+    if(!left && w < n)
+        return rocblas_status_not_implemented;
     if(left)
     {
         ncol = n;
@@ -184,8 +192,8 @@ rocblas_status rocsolver_orm2r_unm2r_template(rocblas_handle handle,
     if(COMPLEX && transpose)
         rocsolver_lacgv_template<T>(handle, k, ipiv, 0, 1, strideP, batch_count);
 
-    rocblas_int i;
-    for(rocblas_int j = 1; j <= k; ++j)
+    I i;
+    for(I j = 1; j <= k; ++j)
     {
         i = start + step * j; // current householder vector
         if(left)
@@ -205,9 +213,11 @@ rocblas_status rocsolver_orm2r_unm2r_template(rocblas_handle handle,
                                 diag, 0, 1, A, shiftA + idx2D(i, i, lda), lda, strideA, 1, true);
 
         // Apply current Householder reflector
-        rocsolver_larf_template(handle, side, nrow, ncol, A, shiftA + idx2D(i, i, lda), 1, strideA,
-                                (ipiv + i), strideP, C, shiftC + idx2D(ic, jc, ldc), ldc, strideC,
-                                batch_count, scalars, Abyx, workArr);
+        for(I c = 0; c < ncol; c += w)
+            rocsolver_larf_template(handle, side, nrow, std::min(ncol - c, w), A,
+                                    shiftA + idx2D(i, i, lda), 1, strideA, (ipiv + i), strideP, C,
+                                    shiftC + idx2D(ic, jc + c, ldc), ldc, strideC, batch_count,
+                                    scalars, Abyx, workArr);
 
         // restore original value of A(i,i)
         ROCSOLVER_LAUNCH_KERNEL(restore_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0, stream,
@@ -76,7 +76,7 @@ rocblas_status rocsolver_orml2_unml2_impl(rocblas_handle handle,
                                                   &size_Abyx, &size_diag, &size_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_Abyx, size_diag,
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_scalars, size_Abyx, size_diag,
                                                       size_workArr);
 
     // memory workspace allocation
@@ -27,18 +27,18 @@
 
 #include "rocauxiliary_ormqr_unmqr.hpp"
 
-template <typename T, bool COMPLEX = rocblas_is_complex<T>>
+template <typename T, typename I, bool COMPLEX = rocblas_is_complex<T>>
 rocblas_status rocsolver_ormqr_unmqr_impl(rocblas_handle handle,
                                           const rocblas_side side,
                                           const rocblas_operation trans,
-                                          const rocblas_int m,
-                                          const rocblas_int n,
-                                          const rocblas_int k,
+                                          const I m,
+                                          const I n,
+                                          const I k,
                                           T* A,
-                                          const rocblas_int lda,
+                                          const I lda,
                                           T* ipiv,
                                           T* C,
-                                          const rocblas_int ldc)
+                                          const I ldc)
 {
     const char* name = (!rocblas_is_complex<T> ? "ormqr" : "unmqr");
     ROCSOLVER_ENTER_TOP(name, "--side", side, "--trans", trans, "-m", m, "-n", n, "-k", k, "--lda",
@@ -54,14 +54,14 @@ rocblas_status rocsolver_ormqr_unmqr_impl(rocblas_handle handle,
         return st;
 
     // working with unshifted arrays
-    rocblas_int shiftA = 0;
-    rocblas_int shiftC = 0;
+    rocblas_stride shiftA = 0;
+    rocblas_stride shiftC = 0;
 
     // normal (non-batched non-strided) execution
     rocblas_stride strideA = 0;
     rocblas_stride strideP = 0;
     rocblas_stride strideC = 0;
-    rocblas_int batch_count = 1;
+    I batch_count = 1;
 
     // memory workspace sizes:
     // size for constants in rocblas calls
@@ -77,7 +77,7 @@ rocblas_status rocsolver_ormqr_unmqr_impl(rocblas_handle handle,
                                                   &size_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_AbyxORwork,
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_scalars, size_AbyxORwork,
                                                       size_diagORtmptr, size_trfact, size_workArr);
 
     // memory workspace allocation
@@ -171,4 +171,66 @@ rocblas_status rocsolver_zunmqr(rocblas_handle handle,
                                                               ipiv, C, ldc);
 }
 
+rocblas_status rocsolver_sormqr_64(rocblas_handle handle,
+                                   const rocblas_side side,
+                                   const rocblas_operation trans,
+                                   const int64_t m,
+                                   const int64_t n,
+                                   const int64_t k,
+                                   float* A,
+                                   const int64_t lda,
+                                   float* ipiv,
+                                   float* C,
+                                   const int64_t ldc)
+{
+    return rocsolver_ormqr_unmqr_impl<float>(handle, side, trans, m, n, k, A, lda, ipiv, C, ldc);
+}
+
+rocblas_status rocsolver_dormqr_64(rocblas_handle handle,
+                                   const rocblas_side side,
+                                   const rocblas_operation trans,
+                                   const int64_t m,
+                                   const int64_t n,
+                                   const int64_t k,
+                                   double* A,
+                                   const int64_t lda,
+                                   double* ipiv,
+                                   double* C,
+                                   const int64_t ldc)
+{
+    return rocsolver_ormqr_unmqr_impl<double>(handle, side, trans, m, n, k, A, lda, ipiv, C, ldc);
+}
+
+rocblas_status rocsolver_cunmqr_64(rocblas_handle handle,
+                                   const rocblas_side side,
+                                   const rocblas_operation trans,
+                                   const int64_t m,
+                                   const int64_t n,
+                                   const int64_t k,
+                                   rocblas_float_complex* A,
+                                   const int64_t lda,
+                                   rocblas_float_complex* ipiv,
+                                   rocblas_float_complex* C,
+                                   const int64_t ldc)
+{
+    return rocsolver_ormqr_unmqr_impl<rocblas_float_complex>(handle, side, trans, m, n, k, A, lda,
+                                                             ipiv, C, ldc);
+}
+
+rocblas_status rocsolver_zunmqr_64(rocblas_handle handle,
+                                   const rocblas_side side,
+                                   const rocblas_operation trans,
+                                   const int64_t m,
+                                   const int64_t n,
+                                   const int64_t k,
+                                   rocblas_double_complex* A,
+                                   const int64_t lda,
+                                   rocblas_double_complex* ipiv,
+                                   rocblas_double_complex* C,
+                                   const int64_t ldc)
+{
+    return rocsolver_ormqr_unmqr_impl<rocblas_double_complex>(handle, side, trans, m, n, k, A, lda,
+                                                              ipiv, C, ldc);
+}
+
 } // extern C
@@ -38,12 +38,12 @@
 #include "rocblas.hpp"
 #include "rocsolver/rocsolver.h"
 
-template <bool BATCHED, typename T>
+template <bool BATCHED, typename T, typename I>
 void rocsolver_ormqr_unmqr_getMemorySize(const rocblas_side side,
-                                         const rocblas_int m,
-                                         const rocblas_int n,
-                                         const rocblas_int k,
-                                         const rocblas_int batch_count,
+                                         const I m,
+                                         const I n,
+                                         const I k,
+                                         const I batch_count,
                                          size_t* size_scalars,
                                          size_t* size_AbyxORwork,
                                          size_t* size_diagORtmptr,
@@ -65,17 +65,23 @@ void rocsolver_ormqr_unmqr_getMemorySize(const rocblas_side side,
     rocsolver_orm2r_unm2r_getMemorySize<BATCHED, T>(side, m, n, k, batch_count, size_scalars,
                                                     size_AbyxORwork, size_diagORtmptr, size_workArr);
 
-    if(k > xxMQx_BLOCKSIZE)
+    // if C cannot be addressed with 32-bit indices, it is updated from the left in strips of
+    // at most w columns, and from the right with block reflectors (as ldc is not known here,
+    // the 64-bit APIs always reserve the workspace of the block reflectors from the right)
+    const bool left = (side == rocblas_side_left);
+    const I w = rocsolver_column_strip(n, m);
+
+    if(k > xxMQx_BLOCKSIZE || (!left && std::is_same<I, int64_t>::value))
     {
-        rocblas_int jb = xxMQx_BLOCKSIZE;
+        I jb = xxMQx_BLOCKSIZE;
 
         // requirements for calling larft
         rocsolver_larft_getMemorySize<BATCHED, T>(std::max(m, n), std::min(jb, k), batch_count,
                                                   &unused, size_AbyxORwork, &unused);
 
         // requirements for calling larfb
-        rocsolver_larfb_getMemorySize<BATCHED, T>(side, m, n, std::min(jb, k), batch_count,
-                                                  size_diagORtmptr, &unused);
+        rocsolver_larfb_getMemorySize<BATCHED, T>(side, m, (left ? w : n), std::min(jb, k),
+                                                  batch_count, size_diagORtmptr, &unused);
 
         // size of temporary array for triangular factor
         *size_trfact = sizeof(T) * jb * jb * batch_count;
@@ -84,24 +90,24 @@ void rocsolver_ormqr_unmqr_getMemorySize(const rocblas_side side,
         *size_trfact = 0;
 }
 
-template <bool BATCHED, bool STRIDED, typename T, typename U>
+template <bool BATCHED, bool STRIDED, typename T, typename I, typename U>
 rocblas_status rocsolver_ormqr_unmqr_template(rocblas_handle handle,
                                               const rocblas_side side,
                                               const rocblas_operation trans,
-                                              const rocblas_int m,
-                                              const rocblas_int n,
-                                              const rocblas_int k,
+                                              const I m,
+                                              const I n,
+                                              const I k,
                                               U A,
-                                              const rocblas_int shiftA,
-                                              const rocblas_int lda,
+                                              const rocblas_stride shiftA,
+                                              const I lda,
                                               const rocblas_stride strideA,
                                               T* ipiv,
                                               const rocblas_stride strideP,
                                               U C,
-                                              const rocblas_int shiftC,
-                                              const rocblas_int ldc,
+                                              const rocblas_stride shiftC,
+                                              const I ldc,
                                               const rocblas_stride strideC,
-                                              const rocblas_int batch_count,
+                                              const I batch_count,
                                               T* scalars,
                                               T* AbyxORwork,
                                               T* diagORtmptr,
@@ -120,19 +126,37 @@ rocblas_status rocsolver_ormqr_unmqr_template(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
+    // the 32-bit interface of rocBLAS requires the leading dimensions and the batch size to
+    // fit in rocblas_int
+    if(std::is_same<I, int64_t>::value
+       && (lda >= INT_MAX || ldc >= INT_MAX || batch_count >= INT_MAX))
+        return rocblas_status_not_implemented;
+
+    // determine limits and indices
+    bool left = (side == rocblas_side_left);
+    bool transpose = (trans != rocblas_operation_none);
+    I start, step, nq, ncol, nrow, ic, jc;
+
+    // every rocBLAS call must be addressable with 32-bit indices: the block reflectors are
+    // applied to strips of at most wC columns of C, and blocks of Householder vectors must fit
+    // in wA columns of A (wC = n and wA = k if the whole matrices fit)
+    const I wC = rocsolver_column_strip(n, ldc);
+    const I wA = rocsolver_column_strip(k, lda);
+    const I jb = std::min(k, I(xxMQx_BLOCKSIZE));
+    const bool blocked_fits = (wA >= jb && (left || wC >= jb));
+
     // if the matrix is small, use the unblocked variant of the algorithm
-    if(k <= xxMQx_BLOCKSIZE)
+    // (it is also used if the blocks do not fit in the strips, which is only supported from the
+    // left)
+    if((k <= xxMQx_BLOCKSIZE && (left || wC == n)) || (left && !blocked_fits))
         return rocsolver_orm2r_unm2r_template<T>(
             handle, side, trans, m, n, k, A, shiftA, lda, strideA, ipiv, strideP, C, shiftC, ldc,
             strideC, batch_count, scalars, AbyxORwork, diagORtmptr, workArr);
+    if(!blocked_fits)
+        return rocblas_status_not_implemented;
 
-    rocblas_int ldw = xxMQx_BLOCKSIZE;
+    I ldw = xxMQx_BLOCKSIZE;
     rocblas_stride strideW = rocblas_stride(ldw) * ldw;
-
-    // determine limits and indices
-    bool left = (side == rocblas_side_left);
-    bool transpose = (trans != rocblas_operation_none);
-    rocblas_int start, step, nq, ncol, nrow, ic, jc;
     if(left)
     {
         nq = m;
@@ -166,8 +190,8 @@ rocblas_status rocsolver_ormqr_unmqr_template(rocblas_handle handle,
         }
     }
 
-    rocblas_int i, ib;
-    for(rocblas_int j = 0; j < k; j += ldw)
+    I i, ib;
+    for(I j = 0; j < k; j += ldw)
     {
         i = start + step * j; // current householder block
         ib = std::min(ldw, k - i);
@@ -188,10 +212,21 @@ rocblas_status rocsolver_ormqr_unmqr_template(rocblas_handle handle,
                                     trfact, ldw, strideW, batch_count, scalars, AbyxORwork, workArr);
 
         // apply current block reflector
-        rocsolver_larfb_template<BATCHED, STRIDED, T>(
-            handle, side, trans, rocblas_forward_direction, rocblas_column_wise, nrow, ncol, ib, A,
-            shiftA + idx2D(i, i, lda), lda, strideA, trfact, 0, ldw, strideW, C,
-            shiftC + idx2D(ic, jc, ldc), ldc, strideC, batch_count, diagORtmptr, workArr);
+        // (from the left, in strips of at most wC columns)
+        if(left)
+        {
+            for(I c = 0; c < ncol; c += wC)
+                rocsolver_larfb_template<BATCHED, STRIDED, T>(
+                    handle, side, trans, rocblas_forward_direction, rocblas_column_wise, nrow,
+                    std::min(ncol - c, wC), ib, A, shiftA + idx2D(i, i, lda), lda, strideA, trfact,
+                    0, ldw, strideW, C, shiftC + idx2D(ic, jc + c, ldc), ldc, strideC,
+                    batch_count, diagORtmptr, workArr);
+        }
+        else
+            rocsolver_larfb_template<BATCHED, STRIDED, T>(
+                handle, side, trans, rocblas_forward_direction, rocblas_column_wise, nrow, ncol,
+                ib, A, shiftA + idx2D(i, i, lda), lda, strideA, trfact, 0, ldw, strideW, C,
+                shiftC + idx2D(ic, jc, ldc), ldc, strideC, batch_count, diagORtmptr, workArr, wC);
     }
 
     return rocblas_status_success;
@@ -0,0 +1,237 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+
+#pragma once
+
+#include "../lapack/roclapack_geqrf_tsqr.hpp"
+#include "rocauxiliary_orm2r_unm2r.hpp"
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+/** TSQR_LEAF_APPLY applies the reflectors of the factorizations of the blocks of rows
+    (as returned by GEQRF_TSQR) to the matrix C. If left is true, the orthogonal matrix
+    multiplies C from the left and each column of C is a vector to update; otherwise, it
+    multiplies C from the right and each row of C is a vector to update.
+    There is a thread-block per vector of C and block of rows. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) tsqr_leaf_apply(const bool left,
+                                                             const bool trans,
+                                                             const rocblas_int mq,
+                                                             const rocblas_int k,
+                                                             const rocblas_int mb,
+                                                             const rocblas_int nblocks,
+                                                             U A,
+                                                             const rocblas_int shiftA,
+                                                             const rocblas_int lda,
+                                                             const rocblas_stride strideA,
+                                                             T* ipiv,
+                                                             const rocblas_stride strideP,
+                                                             U C,
+                                                             const rocblas_int shiftC,
+                                                             const rocblas_int ldc,
+                                                             const rocblas_stride strideC)
+{
+    const rocblas_int bid = hipBlockIdx_z;
+    const rocblas_int blk = hipBlockIdx_y;
+    const rocblas_int vec = hipBlockIdx_x;
+    const rocblas_int tid = hipThreadIdx_x;
+    const rocblas_int rows = (blk == nblocks - 1) ? mq - blk * mb : mb;
+
+    __shared__ T sdot[BS1];
+
+    // distance between consecutive elements of the vector of C
+    const rocblas_stride incc = left ? 1 : ldc;
+    const rocblas_stride incv = left ? ldc : 1;
+
+    T* a = load_ptr_batch<T>(A, bid, shiftA, strideA) + blk * mb;
+    T* c = load_ptr_batch<T>(C, bid, shiftC, strideC) + vec * incv + blk * mb * incc;
+    T* tau = ipiv + bid * strideP + blk * k;
+
+    // Q' from the left and Q from the right are applied as H(0), H(1), ..., H(k-1)
+    const bool forward = (left == trans);
+
+    for(rocblas_int jj = 0; jj < k; jj++)
+    {
+        const rocblas_int j = forward ? jj : k - 1 - jj;
+        const T t = trans ? conj(tau[j]) : tau[j];
+
+        T d = (tid == 0) ? c[j * incc] : T(0);
+        for(rocblas_int i = j + 1 + tid; i < rows; i += BS1)
+            d += (left ? conj(a[i + j * lda]) : a[i + j * lda]) * c[i * incc];
+        d = block_sum<BS1>(tid, d, sdot) * t;
+
+        if(tid == 0)
+            c[j * incc] -= d;
+        for(rocblas_int i = j + 1 + tid; i < rows; i += BS1)
+            c[i * incc] -= (left ? a[i + j * lda] : conj(a[i + j * lda])) * d;
+        __syncthreads();
+    }
+}
+
+/** TSQR_TREE_APPLY applies the reflectors that combine the triangular factors of a pair
+    of blocks at the given level of the tree (as returned by GEQRF_TSQR) to the matrix C.
+    The blocks of C start every mbc rows (or columns, if left is false), and only their first
+    k rows (or columns) are updated. There is a thread-block per pair of blocks; every thread
+    updates a different vector of C. **/
+template <typename T, typename U, typename V>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) tsqr_tree_apply(const bool left,
+                                                             const bool trans,
+                                                             const rocblas_int nv,
+                                                             const rocblas_int k,
+                                                             const rocblas_int mb,
+                                                             const rocblas_int nblocks,
+                                                             const rocblas_int level,
+                                                             U A,
+                                                             const rocblas_int shiftA,
+                                                             const rocblas_int lda,
+                                                             const rocblas_stride strideA,
+                                                             T* ipiv,
+                                                             const rocblas_stride strideP,
+                                                             const rocblas_int mbc,
+                                                             V C,
+                                                             const rocblas_int shiftC,
+                                                             const rocblas_int ldc,
+                                                             const rocblas_stride strideC)
+{
+    const rocblas_int bid = hipBlockIdx_y;
+    const rocblas_int tid = hipThreadIdx_x;
+    const rocblas_int top = hipBlockIdx_x << (level + 1);
+    const rocblas_int bot = top + (1 << level);
+
+    if(bot >= nblocks)
+        return;
+
+    const rocblas_stride incc = left ? 1 : ldc;
+    const rocblas_stride incv = left ? ldc : 1;
+
+    T* v = load_ptr_batch<T>(A, bid, shiftA, strideA) + bot * mb;
+    T* c = load_ptr_batch<T>(C, bid, shiftC, strideC);
+    T* tau = ipiv + bid * strideP + (nblocks + bot) * k;
+
+    const bool forward = (left == trans);
+
+    for(rocblas_int vec = tid; vec < nv; vec += BS1)
+    {
+        T* x1 = c + vec * incv + top * mbc * incc;
+        T* x2 = c + vec * incv + bot * mbc * incc;
+
+        for(rocblas_int jj = 0; jj < k; jj++)
+        {
+            const rocblas_int j = forward ? jj : k - 1 - jj;
+            const T t = trans ? conj(tau[j]) : tau[j];
+
+            // the reflector is e_j in the first block, and has only j+1 nonzero
+            // elements in the second block
+            T d = x1[j * incc];
+            for(rocblas_int i = 0; i <= j; i++)
+                d += (left ? conj(v[i + j * lda]) : v[i + j * lda]) * x2[i * incc];
+            d *= t;
+
+            x1[j * incc] -= d;
+            for(rocblas_int i = 0; i <= j; i++)
+                x2[i * incc] -= (left ? v[i + j * lda] : conj(v[i + j * lda])) * d;
+        }
+    }
+}
+
+/** ORMQR_TSQR_TEMPLATE multiplies C by the orthogonal matrix Q of a tall-skinny QR
+    factorization (see GEQRF_TSQR_TEMPLATE). Q = Q_0 * Q_1 * ... * Q_L, where Q_0 is the
+    block-diagonal matrix formed by the orthogonal factors of the blocks of rows, and
+    Q_l, l > 0, contains the reflectors of level l-1 of the tree. No workspace is needed. **/
+template <typename T, typename U>
+rocblas_status rocsolver_ormqr_unmqr_tsqr_template(rocblas_handle handle,
+                                                   const rocblas_side side,
+                                                   const rocblas_operation trans,
+                                                   const rocblas_int m,
+                                                   const rocblas_int n,
+                                                   const rocblas_int k,
+                                                   U A,
+                                                   const rocblas_int shiftA,
+                                                   const rocblas_int lda,
+                                                   const rocblas_stride strideA,
+                                                   T* ipiv,
+                                                   const rocblas_stride strideP,
+                                                   U C,
+                                                   const rocblas_int shiftC,
+                                                   const rocblas_int ldc,
+                                                   const rocblas_stride strideC,
+                                                   const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("ormqr_unmqr_tsqr", "side:", side, "trans:", trans, "m:", m, "n:", n, "k:", k,
+                    "shiftA:", shiftA, "lda:", lda, "shiftC:", shiftC, "ldc:", ldc,
+                    "bc:", batch_count);
+
+    // quick return
+    if(!n || !m || !k || !batch_count)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    const bool left = (side == rocblas_side_left);
+    const bool tr = (trans != rocblas_operation_none);
+
+    // order of Q and number of vectors of C to update
+    const rocblas_int mq = left ? m : n;
+    const rocblas_int nv = left ? n : m;
+
+    rocblas_int mb, nblocks;
+    rocsolver_tsqr_blocks(mq, k, &mb, &nblocks);
+
+    rocblas_int levels = 0;
+    while((1 << levels) < nblocks)
+        levels++;
+
+    dim3 gridLeaf(nv, nblocks, batch_count);
+    dim3 threads(BS1, 1, 1);
+
+    // Q' from the left and Q from the right start with the blocks of rows
+    const bool forward = (left == tr);
+
+    if(forward)
+        ROCSOLVER_LAUNCH_KERNEL((tsqr_leaf_apply<T>), gridLeaf, threads, 0, stream, left, tr, mq,
+                                k, mb, nblocks, A, shiftA, lda, strideA, ipiv, strideP, C, shiftC,
+                                ldc, strideC);
+
+    for(rocblas_int l = 0; l < levels; l++)
+    {
+        rocblas_int level = forward ? l : levels - 1 - l;
+        rocblas_int pairs = (nblocks - 1) / (2 << level) + 1;
+
+        ROCSOLVER_LAUNCH_KERNEL((tsqr_tree_apply<T>), dim3(pairs, batch_count, 1), threads, 0,
+                                stream, left, tr, nv, k, mb, nblocks, level, A, shiftA, lda,
+                                strideA, ipiv, strideP, mb, C, shiftC, ldc, strideC);
+    }
+
+    if(!forward)
+        ROCSOLVER_LAUNCH_KERNEL((tsqr_leaf_apply<T>), gridLeaf, threads, 0, stream, left, tr, mq,
+                                k, mb, nblocks, A, shiftA, lda, strideA, ipiv, strideP, C, shiftC,
+                                ldc, strideC);
+
+    return rocblas_status_success;
+}
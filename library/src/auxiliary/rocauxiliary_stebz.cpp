@@ -76,7 +76,7 @@ rocblas_status rocsolver_stebz_impl(rocblas_handle handle,
                                      &size_bounds, &size_inter, &size_ninter);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_work, size_pivmin, size_Esqr,
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_work, size_pivmin, size_Esqr,
                                                       size_bounds, size_inter, size_ninter);
 
     // memory workspace allocation
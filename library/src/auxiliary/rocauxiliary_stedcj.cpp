@@ -81,7 +81,7 @@ rocblas_status rocsolver_stedcj_impl(rocblas_handle handle,
                                                 &size_splits_map, &size_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_work_stack, size_tempvect,
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_work_stack, size_tempvect,
                                                       size_tempgemm, size_tmpz, size_splits_map,
                                                       size_workArr);
 
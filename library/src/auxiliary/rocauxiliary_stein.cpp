@@ -74,7 +74,7 @@ rocblas_status rocsolver_stein_impl(rocblas_handle handle,
     rocsolver_stein_getMemorySize<T, S>(n, batch_count, &size_work, &size_iwork);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_work, size_iwork);
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_work, size_iwork);
 
     // memory workspace allocation
     void *work, *iwork;
@@ -64,7 +64,7 @@ rocblas_status rocsolver_steqr_impl(rocblas_handle handle,
     rocsolver_steqr_getMemorySize<T, S>(evect, n, batch_count, &size_work_stack);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_work_stack);
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_work_stack);
 
     // memory workspace allocation
     void* work_stack;
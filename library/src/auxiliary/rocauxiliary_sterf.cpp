@@ -56,7 +56,7 @@ rocblas_status
     rocsolver_sterf_getMemorySize<T>(n, batch_count, &size_stack);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_stack);
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_stack);
 
     // memory workspace allocation
     void* stack;
@@ -0,0 +1,609 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+#include "rocblas_utility.hpp"
+#include "rocsolver_handle_state.hpp"
+
+// initialize the static variables
+std::mutex rocsolver_handle_state_map::_mutex;
+rocsolver_handle_state_map::state_map rocsolver_handle_state_map::_states;
+std::unordered_map<int, rocsolver_arch_info> rocsolver_handle_state_map::_devices;
+
+/***************************************************************************
+ * Handle entries
+ ***************************************************************************/
+
+// returns the device that is current for the calling thread, or -1 if it cannot be queried
+static int rocsolver_current_device()
+{
+    int device;
+    if(hipGetDevice(&device) != hipSuccess)
+        return -1;
+    return device;
+}
+
+rocsolver_handle_state_map::state_map::iterator
+    rocsolver_handle_state_map::find(rocblas_handle handle)
+{
+    auto it = _states.find(handle);
+    if(it == _states.end() || it->second.device == rocsolver_current_device())
+        return it;
+
+    // rocBLAS handles are bound to the device that is current when they are created, so
+    // this entry belongs to a handle that was destroyed without releasing its resources
+    destroy_pool(it->second.pool);
+    _states.erase(it);
+    return _states.end();
+}
+
+rocsolver_handle_state_map::state_map::iterator
+    rocsolver_handle_state_map::find_or_create(rocblas_handle handle)
+{
+    auto it = find(handle);
+    if(it == _states.end())
+    {
+        it = _states.emplace(handle, rocsolver_handle_state()).first;
+        it->second.device = rocsolver_current_device();
+    }
+    return it;
+}
+
+/***************************************************************************
+ * Architecture description
+ ***************************************************************************/
+
+// description used when the device properties cannot be queried
+static rocsolver_arch_info rocsolver_default_arch()
+{
+    rocsolver_arch_info arch = {};
+    std::strncpy(arch.name, "unknown", sizeof(arch.name) - 1);
+    arch.wavefront_size = 64;
+    arch.lds_size = 64 * 1024;
+    arch.cu_count = 1;
+    arch.flags = rocsolver_arch_flag_none;
+    return arch;
+}
+
+// queries the properties of the given device and parses its architecture name
+// (e.g. "gfx90a:sramecc+:xnack-")
+static rocsolver_arch_info rocsolver_query_arch(int device)
+{
+    rocsolver_arch_info arch = rocsolver_default_arch();
+
+    hipDeviceProp_t props;
+    if(hipGetDeviceProperties(&props, device) != hipSuccess)
+        return arch;
+
+    std::string full(props.gcnArchName);
+    std::string name = full.substr(0, full.find(":"));
+    std::strncpy(arch.name, name.c_str(), sizeof(arch.name) - 1);
+    arch.wavefront_size = props.warpSize;
+    arch.lds_size = int(props.sharedMemPerBlock);
+    arch.cu_count = props.multiProcessorCount;
+
+    if(full.find("xnack+") != std::string::npos)
+        arch.flags |= rocsolver_arch_flag_xnack;
+    if(full.find("sramecc+") != std::string::npos)
+        arch.flags |= rocsolver_arch_flag_sramecc;
+
+    // TODO: Some architectures require synchronization between rocSOLVER and rocBLAS kernels;
+    // more investigation needed
+    if(name.find("gfx940") != std::string::npos || name.find("gfx941") != std::string::npos)
+        arch.flags |= rocsolver_arch_flag_blas_sync;
+
+    return arch;
+}
+
+rocsolver_arch_info rocsolver_handle_state_map::get_arch(rocblas_handle handle)
+{
+    const std::lock_guard<std::mutex> lock(_mutex);
+    auto state = find(handle);
+    if(state != _states.end() && state->second.has_arch)
+        return state->second.arch;
+
+    // rocBLAS handles are bound to the device that is current when they are created
+    // (the description is cached per device, so that no state is created for the handle)
+    int device = 0;
+    if(hipGetDevice(&device) != hipSuccess)
+        return rocsolver_default_arch();
+
+    auto it = _devices.find(device);
+    if(it == _devices.end())
+        it = _devices.emplace(device, rocsolver_query_arch(device)).first;
+
+    return it->second;
+}
+
+void rocsolver_handle_state_map::set_arch(rocblas_handle handle, const rocsolver_arch_info* info)
+{
+    update(handle, [&](rocsolver_handle_state& state) {
+        state.has_arch = (info != nullptr);
+        if(info)
+            state.arch = *info;
+    });
+}
+
+/***************************************************************************
+ * Workspace budget and breakdown
+ ***************************************************************************/
+
+size_t rocsolver_handle_state_map::workspace_budget(rocblas_handle handle)
+{
+    size_t budget = 0;
+    {
+        const std::lock_guard<std::mutex> lock(_mutex);
+        auto it = find(handle);
+        if(it != _states.end())
+            budget = it->second.workspace_budget;
+    }
+
+    // memory set by the user (or a user-owned workspace) cannot grow
+    if(budget > 0 && !rocblas_is_managing_device_memory(handle))
+    {
+        size_t size;
+        if(rocblas_get_device_memory_size(handle, &size) == rocblas_status_success)
+            budget = std::min(budget, size);
+    }
+
+    return budget;
+}
+
+void rocsolver_handle_state_map::get_breakdown(rocblas_handle handle,
+                                               rocsolver_workspace_node* nodes,
+                                               rocblas_int* count)
+{
+    const std::lock_guard<std::mutex> lock(_mutex);
+    auto it = find(handle);
+    size_t available = (it != _states.end() ? it->second.breakdown.size() : 0);
+
+    if(!nodes)
+    {
+        *count = rocblas_int(available);
+        return;
+    }
+
+    size_t copied = std::min(available, size_t(std::max(*count, 0)));
+    for(size_t i = 0; i < copied; ++i)
+        nodes[i] = it->second.breakdown[i];
+    *count = rocblas_int(copied);
+}
+
+bool rocsolver_handle_state_map::is_device_array(const void* ptr)
+{
+    hipPointerAttribute_t attr;
+    if(hipPointerGetAttributes(&attr, ptr) != hipSuccess)
+    {
+        // clear the error, so that it is not reported by later HIP calls
+        (void)hipGetLastError();
+        return false;
+    }
+    return attr.type == hipMemoryTypeDevice || attr.type == hipMemoryTypeManaged;
+}
+
+/***************************************************************************
+ * Stream pool management
+ ***************************************************************************/
+
+rocblas_status rocsolver_handle_state_map::grow_pool(rocsolver_stream_pool& pool, int count)
+{
+    // create missing events (one per stream plus one for the handle's stream)
+    while(pool.events.size() < size_t(count + 1))
+    {
+        hipEvent_t event;
+        if(hipEventCreateWithFlags(&event, hipEventDisableTiming) != hipSuccess)
+            return rocblas_status_internal_error;
+        pool.events.push_back(event);
+    }
+
+    // create missing streams
+    while(pool.streams.size() < size_t(count))
+    {
+        hipStream_t stream;
+        if(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking) != hipSuccess)
+            return rocblas_status_internal_error;
+        pool.streams.push_back(stream);
+    }
+
+    return rocblas_status_success;
+}
+
+rocblas_status rocsolver_handle_state_map::destroy_pool(rocsolver_stream_pool& pool)
+{
+    rocblas_status status = rocblas_status_success;
+
+    for(hipStream_t stream : pool.streams)
+    {
+        if(hipStreamSynchronize(stream) != hipSuccess || hipStreamDestroy(stream) != hipSuccess)
+            status = rocblas_status_internal_error;
+    }
+    for(hipEvent_t event : pool.events)
+    {
+        if(hipEventDestroy(event) != hipSuccess)
+            status = rocblas_status_internal_error;
+    }
+
+    pool.streams.clear();
+    pool.events.clear();
+    return status;
+}
+
+rocblas_status rocsolver_handle_state_map::get_streams(rocblas_handle handle,
+                                                       int count,
+                                                       hipStream_t* streams,
+                                                       hipEvent_t* events)
+{
+    const std::lock_guard<std::mutex> lock(_mutex);
+    rocsolver_stream_pool& pool = find_or_create(handle)->second.pool;
+
+    rocblas_status status = grow_pool(pool, count);
+    if(status != rocblas_status_success)
+        return status;
+
+    for(int i = 0; i < count; ++i)
+        streams[i] = pool.streams[i];
+    for(int i = 0; i <= count; ++i)
+        events[i] = pool.events[i];
+
+    return rocblas_status_success;
+}
+
+rocblas_status rocsolver_handle_state_map::release(rocblas_handle handle)
+{
+    const std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _states.find(handle);
+    if(it == _states.end())
+        return rocblas_status_success;
+
+    rocblas_status status = destroy_pool(it->second.pool);
+    _states.erase(it);
+    return status;
+}
+
+/***************************************************************************
+ * Handle configuration
+ ***************************************************************************/
+
+extern "C" {
+
+rocblas_status rocsolver_set_lookahead(rocblas_handle handle, const bool enable)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    rocsolver_handle_state_map::set_lookahead(handle, enable);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocsolver_get_lookahead(rocblas_handle handle, bool* enable)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!enable)
+        return rocblas_status_invalid_pointer;
+
+    *enable = rocsolver_handle_state_map::lookahead_enabled(handle);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocsolver_set_workspace_budget(rocblas_handle handle, const size_t size)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    rocsolver_handle_state_map::set_workspace_budget(handle, size);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocsolver_get_workspace_budget(rocblas_handle handle, size_t* size)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!size)
+        return rocblas_status_invalid_pointer;
+
+    rocsolver_handle_state_map::get_workspace_budget(handle, size);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocsolver_set_info_summary(rocblas_handle handle, rocblas_int* summary)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(summary && !rocsolver_handle_state_map::is_device_array(summary))
+        return rocblas_status_invalid_pointer;
+
+    rocsolver_handle_state_map::set_info_summary(handle, summary);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocsolver_get_info_summary(rocblas_handle handle, rocblas_int** summary)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!summary)
+        return rocblas_status_invalid_pointer;
+
+    *summary = rocsolver_handle_state_map::info_summary(handle);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocsolver_set_early_abort(rocblas_handle handle, const bool enable)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    rocsolver_handle_state_map::set_early_abort(handle, enable);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocsolver_get_early_abort(rocblas_handle handle, bool* enable)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!enable)
+        return rocblas_status_invalid_pointer;
+
+    *enable = rocsolver_handle_state_map::early_abort_enabled(handle);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocsolver_set_batch_streams(rocblas_handle handle, const rocblas_int count)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(count < 0)
+        return rocblas_status_invalid_size;
+
+    rocsolver_handle_state_map::set_batch_streams(handle, count);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocsolver_get_batch_streams(rocblas_handle handle, rocblas_int* count)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!count)
+        return rocblas_status_invalid_pointer;
+
+    *count = rocsolver_handle_state_map::batch_streams(handle);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocsolver_set_capture_safe(rocblas_handle handle, const bool enable)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // the synchronizations required by some architectures cannot be avoided
+    if(enable
+       && (rocsolver_handle_state_map::get_arch(handle).flags & rocsolver_arch_flag_blas_sync))
+        return rocblas_status_arch_mismatch;
+
+    rocsolver_handle_state_map::set_capture_safe(handle, enable);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocsolver_get_capture_safe(rocblas_handle handle, bool* enable)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!enable)
+        return rocblas_status_invalid_pointer;
+
+    *enable = rocsolver_handle_state_map::capture_safe_enabled(handle);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocsolver_set_alg_mode(rocblas_handle handle,
+                                      const rocsolver_function func,
+                                      const rocsolver_alg_mode mode)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(func != rocsolver_function_getrf && func != rocsolver_function_geqrf
+       && func != rocsolver_function_potrf)
+        return rocblas_status_invalid_value;
+    if(mode != rocsolver_alg_mode_default && mode != rocsolver_alg_mode_recursive
+       && (mode != rocsolver_alg_mode_persistent || func != rocsolver_function_potrf))
+        return rocblas_status_invalid_value;
+
+    rocsolver_handle_state_map::set_alg_mode(handle, func, mode);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocsolver_get_alg_mode(rocblas_handle handle,
+                                      const rocsolver_function func,
+                                      rocsolver_alg_mode* mode)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(func != rocsolver_function_getrf && func != rocsolver_function_geqrf
+       && func != rocsolver_function_potrf)
+        return rocblas_status_invalid_value;
+    if(!mode)
+        return rocblas_status_invalid_pointer;
+
+    *mode = rocsolver_handle_state_map::alg_mode(handle, func);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocsolver_get_workspace_breakdown(rocblas_handle handle,
+                                                 rocsolver_workspace_node* nodes,
+                                                 rocblas_int* count)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!count)
+        return rocblas_status_invalid_pointer;
+    if(nodes && *count < 0)
+        return rocblas_status_invalid_size;
+
+    rocsolver_handle_state_map::get_breakdown(handle, nodes, count);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocsolver_clear_workspace_breakdown(rocblas_handle handle)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    rocsolver_handle_state_map::clear_breakdown(handle);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocsolver_get_arch_info(rocblas_handle handle, rocsolver_arch_info* info)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!info)
+        return rocblas_status_invalid_pointer;
+
+    *info = rocsolver_handle_state_map::get_arch(handle);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocsolver_set_arch_info(rocblas_handle handle, const rocsolver_arch_info* info)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(info && (info->wavefront_size <= 0 || info->lds_size <= 0 || info->cu_count <= 0))
+        return rocblas_status_invalid_value;
+    if(info && (info->flags & rocsolver_arch_flag_blas_sync)
+       && rocsolver_handle_state_map::capture_safe_enabled(handle))
+        return rocblas_status_arch_mismatch;
+
+    rocsolver_handle_state_map::set_arch(handle, info);
+    return rocblas_status_success;
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+
+rocblas_status rocsolver_release_handle_resources(rocblas_handle handle)
+try
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    return rocsolver_handle_state_map::release(handle);
+}
+catch(...)
+{
+    return exception_to_rocblas_status();
+}
+}
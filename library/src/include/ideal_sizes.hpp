@@ -51,6 +51,62 @@
 #define GEQxF_GEQx2_SWITCHSIZE 128
 #endif
 
+/*! \brief Determines whether the block columns in GEQRF are factorized with the recursive
+    algorithm (if different from 0) or with the unblocked algorithm (if equal to 0). It also applies to the
+    corresponding batched and strided-batched routines.
+
+    \details With the recursive algorithm, the columns of a block are split in halves until the resulting
+    sub-blocks have no more than GEQRF_RECURSIVE_PANEL_MINSIZE columns; these are then factorized with the
+    unblocked algorithm (GEQR2), and the block reflectors of the left halves are applied to the right halves
+    with LARFT and LARFB.
+
+    When equal to 0, the recursive algorithm can still be selected at run time for a given handle
+    with rocsolver_set_alg_mode and rocsolver_function_geqrf.*/
+#ifndef GEQRF_RECURSIVE_PANEL
+#define GEQRF_RECURSIVE_PANEL 0
+#endif
+
+/*! \brief Determines the size of the base case of the recursive block column factorization in GEQRF.*/
+#ifndef GEQRF_RECURSIVE_PANEL_MINSIZE
+#define GEQRF_RECURSIVE_PANEL_MINSIZE 16
+#endif
+
+/***************** geqrf_tsqr and orgqr_tsqr/ormqr_tsqr ************************
+*******************************************************************************/
+/*! \brief Determines the number of rows of the blocks in the tall-skinny QR factorization
+    (GEQRF_TSQR). It also applies to the corresponding batched and strided-batched routines.
+
+    \details The matrix is split into blocks of max(TSQR_BLOCKSIZE, n) rows (the last block
+    takes the remaining rows); each block is factorized by a single work-group, and the resulting
+    triangular factors are combined pairwise in a binary tree. The same value must be used by
+    ORGQR_TSQR and ORMQR_TSQR to interpret the factorization. */
+#ifndef TSQR_BLOCKSIZE
+#define TSQR_BLOCKSIZE 256
+#endif
+
+/*! \brief Determines the maximum size in bytes of the LDS buffer used to stage rows of the
+    matrix when forming the orthogonal factor with ORGQR_TSQR. If a single row does not fit,
+    the rows are staged in global memory instead. */
+#ifndef TSQR_LDS_SIZE
+#define TSQR_LDS_SIZE (32 * 1024)
+#endif
+
+/***************** gels ********************************************************
+*******************************************************************************/
+/*! \brief Determines when GELS uses the tall-skinny QR factorization (GEQRF_TSQR)
+    instead of the blocked QR factorization (GEQRF).
+
+    \details The tall-skinny algorithm is used for overdetermined problems with
+    m >= GELS_TSQR_RATIO * n and n <= GELS_TSQR_MAX_COLS. It also applies to the
+    corresponding batched and strided-batched routines. */
+#ifndef GELS_TSQR_RATIO
+#define GELS_TSQR_RATIO 64
+#endif
+
+#ifndef GELS_TSQR_MAX_COLS
+#define GELS_TSQR_MAX_COLS 128
+#endif
+
 /***************** gerq2/gerqf and gelq2/gelqf ********************************
 *******************************************************************************/
 /*! \brief Determines the size of the block row factorized at each step
@@ -244,11 +300,55 @@
 #define POTRF_POTF2_SWITCHSIZE(T) POTRF_BLOCKSIZE(T)
 #endif
 
+/*! \brief Determines whether POTRF uses the recursive algorithm (if different from 0) or the
+    blocked algorithm (if equal to 0). It also applies to the corresponding batched and strided-batched routines.
+
+    \details With the recursive algorithm, the matrix is split in halves until the resulting diagonal
+    blocks have no more than POTRF_RECURSIVE_MINSIZE columns; these are then factorized with the unblocked
+    algorithm (POTF2), and the off-diagonal and trailing blocks are updated with TRSM and SYRK/HERK.
+
+    When equal to 0, the recursive algorithm can still be selected at run time for a given handle
+    with rocsolver_set_alg_mode and rocsolver_function_potrf.*/
+#ifndef POTRF_RECURSIVE
+#define POTRF_RECURSIVE 0
+#endif
+
+/*! \brief Determines the size of the base case of the recursive algorithm in POTRF. It should not be
+    greater than POTF2_MAX_SMALL_SIZE so that the diagonal blocks can be factorized in the LDS.*/
+#ifndef POTRF_RECURSIVE_MINSIZE
+#define POTRF_RECURSIVE_MINSIZE(T) POTRF_BLOCKSIZE(T)
+#endif
+
+/*! \brief Determines the range of sizes for which POTRF factorizes a single matrix
+    (batch_count = 1) with the persistent kernel.
+
+    \details The persistent kernel splits the matrix into tiles of POTRF_PERSISTENT_TILE x
+    POTRF_PERSISTENT_TILE elements and launches a fixed number of thread-blocks that dequeue the
+    factorization, triangular-solve and trailing-update tasks of the tiles from a global queue. Each
+    task waits on per-tile dependency counters, so that the whole factorization runs without returning
+    to the host. Setting POTRF_PERSISTENT_MAX_SIZE to 0 disables the persistent kernel by default;
+    it can still be selected at run time for a given handle with rocsolver_set_alg_mode and
+    rocsolver_alg_mode_persistent. (It is disabled until its crossover with the blocked algorithm has
+    been benchmarked.)*/
+#ifndef POTRF_PERSISTENT_MIN_SIZE
+#define POTRF_PERSISTENT_MIN_SIZE 512
+#endif
+#ifndef POTRF_PERSISTENT_MAX_SIZE
+#define POTRF_PERSISTENT_MAX_SIZE 0
+#endif
+
+/*! \brief Determines the size of the tiles processed by each task of the persistent kernel of
+    POTRF. Must be a multiple of 4 and not greater than 64.*/
+#ifndef POTRF_PERSISTENT_TILE
+#define POTRF_PERSISTENT_TILE 32
+#endif
+
 /*! \brief Determines the maximum size at which rocSOLVER can use POTF2
     \details 
     POTF2 will attempt to factorize a small symmetric matrix that can fit entirely
     within the LDS share memory using compact storage.  
-    The amount of LDS shared memory is assumed to be at least (64 * 1024) bytes. */
+    The size is further limited by the amount of LDS shared memory reported by the
+    architecture description of the handle (see rocsolver_get_arch_info). */
 #ifndef POTF2_MAX_SMALL_SIZE
 #define POTF2_MAX_SMALL_SIZE(T) ((sizeof(T) == 4) ? 180 : (sizeof(T) == 8) ? 127 : 90)
 #endif
@@ -265,6 +365,15 @@
 #define SYEVJ_BLOCKED_SWITCH 58
 #endif
 
+/*! \brief Determines the minimum number of problems that each stream must process
+    when a batched or strided-batched SYEVJ call is split across the stream pool of
+    the handle (see rocsolver_set_batch_streams).
+
+    \details Batches with fewer than 2*SYEVJ_SPLIT_MIN_BATCH problems are not split. */
+#ifndef SYEVJ_SPLIT_MIN_BATCH
+#define SYEVJ_SPLIT_MIN_BATCH 4
+#endif
+
 /*************************** sytf2/sytrf **************************************
 *******************************************************************************/
 /*! \brief Determines the maximum size of the partial factorization executed at each step
@@ -313,6 +422,26 @@
 #define GETF2_OPTIM_NGRP \
     16, 15, 8, 8, 8, 8, 8, 8, 6, 6, 4, 4, 4, 4, 4, 4, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2
 #endif
+/*! \brief Determines whether the panel factorizations in GETRF use the recursive algorithm
+    (if different from 0) or the iterative blocked algorithm (if equal to 0). It also applies to the
+    corresponding batched and strided-batched routines.
+
+    \details With the recursive algorithm, the columns of a panel are split in halves until the resulting
+    sub-panels have no more than GETRF_RECURSIVE_PANEL_MINSIZE columns; these are then factorized with the
+    unblocked algorithm (GETF2), and the rest of the panel is updated with TRSM and GEMM.
+
+    When equal to 0, the recursive algorithm can still be selected at run time for a given handle
+    with rocsolver_set_alg_mode and rocsolver_function_getrf.*/
+#ifndef GETRF_RECURSIVE_PANEL
+#define GETRF_RECURSIVE_PANEL 0
+#endif
+
+/*! \brief Determines the size of the base case of the recursive panel factorization in GETRF.
+    Must be greater than 0 and not greater than 1024.*/
+#ifndef GETRF_RECURSIVE_PANEL_MINSIZE
+#define GETRF_RECURSIVE_PANEL_MINSIZE 16
+#endif
+
 #ifndef GETRF_NUM_INTERVALS_REAL
 #define GETRF_NUM_INTERVALS_REAL 4
 #endif
@@ -417,6 +546,26 @@
 #define GETRI_BATCH_BLKSIZES 32, 0, 256
 #endif
 
+/*! \brief Determines the largest matrix size accepted by GETRI_DIRECT and POTRI_DIRECT (with
+    batched and strided-batched versions), which invert the matrix in the LDS with a single kernel
+    call. Must be <= 32. */
+#ifndef GETRI_DIRECT_MAX_SIZE
+#define GETRI_DIRECT_MAX_SIZE 32
+#endif
+
+/****************************** gesv ******************************************
+*******************************************************************************/
+/*! \brief Determines the size at which rocSOLVER switches from the fused small-size kernel
+    to the GETRF + GETRS algorithm when executing GESV and GESV_OUTOFPLACE. It also applies to the
+    corresponding batched and strided-batched routines. Must be <= 32.
+
+    \details If n is not greater than GESV_SMALL_SWITCHSIZE, the factorization and the solution
+    are computed with a single kernel call that keeps the matrices in the LDS, so that no
+    additional workspace is required. */
+#ifndef GESV_SMALL_SWITCHSIZE
+#define GESV_SMALL_SWITCHSIZE 32
+#endif
+
 /***************************** trtri ******************************************
 *******************************************************************************/
 #ifndef TRTRI_MAX_COLS
@@ -449,3 +598,119 @@
 #ifndef SPLITLU_SWITCH_SIZE
 #define SPLITLU_SWITCH_SIZE 64
 #endif
+
+/*************************** geblttrf/geblttrs ********************************
+*******************************************************************************/
+/*! \brief Determines the maximum block size nb for which GEBLTTRF_NPVT and GEBLTTRS_NPVT
+    use a single fused kernel. It also applies to the corresponding batched, strided-batched and
+    interleaved-batched routines. Must be <= 8.
+
+    \details With the fused kernels, each thread processes all the blocks of one matrix of the batch,
+    keeping the diagonal block in registers. Accesses to global memory are coalesced when the
+    matrices are stored in the interleaved layout.*/
+#ifndef GEBLTTR_SMALL_MAX_NB
+#define GEBLTTR_SMALL_MAX_NB(T) ((sizeof(T) == 16) ? 6 : 8)
+#endif
+
+/************************** gbtrf/pbtrf ***************************************
+*******************************************************************************/
+/*! \brief Determines the number of threads of the kernels used by GBTRF, GBTRS, PBTRF and PBTRS
+    (and the corresponding batched and strided-batched routines). Must be a power of 2 >= 128.
+
+    \details Each thread block processes one matrix (or one right-hand side) of the batch. The
+    factorizations keep a sliding window of the band in the LDS whenever it fits; otherwise, they
+    work directly on the band storage in global memory.*/
+#ifndef BAND_BLOCKSIZE
+#define BAND_BLOCKSIZE 128
+#endif
+
+/************************** gtsv/ptsv/gpsv ************************************
+*******************************************************************************/
+/*! \brief Determines the size at which GTSV_NOPIVOT switches from the Thomas algorithm to
+    parallel cyclic reduction. It also applies to the corresponding strided-batched and
+    interleaved-batched routines.
+
+    \details With the Thomas algorithm, each thread solves one system of the batch (a lane);
+    accesses to global memory are coalesced when the systems are stored in the interleaved layout.
+    With parallel cyclic reduction, each thread block solves one system (one right-hand side), and the
+    reduced equations are kept in the LDS. Parallel cyclic reduction is only used when n >=
+    GTSV_PCR_SWITCHSIZE and the equations fit in the LDS.*/
+#ifndef GTSV_PCR_SWITCHSIZE
+#define GTSV_PCR_SWITCHSIZE 128
+#endif
+
+/************************** out-of-core ***************************************
+*******************************************************************************/
+/*! \brief Determines the width of the column panels moved between the host and the device by the
+    out-of-core routines GETRF_OOC, POTRF_OOC, GETRS_OOC and POTRS_OOC.
+
+    \details The device workspace holds up to three panels of this width (the panel being
+    factorized and the two buffers of the window through which the previous panels are streamed),
+    each with as many rows as the matrix. Wider panels increase the amount of work per transferred
+    byte.*/
+#ifndef OOC_BLOCKSIZE
+#define OOC_BLOCKSIZE 512
+#endif
+
+/********************** panel-apply (getrf/potrf/geqrf) ***********************
+*******************************************************************************/
+/*! \brief Determines the range of sizes (min(m,n) for GETRF and GEQRF, n for POTRF) and the
+    minimum batch count for which the batched and strided-batched blocked factorizations update
+    the trailing matrix with the fused panel-apply kernels.
+
+    \details At every block step, GETRF and GEQRF apply the factorized panel to the trailing
+    columns with a single kernel (triangular solve of the block row followed by the rank-jb
+    update in GETRF; block reflector application in GEQRF), and POTRF switches to the left-looking
+    algorithm so that the update and the triangular solve of each block row (column) are also
+    done by a single kernel. Each thread-block processes PANEL_APPLY_TILE columns of one
+    problem of the batch, so that no intermediate results go through global memory. Setting
+    PANEL_APPLY_MAX_SIZE to 0 disables the panel-apply kernels.*/
+#ifndef PANEL_APPLY_MIN_SIZE
+#define PANEL_APPLY_MIN_SIZE 128
+#endif
+#ifndef PANEL_APPLY_MAX_SIZE
+#define PANEL_APPLY_MAX_SIZE 512
+#endif
+#ifndef PANEL_APPLY_MIN_BATCH
+#define PANEL_APPLY_MIN_BATCH 64
+#endif
+
+/*! \brief Determines the number of columns processed by each thread-block of the panel-apply
+    kernels. Must be a multiple of 4 and not greater than 16.*/
+#ifndef PANEL_APPLY_TILE
+#define PANEL_APPLY_TILE 16
+#endif
+
+/*********************** persistent kernels (syevj/bdsqr) *********************
+*******************************************************************************/
+/*! \brief Determines the number of thread-groups per compute unit launched by the persistent
+    kernels, which loop over the batch instances read from a device-side work queue instead of
+    launching one set of thread-groups per instance.
+
+    \details The blocked SYEVJ/HEEVJ kernels only process the instances that have not converged
+    yet (the queue is rebuilt after every sweep), and BDSQR pulls its diagonal blocks dynamically
+    so that the instances that need more QR steps do not leave other thread-groups idle. The
+    number of concurrent instances is also bounded by the number of instances in the batch.*/
+#ifndef PERSISTENT_GROUPS_PER_CU
+#define PERSISTENT_GROUPS_PER_CU 8
+#endif
+
+/************************** vbatched ******************************************
+*******************************************************************************/
+/*! \brief Determines the size classes in which the variable-size batched functions group the
+    problems of a batch. Every interval [2^k, 2^(k+1)) of sizes is split into
+    VBATCHED_CLASS_SPLIT classes of the same width; smaller sizes are classes of their own.
+
+    \details The problems of a class are processed together by the batched algorithm. If they do
+    not all have the same sizes, they are copied into the workspace and padded to the largest sizes
+    of the class, so that each dimension is enlarged by less than 1/VBATCHED_CLASS_SPLIT.*/
+#ifndef VBATCHED_CLASS_SPLIT
+#define VBATCHED_CLASS_SPLIT 4
+#endif
+
+/*! \brief Determines the number of elements of the workspace where the variable-size batched
+    functions pad the problems of a size class (unless the batch needs less, or a single problem
+    needs more). Classes that do not fit are processed in chunks.*/
+#ifndef VBATCHED_PAD_SIZE
+#define VBATCHED_PAD_SIZE (1 << 20)
+#endif
@@ -793,6 +793,124 @@ __device__ void nrm2(const rocblas_int tid, const rocblas_int n, T* A, const roc
         sval[0] = sqrt(sval[0]);
 }
 
+/** BLOCK_SUM returns the sum of the values val of all the threads in the block.
+    MAX_THDS must be a power of 2 equal to the block size, and sval a shared array of
+    size MAX_THDS. **/
+template <int MAX_THDS, typename T>
+__device__ T block_sum(const rocblas_int tid, const T val, T* sval)
+{
+    sval[tid] = val;
+    __syncthreads();
+
+    for(rocblas_int i = MAX_THDS / 2; i > 0; i /= 2)
+    {
+        if(tid < i)
+            sval[tid] += sval[tid + i];
+        __syncthreads();
+    }
+
+    T res = sval[0];
+    __syncthreads();
+    return res;
+}
+
+/** TBSV solves op(A)*x = b, where A is an n-by-n triangular band matrix with k
+    super-diagonals (if upper) or sub-diagonals (if lower) given in band storage.
+    All the threads of the block must call this function. MAX_THDS must be a power
+    of 2 equal to the block size, and sval a shared array of size MAX_THDS. **/
+template <int MAX_THDS, typename T>
+__device__ void tbsv(const rocblas_int tid,
+                     const rocblas_fill uplo,
+                     const rocblas_operation trans,
+                     const rocblas_diagonal diag,
+                     const rocblas_int n,
+                     const rocblas_int k,
+                     T* A,
+                     const rocblas_int lda,
+                     T* x,
+                     T* sval)
+{
+    const bool unit = (diag == rocblas_diagonal_unit);
+    const bool cnj = (trans == rocblas_operation_conjugate_transpose);
+
+    if(trans == rocblas_operation_none)
+    {
+        if(uplo == rocblas_fill_upper)
+        {
+            // backward substitution by columns
+            for(rocblas_int j = n - 1; j >= 0; j--)
+            {
+                T xj = unit ? x[j] : x[j] / A[k + j * lda];
+                __syncthreads();
+                if(tid == 0)
+                    x[j] = xj;
+                for(rocblas_int i = tid; i < std::min(k, j); i += MAX_THDS)
+                    x[j - 1 - i] -= A[k - 1 - i + j * lda] * xj;
+                __syncthreads();
+            }
+        }
+        else
+        {
+            // forward substitution by columns
+            for(rocblas_int j = 0; j < n; j++)
+            {
+                T xj = unit ? x[j] : x[j] / A[j * lda];
+                __syncthreads();
+                if(tid == 0)
+                    x[j] = xj;
+                for(rocblas_int i = tid; i < std::min(k, n - 1 - j); i += MAX_THDS)
+                    x[j + 1 + i] -= A[1 + i + j * lda] * xj;
+                __syncthreads();
+            }
+        }
+    }
+    else
+    {
+        if(uplo == rocblas_fill_upper)
+        {
+            // forward substitution by rows
+            for(rocblas_int j = 0; j < n; j++)
+            {
+                T temp = 0;
+                for(rocblas_int i = tid; i < std::min(k, j); i += MAX_THDS)
+                {
+                    T a = A[k - 1 - i + j * lda];
+                    temp += (cnj ? conj(a) : a) * x[j - 1 - i];
+                }
+                temp = block_sum<MAX_THDS>(tid, temp, sval);
+
+                if(tid == 0)
+                {
+                    T a = A[k + j * lda];
+                    x[j] = unit ? x[j] - temp : (x[j] - temp) / (cnj ? conj(a) : a);
+                }
+                __syncthreads();
+            }
+        }
+        else
+        {
+            // backward substitution by rows
+            for(rocblas_int j = n - 1; j >= 0; j--)
+            {
+                T temp = 0;
+                for(rocblas_int i = tid; i < std::min(k, n - 1 - j); i += MAX_THDS)
+                {
+                    T a = A[1 + i + j * lda];
+                    temp += (cnj ? conj(a) : a) * x[j + 1 + i];
+                }
+                temp = block_sum<MAX_THDS>(tid, temp, sval);
+
+                if(tid == 0)
+                {
+                    T a = A[j * lda];
+                    x[j] = unit ? x[j] - temp : (x[j] - temp) / (cnj ? conj(a) : a);
+                }
+                __syncthreads();
+            }
+        }
+    }
+}
+
 /** LAGTF computes an LU factorization of a matrix T - lambda*I, where T
     is a tridiagonal matrix and lambda is a scalar. **/
 template <typename T>
@@ -120,6 +120,74 @@ __device__ void scale_tridiag(const rocblas_int start, const rocblas_int end, T*
     }
 }
 
+// **********************************************************
+// device-side work queues used by persistent kernels
+// **********************************************************
+
+/*
+ * A persistent kernel is launched with a fixed number of thread-groups (see
+ * rocsolver_queue_groups) that loop over the batch instances still requiring work,
+ * instead of launching one group per batch instance. The instances are read from a
+ * work queue stored in an array of 2 + batch_count integers:
+ *    queue[0]      number of queued instances,
+ *    queue[1]      head of the queue (number of work items already pulled),
+ *    queue[2 + q]  index of the q-th queued instance.
+ * The queue must be reset (queue[0] = queue[1] = 0) before any instance is pushed.
+ * A queue can be traversed by striding over its entries (rocsolver_queue_entry), or by
+ * pulling work items dynamically from its head (rocsolver_queue_pull), but not both
+ * within the same kernel.
+ */
+
+/** QUEUE_PUSH appends the batch instance bid to the queue. It must be called by a
+    single thread per instance. **/
+__device__ inline void rocsolver_queue_push(rocblas_int* queue, const rocblas_int bid)
+{
+    queue[2 + atomicAdd(queue, 1)] = bid;
+}
+
+/** QUEUE_SIZE returns the number of instances in the queue. No instances can be pushed
+    into the queue by the calling kernel. **/
+__device__ inline rocblas_int rocsolver_queue_size(const rocblas_int* queue)
+{
+    return queue[0];
+}
+
+/** QUEUE_ENTRY returns the q-th instance in the queue. **/
+__device__ inline rocblas_int rocsolver_queue_entry(const rocblas_int* queue, const rocblas_int q)
+{
+    return queue[2 + q];
+}
+
+/** QUEUE_PULL returns the index of the next work item to be processed by the calling
+    thread-group, and advances the head of the queue. Work items are numbered
+    consecutively from zero; it is up to the caller to map them to the queued instances
+    and to stop when the returned index exceeds the number of work items. It must be
+    called by all the threads of the group. **/
+__device__ inline rocblas_int rocsolver_queue_pull(rocblas_int* queue)
+{
+    __shared__ rocblas_int item;
+
+    __syncthreads();
+    if(hipThreadIdx_x == 0 && hipThreadIdx_y == 0 && hipThreadIdx_z == 0)
+        item = atomicAdd(queue + 1, 1);
+    __syncthreads();
+
+    return item;
+}
+
+/** QUEUE_GROUPS returns the number of concurrent work items (i.e. the number of
+    thread-groups divided by groups_per_item) with which a persistent kernel should be
+    launched to process the given number of work items on a device with cu_count
+    compute units (see PERSISTENT_GROUPS_PER_CU). **/
+inline rocblas_int rocsolver_queue_groups(const rocblas_int items,
+                                          const rocblas_int groups_per_item,
+                                          const int cu_count)
+{
+    int64_t resident = int64_t(std::max(cu_count, 1)) * PERSISTENT_GROUPS_PER_CU;
+    int64_t groups = std::max(resident / std::max(groups_per_item, 1), int64_t(1));
+    return rocblas_int(std::max(std::min(int64_t(items), groups), int64_t(1)));
+}
+
 // **********************************************************
 // GPU kernels that are used by many rocsolver functions
 // **********************************************************
@@ -141,6 +209,7 @@ struct no_mask
 };
 
 /** An mask defined by an integer array (e.g., the info array) **/
+template <typename I = rocblas_int>
 struct info_mask
 {
     enum mask_transform
@@ -149,7 +218,7 @@ struct info_mask
         negate
     };
 
-    explicit constexpr info_mask(rocblas_int* mask, mask_transform transform = none) noexcept
+    explicit constexpr info_mask(I* mask, mask_transform transform = none) noexcept
         : m_mask(mask)
         , m_negate(transform == negate)
     {
@@ -160,7 +229,7 @@ struct info_mask
         return m_negate ^ !!m_mask[idx];
     }
 
-    rocblas_int* m_mask;
+    I* m_mask;
     bool m_negate;
 };
 
@@ -173,7 +242,7 @@ ROCSOLVER_KERNEL void copy_mat(copymat_direction direction,
                                const rocblas_int m,
                                const rocblas_int n,
                                U A,
-                               const rocblas_int shiftA,
+                               const rocblas_stride shiftA,
                                const rocblas_int lda,
                                const rocblas_stride strideA,
                                T* buffer,
@@ -203,9 +272,9 @@ ROCSOLVER_KERNEL void copy_mat(copymat_direction direction,
             T* Bp = &buffer[b * strideB];
 
             if(direction == copymat_to_buffer)
-                Bp[i + j * ldb] = Ap[i + j * lda];
+                Bp[i + j * rocblas_stride(ldb)] = Ap[i + j * rocblas_stride(lda)];
             else // direction == copymat_from_buffer
-                Ap[i + j * lda] = Bp[i + j * ldb];
+                Ap[i + j * rocblas_stride(lda)] = Bp[i + j * rocblas_stride(ldb)];
         }
     }
 }
@@ -218,11 +287,11 @@ template <typename T, typename U1, typename U2, typename Mask = no_mask>
 ROCSOLVER_KERNEL void copy_mat(const rocblas_int m,
                                const rocblas_int n,
                                U1 A,
-                               const rocblas_int shiftA,
+                               const rocblas_stride shiftA,
                                const rocblas_int lda,
                                const rocblas_stride strideA,
                                U2 B,
-                               const rocblas_int shiftB,
+                               const rocblas_stride shiftB,
                                const rocblas_int ldb,
                                const rocblas_stride strideB,
                                const Mask mask = no_mask{},
@@ -247,7 +316,7 @@ ROCSOLVER_KERNEL void copy_mat(const rocblas_int m,
             T* Ap = load_ptr_batch<T>(A, b, shiftA, strideA);
             T* Bp = load_ptr_batch<T>(B, b, shiftB, strideB);
 
-            Bp[i + j * ldb] = Ap[i + j * lda];
+            Bp[i + j * rocblas_stride(ldb)] = Ap[i + j * rocblas_stride(lda)];
         }
     }
 }
@@ -411,7 +480,7 @@ template <typename T, typename U>
 ROCSOLVER_KERNEL void subtract_tau(const rocblas_int i,
                                    const rocblas_int j,
                                    U A,
-                                   const rocblas_int shiftA,
+                                   const rocblas_stride shiftA,
                                    const rocblas_int lda,
                                    const rocblas_stride strideA,
                                    T* ipiv,
@@ -423,7 +492,7 @@ ROCSOLVER_KERNEL void subtract_tau(const rocblas_int i,
 
     T t = -(*tau);
     *tau = t;
-    Ap[i + j * lda] = 1.0 + t;
+    Ap[i + j * rocblas_stride(lda)] = 1.0 + t;
 }
 
 template <typename T>
@@ -446,7 +515,7 @@ ROCSOLVER_KERNEL void set_diag(S* D,
                                const rocblas_int shiftd,
                                const rocblas_stride strided,
                                U A,
-                               const rocblas_int shifta,
+                               const rocblas_stride shifta,
                                const rocblas_int lda,
                                const rocblas_stride stridea,
                                const rocblas_int n,
@@ -474,7 +543,7 @@ ROCSOLVER_KERNEL void set_diag(S* D,
                                const rocblas_int shiftd,
                                const rocblas_stride strided,
                                U A,
-                               const rocblas_int shifta,
+                               const rocblas_stride shifta,
                                const rocblas_int lda,
                                const rocblas_stride stridea,
                                const rocblas_int n,
@@ -499,7 +568,7 @@ ROCSOLVER_KERNEL void restore_diag(S* D,
                                    const rocblas_int shiftd,
                                    const rocblas_stride strided,
                                    U A,
-                                   const rocblas_int shifta,
+                                   const rocblas_stride shifta,
                                    const rocblas_int lda,
                                    const rocblas_stride stridea,
                                    const rocblas_int n)
@@ -522,7 +591,7 @@ template <typename T, typename U>
 ROCSOLVER_KERNEL void set_zero(const rocblas_int m,
                                const rocblas_int n,
                                U A,
-                               const rocblas_int shiftA,
+                               const rocblas_stride shiftA,
                                const rocblas_int lda,
                                const rocblas_stride strideA,
                                const rocblas_fill uplo = rocblas_fill_full)
@@ -539,7 +608,7 @@ ROCSOLVER_KERNEL void set_zero(const rocblas_int m,
         if(full || (lower && j > i) || (upper && i > j))
         {
             T* Ap = load_ptr_batch<T>(A, b, shiftA, strideA);
-            Ap[i + j * lda] = 0.0;
+            Ap[i + j * rocblas_stride(lda)] = 0.0;
         }
     }
 }
@@ -750,13 +819,13 @@ ROCSOLVER_KERNEL void scale_axpy(const rocblas_int n,
     }
 }
 
-template <typename T, typename U>
+template <typename T, typename U, typename I>
 ROCSOLVER_KERNEL void check_singularity(const rocblas_int n,
                                         U A,
-                                        const rocblas_int shiftA,
+                                        const rocblas_stride shiftA,
                                         const rocblas_int lda,
                                         const rocblas_stride strideA,
-                                        rocblas_int* info)
+                                        I* info)
 {
     // Checks for singularities in the matrix and updates info to indicate where
     // the first singularity (if any) occurs
@@ -772,7 +841,7 @@ ROCSOLVER_KERNEL void check_singularity(const rocblas_int n,
 
     for(int i = hipThreadIdx_y; i < n; i += hipBlockDim_y)
     {
-        if(a[i + i * lda] == 0)
+        if(a[i + i * rocblas_stride(lda)] == 0)
         {
             rocblas_int _info_temp = _info;
             while(_info_temp == 0 || _info_temp > i + 1)
@@ -27,9 +27,12 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cassert>
+#include <climits>
 #include <cstdlib>
 #include <cstring>
+#include <type_traits>
 #include <hip/hip_runtime.h>
 #include <rocblas/rocblas.h>
 
@@ -51,6 +54,18 @@ inline int64_t idx2D(const int64_t i, const int64_t j, const int64_t inca, const
     return j * lda + i * inca;
 }
 
+/** COLUMN_STRIP returns the maximum number of columns of a matrix with leading dimension ld
+    that can be addressed by a single 32-bit rocBLAS call or kernel launch. It is n if the
+    n columns of the matrix fit, which is always the case for 32-bit sizes. The 64-bit APIs
+    split the updates of larger matrices into column strips of this width. **/
+template <typename I>
+inline I rocsolver_column_strip(const I n, const I ld)
+{
+    if(!std::is_same<I, int64_t>::value || int64_t(ld) * n < INT_MAX)
+        return n;
+    return std::max(I(1), I((INT_MAX - 1) / ld));
+}
+
 template <typename T>
 T const* cast2constType(T* array)
 {
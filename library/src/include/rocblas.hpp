@@ -36,6 +36,7 @@
 #include "rocblas/internal/rocblas-exported-proto.hpp"
 #include "rocblas/internal/rocblas_device_malloc.hpp"
 #include "rocsolver_logger.hpp"
+#include "rocsolver_ptr_array_cache.hpp"
 
 constexpr auto rocblas2string_status(rocblas_status status)
 {
@@ -292,9 +293,7 @@ rocblas_status rocblasCall_dot(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    rocblas_int blocks = (batch_count - 1) / 256 + 1;
-    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work, x, stridex,
-                            batch_count);
+    rocsolver_get_array(handle, stream, work, x, stridex, batch_count);
 
     if constexpr(CONJ)
         return rocblas_internal_dotc_batched_template(handle, n, cast2constType<T>(work), offsetx,
@@ -435,9 +434,7 @@ rocblas_status rocblasCall_ger(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    I blocks = (batch_count - 1) / 256 + 1;
-    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work, y, stridey,
-                            batch_count);
+    rocsolver_get_array(handle, stream, work, y, stridey, batch_count);
 
     if constexpr(std::is_same<I, int64_t>::value)
     {
@@ -492,9 +489,7 @@ rocblas_status rocblasCall_ger(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    I blocks = (batch_count - 1) / 256 + 1;
-    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work, x, stridex,
-                            batch_count);
+    rocsolver_get_array(handle, stream, work, x, stridex, batch_count);
 
     if constexpr(std::is_same<I, int64_t>::value)
     {
@@ -623,9 +618,7 @@ rocblas_status rocblasCall_gemv(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    rocblas_int blocks = (batch_count - 1) / 256 + 1;
-    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work, A, strideA,
-                            batch_count);
+    rocsolver_get_array(handle, stream, work, A, strideA, batch_count);
 
     return rocblas_internal_gemv_batched_template(
         handle, transA, m, n, alpha, stride_alpha, cast2constType<T>(work), offseta, lda, strideA,
@@ -665,9 +658,7 @@ rocblas_status rocblasCall_gemv(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    rocblas_int blocks = (batch_count - 1) / 256 + 1;
-    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work, x, stridex,
-                            batch_count);
+    rocsolver_get_array(handle, stream, work, x, stridex, batch_count);
 
     return rocblas_internal_gemv_batched_template(handle, transA, m, n, alpha, stride_alpha, A,
                                                   offseta, lda, strideA, cast2constType<T>(work),
@@ -708,9 +699,7 @@ rocblas_status rocblasCall_gemv(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    rocblas_int blocks = (batch_count - 1) / 256 + 1;
-    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work, y, stridey,
-                            batch_count);
+    rocsolver_get_array(handle, stream, work, y, stridey, batch_count);
 
     return rocblas_internal_gemv_batched_template(handle, transA, m, n, alpha, stride_alpha, A,
                                                   offseta, lda, strideA, x, offsetx, incx, stridex,
@@ -751,11 +740,8 @@ rocblas_status rocblasCall_gemv(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    rocblas_int blocks = (batch_count - 1) / 256 + 1;
-    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work, x, stridex,
-                            batch_count);
-    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, (work + batch_count), y,
-                            stridey, batch_count);
+    rocsolver_get_array(handle, stream, work, x, stridex, batch_count);
+    rocsolver_get_array(handle, stream, (work + batch_count), y, stridey, batch_count);
 
     return rocblas_internal_gemv_batched_template(
         handle, transA, m, n, alpha, stride_alpha, A, offseta, lda, strideA,
@@ -796,11 +782,8 @@ rocblas_status rocblasCall_gemv(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    rocblas_int blocks = (batch_count - 1) / 256 + 1;
-    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work, A, strideA,
-                            batch_count);
-    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, (work + batch_count), y,
-                            stridey, batch_count);
+    rocsolver_get_array(handle, stream, work, A, strideA, batch_count);
+    rocsolver_get_array(handle, stream, (work + batch_count), y, stridey, batch_count);
 
     return rocblas_internal_gemv_batched_template(
         handle, transA, m, n, alpha, stride_alpha, cast2constType<T>(work), offseta, lda, strideA,
@@ -963,9 +946,7 @@ rocblas_status rocblasCall_gemm(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    rocblas_int blocks = (batch_count - 1) / 256 + 1;
-    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work, A, stride_a,
-                            batch_count);
+    rocsolver_get_array(handle, stream, work, A, stride_a, batch_count);
 
     return rocblas_internal_gemm_batched_template(
         handle, trans_a, trans_b, m, n, k, alpha, cast2constType<T>(work), offset_a, ld_a, stride_a,
@@ -1005,9 +986,7 @@ rocblas_status rocblasCall_gemm(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    rocblas_int blocks = (batch_count - 1) / 256 + 1;
-    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work, B, stride_b,
-                            batch_count);
+    rocsolver_get_array(handle, stream, work, B, stride_b, batch_count);
 
     return rocblas_internal_gemm_batched_template(handle, trans_a, trans_b, m, n, k, alpha, A,
                                                   offset_a, ld_a, stride_a, cast2constType<T>(work),
@@ -1048,9 +1027,7 @@ rocblas_status rocblasCall_gemm(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    rocblas_int blocks = (batch_count - 1) / 256 + 1;
-    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work, C, stride_c,
-                            batch_count);
+    rocsolver_get_array(handle, stream, work, C, stride_c, batch_count);
 
     return rocblas_internal_gemm_batched_template(
         handle, trans_a, trans_b, m, n, k, alpha, A, offset_a, ld_a, stride_a, B, offset_b, ld_b,
@@ -1090,11 +1067,8 @@ rocblas_status rocblasCall_gemm(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    rocblas_int blocks = (batch_count - 1) / 256 + 1;
-    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work, B, stride_b,
-                            batch_count);
-    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work + batch_count, C,
-                            stride_c, batch_count);
+    rocsolver_get_array(handle, stream, work, B, stride_b, batch_count);
+    rocsolver_get_array(handle, stream, work + batch_count, C, stride_c, batch_count);
 
     return rocblas_internal_gemm_batched_template(
         handle, trans_a, trans_b, m, n, k, alpha, A, offset_a, ld_a, stride_a,
@@ -1135,11 +1109,8 @@ rocblas_status rocblasCall_gemm(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    rocblas_int blocks = (batch_count - 1) / 256 + 1;
-    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work, A, stride_a,
-                            batch_count);
-    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work + batch_count, C,
-                            stride_c, batch_count);
+    rocsolver_get_array(handle, stream, work, A, stride_a, batch_count);
+    rocsolver_get_array(handle, stream, work + batch_count, C, stride_c, batch_count);
 
     return rocblas_internal_gemm_batched_template(
         handle, trans_a, trans_b, m, n, k, alpha, cast2constType<T>(work), offset_a, ld_a, stride_a,
@@ -1180,11 +1151,8 @@ rocblas_status rocblasCall_gemm(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    rocblas_int blocks = (batch_count - 1) / 256 + 1;
-    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work, A, stride_a,
-                            batch_count);
-    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work + batch_count, B,
-                            stride_b, batch_count);
+    rocsolver_get_array(handle, stream, work, A, stride_a, batch_count);
+    rocsolver_get_array(handle, stream, work + batch_count, B, stride_b, batch_count);
 
     return rocblas_internal_gemm_batched_template(
         handle, trans_a, trans_b, m, n, k, alpha, cast2constType<T>(work), offset_a, ld_a, stride_a,
@@ -1284,10 +1252,8 @@ rocblas_status rocblasCall_trmm(rocblas_handle handle,
 
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
-    rocblas_int blocks = (batch_count - 1) / 256 + 1;
 
-    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, workArr, B, strideB,
-                            batch_count);
+    rocsolver_get_array(handle, stream, workArr, B, strideB, batch_count);
 
     return rocblas_internal_trmm_batched_template(
         handle, side, uplo, transA, diag, m, n, alpha, stride_alpha, A, offsetA, lda, strideA,
@@ -1396,9 +1362,7 @@ rocblas_status rocblasCall_syr2_her2(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    rocblas_int blocks = (batch_count - 1) / 256 + 1;
-    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work, y, stridey,
-                            batch_count);
+    rocsolver_get_array(handle, stream, work, y, stridey, batch_count);
 
     if constexpr(!rocblas_is_complex<T>)
         return rocblas_internal_syr2_batched_template(handle, uplo, n, alpha, x, offsetx, incx,
@@ -1558,9 +1522,7 @@ rocblas_status rocblasCall_syr2k_her2k(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    rocblas_int blocks = (batch_count - 1) / 256 + 1;
-    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work, B, strideB,
-                            batch_count);
+    rocsolver_get_array(handle, stream, work, B, strideB, batch_count);
 
     if constexpr(BATCHED)
         return rocblas_internal_syr2k_batched_template(
@@ -1656,9 +1618,7 @@ rocblas_status rocblasCall_syr2k_her2k(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    rocblas_int blocks = (batch_count - 1) / 256 + 1;
-    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, work, B, strideB,
-                            batch_count);
+    rocsolver_get_array(handle, stream, work, B, strideB, batch_count);
 
     if constexpr(BATCHED)
         return rocblas_internal_her2k_batched_template(
@@ -1792,9 +1752,7 @@ rocblas_status rocblasCall_symv_hemv(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    rocblas_int blocks = (batch_count - 1) / 256 + 1;
-    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, workArr, y, stridey,
-                            batch_count);
+    rocsolver_get_array(handle, stream, workArr, y, stridey, batch_count);
 
     if constexpr(!rocblas_is_complex<T>)
         return rocblas_internal_symv_batched_template(handle, uplo, n, alpha, stridea, A, offsetA,
@@ -1953,35 +1911,43 @@ rocblas_status rocblasCall_trsm_mem(rocblas_side side,
                                     size_t* x_temp,
                                     size_t* x_temp_arr,
                                     size_t* invA,
-                                    size_t* invA_arr)
+                                    size_t* invA_arr,
+                                    bool optim_mem = true)
 {
+    /** By default, we request the size for optimal performance. If optim_mem
+        is false, x_temp is reduced to the size needed by the (slower)
+        low-memory algorithm **/
     size_t no_opt_size = 0;
-    /** TODO: For now, we always request the size for optimal performance.
-        no_opt_size could be used in the future if we generalize the use of
-        rocblas_workmode parameter **/
+    rocblas_status status;
 
     // can't infer batched based on input params
     if constexpr(std::is_same<I, int64_t>::value)
     {
         if constexpr(BATCHED)
-            return rocblas_internal_trsm_batched_workspace_size_64<T>(
+            status = rocblas_internal_trsm_batched_workspace_size_64<T>(
                 side, transA, m, n, lda, ldb, batch_count, 0, x_temp, x_temp_arr, invA, invA_arr,
                 &no_opt_size);
         else
-            return rocblas_internal_trsm_workspace_size_64<T>(side, transA, m, n, lda, ldb,
-                                                              batch_count, 0, x_temp, x_temp_arr,
-                                                              invA, invA_arr, &no_opt_size);
+            status = rocblas_internal_trsm_workspace_size_64<T>(side, transA, m, n, lda, ldb,
+                                                                batch_count, 0, x_temp, x_temp_arr,
+                                                                invA, invA_arr, &no_opt_size);
     }
     else
     {
         if constexpr(BATCHED)
-            return rocblas_internal_trsm_batched_workspace_size<T>(side, transA, m, n, batch_count,
-                                                                   0, x_temp, x_temp_arr, invA,
-                                                                   invA_arr, &no_opt_size);
+            status = rocblas_internal_trsm_batched_workspace_size<T>(side, transA, m, n,
+                                                                     batch_count, 0, x_temp,
+                                                                     x_temp_arr, invA, invA_arr,
+                                                                     &no_opt_size);
         else
-            return rocblas_internal_trsm_workspace_size<T>(side, transA, m, n, batch_count, 0, x_temp,
-                                                           x_temp_arr, invA, invA_arr, &no_opt_size);
+            status = rocblas_internal_trsm_workspace_size<T>(side, transA, m, n, batch_count, 0,
+                                                             x_temp, x_temp_arr, invA, invA_arr,
+                                                             &no_opt_size);
     }
+
+    if(!optim_mem && (status == rocblas_status_success || status == rocblas_status_continue))
+        *x_temp = std::min(*x_temp, no_opt_size);
+    return status;
 }
 
 // trsm
@@ -2108,9 +2074,7 @@ rocblas_status rocblasCall_trsm(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    I blocks = (batch_count - 1) / 256 + 1;
-    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, workArr, A, stride_A,
-                            batch_count);
+    rocsolver_get_array(handle, stream, workArr, A, stride_A, batch_count);
 
     U supplied_invA = nullptr;
     if constexpr(std::is_same<I, int64_t>::value)
@@ -2216,9 +2180,7 @@ rocblas_status rocblasCall_trtri(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    rocblas_int blocks = (batch_count - 1) / 256 + 1;
-    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, c_temp_arr, c_temp,
-                            c_temp_els, batch_count);
+    rocsolver_get_array(handle, stream, c_temp_arr, c_temp, c_temp_els, batch_count);
 
     return rocblas_internal_trtri_template(handle, uplo, diag, n, A, offset_A, lda, stride_A, 0,
                                            invA, offset_invA, ldinvA, stride_invA, 0, batch_count,
@@ -2252,11 +2214,8 @@ rocblas_status rocblasCall_trtri(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    rocblas_int blocks = (batch_count - 1) / 256 + 1;
-    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, workArr, invA,
-                            stride_invA, batch_count);
-    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, c_temp_arr, c_temp,
-                            c_temp_els, batch_count);
+    rocsolver_get_array(handle, stream, workArr, invA, stride_invA, batch_count);
+    rocsolver_get_array(handle, stream, c_temp_arr, c_temp, c_temp_els, batch_count);
 
     return rocblas_internal_trtri_batched_template(
         handle, uplo, diag, n, A, offset_A, lda, stride_A, 0, cast2constPointer(workArr),
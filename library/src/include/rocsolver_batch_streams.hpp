@@ -0,0 +1,114 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocblas/rocblas.h>
+
+#include "rocblas.hpp"
+#include "rocblas_utility.hpp"
+#include "rocsolver_batch_chunking.hpp"
+#include "rocsolver_handle_state.hpp"
+
+/***************************************************************************
+ * Multi-stream execution of batched functions
+ ***************************************************************************/
+
+/*! \brief Returns the number of problems that each stream must process when a batch
+    of batch_count problems is executed with the given handle (batch_count if the batch
+    is not split).
+    \details min_chunk is the minimum number of problems per stream; the maximum number
+    of streams is set with rocsolver_set_batch_streams. The batch is never split in
+    capture-safe mode, so that no streams are created while the stream of the handle is
+    being captured. */
+template <typename I>
+I rocsolver_batch_streams_chunk(rocblas_handle handle, const I batch_count, const I min_chunk)
+{
+    if(rocsolver_handle_state_map::capture_safe_enabled(handle))
+        return batch_count;
+
+    return rocsolver_plan_stream_split(
+        batch_count, int(rocsolver_handle_state_map::batch_streams(handle)), min_chunk);
+}
+
+/*! \brief Executes a batch of batch_count problems in chunks of the given size, each
+    one on its own stream of the pool of the handle.
+    \details run(s, offset, bc) must enqueue the bc problems starting at offset on the
+    current stream of the handle, using the workspace of stream s. The chunks are enqueued
+    in order by the calling thread, with the stream of the handle switched to stream s of
+    the pool, so that they keep the configuration of the handle and its device memory.
+    The streams of the pool wait for the work previously enqueued on the stream of the
+    handle, and the stream of the handle waits for the work of all the streams before
+    returning, so that the whole execution is ordered with respect to the stream of the
+    handle.
+
+    The chunks only overlap if run does not synchronize with the host. If there is a
+    single chunk, run is called on the stream of the handle. */
+template <typename I, typename F>
+rocblas_status
+    rocsolver_split_batch(rocblas_handle handle, const I batch_count, const I chunk, F run)
+{
+    const int count = rocsolver_stream_split_count(batch_count, chunk);
+    if(count == 1)
+        return run(0, I(0), batch_count);
+
+    std::vector<hipStream_t> streams(count);
+    std::vector<hipEvent_t> events(count + 1);
+    ROCBLAS_CHECK(
+        rocsolver_handle_state_map::get_streams(handle, count, streams.data(), events.data()));
+
+    hipStream_t stream;
+    ROCBLAS_CHECK(rocblas_get_stream(handle, &stream));
+
+    // fork
+    HIP_CHECK(hipEventRecord(events[0], stream));
+    for(int s = 0; s < count; ++s)
+        HIP_CHECK(hipStreamWaitEvent(streams[s], events[0], 0));
+
+    // enqueue the chunks (stopping at the first failure)
+    rocblas_status status = rocblas_status_success;
+    int enqueued = 0;
+    for(; enqueued < count && status == rocblas_status_success; ++enqueued)
+    {
+        rocsolver_stream_guard guard(handle, streams[enqueued]);
+        I offset = I(enqueued) * chunk;
+        status = run(enqueued, offset, std::min(chunk, batch_count - offset));
+    }
+
+    // join (the streams that received work, even if a chunk failed)
+    for(int s = 0; s < enqueued; ++s)
+    {
+        HIP_CHECK(hipEventRecord(events[s + 1], streams[s]));
+        HIP_CHECK(hipStreamWaitEvent(stream, events[s + 1], 0));
+    }
+
+    return status;
+}
@@ -0,0 +1,390 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocblas/rocblas.h>
+
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_batch_chunking.hpp"
+
+/***************************************************************************
+ * Per-handle state
+ ***************************************************************************/
+
+/*! \brief Streams and events owned by rocSOLVER for a given handle.
+    \details Streams are created on demand the first time they are requested
+    and live until the handle resources are released. Event 0 is reserved to
+    mark the handle's stream; event i+1 marks stream i of the pool. */
+struct rocsolver_stream_pool
+{
+    std::vector<hipStream_t> streams;
+    std::vector<hipEvent_t> events;
+};
+
+/*! \brief Configuration and resources that rocSOLVER keeps for each rocBLAS
+    handle.
+    \details rocBLAS handles cannot carry rocSOLVER data, so the state is kept
+    in a global map indexed by the handle (in the same fashion as the call stacks
+    of the logger). rocBLAS does not notify rocSOLVER when a handle is destroyed,
+    so an entry only exists while it differs from the default state: entries are
+    created when the handle is configured (or streams are created for it), erased
+    as soon as their configuration returns to the defaults, and destroyed by
+    rocsolver_release_handle_resources. Each entry remembers the device of its
+    handle; an entry found while another device is current belongs to a destroyed
+    handle whose address has been reused, and is discarded. */
+struct rocsolver_handle_state
+{
+    // device that was current when the entry was created (rocBLAS handles are bound to it)
+    int device = -1;
+
+    // enables look-ahead in the blocked factorizations
+    bool lookahead = false;
+
+    // ceiling for the workspace of the batched functions (0 if not set)
+    size_t workspace_budget = 0;
+
+    // device array where the batched functions aggregate their info values (null if not set)
+    rocblas_int* info_summary = nullptr;
+
+    // skips the remaining work of the problems of a batch that already failed
+    bool early_abort = false;
+
+    // maximum number of streams across which a batched function can be split (0 or 1
+    // disables splitting)
+    rocblas_int batch_streams = 0;
+
+    // avoids any synchronization with the host, so that the functions can be captured
+    // into a HIP graph
+    bool capture_safe = false;
+
+    // algorithms selected for the functions that offer alternative algorithms
+    rocsolver_alg_mode alg_getrf = rocsolver_alg_mode_default;
+    rocsolver_alg_mode alg_geqrf = rocsolver_alg_mode_default;
+    rocsolver_alg_mode alg_potrf = rocsolver_alg_mode_default;
+
+    // workspace breakdown recorded during device memory size queries
+    std::vector<rocsolver_workspace_node> breakdown;
+
+    // description of the device architecture set with rocsolver_set_arch_info (valid if
+    // has_arch is true)
+    bool has_arch = false;
+    rocsolver_arch_info arch;
+
+    rocsolver_stream_pool pool;
+};
+
+class rocsolver_handle_state_map
+{
+private:
+    using state_map = std::unordered_map<rocblas_handle, rocsolver_handle_state>;
+
+    // static mutex for multithreading
+    static std::mutex _mutex;
+    // states of the handles currently known to rocSOLVER
+    static state_map _states;
+    // architecture descriptions of the devices queried so far
+    static std::unordered_map<int, rocsolver_arch_info> _devices;
+
+    // creates the missing streams and events of the given pool (the mutex must be held)
+    static rocblas_status grow_pool(rocsolver_stream_pool& pool, int count);
+
+    // destroys the streams and events of the given pool
+    static rocblas_status destroy_pool(rocsolver_stream_pool& pool);
+
+    // returns the entry of the given handle, or the end of the map if there is none; a stale
+    // entry (created while another device was current) is destroyed and not returned
+    // (the mutex must be held)
+    static state_map::iterator find(rocblas_handle handle);
+
+    // returns the entry of the given handle, creating it if needed (the mutex must be held)
+    static state_map::iterator find_or_create(rocblas_handle handle);
+
+    // returns true if the given state holds nothing but default values
+    static bool is_default(const rocsolver_handle_state& state)
+    {
+        return !state.lookahead && state.workspace_budget == 0 && !state.info_summary
+            && !state.early_abort && state.batch_streams == 0 && !state.capture_safe
+            && state.alg_getrf == rocsolver_alg_mode_default
+            && state.alg_geqrf == rocsolver_alg_mode_default
+            && state.alg_potrf == rocsolver_alg_mode_default && state.breakdown.empty()
+            && !state.has_arch && state.pool.streams.empty() && state.pool.events.empty();
+    }
+
+    // applies the given update to the state of the given handle, creating the entry if
+    // needed and erasing it if the state is left with default values only
+    template <typename F>
+    static void update(rocblas_handle handle, F&& f)
+    {
+        const std::lock_guard<std::mutex> lock(_mutex);
+        auto it = find_or_create(handle);
+        f(it->second);
+        if(is_default(it->second))
+            _states.erase(it);
+    }
+
+    // returns the entry of the given state that holds the algorithm of the given function
+    static rocsolver_alg_mode* alg_mode_entry(rocsolver_handle_state& state,
+                                              rocsolver_function func)
+    {
+        switch(func)
+        {
+        case rocsolver_function_getrf: return &state.alg_getrf;
+        case rocsolver_function_geqrf: return &state.alg_geqrf;
+        default: return &state.alg_potrf;
+        }
+    }
+
+public:
+    // returns true if look-ahead is enabled for the given handle
+    static bool lookahead_enabled(rocblas_handle handle)
+    {
+        const std::lock_guard<std::mutex> lock(_mutex);
+        auto it = find(handle);
+        return it != _states.end() && it->second.lookahead;
+    }
+
+    // enables or disables look-ahead for the given handle
+    static void set_lookahead(rocblas_handle handle, bool enable)
+    {
+        update(handle, [&](rocsolver_handle_state& state) { state.lookahead = enable; });
+    }
+
+    // returns the workspace ceiling to be honored with the given handle, or 0 if
+    // budgeted execution is disabled (if the device memory of the handle is not
+    // managed by rocBLAS, the ceiling never exceeds its size)
+    static size_t workspace_budget(rocblas_handle handle);
+
+    // returns the workspace budget set for the given handle
+    static void get_workspace_budget(rocblas_handle handle, size_t* budget)
+    {
+        const std::lock_guard<std::mutex> lock(_mutex);
+        auto it = find(handle);
+        *budget = (it != _states.end() ? it->second.workspace_budget : 0);
+    }
+
+    // sets the workspace budget of the given handle (0 disables budgeted execution)
+    static void set_workspace_budget(rocblas_handle handle, size_t budget)
+    {
+        update(handle, [&](rocsolver_handle_state& state) { state.workspace_budget = budget; });
+    }
+
+    // returns the device array where the info values must be aggregated, or null
+    static rocblas_int* info_summary(rocblas_handle handle)
+    {
+        const std::lock_guard<std::mutex> lock(_mutex);
+        auto it = find(handle);
+        return (it != _states.end() ? it->second.info_summary : nullptr);
+    }
+
+    // returns true if the given pointer refers to memory allocated on the device (the array
+    // of the info summary is checked before it is written, as it would be stale if the
+    // handle that set it was destroyed without releasing its resources)
+    static bool is_device_array(const void* ptr);
+
+    // sets the device array where the info values must be aggregated (null disables it)
+    static void set_info_summary(rocblas_handle handle, rocblas_int* summary)
+    {
+        update(handle, [&](rocsolver_handle_state& state) { state.info_summary = summary; });
+    }
+
+    // returns true if early abort is enabled for the given handle
+    static bool early_abort_enabled(rocblas_handle handle)
+    {
+        const std::lock_guard<std::mutex> lock(_mutex);
+        auto it = find(handle);
+        return it != _states.end() && it->second.early_abort;
+    }
+
+    // enables or disables early abort for the given handle
+    static void set_early_abort(rocblas_handle handle, bool enable)
+    {
+        update(handle, [&](rocsolver_handle_state& state) { state.early_abort = enable; });
+    }
+
+    // returns the maximum number of streams across which the batched functions can be split
+    static rocblas_int batch_streams(rocblas_handle handle)
+    {
+        const std::lock_guard<std::mutex> lock(_mutex);
+        auto it = find(handle);
+        return (it != _states.end() ? it->second.batch_streams : 0);
+    }
+
+    // sets the maximum number of streams across which the batched functions can be split
+    static void set_batch_streams(rocblas_handle handle, rocblas_int count)
+    {
+        update(handle, [&](rocsolver_handle_state& state) { state.batch_streams = count; });
+    }
+
+    // returns true if capture-safe mode is enabled for the given handle
+    static bool capture_safe_enabled(rocblas_handle handle)
+    {
+        const std::lock_guard<std::mutex> lock(_mutex);
+        auto it = find(handle);
+        return it != _states.end() && it->second.capture_safe;
+    }
+
+    // enables or disables capture-safe mode for the given handle
+    static void set_capture_safe(rocblas_handle handle, bool enable)
+    {
+        update(handle, [&](rocsolver_handle_state& state) { state.capture_safe = enable; });
+    }
+
+    // returns the algorithm selected for the given function with the given handle
+    static rocsolver_alg_mode alg_mode(rocblas_handle handle, rocsolver_function func)
+    {
+        const std::lock_guard<std::mutex> lock(_mutex);
+        auto it = find(handle);
+        if(it == _states.end())
+            return rocsolver_alg_mode_default;
+        return *alg_mode_entry(it->second, func);
+    }
+
+    // selects the algorithm of the given function with the given handle
+    static void set_alg_mode(rocblas_handle handle,
+                             rocsolver_function func,
+                             rocsolver_alg_mode mode)
+    {
+        update(handle, [&](rocsolver_handle_state& state) { *alg_mode_entry(state, func) = mode; });
+    }
+
+    // appends the given nodes to the workspace breakdown of the given handle
+    static void append_breakdown(rocblas_handle handle,
+                                 const std::vector<rocsolver_workspace_node>& nodes)
+    {
+        const std::lock_guard<std::mutex> lock(_mutex);
+        auto& breakdown = find_or_create(handle)->second.breakdown;
+        breakdown.insert(breakdown.end(), nodes.begin(), nodes.end());
+    }
+
+    // copies up to *count nodes of the workspace breakdown of the given handle into nodes
+    // (or only returns the number of nodes if nodes is null)
+    static void
+        get_breakdown(rocblas_handle handle, rocsolver_workspace_node* nodes, rocblas_int* count);
+
+    // discards the workspace breakdown of the given handle
+    static void clear_breakdown(rocblas_handle handle)
+    {
+        update(handle, [](rocsolver_handle_state& state) { state.breakdown.clear(); });
+    }
+
+    // returns the description of the device architecture used with the given handle
+    // (querying the device properties the first time the device is seen)
+    static rocsolver_arch_info get_arch(rocblas_handle handle);
+
+    // overrides the description of the device architecture used with the given handle;
+    // if info is null, the description of the device is restored
+    static void set_arch(rocblas_handle handle, const rocsolver_arch_info* info);
+
+    // returns count streams of the pool of the given handle and count+1 events
+    // (creating them if needed)
+    static rocblas_status
+        get_streams(rocblas_handle handle, int count, hipStream_t* streams, hipEvent_t* events);
+
+    // destroys the streams and events of the given handle and forgets its state
+    static rocblas_status release(rocblas_handle handle);
+};
+
+/*! \brief RAII helper that switches the stream of a rocBLAS handle and restores
+    the original one when going out of scope. */
+class rocsolver_stream_guard
+{
+private:
+    rocblas_handle handle;
+    hipStream_t old_stream;
+
+public:
+    rocsolver_stream_guard(rocblas_handle handle, hipStream_t stream)
+        : handle(handle)
+    {
+        rocblas_get_stream(handle, &old_stream);
+        rocblas_set_stream(handle, stream);
+    }
+
+    ~rocsolver_stream_guard()
+    {
+        rocblas_set_stream(handle, old_stream);
+    }
+
+    rocsolver_stream_guard(const rocsolver_stream_guard&) = delete;
+    rocsolver_stream_guard& operator=(const rocsolver_stream_guard&) = delete;
+};
+
+/*! \brief Secondary stream and events used by the look-ahead variants of the
+    blocked factorizations.
+    \details If look-ahead is disabled for the handle, capture-safe mode is enabled
+    (so that no streams of the pool are used while the stream of the handle is being
+    captured), or the pool could not be created, enabled is false and the factorizations
+    fall back to their regular single-stream algorithm. */
+struct rocsolver_lookahead
+{
+    bool enabled = false;
+    hipStream_t main_stream = 0;
+    hipStream_t side_stream = 0;
+    hipEvent_t main_event = 0;
+    hipEvent_t side_event = 0;
+
+    explicit rocsolver_lookahead(rocblas_handle handle)
+    {
+        if(!rocsolver_handle_state_map::lookahead_enabled(handle)
+           || rocsolver_handle_state_map::capture_safe_enabled(handle))
+            return;
+
+        hipEvent_t events[2];
+        if(rocsolver_handle_state_map::get_streams(handle, 1, &side_stream, events)
+           != rocblas_status_success)
+            return;
+
+        rocblas_get_stream(handle, &main_stream);
+        main_event = events[0];
+        side_event = events[1];
+        enabled = true;
+    }
+
+    // makes the side stream wait for the work enqueued so far on the main stream
+    rocblas_status fork()
+    {
+        if(hipEventRecord(main_event, main_stream) != hipSuccess
+           || hipStreamWaitEvent(side_stream, main_event, 0) != hipSuccess)
+            return rocblas_status_internal_error;
+        return rocblas_status_success;
+    }
+
+    // makes the main stream wait for the work enqueued so far on the side stream
+    rocblas_status join()
+    {
+        if(hipEventRecord(side_event, side_stream) != hipSuccess
+           || hipStreamWaitEvent(main_stream, side_event, 0) != hipSuccess)
+            return rocblas_status_internal_error;
+        return rocblas_status_success;
+    }
+};
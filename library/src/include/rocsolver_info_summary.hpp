@@ -0,0 +1,126 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include <hip/hip_runtime.h>
+#include <rocblas/rocblas.h>
+
+#include "lib_device_helpers.hpp"
+#include "rocsolver_handle_state.hpp"
+#include "rocsolver_logger.hpp"
+
+/***************************************************************************
+ * Aggregated info values
+ ***************************************************************************/
+
+/** INFO_SUMMARY_RESET initializes the summary of a batch: no failed problem, and
+    the first failed problem past the end of the batch. **/
+template <typename I>
+ROCSOLVER_KERNEL void info_summary_reset(rocblas_int* summary, const I batch_count)
+{
+    summary[0] = 0;
+    summary[1] = rocblas_int(batch_count);
+}
+
+/** INFO_SUMMARY_KERNEL counts the problems with info != 0 and finds the first of them.
+    Each thread-block reduces BS1 info values and updates the summary atomically.
+    Call this kernel with ceil(batch_count / BS1) groups of BS1 threads. **/
+template <typename I>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1)
+    info_summary_kernel(const I* info, const I batch_count, rocblas_int* summary)
+{
+    __shared__ rocblas_int scount[BS1];
+    __shared__ I sfirst[BS1];
+
+    I tid = hipThreadIdx_x;
+    I b = hipBlockIdx_x * I(BS1) + tid;
+    bool failed = (b < batch_count && info[b] != 0);
+    scount[tid] = failed ? 1 : 0;
+    sfirst[tid] = failed ? b : batch_count;
+    __syncthreads();
+
+    for(I s = BS1 / 2; s > 0; s /= 2)
+    {
+        if(tid < s)
+        {
+            scount[tid] += scount[tid + s];
+            sfirst[tid] = std::min(sfirst[tid], sfirst[tid + s]);
+        }
+        __syncthreads();
+    }
+
+    if(tid == 0 && scount[0] > 0)
+    {
+        atomicAdd(summary, scount[0]);
+        atomicMin(summary + 1, rocblas_int(sfirst[0]));
+    }
+}
+
+/** INFO_SUMMARY_ARGCHECK verifies that the summary array set for the handle (if any) can
+    hold the aggregated info values of a batch of the given size. The array holds rocblas_int
+    values, so the 64-bit functions cannot aggregate batches of more than INT32_MAX problems. **/
+template <typename I>
+rocblas_status rocsolver_info_summary_argCheck(rocblas_handle handle, const I batch_count)
+{
+    if(std::is_same<I, int64_t>::value && batch_count > INT32_MAX
+       && rocsolver_handle_state_map::info_summary(handle))
+        return rocblas_status_invalid_size;
+
+    return rocblas_status_continue;
+}
+
+/** Aggregates the info values of a batch into the summary array set for the handle
+    (see rocsolver_set_info_summary), if any. The size of the batch must have been checked
+    with rocsolver_info_summary_argCheck. **/
+template <typename I>
+rocblas_status rocsolver_info_summary(rocblas_handle handle, const I* info, const I batch_count)
+{
+    // type used by the kernel logging macros (the summary does not depend on the precision of
+    // the function)
+    using T = I;
+
+    rocblas_int* summary = rocsolver_handle_state_map::info_summary(handle);
+    if(!summary)
+        return rocblas_status_success;
+    if(!rocsolver_handle_state_map::is_device_array(summary))
+        return rocblas_status_invalid_pointer;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    ROCSOLVER_LAUNCH_KERNEL(info_summary_reset<I>, dim3(1), dim3(1), 0, stream, summary,
+                            batch_count);
+    if(batch_count > 0)
+    {
+        I blocks = (batch_count - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(info_summary_kernel<I>, dim3(blocks), dim3(BS1), 0, stream, info,
+                                batch_count, summary);
+    }
+
+    return rocblas_status_success;
+}
@@ -43,6 +43,7 @@
 #include "rocsolver/rocsolver.h"
 #include "rocsolver_datatype2string.hpp"
 #include "rocsolver_logvalue.hpp"
+#include "rocsolver_workspace_breakdown.hpp"
 
 /***************************************************************************
  * rocSOLVER logging macros
@@ -50,6 +51,7 @@
 
 #define ROCSOLVER_ENTER_TOP(name, ...)                                                      \
     std::unique_ptr<rocsolver_logger::scope_guard<T>> _log_token;                           \
+    rocsolver_workspace_scope<T> _ws_token(handle, name);                                   \
     do                                                                                      \
     {                                                                                       \
         if(rocsolver_logger::is_logging_enabled())                                          \
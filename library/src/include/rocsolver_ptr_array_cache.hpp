@@ -0,0 +1,218 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+#include <rocblas/rocblas.h>
+
+#include "lib_device_helpers.hpp"
+#include "rocsolver_logger.hpp"
+
+/***************************************************************************
+ * Pointer-array cache
+ ***************************************************************************/
+
+/*! \brief Keeps track of the pointer arrays built by get_array in the buffers
+    registered by the active scopes of each handle.
+    \details The batched rocBLAS calls that take a strided operand need an array
+    with the address of every problem, which is built in a workspace buffer by the
+    get_array kernel. The blocked algorithms call these functions repeatedly with the
+    same operands, so the arrays are rebuilt over and over. A function that owns a buffer
+    used exclusively for pointer arrays can register it with a
+    rocsolver_ptr_array_scope; while the scope is alive, every array built in the buffer
+    is recorded by its location, base pointer, stride, batch count and stream, and
+    get_array is only launched when the requested array is not recorded. Building an array
+    forgets the arrays that it overwrites. Arrays outside of the registered buffers (e.g.
+    in workspace that aliases other data) are always rebuilt.
+
+    The state is kept in a global map indexed by the handle (in the same fashion as the
+    call stacks of the logger), and the entry of a handle is erased when its last scope
+    ends. */
+class rocsolver_ptr_array_cache
+{
+private:
+    struct buffer
+    {
+        const char* begin;
+        const char* end;
+    };
+
+    struct entry
+    {
+        const char* begin;
+        const char* end;
+        const void* in;
+        rocblas_stride stride;
+        int64_t batch;
+        hipStream_t stream;
+    };
+
+    struct state
+    {
+        std::vector<buffer> buffers;
+        std::vector<entry> entries;
+    };
+
+    static inline std::mutex _mutex;
+    static inline std::unordered_map<rocblas_handle, state> _states;
+
+public:
+    // registers the given buffer of bytes for the given handle; returns false if it is
+    // null or its start already belongs to a registered buffer
+    static bool add(rocblas_handle handle, const void* out, size_t bytes)
+    {
+        if(!out || bytes == 0)
+            return false;
+
+        const char* begin = (const char*)out;
+        const std::lock_guard<std::mutex> lock(_mutex);
+        state& st = _states[handle];
+        for(const buffer& b : st.buffers)
+            if(begin >= b.begin && begin < b.end)
+                return false;
+        st.buffers.push_back({begin, begin + bytes});
+        return true;
+    }
+
+    // unregisters the given buffer and forgets the arrays built in it
+    static void remove(rocblas_handle handle, const void* out)
+    {
+        const char* begin = (const char*)out;
+        const std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _states.find(handle);
+        if(it == _states.end())
+            return;
+
+        state& st = it->second;
+        for(size_t i = 0; i < st.buffers.size(); ++i)
+        {
+            if(st.buffers[i].begin == begin)
+            {
+                const buffer b = st.buffers[i];
+                st.buffers.erase(st.buffers.begin() + i);
+                for(size_t j = st.entries.size(); j-- > 0;)
+                    if(st.entries[j].begin < b.end && st.entries[j].end > b.begin)
+                        st.entries.erase(st.entries.begin() + j);
+                break;
+            }
+        }
+
+        if(st.buffers.empty())
+            _states.erase(it);
+    }
+
+    // returns true if the array must be (re)built, and records its new content
+    static bool update(rocblas_handle handle,
+                       const void* out,
+                       size_t bytes,
+                       const void* in,
+                       rocblas_stride stride,
+                       int64_t batch,
+                       hipStream_t stream)
+    {
+        const char* begin = (const char*)out;
+        const char* end = begin + bytes;
+        const std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _states.find(handle);
+        if(it == _states.end())
+            return true;
+
+        state& st = it->second;
+        for(const entry& e : st.entries)
+            if(e.begin == begin && e.end == end && e.in == in && e.stride == stride
+               && e.batch == batch && e.stream == stream)
+                return false;
+
+        // the new array overwrites the arrays that overlap with it
+        for(size_t j = st.entries.size(); j-- > 0;)
+            if(st.entries[j].begin < end && st.entries[j].end > begin)
+                st.entries.erase(st.entries.begin() + j);
+
+        for(const buffer& b : st.buffers)
+        {
+            if(begin >= b.begin && end <= b.end)
+            {
+                st.entries.push_back({begin, end, in, stride, batch, stream});
+                break;
+            }
+        }
+        return true;
+    }
+};
+
+/*! \brief RAII helper that registers a buffer of count pointers in the pointer-array
+    cache of the handle for the duration of a function. Nested scopes on a buffer that
+    is already registered share the registration of the outermost one. */
+class rocsolver_ptr_array_scope
+{
+private:
+    rocblas_handle handle;
+    const void* buffer;
+    bool owner;
+
+public:
+    template <typename T, typename I>
+    rocsolver_ptr_array_scope(rocblas_handle handle, T** buffer, I count)
+        : handle(handle)
+        , buffer(buffer)
+        , owner(rocsolver_ptr_array_cache::add(handle, buffer, sizeof(T*) * count))
+    {
+    }
+
+    ~rocsolver_ptr_array_scope()
+    {
+        if(owner)
+            rocsolver_ptr_array_cache::remove(handle, buffer);
+    }
+
+    rocsolver_ptr_array_scope(const rocsolver_ptr_array_scope&) = delete;
+    rocsolver_ptr_array_scope& operator=(const rocsolver_ptr_array_scope&) = delete;
+};
+
+/** Builds in out the array of pointers to the batch problems in, in + stride, ...,
+    unless out is in a registered buffer and already holds it. **/
+template <typename T, typename U, typename I>
+void rocsolver_get_array(rocblas_handle handle,
+                         hipStream_t stream,
+                         T** out,
+                         U in,
+                         rocblas_stride stride,
+                         I batch_count)
+{
+    if(!rocsolver_ptr_array_cache::update(handle, out, sizeof(T*) * batch_count, in, stride,
+                                          batch_count, stream))
+        return;
+
+    I blocks = (batch_count - 1) / 256 + 1;
+    ROCSOLVER_LAUNCH_KERNEL(get_array, dim3(blocks), dim3(256), 0, stream, out, in, stride,
+                            batch_count);
+}
@@ -29,6 +29,7 @@
 
 #include "rocblas.hpp"
 #include "rocsolver/rocsolver.h"
+#include "rocsolver_handle_state.hpp"
 
 /*
  * ===========================================================================
@@ -54,7 +55,8 @@ rocblas_status rocsolver_trsm_mem(const rocblas_side side,
                                   const I lda = 1,
                                   const I ldb = 1,
                                   const I inca = 1,
-                                  const I incb = 1);
+                                  const I incb = 1,
+                                  const bool lowmem = false);
 
 template <bool BATCHED, bool STRIDED, typename T, typename I, typename U>
 rocblas_status rocsolver_trsm_lower(rocblas_handle handle,
@@ -244,17 +246,148 @@ rocblas_status rocsolver_ger(rocblas_handle handle,
                              I batch_count,
                              T** work);
 
+// panel-apply
+#define PA_DIMX 64 // threads along the rows of a tile
+#define PA_RPT 4 // rows of the register tile of each thread
+#define PA_CPT 4 // columns of the register tile of each thread
+#define PA_MAX_K (PA_DIMX * PA_RPT) // maximum width of the panel
+
+template <typename T, typename I>
+inline bool
+    rocsolver_use_panel_apply(rocblas_handle handle, const I dim, const I nb, const I batch_count)
+{
+    // the panels cannot be wider than the rows covered by the register tiles of a thread-block
+    if(dim < PANEL_APPLY_MIN_SIZE || dim > PANEL_APPLY_MAX_SIZE
+       || batch_count < PANEL_APPLY_MIN_BATCH || nb > PA_MAX_K)
+        return false;
+
+    // the kernels keep two nb x PANEL_APPLY_TILE blocks and a square tile in the LDS
+    const rocsolver_arch_info arch = rocsolver_handle_state_map::get_arch(handle);
+    return sizeof(T) * (2 * nb + PANEL_APPLY_TILE) * PANEL_APPLY_TILE <= size_t(arch.lds_size);
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename I, typename U>
+rocblas_status rocsolver_getrf_panel_apply(rocblas_handle handle,
+                                           const I mm,
+                                           const I nn,
+                                           const I jb,
+                                           U A,
+                                           const rocblas_stride shiftA,
+                                           const I lda,
+                                           const rocblas_stride strideA,
+                                           const I batch_count);
+
+template <bool BATCHED, bool STRIDED, typename T, typename I, typename U>
+rocblas_status rocsolver_potrf_panel_apply(rocblas_handle handle,
+                                           const rocblas_fill uplo,
+                                           const I j,
+                                           const I jb,
+                                           const I cb,
+                                           const I nn,
+                                           U A,
+                                           const rocblas_stride shiftA,
+                                           const I lda,
+                                           const rocblas_stride strideA,
+                                           const I* info,
+                                           const I batch_count);
+
+template <bool BATCHED, bool STRIDED, typename T, typename I, typename U>
+rocblas_status rocsolver_larfb_panel_apply(rocblas_handle handle,
+                                           const I m,
+                                           const I n,
+                                           const I k,
+                                           U V,
+                                           const rocblas_stride shiftV,
+                                           const I ldv,
+                                           const rocblas_stride strideV,
+                                           T* F,
+                                           const I ldf,
+                                           const rocblas_stride strideF,
+                                           U C,
+                                           const rocblas_stride shiftC,
+                                           const I ldc,
+                                           const rocblas_stride strideC,
+                                           const I batch_count);
+
 // potf2
-template <typename T, typename U>
+template <typename T, typename I, typename U>
 rocblas_status potf2_run_small(rocblas_handle handle,
                                const rocblas_fill uplo,
-                               const rocblas_int n,
+                               const I n,
                                U AA,
-                               const rocblas_int shiftA,
-                               const rocblas_int lda,
+                               const rocblas_stride shiftA,
+                               const I lda,
                                const rocblas_stride strideA,
-                               rocblas_int* info,
-                               const rocblas_int batch_count);
+                               I* info,
+                               const I batch_count,
+                               const I* skip = nullptr);
+
+// posv
+template <typename T, typename U>
+rocblas_status posv_run_small(rocblas_handle handle,
+                              const rocblas_fill uplo,
+                              const rocblas_int n,
+                              const rocblas_int nrhs,
+                              U A,
+                              const rocblas_int shiftA,
+                              const rocblas_int lda,
+                              const rocblas_stride strideA,
+                              U B,
+                              const rocblas_int shiftB,
+                              const rocblas_int ldb,
+                              const rocblas_stride strideB,
+                              rocblas_int* info,
+                              const rocblas_int batch_count);
+
+// geblttrf/geblttrs
+template <typename T, typename U>
+rocblas_status geblttrf_npvt_run_small(rocblas_handle handle,
+                                       const rocblas_int nb,
+                                       const rocblas_int nblocks,
+                                       U A,
+                                       const rocblas_int shiftA,
+                                       const rocblas_int inca,
+                                       const rocblas_int lda,
+                                       const rocblas_stride strideA,
+                                       U B,
+                                       const rocblas_int shiftB,
+                                       const rocblas_int incb,
+                                       const rocblas_int ldb,
+                                       const rocblas_stride strideB,
+                                       U C,
+                                       const rocblas_int shiftC,
+                                       const rocblas_int incc,
+                                       const rocblas_int ldc,
+                                       const rocblas_stride strideC,
+                                       rocblas_int* info,
+                                       const rocblas_int batch_count);
+
+template <typename T, typename U>
+rocblas_status geblttrs_npvt_run_small(rocblas_handle handle,
+                                       const rocblas_int nb,
+                                       const rocblas_int nblocks,
+                                       const rocblas_int nrhs,
+                                       U A,
+                                       const rocblas_int shiftA,
+                                       const rocblas_int inca,
+                                       const rocblas_int lda,
+                                       const rocblas_stride strideA,
+                                       U B,
+                                       const rocblas_int shiftB,
+                                       const rocblas_int incb,
+                                       const rocblas_int ldb,
+                                       const rocblas_stride strideB,
+                                       U C,
+                                       const rocblas_int shiftC,
+                                       const rocblas_int incc,
+                                       const rocblas_int ldc,
+                                       const rocblas_stride strideC,
+                                       U X,
+                                       const rocblas_int shiftX,
+                                       const rocblas_int incx,
+                                       const rocblas_int ldx,
+                                       const rocblas_stride strideX,
+                                       const rocblas_int batch_count);
 
 #ifdef OPTIMAL
 
@@ -0,0 +1,217 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include <cstring>
+#include <initializer_list>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fmt/core.h>
+
+#include "rocblas/internal/rocblas_device_malloc.hpp"
+#include "rocsolver_batch_chunking.hpp"
+#include "rocsolver_datatype2string.hpp"
+#include "rocsolver_handle_state.hpp"
+
+/***************************************************************************
+ * Workspace breakdown
+ ***************************************************************************/
+
+/*! \brief Records the workspace required by the functions called during a
+    device memory size query.
+    \details Recording is done per thread: the outermost rocSOLVER function called
+    with a handle in query mode starts it (see ROCSOLVER_ENTER_TOP) and discards the
+    breakdown of the handle, and the recorded nodes are stored as the new breakdown
+    when the function returns.
+    Outside of a query, all the recording functions return immediately. */
+class rocsolver_workspace_breakdown
+{
+private:
+    // nodes recorded by the current thread (null if not recording)
+    static inline thread_local std::vector<rocsolver_workspace_node>* _nodes = nullptr;
+    // positions of the nodes that are currently open (the innermost last)
+    static inline thread_local std::vector<size_t> _open;
+
+    static void push(const std::string& name, size_t size, int depth)
+    {
+        rocsolver_workspace_node node = {};
+        std::strncpy(node.name, name.c_str(), sizeof(node.name) - 1);
+        node.size = size;
+        node.depth = depth;
+        _nodes->push_back(node);
+    }
+
+    static int depth()
+    {
+        return (*_nodes)[_open.back()].depth;
+    }
+
+    // splits a comma-separated list of (stringified) arguments, and removes the prefix
+    // "size_" from their names
+    static std::vector<std::string> split_names(const char* names)
+    {
+        std::vector<std::string> list(1);
+        int level = 0;
+        for(const char* c = names; *c; ++c)
+        {
+            if(*c == ',' && level == 0)
+                list.emplace_back();
+            else
+            {
+                level += (*c == '(') - (*c == ')');
+                if(*c != ' ' || !list.back().empty())
+                    list.back() += *c;
+            }
+        }
+        for(auto& name : list)
+        {
+            if(name.compare(0, 5, "size_") == 0)
+                name.erase(0, 5);
+        }
+        return list;
+    }
+
+public:
+    static bool is_recording()
+    {
+        return _nodes != nullptr;
+    }
+
+    // opens a node for a function or internal sub-call (a new recording is started
+    // if the thread is not recording yet)
+    static void open(const std::string& name)
+    {
+        if(!_nodes)
+        {
+            _nodes = new std::vector<rocsolver_workspace_node>;
+            _open.clear();
+            push(name, 0, 0);
+        }
+        else
+            push(name, 0, depth() + 1);
+        _open.push_back(_nodes->size() - 1);
+    }
+
+    // closes the innermost node; when the outermost node is closed, the recorded
+    // nodes are stored in the breakdown of the handle (if any array was recorded)
+    static void close(rocblas_handle handle)
+    {
+        _open.pop_back();
+        if(!_open.empty())
+            return;
+
+        if(_nodes->size() > 1)
+            rocsolver_handle_state_map::append_breakdown(handle, *_nodes);
+        delete _nodes;
+        _nodes = nullptr;
+    }
+
+    // records the workspace arrays of the innermost node; names is the list of the
+    // variables holding the sizes, as written in the source
+    static void record_arrays(const char* names, std::initializer_list<size_t> sizes)
+    {
+        if(!_nodes)
+            return;
+
+        std::vector<std::string> list = split_names(names);
+        (*_nodes)[_open.back()].size = rocsolver_workspace_size(sizes);
+        int d = depth() + 1;
+        size_t i = 0;
+        for(size_t s : sizes)
+            push(i < list.size() ? list[i++] : std::string(), s, d);
+    }
+
+    // records the requirements of an internal sub-call of the innermost node
+    static void record_subcall(const char* name,
+                               std::initializer_list<std::pair<const char*, size_t>> arrays)
+    {
+        if(!_nodes)
+            return;
+
+        size_t total = 0;
+        for(auto& a : arrays)
+            total += a.second;
+
+        int d = depth() + 1;
+        push(name, total, d);
+        for(auto& a : arrays)
+            push(a.first, a.second, d + 1);
+    }
+};
+
+/*! \brief RAII helper that opens the node of a top-level rocSOLVER function if the
+    handle is in device memory size query mode (or if a recording is already in
+    progress, in which case the function is recorded as a sub-call). */
+template <typename T>
+class rocsolver_workspace_scope
+{
+private:
+    rocblas_handle handle;
+    bool active = false;
+
+public:
+    rocsolver_workspace_scope(rocblas_handle handle, const char* name)
+        : handle(handle)
+    {
+        if(rocsolver_workspace_breakdown::is_recording()
+           || (handle && rocblas_is_device_memory_size_query(handle)))
+        {
+            // a new top-level query replaces the breakdown of the previous one
+            if(!rocsolver_workspace_breakdown::is_recording())
+                rocsolver_handle_state_map::clear_breakdown(handle);
+            rocsolver_workspace_breakdown::open(
+                fmt::format("rocsolver_{}{}", rocblas2char_precision<T>, name));
+            active = true;
+        }
+    }
+
+    ~rocsolver_workspace_scope()
+    {
+        if(active)
+            rocsolver_workspace_breakdown::close(handle);
+    }
+
+    rocsolver_workspace_scope(const rocsolver_workspace_scope&) = delete;
+    rocsolver_workspace_scope& operator=(const rocsolver_workspace_scope&) = delete;
+};
+
+/*! \brief Sets the optimal device memory size during a size query (as
+    rocblas_set_optimal_device_memory_size does), and records the given workspace
+    arrays in the breakdown of the current function. */
+#define ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, ...) \
+    rocsolver_set_optimal_device_memory_size(handle, #__VA_ARGS__, __VA_ARGS__)
+
+template <typename... Ss>
+rocblas_status
+    rocsolver_set_optimal_device_memory_size(rocblas_handle handle, const char* names, Ss... sizes)
+{
+    rocsolver_workspace_breakdown::record_arrays(names, {size_t(sizes)...});
+    return rocblas_set_optimal_device_memory_size(handle, sizes...);
+}
@@ -0,0 +1,144 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_gbsv.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_gbsv_impl(rocblas_handle handle,
+                                   const rocblas_int n,
+                                   const rocblas_int kl,
+                                   const rocblas_int ku,
+                                   const rocblas_int nrhs,
+                                   U A,
+                                   const rocblas_int lda,
+                                   rocblas_int* ipiv,
+                                   U B,
+                                   const rocblas_int ldb,
+                                   rocblas_int* info)
+{
+    ROCSOLVER_ENTER_TOP("gbsv", "-n", n, "--kl", kl, "--ku", ku, "--nrhs", nrhs, "--lda", lda,
+                        "--ldb", ldb);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st
+        = rocsolver_gbsv_argCheck(handle, n, kl, ku, nrhs, lda, ldb, A, B, ipiv, info);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftB = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideB = 0;
+    rocblas_stride strideP = 0;
+    rocblas_int batch_count = 1;
+
+    // this function does not require memory work space
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_size_unchanged;
+
+    // execution
+    return rocsolver_gbsv_template<T>(handle, n, kl, ku, nrhs, A, shiftA, lda, strideA, ipiv,
+                                      strideP, B, shiftB, ldb, strideB, info, batch_count);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgbsv(rocblas_handle handle,
+                               const rocblas_int n,
+                               const rocblas_int kl,
+                               const rocblas_int ku,
+                               const rocblas_int nrhs,
+                               float* A,
+                               const rocblas_int lda,
+                               rocblas_int* ipiv,
+                               float* B,
+                               const rocblas_int ldb,
+                               rocblas_int* info)
+{
+    return rocsolver_gbsv_impl<float>(handle, n, kl, ku, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+rocblas_status rocsolver_dgbsv(rocblas_handle handle,
+                               const rocblas_int n,
+                               const rocblas_int kl,
+                               const rocblas_int ku,
+                               const rocblas_int nrhs,
+                               double* A,
+                               const rocblas_int lda,
+                               rocblas_int* ipiv,
+                               double* B,
+                               const rocblas_int ldb,
+                               rocblas_int* info)
+{
+    return rocsolver_gbsv_impl<double>(handle, n, kl, ku, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+rocblas_status rocsolver_cgbsv(rocblas_handle handle,
+                               const rocblas_int n,
+                               const rocblas_int kl,
+                               const rocblas_int ku,
+                               const rocblas_int nrhs,
+                               rocblas_float_complex* A,
+                               const rocblas_int lda,
+                               rocblas_int* ipiv,
+                               rocblas_float_complex* B,
+                               const rocblas_int ldb,
+                               rocblas_int* info)
+{
+    return rocsolver_gbsv_impl<rocblas_float_complex>(handle, n, kl, ku, nrhs, A, lda, ipiv, B, ldb,
+                                                      info);
+}
+
+rocblas_status rocsolver_zgbsv(rocblas_handle handle,
+                               const rocblas_int n,
+                               const rocblas_int kl,
+                               const rocblas_int ku,
+                               const rocblas_int nrhs,
+                               rocblas_double_complex* A,
+                               const rocblas_int lda,
+                               rocblas_int* ipiv,
+                               rocblas_double_complex* B,
+                               const rocblas_int ldb,
+                               rocblas_int* info)
+{
+    return rocsolver_gbsv_impl<rocblas_double_complex>(handle, n, kl, ku, nrhs, A, lda, ipiv, B,
+                                                       ldb, info);
+}
+
+} // extern C
@@ -0,0 +1,111 @@
+/*****************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_gbtrf.hpp"
+#include "roclapack_gbtrs.hpp"
+#include "rocsolver/rocsolver.h"
+
+template <typename T>
+rocblas_status rocsolver_gbsv_argCheck(rocblas_handle handle,
+                                       const rocblas_int n,
+                                       const rocblas_int kl,
+                                       const rocblas_int ku,
+                                       const rocblas_int nrhs,
+                                       const rocblas_int lda,
+                                       const rocblas_int ldb,
+                                       T A,
+                                       T B,
+                                       const rocblas_int* ipiv,
+                                       const rocblas_int* info,
+                                       const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(n < 0 || kl < 0 || ku < 0 || nrhs < 0 || lda < 2 * kl + ku + 1 || ldb < n
+       || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n && !ipiv) || (nrhs && n && !B) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_gbsv_template(rocblas_handle handle,
+                                       const rocblas_int n,
+                                       const rocblas_int kl,
+                                       const rocblas_int ku,
+                                       const rocblas_int nrhs,
+                                       U A,
+                                       const rocblas_int shiftA,
+                                       const rocblas_int lda,
+                                       const rocblas_stride strideA,
+                                       rocblas_int* ipiv,
+                                       const rocblas_stride strideP,
+                                       U B,
+                                       const rocblas_int shiftB,
+                                       const rocblas_int ldb,
+                                       const rocblas_stride strideB,
+                                       rocblas_int* info,
+                                       const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("gbsv", "n:", n, "kl:", kl, "ku:", ku, "nrhs:", nrhs, "shiftA:", shiftA, "lda:",
+                    lda, "shiftB:", shiftB, "ldb:", ldb, "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    // compute LU factorization of A
+    rocsolver_gbtrf_template<T>(handle, n, n, kl, ku, A, shiftA, lda, strideA, ipiv, strideP, info,
+                                batch_count);
+
+    // solve AX = B, overwriting B with X
+    // (the instances with singular matrices are left unchanged)
+    rocsolver_gbtrs_template<T>(handle, rocblas_operation_none, n, kl, ku, nrhs, A, shiftA, lda,
+                                strideA, ipiv, strideP, B, shiftB, ldb, strideB, batch_count, info);
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,128 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_gbtrf.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_gbtrf_impl(rocblas_handle handle,
+                                    const rocblas_int m,
+                                    const rocblas_int n,
+                                    const rocblas_int kl,
+                                    const rocblas_int ku,
+                                    U A,
+                                    const rocblas_int lda,
+                                    rocblas_int* ipiv,
+                                    rocblas_int* info)
+{
+    ROCSOLVER_ENTER_TOP("gbtrf", "-m", m, "-n", n, "--kl", kl, "--ku", ku, "--lda", lda);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_gbtrf_argCheck(handle, m, n, kl, ku, lda, A, ipiv, info);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideP = 0;
+    rocblas_int batch_count = 1;
+
+    // this function does not require memory work space
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_size_unchanged;
+
+    // execution
+    return rocsolver_gbtrf_template<T>(handle, m, n, kl, ku, A, shiftA, lda, strideA, ipiv, strideP,
+                                       info, batch_count);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgbtrf(rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                const rocblas_int kl,
+                                const rocblas_int ku,
+                                float* A,
+                                const rocblas_int lda,
+                                rocblas_int* ipiv,
+                                rocblas_int* info)
+{
+    return rocsolver_gbtrf_impl<float>(handle, m, n, kl, ku, A, lda, ipiv, info);
+}
+
+rocblas_status rocsolver_dgbtrf(rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                const rocblas_int kl,
+                                const rocblas_int ku,
+                                double* A,
+                                const rocblas_int lda,
+                                rocblas_int* ipiv,
+                                rocblas_int* info)
+{
+    return rocsolver_gbtrf_impl<double>(handle, m, n, kl, ku, A, lda, ipiv, info);
+}
+
+rocblas_status rocsolver_cgbtrf(rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                const rocblas_int kl,
+                                const rocblas_int ku,
+                                rocblas_float_complex* A,
+                                const rocblas_int lda,
+                                rocblas_int* ipiv,
+                                rocblas_int* info)
+{
+    return rocsolver_gbtrf_impl<rocblas_float_complex>(handle, m, n, kl, ku, A, lda, ipiv, info);
+}
+
+rocblas_status rocsolver_zgbtrf(rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                const rocblas_int kl,
+                                const rocblas_int ku,
+                                rocblas_double_complex* A,
+                                const rocblas_int lda,
+                                rocblas_int* ipiv,
+                                rocblas_int* info)
+{
+    return rocsolver_gbtrf_impl<rocblas_double_complex>(handle, m, n, kl, ku, A, lda, ipiv, info);
+}
+
+} // extern C
@@ -0,0 +1,279 @@
+/*****************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "lapack_device_functions.hpp"
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_handle_state.hpp"
+
+/** GBTRF_KERNEL computes the LU factorization with partial pivoting of one band matrix
+    per thread block. The (kl+1)-by-(kl+ku+1) window of the band affected by each step is
+    kept in the LDS (if use_lds is true), reusing its columns circularly as the factorization
+    advances; the columns leaving the window are written back to global memory. Otherwise,
+    the kernel works directly on the band storage in global memory. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BAND_BLOCKSIZE)
+    gbtrf_kernel(const rocblas_int m,
+                 const rocblas_int n,
+                 const rocblas_int kl,
+                 const rocblas_int ku,
+                 U AA,
+                 const rocblas_int shiftA,
+                 const rocblas_int lda,
+                 const rocblas_stride strideA,
+                 rocblas_int* ipivA,
+                 const rocblas_stride strideP,
+                 rocblas_int* infoA,
+                 const bool use_lds)
+{
+    using S = decltype(std::real(T{}));
+
+    rocblas_int bid = hipBlockIdx_x;
+    rocblas_int tid = hipThreadIdx_x;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    rocblas_int* ipiv = ipivA + bid * strideP;
+
+    // shared memory setup
+    __shared__ S sval[BAND_BLOCKSIZE];
+    __shared__ rocblas_int sidx[BAND_BLOCKSIZE];
+    extern __shared__ double lmem[];
+    T* W = reinterpret_cast<T*>(lmem);
+
+    // element (i,c) of the matrix is stored in position kv+i-c of column c
+    const rocblas_int kv = kl + ku;
+    const rocblas_int ldw = kv + kl + 1;
+    const rocblas_int nw = kv + 1;
+    const rocblas_int dim = std::min(m, n);
+
+    // returns the position of column c of the band in the window
+    auto col = [&](rocblas_int c) { return use_lds ? W + (c % nw) * ldw : A + c * lda; };
+
+    // brings column c into the window, zeroing the elements of the fill-in
+    auto load_col = [&](rocblas_int c) {
+        T* w = col(c);
+        for(rocblas_int r = tid; r < ldw; r += BAND_BLOCKSIZE)
+        {
+            rocblas_int i = r - kv + c;
+            if(i >= 0 && i < m)
+            {
+                if(r < kl)
+                    w[r] = 0;
+                else if(use_lds)
+                    w[r] = A[r + c * lda];
+            }
+        }
+    };
+
+    // writes column c of the window back to global memory
+    auto store_col = [&](rocblas_int c) {
+        T* w = col(c);
+        for(rocblas_int r = tid; r < ldw; r += BAND_BLOCKSIZE)
+        {
+            rocblas_int i = r - kv + c;
+            if(i >= 0 && i < m)
+                A[r + c * lda] = w[r];
+        }
+    };
+
+    for(rocblas_int c = 0; c < std::min(nw, n); c++)
+        load_col(c);
+    __syncthreads();
+
+    // last column affected by the row interchanges so far
+    rocblas_int ju = 0;
+    rocblas_int myinfo = 0;
+
+    for(rocblas_int j = 0; j < dim; j++)
+    {
+        T* wj = col(j);
+        rocblas_int km = std::min(kl, m - 1 - j);
+
+        // find pivot
+        iamax<BAND_BLOCKSIZE>(tid, km + 1, wj + kv, 1, sval, sidx);
+        __syncthreads();
+        rocblas_int jp = sidx[0] - 1;
+        T pivot = wj[kv + jp];
+        __syncthreads();
+
+        if(tid == 0)
+            ipiv[j] = j + jp + 1; // use fortran 1-based index
+
+        if(pivot != T(0))
+        {
+            ju = std::max(ju, std::min(j + ku + jp, n - 1));
+
+            // interchange rows j and j+jp in columns j to ju
+            if(jp != 0)
+            {
+                for(rocblas_int c = j + tid; c <= ju; c += BAND_BLOCKSIZE)
+                {
+                    T* w = col(c);
+                    swap(w[kv + j - c], w[kv + j + jp - c]);
+                }
+                __syncthreads();
+            }
+
+            // compute multipliers
+            for(rocblas_int i = tid; i < km; i += BAND_BLOCKSIZE)
+                wj[kv + 1 + i] /= pivot;
+            __syncthreads();
+
+            // update trailing part of the window
+            rocblas_int nu = ju - j;
+            for(rocblas_int k = tid; k < km * nu; k += BAND_BLOCKSIZE)
+            {
+                rocblas_int i = k % km;
+                rocblas_int c = j + 1 + k / km;
+                T* w = col(c);
+                w[kv + j + 1 + i - c] -= wj[kv + 1 + i] * w[kv + j - c];
+            }
+        }
+        else if(myinfo == 0)
+            myinfo = j + 1; // use fortran 1-based index
+        __syncthreads();
+
+        // slide the window: column j is final and column j+kv+1 is brought in
+        if(use_lds)
+            store_col(j);
+        if(j + nw < n && j + 1 < dim)
+        {
+            __syncthreads();
+            load_col(j + nw);
+        }
+        __syncthreads();
+    }
+
+    // write back the columns remaining in the window
+    if(use_lds)
+    {
+        for(rocblas_int c = dim; c < std::min(dim + kv, n); c++)
+            store_col(c);
+    }
+
+    if(tid == 0)
+        infoA[bid] = myinfo;
+}
+
+/** GBTRF_LDS_SIZE returns the size in bytes of the window of the band kept in the LDS by
+    GBTRF_KERNEL, or 0 if it does not fit in the LDS of the given architecture. **/
+template <typename T>
+size_t rocsolver_gbtrf_lds_size(const rocblas_int kl,
+                                const rocblas_int ku,
+                                const rocsolver_arch_info& arch)
+{
+    using S = decltype(std::real(T{}));
+
+    size_t size = sizeof(T) * size_t(2 * kl + ku + 1) * (kl + ku + 1);
+    size_t avail = size_t(arch.lds_size) - BAND_BLOCKSIZE * (sizeof(S) + sizeof(rocblas_int));
+    return (size <= avail) ? size : 0;
+}
+
+template <typename T>
+rocblas_status rocsolver_gbtrf_argCheck(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int kl,
+                                        const rocblas_int ku,
+                                        const rocblas_int lda,
+                                        T A,
+                                        rocblas_int* ipiv,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || kl < 0 || ku < 0 || lda < 2 * kl + ku + 1 || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m && n && !A) || (m && n && !ipiv) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_gbtrf_template(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int kl,
+                                        const rocblas_int ku,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        rocblas_int* ipiv,
+                                        const rocblas_stride strideP,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("gbtrf", "m:", m, "n:", n, "kl:", kl, "ku:", ku, "shiftA:", shiftA, "lda:", lda,
+                    "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // quick return if no dimensions
+    if(m == 0 || n == 0)
+    {
+        rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(blocks, 1, 1), dim3(BS1, 1, 1), 0, stream, info,
+                                batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    // the window is kept in the LDS when it fits
+    const rocsolver_arch_info arch = rocsolver_handle_state_map::get_arch(handle);
+    size_t lmemsize = rocsolver_gbtrf_lds_size<T>(kl, ku, arch);
+
+    ROCSOLVER_LAUNCH_KERNEL(gbtrf_kernel<T>, dim3(batch_count, 1, 1), dim3(BAND_BLOCKSIZE, 1, 1),
+                            lmemsize, stream, m, n, kl, ku, A, shiftA, lda, strideA, ipiv, strideP,
+                            info, lmemsize > 0);
+
+    return rocblas_status_success;
+}
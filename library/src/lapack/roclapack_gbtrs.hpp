@@ -0,0 +1,204 @@
+/*****************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "lapack_device_functions.hpp"
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+/** GBTRS_KERNEL solves op(A)*X = B for one right-hand side per thread block, using the
+    band LU factorization computed by GBTRF. If info is not null, the instances with
+    info != 0 (singular matrices) are skipped. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BAND_BLOCKSIZE)
+    gbtrs_kernel(const rocblas_operation trans,
+                 const rocblas_int n,
+                 const rocblas_int kl,
+                 const rocblas_int ku,
+                 U AA,
+                 const rocblas_int shiftA,
+                 const rocblas_int lda,
+                 const rocblas_stride strideA,
+                 const rocblas_int* ipivA,
+                 const rocblas_stride strideP,
+                 U BB,
+                 const rocblas_int shiftB,
+                 const rocblas_int ldb,
+                 const rocblas_stride strideB,
+                 const rocblas_int* info)
+{
+    rocblas_int rhs = hipBlockIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int tid = hipThreadIdx_x;
+
+    if(info && info[bid] != 0)
+        return;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    T* B = load_ptr_batch<T>(BB, bid, shiftB, strideB);
+    const rocblas_int* ipiv = ipivA + bid * strideP;
+    T* x = B + rhs * ldb;
+
+    // shared memory setup
+    __shared__ T sval[BAND_BLOCKSIZE];
+
+    // U has kv super-diagonals, and the multipliers of L are stored below the diagonal
+    const rocblas_int kv = kl + ku;
+    const bool cnj = (trans == rocblas_operation_conjugate_transpose);
+
+    if(trans == rocblas_operation_none)
+    {
+        // solve L*Y = P*B, overwriting B with Y
+        for(rocblas_int j = 0; kl > 0 && j < n - 1; j++)
+        {
+            rocblas_int lm = std::min(kl, n - 1 - j);
+            rocblas_int l = ipiv[j] - 1;
+            if(tid == 0 && l != j)
+                swap(x[l], x[j]);
+            __syncthreads();
+
+            T xj = x[j];
+            for(rocblas_int i = tid; i < lm; i += BAND_BLOCKSIZE)
+                x[j + 1 + i] -= A[kv + 1 + i + j * lda] * xj;
+            __syncthreads();
+        }
+
+        // solve U*X = Y, overwriting B with X
+        tbsv<BAND_BLOCKSIZE>(tid, rocblas_fill_upper, trans, rocblas_diagonal_non_unit, n, kv, A,
+                             lda, x, sval);
+    }
+    else
+    {
+        // solve U'*Y = B, overwriting B with Y
+        tbsv<BAND_BLOCKSIZE>(tid, rocblas_fill_upper, trans, rocblas_diagonal_non_unit, n, kv, A,
+                             lda, x, sval);
+
+        // solve L'*X = Y and apply the row interchanges, overwriting B with X
+        for(rocblas_int j = n - 2; kl > 0 && j >= 0; j--)
+        {
+            rocblas_int lm = std::min(kl, n - 1 - j);
+            T temp = 0;
+            for(rocblas_int i = tid; i < lm; i += BAND_BLOCKSIZE)
+            {
+                T a = A[kv + 1 + i + j * lda];
+                temp += (cnj ? conj(a) : a) * x[j + 1 + i];
+            }
+            temp = block_sum<BAND_BLOCKSIZE>(tid, temp, sval);
+
+            if(tid == 0)
+            {
+                x[j] -= temp;
+                rocblas_int l = ipiv[j] - 1;
+                if(l != j)
+                    swap(x[l], x[j]);
+            }
+            __syncthreads();
+        }
+    }
+}
+
+template <typename T>
+rocblas_status rocsolver_gbtrs_argCheck(rocblas_handle handle,
+                                        const rocblas_operation trans,
+                                        const rocblas_int n,
+                                        const rocblas_int kl,
+                                        const rocblas_int ku,
+                                        const rocblas_int nrhs,
+                                        const rocblas_int lda,
+                                        const rocblas_int ldb,
+                                        T A,
+                                        T B,
+                                        const rocblas_int* ipiv,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(trans != rocblas_operation_none && trans != rocblas_operation_transpose
+       && trans != rocblas_operation_conjugate_transpose)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || kl < 0 || ku < 0 || nrhs < 0 || lda < 2 * kl + ku + 1 || ldb < n
+       || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n && !ipiv) || (nrhs && n && !B))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_gbtrs_template(rocblas_handle handle,
+                                        const rocblas_operation trans,
+                                        const rocblas_int n,
+                                        const rocblas_int kl,
+                                        const rocblas_int ku,
+                                        const rocblas_int nrhs,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        const rocblas_int* ipiv,
+                                        const rocblas_stride strideP,
+                                        U B,
+                                        const rocblas_int shiftB,
+                                        const rocblas_int ldb,
+                                        const rocblas_stride strideB,
+                                        const rocblas_int batch_count,
+                                        const rocblas_int* info)
+{
+    ROCSOLVER_ENTER("gbtrs", "trans:", trans, "n:", n, "kl:", kl, "ku:", ku, "nrhs:", nrhs,
+                    "shiftA:", shiftA, "lda:", lda, "shiftB:", shiftB, "ldb:", ldb, "bc:",
+                    batch_count);
+
+    // quick return
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    ROCSOLVER_LAUNCH_KERNEL(gbtrs_kernel<T>, dim3(nrhs, batch_count, 1), dim3(BAND_BLOCKSIZE, 1, 1),
+                            0, stream, trans, n, kl, ku, A, shiftA, lda, strideA, ipiv, strideP, B,
+                            shiftB, ldb, strideB, info);
+
+    return rocblas_status_success;
+}
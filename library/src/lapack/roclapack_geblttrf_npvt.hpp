@@ -82,6 +82,23 @@ void rocsolver_geblttrf_npvt_getMemorySize(const rocblas_int nb,
         return;
     }
 
+    // the fused kernel for small block sizes requires no workspace
+    if(nb <= GEBLTTR_SMALL_MAX_NB(T))
+    {
+        *size_scalars = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_pivotval = 0;
+        *size_pivotidx = 0;
+        *size_iipiv = 0;
+        *size_iinfo1 = 0;
+        *size_iinfo2 = 0;
+        *optim_mem = true;
+        return;
+    }
+
     bool unused;
     size_t a1 = 0, a2 = 0;
     size_t b1 = 0, b2 = 0;
@@ -194,6 +211,12 @@ rocblas_status rocsolver_geblttrf_npvt_template(rocblas_handle handle,
     if(nb == 0 || nblocks == 0 || batch_count == 0)
         return rocblas_status_success;
 
+    // fused kernel for small block sizes
+    if(nb <= GEBLTTR_SMALL_MAX_NB(T))
+        return geblttrf_npvt_run_small<T>(handle, nb, nblocks, A, shiftA, inca, lda, strideA, B,
+                                          shiftB, incb, ldb, strideB, C, shiftC, incc, ldc, strideC,
+                                          info, batch_count);
+
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
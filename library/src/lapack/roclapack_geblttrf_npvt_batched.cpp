@@ -78,7 +78,7 @@ rocblas_status rocsolver_geblttrf_npvt_batched_impl(rocblas_handle handle,
         &size_pivotval, &size_pivotidx, &size_iipiv, &size_iinfo1, &size_iinfo2, &optim_mem);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(
             handle, size_scalars, size_work1, size_work2, size_work3, size_work4, size_pivotval,
             size_pivotidx, size_iipiv, size_iinfo1, size_iinfo2);
 
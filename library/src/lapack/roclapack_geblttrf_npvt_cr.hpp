@@ -0,0 +1,508 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_getrf.hpp"
+#include "roclapack_getrs.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_run_specialized_kernels.hpp"
+
+/** The block cyclic reduction works by levels. At level l, the block rows that remain
+    are the rows i with (i+1) divisible by s = 2^l. Among them, the rows s-1, 3s-1, 5s-1, ...
+    are eliminated, and the rows 2s-1, 4s-1, ... are kept and coupled among them to form
+    the block tridiagonal system of the next level. The k-th eliminated row is then
+    e_k = s-1 + 2sk and the k-th kept row is j_k = 2s-1 + 2sk. All the sub-problems of a level
+    (for all the rows and all the batch instances) are solved with a single call to the
+    batched building blocks, using arrays of pointers with entry k*batch_count + b pointing to
+    the block of row k in batch instance b.
+
+    The diagonal blocks of every level are stored in B. The off-diagonal blocks of level 0
+    are the blocks A and C, and those of the levels l > 0 are stored in F, starting at
+    offset geblt_cr_offset(l), with the blocks of the a-th remaining row at 2a*nb*nb (left
+    coupling) and (2a+1)*nb*nb (right coupling). **/
+
+// number of block rows that remain at the given level
+inline rocblas_int geblt_cr_rows(const rocblas_int nblocks, const rocblas_int level)
+{
+    return nblocks >> level;
+}
+
+// number of the last level of the reduction
+inline rocblas_int geblt_cr_levels(const rocblas_int nblocks)
+{
+    rocblas_int level = 0;
+    while(geblt_cr_rows(nblocks, level + 1) > 0)
+        level++;
+    return level;
+}
+
+// offset in F of the coupling blocks of the given level (level > 0)
+inline rocblas_stride
+    geblt_cr_offset(const rocblas_int nb, const rocblas_int nblocks, const rocblas_int level)
+{
+    rocblas_stride offset = 0;
+    for(rocblas_int l = 1; l < level; l++)
+        offset += 2 * rocblas_stride(nb) * nb * geblt_cr_rows(nblocks, l);
+    return offset;
+}
+
+// number of elements of F required by the reduction (2*nb*nb*(nblocks - number of ones
+// in the binary representation of nblocks))
+inline rocblas_stride geblt_cr_size(const rocblas_int nb, const rocblas_int nblocks)
+{
+    return geblt_cr_offset(nb, nblocks, geblt_cr_levels(nblocks) + 1);
+}
+
+/** GEBLT_CR_POINTERS sets ptrs[k*bc + b] to the address of the block at shift + k*rowstride
+    in batch instance b, for k = 0, ..., rows-1.
+
+    Call this kernel with enough threads in x to cover rows*bc. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void geblt_cr_pointers(const rocblas_int rows,
+                                        const rocblas_int bc,
+                                        T** ptrs,
+                                        U M,
+                                        const rocblas_stride shift,
+                                        const rocblas_stride rowstride,
+                                        const rocblas_stride strideM)
+{
+    rocblas_int idx = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(idx < rows * bc)
+    {
+        rocblas_int k = idx / bc;
+        rocblas_int b = idx % bc;
+        ptrs[idx] = load_ptr_batch<T>(M, b, shift + k * rowstride, strideM);
+    }
+}
+
+/** Fills the entries k0 <= k < k1 of the array of pointers ptrs with the blocks located
+    at shift0 + k*rowstride **/
+template <typename T, typename U>
+void geblt_cr_set_pointers(rocblas_handle handle,
+                           const rocblas_int k0,
+                           const rocblas_int k1,
+                           const rocblas_int bc,
+                           T* const* ptrs,
+                           U M,
+                           const rocblas_stride shift0,
+                           const rocblas_stride rowstride,
+                           const rocblas_stride strideM)
+{
+    rocblas_int rows = k1 - k0;
+    if(rows <= 0)
+        return;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (rows * bc - 1) / BS1 + 1;
+    ROCSOLVER_LAUNCH_KERNEL((geblt_cr_pointers<T>), dim3(blocks, 1, 1), dim3(BS1, 1, 1), 0, stream,
+                            rows, bc, (T**)ptrs + k0 * bc, M, shift0 + k0 * rowstride, rowstride,
+                            strideM);
+}
+
+/** Arrays of pointers to the blocks of the eliminated rows (De, Le, Ue) and the kept rows
+    (Dk, Lk, Uk) of one level of the reduction. The coupling blocks of the eliminated rows
+    have leading dimension ldl/ldu and increment incl/incu (those of the kept rows too). **/
+template <typename T>
+struct geblt_cr_level
+{
+    rocblas_int s, ne, nk, nr;
+    rocblas_int ldl, incl, ldu, incu;
+    T* const* De;
+    T* const* Le;
+    T* const* Ue;
+    T* const* Dk;
+    T* const* Lk;
+    T* const* Uk;
+
+    // sets the sizes of the given level and the arrays of pointers to the blocks of
+    // B (diagonal) and A, C or F (off-diagonal)
+    template <typename U>
+    void set(rocblas_handle handle,
+             const rocblas_int nb,
+             const rocblas_int nblocks,
+             const rocblas_int level,
+             const rocblas_int bc,
+             U A,
+             const rocblas_int shiftA,
+             const rocblas_int inca,
+             const rocblas_int lda,
+             const rocblas_stride strideA,
+             U B,
+             const rocblas_int shiftB,
+             const rocblas_int ldb,
+             const rocblas_stride strideB,
+             U C,
+             const rocblas_int shiftC,
+             const rocblas_int incc,
+             const rocblas_int ldc,
+             const rocblas_stride strideC,
+             T* F,
+             const rocblas_stride strideF)
+    {
+        rocblas_int m = geblt_cr_rows(nblocks, level);
+        s = 1 << level;
+        ne = (m + 1) / 2;
+        nk = m / 2;
+        // number of kept rows with a neighbour on the right
+        nr = std::min(nk, ne - 1);
+
+        rocblas_stride bsb = rocblas_stride(ldb) * nb;
+        geblt_cr_set_pointers(handle, 0, ne, bc, De, B, shiftB + (s - 1) * bsb, 2 * s * bsb,
+                              strideB);
+        geblt_cr_set_pointers(handle, 0, nk, bc, Dk, B, shiftB + (2 * s - 1) * bsb, 2 * s * bsb,
+                              strideB);
+
+        if(level == 0)
+        {
+            // row i is coupled to row i-1 by block A_{i-1}, and to row i+1 by block C_i
+            rocblas_stride bsa = rocblas_stride(lda) * nb;
+            rocblas_stride bsc = rocblas_stride(ldc) * nb;
+            ldl = lda;
+            incl = inca;
+            ldu = ldc;
+            incu = incc;
+            geblt_cr_set_pointers(handle, 1, ne, bc, Le, A, shiftA - bsa, 2 * bsa, strideA);
+            geblt_cr_set_pointers(handle, 0, nk, bc, Ue, C, rocblas_stride(shiftC), 2 * bsc,
+                                  strideC);
+            geblt_cr_set_pointers(handle, 0, nk, bc, Lk, A, rocblas_stride(shiftA), 2 * bsa,
+                                  strideA);
+            geblt_cr_set_pointers(handle, 0, nr, bc, Uk, C, shiftC + bsc, 2 * bsc, strideC);
+        }
+        else
+        {
+            rocblas_stride bs = rocblas_stride(nb) * nb;
+            rocblas_stride offset = geblt_cr_offset(nb, nblocks, level);
+            ldl = nb;
+            incl = 1;
+            ldu = nb;
+            incu = 1;
+            geblt_cr_set_pointers(handle, 1, ne, bc, Le, F, offset, 4 * bs, strideF);
+            geblt_cr_set_pointers(handle, 0, nk, bc, Ue, F, offset + bs, 4 * bs, strideF);
+            geblt_cr_set_pointers(handle, 0, nk, bc, Lk, F, offset + 2 * bs, 4 * bs, strideF);
+            geblt_cr_set_pointers(handle, 0, nr, bc, Uk, F, offset + 3 * bs, 4 * bs, strideF);
+        }
+    }
+};
+
+template <typename T>
+ROCSOLVER_KERNEL void geblttrf_cr_update_info(T* info,
+                                              T* iinfo,
+                                              const rocblas_int nb,
+                                              const rocblas_int first,
+                                              const rocblas_int rowstride,
+                                              const rocblas_int rows,
+                                              const rocblas_int bc)
+{
+    int b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(b < bc && info[b] == 0)
+    {
+        // report the first singular block of the level
+        for(rocblas_int k = 0; k < rows; k++)
+        {
+            if(iinfo[k * bc + b] != 0)
+            {
+                info[b] = iinfo[k * bc + b] + (first + k * rowstride) * nb;
+                break;
+            }
+        }
+    }
+}
+
+template <typename T>
+void rocsolver_geblttrf_npvt_cr_getMemorySize(const rocblas_int nb,
+                                              const rocblas_int nblocks,
+                                              const rocblas_int batch_count,
+                                              size_t* size_scalars,
+                                              size_t* size_work1,
+                                              size_t* size_work2,
+                                              size_t* size_work3,
+                                              size_t* size_work4,
+                                              size_t* size_pivotval,
+                                              size_t* size_pivotidx,
+                                              size_t* size_iipiv,
+                                              size_t* size_iinfo1,
+                                              size_t* size_iinfo2,
+                                              size_t* size_ptrs,
+                                              bool* optim_mem,
+                                              const rocblas_int lda = 1,
+                                              const rocblas_int ldb = 1,
+                                              const rocblas_int ldc = 1,
+                                              const rocblas_int inca = 1,
+                                              const rocblas_int incb = 1,
+                                              const rocblas_int incc = 1)
+{
+    // if quick return, no need of workspace
+    if(nb == 0 || nblocks == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_pivotval = 0;
+        *size_pivotidx = 0;
+        *size_iipiv = 0;
+        *size_iinfo1 = 0;
+        *size_iinfo2 = 0;
+        *size_ptrs = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    // all the sub-problems of a level are solved as one batch of pointers; the largest
+    // batch corresponds to the rows eliminated at level 0
+    rocblas_int bcr = ((nblocks + 1) / 2) * batch_count;
+
+    bool unused;
+    size_t w1, w2, w3, w4;
+
+    // size requirements for getrf
+    rocsolver_getrf_getMemorySize<true, false, T>(nb, nb, false, bcr, size_scalars, size_work1,
+                                                  size_work2, size_work3, size_work4, size_pivotval,
+                                                  size_pivotidx, size_iipiv, size_iinfo1,
+                                                  optim_mem, ldb, incb);
+
+    // size requirements for getrs (the right-hand sides are the off-diagonal blocks stored
+    // in A, C or F)
+    rocblas_int ldr[3] = {lda, ldc, nb};
+    rocblas_int incr[3] = {inca, incc, 1};
+    for(int i = 0; i < 3; i++)
+    {
+        rocsolver_getrs_getMemorySize<true, false, T>(rocblas_operation_none, nb, nb, bcr, &w1,
+                                                      &w2, &w3, &w4, &unused, ldb, ldr[i], incb,
+                                                      incr[i]);
+        *size_work1 = std::max(*size_work1, w1);
+        *size_work2 = std::max(*size_work2, w2);
+        *size_work3 = std::max(*size_work3, w3);
+        *size_work4 = std::max(*size_work4, w4);
+    }
+
+    // size for temporary info storage
+    *size_iinfo2 = sizeof(rocblas_int) * bcr;
+
+    // size for the arrays of pointers to the blocks of one level
+    // (De, Le, Ue, Dk, Lk, Uk and the new coupling blocks)
+    *size_ptrs = sizeof(T*) * bcr * 8;
+}
+
+template <typename T>
+rocblas_status rocsolver_geblttrf_npvt_cr_argCheck(rocblas_handle handle,
+                                                   const rocblas_int nb,
+                                                   const rocblas_int nblocks,
+                                                   const rocblas_int lda,
+                                                   const rocblas_int ldb,
+                                                   const rocblas_int ldc,
+                                                   T A,
+                                                   T B,
+                                                   T C,
+                                                   void* F,
+                                                   rocblas_int* info,
+                                                   const rocblas_int batch_count = 1,
+                                                   const rocblas_int inca = 1,
+                                                   const rocblas_int incb = 1,
+                                                   const rocblas_int incc = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(handle == nullptr)
+    {
+        return (rocblas_status_invalid_handle);
+    };
+
+    // 2. invalid size
+    if(nb < 0 || nblocks < 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if(inca < 1 || lda < inca * nb)
+        return rocblas_status_invalid_size;
+    if(incb < 1 || ldb < incb * nb)
+        return rocblas_status_invalid_size;
+    if(incc < 1 || ldc < incc * nb)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((nb && nblocks > 1 && !A) || (nb && nblocks && !B) || (nb && nblocks > 1 && !C)
+       || (nb && nblocks > 1 && !F) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_geblttrf_npvt_cr_template(rocblas_handle handle,
+                                                   const rocblas_int nb,
+                                                   const rocblas_int nblocks,
+                                                   U A,
+                                                   const rocblas_int shiftA,
+                                                   const rocblas_int inca,
+                                                   const rocblas_int lda,
+                                                   const rocblas_stride strideA,
+                                                   U B,
+                                                   const rocblas_int shiftB,
+                                                   const rocblas_int incb,
+                                                   const rocblas_int ldb,
+                                                   const rocblas_stride strideB,
+                                                   U C,
+                                                   const rocblas_int shiftC,
+                                                   const rocblas_int incc,
+                                                   const rocblas_int ldc,
+                                                   const rocblas_stride strideC,
+                                                   T* F,
+                                                   const rocblas_stride strideF,
+                                                   rocblas_int* info,
+                                                   const rocblas_int batch_count,
+                                                   T* scalars,
+                                                   void* work1,
+                                                   void* work2,
+                                                   void* work3,
+                                                   void* work4,
+                                                   T* pivotval,
+                                                   rocblas_int* pivotidx,
+                                                   rocblas_int* iipiv,
+                                                   rocblas_int* iinfo1,
+                                                   rocblas_int* iinfo2,
+                                                   T** ptrs,
+                                                   bool optim_mem)
+{
+    ROCSOLVER_ENTER("geblttrf_npvt_cr", "nb:", nb, "nblocks:", nblocks, "shiftA:", shiftA,
+                    "inca:", inca, "lda:", lda, "shiftB:", shiftB, "incb:", incb, "ldb:", ldb,
+                    "shiftC:", shiftC, "incc:", incc, "ldc:", ldc, "bc:", batch_count);
+
+    // quick return
+    if(nb == 0 || nblocks == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    T one = T(1);
+    T minone = T(-1);
+    T zero = T(0);
+
+    // initialize info and the coupling blocks of the reduced systems
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
+    rocblas_stride size_F = geblt_cr_size(nb, nblocks);
+    if(size_F > 0)
+    {
+        rocblas_int blocks = (size_F - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(reset_batch_info<T>, dim3(blocks, batch_count, 1), threads, 0,
+                                stream, F, strideF, size_F, 0);
+    }
+
+    // arrays of pointers
+    rocblas_int bcr = ((nblocks + 1) / 2) * batch_count;
+    geblt_cr_level<T> lev;
+    lev.De = ptrs;
+    lev.Le = ptrs + bcr;
+    lev.Ue = ptrs + 2 * bcr;
+    lev.Dk = ptrs + 3 * bcr;
+    lev.Lk = ptrs + 4 * bcr;
+    lev.Uk = ptrs + 5 * bcr;
+    T* const* Ln = ptrs + 6 * bcr;
+    T* const* Un = ptrs + 7 * bcr;
+
+    rocblas_int nlevels = geblt_cr_levels(nblocks) + 1;
+    rocblas_stride bs = rocblas_stride(nb) * nb;
+
+    for(rocblas_int l = 0; l < nlevels; l++)
+    {
+        lev.set(handle, nb, nblocks, l, batch_count, A, shiftA, inca, lda, strideA, B, shiftB, ldb,
+                strideB, C, shiftC, incc, ldc, strideC, F, strideF);
+        rocblas_int s = lev.s, ne = lev.ne, nk = lev.nk, nr = lev.nr;
+        rocblas_int bc = batch_count;
+
+        // coupling blocks of the next level
+        rocblas_stride offset = geblt_cr_offset(nb, nblocks, l + 1);
+        geblt_cr_set_pointers(handle, 1, nk, bc, Ln, F, offset, 2 * bs, strideF);
+        geblt_cr_set_pointers(handle, 0, nk - 1, bc, Un, F, offset + bs, 2 * bs, strideF);
+
+        // 1. factorize the diagonal blocks of the eliminated rows
+        rocsolver_getrf_template<true, false, T>(handle, nb, nb, lev.De, 0, incb, ldb, 0,
+                                                 (rocblas_int*)nullptr, 0, 0, iinfo2, ne * bc,
+                                                 scalars, work1, work2, work3, work4, pivotval,
+                                                 pivotidx, iipiv, iinfo1, optim_mem, false);
+
+        ROCSOLVER_LAUNCH_KERNEL(geblttrf_cr_update_info, gridReset, threads, 0, stream, info,
+                                iinfo2, nb, s - 1, 2 * s, ne, bc);
+
+        // 2. scale the coupling blocks of the eliminated rows by the inverse of their
+        // diagonal blocks
+        rocsolver_getrs_template<true, false, T>(
+            handle, rocblas_operation_none, nb, nb, lev.De + bc, 0, incb, ldb, 0,
+            (rocblas_int*)nullptr, 0, lev.Le + bc, 0, lev.incl, lev.ldl, 0, (ne - 1) * bc, work1,
+            work2, work3, work4, optim_mem, false);
+
+        rocsolver_getrs_template<true, false, T>(handle, rocblas_operation_none, nb, nb, lev.De, 0,
+                                                 incb, ldb, 0, (rocblas_int*)nullptr, 0, lev.Ue, 0,
+                                                 lev.incu, lev.ldu, 0, nk * bc, work1, work2, work3,
+                                                 work4, optim_mem, false);
+
+        // 3. update the diagonal blocks of the kept rows
+        rocsolver_gemm<true, false, T>(handle, rocblas_operation_none, rocblas_operation_none, nb,
+                                       nb, nb, &minone, lev.Lk, 0, lev.incl, lev.ldl, 0, lev.Ue, 0,
+                                       lev.incu, lev.ldu, 0, &one, lev.Dk, 0, incb, ldb, 0, nk * bc,
+                                       (T**)nullptr);
+
+        rocsolver_gemm<true, false, T>(handle, rocblas_operation_none, rocblas_operation_none, nb,
+                                       nb, nb, &minone, lev.Uk, 0, lev.incu, lev.ldu, 0,
+                                       lev.Le + bc, 0, lev.incl, lev.ldl, 0, &one, lev.Dk, 0, incb,
+                                       ldb, 0, nr * bc, (T**)nullptr);
+
+        // 4. compute the coupling blocks of the next level
+        rocsolver_gemm<true, false, T>(handle, rocblas_operation_none, rocblas_operation_none, nb,
+                                       nb, nb, &minone, lev.Lk + bc, 0, lev.incl, lev.ldl, 0,
+                                       lev.Le + bc, 0, lev.incl, lev.ldl, 0, &zero, Ln + bc, 0, 1,
+                                       nb, 0, (nk - 1) * bc, (T**)nullptr);
+
+        rocsolver_gemm<true, false, T>(handle, rocblas_operation_none, rocblas_operation_none, nb,
+                                       nb, nb, &minone, lev.Uk, 0, lev.incu, lev.ldu, 0,
+                                       lev.Ue + bc, 0, lev.incu, lev.ldu, 0, &zero, Un, 0, 1, nb, 0,
+                                       (nk - 1) * bc, (T**)nullptr);
+    }
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
@@ -57,6 +57,17 @@ void rocsolver_geblttrs_npvt_getMemorySize(const rocblas_int nb,
         return;
     }
 
+    // the fused kernel for small block sizes requires no workspace
+    if(nb <= GEBLTTR_SMALL_MAX_NB(T))
+    {
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *optim_mem = true;
+        return;
+    }
+
     // size requirements for getrs
     rocsolver_getrs_getMemorySize<BATCHED, STRIDED, T>(rocblas_operation_none, nb, nrhs, batch_count,
                                                        size_work1, size_work2, size_work3,
@@ -155,6 +166,12 @@ rocblas_status rocsolver_geblttrs_npvt_template(rocblas_handle handle,
     if(nb == 0 || nblocks == 0 || nrhs == 0 || batch_count == 0)
         return rocblas_status_success;
 
+    // fused kernel for small block sizes
+    if(nb <= GEBLTTR_SMALL_MAX_NB(T))
+        return geblttrs_npvt_run_small<T>(handle, nb, nblocks, nrhs, A, shiftA, inca, lda, strideA,
+                                          B, shiftB, incb, ldb, strideB, C, shiftC, incc, ldc,
+                                          strideC, X, shiftX, incx, ldx, strideX, batch_count);
+
     T one = T(1);
     T minone = T(-1);
 
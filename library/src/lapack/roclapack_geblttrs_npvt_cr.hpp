@@ -0,0 +1,249 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_geblttrf_npvt_cr.hpp"
+#include "roclapack_getrs.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_run_specialized_kernels.hpp"
+
+template <typename T>
+void rocsolver_geblttrs_npvt_cr_getMemorySize(const rocblas_int nb,
+                                              const rocblas_int nblocks,
+                                              const rocblas_int nrhs,
+                                              const rocblas_int batch_count,
+                                              size_t* size_work1,
+                                              size_t* size_work2,
+                                              size_t* size_work3,
+                                              size_t* size_work4,
+                                              size_t* size_ptrs,
+                                              bool* optim_mem,
+                                              const rocblas_int ldb = 1,
+                                              const rocblas_int ldx = 1,
+                                              const rocblas_int incb = 1,
+                                              const rocblas_int incx = 1)
+{
+    // if quick return, no need of workspace
+    if(nb == 0 || nblocks == 0 || nrhs == 0 || batch_count == 0)
+    {
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_ptrs = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    // all the sub-problems of a level are solved as one batch of pointers
+    rocblas_int bcr = ((nblocks + 1) / 2) * batch_count;
+
+    // size requirements for getrs
+    rocsolver_getrs_getMemorySize<true, false, T>(rocblas_operation_none, nb, nrhs, bcr,
+                                                  size_work1, size_work2, size_work3, size_work4,
+                                                  optim_mem, ldb, ldx, incb, incx);
+
+    // size for the arrays of pointers to the blocks of one level
+    // (De, Le, Ue, Dk, Lk, Uk and the blocks of X)
+    *size_ptrs = sizeof(T*) * bcr * 8;
+}
+
+template <typename T>
+rocblas_status rocsolver_geblttrs_npvt_cr_argCheck(rocblas_handle handle,
+                                                   const rocblas_int nb,
+                                                   const rocblas_int nblocks,
+                                                   const rocblas_int nrhs,
+                                                   const rocblas_int lda,
+                                                   const rocblas_int ldb,
+                                                   const rocblas_int ldc,
+                                                   const rocblas_int ldx,
+                                                   T A,
+                                                   T B,
+                                                   T C,
+                                                   const void* F,
+                                                   T X,
+                                                   const rocblas_int batch_count = 1,
+                                                   const rocblas_int inca = 1,
+                                                   const rocblas_int incb = 1,
+                                                   const rocblas_int incc = 1,
+                                                   const rocblas_int incx = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(handle == nullptr)
+    {
+        return (rocblas_status_invalid_handle);
+    };
+
+    // 2. invalid size
+    if(nb < 0 || nblocks < 0 || nrhs < 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if(inca < 1 || lda < inca * nb)
+        return rocblas_status_invalid_size;
+    if(incb < 1 || ldb < incb * nb)
+        return rocblas_status_invalid_size;
+    if(incc < 1 || ldc < incc * nb)
+        return rocblas_status_invalid_size;
+    if(incx < 1 || ldx < incx * nb)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((nb && nblocks > 1 && !A) || (nb && nblocks && !B) || (nb && nblocks > 1 && !C)
+       || (nb && nblocks > 1 && !F) || (nb && nblocks && nrhs && !X))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_geblttrs_npvt_cr_template(rocblas_handle handle,
+                                                   const rocblas_int nb,
+                                                   const rocblas_int nblocks,
+                                                   const rocblas_int nrhs,
+                                                   U A,
+                                                   const rocblas_int shiftA,
+                                                   const rocblas_int inca,
+                                                   const rocblas_int lda,
+                                                   const rocblas_stride strideA,
+                                                   U B,
+                                                   const rocblas_int shiftB,
+                                                   const rocblas_int incb,
+                                                   const rocblas_int ldb,
+                                                   const rocblas_stride strideB,
+                                                   U C,
+                                                   const rocblas_int shiftC,
+                                                   const rocblas_int incc,
+                                                   const rocblas_int ldc,
+                                                   const rocblas_stride strideC,
+                                                   T* F,
+                                                   const rocblas_stride strideF,
+                                                   U X,
+                                                   const rocblas_int shiftX,
+                                                   const rocblas_int incx,
+                                                   const rocblas_int ldx,
+                                                   const rocblas_stride strideX,
+                                                   const rocblas_int batch_count,
+                                                   void* work1,
+                                                   void* work2,
+                                                   void* work3,
+                                                   void* work4,
+                                                   T** ptrs,
+                                                   bool optim_mem)
+{
+    ROCSOLVER_ENTER("geblttrs_npvt_cr", "nb:", nb, "nblocks:", nblocks, "nrhs:", nrhs,
+                    "shiftA:", shiftA, "inca:", inca, "lda:", lda, "shiftB:", shiftB, "incb:", incb,
+                    "ldb:", ldb, "shiftC:", shiftC, "incc:", incc, "ldc:", ldc, "shiftX:", shiftX,
+                    "incx:", incx, "ldx:", ldx, "bc:", batch_count);
+
+    // quick return
+    if(nb == 0 || nblocks == 0 || nrhs == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    T one = T(1);
+    T minone = T(-1);
+
+    // arrays of pointers
+    rocblas_int bcr = ((nblocks + 1) / 2) * batch_count;
+    geblt_cr_level<T> lev;
+    lev.De = ptrs;
+    lev.Le = ptrs + bcr;
+    lev.Ue = ptrs + 2 * bcr;
+    lev.Dk = ptrs + 3 * bcr;
+    lev.Lk = ptrs + 4 * bcr;
+    lev.Uk = ptrs + 5 * bcr;
+    T* const* Xe = ptrs + 6 * bcr;
+    T* const* Xk = ptrs + 7 * bcr;
+
+    rocblas_int nlevels = geblt_cr_levels(nblocks) + 1;
+    rocblas_int bc = batch_count;
+    rocblas_stride bsx = rocblas_stride(ldx) * nrhs;
+
+    // sets the arrays of pointers of the given level
+    auto set_level = [&](rocblas_int l) {
+        lev.set(handle, nb, nblocks, l, bc, A, shiftA, inca, lda, strideA, B, shiftB, ldb, strideB,
+                C, shiftC, incc, ldc, strideC, F, strideF);
+        geblt_cr_set_pointers(handle, 0, lev.ne, bc, Xe, X, shiftX + (lev.s - 1) * bsx,
+                              2 * lev.s * bsx, strideX);
+        geblt_cr_set_pointers(handle, 0, lev.nk, bc, Xk, X, shiftX + (2 * lev.s - 1) * bsx,
+                              2 * lev.s * bsx, strideX);
+    };
+
+    // forward reduction of the right-hand sides
+    for(rocblas_int l = 0; l < nlevels; l++)
+    {
+        set_level(l);
+
+        // solve with the diagonal blocks of the eliminated rows
+        rocsolver_getrs_template<true, false, T>(handle, rocblas_operation_none, nb, nrhs, lev.De,
+                                                 0, incb, ldb, 0, (rocblas_int*)nullptr, 0, Xe, 0,
+                                                 incx, ldx, 0, lev.ne * bc, work1, work2, work3,
+                                                 work4, optim_mem, false);
+
+        // update the kept rows
+        rocsolver_gemm<true, false, T>(handle, rocblas_operation_none, rocblas_operation_none, nb,
+                                       nrhs, nb, &minone, lev.Lk, 0, lev.incl, lev.ldl, 0, Xe, 0,
+                                       incx, ldx, 0, &one, Xk, 0, incx, ldx, 0, lev.nk * bc,
+                                       (T**)nullptr);
+
+        rocsolver_gemm<true, false, T>(handle, rocblas_operation_none, rocblas_operation_none, nb,
+                                       nrhs, nb, &minone, lev.Uk, 0, lev.incu, lev.ldu, 0, Xe + bc,
+                                       0, incx, ldx, 0, &one, Xk, 0, incx, ldx, 0, lev.nr * bc,
+                                       (T**)nullptr);
+    }
+
+    // backward substitution
+    for(rocblas_int l = nlevels - 1; l >= 0; l--)
+    {
+        set_level(l);
+
+        // update the eliminated rows with the solution of the kept rows
+        rocsolver_gemm<true, false, T>(handle, rocblas_operation_none, rocblas_operation_none, nb,
+                                       nrhs, nb, &minone, lev.Le + bc, 0, lev.incl, lev.ldl, 0, Xk,
+                                       0, incx, ldx, 0, &one, Xe + bc, 0, incx, ldx, 0,
+                                       (lev.ne - 1) * bc, (T**)nullptr);
+
+        rocsolver_gemm<true, false, T>(handle, rocblas_operation_none, rocblas_operation_none, nb,
+                                       nrhs, nb, &minone, lev.Ue, 0, lev.incu, lev.ldu, 0, Xk, 0,
+                                       incx, ldx, 0, &one, Xe, 0, incx, ldx, 0, lev.nk * bc,
+                                       (T**)nullptr);
+    }
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
@@ -80,7 +80,7 @@ rocblas_status rocsolver_gebrd_strided_batched_impl(rocblas_handle handle,
                                             &size_Abyx_norms, &size_X, &size_Y);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work_workArr,
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_scalars, size_work_workArr,
                                                       size_Abyx_norms, size_X, size_Y);
 
     // memory workspace allocation
@@ -66,7 +66,7 @@ rocblas_status rocsolver_gelqf_impl(rocblas_handle handle,
                                             &size_Abyx_norms_trfact, &size_diag_tmptr, &size_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work_workArr,
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_scalars, size_work_workArr,
                                                       size_Abyx_norms_trfact, size_diag_tmptr,
                                                       size_workArr);
 
@@ -27,17 +27,17 @@
 
 #include "roclapack_gels.hpp"
 
-template <typename T, typename U, bool COMPLEX = rocblas_is_complex<T>>
+template <typename T, typename I, typename U, bool COMPLEX = rocblas_is_complex<T>>
 rocblas_status rocsolver_gels_impl(rocblas_handle handle,
                                    rocblas_operation trans,
-                                   const rocblas_int m,
-                                   const rocblas_int n,
-                                   const rocblas_int nrhs,
+                                   const I m,
+                                   const I n,
+                                   const I nrhs,
                                    U A,
-                                   const rocblas_int lda,
+                                   const I lda,
                                    U B,
-                                   const rocblas_int ldb,
-                                   rocblas_int* info)
+                                   const I ldb,
+                                   I* info)
 {
     ROCSOLVER_ENTER_TOP("gels", "--trans", trans, "-m", m, "-n", n, "--nrhs", nrhs, "--lda", lda,
                         "--ldb", ldb);
@@ -52,13 +52,13 @@ rocblas_status rocsolver_gels_impl(rocblas_handle handle,
         return st;
 
     // working with unshifted arrays
-    const rocblas_int shiftA = 0;
-    const rocblas_int shiftB = 0;
+    const rocblas_stride shiftA = 0;
+    const rocblas_stride shiftB = 0;
 
     // normal (non-batched non-strided) execution
     const rocblas_stride strideA = 0;
     const rocblas_stride strideB = 0;
-    const rocblas_int batch_count = 1;
+    const I batch_count = 1;
 
     // memory workspace sizes:
     // size for constants in rocblas calls
@@ -74,7 +74,7 @@ rocblas_status rocsolver_gels_impl(rocblas_handle handle,
         &size_diag_trfac_invA, &size_trfact_workTrmm_invA_arr, &size_ipiv_savedB, &optim_mem);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(
             handle, size_scalars, size_work_x_temp, size_workArr_temp_arr, size_diag_trfac_invA,
             size_trfact_workTrmm_invA_arr, size_ipiv_savedB);
 
@@ -169,4 +169,62 @@ rocblas_status rocsolver_zgels(rocblas_handle handle,
                                                        info);
 }
 
+rocblas_status rocsolver_sgels_64(rocblas_handle handle,
+                                  rocblas_operation trans,
+                                  const int64_t m,
+                                  const int64_t n,
+                                  const int64_t nrhs,
+                                  float* A,
+                                  const int64_t lda,
+                                  float* B,
+                                  const int64_t ldb,
+                                  int64_t* info)
+{
+    return rocsolver_gels_impl<float>(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
+}
+
+rocblas_status rocsolver_dgels_64(rocblas_handle handle,
+                                  rocblas_operation trans,
+                                  const int64_t m,
+                                  const int64_t n,
+                                  const int64_t nrhs,
+                                  double* A,
+                                  const int64_t lda,
+                                  double* B,
+                                  const int64_t ldb,
+                                  int64_t* info)
+{
+    return rocsolver_gels_impl<double>(handle, trans, m, n, nrhs, A, lda, B, ldb, info);
+}
+
+rocblas_status rocsolver_cgels_64(rocblas_handle handle,
+                                  rocblas_operation trans,
+                                  const int64_t m,
+                                  const int64_t n,
+                                  const int64_t nrhs,
+                                  rocblas_float_complex* A,
+                                  const int64_t lda,
+                                  rocblas_float_complex* B,
+                                  const int64_t ldb,
+                                  int64_t* info)
+{
+    return rocsolver_gels_impl<rocblas_float_complex>(handle, trans, m, n, nrhs, A, lda, B, ldb,
+                                                      info);
+}
+
+rocblas_status rocsolver_zgels_64(rocblas_handle handle,
+                                  rocblas_operation trans,
+                                  const int64_t m,
+                                  const int64_t n,
+                                  const int64_t nrhs,
+                                  rocblas_double_complex* A,
+                                  const int64_t lda,
+                                  rocblas_double_complex* B,
+                                  const int64_t ldb,
+                                  int64_t* info)
+{
+    return rocsolver_gels_impl<rocblas_double_complex>(handle, trans, m, n, nrhs, A, lda, B, ldb,
+                                                       info);
+}
+
 } // extern C
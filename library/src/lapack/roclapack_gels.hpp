@@ -34,21 +34,24 @@
 
 #include "auxiliary/rocauxiliary_ormlq_unmlq.hpp"
 #include "auxiliary/rocauxiliary_ormqr_unmqr.hpp"
+#include "auxiliary/rocauxiliary_ormqr_unmqr_tsqr.hpp"
 #include "rocblas.hpp"
 #include "roclapack_gelqf.hpp"
 #include "roclapack_geqrf.hpp"
+#include "roclapack_geqrf_tsqr.hpp"
 #include "rocsolver/rocsolver.h"
 #include "rocsolver_run_specialized_kernels.hpp"
+#include "rocsolver_workspace_breakdown.hpp"
 
-template <typename T, typename U>
+template <typename T, typename I, typename U>
 ROCSOLVER_KERNEL void gels_set_zero(const rocblas_int k1,
                                     const rocblas_int k2,
                                     const rocblas_int nrhs,
                                     U B,
-                                    const rocblas_int shiftB,
+                                    const rocblas_stride shiftB,
                                     const rocblas_int ldb,
                                     const rocblas_stride strideB,
-                                    const rocblas_int* info)
+                                    const I* info)
 {
     const auto b = hipBlockIdx_z;
     const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
@@ -58,16 +61,24 @@ ROCSOLVER_KERNEL void gels_set_zero(const rocblas_int k1,
     {
         T* Bp = load_ptr_batch<T>(B, b, shiftB, strideB);
 
-        Bp[(i + k1) + j * ldb] = 0;
+        Bp[(i + k1) + j * rocblas_stride(ldb)] = 0;
     }
 }
 
-template <bool BATCHED, bool STRIDED, typename T>
+/** GELS_USE_TSQR returns true if the least squares problem with a m-by-n matrix is
+    overdetermined enough to be solved with the tall-skinny QR factorization. **/
+template <typename I>
+inline bool rocsolver_gels_use_tsqr(const I m, const I n)
+{
+    return m >= n && n <= GELS_TSQR_MAX_COLS && m >= GELS_TSQR_RATIO * n;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename I>
 void rocsolver_gels_getMemorySize(const rocblas_operation trans,
-                                  const rocblas_int m,
-                                  const rocblas_int n,
-                                  const rocblas_int nrhs,
-                                  const rocblas_int batch_count,
+                                  const I m,
+                                  const I n,
+                                  const I nrhs,
+                                  const I batch_count,
                                   size_t* size_scalars,
                                   size_t* size_work_x_temp,
                                   size_t* size_workArr_temp_arr,
@@ -77,7 +88,10 @@ void rocsolver_gels_getMemorySize(const rocblas_operation trans,
                                   bool* optim_mem)
 {
     // if quick return no workspace needed
-    if(m == 0 || n == 0 || nrhs == 0 || batch_count == 0)
+    // (the 64-bit APIs do not support leading dimensions larger than INT32_MAX, and ldb is at
+    // least max(m, n))
+    if(m == 0 || n == 0 || nrhs == 0 || batch_count == 0
+       || (std::is_same<I, int64_t>::value && std::max(m, n) >= INT_MAX))
     {
         *size_scalars = 0;
         *size_work_x_temp = 0;
@@ -93,7 +107,19 @@ void rocsolver_gels_getMemorySize(const rocblas_operation trans,
     size_t ormxx_scalars, ormxx_work, ormxx_workArr, ormxx_trfact, ormxx_workTrmm;
     size_t trsm_x_temp, trsm_x_temp_arr, trsm_invA, trsm_invA_arr;
 
-    if(m >= n)
+    // the tall-skinny QR factorization is 32-bit only, so the 64-bit APIs fall back to GEQRF
+    // when the matrices do not fit 32-bit indexing (as the leading dimensions are not known
+    // here, the workspace of GEQRF and ORMQR is always reserved)
+    const bool tsqr = rocsolver_gels_use_tsqr(m, n);
+    const bool qr_fallback = tsqr && std::is_same<I, int64_t>::value;
+
+    if(tsqr && !qr_fallback)
+    {
+        // GEQRF_TSQR and ORMQR_TSQR do not require workspace
+        gexxf_scalars = gexxf_work = gexxf_workArr = gexxf_diag = gexxf_trfact = 0;
+        ormxx_work = ormxx_workArr = ormxx_trfact = ormxx_workTrmm = 0;
+    }
+    else if(m >= n)
     {
         rocsolver_geqrf_getMemorySize<BATCHED, T>(m, n, batch_count, &gexxf_scalars, &gexxf_work,
                                                   &gexxf_workArr, &gexxf_diag, &gexxf_trfact);
@@ -116,9 +142,30 @@ void rocsolver_gels_getMemorySize(const rocblas_operation trans,
         ROCSOLVER_ASSUME_X(gexxf_scalars == ormxx_scalars, "GELQF and ORMLQ use the same scalars");
     }
 
+    if(!tsqr || qr_fallback)
+    {
+        rocsolver_workspace_breakdown::record_subcall(m >= n ? "geqrf" : "gelqf",
+                                                      {{"scalars", gexxf_scalars},
+                                                       {"work_x_temp", gexxf_work},
+                                                       {"workArr_temp_arr", gexxf_workArr},
+                                                       {"diag_trfac_invA", gexxf_diag},
+                                                       {"trfact_workTrmm_invA_arr", gexxf_trfact}});
+        rocsolver_workspace_breakdown::record_subcall(
+            m >= n ? "ormqr_unmqr" : "ormlq_unmlq",
+            {{"work_x_temp", ormxx_work},
+             {"workArr_temp_arr", ormxx_workArr},
+             {"diag_trfac_invA", ormxx_trfact},
+             {"trfact_workTrmm_invA_arr", ormxx_workTrmm}});
+    }
+
     rocsolver_trsm_mem<BATCHED, STRIDED, T>(rocblas_side_left, trans, std::min(m, n), nrhs,
                                             batch_count, &trsm_x_temp, &trsm_x_temp_arr, &trsm_invA,
                                             &trsm_invA_arr, optim_mem);
+    rocsolver_workspace_breakdown::record_subcall("trsm",
+                                                  {{"work_x_temp", trsm_x_temp},
+                                                   {"workArr_temp_arr", trsm_x_temp_arr},
+                                                   {"diag_trfac_invA", trsm_invA},
+                                                   {"trfact_workTrmm_invA_arr", trsm_invA_arr}});
 
     // TODO: rearrange to minimize total size
     *size_scalars = gexxf_scalars;
@@ -132,20 +179,24 @@ void rocsolver_gels_getMemorySize(const rocblas_operation trans,
         *size_ipiv_savedB = sizeof(T) * std::min(m, n) * nrhs * batch_count;
     else
         *size_ipiv_savedB = sizeof(T) * std::max(m, n) * nrhs * batch_count;
+
+    // the Householder scalars of the tall-skinny QR need their own space
+    if(tsqr)
+        *size_ipiv_savedB += sizeof(T) * 2 * m * batch_count;
 }
 
-template <bool COMPLEX, typename T>
+template <bool COMPLEX, typename T, typename I>
 rocblas_status rocsolver_gels_argCheck(rocblas_handle handle,
                                        rocblas_operation trans,
-                                       const rocblas_int m,
-                                       const rocblas_int n,
-                                       const rocblas_int nrhs,
+                                       const I m,
+                                       const I n,
+                                       const I nrhs,
                                        T A,
-                                       const rocblas_int lda,
+                                       const I lda,
                                        T B,
-                                       const rocblas_int ldb,
-                                       rocblas_int* info,
-                                       const rocblas_int batch_count = 1)
+                                       const I ldb,
+                                       I* info,
+                                       const I batch_count = 1)
 {
     // order is important for unit tests:
 
@@ -172,22 +223,22 @@ rocblas_status rocsolver_gels_argCheck(rocblas_handle handle,
     return rocblas_status_continue;
 }
 
-template <bool BATCHED, bool STRIDED, typename T, typename U>
+template <bool BATCHED, bool STRIDED, typename T, typename I, typename U>
 rocblas_status rocsolver_gels_template(rocblas_handle handle,
                                        rocblas_operation trans,
-                                       const rocblas_int m,
-                                       const rocblas_int n,
-                                       const rocblas_int nrhs,
+                                       const I m,
+                                       const I n,
+                                       const I nrhs,
                                        U A,
-                                       const rocblas_int shiftA,
-                                       const rocblas_int lda,
+                                       const rocblas_stride shiftA,
+                                       const I lda,
                                        const rocblas_stride strideA,
                                        U B,
-                                       const rocblas_int shiftB,
-                                       const rocblas_int ldb,
+                                       const rocblas_stride shiftB,
+                                       const I ldb,
                                        const rocblas_stride strideB,
-                                       rocblas_int* info,
-                                       const rocblas_int batch_count,
+                                       I* info,
+                                       const I batch_count,
                                        T* scalars,
                                        T* work_x_temp,
                                        T* workArr_temp_arr,
@@ -203,10 +254,16 @@ rocblas_status rocsolver_gels_template(rocblas_handle handle,
     if(batch_count == 0)
         return rocblas_status_success;
 
+    // the 32-bit interface of rocBLAS requires the leading dimensions and the batch size to
+    // fit in rocblas_int
+    if(std::is_same<I, int64_t>::value
+       && (lda >= INT_MAX || ldb >= INT_MAX || batch_count >= INT_MAX))
+        return rocblas_status_not_implemented;
+
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+    I blocksReset = (batch_count - 1) / BS1 + 1;
     dim3 gridReset(blocksReset, 1, 1);
     dim3 threads(BS1, 1, 1);
 
@@ -220,15 +277,22 @@ rocblas_status rocsolver_gels_template(rocblas_handle handle,
     // quick return if A is empty
     if(m == 0 || n == 0)
     {
-        rocblas_int rowsB = std::max(m, n);
-        rocblas_int blocksx = (rowsB - 1) / 32 + 1;
-        rocblas_int blocksy = (nrhs - 1) / 32 + 1;
+        I rowsB = std::max(m, n);
+        I blocksx = (rowsB - 1) / 32 + 1;
+        I blocksy = (nrhs - 1) / 32 + 1;
         ROCSOLVER_LAUNCH_KERNEL(set_zero<T>, dim3(blocksx, blocksy, batch_count), dim3(32, 32), 0,
                                 stream, rowsB, nrhs, B, shiftB, ldb, strideB);
 
         return rocblas_status_success;
     }
 
+    // the tall-skinny QR and the LQ factorizations are 32-bit only; they are used by the 64-bit
+    // APIs only if A and B can be addressed with 32-bit indices
+    const bool fits
+        = (rocsolver_column_strip(n, lda) == n && rocsolver_column_strip(nrhs, ldb) == nrhs);
+    if(m < n && !fits)
+        return rocblas_status_not_implemented;
+
     // everything must be executed with scalars on the host
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
@@ -236,27 +300,43 @@ rocblas_status rocsolver_gels_template(rocblas_handle handle,
 
     // constants in host memory
     const rocblas_stride strideP = std::min(m, n);
-    const rocblas_int check_threads = std::min(((std::min(m, n) - 1) / 64 + 1) * 64, BS1);
-    const rocblas_int copyblocksmin = (std::min(m, n) - 1) / 32 + 1;
-    const rocblas_int copyblocksmax = (std::max(m, n) - 1) / 32 + 1;
-    const rocblas_int copyblocksy = (nrhs - 1) / 32 + 1;
+    const I check_threads = std::min(((std::min(m, n) - 1) / 64 + 1) * 64, I(BS1));
+    const I copyblocksmin = (std::min(m, n) - 1) / 32 + 1;
+    const I copyblocksmax = (std::max(m, n) - 1) / 32 + 1;
+    const I copyblocksy = (nrhs - 1) / 32 + 1;
 
     // TODO: apply scaling to improve accuracy over a larger range of values
 
     if(m >= n)
     {
+        // very overdetermined systems use the tall-skinny QR factorization, whose
+        // Householder scalars are stored before the saved elements of B
+        const bool tsqr = rocsolver_gels_use_tsqr(m, n) && fits;
+        const rocblas_stride strideT = 2 * m;
+        T* savedB = tsqr ? ipiv_savedB + strideT * batch_count : ipiv_savedB;
+
         // compute QR factorization of A
-        rocsolver_geqrf_template<BATCHED, STRIDED>(
-            handle, m, n, A, shiftA, lda, strideA, ipiv_savedB, strideP, batch_count, scalars,
-            work_x_temp, workArr_temp_arr, diag_trfac_invA, trfact_workTrmm_invA_arr);
+        if(tsqr)
+            rocsolver_geqrf_tsqr_template<T>(handle, m, n, A, shiftA, lda, strideA, ipiv_savedB,
+                                             strideT, batch_count);
+        else
+            rocsolver_geqrf_template<BATCHED, STRIDED>(
+                handle, m, n, A, shiftA, lda, strideA, ipiv_savedB, strideP, batch_count, scalars,
+                work_x_temp, workArr_temp_arr, diag_trfac_invA, trfact_workTrmm_invA_arr);
 
         if(trans == rocblas_operation_none)
         {
-            rocsolver_ormqr_unmqr_template<BATCHED, STRIDED>(
-                handle, rocblas_side_left, rocblas_operation_conjugate_transpose, m, nrhs, n, A,
-                shiftA, lda, strideA, ipiv_savedB, strideP, B, shiftB, ldb, strideB, batch_count,
-                scalars, (T*)work_x_temp, (T*)workArr_temp_arr, (T*)diag_trfac_invA,
-                (T**)trfact_workTrmm_invA_arr);
+            if(tsqr)
+                rocsolver_ormqr_unmqr_tsqr_template<T>(
+                    handle, rocblas_side_left, rocblas_operation_conjugate_transpose, m, nrhs, n,
+                    A, shiftA, lda, strideA, ipiv_savedB, strideT, B, shiftB, ldb, strideB,
+                    batch_count);
+            else
+                rocsolver_ormqr_unmqr_template<BATCHED, STRIDED>(
+                    handle, rocblas_side_left, rocblas_operation_conjugate_transpose, m, nrhs, n,
+                    A, shiftA, lda, strideA, ipiv_savedB, strideP, B, shiftB, ldb, strideB,
+                    batch_count, scalars, (T*)work_x_temp, (T*)workArr_temp_arr,
+                    (T*)diag_trfac_invA, (T**)trfact_workTrmm_invA_arr);
 
             // do the equivalent of trtrs
             ROCSOLVER_LAUNCH_KERNEL(check_singularity<T>, dim3(batch_count, 1, 1),
@@ -266,7 +346,7 @@ rocblas_status rocsolver_gels_template(rocblas_handle handle,
             // save elements of B that will be overwritten in cases where info is nonzero
             ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, U>), dim3(copyblocksmin, copyblocksy, batch_count),
                                     dim3(32, 32), 0, stream, copymat_to_buffer, n, nrhs, B, shiftB,
-                                    ldb, strideB, ipiv_savedB, info_mask(info));
+                                    ldb, strideB, savedB, info_mask(info));
 
             // solve RX = Q'B, overwriting B with X
             rocsolver_trsm_upper<BATCHED, STRIDED, T>(
@@ -277,7 +357,7 @@ rocblas_status rocsolver_gels_template(rocblas_handle handle,
             // restore elements of B that were overwritten in cases where info is nonzero
             ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, U>), dim3(copyblocksmin, copyblocksy, batch_count),
                                     dim3(32, 32), 0, stream, copymat_from_buffer, n, nrhs, B,
-                                    shiftB, ldb, strideB, ipiv_savedB, info_mask(info));
+                                    shiftB, ldb, strideB, savedB, info_mask(info));
         }
         else
         {
@@ -289,7 +369,7 @@ rocblas_status rocsolver_gels_template(rocblas_handle handle,
             // save elements of B that will be overwritten in cases where info is nonzero
             ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, U>), dim3(copyblocksmax, copyblocksy, batch_count),
                                     dim3(32, 32), 0, stream, copymat_to_buffer, m, nrhs, B, shiftB,
-                                    ldb, strideB, ipiv_savedB, info_mask(info));
+                                    ldb, strideB, savedB, info_mask(info));
 
             // solve R'Y = B overwriting B with Y (here Y = Q'X)
             rocsolver_trsm_upper<BATCHED, STRIDED, T>(
@@ -299,21 +379,26 @@ rocblas_status rocsolver_gels_template(rocblas_handle handle,
                 trfact_workTrmm_invA_arr);
 
             // zero row n to m-1 of B in cases where info is zero
-            const rocblas_int zeroblocksx = (m - n - 1) / 32 + 1;
-            ROCSOLVER_LAUNCH_KERNEL((gels_set_zero<T, U>),
+            const I zeroblocksx = (m - n - 1) / 32 + 1;
+            ROCSOLVER_LAUNCH_KERNEL((gels_set_zero<T, I, U>),
                                     dim3(zeroblocksx, copyblocksy, batch_count), dim3(32, 32), 0,
                                     stream, n, m, nrhs, B, shiftB, ldb, strideB, info);
 
-            rocsolver_ormqr_unmqr_template<BATCHED, STRIDED>(
-                handle, rocblas_side_left, rocblas_operation_none, m, nrhs, n, A, shiftA, lda,
-                strideA, ipiv_savedB, strideP, B, shiftB, ldb, strideB, batch_count, scalars,
-                (T*)work_x_temp, (T*)workArr_temp_arr, (T*)diag_trfac_invA,
-                (T**)trfact_workTrmm_invA_arr);
+            if(tsqr)
+                rocsolver_ormqr_unmqr_tsqr_template<T>(
+                    handle, rocblas_side_left, rocblas_operation_none, m, nrhs, n, A, shiftA, lda,
+                    strideA, ipiv_savedB, strideT, B, shiftB, ldb, strideB, batch_count);
+            else
+                rocsolver_ormqr_unmqr_template<BATCHED, STRIDED>(
+                    handle, rocblas_side_left, rocblas_operation_none, m, nrhs, n, A, shiftA, lda,
+                    strideA, ipiv_savedB, strideP, B, shiftB, ldb, strideB, batch_count, scalars,
+                    (T*)work_x_temp, (T*)workArr_temp_arr, (T*)diag_trfac_invA,
+                    (T**)trfact_workTrmm_invA_arr);
 
             // restore elements of B that were overwritten in cases where info is nonzero
             ROCSOLVER_LAUNCH_KERNEL((copy_mat<T, U>), dim3(copyblocksmax, copyblocksy, batch_count),
                                     dim3(32, 32), 0, stream, copymat_from_buffer, m, nrhs, B,
-                                    shiftB, ldb, strideB, ipiv_savedB, info_mask(info));
+                                    shiftB, ldb, strideB, savedB, info_mask(info));
         }
     }
     else
@@ -342,8 +427,8 @@ rocblas_status rocsolver_gels_template(rocblas_handle handle,
                 work_x_temp, workArr_temp_arr, diag_trfac_invA, trfact_workTrmm_invA_arr);
 
             // zero row m to n-1 of B in cases where info is zero
-            const rocblas_int zeroblocksx = (n - m - 1) / 32 + 1;
-            ROCSOLVER_LAUNCH_KERNEL((gels_set_zero<T, U>),
+            const I zeroblocksx = (n - m - 1) / 32 + 1;
+            ROCSOLVER_LAUNCH_KERNEL((gels_set_zero<T, I, U>),
                                     dim3(zeroblocksx, copyblocksy, batch_count), dim3(32, 32), 0,
                                     stream, m, n, nrhs, B, shiftB, ldb, strideB, info);
 
@@ -27,18 +27,18 @@
 
 #include "roclapack_gels.hpp"
 
-template <typename T, typename U, bool COMPLEX = rocblas_is_complex<T>>
+template <typename T, typename I, typename U, bool COMPLEX = rocblas_is_complex<T>>
 rocblas_status rocsolver_gels_batched_impl(rocblas_handle handle,
                                            rocblas_operation trans,
-                                           const rocblas_int m,
-                                           const rocblas_int n,
-                                           const rocblas_int nrhs,
+                                           const I m,
+                                           const I n,
+                                           const I nrhs,
                                            U A,
-                                           const rocblas_int lda,
+                                           const I lda,
                                            U B,
-                                           const rocblas_int ldb,
-                                           rocblas_int* info,
-                                           const rocblas_int batch_count)
+                                           const I ldb,
+                                           I* info,
+                                           const I batch_count)
 {
     ROCSOLVER_ENTER_TOP("gels_batched", "--trans", trans, "-m", m, "-n", n, "--nrhs", nrhs, "--lda",
                         lda, "--ldb", ldb, "--batch_count", batch_count);
@@ -53,8 +53,8 @@ rocblas_status rocsolver_gels_batched_impl(rocblas_handle handle,
         return st;
 
     // working with unshifted arrays
-    const rocblas_int shiftA = 0;
-    const rocblas_int shiftB = 0;
+    const rocblas_stride shiftA = 0;
+    const rocblas_stride shiftB = 0;
 
     // batched execution
     const rocblas_stride strideA = 0;
@@ -74,7 +74,7 @@ rocblas_status rocsolver_gels_batched_impl(rocblas_handle handle,
         &size_diag_trfac_invA, &size_trfact_workTrmm_invA_arr, &size_ipiv_savedB, &optim_mem);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(
             handle, size_scalars, size_work_x_temp, size_workArr_temp_arr, size_diag_trfac_invA,
             size_trfact_workTrmm_invA_arr, size_ipiv_savedB);
 
@@ -175,4 +175,68 @@ rocblas_status rocsolver_zgels_batched(rocblas_handle handle,
                                                                ldb, info, batch_count);
 }
 
+rocblas_status rocsolver_sgels_batched_64(rocblas_handle handle,
+                                          rocblas_operation trans,
+                                          const int64_t m,
+                                          const int64_t n,
+                                          const int64_t nrhs,
+                                          float* const A[],
+                                          const int64_t lda,
+                                          float* const B[],
+                                          const int64_t ldb,
+                                          int64_t* info,
+                                          const int64_t batch_count)
+{
+    return rocsolver_gels_batched_impl<float>(handle, trans, m, n, nrhs, A, lda, B, ldb, info,
+                                              batch_count);
+}
+
+rocblas_status rocsolver_dgels_batched_64(rocblas_handle handle,
+                                          rocblas_operation trans,
+                                          const int64_t m,
+                                          const int64_t n,
+                                          const int64_t nrhs,
+                                          double* const A[],
+                                          const int64_t lda,
+                                          double* const B[],
+                                          const int64_t ldb,
+                                          int64_t* info,
+                                          const int64_t batch_count)
+{
+    return rocsolver_gels_batched_impl<double>(handle, trans, m, n, nrhs, A, lda, B, ldb, info,
+                                               batch_count);
+}
+
+rocblas_status rocsolver_cgels_batched_64(rocblas_handle handle,
+                                          rocblas_operation trans,
+                                          const int64_t m,
+                                          const int64_t n,
+                                          const int64_t nrhs,
+                                          rocblas_float_complex* const A[],
+                                          const int64_t lda,
+                                          rocblas_float_complex* const B[],
+                                          const int64_t ldb,
+                                          int64_t* info,
+                                          const int64_t batch_count)
+{
+    return rocsolver_gels_batched_impl<rocblas_float_complex>(handle, trans, m, n, nrhs, A, lda, B,
+                                                              ldb, info, batch_count);
+}
+
+rocblas_status rocsolver_zgels_batched_64(rocblas_handle handle,
+                                          rocblas_operation trans,
+                                          const int64_t m,
+                                          const int64_t n,
+                                          const int64_t nrhs,
+                                          rocblas_double_complex* const A[],
+                                          const int64_t lda,
+                                          rocblas_double_complex* const B[],
+                                          const int64_t ldb,
+                                          int64_t* info,
+                                          const int64_t batch_count)
+{
+    return rocsolver_gels_batched_impl<rocblas_double_complex>(handle, trans, m, n, nrhs, A, lda, B,
+                                                               ldb, info, batch_count);
+}
+
 } // extern C
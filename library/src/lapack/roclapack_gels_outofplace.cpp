@@ -86,7 +86,7 @@ rocblas_status rocsolver_gels_outofplace_impl(rocblas_handle handle,
         &size_diag_trfac_invA, &size_trfact_workTrmm_invA_arr, &size_ipiv, &size_savedB, &optim_mem);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(
             handle, size_scalars, size_work_x_temp, size_workArr_temp_arr, size_diag_trfac_invA,
             size_trfact_workTrmm_invA_arr, size_ipiv, size_savedB);
 
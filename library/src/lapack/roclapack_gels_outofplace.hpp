@@ -268,7 +268,7 @@ rocblas_status rocsolver_gels_outofplace_template(rocblas_handle handle,
 
             // zero row n to m-1 of X in cases where info is zero
             const rocblas_int zeroblocksx = (m - n - 1) / 32 + 1;
-            ROCSOLVER_LAUNCH_KERNEL((gels_set_zero<T, U>),
+            ROCSOLVER_LAUNCH_KERNEL((gels_set_zero<T, rocblas_int, U>),
                                     dim3(zeroblocksx, copyblocksy, batch_count), dim3(32, 32), 0,
                                     stream, n, m, nrhs, X, shiftX, ldx, strideX, info);
 
@@ -304,7 +304,7 @@ rocblas_status rocsolver_gels_outofplace_template(rocblas_handle handle,
 
             // zero row m to n-1 of X in cases where info is zero
             const rocblas_int zeroblocksx = (n - m - 1) / 32 + 1;
-            ROCSOLVER_LAUNCH_KERNEL((gels_set_zero<T, U>),
+            ROCSOLVER_LAUNCH_KERNEL((gels_set_zero<T, rocblas_int, U>),
                                     dim3(zeroblocksx, copyblocksy, batch_count), dim3(32, 32), 0,
                                     stream, m, n, nrhs, X, shiftX, ldx, strideX, info);
 
@@ -27,20 +27,20 @@
 
 #include "roclapack_gels.hpp"
 
-template <typename T, typename U, bool COMPLEX = rocblas_is_complex<T>>
+template <typename T, typename I, typename U, bool COMPLEX = rocblas_is_complex<T>>
 rocblas_status rocsolver_gels_strided_batched_impl(rocblas_handle handle,
                                                    rocblas_operation trans,
-                                                   const rocblas_int m,
-                                                   const rocblas_int n,
-                                                   const rocblas_int nrhs,
+                                                   const I m,
+                                                   const I n,
+                                                   const I nrhs,
                                                    U A,
-                                                   const rocblas_int lda,
+                                                   const I lda,
                                                    const rocblas_stride strideA,
                                                    U B,
-                                                   const rocblas_int ldb,
+                                                   const I ldb,
                                                    const rocblas_stride strideB,
-                                                   rocblas_int* info,
-                                                   const rocblas_int batch_count)
+                                                   I* info,
+                                                   const I batch_count)
 {
     ROCSOLVER_ENTER_TOP("gels_strided_batched", "--trans", trans, "-m", m, "-n", n, "--nrhs", nrhs,
                         "--lda", lda, "--strideA", strideA, "--ldb", ldb, "--strideB", strideB,
@@ -56,8 +56,8 @@ rocblas_status rocsolver_gels_strided_batched_impl(rocblas_handle handle,
         return st;
 
     // working with unshifted arrays
-    const rocblas_int shiftA = 0;
-    const rocblas_int shiftB = 0;
+    const rocblas_stride shiftA = 0;
+    const rocblas_stride shiftB = 0;
 
     // memory workspace sizes:
     // size for constants in rocblas calls
@@ -73,7 +73,7 @@ rocblas_status rocsolver_gels_strided_batched_impl(rocblas_handle handle,
         &size_diag_trfac_invA, &size_trfact_workTrmm_invA_arr, &size_ipiv_savedB, &optim_mem);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(
             handle, size_scalars, size_work_x_temp, size_workArr_temp_arr, size_diag_trfac_invA,
             size_trfact_workTrmm_invA_arr, size_ipiv_savedB);
 
@@ -182,4 +182,76 @@ rocblas_status rocsolver_zgels_strided_batched(rocblas_handle handle,
         handle, trans, m, n, nrhs, A, lda, strideA, B, ldb, strideB, info, batch_count);
 }
 
+rocblas_status rocsolver_sgels_strided_batched_64(rocblas_handle handle,
+                                                  rocblas_operation trans,
+                                                  const int64_t m,
+                                                  const int64_t n,
+                                                  const int64_t nrhs,
+                                                  float* A,
+                                                  const int64_t lda,
+                                                  const rocblas_stride strideA,
+                                                  float* B,
+                                                  const int64_t ldb,
+                                                  const rocblas_stride strideB,
+                                                  int64_t* info,
+                                                  const int64_t batch_count)
+{
+    return rocsolver_gels_strided_batched_impl<float>(handle, trans, m, n, nrhs, A, lda, strideA, B,
+                                                      ldb, strideB, info, batch_count);
+}
+
+rocblas_status rocsolver_dgels_strided_batched_64(rocblas_handle handle,
+                                                  rocblas_operation trans,
+                                                  const int64_t m,
+                                                  const int64_t n,
+                                                  const int64_t nrhs,
+                                                  double* A,
+                                                  const int64_t lda,
+                                                  const rocblas_stride strideA,
+                                                  double* B,
+                                                  const int64_t ldb,
+                                                  const rocblas_stride strideB,
+                                                  int64_t* info,
+                                                  const int64_t batch_count)
+{
+    return rocsolver_gels_strided_batched_impl<double>(handle, trans, m, n, nrhs, A, lda, strideA,
+                                                       B, ldb, strideB, info, batch_count);
+}
+
+rocblas_status rocsolver_cgels_strided_batched_64(rocblas_handle handle,
+                                                  rocblas_operation trans,
+                                                  const int64_t m,
+                                                  const int64_t n,
+                                                  const int64_t nrhs,
+                                                  rocblas_float_complex* A,
+                                                  const int64_t lda,
+                                                  const rocblas_stride strideA,
+                                                  rocblas_float_complex* B,
+                                                  const int64_t ldb,
+                                                  const rocblas_stride strideB,
+                                                  int64_t* info,
+                                                  const int64_t batch_count)
+{
+    return rocsolver_gels_strided_batched_impl<rocblas_float_complex>(
+        handle, trans, m, n, nrhs, A, lda, strideA, B, ldb, strideB, info, batch_count);
+}
+
+rocblas_status rocsolver_zgels_strided_batched_64(rocblas_handle handle,
+                                                  rocblas_operation trans,
+                                                  const int64_t m,
+                                                  const int64_t n,
+                                                  const int64_t nrhs,
+                                                  rocblas_double_complex* A,
+                                                  const int64_t lda,
+                                                  const rocblas_stride strideA,
+                                                  rocblas_double_complex* B,
+                                                  const int64_t ldb,
+                                                  const rocblas_stride strideB,
+                                                  int64_t* info,
+                                                  const int64_t batch_count)
+{
+    return rocsolver_gels_strided_batched_impl<rocblas_double_complex>(
+        handle, trans, m, n, nrhs, A, lda, strideA, B, ldb, strideB, info, batch_count);
+}
+
 } // extern C
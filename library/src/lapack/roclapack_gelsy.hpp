@@ -0,0 +1,453 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_ormqr_unmqr.hpp"
+#include "rocblas.hpp"
+#include "roclapack_geqp3.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_run_specialized_kernels.hpp"
+
+/** GELSY_RZ_STEP annihilates the entries of row k of the upper trapezoidal matrix
+    [R11 R12] that lie in the columns rank to n-1 by applying a Householder
+    reflector from the right (as in LAPACK's LATRZ). The vector v of the reflector is
+    stored in place of the annihilated entries (its k-th element is implicitly one)
+    and the scalar in tauz. There is a thread-block per instance. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) gelsy_rz_step(const rocblas_int k,
+                                                           const rocblas_int n,
+                                                           U A,
+                                                           const rocblas_int shiftA,
+                                                           const rocblas_int lda,
+                                                           const rocblas_stride strideA,
+                                                           const rocblas_int* rank,
+                                                           T* tauz,
+                                                           const rocblas_stride strideT)
+{
+    using S = decltype(std::real(T{}));
+
+    const rocblas_int bid = hipBlockIdx_y;
+    const rocblas_int tid = hipThreadIdx_x;
+    const rocblas_int r = rank[bid];
+
+    // nothing to do for rows beyond the rank
+    if(k >= r)
+        return;
+
+    __shared__ S sval[BS1];
+
+    T* a = load_ptr_batch<T>(A, bid, shiftA, strideA);
+    const rocblas_int l = n - r;
+
+    S xnorm = 0;
+    for(rocblas_int j = tid; j < l; j += BS1)
+        xnorm += std::norm(a[k + (r + j) * lda]);
+    xnorm = block_sum<BS1>(tid, xnorm, sval);
+
+    if(xnorm == 0)
+    {
+        // the row is already in the desired form
+        if(tid == 0)
+            tauz[bid * strideT + k] = 0;
+        return;
+    }
+
+    // the reflector works on the conjugate of the row
+    const T alpha = conj(a[k + k * lda]);
+
+    S beta = sqrt(std::norm(alpha) + xnorm);
+    beta = (std::real(alpha) >= 0) ? -beta : beta;
+    const T tau = (T(beta) - alpha) / T(beta);
+    const T scal = T(1) / (alpha - T(beta));
+
+    for(rocblas_int j = tid; j < l; j += BS1)
+        a[k + (r + j) * lda] = conj(a[k + (r + j) * lda]) * scal;
+    __syncthreads();
+
+    if(tid == 0)
+    {
+        a[k + k * lda] = T(beta);
+        tauz[bid * strideT + k] = tau;
+    }
+
+    // apply the reflector from the right to rows 0 to k-1
+    for(rocblas_int i = tid; i < k; i += BS1)
+    {
+        T w = a[i + k * lda];
+        for(rocblas_int j = 0; j < l; j++)
+            w += a[i + (r + j) * lda] * a[k + (r + j) * lda];
+        w *= tau;
+
+        a[i + k * lda] -= w;
+        for(rocblas_int j = 0; j < l; j++)
+            a[i + (r + j) * lda] -= w * conj(a[k + (r + j) * lda]);
+    }
+}
+
+/** GELSY_PREPARE_TRSM sets to zero the rows rank to n-1 of B and replaces the
+    diagonal elements rank to dim-1 of A by ones (saving the original values),
+    so that the triangular solve with the leading dim-by-dim block of A only
+    involves the rank-by-rank triangular factor T11. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void gelsy_prepare_trsm(const rocblas_int n,
+                                         const rocblas_int dim,
+                                         const rocblas_int nrhs,
+                                         U A,
+                                         const rocblas_int shiftA,
+                                         const rocblas_int lda,
+                                         const rocblas_stride strideA,
+                                         U B,
+                                         const rocblas_int shiftB,
+                                         const rocblas_int ldb,
+                                         const rocblas_stride strideB,
+                                         const rocblas_int* rank,
+                                         T* diag)
+{
+    const auto b = hipBlockIdx_z;
+    const auto j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const rocblas_int r = rank[b];
+
+    if(i >= r && i < n && j < nrhs)
+    {
+        T* Bp = load_ptr_batch<T>(B, b, shiftB, strideB);
+        Bp[i + j * ldb] = 0;
+
+        if(j == 0 && i < dim)
+        {
+            T* Ap = load_ptr_batch<T>(A, b, shiftA, strideA);
+            diag[b * dim + i] = Ap[i + i * lda];
+            Ap[i + i * lda] = 1;
+        }
+    }
+}
+
+/** GELSY_RESTORE_DIAG restores the diagonal elements rank to dim-1 of A saved
+    by GELSY_PREPARE_TRSM. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void gelsy_restore_diag(const rocblas_int dim,
+                                         U A,
+                                         const rocblas_int shiftA,
+                                         const rocblas_int lda,
+                                         const rocblas_stride strideA,
+                                         const rocblas_int* rank,
+                                         T* diag)
+{
+    const auto b = hipBlockIdx_y;
+    const auto i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(i >= rank[b] && i < dim)
+    {
+        T* Ap = load_ptr_batch<T>(A, b, shiftA, strideA);
+        Ap[i + i * lda] = diag[b * dim + i];
+    }
+}
+
+/** GELSY_APPLY_Z computes X = P * Z' * [Y; 0], where Y is the solution of the
+    triangular system stored in the first rows of B, Z is the orthogonal matrix
+    generated by GELSY_RZ_STEP and P is the column permutation of GEQP3.
+    There is a thread-block per right-hand side and instance. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) gelsy_apply_z(const rocblas_int n,
+                                                           const rocblas_int nrhs,
+                                                           U A,
+                                                           const rocblas_int shiftA,
+                                                           const rocblas_int lda,
+                                                           const rocblas_stride strideA,
+                                                           const rocblas_int* rank,
+                                                           const T* tauz,
+                                                           const rocblas_stride strideT,
+                                                           U B,
+                                                           const rocblas_int shiftB,
+                                                           const rocblas_int ldb,
+                                                           const rocblas_stride strideB,
+                                                           const rocblas_int* jpvt,
+                                                           const rocblas_stride strideJ,
+                                                           T* work)
+{
+    const rocblas_int bid = hipBlockIdx_y;
+    const rocblas_int col = hipBlockIdx_x;
+    const rocblas_int tid = hipThreadIdx_x;
+    const rocblas_int r = rank[bid];
+    const rocblas_int l = n - r;
+
+    __shared__ T sval[BS1];
+
+    T* a = load_ptr_batch<T>(A, bid, shiftA, strideA);
+    T* x = load_ptr_batch<T>(B, bid, shiftB, strideB) + col * ldb;
+    T* w = work + (bid * nrhs + col) * n;
+    const rocblas_int* ipvt = jpvt + bid * strideJ;
+
+    // apply the reflectors H(0), H(1), ..., H(r-1)
+    if(l > 0)
+    {
+        for(rocblas_int k = 0; k < r; k++)
+        {
+            T d = (tid == 0) ? x[k] : T(0);
+            for(rocblas_int j = tid; j < l; j += BS1)
+                d += conj(a[k + (r + j) * lda]) * x[r + j];
+            d = block_sum<BS1>(tid, d, sval) * tauz[bid * strideT + k];
+
+            if(tid == 0)
+                x[k] -= d;
+            for(rocblas_int j = tid; j < l; j += BS1)
+                x[r + j] -= a[k + (r + j) * lda] * d;
+        }
+    }
+
+    // undo the column permutation
+    for(rocblas_int i = tid; i < n; i += BS1)
+        w[i] = x[i];
+    __syncthreads();
+
+    for(rocblas_int i = tid; i < n; i += BS1)
+        x[ipvt[i] - 1] = w[i];
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_gelsy_getMemorySize(const rocblas_int m,
+                                   const rocblas_int n,
+                                   const rocblas_int nrhs,
+                                   const rocblas_int batch_count,
+                                   size_t* size_scalars,
+                                   size_t* size_work_x_temp,
+                                   size_t* size_workArr_temp_arr,
+                                   size_t* size_norms_trfact_invA,
+                                   size_t* size_diag_workTrmm_invA_arr,
+                                   size_t* size_colnorms,
+                                   size_t* size_ndone,
+                                   size_t* size_tau,
+                                   size_t* size_savedX,
+                                   bool* optim_mem)
+{
+    // if quick return no workspace needed
+    // (when m = 0 the permutation must still be initialized)
+    if(n == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work_x_temp = 0;
+        *size_workArr_temp_arr = 0;
+        *size_norms_trfact_invA = 0;
+        *size_diag_workTrmm_invA_arr = 0;
+        *size_colnorms = 0;
+        *size_ndone = 0;
+        *size_tau = 0;
+        *size_savedX = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    const rocblas_int dim = std::min(m, n);
+
+    size_t geqp3_scalars, geqp3_work, geqp3_norms, geqp3_diag;
+    size_t ormqr_scalars, ormqr_work, ormqr_workArr, ormqr_trfact, ormqr_workTrmm;
+    size_t trsm_x_temp, trsm_x_temp_arr, trsm_invA, trsm_invA_arr;
+
+    rocsolver_geqp3_getMemorySize<BATCHED, T>(m, n, batch_count, &geqp3_scalars, &geqp3_work,
+                                              &geqp3_norms, &geqp3_diag, size_colnorms, size_ndone);
+
+    rocsolver_ormqr_unmqr_getMemorySize<BATCHED, T>(rocblas_side_left, m, nrhs, dim, batch_count,
+                                                    &ormqr_scalars, &ormqr_work, &ormqr_workArr,
+                                                    &ormqr_trfact, &ormqr_workTrmm);
+
+    rocsolver_trsm_mem<BATCHED, STRIDED, T>(rocblas_side_left, rocblas_operation_none, dim, nrhs,
+                                            batch_count, &trsm_x_temp, &trsm_x_temp_arr, &trsm_invA,
+                                            &trsm_invA_arr, optim_mem);
+
+    *size_scalars = std::max(geqp3_scalars, ormqr_scalars);
+    *size_work_x_temp = std::max({geqp3_work, ormqr_work, trsm_x_temp});
+    *size_workArr_temp_arr = std::max(ormqr_workArr, trsm_x_temp_arr);
+    *size_norms_trfact_invA = std::max({geqp3_norms, ormqr_trfact, trsm_invA});
+    *size_diag_workTrmm_invA_arr = std::max({geqp3_diag, ormqr_workTrmm, trsm_invA_arr});
+
+    // the scalars of the reflectors of Q and Z, and the saved diagonal of A
+    *size_tau = sizeof(T) * 3 * dim * batch_count;
+
+    // copy of the solution used to apply the permutation
+    *size_savedX = sizeof(T) * n * nrhs * batch_count;
+}
+
+template <typename T, typename S>
+rocblas_status rocsolver_gelsy_argCheck(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        T A,
+                                        const rocblas_int lda,
+                                        T B,
+                                        const rocblas_int ldb,
+                                        rocblas_int* jpvt,
+                                        const S rcond,
+                                        rocblas_int* rank,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(rcond < 0)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || nrhs < 0 || lda < m || ldb < m || ldb < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m && n && !A) || (((m && nrhs) || (n && nrhs)) && !B) || (n && !jpvt)
+       || (batch_count && !rank))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+/** GELSY_TEMPLATE computes the minimum-norm solution of the (possibly rank-deficient)
+    least-squares problem min ||A*X - B|| using a complete orthogonal factorization
+    of A (as in LAPACK's GELSY).
+    The effective rank r is determined by the truncated column-pivoted QR factorization
+    A*P = Q*[R11 R12; 0 R22] as the number of diagonal elements of R that are larger
+    than rcond times |R(0,0)|. [R11 R12] is then reduced to [T11 0] by orthogonal
+    transformations from the right, [R11 R12] = [T11 0]*Z, and the solution is
+    X = P*Z'*[inv(T11)*(Q'*B)(0:r-1,:); 0]. **/
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_gelsy_template(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        U B,
+                                        const rocblas_int shiftB,
+                                        const rocblas_int ldb,
+                                        const rocblas_stride strideB,
+                                        rocblas_int* jpvt,
+                                        const rocblas_stride strideJ,
+                                        const S rcond,
+                                        rocblas_int* rank,
+                                        const rocblas_int batch_count,
+                                        T* scalars,
+                                        void* work_x_temp,
+                                        void* workArr_temp_arr,
+                                        void* norms_trfact_invA,
+                                        void* diag_workTrmm_invA_arr,
+                                        S* colnorms,
+                                        rocblas_int* ndone,
+                                        T* tau,
+                                        T* savedX,
+                                        bool optim_mem)
+{
+    ROCSOLVER_ENTER("gelsy", "m:", m, "n:", n, "nrhs:", nrhs, "shiftA:", shiftA, "lda:", lda,
+                    "shiftB:", shiftB, "ldb:", ldb, "rcond:", rcond, "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    const rocblas_int dim = std::min(m, n);
+    const rocblas_stride strideP = dim;
+    T* tauq = tau;
+    T* tauz = tau + dim * batch_count;
+    T* diag = tau + 2 * dim * batch_count;
+
+    // compute the column-pivoted QR factorization of A, truncated at the effective rank
+    // (this also initializes rank and jpvt when A is empty)
+    rocblas_int steps;
+    rocsolver_geqp3_template<BATCHED, T>(
+        handle, m, n, A, shiftA, lda, strideA, jpvt, strideJ, tauq, strideP, rcond, rank,
+        batch_count, scalars, work_x_temp, (T*)norms_trfact_invA, (T*)diag_workTrmm_invA_arr,
+        colnorms, ndone, &steps);
+
+    // quick return if B is empty
+    if(nrhs == 0)
+    {
+        rocblas_set_pointer_mode(handle, old_mode);
+        return rocblas_status_success;
+    }
+
+    // quick return if A is empty
+    if(m == 0 || n == 0)
+    {
+        rocblas_int rowsB = std::max(m, n);
+        rocblas_int blocksx = (rowsB - 1) / 32 + 1;
+        rocblas_int blocksy = (nrhs - 1) / 32 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(set_zero<T>, dim3(blocksx, blocksy, batch_count), dim3(32, 32), 0,
+                                stream, rowsB, nrhs, B, shiftB, ldb, strideB);
+
+        rocblas_set_pointer_mode(handle, old_mode);
+        return rocblas_status_success;
+    }
+
+    // B = Q' * B (only the executed reflectors are applied)
+    if(steps > 0)
+        rocsolver_ormqr_unmqr_template<BATCHED, STRIDED>(
+            handle, rocblas_side_left, rocblas_operation_conjugate_transpose, m, nrhs, steps, A,
+            shiftA, lda, strideA, tauq, strideP, B, shiftB, ldb, strideB, batch_count, scalars,
+            (T*)work_x_temp, (T*)workArr_temp_arr, (T*)norms_trfact_invA,
+            (T**)diag_workTrmm_invA_arr);
+
+    // reduce [R11 R12] to [T11 0] (rows are processed from the bottom up)
+    for(rocblas_int k = steps - 1; k >= 0; k--)
+        ROCSOLVER_LAUNCH_KERNEL((gelsy_rz_step<T>), dim3(1, batch_count, 1), dim3(BS1, 1, 1), 0,
+                                stream, k, n, A, shiftA, lda, strideA, rank, tauz, strideP);
+
+    // solve T11 * Y = (Q' * B)(0:r-1,:) and set the remaining rows of the solution to zero
+    const rocblas_int blocksx = (n - 1) / 32 + 1;
+    const rocblas_int blocksy = (nrhs - 1) / 32 + 1;
+    ROCSOLVER_LAUNCH_KERNEL((gelsy_prepare_trsm<T>), dim3(blocksx, blocksy, batch_count),
+                            dim3(32, 32), 0, stream, n, dim, nrhs, A, shiftA, lda, strideA, B,
+                            shiftB, ldb, strideB, rank, diag);
+
+    rocsolver_trsm_upper<BATCHED, STRIDED, T>(
+        handle, rocblas_side_left, rocblas_operation_none, rocblas_diagonal_non_unit, dim, nrhs, A,
+        shiftA, lda, strideA, B, shiftB, ldb, strideB, batch_count, optim_mem, work_x_temp,
+        workArr_temp_arr, norms_trfact_invA, diag_workTrmm_invA_arr);
+
+    ROCSOLVER_LAUNCH_KERNEL((gelsy_restore_diag<T>), dim3((dim - 1) / BS1 + 1, batch_count, 1),
+                            dim3(BS1, 1, 1), 0, stream, dim, A, shiftA, lda, strideA, rank, diag);
+
+    // X = P * Z' * [Y; 0]
+    ROCSOLVER_LAUNCH_KERNEL((gelsy_apply_z<T>), dim3(nrhs, batch_count, 1), dim3(BS1, 1, 1), 0,
+                            stream, n, nrhs, A, shiftA, lda, strideA, rank, tauz, strideP, B,
+                            shiftB, ldb, strideB, jpvt, strideJ, savedX);
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
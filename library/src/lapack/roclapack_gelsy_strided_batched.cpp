@@ -0,0 +1,209 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_gelsy.hpp"
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_gelsy_strided_batched_impl(rocblas_handle handle,
+                                                    const rocblas_int m,
+                                                    const rocblas_int n,
+                                                    const rocblas_int nrhs,
+                                                    U A,
+                                                    const rocblas_int lda,
+                                                    const rocblas_stride strideA,
+                                                    U B,
+                                                    const rocblas_int ldb,
+                                                    const rocblas_stride strideB,
+                                                    rocblas_int* jpvt,
+                                                    const rocblas_stride strideJ,
+                                                    const S rcond,
+                                                    rocblas_int* rank,
+                                                    const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP(
+        "gelsy_strided_batched", "-m", m, "-n", n, "--nrhs", nrhs, "--lda", lda, "--strideA",
+        strideA, "--ldb", ldb, "--strideB", strideB, "--strideJ", strideJ, "--rcond", rcond,
+        "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_gelsy_argCheck(handle, m, n, nrhs, A, lda, B, ldb, jpvt, rcond,
+                                                 rank, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+    rocblas_int shiftB = 0;
+
+    // memory workspace sizes:
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of reusable workspaces (and for calling TRSM)
+    size_t size_work_x_temp, size_workArr_temp_arr, size_norms_trfact_invA,
+        size_diag_workTrmm_invA_arr;
+    // size to store the column norms and the number of finished instances
+    size_t size_colnorms, size_ndone;
+    // size to store the Householder scalars and the saved diagonal
+    size_t size_tau;
+    // size to store a copy of the solution
+    size_t size_savedX;
+    bool optim_mem;
+    rocsolver_gelsy_getMemorySize<false, true, T>(
+        m, n, nrhs, batch_count, &size_scalars, &size_work_x_temp, &size_workArr_temp_arr,
+        &size_norms_trfact_invA, &size_diag_workTrmm_invA_arr, &size_colnorms, &size_ndone,
+        &size_tau, &size_savedX, &optim_mem);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(
+            handle, size_scalars, size_work_x_temp, size_workArr_temp_arr, size_norms_trfact_invA,
+            size_diag_workTrmm_invA_arr, size_colnorms, size_ndone, size_tau, size_savedX);
+
+    // memory workspace allocation
+    void *scalars, *work_x_temp, *workArr_temp_arr, *norms_trfact_invA, *diag_workTrmm_invA_arr,
+        *colnorms, *ndone, *tau, *savedX;
+    rocblas_device_malloc mem(handle, size_scalars, size_work_x_temp, size_workArr_temp_arr,
+                              size_norms_trfact_invA, size_diag_workTrmm_invA_arr, size_colnorms,
+                              size_ndone, size_tau, size_savedX);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    work_x_temp = mem[1];
+    workArr_temp_arr = mem[2];
+    norms_trfact_invA = mem[3];
+    diag_workTrmm_invA_arr = mem[4];
+    colnorms = mem[5];
+    ndone = mem[6];
+    tau = mem[7];
+    savedX = mem[8];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    // execution
+    return rocsolver_gelsy_template<false, true, T>(
+        handle, m, n, nrhs, A, shiftA, lda, strideA, B, shiftB, ldb, strideB, jpvt, strideJ, rcond,
+        rank, batch_count, (T*)scalars, work_x_temp, workArr_temp_arr, norms_trfact_invA,
+        diag_workTrmm_invA_arr, (S*)colnorms, (rocblas_int*)ndone, (T*)tau, (T*)savedX, optim_mem);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgelsy_strided_batched(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int nrhs,
+                                                float* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                float* B,
+                                                const rocblas_int ldb,
+                                                const rocblas_stride strideB,
+                                                rocblas_int* jpvt,
+                                                const rocblas_stride strideJ,
+                                                const float rcond,
+                                                rocblas_int* rank,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_gelsy_strided_batched_impl<float>(
+        handle, m, n, nrhs, A, lda, strideA, B, ldb, strideB, jpvt, strideJ, rcond, rank,
+        batch_count);
+}
+
+rocblas_status rocsolver_dgelsy_strided_batched(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int nrhs,
+                                                double* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                double* B,
+                                                const rocblas_int ldb,
+                                                const rocblas_stride strideB,
+                                                rocblas_int* jpvt,
+                                                const rocblas_stride strideJ,
+                                                const double rcond,
+                                                rocblas_int* rank,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_gelsy_strided_batched_impl<double>(
+        handle, m, n, nrhs, A, lda, strideA, B, ldb, strideB, jpvt, strideJ, rcond, rank,
+        batch_count);
+}
+
+rocblas_status rocsolver_cgelsy_strided_batched(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int nrhs,
+                                                rocblas_float_complex* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                rocblas_float_complex* B,
+                                                const rocblas_int ldb,
+                                                const rocblas_stride strideB,
+                                                rocblas_int* jpvt,
+                                                const rocblas_stride strideJ,
+                                                const float rcond,
+                                                rocblas_int* rank,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_gelsy_strided_batched_impl<rocblas_float_complex>(
+        handle, m, n, nrhs, A, lda, strideA, B, ldb, strideB, jpvt, strideJ, rcond, rank,
+        batch_count);
+}
+
+rocblas_status rocsolver_zgelsy_strided_batched(rocblas_handle handle,
+                                                const rocblas_int m,
+                                                const rocblas_int n,
+                                                const rocblas_int nrhs,
+                                                rocblas_double_complex* A,
+                                                const rocblas_int lda,
+                                                const rocblas_stride strideA,
+                                                rocblas_double_complex* B,
+                                                const rocblas_int ldb,
+                                                const rocblas_stride strideB,
+                                                rocblas_int* jpvt,
+                                                const rocblas_stride strideJ,
+                                                const double rcond,
+                                                rocblas_int* rank,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_gelsy_strided_batched_impl<rocblas_double_complex>(
+        handle, m, n, nrhs, A, lda, strideA, B, ldb, strideB, jpvt, strideJ, rcond, rank,
+        batch_count);
+}
+
+}
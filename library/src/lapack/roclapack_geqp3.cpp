@@ -0,0 +1,216 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_geqp3.hpp"
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_geqp3_impl(rocblas_handle handle,
+                                    const rocblas_int m,
+                                    const rocblas_int n,
+                                    U A,
+                                    const rocblas_int lda,
+                                    rocblas_int* jpvt,
+                                    T* ipiv,
+                                    const S tol,
+                                    rocblas_int* rank,
+                                    const bool truncated)
+{
+    const char* name = (truncated ? "geqp3_truncated" : "geqp3");
+    ROCSOLVER_ENTER_TOP(name, "-m", m, "-n", n, "--lda", lda);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_geqp3_argCheck(handle, m, n, lda, A, jpvt, ipiv, tol, rank,
+                                                 truncated);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // normal (non-batched non-strided) execution
+    rocblas_stride strideA = 0;
+    rocblas_stride strideJ = 0;
+    rocblas_stride strideP = 0;
+    rocblas_int batch_count = 1;
+
+    // memory workspace sizes:
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of arrays of pointers (for batched cases) and re-usable workspace
+    size_t size_work_workArr;
+    // extra requirements for calling LARF and LARFG
+    size_t size_Abyx_norms;
+    // size to store the diagonal values temporarily
+    size_t size_diag;
+    // size to store the column norms and the number of finished instances
+    size_t size_colnorms, size_ndone;
+    rocsolver_geqp3_getMemorySize<false, T>(m, n, batch_count, &size_scalars,
+                                            &size_work_workArr, &size_Abyx_norms, &size_diag,
+                                            &size_colnorms, &size_ndone);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_scalars, size_work_workArr,
+                                                      size_Abyx_norms, size_diag, size_colnorms,
+                                                      size_ndone);
+
+    // memory workspace allocation
+    void *scalars, *work_workArr, *Abyx_norms, *diag, *colnorms, *ndone;
+    rocblas_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms, size_diag,
+                              size_colnorms, size_ndone);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    work_workArr = mem[1];
+    Abyx_norms = mem[2];
+    diag = mem[3];
+    colnorms = mem[4];
+    ndone = mem[5];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    // execution
+    return rocsolver_geqp3_template<false, T>(
+        handle, m, n, A, shiftA, lda, strideA, jpvt, strideJ, ipiv, strideP, tol,
+        (truncated ? rank : nullptr), batch_count, (T*)scalars, work_workArr, (T*)Abyx_norms,
+        (T*)diag, (S*)colnorms, (rocblas_int*)ndone);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgeqp3(rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                float* A,
+                                const rocblas_int lda,
+                                rocblas_int* jpvt,
+                                float* ipiv)
+{
+    return rocsolver_geqp3_impl<float>(handle, m, n, A, lda, jpvt, ipiv, float(0), nullptr, false);
+}
+
+rocblas_status rocsolver_dgeqp3(rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                double* A,
+                                const rocblas_int lda,
+                                rocblas_int* jpvt,
+                                double* ipiv)
+{
+    return rocsolver_geqp3_impl<double>(handle, m, n, A, lda, jpvt, ipiv, double(0), nullptr,
+                                        false);
+}
+
+rocblas_status rocsolver_cgeqp3(rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                rocblas_float_complex* A,
+                                const rocblas_int lda,
+                                rocblas_int* jpvt,
+                                rocblas_float_complex* ipiv)
+{
+    return rocsolver_geqp3_impl<rocblas_float_complex>(handle, m, n, A, lda, jpvt, ipiv, float(0),
+                                                       nullptr, false);
+}
+
+rocblas_status rocsolver_zgeqp3(rocblas_handle handle,
+                                const rocblas_int m,
+                                const rocblas_int n,
+                                rocblas_double_complex* A,
+                                const rocblas_int lda,
+                                rocblas_int* jpvt,
+                                rocblas_double_complex* ipiv)
+{
+    return rocsolver_geqp3_impl<rocblas_double_complex>(handle, m, n, A, lda, jpvt, ipiv, double(0),
+                                                        nullptr, false);
+}
+
+rocblas_status rocsolver_sgeqp3_truncated(rocblas_handle handle,
+                                          const rocblas_int m,
+                                          const rocblas_int n,
+                                          float* A,
+                                          const rocblas_int lda,
+                                          rocblas_int* jpvt,
+                                          float* ipiv,
+                                          const float tol,
+                                          rocblas_int* rank)
+{
+    return rocsolver_geqp3_impl<float>(handle, m, n, A, lda, jpvt, ipiv, tol, rank, true);
+}
+
+rocblas_status rocsolver_dgeqp3_truncated(rocblas_handle handle,
+                                          const rocblas_int m,
+                                          const rocblas_int n,
+                                          double* A,
+                                          const rocblas_int lda,
+                                          rocblas_int* jpvt,
+                                          double* ipiv,
+                                          const double tol,
+                                          rocblas_int* rank)
+{
+    return rocsolver_geqp3_impl<double>(handle, m, n, A, lda, jpvt, ipiv, tol, rank, true);
+}
+
+rocblas_status rocsolver_cgeqp3_truncated(rocblas_handle handle,
+                                          const rocblas_int m,
+                                          const rocblas_int n,
+                                          rocblas_float_complex* A,
+                                          const rocblas_int lda,
+                                          rocblas_int* jpvt,
+                                          rocblas_float_complex* ipiv,
+                                          const float tol,
+                                          rocblas_int* rank)
+{
+    return rocsolver_geqp3_impl<rocblas_float_complex>(handle, m, n, A, lda, jpvt, ipiv, tol, rank,
+                                                       true);
+}
+
+rocblas_status rocsolver_zgeqp3_truncated(rocblas_handle handle,
+                                          const rocblas_int m,
+                                          const rocblas_int n,
+                                          rocblas_double_complex* A,
+                                          const rocblas_int lda,
+                                          rocblas_int* jpvt,
+                                          rocblas_double_complex* ipiv,
+                                          const double tol,
+                                          rocblas_int* rank)
+{
+    return rocsolver_geqp3_impl<rocblas_double_complex>(handle, m, n, A, lda, jpvt, ipiv, tol, rank,
+                                                        true);
+}
+
+}
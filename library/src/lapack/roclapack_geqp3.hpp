@@ -0,0 +1,420 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "auxiliary/rocauxiliary_lacgv.hpp"
+#include "auxiliary/rocauxiliary_larf.hpp"
+#include "auxiliary/rocauxiliary_larfg.hpp"
+#include "lapack_device_functions.hpp"
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_handle_state.hpp"
+
+/** The column norms of each instance are kept in a real array of 2n+1 elements:
+    the partial norms vn1, the reference norms vn2 used to detect cancellation
+    when downdating, and the largest initial column norm. **/
+#define GEQP3_NORMS_SIZE(n) (2 * (n) + 1)
+
+/** GEQP3_INIT computes the initial column norms and sets the permutation to
+    the identity. There is a thread-block per column. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) geqp3_init(const rocblas_int m,
+                                                        const rocblas_int n,
+                                                        U A,
+                                                        const rocblas_int shiftA,
+                                                        const rocblas_int lda,
+                                                        const rocblas_stride strideA,
+                                                        rocblas_int* jpvt,
+                                                        const rocblas_stride strideJ,
+                                                        S* norms,
+                                                        rocblas_int* rank)
+{
+    const rocblas_int bid = hipBlockIdx_y;
+    const rocblas_int j = hipBlockIdx_x;
+    const rocblas_int tid = hipThreadIdx_x;
+
+    __shared__ S sval[BS1];
+
+    T* a = load_ptr_batch<T>(A, bid, shiftA, strideA) + j * lda;
+    S* vn1 = norms + bid * GEQP3_NORMS_SIZE(n);
+    S* vn2 = vn1 + n;
+
+    S val = 0;
+    for(rocblas_int i = tid; i < m; i += BS1)
+        val += std::norm(a[i]);
+    val = sqrt(block_sum<BS1>(tid, val, sval));
+
+    if(tid == 0)
+    {
+        vn1[j] = val;
+        vn2[j] = val;
+        jpvt[bid * strideJ + j] = j + 1;
+        if(rank && j == 0)
+            rank[bid] = std::min(m, n);
+    }
+}
+
+/** GEQP3_PIVOT selects the column with the largest partial norm among columns
+    j to n-1 and interchanges it with column j. If tol >= 0, the instances whose
+    largest partial norm is below tol times the largest initial column norm are
+    marked as finished: their rank is set to j and the counter ndone is increased.
+    There is a thread-block per instance. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) geqp3_pivot(const rocblas_int j,
+                                                         const rocblas_int m,
+                                                         const rocblas_int n,
+                                                         U A,
+                                                         const rocblas_int shiftA,
+                                                         const rocblas_int lda,
+                                                         const rocblas_stride strideA,
+                                                         rocblas_int* jpvt,
+                                                         const rocblas_stride strideJ,
+                                                         S* norms,
+                                                         const S tol,
+                                                         rocblas_int* rank,
+                                                         rocblas_int* ndone)
+{
+    const rocblas_int bid = hipBlockIdx_y;
+    const rocblas_int tid = hipThreadIdx_x;
+
+    __shared__ S sval[BS1];
+    __shared__ rocblas_int sidx[BS1];
+
+    T* a = load_ptr_batch<T>(A, bid, shiftA, strideA);
+    rocblas_int* ipvt = jpvt + bid * strideJ;
+    S* vn1 = norms + bid * GEQP3_NORMS_SIZE(n);
+    S* vn2 = vn1 + n;
+    S* vmax = vn2 + n;
+
+    iamax<BS1>(tid, n - j, vn1 + j, 1, sval, sidx);
+    __syncthreads();
+    const rocblas_int p = j + sidx[0] - 1;
+
+    if(tid == 0)
+    {
+        if(j == 0)
+            vmax[0] = sval[0];
+
+        // check stopping criterion of the truncated factorization
+        if(rank && tol >= 0 && rank[bid] == std::min(m, n) && sval[0] <= tol * vmax[0])
+        {
+            rank[bid] = j;
+            atomicAdd(ndone, 1);
+        }
+
+        if(p != j)
+        {
+            swap(ipvt[j], ipvt[p]);
+            vn1[p] = vn1[j];
+            vn2[p] = vn2[j];
+        }
+    }
+
+    if(p != j)
+    {
+        for(rocblas_int i = tid; i < m; i += BS1)
+            swap(a[i + j * lda], a[i + p * lda]);
+    }
+}
+
+/** GEQP3_UPDATE_NORMS downdates the partial norms of columns j+1 to n-1 after
+    the application of the j-th Householder reflector (as in LAPACK's LAQP2).
+    Norms that have lost too much accuracy are recomputed. There is a
+    thread-block per column. **/
+template <typename T, typename S, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) geqp3_update_norms(const rocblas_int j,
+                                                                const rocblas_int m,
+                                                                const rocblas_int n,
+                                                                U A,
+                                                                const rocblas_int shiftA,
+                                                                const rocblas_int lda,
+                                                                const rocblas_stride strideA,
+                                                                S* norms,
+                                                                const S tol3z)
+{
+    const rocblas_int bid = hipBlockIdx_y;
+    const rocblas_int l = j + 1 + hipBlockIdx_x;
+    const rocblas_int tid = hipThreadIdx_x;
+
+    __shared__ S sval[BS1];
+    __shared__ bool recompute;
+
+    T* a = load_ptr_batch<T>(A, bid, shiftA, strideA) + l * lda;
+    S* vn1 = norms + bid * GEQP3_NORMS_SIZE(n);
+    S* vn2 = vn1 + n;
+
+    if(tid == 0)
+    {
+        recompute = false;
+        if(vn1[l] != 0)
+        {
+            S temp = sqrt(std::norm(a[j])) / vn1[l];
+            temp = std::max(S(0), (1 - temp) * (1 + temp));
+            S temp2 = temp * (vn1[l] / vn2[l]) * (vn1[l] / vn2[l]);
+            if(temp2 <= tol3z)
+                recompute = true;
+            else
+                vn1[l] *= sqrt(temp);
+        }
+    }
+    __syncthreads();
+
+    if(recompute)
+    {
+        S val = 0;
+        for(rocblas_int i = j + 1 + tid; i < m; i += BS1)
+            val += std::norm(a[i]);
+        val = sqrt(block_sum<BS1>(tid, val, sval));
+
+        if(tid == 0)
+        {
+            vn1[l] = val;
+            vn2[l] = val;
+        }
+    }
+}
+
+template <bool BATCHED, typename T>
+void rocsolver_geqp3_getMemorySize(const rocblas_int m,
+                                   const rocblas_int n,
+                                   const rocblas_int batch_count,
+                                   size_t* size_scalars,
+                                   size_t* size_work_workArr,
+                                   size_t* size_Abyx_norms,
+                                   size_t* size_diag,
+                                   size_t* size_colnorms,
+                                   size_t* size_ndone)
+{
+    using S = decltype(std::real(T{}));
+
+    // if quick return no workspace needed
+    // (when m = 0 the permutation must still be initialized)
+    if(n == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work_workArr = 0;
+        *size_Abyx_norms = 0;
+        *size_diag = 0;
+        *size_colnorms = 0;
+        *size_ndone = 0;
+        return;
+    }
+
+    // size of Abyx_norms is maximum of what is needed by larf and larfg
+    // size_work_workArr is maximum of re-usable work space and array of pointers to workspace
+    size_t s1, s2, w1, w2;
+    rocsolver_larf_getMemorySize<BATCHED, T>(rocblas_side_left, m, n, batch_count, size_scalars,
+                                             &s1, &w1);
+    rocsolver_larfg_getMemorySize<T>(m, batch_count, &w2, &s2);
+    *size_work_workArr = std::max(w1, w2);
+    *size_Abyx_norms = std::max(s1, s2);
+
+    // size of array to store temporary diagonal values
+    *size_diag = sizeof(T) * batch_count;
+
+    // size of arrays to store the column norms
+    *size_colnorms = sizeof(S) * GEQP3_NORMS_SIZE(n) * batch_count;
+
+    // size of the counter of finished instances
+    *size_ndone = sizeof(rocblas_int);
+}
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_geqp3_argCheck(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        const rocblas_int lda,
+                                        T A,
+                                        rocblas_int* jpvt,
+                                        U ipiv,
+                                        const S tol,
+                                        rocblas_int* rank,
+                                        const bool truncated,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(truncated && tol < 0)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || lda < m || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m && n && !A) || (n && !jpvt) || (m && n && !ipiv) || (truncated && batch_count && !rank))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+/** GEQP3_TEMPLATE computes the QR factorization with column pivoting A*P = Q*R.
+    (This is the unblocked algorithm of LAPACK's LAQP2; every step selects the pivot
+    column, reuses LARFG and LARF to annihilate it, and downdates the partial norms
+    of the remaining columns.)
+    If rank is not null, the factorization is truncated: the rank of each instance
+    is determined as the first step j at which the largest partial norm is not
+    larger than tol times the largest column norm of A, and the process stops when
+    all the instances in the batch have reached their rank. The number of
+    executed steps is returned in steps (the Householder scalars of the steps that
+    were not executed are set to zero). **/
+template <bool BATCHED, typename T, typename S, typename U, bool COMPLEX = rocblas_is_complex<T>>
+rocblas_status rocsolver_geqp3_template(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        rocblas_int* jpvt,
+                                        const rocblas_stride strideJ,
+                                        T* ipiv,
+                                        const rocblas_stride strideP,
+                                        const S tol,
+                                        rocblas_int* rank,
+                                        const rocblas_int batch_count,
+                                        T* scalars,
+                                        void* work_workArr,
+                                        T* Abyx_norms,
+                                        T* diag,
+                                        S* colnorms,
+                                        rocblas_int* ndone,
+                                        rocblas_int* steps = nullptr)
+{
+    ROCSOLVER_ENTER("geqp3", "m:", m, "n:", n, "shiftA:", shiftA, "lda:", lda, "bc:", batch_count);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int dim = std::min(m, n); // total number of pivots
+    if(steps)
+        *steps = 0;
+
+    // quick return if A is empty
+    if(n == 0)
+    {
+        if(rank)
+        {
+            rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+            ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(blocks, 1, 1), dim3(BS1, 1, 1), 0, stream,
+                                    rank, batch_count, 0);
+        }
+        return rocblas_status_success;
+    }
+
+    const bool truncated = (rank != nullptr);
+    const bool check_host = !rocsolver_handle_state_map::capture_safe_enabled(handle);
+    const S tol3z = sqrt(get_epsilon<S>());
+    dim3 threads(BS1, 1, 1);
+
+    // compute initial norms and permutation
+    ROCSOLVER_LAUNCH_KERNEL((geqp3_init<T>), dim3(n, batch_count, 1), threads, 0, stream, m, n, A,
+                            shiftA, lda, strideA, jpvt, strideJ, colnorms, rank);
+    if(truncated)
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(1, 1, 1), dim3(1, 1, 1), 0, stream, ndone, 1, 0);
+
+    rocblas_int j;
+    for(j = 0; j < dim; ++j)
+    {
+        // choose pivot column and move it to position j
+        ROCSOLVER_LAUNCH_KERNEL((geqp3_pivot<T>), dim3(1, batch_count, 1), threads, 0, stream, j,
+                                m, n, A, shiftA, lda, strideA, jpvt, strideJ, colnorms, tol, rank,
+                                ndone);
+
+        // if all instances in the batch have reached their rank, stop the factorization
+        // (in capture-safe mode, all the steps are executed)
+        if(truncated && check_host)
+        {
+            rocblas_int h_ndone;
+            HIP_CHECK(hipMemcpyAsync(&h_ndone, ndone, sizeof(rocblas_int), hipMemcpyDeviceToHost,
+                                     stream));
+            HIP_CHECK(hipStreamSynchronize(stream));
+            if(h_ndone == batch_count)
+                break;
+        }
+
+        // generate Householder reflector to work on column j
+        rocsolver_larfg_template(handle, m - j, A, shiftA + idx2D(j, j, lda), A,
+                                 shiftA + idx2D(std::min(j + 1, m - 1), j, lda), 1, strideA,
+                                 (ipiv + j), strideP, batch_count, (T*)work_workArr, Abyx_norms);
+
+        if(j < n - 1)
+        {
+            // insert one in A(j,j) to build/apply the householder matrix
+            ROCSOLVER_LAUNCH_KERNEL(set_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0,
+                                    stream, diag, 0, 1, A, shiftA + idx2D(j, j, lda), lda, strideA,
+                                    1, true);
+
+            // conjugate tau
+            if(COMPLEX)
+                rocsolver_lacgv_template<T>(handle, 1, ipiv, j, 1, strideP, batch_count);
+
+            // Apply Householder reflector to the rest of matrix from the left
+            rocsolver_larf_template(handle, rocblas_side_left, m - j, n - j - 1, A,
+                                    shiftA + idx2D(j, j, lda), 1, strideA, (ipiv + j), strideP, A,
+                                    shiftA + idx2D(j, j + 1, lda), lda, strideA, batch_count,
+                                    scalars, Abyx_norms, (T**)work_workArr);
+
+            // restore original value of A(j,j)
+            ROCSOLVER_LAUNCH_KERNEL(restore_diag<T>, dim3(batch_count, 1, 1), dim3(1, 1, 1), 0,
+                                    stream, diag, 0, 1, A, shiftA + idx2D(j, j, lda), lda, strideA,
+                                    1);
+
+            // restore tau
+            if(COMPLEX)
+                rocsolver_lacgv_template<T>(handle, 1, ipiv, j, 1, strideP, batch_count);
+
+            // update partial column norms
+            ROCSOLVER_LAUNCH_KERNEL((geqp3_update_norms<T>), dim3(n - j - 1, batch_count, 1),
+                                    threads, 0, stream, j, m, n, A, shiftA, lda, strideA, colnorms,
+                                    tol3z);
+        }
+    }
+
+    // the reflectors of the steps that were not executed are the identity
+    if(j < dim)
+    {
+        rocblas_int blocks = (dim - j - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(set_zero<T>, dim3(blocks, 1, batch_count), dim3(BS1, 1, 1), 0,
+                                stream, dim - j, 1, ipiv, j, 1, strideP);
+    }
+
+    if(steps)
+        *steps = j;
+
+    return rocblas_status_success;
+}
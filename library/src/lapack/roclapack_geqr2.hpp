@@ -38,10 +38,10 @@
 #include "rocblas.hpp"
 #include "rocsolver/rocsolver.h"
 
-template <bool BATCHED, typename T>
-void rocsolver_geqr2_getMemorySize(const rocblas_int m,
-                                   const rocblas_int n,
-                                   const rocblas_int batch_count,
+template <bool BATCHED, typename T, typename I>
+void rocsolver_geqr2_getMemorySize(const I m,
+                                   const I n,
+                                   const I batch_count,
                                    size_t* size_scalars,
                                    size_t* size_work_workArr,
                                    size_t* size_Abyx_norms,
@@ -59,8 +59,10 @@ void rocsolver_geqr2_getMemorySize(const rocblas_int m,
 
     // size of Abyx_norms is maximum of what is needed by larf and larfg
     // size_work_workArr is maximum of re-usable work space and array of pointers to workspace
+    // (the reflectors are applied to strips of at most w columns)
     size_t s1, s2, w1, w2;
-    rocsolver_larf_getMemorySize<BATCHED, T>(rocblas_side_left, m, n, batch_count, size_scalars,
+    const I w = std::min(n, rocsolver_column_strip(n, m));
+    rocsolver_larf_getMemorySize<BATCHED, T>(rocblas_side_left, m, w, batch_count, size_scalars,
                                              &s1, &w1);
     rocsolver_larfg_getMemorySize<T>(m, batch_count, &w2, &s2);
     *size_work_workArr = std::max(w1, w2);
@@ -70,14 +72,14 @@ void rocsolver_geqr2_getMemorySize(const rocblas_int m,
     *size_diag = sizeof(T) * batch_count;
 }
 
-template <typename T, typename U>
+template <typename T, typename I, typename U>
 rocblas_status rocsolver_geqr2_geqrf_argCheck(rocblas_handle handle,
-                                              const rocblas_int m,
-                                              const rocblas_int n,
-                                              const rocblas_int lda,
+                                              const I m,
+                                              const I n,
+                                              const I lda,
                                               T A,
                                               U ipiv,
-                                              const rocblas_int batch_count = 1)
+                                              const I batch_count = 1)
 {
     // order is important for unit tests:
 
@@ -99,17 +101,17 @@ rocblas_status rocsolver_geqr2_geqrf_argCheck(rocblas_handle handle,
     return rocblas_status_continue;
 }
 
-template <typename T, typename U, bool COMPLEX = rocblas_is_complex<T>>
+template <typename T, typename I, typename U, bool COMPLEX = rocblas_is_complex<T>>
 rocblas_status rocsolver_geqr2_template(rocblas_handle handle,
-                                        const rocblas_int m,
-                                        const rocblas_int n,
+                                        const I m,
+                                        const I n,
                                         U A,
-                                        const rocblas_int shiftA,
-                                        const rocblas_int lda,
+                                        const rocblas_stride shiftA,
+                                        const I lda,
                                         const rocblas_stride strideA,
                                         T* ipiv,
                                         const rocblas_stride strideP,
-                                        const rocblas_int batch_count,
+                                        const I batch_count,
                                         T* scalars,
                                         void* work_workArr,
                                         T* Abyx_norms,
@@ -124,9 +126,15 @@ rocblas_status rocsolver_geqr2_template(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    rocblas_int dim = std::min(m, n); // total number of pivots
+    // the 32-bit interface of rocBLAS requires the leading dimension and the batch size to
+    // fit in rocblas_int
+    if(std::is_same<I, int64_t>::value && (lda >= INT_MAX || batch_count >= INT_MAX))
+        return rocblas_status_not_implemented;
 
-    for(rocblas_int j = 0; j < dim; ++j)
+    I dim = std::min(m, n); // total number of pivots
+    I w = rocsolver_column_strip(n, lda);
+
+    for(I j = 0; j < dim; ++j)
     {
         // generate Householder reflector to work on column j
         rocsolver_larfg_template(handle, m - j, A, shiftA + idx2D(j, j, lda), A,
@@ -142,12 +150,13 @@ rocblas_status rocsolver_geqr2_template(rocblas_handle handle,
             rocsolver_lacgv_template<T>(handle, 1, ipiv, j, 1, strideP, batch_count);
 
         // Apply Householder reflector to the rest of matrix from the left
-        if(j < n - 1)
+        // (in strips of at most w columns)
+        for(I c = j + 1; c < n; c += w)
         {
-            rocsolver_larf_template(handle, rocblas_side_left, m - j, n - j - 1, A,
+            rocsolver_larf_template(handle, rocblas_side_left, m - j, std::min(n - c, w), A,
                                     shiftA + idx2D(j, j, lda), 1, strideA, (ipiv + j), strideP, A,
-                                    shiftA + idx2D(j, j + 1, lda), lda, strideA, batch_count,
-                                    scalars, Abyx_norms, (T**)work_workArr);
+                                    shiftA + idx2D(j, c, lda), lda, strideA, batch_count, scalars,
+                                    Abyx_norms, (T**)work_workArr);
         }
 
         // restore original value of A(j,j)
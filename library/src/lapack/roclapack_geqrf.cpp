@@ -27,12 +27,12 @@
 
 #include "roclapack_geqrf.hpp"
 
-template <typename T, typename U>
+template <typename T, typename I, typename U>
 rocblas_status rocsolver_geqrf_impl(rocblas_handle handle,
-                                    const rocblas_int m,
-                                    const rocblas_int n,
+                                    const I m,
+                                    const I n,
                                     U A,
-                                    const rocblas_int lda,
+                                    const I lda,
                                     T* ipiv)
 {
     ROCSOLVER_ENTER_TOP("geqrf", "-m", m, "-n", n, "--lda", lda);
@@ -46,12 +46,12 @@ rocblas_status rocsolver_geqrf_impl(rocblas_handle handle,
         return st;
 
     // working with unshifted arrays
-    rocblas_int shiftA = 0;
+    rocblas_stride shiftA = 0;
 
     // normal (non-batched non-strided) execution
     rocblas_stride strideA = 0;
     rocblas_stride stridep = 0;
-    rocblas_int batch_count = 1;
+    I batch_count = 1;
 
     // memory workspace sizes:
     // size for constants in rocblas calls
@@ -62,18 +62,24 @@ rocblas_status rocsolver_geqrf_impl(rocblas_handle handle,
     size_t size_Abyx_norms_trfact;
     // extra requirements for calling GEQR2 and LARFB
     size_t size_diag_tmptr;
+    // extra requirements to overlap the block factorizations with the trailing updates
+    size_t size_lawork = 0;
+    bool lookahead = rocsolver_handle_state_map::lookahead_enabled(handle);
+    const rocsolver_alg_mode mode
+        = rocsolver_handle_state_map::alg_mode(handle, rocsolver_function_geqrf);
     rocsolver_geqrf_getMemorySize<false, T>(m, n, batch_count, &size_scalars, &size_work_workArr,
-                                            &size_Abyx_norms_trfact, &size_diag_tmptr, &size_workArr);
+                                            &size_Abyx_norms_trfact, &size_diag_tmptr, &size_workArr,
+                                            (lookahead ? &size_lawork : nullptr));
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work_workArr,
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_scalars, size_work_workArr,
                                                       size_Abyx_norms_trfact, size_diag_tmptr,
-                                                      size_workArr);
+                                                      size_workArr, size_lawork);
 
     // memory workspace allocation
-    void *scalars, *work_workArr, *Abyx_norms_trfact, *diag_tmptr, *workArr;
+    void *scalars, *work_workArr, *Abyx_norms_trfact, *diag_tmptr, *workArr, *lawork;
     rocblas_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms_trfact,
-                              size_diag_tmptr, size_workArr);
+                              size_diag_tmptr, size_workArr, size_lawork);
 
     if(!mem)
         return rocblas_status_memory_error;
@@ -83,13 +89,15 @@ rocblas_status rocsolver_geqrf_impl(rocblas_handle handle,
     Abyx_norms_trfact = mem[2];
     diag_tmptr = mem[3];
     workArr = mem[4];
+    lawork = size_lawork > 0 ? mem[5] : nullptr;
     if(size_scalars > 0)
         init_scalars(handle, (T*)scalars);
 
     // execution
     return rocsolver_geqrf_template<false, false, T>(
         handle, m, n, A, shiftA, lda, strideA, ipiv, stridep, batch_count, (T*)scalars,
-        work_workArr, (T*)Abyx_norms_trfact, (T*)diag_tmptr, (T**)workArr);
+        work_workArr, (T*)Abyx_norms_trfact, (T*)diag_tmptr, (T**)workArr, lawork,
+        mode);
 }
 
 /*
@@ -140,4 +148,44 @@ rocblas_status rocsolver_zgeqrf(rocblas_handle handle,
     return rocsolver_geqrf_impl<rocblas_double_complex>(handle, m, n, A, lda, ipiv);
 }
 
+rocblas_status rocsolver_sgeqrf_64(rocblas_handle handle,
+                                   const int64_t m,
+                                   const int64_t n,
+                                   float* A,
+                                   const int64_t lda,
+                                   float* ipiv)
+{
+    return rocsolver_geqrf_impl<float>(handle, m, n, A, lda, ipiv);
+}
+
+rocblas_status rocsolver_dgeqrf_64(rocblas_handle handle,
+                                   const int64_t m,
+                                   const int64_t n,
+                                   double* A,
+                                   const int64_t lda,
+                                   double* ipiv)
+{
+    return rocsolver_geqrf_impl<double>(handle, m, n, A, lda, ipiv);
+}
+
+rocblas_status rocsolver_cgeqrf_64(rocblas_handle handle,
+                                   const int64_t m,
+                                   const int64_t n,
+                                   rocblas_float_complex* A,
+                                   const int64_t lda,
+                                   rocblas_float_complex* ipiv)
+{
+    return rocsolver_geqrf_impl<rocblas_float_complex>(handle, m, n, A, lda, ipiv);
+}
+
+rocblas_status rocsolver_zgeqrf_64(rocblas_handle handle,
+                                   const int64_t m,
+                                   const int64_t n,
+                                   rocblas_double_complex* A,
+                                   const int64_t lda,
+                                   rocblas_double_complex* ipiv)
+{
+    return rocsolver_geqrf_impl<rocblas_double_complex>(handle, m, n, A, lda, ipiv);
+}
+
 } // extern C
@@ -37,16 +37,19 @@
 #include "rocblas.hpp"
 #include "roclapack_geqr2.hpp"
 #include "rocsolver/rocsolver.h"
+#include "rocsolver_handle_state.hpp"
+#include "rocsolver_run_specialized_kernels.hpp"
 
-template <bool BATCHED, typename T>
-void rocsolver_geqrf_getMemorySize(const rocblas_int m,
-                                   const rocblas_int n,
-                                   const rocblas_int batch_count,
+template <bool BATCHED, typename T, typename I>
+void rocsolver_geqrf_getMemorySize(const I m,
+                                   const I n,
+                                   const I batch_count,
                                    size_t* size_scalars,
                                    size_t* size_work_workArr,
                                    size_t* size_Abyx_norms_trfact,
                                    size_t* size_diag_tmptr,
-                                   size_t* size_workArr)
+                                   size_t* size_workArr,
+                                   size_t* size_lawork = nullptr)
 {
     // if quick return no workspace needed
     if(m == 0 || n == 0 || batch_count == 0)
@@ -56,6 +59,8 @@ void rocsolver_geqrf_getMemorySize(const rocblas_int m,
         *size_Abyx_norms_trfact = 0;
         *size_diag_tmptr = 0;
         *size_workArr = 0;
+        if(size_lawork)
+            *size_lawork = 0;
         return;
     }
 
@@ -65,11 +70,16 @@ void rocsolver_geqrf_getMemorySize(const rocblas_int m,
         rocsolver_geqr2_getMemorySize<BATCHED, T>(m, n, batch_count, size_scalars, size_work_workArr,
                                                   size_Abyx_norms_trfact, size_diag_tmptr);
         *size_workArr = 0;
+        if(size_lawork)
+            *size_lawork = 0;
     }
     else
     {
         size_t w1, w2, unused, s1, s2;
-        rocblas_int jb = GEQxF_BLOCKSIZE;
+        I jb = GEQxF_BLOCKSIZE;
+
+        // the block reflectors are applied to strips of at most w columns
+        I w = std::min(n - jb, rocsolver_column_strip(n, m));
 
         // size to store the temporary triangular factor
         *size_Abyx_norms_trfact = sizeof(T) * jb * jb * batch_count;
@@ -82,8 +92,18 @@ void rocsolver_geqrf_getMemorySize(const rocblas_int m,
         rocsolver_larft_getMemorySize<BATCHED, T>(m, jb, batch_count, &unused, &w2, size_workArr);
 
         // requirements for calling LARFB
-        rocsolver_larfb_getMemorySize<BATCHED, T>(rocblas_side_left, m, n - jb, jb, batch_count,
-                                                  &s2, &unused);
+        rocsolver_larfb_getMemorySize<BATCHED, T>(rocblas_side_left, m, w, jb, batch_count, &s2,
+                                                  &unused);
+        size_t s_larfb = s2;
+
+        // requirements for calling LARFB in the recursive factorization of the sub blocks
+        // (which can be selected at run time, see rocsolver_set_alg_mode)
+        {
+            size_t s3;
+            rocsolver_larfb_getMemorySize<BATCHED, T>(rocblas_side_left, m, jb - jb / 2, jb / 2,
+                                                      batch_count, &s3, &unused);
+            s2 = std::max(s2, s3);
+        }
 
         *size_work_workArr = std::max(w1, w2);
         *size_diag_tmptr = std::max(s1, s2);
@@ -92,25 +112,212 @@ void rocsolver_geqrf_getMemorySize(const rocblas_int m,
         // LARFB's TRMM calls in the batched case
         if(BATCHED)
             *size_workArr *= 2;
+
+        // extra workspace to update the trailing matrix while the next block is
+        // factorized (look-ahead): array of pointers, triangular factor and temporary
+        // array for LARFB
+        if(size_lawork)
+            *size_lawork = *size_workArr + sizeof(T) * jb * jb * batch_count + s_larfb;
     }
 }
 
+/** This is the recursive implementation of the factorization of the
+    block columns in geqrf. The n columns of the block are split in halves until
+    there are no more than GEQRF_RECURSIVE_PANEL_MINSIZE columns left; these are factorized
+    with GEQR2. The block reflector of each left half is applied to the corresponding
+    right half with LARFT and LARFB. **/
+template <bool BATCHED, bool STRIDED, typename T, typename I, typename U>
+rocblas_status geqrf_recursive_panel(rocblas_handle handle,
+                                     const I m,
+                                     const I n,
+                                     U A,
+                                     const rocblas_stride shiftA,
+                                     const I lda,
+                                     const rocblas_stride strideA,
+                                     T* ipiv,
+                                     const rocblas_stride strideP,
+                                     const I batch_count,
+                                     T* scalars,
+                                     void* work_workArr,
+                                     T* Abyx_norms_trfact,
+                                     T* diag_tmptr,
+                                     T** workArr)
+{
+    // base case: factorize with the unblocked algorithm
+    if(n <= GEQRF_RECURSIVE_PANEL_MINSIZE || m <= GEQRF_RECURSIVE_PANEL_MINSIZE)
+        return rocsolver_geqr2_template<T>(handle, m, n, A, shiftA, lda, strideA, ipiv, strideP,
+                                           batch_count, scalars, work_workArr, Abyx_norms_trfact,
+                                           diag_tmptr);
+
+    I n1 = n / 2;
+    I n2 = n - n1;
+    I ldw = GEQxF_BLOCKSIZE;
+    rocblas_stride strideW = rocblas_stride(ldw) * ldw;
+
+    // the second half of workArr holds the pointers for LARFB
+    T** larfb_workArr = BATCHED ? workArr + batch_count : workArr;
+
+    // factorize left half
+    geqrf_recursive_panel<BATCHED, STRIDED, T>(handle, m, n1, A, shiftA, lda, strideA, ipiv,
+                                               strideP, batch_count, scalars, work_workArr,
+                                               Abyx_norms_trfact, diag_tmptr, workArr);
+
+    // apply block reflector of left half to right half
+    rocsolver_larft_template<T>(handle, rocblas_forward_direction, rocblas_column_wise, m, n1, A,
+                                shiftA, lda, strideA, ipiv, strideP, Abyx_norms_trfact, ldw,
+                                strideW, batch_count, scalars, (T*)work_workArr, workArr);
+
+    rocsolver_larfb_template<BATCHED, STRIDED, T>(
+        handle, rocblas_side_left, rocblas_operation_conjugate_transpose, rocblas_forward_direction,
+        rocblas_column_wise, m, n2, n1, A, shiftA, lda, strideA, Abyx_norms_trfact, 0, ldw, strideW,
+        A, shiftA + idx2D(0, n1, lda), lda, strideA, batch_count, diag_tmptr, larfb_workArr);
+
+    // factorize right half
+    geqrf_recursive_panel<BATCHED, STRIDED, T>(
+        handle, m - n1, n2, A, shiftA + idx2D(n1, n1, lda), lda, strideA, (ipiv + n1), strideP,
+        batch_count, scalars, work_workArr, Abyx_norms_trfact, diag_tmptr, workArr);
+
+    return rocblas_status_success;
+}
+
+/** This is the look-ahead implementation of the blocked QR factorization.
+    The block reflector of the current block is applied to the next block first; then
+    the next block is factorized on the secondary stream while the block reflector is
+    applied to the rest of the trailing matrix on the main stream. The updates on the main
+    stream use the extra workspace lawork so that they do not overlap with the workspace of
+    the block factorization. **/
 template <bool BATCHED, bool STRIDED, typename T, typename U>
+rocblas_status geqrf_lookahead(rocblas_handle handle,
+                               rocsolver_lookahead& la,
+                               const rocblas_int m,
+                               const rocblas_int n,
+                               U A,
+                               const rocblas_stride shiftA,
+                               const rocblas_int lda,
+                               const rocblas_stride strideA,
+                               T* ipiv,
+                               const rocblas_stride strideP,
+                               const rocblas_int batch_count,
+                               T* scalars,
+                               void* work_workArr,
+                               T* Abyx_norms_trfact,
+                               T* diag_tmptr,
+                               T** workArr,
+                               void* lawork,
+                               const bool recursive)
+{
+    rocblas_int dim = std::min(m, n); // total number of pivots
+    rocblas_int jb, jbn, nextpiv, j = 0;
+
+    rocblas_int nb = GEQxF_BLOCKSIZE;
+    rocblas_int ldw = GEQxF_BLOCKSIZE;
+    rocblas_stride strideW = rocblas_stride(ldw) * ldw;
+
+    // split look-ahead workspace
+    size_t size_workArr = BATCHED ? sizeof(T*) * 2 * batch_count : 0;
+    T** la_workArr = (T**)lawork;
+    T* la_trfact = (T*)((char*)lawork + size_workArr);
+    T* la_tmptr = la_trfact + size_t(ldw) * ldw * batch_count;
+
+    // the pointers to la_trfact and la_tmptr are built once for the whole factorization
+    rocsolver_ptr_array_scope la_ptr_arrays(handle, la_workArr, BATCHED ? 2 * batch_count : 0);
+    T** la_larfb_workArr = BATCHED ? la_workArr + batch_count : la_workArr;
+
+    // factorizes the block of jb columns starting at column k
+    auto factor_block = [&](rocblas_int k, rocblas_int kb) {
+        if(recursive)
+            geqrf_recursive_panel<BATCHED, STRIDED, T>(
+                handle, m - k, kb, A, shiftA + idx2D(k, k, lda), lda, strideA, (ipiv + k), strideP,
+                batch_count, scalars, work_workArr, Abyx_norms_trfact, diag_tmptr, workArr);
+        else
+            rocsolver_geqr2_template<T>(handle, m - k, kb, A, shiftA + idx2D(k, k, lda), lda,
+                                        strideA, (ipiv + k), strideP, batch_count, scalars,
+                                        work_workArr, Abyx_norms_trfact, diag_tmptr);
+    };
+
+    // factorize first block
+    factor_block(0, std::min(dim, nb));
+
+    while(j < dim - GEQxF_GEQx2_SWITCHSIZE)
+    {
+        jb = std::min(dim - j, nb); // number of columns in the block
+        nextpiv = j + jb;
+
+        if(nextpiv < n)
+        {
+            // compute block reflector
+            rocsolver_larft_template<T>(handle, rocblas_forward_direction, rocblas_column_wise,
+                                        m - j, jb, A, shiftA + idx2D(j, j, lda), lda, strideA,
+                                        (ipiv + j), strideP, la_trfact, ldw, strideW, batch_count,
+                                        scalars, (T*)work_workArr, la_workArr);
+
+            // the next block is the last one if it is factorized with a single GEQR2
+            if(nextpiv >= dim - GEQxF_GEQx2_SWITCHSIZE)
+                jbn = n - nextpiv;
+            else
+                jbn = std::min(dim - nextpiv, nb);
+
+            // apply the block reflector to the next block
+            rocsolver_larfb_template<BATCHED, STRIDED, T>(
+                handle, rocblas_side_left, rocblas_operation_conjugate_transpose,
+                rocblas_forward_direction, rocblas_column_wise, m - j, jbn, jb, A,
+                shiftA + idx2D(j, j, lda), lda, strideA, la_trfact, 0, ldw, strideW, A,
+                shiftA + idx2D(j, nextpiv, lda), lda, strideA, batch_count, la_tmptr,
+                la_larfb_workArr);
+
+            if(n - nextpiv > jbn)
+            {
+                ROCBLAS_CHECK(la.fork());
+
+                // factorize next block on the secondary stream
+                {
+                    rocsolver_stream_guard guard(handle, la.side_stream);
+                    factor_block(nextpiv, jbn);
+                }
+
+                // apply the block reflector to the rest of the trailing matrix
+                rocsolver_larfb_template<BATCHED, STRIDED, T>(
+                    handle, rocblas_side_left, rocblas_operation_conjugate_transpose,
+                    rocblas_forward_direction, rocblas_column_wise, m - j, n - nextpiv - jbn, jb,
+                    A, shiftA + idx2D(j, j, lda), lda, strideA, la_trfact, 0, ldw, strideW, A,
+                    shiftA + idx2D(j, nextpiv + jbn, lda), lda, strideA, batch_count, la_tmptr,
+                    la_larfb_workArr);
+
+                ROCBLAS_CHECK(la.join());
+            }
+            else if(nextpiv < dim - GEQxF_GEQx2_SWITCHSIZE)
+                factor_block(nextpiv, jbn);
+        }
+        j += nb;
+    }
+
+    // factor last block
+    if(j < dim)
+        rocsolver_geqr2_template<T>(handle, m - j, n - j, A, shiftA + idx2D(j, j, lda), lda,
+                                    strideA, (ipiv + j), strideP, batch_count, scalars,
+                                    work_workArr, Abyx_norms_trfact, diag_tmptr);
+
+    return rocblas_status_success;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename I, typename U>
 rocblas_status rocsolver_geqrf_template(rocblas_handle handle,
-                                        const rocblas_int m,
-                                        const rocblas_int n,
+                                        const I m,
+                                        const I n,
                                         U A,
-                                        const rocblas_int shiftA,
-                                        const rocblas_int lda,
+                                        const rocblas_stride shiftA,
+                                        const I lda,
                                         const rocblas_stride strideA,
                                         T* ipiv,
                                         const rocblas_stride strideP,
-                                        const rocblas_int batch_count,
+                                        const I batch_count,
                                         T* scalars,
                                         void* work_workArr,
                                         T* Abyx_norms_trfact,
                                         T* diag_tmptr,
-                                        T** workArr)
+                                        T** workArr,
+                                        void* lawork = nullptr,
+                                        const rocsolver_alg_mode mode = rocsolver_alg_mode_default)
 {
     ROCSOLVER_ENTER("geqrf", "m:", m, "n:", n, "shiftA:", shiftA, "lda:", lda, "bc:", batch_count);
 
@@ -121,29 +328,65 @@ rocblas_status rocsolver_geqrf_template(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    // if the matrix is small, use the unblocked (BLAS-levelII) variant of the
-    // algorithm
-    if(m <= GEQxF_GEQx2_SWITCHSIZE || n <= GEQxF_GEQx2_SWITCHSIZE)
+    // the block reflectors are applied to strips of at most w columns, so that every rocBLAS
+    // call can be addressed with 32-bit indices (w = n if the whole matrix can)
+    const I w = rocsolver_column_strip(n, lda);
+    const bool is_32bit = (w == n);
+
+    // if the matrix is small, or if the strips cannot hold a whole block, use the unblocked
+    // (BLAS-levelII) variant of the algorithm
+    if(m <= GEQxF_GEQx2_SWITCHSIZE || n <= GEQxF_GEQx2_SWITCHSIZE || w < GEQxF_BLOCKSIZE)
     {
         rocsolver_geqr2_template<T>(handle, m, n, A, shiftA, lda, strideA, ipiv, strideP, batch_count,
                                     scalars, work_workArr, Abyx_norms_trfact, diag_tmptr);
         return rocblas_status_success;
     }
 
-    rocblas_int dim = std::min(m, n); // total number of pivots
-    rocblas_int jb, j = 0;
+    // use the recursive panel factorization if enabled at build time or selected for the handle
+    const bool recursive = (GEQRF_RECURSIVE_PANEL || mode == rocsolver_alg_mode_recursive);
 
-    rocblas_int nb = GEQxF_BLOCKSIZE;
-    rocblas_int ldw = GEQxF_BLOCKSIZE;
+    // in the batched case, workArr holds the pointers to the triangular factor for LARFT and,
+    // in its second half, the pointers to the temporary array for LARFB; the pointers are
+    // built once for the whole factorization (except when the strides of the temporary
+    // array change)
+    rocsolver_ptr_array_scope ptr_arrays(handle, workArr, BATCHED ? 2 * batch_count : 0);
+    T** larfb_workArr = BATCHED ? workArr + batch_count : workArr;
+
+    // use look-ahead if enabled for the handle and the extra workspace was provided
+    // (only when the matrix can be addressed with 32-bit indices)
+    if(lawork && is_32bit)
+    {
+        rocsolver_lookahead la(handle);
+        if(la.enabled)
+            return geqrf_lookahead<BATCHED, STRIDED, T>(
+                handle, la, m, n, A, shiftA, lda, strideA, ipiv, strideP, batch_count, scalars,
+                work_workArr, Abyx_norms_trfact, diag_tmptr, workArr, lawork, recursive);
+    }
+
+    I dim = std::min(m, n); // total number of pivots
+    I jb, j = 0;
+
+    I nb = GEQxF_BLOCKSIZE;
+    I ldw = GEQxF_BLOCKSIZE;
     rocblas_stride strideW = rocblas_stride(ldw) * ldw;
 
+    // for moderate sizes and large batches, apply the block reflectors with the fused
+    // panel-apply kernel
+    const bool use_panel_apply = (BATCHED || STRIDED) && is_32bit
+        && rocsolver_use_panel_apply<T>(handle, dim, nb, batch_count);
+
     while(j < dim - GEQxF_GEQx2_SWITCHSIZE)
     {
         // Factor diagonal and subdiagonal blocks
         jb = std::min(dim - j, nb); // number of columns in the block
-        rocsolver_geqr2_template<T>(handle, m - j, jb, A, shiftA + idx2D(j, j, lda), lda, strideA,
-                                    (ipiv + j), strideP, batch_count, scalars, work_workArr,
-                                    Abyx_norms_trfact, diag_tmptr);
+        if(recursive)
+            geqrf_recursive_panel<BATCHED, STRIDED, T>(
+                handle, m - j, jb, A, shiftA + idx2D(j, j, lda), lda, strideA, (ipiv + j), strideP,
+                batch_count, scalars, work_workArr, Abyx_norms_trfact, diag_tmptr, workArr);
+        else
+            rocsolver_geqr2_template<T>(handle, m - j, jb, A, shiftA + idx2D(j, j, lda), lda,
+                                        strideA, (ipiv + j), strideP, batch_count, scalars,
+                                        work_workArr, Abyx_norms_trfact, diag_tmptr);
 
         // apply transformation to the rest of the matrix
         if(j + jb < n)
@@ -155,11 +398,21 @@ rocblas_status rocsolver_geqrf_template(rocblas_handle handle,
                                         batch_count, scalars, (T*)work_workArr, workArr);
 
             // apply the block reflector
-            rocsolver_larfb_template<BATCHED, STRIDED, T>(
-                handle, rocblas_side_left, rocblas_operation_conjugate_transpose,
-                rocblas_forward_direction, rocblas_column_wise, m - j, n - j - jb, jb, A,
-                shiftA + idx2D(j, j, lda), lda, strideA, Abyx_norms_trfact, 0, ldw, strideW, A,
-                shiftA + idx2D(j, j + jb, lda), lda, strideA, batch_count, diag_tmptr, workArr);
+            if(use_panel_apply)
+                rocsolver_larfb_panel_apply<BATCHED, STRIDED, T, rocblas_int>(
+                    handle, m - j, n - j - jb, jb, A, shiftA + idx2D(j, j, lda), lda, strideA,
+                    Abyx_norms_trfact, ldw, strideW, A, shiftA + idx2D(j, j + jb, lda), lda,
+                    strideA, batch_count);
+            else
+            {
+                for(I c = j + jb; c < n; c += w)
+                    rocsolver_larfb_template<BATCHED, STRIDED, T>(
+                        handle, rocblas_side_left, rocblas_operation_conjugate_transpose,
+                        rocblas_forward_direction, rocblas_column_wise, m - j, std::min(n - c, w),
+                        jb, A, shiftA + idx2D(j, j, lda), lda, strideA, Abyx_norms_trfact, 0, ldw,
+                        strideW, A, shiftA + idx2D(j, c, lda), lda, strideA, batch_count,
+                        diag_tmptr, larfb_workArr);
+            }
         }
         j += nb;
     }
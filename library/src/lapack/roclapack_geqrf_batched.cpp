@@ -27,15 +27,15 @@
 
 #include "roclapack_geqrf.hpp"
 
-template <typename T, typename U>
+template <typename T, typename I, typename U>
 rocblas_status rocsolver_geqrf_batched_impl(rocblas_handle handle,
-                                            const rocblas_int m,
-                                            const rocblas_int n,
+                                            const I m,
+                                            const I n,
                                             U A,
-                                            const rocblas_int lda,
+                                            const I lda,
                                             T* ipiv,
                                             const rocblas_stride stridep,
-                                            const rocblas_int batch_count)
+                                            const I batch_count)
 {
     ROCSOLVER_ENTER_TOP("geqrf_batched", "-m", m, "-n", n, "--lda", lda, "--strideP", stridep,
                         "--batch_count", batch_count);
@@ -49,7 +49,7 @@ rocblas_status rocsolver_geqrf_batched_impl(rocblas_handle handle,
         return st;
 
     // working with unshifted arrays
-    rocblas_int shiftA = 0;
+    rocblas_stride shiftA = 0;
 
     // batched execution
     rocblas_stride strideA = 0;
@@ -63,18 +63,48 @@ rocblas_status rocsolver_geqrf_batched_impl(rocblas_handle handle,
     size_t size_Abyx_norms_trfact;
     // extra requirements for calling GEQR2 and LARFB
     size_t size_diag_tmptr;
+    // extra requirements to overlap the block factorizations with the trailing updates
+    size_t size_lawork = 0;
+    bool lookahead = rocsolver_handle_state_map::lookahead_enabled(handle);
+    const rocsolver_alg_mode mode
+        = rocsolver_handle_state_map::alg_mode(handle, rocsolver_function_geqrf);
     rocsolver_geqrf_getMemorySize<true, T>(m, n, batch_count, &size_scalars, &size_work_workArr,
-                                           &size_Abyx_norms_trfact, &size_diag_tmptr, &size_workArr);
+                                           &size_Abyx_norms_trfact, &size_diag_tmptr, &size_workArr,
+                                           (lookahead ? &size_lawork : nullptr));
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work_workArr,
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_scalars, size_work_workArr,
                                                       size_Abyx_norms_trfact, size_diag_tmptr,
-                                                      size_workArr);
+                                                      size_workArr, size_lawork);
+
+    // budgeted execution: if the workspace exceeds the budget set for the handle, look-ahead is
+    // not used and, if still needed, the batch is split in chunks
+    I chunk = batch_count;
+    size_t budget = rocsolver_handle_state_map::workspace_budget(handle);
+    if(budget > 0
+       && rocsolver_workspace_size({size_scalars, size_work_workArr, size_Abyx_norms_trfact,
+                                    size_diag_tmptr, size_workArr, size_lawork})
+           > budget)
+    {
+        size_lawork = 0;
+        auto nolookahead_size = [&](I bc) {
+            rocsolver_geqrf_getMemorySize<true, T>(m, n, bc, &size_scalars, &size_work_workArr,
+                                                   &size_Abyx_norms_trfact, &size_diag_tmptr,
+                                                   &size_workArr);
+            return rocsolver_workspace_size({size_scalars, size_work_workArr,
+                                             size_Abyx_norms_trfact, size_diag_tmptr, size_workArr,
+                                             size_lawork});
+        };
+        chunk = rocsolver_plan_batch_chunk(budget, batch_count, nolookahead_size);
+        if(chunk == 0)
+            return rocblas_status_memory_error;
+        nolookahead_size(chunk);
+    }
 
     // memory workspace allocation
-    void *scalars, *work_workArr, *Abyx_norms_trfact, *diag_tmptr, *workArr;
+    void *scalars, *work_workArr, *Abyx_norms_trfact, *diag_tmptr, *workArr, *lawork;
     rocblas_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms_trfact,
-                              size_diag_tmptr, size_workArr);
+                              size_diag_tmptr, size_workArr, size_lawork);
 
     if(!mem)
         return rocblas_status_memory_error;
@@ -84,13 +114,22 @@ rocblas_status rocsolver_geqrf_batched_impl(rocblas_handle handle,
     Abyx_norms_trfact = mem[2];
     diag_tmptr = mem[3];
     workArr = mem[4];
+    lawork = size_lawork > 0 ? mem[5] : nullptr;
     if(size_scalars > 0)
         init_scalars(handle, (T*)scalars);
 
     // execution
-    return rocsolver_geqrf_template<true, false, T>(
-        handle, m, n, A, shiftA, lda, strideA, ipiv, stridep, batch_count, (T*)scalars,
-        work_workArr, (T*)Abyx_norms_trfact, (T*)diag_tmptr, (T**)workArr);
+    for(I b = 0; b < batch_count; b += chunk)
+    {
+        st = rocsolver_geqrf_template<true, false, T>(
+            handle, m, n, A + b, shiftA, lda, strideA, ipiv + b * stridep, stridep,
+            std::min(chunk, batch_count - b), (T*)scalars, work_workArr, (T*)Abyx_norms_trfact,
+            (T*)diag_tmptr, (T**)workArr, lawork, mode);
+        if(st != rocblas_status_success)
+            return st;
+    }
+
+    return rocblas_status_success;
 }
 
 /*
@@ -151,4 +190,54 @@ rocblas_status rocsolver_zgeqrf_batched(rocblas_handle handle,
                                                                 batch_count);
 }
 
+rocblas_status rocsolver_sgeqrf_batched_64(rocblas_handle handle,
+                                           const int64_t m,
+                                           const int64_t n,
+                                           float* const A[],
+                                           const int64_t lda,
+                                           float* ipiv,
+                                           const rocblas_stride stridep,
+                                           const int64_t batch_count)
+{
+    return rocsolver_geqrf_batched_impl<float>(handle, m, n, A, lda, ipiv, stridep, batch_count);
+}
+
+rocblas_status rocsolver_dgeqrf_batched_64(rocblas_handle handle,
+                                           const int64_t m,
+                                           const int64_t n,
+                                           double* const A[],
+                                           const int64_t lda,
+                                           double* ipiv,
+                                           const rocblas_stride stridep,
+                                           const int64_t batch_count)
+{
+    return rocsolver_geqrf_batched_impl<double>(handle, m, n, A, lda, ipiv, stridep, batch_count);
+}
+
+rocblas_status rocsolver_cgeqrf_batched_64(rocblas_handle handle,
+                                           const int64_t m,
+                                           const int64_t n,
+                                           rocblas_float_complex* const A[],
+                                           const int64_t lda,
+                                           rocblas_float_complex* ipiv,
+                                           const rocblas_stride stridep,
+                                           const int64_t batch_count)
+{
+    return rocsolver_geqrf_batched_impl<rocblas_float_complex>(handle, m, n, A, lda, ipiv, stridep,
+                                                               batch_count);
+}
+
+rocblas_status rocsolver_zgeqrf_batched_64(rocblas_handle handle,
+                                           const int64_t m,
+                                           const int64_t n,
+                                           rocblas_double_complex* const A[],
+                                           const int64_t lda,
+                                           rocblas_double_complex* ipiv,
+                                           const rocblas_stride stridep,
+                                           const int64_t batch_count)
+{
+    return rocsolver_geqrf_batched_impl<rocblas_double_complex>(handle, m, n, A, lda, ipiv, stridep,
+                                                                batch_count);
+}
+
 } // extern C
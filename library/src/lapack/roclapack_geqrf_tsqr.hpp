@@ -0,0 +1,294 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+
+#pragma once
+
+#include "lapack_device_functions.hpp"
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+/** The tall-skinny QR factorization (TSQR) splits the m-by-n matrix A into nblocks blocks
+    of mb rows (the last block takes the remaining rows) and factorizes every block
+    independently. The triangular factors of the blocks are then combined pairwise in a
+    binary tree: at level l, the factor of block b (with b a multiple of 2^(l+1)) is
+    combined with the factor of block b + 2^l.
+
+    The compact storage of the factorization is as follows:
+    - the Householder vectors of the factorization of block b are stored below the diagonal
+      of the block, and their scalars in ipiv[b*n : (b+1)*n-1];
+    - the Householder vectors that combine the factor of block b > 0 with the factor of its
+      partner are upper triangular, and are stored in place of the triangular factor of
+      block b; their scalars are stored in ipiv[(nblocks+b)*n : (nblocks+b+1)*n-1];
+    - the final triangular factor R is stored in the upper triangular part of the first block,
+      i.e. in the upper triangular part of A as in GEQRF.
+    As mb >= n, the array ipiv has at most 2*m elements. **/
+
+/** TSQR_BLOCKS computes the number of rows of the blocks and the number of blocks
+    used to factorize a m-by-n matrix with m >= n. **/
+inline void rocsolver_tsqr_blocks(const rocblas_int m,
+                                  const rocblas_int n,
+                                  rocblas_int* mb,
+                                  rocblas_int* nblocks)
+{
+    *mb = std::max(TSQR_BLOCKSIZE, n);
+    *nblocks = std::max(1, m / *mb);
+}
+
+/** TSQR_HOUSEHOLDER computes the Householder reflector H such that H'*[alpha; x] = [beta; 0]
+    (as in LARFG), given alpha and the squared norm of x. On exit, alpha is overwritten by beta,
+    tau is the Householder scalar, and scal is the factor that must be applied to x to obtain
+    the Householder vector. **/
+template <typename T, typename S>
+__device__ void tsqr_householder(T& alpha, const S xnorm2, T& tau, T& scal)
+{
+    S ai2 = 0;
+    if constexpr(rocblas_is_complex<T>)
+        ai2 = alpha.imag() * alpha.imag();
+
+    if(xnorm2 > 0 || ai2 > 0)
+    {
+        S beta = sqrt(std::norm(alpha) + xnorm2);
+        beta = (std::real(alpha) >= 0) ? -beta : beta;
+        tau = (T(beta) - alpha) / T(beta);
+        scal = T(1) / (alpha - T(beta));
+        alpha = T(beta);
+    }
+    else
+    {
+        tau = 0;
+        scal = 1;
+    }
+}
+
+/** TSQR_LEAF_FACTOR computes the QR factorization of every block of rows of A
+    (as in GEQR2). There is a thread-block per block of rows. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) tsqr_leaf_factor(const rocblas_int m,
+                                                              const rocblas_int n,
+                                                              const rocblas_int mb,
+                                                              const rocblas_int nblocks,
+                                                              U A,
+                                                              const rocblas_int shiftA,
+                                                              const rocblas_int lda,
+                                                              const rocblas_stride strideA,
+                                                              T* ipiv,
+                                                              const rocblas_stride strideP)
+{
+    using S = decltype(std::real(T{}));
+
+    const rocblas_int bid = hipBlockIdx_y;
+    const rocblas_int blk = hipBlockIdx_x;
+    const rocblas_int tid = hipThreadIdx_x;
+    const rocblas_int rows = (blk == nblocks - 1) ? m - blk * mb : mb;
+
+    __shared__ S snorm[BS1];
+    __shared__ T sdot[BS1];
+
+    T* a = load_ptr_batch<T>(A, bid, shiftA, strideA) + blk * mb;
+    T* tau = ipiv + bid * strideP + blk * n;
+
+    for(rocblas_int j = 0; j < n; j++)
+    {
+        // generate the reflector of column j
+        T alpha = a[j + j * lda];
+        S xnorm2 = 0;
+        for(rocblas_int i = j + 1 + tid; i < rows; i += BS1)
+            xnorm2 += std::norm(a[i + j * lda]);
+        xnorm2 = block_sum<BS1>(tid, xnorm2, snorm);
+
+        T t, scal;
+        tsqr_householder(alpha, xnorm2, t, scal);
+
+        for(rocblas_int i = j + 1 + tid; i < rows; i += BS1)
+            a[i + j * lda] *= scal;
+        if(tid == 0)
+        {
+            a[j + j * lda] = alpha;
+            tau[j] = t;
+        }
+        __syncthreads();
+
+        // apply the reflector to columns j+1 to n-1
+        const T ct = conj(t);
+        for(rocblas_int c = j + 1; c < n; c++)
+        {
+            T d = (tid == 0) ? a[j + c * lda] : T(0);
+            for(rocblas_int i = j + 1 + tid; i < rows; i += BS1)
+                d += conj(a[i + j * lda]) * a[i + c * lda];
+            d = block_sum<BS1>(tid, d, sdot) * ct;
+
+            if(tid == 0)
+                a[j + c * lda] -= d;
+            for(rocblas_int i = j + 1 + tid; i < rows; i += BS1)
+                a[i + c * lda] -= a[i + j * lda] * d;
+        }
+        __syncthreads();
+    }
+}
+
+/** TSQR_TREE_FACTOR computes the QR factorization of the 2n-by-n matrix formed by stacking
+    the triangular factors of a pair of blocks at the given level of the tree. The resulting
+    factor overwrites the factor of the first block, and the Householder vectors overwrite the
+    factor of the second block. There is a thread-block per pair of blocks. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) tsqr_tree_factor(const rocblas_int n,
+                                                              const rocblas_int mb,
+                                                              const rocblas_int nblocks,
+                                                              const rocblas_int level,
+                                                              U A,
+                                                              const rocblas_int shiftA,
+                                                              const rocblas_int lda,
+                                                              const rocblas_stride strideA,
+                                                              T* ipiv,
+                                                              const rocblas_stride strideP)
+{
+    using S = decltype(std::real(T{}));
+
+    const rocblas_int bid = hipBlockIdx_y;
+    const rocblas_int tid = hipThreadIdx_x;
+    const rocblas_int top = hipBlockIdx_x << (level + 1);
+    const rocblas_int bot = top + (1 << level);
+
+    if(bot >= nblocks)
+        return;
+
+    __shared__ S snorm[BS1];
+
+    T* a = load_ptr_batch<T>(A, bid, shiftA, strideA);
+    T* r1 = a + top * mb;
+    T* r2 = a + bot * mb;
+    T* tau = ipiv + bid * strideP + (nblocks + bot) * n;
+
+    for(rocblas_int k = 0; k < n; k++)
+    {
+        // generate the reflector of column k (only the first k+1 elements of the
+        // column of the second factor are nonzero)
+        T alpha = r1[k + k * lda];
+        S xnorm2 = 0;
+        for(rocblas_int i = tid; i <= k; i += BS1)
+            xnorm2 += std::norm(r2[i + k * lda]);
+        xnorm2 = block_sum<BS1>(tid, xnorm2, snorm);
+
+        T t, scal;
+        tsqr_householder(alpha, xnorm2, t, scal);
+
+        for(rocblas_int i = tid; i <= k; i += BS1)
+            r2[i + k * lda] *= scal;
+        if(tid == 0)
+        {
+            r1[k + k * lda] = alpha;
+            tau[k] = t;
+        }
+        __syncthreads();
+
+        // apply the reflector to columns k+1 to n-1 (a column per thread)
+        const T ct = conj(t);
+        for(rocblas_int c = k + 1 + tid; c < n; c += BS1)
+        {
+            T d = r1[k + c * lda];
+            for(rocblas_int i = 0; i <= k; i++)
+                d += conj(r2[i + k * lda]) * r2[i + c * lda];
+            d *= ct;
+
+            r1[k + c * lda] -= d;
+            for(rocblas_int i = 0; i <= k; i++)
+                r2[i + c * lda] -= r2[i + k * lda] * d;
+        }
+        __syncthreads();
+    }
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_geqrf_tsqr_argCheck(rocblas_handle handle,
+                                             const rocblas_int m,
+                                             const rocblas_int n,
+                                             const rocblas_int lda,
+                                             T A,
+                                             U ipiv,
+                                             const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(m < 0 || n < 0 || n > m || lda < m || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((m && n && !A) || (m && n && !ipiv))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_geqrf_tsqr_template(rocblas_handle handle,
+                                             const rocblas_int m,
+                                             const rocblas_int n,
+                                             U A,
+                                             const rocblas_int shiftA,
+                                             const rocblas_int lda,
+                                             const rocblas_stride strideA,
+                                             T* ipiv,
+                                             const rocblas_stride strideP,
+                                             const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("geqrf_tsqr", "m:", m, "n:", n, "shiftA:", shiftA, "lda:", lda,
+                    "bc:", batch_count);
+
+    // quick return
+    if(m == 0 || n == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int mb, nblocks;
+    rocsolver_tsqr_blocks(m, n, &mb, &nblocks);
+
+    // factorize the blocks of rows
+    ROCSOLVER_LAUNCH_KERNEL((tsqr_leaf_factor<T>), dim3(nblocks, batch_count, 1), dim3(BS1, 1, 1),
+                            0, stream, m, n, mb, nblocks, A, shiftA, lda, strideA, ipiv, strideP);
+
+    // combine the triangular factors
+    for(rocblas_int level = 0; (1 << level) < nblocks; level++)
+    {
+        rocblas_int pairs = (nblocks - 1) / (2 << level) + 1;
+        ROCSOLVER_LAUNCH_KERNEL((tsqr_tree_factor<T>), dim3(pairs, batch_count, 1),
+                                dim3(BS1, 1, 1), 0, stream, n, mb, nblocks, level, A, shiftA, lda,
+                                strideA, ipiv, strideP);
+    }
+
+    return rocblas_status_success;
+}
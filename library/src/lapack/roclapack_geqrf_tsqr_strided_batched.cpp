@@ -0,0 +1,130 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_geqrf_tsqr.hpp"
+
+template <typename T>
+rocblas_status rocsolver_geqrf_tsqr_strided_batched_impl(rocblas_handle handle,
+                                                         const rocblas_int m,
+                                                         const rocblas_int n,
+                                                         T* A,
+                                                         const rocblas_int lda,
+                                                         const rocblas_stride strideA,
+                                                         T* ipiv,
+                                                         const rocblas_stride strideP,
+                                                         const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("geqrf_tsqr_strided_batched", "-m", m, "-n", n, "--lda", lda, "--strideA",
+                        strideA, "--strideP", strideP, "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_geqrf_tsqr_argCheck(handle, m, n, lda, A, ipiv, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+    if(strideP < 2 * m)
+        return rocblas_status_invalid_size;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // this function does not require memory work space
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_size_unchanged;
+
+    // execution
+    return rocsolver_geqrf_tsqr_template<T>(handle, m, n, A, shiftA, lda, strideA, ipiv, strideP,
+                                            batch_count);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgeqrf_tsqr_strided_batched(rocblas_handle handle,
+                                                     const rocblas_int m,
+                                                     const rocblas_int n,
+                                                     float* A,
+                                                     const rocblas_int lda,
+                                                     const rocblas_stride strideA,
+                                                     float* ipiv,
+                                                     const rocblas_stride strideP,
+                                                     const rocblas_int batch_count)
+{
+    return rocsolver_geqrf_tsqr_strided_batched_impl<float>(handle, m, n, A, lda, strideA, ipiv,
+                                                            strideP, batch_count);
+}
+
+rocblas_status rocsolver_dgeqrf_tsqr_strided_batched(rocblas_handle handle,
+                                                     const rocblas_int m,
+                                                     const rocblas_int n,
+                                                     double* A,
+                                                     const rocblas_int lda,
+                                                     const rocblas_stride strideA,
+                                                     double* ipiv,
+                                                     const rocblas_stride strideP,
+                                                     const rocblas_int batch_count)
+{
+    return rocsolver_geqrf_tsqr_strided_batched_impl<double>(handle, m, n, A, lda, strideA, ipiv,
+                                                             strideP, batch_count);
+}
+
+rocblas_status rocsolver_cgeqrf_tsqr_strided_batched(rocblas_handle handle,
+                                                     const rocblas_int m,
+                                                     const rocblas_int n,
+                                                     rocblas_float_complex* A,
+                                                     const rocblas_int lda,
+                                                     const rocblas_stride strideA,
+                                                     rocblas_float_complex* ipiv,
+                                                     const rocblas_stride strideP,
+                                                     const rocblas_int batch_count)
+{
+    return rocsolver_geqrf_tsqr_strided_batched_impl<rocblas_float_complex>(
+        handle, m, n, A, lda, strideA, ipiv, strideP, batch_count);
+}
+
+rocblas_status rocsolver_zgeqrf_tsqr_strided_batched(rocblas_handle handle,
+                                                     const rocblas_int m,
+                                                     const rocblas_int n,
+                                                     rocblas_double_complex* A,
+                                                     const rocblas_int lda,
+                                                     const rocblas_stride strideA,
+                                                     rocblas_double_complex* ipiv,
+                                                     const rocblas_stride strideP,
+                                                     const rocblas_int batch_count)
+{
+    return rocsolver_geqrf_tsqr_strided_batched_impl<rocblas_double_complex>(
+        handle, m, n, A, lda, strideA, ipiv, strideP, batch_count);
+}
+
+} // extern C
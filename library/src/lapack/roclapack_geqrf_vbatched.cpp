@@ -0,0 +1,187 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+#include "roclapack_vbatched.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_geqrf_vbatched_impl(rocblas_handle handle,
+                                             const rocblas_int* m,
+                                             const rocblas_int* n,
+                                             U A,
+                                             const rocblas_int* lda,
+                                             T* const ipiv[],
+                                             const rocblas_int max_m,
+                                             const rocblas_int max_n,
+                                             const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("geqrf_vbatched", "--max_m", max_m, "--max_n", max_n, "--batch_count",
+                        batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_geqrf_vbatched_argCheck(handle, m, n, lda, A, ipiv, max_m, max_n,
+                                                          batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // memory workspace sizes:
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of arrays of pointers (for batched cases) and re-usable workspace
+    size_t size_work_workArr, size_workArr;
+    // extra requirements for calling GEQR2 and to store temporary triangular factor
+    size_t size_Abyx_norms_trfact;
+    // extra requirements for calling GEQR2 and LARFB
+    size_t size_diag_tmptr;
+    // size to sort the problems, store their order and the pointers to the matrices of a group
+    size_t size_sort, size_order, size_Aarr;
+    // size to store the Householder scalars of a group
+    size_t size_gipiv;
+    // size to pad the matrices of a group
+    size_t size_pad;
+    rocsolver_geqrf_vbatched_getMemorySize<T>(
+        max_m, max_n, batch_count, &size_scalars, &size_work_workArr, &size_Abyx_norms_trfact,
+        &size_diag_tmptr, &size_workArr, &size_sort, &size_order, &size_Aarr, &size_gipiv,
+        &size_pad);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(
+            handle, size_scalars, size_work_workArr, size_Abyx_norms_trfact, size_diag_tmptr,
+            size_workArr, size_sort, size_order, size_Aarr, size_gipiv, size_pad);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    // memory workspace allocation
+    void *scalars, *work_workArr, *Abyx_norms_trfact, *diag_tmptr, *workArr;
+    void *sort, *order, *Aarr, *gipiv, *pad;
+    rocblas_device_malloc mem(handle, size_scalars, size_work_workArr, size_Abyx_norms_trfact,
+                              size_diag_tmptr, size_workArr, size_sort, size_order, size_Aarr,
+                              size_gipiv, size_pad);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    work_workArr = mem[1];
+    Abyx_norms_trfact = mem[2];
+    diag_tmptr = mem[3];
+    workArr = mem[4];
+    sort = mem[5];
+    order = mem[6];
+    Aarr = mem[7];
+    gipiv = mem[8];
+    pad = mem[9];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    // group the problems by size class
+    rocsolver_vbatched_groups<3> groups;
+    st = rocsolver_vbatched_sort<T, 3, 2>(
+        handle, batch_count, {m, n, lda},
+        [&](const std::array<rocblas_int, 3>& d) {
+            return d[0] < 0 || d[1] < 0 || d[0] > max_m || d[1] > max_n || d[2] < d[0]
+                || d[2] < 1;
+        },
+        sort, (rocblas_int*)order, groups);
+    if(st != rocblas_status_success)
+        return st;
+
+    // execution
+    return rocsolver_geqrf_vbatched_template<T>(
+        handle, m, n, A, lda, ipiv, groups, (T*)scalars, work_workArr, (T*)Abyx_norms_trfact,
+        (T*)diag_tmptr, (T**)workArr, (rocblas_int*)order, (T**)Aarr, (T*)gipiv, (T*)pad,
+        size_pad);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgeqrf_vbatched(rocblas_handle handle,
+                                         const rocblas_int* m,
+                                         const rocblas_int* n,
+                                         float* const A[],
+                                         const rocblas_int* lda,
+                                         float* const ipiv[],
+                                         const rocblas_int max_m,
+                                         const rocblas_int max_n,
+                                         const rocblas_int batch_count)
+{
+    return rocsolver_geqrf_vbatched_impl<float>(handle, m, n, A, lda, ipiv, max_m, max_n,
+                                                batch_count);
+}
+
+rocblas_status rocsolver_dgeqrf_vbatched(rocblas_handle handle,
+                                         const rocblas_int* m,
+                                         const rocblas_int* n,
+                                         double* const A[],
+                                         const rocblas_int* lda,
+                                         double* const ipiv[],
+                                         const rocblas_int max_m,
+                                         const rocblas_int max_n,
+                                         const rocblas_int batch_count)
+{
+    return rocsolver_geqrf_vbatched_impl<double>(handle, m, n, A, lda, ipiv, max_m, max_n,
+                                                 batch_count);
+}
+
+rocblas_status rocsolver_cgeqrf_vbatched(rocblas_handle handle,
+                                         const rocblas_int* m,
+                                         const rocblas_int* n,
+                                         rocblas_float_complex* const A[],
+                                         const rocblas_int* lda,
+                                         rocblas_float_complex* const ipiv[],
+                                         const rocblas_int max_m,
+                                         const rocblas_int max_n,
+                                         const rocblas_int batch_count)
+{
+    return rocsolver_geqrf_vbatched_impl<rocblas_float_complex>(handle, m, n, A, lda, ipiv,
+                                                                max_m, max_n, batch_count);
+}
+
+rocblas_status rocsolver_zgeqrf_vbatched(rocblas_handle handle,
+                                         const rocblas_int* m,
+                                         const rocblas_int* n,
+                                         rocblas_double_complex* const A[],
+                                         const rocblas_int* lda,
+                                         rocblas_double_complex* const ipiv[],
+                                         const rocblas_int max_m,
+                                         const rocblas_int max_n,
+                                         const rocblas_int batch_count)
+{
+    return rocsolver_geqrf_vbatched_impl<rocblas_double_complex>(handle, m, n, A, lda, ipiv,
+                                                                 max_m, max_n, batch_count);
+}
+
+} // extern C
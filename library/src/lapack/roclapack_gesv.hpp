@@ -69,6 +69,182 @@ rocblas_status rocsolver_gesv_argCheck(rocblas_handle handle,
     return rocblas_status_continue;
 }
 
+/** GESV_SMALL_KERNEL computes the LU factorization with partial pivoting of a small matrix A
+    and solves the system AX = B in a single call. A is factorized in the LDS, one row per
+    thread, and then each thread solves a column of B (read from B and written to X, which can be
+    the same array). X is only written if A is non-singular.
+    Call this kernel with one group of GESV_SMALL_SWITCHSIZE threads per batch instance.
+    The size of the dynamic LDS is given by gesv_small_lds_size. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(GESV_SMALL_SWITCHSIZE)
+    gesv_small_kernel(const rocblas_int n,
+                      const rocblas_int nrhs,
+                      U AA,
+                      const rocblas_int shiftA,
+                      const rocblas_int lda,
+                      const rocblas_stride strideA,
+                      rocblas_int* ipivA,
+                      const rocblas_stride strideP,
+                      U BB,
+                      const rocblas_int shiftB,
+                      const rocblas_int ldb,
+                      const rocblas_stride strideB,
+                      U XX,
+                      const rocblas_int shiftX,
+                      const rocblas_int ldx,
+                      const rocblas_stride strideX,
+                      rocblas_int* info)
+{
+    using S = decltype(std::real(T{}));
+
+    const rocblas_int bid = hipBlockIdx_x;
+    const rocblas_int tid = hipThreadIdx_x;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    T* B = load_ptr_batch<T>(BB, bid, shiftB, strideB);
+    T* X = load_ptr_batch<T>(XX, bid, shiftX, strideX);
+    rocblas_int* ipiv = ipivA + bid * strideP;
+
+    // shared memory: the matrix, one column of the right-hand side per thread, and the pivots
+    extern __shared__ double lmem[];
+    T* sA = reinterpret_cast<T*>(lmem);
+    T* x = sA + n * n + tid * n;
+    rocblas_int* spiv = reinterpret_cast<rocblas_int*>(sA + n * n + GESV_SMALL_SWITCHSIZE * n);
+
+    // read A into the LDS
+    if(tid < n)
+    {
+        for(rocblas_int j = 0; j < n; j++)
+            sA[tid + j * n] = A[tid + j * lda];
+    }
+    __syncthreads();
+
+    // factorization (all threads find the same pivot)
+    rocblas_int myinfo = 0;
+    for(rocblas_int k = 0; k < n; k++)
+    {
+        rocblas_int p = k;
+        S pmax = aabs<S>(sA[k + k * n]);
+        for(rocblas_int i = k + 1; i < n; i++)
+        {
+            S val = aabs<S>(sA[i + k * n]);
+            if(val > pmax)
+            {
+                pmax = val;
+                p = i;
+            }
+        }
+        if(tid == 0)
+            spiv[k] = p;
+        __syncthreads();
+
+        // swap rows
+        if(p != k && tid < n)
+            swap(sA[k + tid * n], sA[p + tid * n]);
+        __syncthreads();
+
+        // scale current column and update trailing matrix
+        const T pivot = sA[k + k * n];
+        if(pivot == T(0))
+        {
+            if(myinfo == 0)
+                myinfo = k + 1;
+        }
+        else if(tid > k && tid < n)
+        {
+            const T l = sA[tid + k * n] / pivot;
+            sA[tid + k * n] = l;
+            for(rocblas_int j = k + 1; j < n; j++)
+                sA[tid + j * n] -= l * sA[k + j * n];
+        }
+        __syncthreads();
+    }
+
+    // write the factorization to global memory
+    if(tid < n)
+    {
+        ipiv[tid] = spiv[tid] + 1;
+        for(rocblas_int j = 0; j < n; j++)
+            A[tid + j * lda] = sA[tid + j * n];
+    }
+    if(tid == 0)
+        info[bid] = myinfo;
+
+    // solve AX = B only if A is non-singular
+    if(myinfo != 0)
+        return;
+
+    for(rocblas_int c = tid; c < nrhs; c += GESV_SMALL_SWITCHSIZE)
+    {
+        // apply row interchanges
+        for(rocblas_int i = 0; i < n; i++)
+            x[i] = B[i + c * ldb];
+        for(rocblas_int k = 0; k < n; k++)
+        {
+            if(spiv[k] != k)
+                swap(x[k], x[spiv[k]]);
+        }
+
+        // forward substitution with L (unit diagonal)
+        for(rocblas_int k = 0; k < n; k++)
+        {
+            for(rocblas_int i = k + 1; i < n; i++)
+                x[i] -= sA[i + k * n] * x[k];
+        }
+
+        // backward substitution with U
+        for(rocblas_int k = n - 1; k >= 0; k--)
+        {
+            x[k] /= sA[k + k * n];
+            for(rocblas_int i = 0; i < k; i++)
+                x[i] -= sA[i + k * n] * x[k];
+        }
+
+        for(rocblas_int i = 0; i < n; i++)
+            X[i + c * ldx] = x[i];
+    }
+}
+
+/** Returns the size of the dynamic LDS required by gesv_small_kernel **/
+template <typename T>
+size_t gesv_small_lds_size(const rocblas_int n)
+{
+    return sizeof(T) * (n * n + GESV_SMALL_SWITCHSIZE * n) + sizeof(rocblas_int) * n;
+}
+
+/** Launches gesv_small_kernel. B and X can be the same array. **/
+template <typename T, typename U>
+void gesv_run_small(rocblas_handle handle,
+                    const rocblas_int n,
+                    const rocblas_int nrhs,
+                    U A,
+                    const rocblas_int shiftA,
+                    const rocblas_int lda,
+                    const rocblas_stride strideA,
+                    rocblas_int* ipiv,
+                    const rocblas_stride strideP,
+                    U B,
+                    const rocblas_int shiftB,
+                    const rocblas_int ldb,
+                    const rocblas_stride strideB,
+                    U X,
+                    const rocblas_int shiftX,
+                    const rocblas_int ldx,
+                    const rocblas_stride strideX,
+                    rocblas_int* info,
+                    const rocblas_int batch_count)
+{
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    size_t lmemsize = gesv_small_lds_size<T>(n);
+    ROCSOLVER_LAUNCH_KERNEL((gesv_small_kernel<T>), dim3(batch_count, 1, 1),
+                            dim3(GESV_SMALL_SWITCHSIZE, 1, 1), lmemsize, stream, n, nrhs, A,
+                            shiftA, lda, strideA, ipiv, strideP, B, shiftB, ldb, strideB, X, shiftX,
+                            ldx, strideX, info);
+}
+
 template <bool BATCHED, bool STRIDED, typename T>
 void rocsolver_gesv_getMemorySize(const rocblas_int n,
                                   const rocblas_int nrhs,
@@ -85,8 +261,8 @@ void rocsolver_gesv_getMemorySize(const rocblas_int n,
                                   size_t* size_iinfo,
                                   bool* optim_mem)
 {
-    // if quick return, no workspace is needed
-    if(n == 0 || nrhs == 0 || batch_count == 0)
+    // if quick return or using the small-size kernel, no workspace is needed
+    if(n == 0 || nrhs == 0 || batch_count == 0 || n <= GESV_SMALL_SWITCHSIZE)
     {
         *size_scalars = 0;
         *size_work = 0;
@@ -159,6 +335,14 @@ rocblas_status rocsolver_gesv_template(rocblas_handle handle,
     if(batch_count == 0)
         return rocblas_status_success;
 
+    // small-size case: factorize and solve in a single kernel
+    if(n > 0 && nrhs > 0 && n <= GESV_SMALL_SWITCHSIZE)
+    {
+        gesv_run_small<T>(handle, n, nrhs, A, shiftA, lda, strideA, ipiv, strideP, B, shiftB, ldb,
+                          strideB, B, shiftB, ldb, strideB, info, batch_count);
+        return rocblas_status_success;
+    }
+
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
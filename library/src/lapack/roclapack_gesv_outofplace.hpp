@@ -33,6 +33,7 @@
 #pragma once
 
 #include "rocblas.hpp"
+#include "roclapack_gesv.hpp"
 #include "roclapack_getrf.hpp"
 #include "roclapack_getrs.hpp"
 #include "rocsolver/rocsolver.h"
@@ -86,8 +87,8 @@ void rocsolver_gesv_outofplace_getMemorySize(const rocblas_int n,
                                              size_t* size_iinfo,
                                              bool* optim_mem)
 {
-    // if quick return, no workspace is needed
-    if(n == 0 || nrhs == 0 || batch_count == 0)
+    // if quick return or using the small-size kernel, no workspace is needed
+    if(n == 0 || nrhs == 0 || batch_count == 0 || n <= GESV_SMALL_SWITCHSIZE)
     {
         *size_scalars = 0;
         *size_work1 = 0;
@@ -159,6 +160,14 @@ rocblas_status rocsolver_gesv_outofplace_template(rocblas_handle handle,
     if(batch_count == 0)
         return rocblas_status_success;
 
+    // small-size case: factorize and solve in a single kernel
+    if(n > 0 && nrhs > 0 && n <= GESV_SMALL_SWITCHSIZE)
+    {
+        gesv_run_small<T>(handle, n, nrhs, A, shiftA, lda, strideA, ipiv, strideP, B, shiftB, ldb,
+                          strideB, X, shiftX, ldx, strideX, info, batch_count);
+        return rocblas_status_success;
+    }
+
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
@@ -0,0 +1,198 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_getrf_rbt.hpp"
+#include "roclapack_getrs_rbt.hpp"
+#include "rocsolver/rocsolver.h"
+
+template <typename T, typename S>
+rocblas_status rocsolver_gesv_rbt_argCheck(rocblas_handle handle,
+                                           const rocblas_int n,
+                                           const rocblas_int nrhs,
+                                           const rocblas_int lda,
+                                           const rocblas_int ldb,
+                                           T A,
+                                           T B,
+                                           S* UV,
+                                           const rocblas_stride strideUV,
+                                           const rocblas_int* info,
+                                           const rocblas_int batch_count)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(n < 0 || nrhs < 0 || lda < n || ldb < n
+       || strideUV < 2 * GERBT_DEPTH * rocblas_stride(n) || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n && batch_count && !UV) || (nrhs && n && !B) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_gesv_rbt_getMemorySize(const rocblas_int n,
+                                      const rocblas_int nrhs,
+                                      const rocblas_int batch_count,
+                                      size_t* size_scalars,
+                                      size_t* size_work,
+                                      size_t* size_work1,
+                                      size_t* size_work2,
+                                      size_t* size_work3,
+                                      size_t* size_work4,
+                                      size_t* size_pivotval,
+                                      size_t* size_pivotidx,
+                                      size_t* size_iipiv,
+                                      size_t* size_iinfo,
+                                      bool* optim_mem,
+                                      const rocblas_int lda = 1,
+                                      const rocblas_int ldb = 1)
+{
+    // if quick return, no workspace is needed
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+    {
+        *size_scalars = 0;
+        *size_work = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_pivotval = 0;
+        *size_pivotidx = 0;
+        *size_iipiv = 0;
+        *size_iinfo = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    bool opt1, opt2;
+    size_t w1, w2, w3, w4;
+
+    // workspace required for calling GETRF_RBT
+    rocsolver_getrf_rbt_getMemorySize<BATCHED, STRIDED, T>(
+        n, batch_count, size_scalars, size_work1, size_work2, size_work3, size_work4,
+        size_pivotval, size_pivotidx, size_iipiv, size_iinfo, &opt1, lda);
+
+    // workspace required for calling GETRS_RBT
+    rocsolver_getrs_rbt_getMemorySize<BATCHED, STRIDED, T>(
+        rocblas_operation_none, n, nrhs, batch_count, &w1, &w2, &w3, &w4, &opt2, lda, ldb);
+
+    *size_work1 = std::max(*size_work1, w1);
+    *size_work2 = std::max(*size_work2, w2);
+    *size_work3 = std::max(*size_work3, w3);
+    *size_work4 = std::max(*size_work4, w4);
+    *optim_mem = opt1 && opt2;
+
+    // extra space to copy B
+    *size_work = sizeof(T) * n * nrhs * batch_count;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_gesv_rbt_template(rocblas_handle handle,
+                                           const rocblas_int n,
+                                           const rocblas_int nrhs,
+                                           U A,
+                                           const rocblas_int shiftA,
+                                           const rocblas_int lda,
+                                           const rocblas_stride strideA,
+                                           S* UV,
+                                           const rocblas_stride strideUV,
+                                           U B,
+                                           const rocblas_int shiftB,
+                                           const rocblas_int ldb,
+                                           const rocblas_stride strideB,
+                                           rocblas_int* info,
+                                           const rocblas_int batch_count,
+                                           T* scalars,
+                                           T* work,
+                                           void* work1,
+                                           void* work2,
+                                           void* work3,
+                                           void* work4,
+                                           T* pivotval,
+                                           rocblas_int* pivotidx,
+                                           rocblas_int* iipiv,
+                                           rocblas_int* iinfo,
+                                           bool optim_mem)
+{
+    ROCSOLVER_ENTER("gesv_rbt", "n:", n, "nrhs:", nrhs, "shiftA:", shiftA, "lda:", lda,
+                    "shiftB:", shiftB, "ldb:", ldb, "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // quick return if A or B are empty
+    if(n == 0 || nrhs == 0)
+    {
+        rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(blocksReset, 1, 1), dim3(BS1, 1, 1), 0, stream,
+                                info, batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    // constants in host memory
+    const rocblas_int copyblocksx = (n - 1) / 32 + 1;
+    const rocblas_int copyblocksy = (nrhs - 1) / 32 + 1;
+
+    // compute the LU factorization of the transformed matrices U'*A*V
+    rocsolver_getrf_rbt_template<BATCHED, STRIDED, T>(
+        handle, n, A, shiftA, lda, strideA, UV, strideUV, info, batch_count, scalars, work1, work2,
+        work3, work4, pivotval, pivotidx, iipiv, iinfo, optim_mem);
+
+    // save elements of B that will be overwritten by GETRS_RBT for cases where info is nonzero
+    ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(copyblocksx, copyblocksy, batch_count), dim3(32, 32),
+                            0, stream, copymat_to_buffer, n, nrhs, B, shiftB, ldb, strideB,
+                            (T*)work, info_mask(info));
+
+    // solve AX = B, overwriting B with X
+    rocsolver_getrs_rbt_template<BATCHED, STRIDED, T>(
+        handle, rocblas_operation_none, n, nrhs, A, shiftA, lda, strideA, (const S*)UV, strideUV,
+        B, shiftB, ldb, strideB, batch_count, work1, work2, work3, work4, optim_mem);
+
+    // restore elements of B that were overwritten by GETRS_RBT in cases where info is nonzero
+    ROCSOLVER_LAUNCH_KERNEL(copy_mat<T>, dim3(copyblocksx, copyblocksy, batch_count), dim3(32, 32),
+                            0, stream, copymat_from_buffer, n, nrhs, B, shiftB, ldb, strideB,
+                            (T*)work, info_mask(info));
+
+    return rocblas_status_success;
+}
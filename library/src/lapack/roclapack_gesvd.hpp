@@ -40,6 +40,7 @@
 #include "roclapack_gelqf.hpp"
 #include "roclapack_geqrf.hpp"
 #include "rocsolver/rocsolver.h"
+#include "rocsolver_workspace_breakdown.hpp"
 
 /** wrapper to xxGQR/xxGLQ_TEMPLATE **/
 template <bool BATCHED, bool STRIDED, typename T, typename U>
@@ -244,9 +245,15 @@ void rocsolver_gesvd_getMemorySize(const rocblas_svect left_svect,
     else
         rocsolver_gebrd_getMemorySize<BATCHED, T>(m, n, batch_count, size_scalars, &w[0], &a[0],
                                                   &x[0], &y[0]);
+    rocsolver_workspace_breakdown::record_subcall("gebrd", {{"work_workArr", w[0]},
+                                                            {"Abyx_norms_tmptr", a[0]},
+                                                            {"Abyx_norms_trfact_X", x[0]},
+                                                            {"diag_tmptr_Y", y[0]}});
 
     // workspace required for the SVD of the bidiagonal form
     rocsolver_bdsqr_getMemorySize<S>(k, nv, nu, 0, batch_count, size_tau_splits, &w[1]);
+    rocsolver_workspace_breakdown::record_subcall(
+        "bdsqr", {{"work_workArr", w[1]}, {"tau_splits", *size_tau_splits}});
 
     // size of array tau to store householder scalars on intermediate
     // orthonormal/unitary matrices
@@ -261,13 +268,22 @@ void rocsolver_gesvd_getMemorySize(const rocblas_svect left_svect,
         else
             rocsolver_gelqf_getMemorySize<BATCHED, T>(m, n, batch_count, &unused, &w[2], &x[1],
                                                       &y[1], &unused);
+        rocsolver_workspace_breakdown::record_subcall(
+            row ? "geqrf" : "gelqf",
+            {{"work_workArr", w[2]}, {"Abyx_norms_trfact_X", x[1]}, {"diag_tmptr_Y", y[1]}});
     }
 
     // extra requirements for orthonormal/unitary matrix generation
     // ormbr
     if(thinSVD && !fast_thinSVD && !leadvN)
+    {
         rocsolver_ormbr_unmbr_getMemorySize<BATCHED, T>(storev_lead, side, m, n, k, batch_count,
                                                         &unused, &a[1], &y[2], &x[2], &unused);
+        rocsolver_workspace_breakdown::record_subcall("ormbr_unmbr",
+                                                      {{"Abyx_norms_tmptr", a[1]},
+                                                       {"Abyx_norms_trfact_X", x[2]},
+                                                       {"diag_tmptr_Y", y[2]}});
+    }
     // orgbr
     if(thinSVD)
     {
@@ -297,6 +313,15 @@ void rocsolver_gesvd_getMemorySize(const rocblas_svect left_svect,
             rocsolver_orgbr_ungbr_getMemorySize<BATCHED, T>(rocblas_row_wise, k, n, m, batch_count,
                                                             &unused, &w[4], &a[3], &x[4], &unused);
     }
+    if(w[3] || a[2] || x[3])
+        rocsolver_workspace_breakdown::record_subcall(
+            "orgbr_ungbr",
+            {{"work_workArr", w[3]}, {"Abyx_norms_tmptr", a[2]}, {"Abyx_norms_trfact_X", x[3]}});
+    if(w[4] || a[3] || x[4])
+        rocsolver_workspace_breakdown::record_subcall(
+            "orgbr_ungbr",
+            {{"work_workArr", w[4]}, {"Abyx_norms_tmptr", a[3]}, {"Abyx_norms_trfact_X", x[4]}});
+
     // orgqr/orglq
     if(thinSVD && !leadvN)
     {
@@ -318,6 +343,10 @@ void rocsolver_gesvd_getMemorySize(const rocblas_svect left_svect,
                 rocsolver_orglq_unglq_getMemorySize<BATCHED, T>(m, n, k, batch_count, &unused,
                                                                 &w[5], &a[4], &x[5], &unused);
         }
+        rocsolver_workspace_breakdown::record_subcall(row ? "orgqr_ungqr" : "orglq_unglq",
+                                                      {{"work_workArr", w[5]},
+                                                       {"Abyx_norms_tmptr", a[4]},
+                                                       {"Abyx_norms_trfact_X", x[5]}});
     }
 
     // get max sizes
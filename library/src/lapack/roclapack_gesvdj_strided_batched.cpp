@@ -83,7 +83,7 @@ rocblas_status rocsolver_gesvdj_strided_batched_impl(rocblas_handle handle,
         &size_work2, &size_work3, &size_work4, &size_work5_ipiv, &size_work6_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(
             handle, size_scalars, size_VUtmp, size_work1_UVtmp, size_work2, size_work3, size_work4,
             size_work5_ipiv, size_work6_workArr);
 
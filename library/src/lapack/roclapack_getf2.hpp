@@ -36,6 +36,7 @@
 #include "lapack_device_functions.hpp"
 #include "rocblas.hpp"
 #include "rocsolver/rocsolver.h"
+#include "rocsolver_handle_state.hpp"
 #include "rocsolver_run_specialized_kernels.hpp"
 
 // number of threads for the iamax reduction kernel
@@ -202,9 +203,16 @@ inline I getf2_get_checksingularity_blksize(const I n)
 /** This function tests if one of the specialized kernels should be used.
     Returns 1 when the use of the small kernel will give better performance,
     Returns 2 when the use of the panel kernel will give better performance,
-    Returns 0 when it would be better to use the normal code. **/
+    Returns 0 when it would be better to use the normal code.
+    If the device architecture is given, the small kernel is only selected when the
+    columns fit in a wavefront (this does not change whether a specialized kernel is used,
+    and thus the workspace requirements). **/
 template <bool ISBATCHED, typename T, typename I, std::enable_if_t<!rocblas_is_complex<T>, int> = 0>
-int select_spkernel(const I m, const I n, const I inca, const bool pivot)
+int select_spkernel(const I m,
+                    const I n,
+                    const I inca,
+                    const bool pivot,
+                    const rocsolver_arch_info* arch = nullptr)
 {
     int ker = 0;
 
@@ -300,12 +308,21 @@ int select_spkernel(const I m, const I n, const I inca, const bool pivot)
         ker = 2;
     }
 
+    if(ker == 1 && arch && n > arch->wavefront_size)
+    {
+        ker = 2;
+    }
+
     return ker;
 }
 
 /** Complex type version **/
 template <bool ISBATCHED, typename T, typename I, std::enable_if_t<rocblas_is_complex<T>, int> = 0>
-int select_spkernel(const I m, const I n, const I inca, const bool pivot)
+int select_spkernel(const I m,
+                    const I n,
+                    const I inca,
+                    const bool pivot,
+                    const rocsolver_arch_info* arch = nullptr)
 {
     int ker = 0;
 
@@ -404,6 +421,11 @@ int select_spkernel(const I m, const I n, const I inca, const bool pivot)
         ker = 2;
     }
 
+    if(ker == 1 && arch && n > arch->wavefront_size)
+    {
+        ker = 2;
+    }
+
     return ker;
 }
 
@@ -600,7 +622,8 @@ rocblas_status rocsolver_getf2_template(rocblas_handle handle,
     }
 
 #ifdef OPTIMAL
-    int spker = select_spkernel<ISBATCHED, T>(m, n, inca, pivot);
+    const rocsolver_arch_info arch = rocsolver_handle_state_map::get_arch(handle);
+    int spker = select_spkernel<ISBATCHED, T>(m, n, inca, pivot, &arch);
     if(!std::is_same<I, int64_t>::value && spker > 0)
     {
         // Use specialized kernels for small matrices
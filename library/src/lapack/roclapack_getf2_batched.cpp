@@ -72,7 +72,7 @@ rocblas_status rocsolver_getf2_batched_impl(rocblas_handle handle,
                                            &size_pivotidx);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_pivotval,
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_scalars, size_pivotval,
                                                       size_pivotidx);
 
     // memory workspace allocation
@@ -76,7 +76,7 @@ rocblas_status rocsolver_getrf_impl(rocblas_handle handle,
         &size_pivotval, &size_pivotidx, &size_iipiv, &size_iinfo, &optim_mem, lda);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work1, size_work2,
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_scalars, size_work1, size_work2,
                                                       size_work3, size_work4, size_pivotval,
                                                       size_pivotidx, size_iipiv, size_iinfo);
 
@@ -100,11 +100,15 @@ rocblas_status rocsolver_getrf_impl(rocblas_handle handle,
     if(size_scalars > 0)
         init_scalars(handle, (T*)scalars);
 
+    // use the algorithm selected for the handle
+    const rocsolver_alg_mode mode
+        = rocsolver_handle_state_map::alg_mode(handle, rocsolver_function_getrf);
+
     // execution
     return rocsolver_getrf_template<false, false, T>(
         handle, m, n, A, shiftA, inca, lda, strideA, ipiv, shiftP, strideP, info, batch_count,
         (T*)scalars, work1, work2, work3, work4, (T*)pivotval, (I*)pivotidx, (I*)iipiv, (I*)iinfo,
-        optim_mem, pivot);
+        optim_mem, pivot, mode);
 }
 
 /*
@@ -32,9 +32,11 @@
 
 #pragma once
 
+#include "auxiliary/rocauxiliary_laswp.hpp"
 #include "rocblas.hpp"
 #include "roclapack_getf2.hpp"
 #include "rocsolver/rocsolver.h"
+#include "rocsolver_handle_state.hpp"
 #include "rocsolver_run_specialized_kernels.hpp"
 
 /** Constants for inner block size of getrf **/
@@ -440,8 +442,118 @@ I getrf_get_innerBlkSize(I m, I n, const bool pivot)
     return blk;
 }
 
+/** This is the recursive implementation of the factorization of the
+    panel blocks in getrf. The nn columns of the sub-panel starting at column k
+    are split in halves until there are no more than GETRF_RECURSIVE_PANEL_MINSIZE
+    columns left; these are factorized with GETF2. The updates of the right halves
+    are done with TRSM and GEMM. **/
+template <bool BATCHED, bool STRIDED, typename T, typename I, typename INFO, typename U>
+rocblas_status getrf_panelLU_recursive(rocblas_handle handle,
+                                       const I mm,
+                                       const I k,
+                                       const I nn,
+                                       const I n,
+                                       U A,
+                                       const rocblas_stride r_shiftA,
+                                       const I inca,
+                                       const I lda,
+                                       const rocblas_stride strideA,
+                                       I* ipiv,
+                                       const rocblas_stride shiftP,
+                                       const rocblas_stride strideP,
+                                       INFO* info,
+                                       const I batch_count,
+                                       const bool pivot,
+                                       T* scalars,
+                                       void* work1,
+                                       void* work2,
+                                       void* work3,
+                                       void* work4,
+                                       const bool optim_mem,
+                                       T* pivotval,
+                                       I* pivotidx,
+                                       const I offset,
+                                       I* permut_idx,
+                                       const rocblas_stride stridePI,
+                                       const I pn,
+                                       const I poffset,
+                                       const rocblas_stride pshiftA)
+{
+    static constexpr bool ISBATCHED = BATCHED || STRIDED;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // constants to use when calling rocablas functions
+    T one = 1; // constant 1 in host
+    T minone = -1; // constant -1 in host
+
+    // r_shiftA is the row where the panel-block starts,
+    // the actual position of the panel-block in the matrix is:
+    rocblas_stride shiftA = r_shiftA + idx2D(0, offset, inca, lda);
+
+    if(nn <= GETRF_RECURSIVE_PANEL_MINSIZE)
+    {
+        // base case: factorize the sub-panel with the unblocked algorithm
+        rocsolver_getf2_template<ISBATCHED, T>(handle, mm - k, nn, A, shiftA + idx2D(k, k, inca, lda),
+                                               inca, lda, strideA, ipiv, shiftP + k, strideP, info,
+                                               batch_count, scalars, pivotval, pivotidx, pivot,
+                                               offset + k, permut_idx, stridePI);
+        if(pivot)
+        {
+            I dimx = nn;
+            I dimy = I(1024) / dimx;
+            I blocks = (pn - nn - 1) / dimy + 1;
+            dim3 grid(1, blocks, batch_count);
+            dim3 threads(dimx, dimy, 1);
+            size_t lmemsize = dimx * dimy * sizeof(T);
+
+            // swap rows
+            ROCSOLVER_LAUNCH_KERNEL(getrf_row_permutate<T>, grid, threads, lmemsize, stream, pn,
+                                    poffset + k, nn, A, pshiftA + k * inca, inca, lda, strideA,
+                                    permut_idx, stridePI);
+        }
+
+        return rocblas_status_success;
+    }
+
+    I n1 = nn / 2;
+    I n2 = nn - n1;
+
+    // factorize left half
+    getrf_panelLU_recursive<BATCHED, STRIDED, T>(
+        handle, mm, k, n1, n, A, r_shiftA, inca, lda, strideA, ipiv, shiftP, strideP, info,
+        batch_count, pivot, scalars, work1, work2, work3, work4, optim_mem, pivotval, pivotidx,
+        offset, permut_idx, stridePI, pn, poffset, pshiftA);
+
+    // update right half
+    rocsolver_trsm_lower<BATCHED, STRIDED, T>(
+        handle, rocblas_side_left, rocblas_operation_none, rocblas_diagonal_unit, n1, n2, A,
+        shiftA + idx2D(k, k, inca, lda), inca, lda, strideA, A, shiftA + idx2D(k, k + n1, inca, lda),
+        inca, lda, strideA, batch_count, optim_mem, work1, work2, work3, work4);
+
+    if(k + n1 < mm)
+        rocsolver_gemm<BATCHED, STRIDED, T>(
+            handle, rocblas_operation_none, rocblas_operation_none, mm - k - n1, n2, n1, &minone, A,
+            shiftA + idx2D(k + n1, k, inca, lda), inca, lda, strideA, A,
+            shiftA + idx2D(k, k + n1, inca, lda), inca, lda, strideA, &one, A,
+            shiftA + idx2D(k + n1, k + n1, inca, lda), inca, lda, strideA, batch_count,
+            (T**)nullptr);
+
+    // factorize right half
+    getrf_panelLU_recursive<BATCHED, STRIDED, T>(
+        handle, mm, k + n1, n2, n, A, r_shiftA, inca, lda, strideA, ipiv, shiftP, strideP, info,
+        batch_count, pivot, scalars, work1, work2, work3, work4, optim_mem, pivotval, pivotidx,
+        offset, permut_idx, stridePI, pn, poffset, pshiftA);
+
+    return rocblas_status_success;
+}
+
 /** This is the implementation of the factorization of the
-    panel blocks in getrf **/
+    panel blocks in getrf. If swap_panel_only is true, the row interchanges
+    are only applied to the columns of the panel; the caller is then responsible
+    for applying them to the rest of the matrix. If recursive is true, the panel
+    is factorized with getrf_panelLU_recursive. **/
 template <bool BATCHED, bool STRIDED, typename T, typename I, typename INFO, typename U>
 rocblas_status getrf_panelLU(rocblas_handle handle,
                              const I mm,
@@ -468,7 +580,9 @@ rocblas_status getrf_panelLU(rocblas_handle handle,
                              I* pivotidx,
                              const I offset,
                              I* permut_idx,
-                             const rocblas_stride stridePI)
+                             const rocblas_stride stridePI,
+                             const bool swap_panel_only = false,
+                             const bool recursive = false)
 {
     static constexpr bool ISBATCHED = BATCHED || STRIDED;
 
@@ -483,6 +597,19 @@ rocblas_status getrf_panelLU(rocblas_handle handle,
     // the actual position of the panel-block in the matrix is:
     rocblas_stride shiftA = r_shiftA + idx2D(0, offset, inca, lda);
 
+    // columns where the row interchanges are applied (pn columns starting at pshiftA,
+    // with the panel-block located at column poffset)
+    I pn = swap_panel_only ? nn : n;
+    I poffset = swap_panel_only ? 0 : offset;
+    rocblas_stride pshiftA = swap_panel_only ? shiftA : r_shiftA;
+
+    // use the recursive algorithm if enabled
+    if((GETRF_RECURSIVE_PANEL || recursive) && nn > GETRF_RECURSIVE_PANEL_MINSIZE)
+        return getrf_panelLU_recursive<BATCHED, STRIDED, T>(
+            handle, mm, I(0), nn, n, A, r_shiftA, inca, lda, strideA, ipiv, shiftP, strideP, info,
+            batch_count, pivot, scalars, work1, work2, work3, work4, optim_mem, pivotval, pivotidx,
+            offset, permut_idx, stridePI, pn, poffset, pshiftA);
+
     I blk = getrf_get_innerBlkSize<ISBATCHED, T>(mm, nn, pivot);
     I jb;
     I dimx, dimy, blocks, blocksy;
@@ -503,14 +630,14 @@ rocblas_status getrf_panelLU(rocblas_handle handle,
         {
             dimx = jb;
             dimy = I(1024) / dimx;
-            blocks = (n - jb - 1) / dimy + 1;
+            blocks = (pn - jb - 1) / dimy + 1;
             grid = dim3(1, blocks, batch_count);
             threads = dim3(dimx, dimy, 1);
             lmemsize = dimx * dimy * sizeof(T);
 
             // swap rows
-            ROCSOLVER_LAUNCH_KERNEL(getrf_row_permutate<T>, grid, threads, lmemsize, stream, n,
-                                    offset + k, jb, A, r_shiftA + k * inca, inca, lda, strideA,
+            ROCSOLVER_LAUNCH_KERNEL(getrf_row_permutate<T>, grid, threads, lmemsize, stream, pn,
+                                    poffset + k, jb, A, pshiftA + k * inca, inca, lda, strideA,
                                     permut_idx, stridePI);
         }
 
@@ -553,7 +680,8 @@ void rocsolver_getrf_getMemorySize(const I m,
                                    size_t* size_iinfo,
                                    bool* optim_mem,
                                    const I lda = 1,
-                                   const I inca = 1)
+                                   const I inca = 1,
+                                   const bool lowmem = false)
 {
     static constexpr bool ISBATCHED = BATCHED || STRIDED;
 
@@ -606,13 +734,14 @@ void rocsolver_getrf_getMemorySize(const I m,
         // extra workspace for calling largest possible TRSM
         rocsolver_trsm_mem<BATCHED, STRIDED, T>(rocblas_side_left, rocblas_operation_none, dim, n,
                                                 batch_count, size_work1, size_work2, size_work3,
-                                                size_work4, optim_mem, true, lda, lda, inca, inca);
+                                                size_work4, optim_mem, true, lda, lda, inca, inca,
+                                                lowmem);
         if(!pivot)
         {
             size_t w1, w2, w3, w4;
             rocsolver_trsm_mem<BATCHED, STRIDED, T>(rocblas_side_right, rocblas_operation_none, m,
                                                     dim, batch_count, &w1, &w2, &w3, &w4, optim_mem,
-                                                    true, lda, lda, inca, inca);
+                                                    true, lda, lda, inca, inca, lowmem);
             *size_work1 = std::max(*size_work1, w1);
             *size_work2 = std::max(*size_work2, w2);
             *size_work3 = std::max(*size_work3, w3);
@@ -621,6 +750,121 @@ void rocsolver_getrf_getMemorySize(const I m,
     }
 }
 
+/** This is the look-ahead implementation of the main loop of getrf. The columns
+    of the next panel are updated first; then the panel is factorized on the
+    secondary stream while the rest of the trailing matrix is updated on the main stream.
+    The row interchanges of each panel are applied to the columns outside the panel
+    once all the updates that read them have been enqueued. **/
+template <bool BATCHED, bool STRIDED, typename T, typename I, typename INFO, typename U>
+rocblas_status getrf_lookahead(rocblas_handle handle,
+                               rocsolver_lookahead& la,
+                               const I m,
+                               const I n,
+                               U A,
+                               const rocblas_stride shiftA,
+                               const I inca,
+                               const I lda,
+                               const rocblas_stride strideA,
+                               I* ipiv,
+                               const rocblas_stride shiftP,
+                               const rocblas_stride strideP,
+                               INFO* info,
+                               const I batch_count,
+                               T* scalars,
+                               void* work1,
+                               void* work2,
+                               void* work3,
+                               void* work4,
+                               T* pivotval,
+                               I* pivotidx,
+                               I* iipiv,
+                               const bool optim_mem,
+                               const bool pivot,
+                               const I blk,
+                               const bool recursive)
+{
+    I dim = std::min(m, n);
+    T one = 1;
+    T minone = -1;
+    I jb, jbn, nextpiv, mm, nn;
+
+    // factorize first block panel
+    getrf_panelLU<BATCHED, STRIDED, T>(handle, m, std::min(dim, blk), n, A, shiftA, inca, lda,
+                                       strideA, ipiv, shiftP, strideP, info, batch_count, pivot,
+                                       scalars, work1, work2, work3, work4, optim_mem, pivotval,
+                                       pivotidx, I(0), iipiv, m, true, recursive);
+
+    for(I j = 0; j < dim; j += blk)
+    {
+        jb = std::min(dim - j, blk);
+        nextpiv = j + jb; //position for the matrix update
+        mm = m - nextpiv; //size for the matrix update
+        nn = n - nextpiv; //size for the matrix update
+
+        // apply row interchanges of the current panel to the left and right columns
+        if(pivot)
+        {
+            rocsolver_laswp_template<T>(handle, j, A, shiftA, inca, lda, strideA, j + 1, nextpiv,
+                                        ipiv, shiftP, I(1), strideP, batch_count);
+            rocsolver_laswp_template<T>(handle, nn, A, shiftA + idx2D(0, nextpiv, inca, lda), inca,
+                                        lda, strideA, j + 1, nextpiv, ipiv, shiftP, I(1), strideP,
+                                        batch_count);
+        }
+
+        if(nextpiv < n)
+        {
+            // update block row (this uses the workspace, so it cannot overlap with the panel)
+            rocsolver_trsm_lower<BATCHED, STRIDED, T>(
+                handle, rocblas_side_left, rocblas_operation_none, rocblas_diagonal_unit, jb, nn, A,
+                shiftA + idx2D(j, j, inca, lda), inca, lda, strideA, A,
+                shiftA + idx2D(j, nextpiv, inca, lda), inca, lda, strideA, batch_count, optim_mem,
+                work1, work2, work3, work4);
+
+            if(nextpiv < m)
+            {
+                // update the columns of the next panel
+                jbn = std::min(dim - nextpiv, blk);
+                rocsolver_gemm<BATCHED, STRIDED, T>(
+                    handle, rocblas_operation_none, rocblas_operation_none, mm, jbn, jb, &minone, A,
+                    shiftA + idx2D(nextpiv, j, inca, lda), inca, lda, strideA, A,
+                    shiftA + idx2D(j, nextpiv, inca, lda), inca, lda, strideA, &one, A,
+                    shiftA + idx2D(nextpiv, nextpiv, inca, lda), inca, lda, strideA, batch_count,
+                    (T**)nullptr);
+
+                if(nn > jbn)
+                    ROCBLAS_CHECK(la.fork());
+
+                // factorize next panel (on the secondary stream if there is
+                // remaining work to overlap with)
+                {
+                    rocsolver_stream_guard guard(handle,
+                                                 nn > jbn ? la.side_stream : la.main_stream);
+                    getrf_panelLU<BATCHED, STRIDED, T>(
+                        handle, mm, jbn, n, A, shiftA + nextpiv * inca, inca, lda, strideA, ipiv,
+                        shiftP + nextpiv, strideP, info, batch_count, pivot, scalars, work1, work2,
+                        work3, work4, optim_mem, pivotval, pivotidx, nextpiv, iipiv, m, true,
+                        recursive);
+                }
+
+                if(nn > jbn)
+                {
+                    // update rest of the trailing matrix
+                    rocsolver_gemm<BATCHED, STRIDED, T>(
+                        handle, rocblas_operation_none, rocblas_operation_none, mm, nn - jbn, jb,
+                        &minone, A, shiftA + idx2D(nextpiv, j, inca, lda), inca, lda, strideA, A,
+                        shiftA + idx2D(j, nextpiv + jbn, inca, lda), inca, lda, strideA, &one, A,
+                        shiftA + idx2D(nextpiv, nextpiv + jbn, inca, lda), inca, lda, strideA,
+                        batch_count, (T**)nullptr);
+
+                    ROCBLAS_CHECK(la.join());
+                }
+            }
+        }
+    }
+
+    return rocblas_status_success;
+}
+
 template <bool BATCHED, bool STRIDED, typename T, typename I, typename INFO, typename U>
 rocblas_status rocsolver_getrf_template(rocblas_handle handle,
                                         const I m,
@@ -645,7 +889,8 @@ rocblas_status rocsolver_getrf_template(rocblas_handle handle,
                                         I* iipiv,
                                         INFO* iinfo,
                                         const bool optim_mem,
-                                        const bool pivot)
+                                        const bool pivot,
+                                        const rocsolver_alg_mode mode = rocsolver_alg_mode_default)
 {
     ROCSOLVER_ENTER("getrf", "m:", m, "n:", n, "shiftA:", shiftA, "inca:", inca, "lda:", lda,
                     "shiftP:", shiftP, "bc:", batch_count);
@@ -691,6 +936,9 @@ rocblas_status rocsolver_getrf_template(rocblas_handle handle,
     size_t lmemsize;
     I j = 0;
 
+    // use the recursive panel factorization if selected for the handle
+    const bool recursive = (mode == rocsolver_alg_mode_recursive);
+
     // in the npvt cases, panel determines whether the whole block-panel or only the
     // diagonal block is factorized
     bool panel = false;
@@ -700,6 +948,27 @@ rocblas_status rocsolver_getrf_template(rocblas_handle handle,
         blk = -blk;
     }
 
+    // use look-ahead if enabled for the handle and there is more than one block panel
+    if((pivot || panel) && dim > blk)
+    {
+        rocsolver_lookahead la(handle);
+        if(la.enabled)
+        {
+            rocblas_status status = getrf_lookahead<BATCHED, STRIDED, T>(
+                handle, la, m, n, A, shiftA, inca, lda, strideA, ipiv, shiftP, strideP, info,
+                batch_count, scalars, work1, work2, work3, work4, pivotval, pivotidx, iipiv,
+                optim_mem, pivot, blk, recursive);
+
+            rocblas_set_pointer_mode(handle, old_mode);
+            return status;
+        }
+    }
+
+    // for moderate sizes and large batches, apply each panel to the trailing matrix with
+    // the fused panel-apply kernel
+    const bool use_panel_apply
+        = ISBATCHED && inca == 1 && rocsolver_use_panel_apply<T>(handle, dim, blk, batch_count);
+
     // MAIN LOOP
     for(I j = 0; j < dim; j += blk)
     {
@@ -711,7 +980,8 @@ rocblas_status rocsolver_getrf_template(rocblas_handle handle,
             getrf_panelLU<BATCHED, STRIDED, T>(handle, m - j, jb, n, A, shiftA + j * inca, inca,
                                                lda, strideA, ipiv, shiftP + j, strideP, info,
                                                batch_count, pivot, scalars, work1, work2, work3,
-                                               work4, optim_mem, pivotval, pivotidx, j, iipiv, m);
+                                               work4, optim_mem, pivotval, pivotidx, j, iipiv, m,
+                                               false, recursive);
         }
         else
         {
@@ -719,7 +989,8 @@ rocblas_status rocsolver_getrf_template(rocblas_handle handle,
             getrf_panelLU<BATCHED, STRIDED, T>(handle, jb, jb, n, A, shiftA + j * inca, inca, lda,
                                                strideA, ipiv, shiftP + j, strideP, info,
                                                batch_count, pivot, scalars, work1, work2, work3,
-                                               work4, optim_mem, pivotval, pivotidx, j, iipiv, m);
+                                               work4, optim_mem, pivotval, pivotidx, j, iipiv, m,
+                                               false, recursive);
 
             // update remaining rows in outer panel
             rocsolver_trsm_upper<BATCHED, STRIDED, T>(
@@ -733,7 +1004,13 @@ rocblas_status rocsolver_getrf_template(rocblas_handle handle,
         nextpiv = j + jb; //position for the matrix update
         mm = m - nextpiv; //size for the matrix update
         nn = n - nextpiv; //size for the matrix update
-        if(nextpiv < n)
+        if(nextpiv < n && use_panel_apply)
+        {
+            rocsolver_getrf_panel_apply<BATCHED, STRIDED, T>(handle, mm, nn, jb, A,
+                                                             shiftA + idx2D(j, j, lda), lda,
+                                                             strideA, batch_count);
+        }
+        else if(nextpiv < n)
         {
             rocsolver_trsm_lower<BATCHED, STRIDED, T>(
                 handle, rocblas_side_left, rocblas_operation_none, rocblas_diagonal_unit, jb, nn, A,
@@ -26,6 +26,7 @@
  * *************************************************************************/
 
 #include "roclapack_getrf.hpp"
+#include "rocsolver_info_summary.hpp"
 
 template <typename T, typename I, typename U>
 rocblas_status rocsolver_getrf_batched_impl(rocblas_handle handle,
@@ -54,6 +55,11 @@ rocblas_status rocsolver_getrf_batched_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    // the aggregated info values must fit in the summary array
+    st = rocsolver_info_summary_argCheck(handle, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
     // working with unshifted arrays
     rocblas_stride shiftA = 0;
     rocblas_stride shiftP = 0;
@@ -78,10 +84,34 @@ rocblas_status rocsolver_getrf_batched_impl(rocblas_handle handle,
         &size_pivotval, &size_pivotidx, &size_iipiv, &size_iinfo, &optim_mem, lda);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work1, size_work2,
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_scalars, size_work1, size_work2,
                                                       size_work3, size_work4, size_pivotval,
                                                       size_pivotidx, size_iipiv, size_iinfo);
 
+    // budgeted execution: if the workspace exceeds the budget set for the handle, the internal
+    // TRSM calls use their low-memory algorithm and, if still needed, the batch is split in chunks
+    I chunk = batch_count;
+    size_t budget = rocsolver_handle_state_map::workspace_budget(handle);
+    if(budget > 0
+       && rocsolver_workspace_size({size_scalars, size_work1, size_work2, size_work3, size_work4,
+                                    size_pivotval, size_pivotidx, size_iipiv, size_iinfo})
+           > budget)
+    {
+        auto lowmem_size = [&](I bc) {
+            rocsolver_getrf_getMemorySize<true, false, T>(
+                m, n, pivot, bc, &size_scalars, &size_work1, &size_work2, &size_work3, &size_work4,
+                &size_pivotval, &size_pivotidx, &size_iipiv, &size_iinfo, &optim_mem, lda, inca,
+                true);
+            return rocsolver_workspace_size({size_scalars, size_work1, size_work2, size_work3,
+                                             size_work4, size_pivotval, size_pivotidx, size_iipiv,
+                                             size_iinfo});
+        };
+        chunk = rocsolver_plan_batch_chunk(budget, batch_count, lowmem_size);
+        if(chunk == 0)
+            return rocblas_status_memory_error;
+        lowmem_size(chunk);
+    }
+
     // memory workspace allocation
     void *scalars, *work1, *work2, *work3, *work4, *pivotval, *pivotidx, *iinfo, *iipiv;
     rocblas_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3, size_work4,
@@ -102,11 +132,24 @@ rocblas_status rocsolver_getrf_batched_impl(rocblas_handle handle,
     if(size_scalars > 0)
         init_scalars(handle, (T*)scalars);
 
+    // use the algorithm selected for the handle
+    const rocsolver_alg_mode mode
+        = rocsolver_handle_state_map::alg_mode(handle, rocsolver_function_getrf);
+
     // execution
-    return rocsolver_getrf_template<true, false, T>(
-        handle, m, n, A, shiftA, inca, lda, strideA, ipiv, shiftP, strideP, info, batch_count,
-        (T*)scalars, work1, work2, work3, work4, (T*)pivotval, (I*)pivotidx, (I*)iipiv, (I*)iinfo,
-        optim_mem, pivot);
+    for(I b = 0; b < batch_count; b += chunk)
+    {
+        st = rocsolver_getrf_template<true, false, T>(
+            handle, m, n, A + b, shiftA, inca, lda, strideA, ipiv + b * strideP, shiftP, strideP,
+            info + b, std::min(chunk, batch_count - b), (T*)scalars, work1, work2, work3, work4,
+            (T*)pivotval, (I*)pivotidx, (I*)iipiv, (I*)iinfo, optim_mem, pivot,
+            mode);
+        if(st != rocblas_status_success)
+            return st;
+    }
+
+    // aggregate the info values of the batch
+    return rocsolver_info_summary(handle, info, batch_count);
 }
 
 /*
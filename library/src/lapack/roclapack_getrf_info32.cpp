@@ -84,7 +84,7 @@ rocblas_status rocsolver_getrf_info32_impl(rocblas_handle handle,
         &size_pivotval, &size_pivotidx, &size_iipiv, &size_iinfo, &optim_mem, lda);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work1, size_work2,
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_scalars, size_work1, size_work2,
                                                       size_work3, size_work4, size_pivotval,
                                                       size_pivotidx, size_iipiv, size_iinfo);
 
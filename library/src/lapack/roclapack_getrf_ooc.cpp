@@ -0,0 +1,157 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_ooc.hpp"
+
+template <typename T>
+rocblas_status rocsolver_getrf_ooc_impl(rocblas_handle handle,
+                                        const rocblas_int m,
+                                        const rocblas_int n,
+                                        T* A,
+                                        const rocblas_int lda,
+                                        rocblas_int* ipiv,
+                                        rocblas_int* info)
+{
+    ROCSOLVER_ENTER_TOP("getrf_ooc", "-m", m, "-n", n, "--lda", lda);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_getf2_getrf_argCheck(handle, m, n, lda, A, ipiv, info, true);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // memory workspace sizes:
+    // size of the resident panel and of the window for the previous panels
+    size_t size_P, size_W;
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of reusable workspace (and for calling TRSM)
+    bool optim_mem;
+    size_t size_work1, size_work2, size_work3, size_work4;
+    // extra requirements for calling GETF2
+    size_t size_pivotval, size_pivotidx;
+    // size to store info about singularity of each subblock and panel
+    size_t size_iinfo, size_iipiv, size_pinfo;
+
+    rocsolver_getrf_ooc_getMemorySize<T>(m, n, &size_P, &size_W, &size_scalars, &size_work1,
+                                         &size_work2, &size_work3, &size_work4, &size_pivotval,
+                                         &size_pivotidx, &size_iipiv, &size_iinfo, &size_pinfo,
+                                         &optim_mem);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_P, size_W, size_scalars,
+                                                      size_work1, size_work2, size_work3,
+                                                      size_work4, size_pivotval, size_pivotidx,
+                                                      size_iipiv, size_iinfo, size_pinfo);
+
+    // memory workspace allocation
+    void *P, *W, *scalars, *work1, *work2, *work3, *work4, *pivotval, *pivotidx, *iipiv, *iinfo,
+        *pinfo;
+    rocblas_device_malloc mem(handle, size_P, size_W, size_scalars, size_work1, size_work2,
+                              size_work3, size_work4, size_pivotval, size_pivotidx, size_iipiv,
+                              size_iinfo, size_pinfo);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    P = mem[0];
+    W = mem[1];
+    scalars = mem[2];
+    work1 = mem[3];
+    work2 = mem[4];
+    work3 = mem[5];
+    work4 = mem[6];
+    pivotval = mem[7];
+    pivotidx = mem[8];
+    iipiv = mem[9];
+    iinfo = mem[10];
+    pinfo = mem[11];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    // execution
+    return rocsolver_getrf_ooc_template<T>(handle, m, n, A, lda, ipiv, info, (T*)P, (T*)W,
+                                           (T*)scalars, work1, work2, work3, work4, (T*)pivotval,
+                                           (rocblas_int*)pivotidx, (rocblas_int*)iipiv,
+                                           (rocblas_int*)iinfo, (rocblas_int*)pinfo, optim_mem);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgetrf_ooc(rocblas_handle handle,
+                                    const rocblas_int m,
+                                    const rocblas_int n,
+                                    float* A,
+                                    const rocblas_int lda,
+                                    rocblas_int* ipiv,
+                                    rocblas_int* info)
+{
+    return rocsolver_getrf_ooc_impl<float>(handle, m, n, A, lda, ipiv, info);
+}
+
+rocblas_status rocsolver_dgetrf_ooc(rocblas_handle handle,
+                                    const rocblas_int m,
+                                    const rocblas_int n,
+                                    double* A,
+                                    const rocblas_int lda,
+                                    rocblas_int* ipiv,
+                                    rocblas_int* info)
+{
+    return rocsolver_getrf_ooc_impl<double>(handle, m, n, A, lda, ipiv, info);
+}
+
+rocblas_status rocsolver_cgetrf_ooc(rocblas_handle handle,
+                                    const rocblas_int m,
+                                    const rocblas_int n,
+                                    rocblas_float_complex* A,
+                                    const rocblas_int lda,
+                                    rocblas_int* ipiv,
+                                    rocblas_int* info)
+{
+    return rocsolver_getrf_ooc_impl<rocblas_float_complex>(handle, m, n, A, lda, ipiv, info);
+}
+
+rocblas_status rocsolver_zgetrf_ooc(rocblas_handle handle,
+                                    const rocblas_int m,
+                                    const rocblas_int n,
+                                    rocblas_double_complex* A,
+                                    const rocblas_int lda,
+                                    rocblas_int* ipiv,
+                                    rocblas_int* info)
+{
+    return rocsolver_getrf_ooc_impl<rocblas_double_complex>(handle, m, n, A, lda, ipiv, info);
+}
+
+} // extern C
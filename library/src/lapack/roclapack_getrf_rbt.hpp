@@ -0,0 +1,272 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_getrf.hpp"
+#include "rocsolver/rocsolver.h"
+
+/** Number of levels of the recursive butterfly transforms. Each instance in the batch uses
+    2*GERBT_DEPTH*n random values: the GERBT_DEPTH levels of U followed by the GERBT_DEPTH
+    levels of V (n values per level). **/
+#define GERBT_DEPTH 2
+
+/*************************************************************
+    Butterfly kernels
+*************************************************************/
+
+/** GERBT_GENERATE fills UV with the random diagonals of the butterfly matrices.
+    The values are exp((u - 1/2)/10) with u uniformly distributed in [0,1) (as in PLASMA and
+    MAGMA). They are obtained by hashing the position in the array, so that the
+    transforms are reproducible and do not depend on the launch configuration. **/
+template <typename S>
+ROCSOLVER_KERNEL void gerbt_generate(const rocblas_int n, S* UV, const rocblas_stride strideUV)
+{
+    const rocblas_int bid = hipBlockIdx_y;
+    const rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const rocblas_int len = 2 * GERBT_DEPTH * n;
+
+    if(i < len)
+    {
+        // splitmix64 hash of the global position
+        uint64_t z = uint64_t(bid) * len + i + 1;
+        z += 0x9e3779b97f4a7c15ULL;
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        z = z ^ (z >> 31);
+
+        const double u = double(z >> 11) * 0x1.0p-53;
+        UV[bid * strideUV + i] = S(exp((u - 0.5) / 10.0));
+    }
+}
+
+/** GERBT_APPLY applies one level of a recursive butterfly transform to nvec vectors of
+    length n stored in X. At the given level, the vectors are split in 2^level blocks and
+    each block is multiplied by the butterfly
+
+        B = 1/sqrt(2) [R0  R1]
+                      [R0 -R1]
+
+    where R0 and R1 are the diagonal matrices of random values in R corresponding to the block.
+    (If the block size is odd, its last element is left unchanged.)
+    If TRANS, the vectors are multiplied by B' instead of B.
+    If ROWS, the vectors are the rows of X, otherwise they are the columns.
+    The blocks are 32x32 threads; every thread takes care of one element of the upper half of
+    a block together with its partner in the lower half. **/
+template <bool TRANS, bool ROWS, typename T, typename S, typename U>
+ROCSOLVER_KERNEL void gerbt_apply(const rocblas_int n,
+                                  const rocblas_int nvec,
+                                  const rocblas_int level,
+                                  U X,
+                                  const rocblas_int shiftX,
+                                  const rocblas_int ldx,
+                                  const rocblas_stride strideX,
+                                  const S* R,
+                                  const rocblas_stride strideR)
+{
+    const rocblas_int bid = hipBlockIdx_z;
+    const rocblas_int p = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    const rocblas_int q = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+
+    // consecutive threads access consecutive elements in memory
+    const rocblas_int i = ROWS ? q : p;
+    const rocblas_int j = ROWS ? p : q;
+
+    if(i < n && j < nvec)
+    {
+        // locate the butterfly block that contains element i
+        const int64_t nb = int64_t(1) << level;
+        const rocblas_int b = ((i + 1) * nb - 1) / n;
+        const rocblas_int start = (b * n) >> level;
+        const rocblas_int h = (((b + 1) * n >> level) - start) / 2;
+
+        if(i - start < h)
+        {
+            T* x = load_ptr_batch<T>(X, bid, shiftX, strideX);
+            const S* r = R + bid * strideR;
+
+            const rocblas_int i2 = i + h;
+            const rocblas_int incx = ROWS ? ldx : 1;
+            const rocblas_int ldv = ROWS ? 1 : ldx;
+            T* x1 = x + i * incx + j * ldv;
+            T* x2 = x + i2 * incx + j * ldv;
+
+            const S s = S(1) / sqrt(S(2));
+            const T a = *x1;
+            const T c = *x2;
+            if(TRANS)
+            {
+                *x1 = (a + c) * (r[i] * s);
+                *x2 = (a - c) * (r[i2] * s);
+            }
+            else
+            {
+                *x1 = (a * r[i] + c * r[i2]) * s;
+                *x2 = (a * r[i] - c * r[i2]) * s;
+            }
+        }
+    }
+}
+
+/** Applies the complete recursive butterfly W = W_(depth-1)*...*W_1*W_0 defined by the random
+    values in R (n values per level) to the nvec columns (or rows if ROWS) of X.
+    If TRANS, X is overwritten by W'X (or X*W if ROWS), otherwise by WX. **/
+template <bool TRANS, bool ROWS, typename T, typename S, typename U>
+void rocsolver_gerbt_apply(rocblas_handle handle,
+                           const rocblas_int n,
+                           const rocblas_int nvec,
+                           U X,
+                           const rocblas_int shiftX,
+                           const rocblas_int ldx,
+                           const rocblas_stride strideX,
+                           const S* R,
+                           const rocblas_stride strideR,
+                           const rocblas_int batch_count)
+{
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    const rocblas_int blocks_elem = (n - 1) / BS2 + 1;
+    const rocblas_int blocks_vec = (nvec - 1) / BS2 + 1;
+    dim3 grid(ROWS ? blocks_vec : blocks_elem, ROWS ? blocks_elem : blocks_vec, batch_count);
+    dim3 threads(BS2, BS2, 1);
+
+    // W' = W_0'*W_1'*...*W_(depth-1)' is applied starting with the finest level
+    for(rocblas_int k = 0; k < GERBT_DEPTH; ++k)
+    {
+        const rocblas_int level = TRANS ? GERBT_DEPTH - 1 - k : k;
+        ROCSOLVER_LAUNCH_KERNEL((gerbt_apply<TRANS, ROWS, T>), grid, threads, 0, stream, n, nvec,
+                                level, X, shiftX, ldx, strideX, R + level * n, strideR);
+    }
+}
+
+/*************************************************************
+    GETRF_RBT
+*************************************************************/
+
+template <typename T, typename S>
+rocblas_status rocsolver_getrf_rbt_argCheck(rocblas_handle handle,
+                                            const rocblas_int n,
+                                            const rocblas_int lda,
+                                            T A,
+                                            S* UV,
+                                            const rocblas_stride strideUV,
+                                            rocblas_int* info,
+                                            const rocblas_int batch_count)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(n < 0 || lda < n || strideUV < 2 * GERBT_DEPTH * rocblas_stride(n) || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n && batch_count && !UV) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_getrf_rbt_getMemorySize(const rocblas_int n,
+                                       const rocblas_int batch_count,
+                                       size_t* size_scalars,
+                                       size_t* size_work1,
+                                       size_t* size_work2,
+                                       size_t* size_work3,
+                                       size_t* size_work4,
+                                       size_t* size_pivotval,
+                                       size_t* size_pivotidx,
+                                       size_t* size_iipiv,
+                                       size_t* size_iinfo,
+                                       bool* optim_mem,
+                                       const rocblas_int lda = 1)
+{
+    // the transforms are applied in place; only GETRF_NPVT needs workspace
+    rocsolver_getrf_getMemorySize<BATCHED, STRIDED, T>(
+        n, n, false, batch_count, size_scalars, size_work1, size_work2, size_work3, size_work4,
+        size_pivotval, size_pivotidx, size_iipiv, size_iinfo, optim_mem, lda);
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_getrf_rbt_template(rocblas_handle handle,
+                                            const rocblas_int n,
+                                            U A,
+                                            const rocblas_int shiftA,
+                                            const rocblas_int lda,
+                                            const rocblas_stride strideA,
+                                            S* UV,
+                                            const rocblas_stride strideUV,
+                                            rocblas_int* info,
+                                            const rocblas_int batch_count,
+                                            T* scalars,
+                                            void* work1,
+                                            void* work2,
+                                            void* work3,
+                                            void* work4,
+                                            T* pivotval,
+                                            rocblas_int* pivotidx,
+                                            rocblas_int* iipiv,
+                                            rocblas_int* iinfo,
+                                            bool optim_mem)
+{
+    ROCSOLVER_ENTER("getrf_rbt", "n:", n, "shiftA:", shiftA, "lda:", lda, "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    if(n > 0)
+    {
+        // generate the random butterflies U and V
+        rocblas_int blocks = (2 * GERBT_DEPTH * n - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(gerbt_generate<S>, dim3(blocks, batch_count, 1), dim3(BS1, 1, 1),
+                                0, stream, n, UV, strideUV);
+
+        // A <- U' * A * V
+        rocsolver_gerbt_apply<true, false, T>(handle, n, n, A, shiftA, lda, strideA, UV, strideUV,
+                                              batch_count);
+        rocsolver_gerbt_apply<true, true, T>(handle, n, n, A, shiftA, lda, strideA,
+                                             UV + GERBT_DEPTH * n, strideUV, batch_count);
+    }
+
+    // LU factorization of the transformed matrices without pivoting
+    return rocsolver_getrf_template<BATCHED, STRIDED, T>(
+        handle, n, n, A, shiftA, 1, lda, strideA, (rocblas_int*)nullptr, 0, 0, info, batch_count,
+        scalars, work1, work2, work3, work4, pivotval, pivotidx, iipiv, iinfo, optim_mem, false);
+}
@@ -0,0 +1,165 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_getrf_rbt.hpp"
+
+template <typename T, typename S, typename U>
+rocblas_status rocsolver_getrf_rbt_batched_impl(rocblas_handle handle,
+                                                const rocblas_int n,
+                                                U A,
+                                                const rocblas_int lda,
+                                                S* UV,
+                                                const rocblas_stride strideUV,
+                                                rocblas_int* info,
+                                                const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("getrf_rbt_batched", "-n", n, "--lda", lda, "--strideUV", strideUV,
+                        "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st
+        = rocsolver_getrf_rbt_argCheck(handle, n, lda, A, UV, strideUV, info, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // normal (non strided) batched execution
+    rocblas_stride strideA = 0;
+
+    // memory workspace sizes:
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of reusable workspace (and for calling TRSM)
+    bool optim_mem;
+    size_t size_work1, size_work2, size_work3, size_work4;
+    // extra requirements for calling GETF2
+    size_t size_pivotval, size_pivotidx;
+    // size to store info about singularity of each subblock
+    size_t size_iinfo, size_iipiv;
+
+    rocsolver_getrf_rbt_getMemorySize<true, false, T>(
+        n, batch_count, &size_scalars, &size_work1, &size_work2, &size_work3, &size_work4,
+        &size_pivotval, &size_pivotidx, &size_iipiv, &size_iinfo, &optim_mem, lda);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_scalars, size_work1, size_work2,
+                                                      size_work3, size_work4, size_pivotval,
+                                                      size_pivotidx, size_iipiv, size_iinfo);
+
+    // memory workspace allocation
+    void *scalars, *work1, *work2, *work3, *work4, *pivotval, *pivotidx, *iinfo, *iipiv;
+    rocblas_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3, size_work4,
+                              size_pivotval, size_pivotidx, size_iipiv, size_iinfo);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    work1 = mem[1];
+    work2 = mem[2];
+    work3 = mem[3];
+    work4 = mem[4];
+    pivotval = mem[5];
+    pivotidx = mem[6];
+    iipiv = mem[7];
+    iinfo = mem[8];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    // execution
+    return rocsolver_getrf_rbt_template<true, false, T>(
+        handle, n, A, shiftA, lda, strideA, UV, strideUV, info, batch_count, (T*)scalars, work1,
+        work2, work3, work4, (T*)pivotval, (rocblas_int*)pivotidx, (rocblas_int*)iipiv,
+        (rocblas_int*)iinfo, optim_mem);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgetrf_rbt_batched(rocblas_handle handle,
+                                            const rocblas_int n,
+                                            float* const A[],
+                                            const rocblas_int lda,
+                                            float* UV,
+                                            const rocblas_stride strideUV,
+                                            rocblas_int* info,
+                                            const rocblas_int batch_count)
+{
+    return rocsolver_getrf_rbt_batched_impl<float>(handle, n, A, lda, UV, strideUV, info,
+                                                   batch_count);
+}
+
+rocblas_status rocsolver_dgetrf_rbt_batched(rocblas_handle handle,
+                                            const rocblas_int n,
+                                            double* const A[],
+                                            const rocblas_int lda,
+                                            double* UV,
+                                            const rocblas_stride strideUV,
+                                            rocblas_int* info,
+                                            const rocblas_int batch_count)
+{
+    return rocsolver_getrf_rbt_batched_impl<double>(handle, n, A, lda, UV, strideUV, info,
+                                                    batch_count);
+}
+
+rocblas_status rocsolver_cgetrf_rbt_batched(rocblas_handle handle,
+                                            const rocblas_int n,
+                                            rocblas_float_complex* const A[],
+                                            const rocblas_int lda,
+                                            float* UV,
+                                            const rocblas_stride strideUV,
+                                            rocblas_int* info,
+                                            const rocblas_int batch_count)
+{
+    return rocsolver_getrf_rbt_batched_impl<rocblas_float_complex>(handle, n, A, lda, UV, strideUV,
+                                                                   info, batch_count);
+}
+
+rocblas_status rocsolver_zgetrf_rbt_batched(rocblas_handle handle,
+                                            const rocblas_int n,
+                                            rocblas_double_complex* const A[],
+                                            const rocblas_int lda,
+                                            double* UV,
+                                            const rocblas_stride strideUV,
+                                            rocblas_int* info,
+                                            const rocblas_int batch_count)
+{
+    return rocsolver_getrf_rbt_batched_impl<rocblas_double_complex>(handle, n, A, lda, UV, strideUV,
+                                                                    info, batch_count);
+}
+
+}
@@ -0,0 +1,260 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+/** GETRI_DIRECT_KERNEL computes the inverse of a small matrix A with the Gauss-Jordan method,
+    keeping the matrix in the LDS. Thread j of the group updates column j at each step, and the
+    row interchanges (if SPD = false) are undone by interchanging the columns of the result.
+    If SPD = true, only the uplo triangular part of A is referenced and updated, no pivoting
+    is performed and info is set if a non-positive pivot is found.
+    If A is singular (or not positive definite), A is not modified.
+    Call this kernel with one group of GETRI_DIRECT_MAX_SIZE threads per batch instance,
+    and (n * n + n) * sizeof(T) + n * sizeof(rocblas_int) bytes of dynamic LDS. **/
+template <bool SPD, typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(GETRI_DIRECT_MAX_SIZE)
+    getri_direct_kernel(const rocblas_fill uplo,
+                        const rocblas_int n,
+                        U AA,
+                        const rocblas_int shiftA,
+                        const rocblas_int lda,
+                        const rocblas_stride strideA,
+                        rocblas_int* info)
+{
+    using S = decltype(std::real(T{}));
+
+    const rocblas_int bid = hipBlockIdx_x;
+    const rocblas_int tid = hipThreadIdx_x;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+
+    // shared memory: the matrix, a copy of the current pivot column, and the pivot indices
+    extern __shared__ double lmem[];
+    T* sA = reinterpret_cast<T*>(lmem);
+    T* col = sA + n * n;
+    rocblas_int* spiv = reinterpret_cast<rocblas_int*>(col + n);
+
+    const bool upper = (uplo == rocblas_fill_upper);
+
+    // read A into the LDS (one row per thread); in the SPD case, the full
+    // Hermitian matrix is built from the referenced triangular part
+    if(tid < n)
+    {
+        for(rocblas_int j = 0; j < n; j++)
+        {
+            if(!SPD || (upper && tid <= j) || (!upper && tid >= j))
+                sA[tid + j * n] = A[tid + j * lda];
+            else
+                sA[tid + j * n] = conj(A[j + tid * lda]);
+        }
+    }
+
+    rocblas_int myinfo = 0;
+    for(rocblas_int k = 0; k < n; k++)
+    {
+        // share the current column
+        __syncthreads();
+        if(tid < n)
+            col[tid] = sA[tid + k * n];
+        __syncthreads();
+
+        // find the pivot (all threads find the same pivot)
+        rocblas_int p = k;
+        T pivot;
+        if(SPD)
+        {
+            const S d = std::real(col[k]);
+            if(!(d > 0 && std::isfinite(d)))
+            {
+                myinfo = k + 1;
+                break;
+            }
+            pivot = T(d);
+        }
+        else
+        {
+            S pmax = aabs<S>(col[k]);
+            for(rocblas_int i = k + 1; i < n; i++)
+            {
+                const S val = aabs<S>(col[i]);
+                if(val > pmax)
+                {
+                    pmax = val;
+                    p = i;
+                }
+            }
+            pivot = col[p];
+            if(pivot == T(0))
+            {
+                myinfo = k + 1;
+                break;
+            }
+        }
+        if(tid == 0)
+            spiv[k] = p;
+        const T pinv = T(1) / pivot;
+
+        // eliminate (thread j updates column j; the current column is read from the copy
+        // in which rows k and p are interchanged)
+        if(tid < n)
+        {
+            const rocblas_int j = tid;
+            if(p != k)
+                swap(sA[k + j * n], sA[p + j * n]);
+
+            if(j == k)
+            {
+                for(rocblas_int i = 0; i < n; i++)
+                {
+                    const T ci = col[(i == k) ? p : (i == p ? k : i)];
+                    sA[i + k * n] = (i == k) ? pinv : -ci * pinv;
+                }
+            }
+            else
+            {
+                const T akj = sA[k + j * n] * pinv;
+                sA[k + j * n] = akj;
+                for(rocblas_int i = 0; i < n; i++)
+                {
+                    if(i != k)
+                        sA[i + j * n] -= col[i == p ? k : i] * akj;
+                }
+            }
+        }
+    }
+    __syncthreads();
+
+    if(tid == 0)
+        info[bid] = myinfo;
+
+    // A is not modified if it is singular
+    if(myinfo != 0 || tid >= n)
+        return;
+
+    // undo the row interchanges by interchanging the columns of the inverse
+    // (each thread works on its own row)
+    if(!SPD)
+    {
+        for(rocblas_int k = n - 1; k >= 0; k--)
+        {
+            const rocblas_int p = spiv[k];
+            if(p != k)
+                swap(sA[tid + k * n], sA[tid + p * n]);
+        }
+    }
+
+    // write the inverse to global memory
+    for(rocblas_int j = 0; j < n; j++)
+    {
+        if(!SPD || (upper && tid <= j) || (!upper && tid >= j))
+            A[tid + j * lda] = sA[tid + j * n];
+    }
+}
+
+template <typename T>
+rocblas_status rocsolver_getri_direct_argCheck(rocblas_handle handle,
+                                               const rocblas_int n,
+                                               const rocblas_int lda,
+                                               T A,
+                                               rocblas_int* info,
+                                               const rocblas_int batch_count)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(n < 0 || n > GETRI_DIRECT_MAX_SIZE || lda < n || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+/** Launches getri_direct_kernel (shared by GETRI_DIRECT and POTRI_DIRECT) **/
+template <bool SPD, typename T, typename U>
+rocblas_status rocsolver_getri_direct_run(rocblas_handle handle,
+                                          const rocblas_fill uplo,
+                                          const rocblas_int n,
+                                          U A,
+                                          const rocblas_int shiftA,
+                                          const rocblas_int lda,
+                                          const rocblas_stride strideA,
+                                          rocblas_int* info,
+                                          const rocblas_int batch_count)
+{
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // quick return if no dimensions
+    if(n == 0)
+    {
+        rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(blocksReset, 1, 1), dim3(BS1, 1, 1), 0, stream,
+                                info, batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    size_t lmemsize = sizeof(T) * (n * n + n) + sizeof(rocblas_int) * n;
+    ROCSOLVER_LAUNCH_KERNEL((getri_direct_kernel<SPD, T>), dim3(batch_count, 1, 1),
+                            dim3(GETRI_DIRECT_MAX_SIZE, 1, 1), lmemsize, stream, uplo, n, A, shiftA,
+                            lda, strideA, info);
+
+    return rocblas_status_success;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_getri_direct_template(rocblas_handle handle,
+                                               const rocblas_int n,
+                                               U A,
+                                               const rocblas_int shiftA,
+                                               const rocblas_int lda,
+                                               const rocblas_stride strideA,
+                                               rocblas_int* info,
+                                               const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("getri_direct", "n:", n, "shiftA:", shiftA, "lda:", lda, "bc:", batch_count);
+
+    return rocsolver_getri_direct_run<false, T>(handle, rocblas_fill_full, n, A, shiftA, lda,
+                                                strideA, info, batch_count);
+}
@@ -70,7 +70,7 @@ rocblas_status rocsolver_getri_outofplace_impl(rocblas_handle handle,
         n, batch_count, &size_work1, &size_work2, &size_work3, &size_work4, &optim_mem);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_work1, size_work2, size_work3,
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_work1, size_work2, size_work3,
                                                       size_work4);
 
     // memory workspace allocation
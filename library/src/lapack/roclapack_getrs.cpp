@@ -70,7 +70,7 @@ rocblas_status rocsolver_getrs_impl(rocblas_handle handle,
                                                    &optim_mem, lda, ldb);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_work1, size_work2, size_work3,
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_work1, size_work2, size_work3,
                                                       size_work4);
 
     // memory workspace allocation
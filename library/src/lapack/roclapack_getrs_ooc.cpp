@@ -0,0 +1,145 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_ooc.hpp"
+
+template <typename T>
+rocblas_status rocsolver_getrs_ooc_impl(rocblas_handle handle,
+                                        const rocblas_operation trans,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        T* A,
+                                        const rocblas_int lda,
+                                        const rocblas_int* ipiv,
+                                        T* B,
+                                        const rocblas_int ldb)
+{
+    ROCSOLVER_ENTER_TOP("getrs_ooc", "--trans", trans, "-n", n, "--nrhs", nrhs, "--lda", lda,
+                        "--ldb", ldb);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_getrs_argCheck(handle, trans, n, nrhs, lda, ldb, A, B, ipiv);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // memory workspace sizes:
+    // size of the window for the panels of the factors
+    size_t size_W;
+    // size of workspace (for calling TRSM)
+    bool optim_mem;
+    size_t size_work1, size_work2, size_work3, size_work4;
+    rocsolver_getrs_potrs_ooc_getMemorySize<T>(trans, n, nrhs, &size_W, &size_work1, &size_work2,
+                                               &size_work3, &size_work4, &optim_mem);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_W, size_work1, size_work2,
+                                                      size_work3, size_work4);
+
+    // memory workspace allocation
+    void *W, *work1, *work2, *work3, *work4;
+    rocblas_device_malloc mem(handle, size_W, size_work1, size_work2, size_work3, size_work4);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    W = mem[0];
+    work1 = mem[1];
+    work2 = mem[2];
+    work3 = mem[3];
+    work4 = mem[4];
+
+    // execution
+    return rocsolver_getrs_ooc_template<T>(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, (T*)W,
+                                           work1, work2, work3, work4, optim_mem);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgetrs_ooc(rocblas_handle handle,
+                                    const rocblas_operation trans,
+                                    const rocblas_int n,
+                                    const rocblas_int nrhs,
+                                    float* A,
+                                    const rocblas_int lda,
+                                    const rocblas_int* ipiv,
+                                    float* B,
+                                    const rocblas_int ldb)
+{
+    return rocsolver_getrs_ooc_impl<float>(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+rocblas_status rocsolver_dgetrs_ooc(rocblas_handle handle,
+                                    const rocblas_operation trans,
+                                    const rocblas_int n,
+                                    const rocblas_int nrhs,
+                                    double* A,
+                                    const rocblas_int lda,
+                                    const rocblas_int* ipiv,
+                                    double* B,
+                                    const rocblas_int ldb)
+{
+    return rocsolver_getrs_ooc_impl<double>(handle, trans, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+rocblas_status rocsolver_cgetrs_ooc(rocblas_handle handle,
+                                    const rocblas_operation trans,
+                                    const rocblas_int n,
+                                    const rocblas_int nrhs,
+                                    rocblas_float_complex* A,
+                                    const rocblas_int lda,
+                                    const rocblas_int* ipiv,
+                                    rocblas_float_complex* B,
+                                    const rocblas_int ldb)
+{
+    return rocsolver_getrs_ooc_impl<rocblas_float_complex>(handle, trans, n, nrhs, A, lda, ipiv, B,
+                                                           ldb);
+}
+
+rocblas_status rocsolver_zgetrs_ooc(rocblas_handle handle,
+                                    const rocblas_operation trans,
+                                    const rocblas_int n,
+                                    const rocblas_int nrhs,
+                                    rocblas_double_complex* A,
+                                    const rocblas_int lda,
+                                    const rocblas_int* ipiv,
+                                    rocblas_double_complex* B,
+                                    const rocblas_int ldb)
+{
+    return rocsolver_getrs_ooc_impl<rocblas_double_complex>(handle, trans, n, nrhs, A, lda, ipiv, B,
+                                                            ldb);
+}
+
+} // extern C
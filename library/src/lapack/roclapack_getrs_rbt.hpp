@@ -0,0 +1,137 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_getrf_rbt.hpp"
+#include "roclapack_getrs.hpp"
+#include "rocsolver/rocsolver.h"
+
+template <typename T, typename S>
+rocblas_status rocsolver_getrs_rbt_argCheck(rocblas_handle handle,
+                                            const rocblas_operation trans,
+                                            const rocblas_int n,
+                                            const rocblas_int nrhs,
+                                            const rocblas_int lda,
+                                            const rocblas_int ldb,
+                                            T A,
+                                            T B,
+                                            const S* UV,
+                                            const rocblas_stride strideUV,
+                                            const rocblas_int batch_count)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(trans != rocblas_operation_none && trans != rocblas_operation_transpose
+       && trans != rocblas_operation_conjugate_transpose)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || nrhs < 0 || lda < n || ldb < n
+       || strideUV < 2 * GERBT_DEPTH * rocblas_stride(n) || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (n && batch_count && !UV) || (nrhs && n && !B))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <bool BATCHED, bool STRIDED, typename T>
+void rocsolver_getrs_rbt_getMemorySize(const rocblas_operation trans,
+                                       const rocblas_int n,
+                                       const rocblas_int nrhs,
+                                       const rocblas_int batch_count,
+                                       size_t* size_work1,
+                                       size_t* size_work2,
+                                       size_t* size_work3,
+                                       size_t* size_work4,
+                                       bool* optim_mem,
+                                       const rocblas_int lda = 1,
+                                       const rocblas_int ldb = 1)
+{
+    // the transforms are applied in place; only GETRS needs workspace
+    rocsolver_getrs_getMemorySize<BATCHED, STRIDED, T>(trans, n, nrhs, batch_count, size_work1,
+                                                       size_work2, size_work3, size_work4,
+                                                       optim_mem, lda, ldb);
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+rocblas_status rocsolver_getrs_rbt_template(rocblas_handle handle,
+                                            const rocblas_operation trans,
+                                            const rocblas_int n,
+                                            const rocblas_int nrhs,
+                                            U A,
+                                            const rocblas_int shiftA,
+                                            const rocblas_int lda,
+                                            const rocblas_stride strideA,
+                                            const S* UV,
+                                            const rocblas_stride strideUV,
+                                            U B,
+                                            const rocblas_int shiftB,
+                                            const rocblas_int ldb,
+                                            const rocblas_stride strideB,
+                                            const rocblas_int batch_count,
+                                            void* work1,
+                                            void* work2,
+                                            void* work3,
+                                            void* work4,
+                                            bool optim_mem)
+{
+    ROCSOLVER_ENTER("getrs_rbt", "trans:", trans, "n:", n, "nrhs:", nrhs, "shiftA:", shiftA,
+                    "lda:", lda, "shiftB:", shiftB, "ldb:", ldb, "bc:", batch_count);
+
+    // quick return
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    // A was factorized as U'*A*V = L*R, then
+    //   A*X = B   is solved as  X = V * inv(L*R) * U'*B
+    //   A'*X = B  is solved as  X = U * inv(L*R)' * V'*B
+    // (the butterflies are real, so the conjugate transpose case is the same as the transpose)
+    const S* W1 = (trans == rocblas_operation_none) ? UV : UV + GERBT_DEPTH * n;
+    const S* W2 = (trans == rocblas_operation_none) ? UV + GERBT_DEPTH * n : UV;
+
+    rocsolver_gerbt_apply<true, false, T>(handle, n, nrhs, B, shiftB, ldb, strideB, W1, strideUV,
+                                          batch_count);
+
+    rocsolver_getrs_template<BATCHED, STRIDED, T>(
+        handle, trans, n, nrhs, A, shiftA, 1, lda, strideA, (rocblas_int*)nullptr, 0, B, shiftB, 1,
+        ldb, strideB, batch_count, work1, work2, work3, work4, optim_mem, false);
+
+    rocsolver_gerbt_apply<false, false, T>(handle, n, nrhs, B, shiftB, ldb, strideB, W2, strideUV,
+                                           batch_count);
+
+    return rocblas_status_success;
+}
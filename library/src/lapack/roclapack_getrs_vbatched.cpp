@@ -0,0 +1,193 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+#include "roclapack_vbatched.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_getrs_vbatched_impl(rocblas_handle handle,
+                                             const rocblas_operation trans,
+                                             const rocblas_int* n,
+                                             const rocblas_int* nrhs,
+                                             U A,
+                                             const rocblas_int* lda,
+                                             const rocblas_int* const ipiv[],
+                                             U B,
+                                             const rocblas_int* ldb,
+                                             const rocblas_int max_n,
+                                             const rocblas_int max_nrhs,
+                                             const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("getrs_vbatched", "--trans", trans, "--max_n", max_n, "--max_nrhs",
+                        max_nrhs, "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_getrs_vbatched_argCheck(handle, trans, n, nrhs, lda, ldb, A, B,
+                                                          ipiv, max_n, max_nrhs, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // memory workspace sizes:
+    // size of reusable workspace (for calling TRSM)
+    size_t size_work[4];
+    // size to sort the problems, store their order and the pointers to the matrices of a group
+    size_t size_sort, size_order, size_ABarr;
+    // size to store the pivot indices of a group
+    size_t size_gipiv;
+    // size to pad the matrices of a group
+    size_t size_pad;
+    rocsolver_getrs_vbatched_getMemorySize<T>(trans, max_n, max_nrhs, batch_count, &size_work[0],
+                                              &size_work[1], &size_work[2], &size_work[3],
+                                              &size_sort, &size_order, &size_ABarr, &size_gipiv,
+                                              &size_pad);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_work[0], size_work[1],
+                                                      size_work[2], size_work[3], size_sort,
+                                                      size_order, size_ABarr, size_gipiv, size_pad);
+
+    // quick return
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    // memory workspace allocation
+    void *work1, *work2, *work3, *work4, *sort, *order, *ABarr, *gipiv, *pad;
+    rocblas_device_malloc mem(handle, size_work[0], size_work[1], size_work[2], size_work[3],
+                              size_sort, size_order, size_ABarr, size_gipiv, size_pad);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    work1 = mem[0];
+    work2 = mem[1];
+    work3 = mem[2];
+    work4 = mem[3];
+    sort = mem[4];
+    order = mem[5];
+    ABarr = mem[6];
+    gipiv = mem[7];
+    pad = mem[8];
+
+    // group the problems by size class
+    rocsolver_vbatched_groups<4> groups;
+    st = rocsolver_vbatched_sort<T, 4, 2>(
+        handle, batch_count, {n, nrhs, lda, ldb},
+        [&](const std::array<rocblas_int, 4>& d) {
+            return d[0] < 0 || d[1] < 0 || d[0] > max_n || d[1] > max_nrhs || d[2] < d[0]
+                || d[2] < 1 || d[3] < d[0] || d[3] < 1;
+        },
+        sort, (rocblas_int*)order, groups);
+    if(st != rocblas_status_success)
+        return st;
+
+    // execution
+    return rocsolver_getrs_vbatched_template<T>(
+        handle, trans, n, nrhs, A, lda, ipiv, B, ldb, groups, work1, work2, work3, work4,
+        (rocblas_int*)order, (T**)ABarr, (rocblas_int*)gipiv, (T*)pad, size_work, size_pad,
+        batch_count);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgetrs_vbatched(rocblas_handle handle,
+                                         const rocblas_operation trans,
+                                         const rocblas_int* n,
+                                         const rocblas_int* nrhs,
+                                         float* const A[],
+                                         const rocblas_int* lda,
+                                         const rocblas_int* const ipiv[],
+                                         float* const B[],
+                                         const rocblas_int* ldb,
+                                         const rocblas_int max_n,
+                                         const rocblas_int max_nrhs,
+                                         const rocblas_int batch_count)
+{
+    return rocsolver_getrs_vbatched_impl<float>(handle, trans, n, nrhs, A, lda, ipiv, B, ldb,
+                                                max_n, max_nrhs, batch_count);
+}
+
+rocblas_status rocsolver_dgetrs_vbatched(rocblas_handle handle,
+                                         const rocblas_operation trans,
+                                         const rocblas_int* n,
+                                         const rocblas_int* nrhs,
+                                         double* const A[],
+                                         const rocblas_int* lda,
+                                         const rocblas_int* const ipiv[],
+                                         double* const B[],
+                                         const rocblas_int* ldb,
+                                         const rocblas_int max_n,
+                                         const rocblas_int max_nrhs,
+                                         const rocblas_int batch_count)
+{
+    return rocsolver_getrs_vbatched_impl<double>(handle, trans, n, nrhs, A, lda, ipiv, B, ldb,
+                                                 max_n, max_nrhs, batch_count);
+}
+
+rocblas_status rocsolver_cgetrs_vbatched(rocblas_handle handle,
+                                         const rocblas_operation trans,
+                                         const rocblas_int* n,
+                                         const rocblas_int* nrhs,
+                                         rocblas_float_complex* const A[],
+                                         const rocblas_int* lda,
+                                         const rocblas_int* const ipiv[],
+                                         rocblas_float_complex* const B[],
+                                         const rocblas_int* ldb,
+                                         const rocblas_int max_n,
+                                         const rocblas_int max_nrhs,
+                                         const rocblas_int batch_count)
+{
+    return rocsolver_getrs_vbatched_impl<rocblas_float_complex>(handle, trans, n, nrhs, A, lda,
+                                                                ipiv, B, ldb, max_n, max_nrhs,
+                                                                batch_count);
+}
+
+rocblas_status rocsolver_zgetrs_vbatched(rocblas_handle handle,
+                                         const rocblas_operation trans,
+                                         const rocblas_int* n,
+                                         const rocblas_int* nrhs,
+                                         rocblas_double_complex* const A[],
+                                         const rocblas_int* lda,
+                                         const rocblas_int* const ipiv[],
+                                         rocblas_double_complex* const B[],
+                                         const rocblas_int* ldb,
+                                         const rocblas_int max_n,
+                                         const rocblas_int max_nrhs,
+                                         const rocblas_int batch_count)
+{
+    return rocsolver_getrs_vbatched_impl<rocblas_double_complex>(handle, trans, n, nrhs, A, lda,
+                                                                 ipiv, B, ldb, max_n, max_nrhs,
+                                                                 batch_count);
+}
+
+} // extern C
@@ -0,0 +1,245 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "lapack_device_functions.hpp"
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+/** GPSV_KERNEL solves the pentadiagonal system A*X = B by Gaussian elimination without pivoting.
+    Each thread solves one system of the batch (a lane), processing all the right-hand sides at
+    the same time. The diagonal and first super-diagonal of the upper triangular factor are kept
+    in the workspace, interleaved among the lanes (the second super-diagonal is that of A). The
+    diagonals of A are not modified. **/
+template <typename T>
+ROCSOLVER_KERNEL void gpsv_kernel(const rocblas_int n,
+                                  const rocblas_int nrhs,
+                                  T* dsA,
+                                  const rocblas_int incds,
+                                  const rocblas_stride strideDS,
+                                  T* dlA,
+                                  const rocblas_int incdl,
+                                  const rocblas_stride strideDL,
+                                  T* dA,
+                                  const rocblas_int incd,
+                                  const rocblas_stride strideD,
+                                  T* duA,
+                                  const rocblas_int incdu,
+                                  const rocblas_stride strideDU,
+                                  T* dwA,
+                                  const rocblas_int incdw,
+                                  const rocblas_stride strideDW,
+                                  T* BA,
+                                  const rocblas_int incb,
+                                  const rocblas_int ldb,
+                                  const rocblas_stride strideB,
+                                  rocblas_int* infoA,
+                                  const rocblas_int batch_count,
+                                  T* work)
+{
+    rocblas_int bid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(bid >= batch_count)
+        return;
+
+    // batch instance
+    T* ds = dsA + bid * strideDS;
+    T* dl = dlA + bid * strideDL;
+    T* d = dA + bid * strideD;
+    T* du = duA + bid * strideDU;
+    T* dw = dwA + bid * strideDW;
+    T* B = BA + bid * strideB;
+    T* u = work + bid;
+    T* v = work + size_t(n) * batch_count + bid;
+
+    auto b = [&](rocblas_int i, rocblas_int j) -> T& { return B[i * incb + j * ldb]; };
+
+    // forward elimination; row i is updated with rows i-2 and i-1 of the upper triangular factor
+    for(rocblas_int i = 0; i < n; i++)
+    {
+        T li = (i > 0) ? dl[(i - 1) * incdl] : T(0);
+        T ui = d[i * incd];
+        T vi = (i < n - 1) ? du[i * incdu] : T(0);
+
+        if(i > 1)
+        {
+            T m2 = ds[(i - 2) * incds] / u[(i - 2) * batch_count];
+            li -= m2 * v[(i - 2) * batch_count];
+            ui -= m2 * dw[(i - 2) * incdw];
+            for(rocblas_int j = 0; j < nrhs; j++)
+                b(i, j) -= m2 * b(i - 2, j);
+        }
+        if(i > 0)
+        {
+            T m1 = li / u[(i - 1) * batch_count];
+            ui -= m1 * v[(i - 1) * batch_count];
+            if(i < n - 1)
+                vi -= m1 * dw[(i - 1) * incdw];
+            for(rocblas_int j = 0; j < nrhs; j++)
+                b(i, j) -= m1 * b(i - 1, j);
+        }
+
+        if(ui == T(0))
+        {
+            infoA[bid] = i + 1;
+            return;
+        }
+        u[i * batch_count] = ui;
+        v[i * batch_count] = vi;
+    }
+
+    // back substitution
+    for(rocblas_int j = 0; j < nrhs; j++)
+    {
+        b(n - 1, j) /= u[(n - 1) * batch_count];
+        if(n > 1)
+            b(n - 2, j) = (b(n - 2, j) - v[(n - 2) * batch_count] * b(n - 1, j))
+                / u[(n - 2) * batch_count];
+        for(rocblas_int i = n - 3; i >= 0; i--)
+            b(i, j) = (b(i, j) - v[i * batch_count] * b(i + 1, j) - dw[i * incdw] * b(i + 2, j))
+                / u[i * batch_count];
+    }
+
+    infoA[bid] = 0;
+}
+
+template <typename T>
+void rocsolver_gpsv_getMemorySize(const rocblas_int n,
+                                  const rocblas_int batch_count,
+                                  size_t* size_work)
+{
+    // if quick return no need of workspace
+    if(n == 0 || batch_count == 0)
+    {
+        *size_work = 0;
+        return;
+    }
+
+    // size of the diagonal and first super-diagonal of the upper triangular factor
+    *size_work = sizeof(T) * 2 * n * batch_count;
+}
+
+template <typename T>
+rocblas_status rocsolver_gpsv_argCheck(rocblas_handle handle,
+                                       const rocblas_int n,
+                                       const rocblas_int nrhs,
+                                       T* ds,
+                                       T* dl,
+                                       T* d,
+                                       T* du,
+                                       T* dw,
+                                       T* B,
+                                       const rocblas_int ldb,
+                                       rocblas_int* info,
+                                       const rocblas_int batch_count,
+                                       const rocblas_int incds = 1,
+                                       const rocblas_int incdl = 1,
+                                       const rocblas_int incd = 1,
+                                       const rocblas_int incdu = 1,
+                                       const rocblas_int incdw = 1,
+                                       const rocblas_int incb = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(n < 0 || nrhs < 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if(incds < 1 || incdl < 1 || incd < 1 || incdu < 1 || incdw < 1)
+        return rocblas_status_invalid_size;
+    if(incb < 1 || ldb < incb * n)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n > 2 && !ds) || (n > 1 && !dl) || (n && !d) || (n > 1 && !du) || (n > 2 && !dw)
+       || (n && nrhs && !B) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T>
+rocblas_status rocsolver_gpsv_template(rocblas_handle handle,
+                                       const rocblas_int n,
+                                       const rocblas_int nrhs,
+                                       T* ds,
+                                       const rocblas_int incds,
+                                       const rocblas_stride strideDS,
+                                       T* dl,
+                                       const rocblas_int incdl,
+                                       const rocblas_stride strideDL,
+                                       T* d,
+                                       const rocblas_int incd,
+                                       const rocblas_stride strideD,
+                                       T* du,
+                                       const rocblas_int incdu,
+                                       const rocblas_stride strideDU,
+                                       T* dw,
+                                       const rocblas_int incdw,
+                                       const rocblas_stride strideDW,
+                                       T* B,
+                                       const rocblas_int incb,
+                                       const rocblas_int ldb,
+                                       const rocblas_stride strideB,
+                                       rocblas_int* info,
+                                       const rocblas_int batch_count,
+                                       T* work)
+{
+    ROCSOLVER_ENTER("gpsv", "n:", n, "nrhs:", nrhs, "incds:", incds, "incdl:", incdl, "incd:", incd,
+                    "incdu:", incdu, "incdw:", incdw, "incb:", incb, "ldb:", ldb, "bc:",
+                    batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+
+    // quick return if no dimensions
+    if(n == 0)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(blocks, 1, 1), dim3(BS1, 1, 1), 0, stream, info,
+                                batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    ROCSOLVER_LAUNCH_KERNEL(gpsv_kernel<T>, dim3(blocks, 1, 1), dim3(BS1, 1, 1), 0, stream, n, nrhs,
+                            ds, incds, strideDS, dl, incdl, strideDL, d, incd, strideD, du, incdu,
+                            strideDU, dw, incdw, strideDW, B, incb, ldb, strideB, info, batch_count,
+                            work);
+
+    return rocblas_status_success;
+}
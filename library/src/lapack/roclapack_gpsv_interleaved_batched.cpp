@@ -0,0 +1,223 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_gpsv.hpp"
+
+template <typename T>
+rocblas_status rocsolver_gpsv_interleaved_batched_impl(rocblas_handle handle,
+                                                       const rocblas_int n,
+                                                       const rocblas_int nrhs,
+                                                       T* ds,
+                                                       const rocblas_int incds,
+                                                       const rocblas_stride strideDS,
+                                                       T* dl,
+                                                       const rocblas_int incdl,
+                                                       const rocblas_stride strideDL,
+                                                       T* d,
+                                                       const rocblas_int incd,
+                                                       const rocblas_stride strideD,
+                                                       T* du,
+                                                       const rocblas_int incdu,
+                                                       const rocblas_stride strideDU,
+                                                       T* dw,
+                                                       const rocblas_int incdw,
+                                                       const rocblas_stride strideDW,
+                                                       T* B,
+                                                       const rocblas_int incb,
+                                                       const rocblas_int ldb,
+                                                       const rocblas_stride strideB,
+                                                       rocblas_int* info,
+                                                       const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("gpsv_interleaved_batched", "-n", n, "--nrhs", nrhs, "--incds", incds,
+                        "--strideDS", strideDS, "--incdl", incdl, "--strideDL", strideDL, "--incd",
+                        incd, "--strideD", strideD, "--incdu", incdu, "--strideDU", strideDU,
+                        "--incdw", incdw, "--strideDW", strideDW, "--incb", incb, "--ldb", ldb,
+                        "--strideB", strideB, "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_gpsv_argCheck(handle, n, nrhs, ds, dl, d, du, dw, B, ldb, info,
+                                                batch_count, incds, incdl, incd, incdu, incdw,
+                                                incb);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // memory workspace sizes:
+    // size to store the upper triangular factor
+    size_t size_work;
+    rocsolver_gpsv_getMemorySize<T>(n, batch_count, &size_work);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_work);
+
+    // memory workspace allocation
+    void* work;
+    rocblas_device_malloc mem(handle, size_work);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    work = mem[0];
+
+    // execution
+    return rocsolver_gpsv_template<T>(
+        handle, n, nrhs, ds, incds, strideDS, dl, incdl, strideDL, d, incd, strideD, du, incdu,
+        strideDU, dw, incdw, strideDW, B, incb, ldb, strideB, info, batch_count, (T*)work);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgpsv_interleaved_batched(rocblas_handle handle,
+                                                   const rocblas_int n,
+                                                   const rocblas_int nrhs,
+                                                   float* ds,
+                                                   const rocblas_int incds,
+                                                   const rocblas_stride strideDS,
+                                                   float* dl,
+                                                   const rocblas_int incdl,
+                                                   const rocblas_stride strideDL,
+                                                   float* d,
+                                                   const rocblas_int incd,
+                                                   const rocblas_stride strideD,
+                                                   float* du,
+                                                   const rocblas_int incdu,
+                                                   const rocblas_stride strideDU,
+                                                   float* dw,
+                                                   const rocblas_int incdw,
+                                                   const rocblas_stride strideDW,
+                                                   float* B,
+                                                   const rocblas_int incb,
+                                                   const rocblas_int ldb,
+                                                   const rocblas_stride strideB,
+                                                   rocblas_int* info,
+                                                   const rocblas_int batch_count)
+{
+    return rocsolver_gpsv_interleaved_batched_impl<float>(
+        handle, n, nrhs, ds, incds, strideDS, dl, incdl, strideDL, d, incd, strideD, du, incdu,
+        strideDU, dw, incdw, strideDW, B, incb, ldb, strideB, info, batch_count);
+}
+
+rocblas_status rocsolver_dgpsv_interleaved_batched(rocblas_handle handle,
+                                                   const rocblas_int n,
+                                                   const rocblas_int nrhs,
+                                                   double* ds,
+                                                   const rocblas_int incds,
+                                                   const rocblas_stride strideDS,
+                                                   double* dl,
+                                                   const rocblas_int incdl,
+                                                   const rocblas_stride strideDL,
+                                                   double* d,
+                                                   const rocblas_int incd,
+                                                   const rocblas_stride strideD,
+                                                   double* du,
+                                                   const rocblas_int incdu,
+                                                   const rocblas_stride strideDU,
+                                                   double* dw,
+                                                   const rocblas_int incdw,
+                                                   const rocblas_stride strideDW,
+                                                   double* B,
+                                                   const rocblas_int incb,
+                                                   const rocblas_int ldb,
+                                                   const rocblas_stride strideB,
+                                                   rocblas_int* info,
+                                                   const rocblas_int batch_count)
+{
+    return rocsolver_gpsv_interleaved_batched_impl<double>(
+        handle, n, nrhs, ds, incds, strideDS, dl, incdl, strideDL, d, incd, strideD, du, incdu,
+        strideDU, dw, incdw, strideDW, B, incb, ldb, strideB, info, batch_count);
+}
+
+rocblas_status rocsolver_cgpsv_interleaved_batched(rocblas_handle handle,
+                                                   const rocblas_int n,
+                                                   const rocblas_int nrhs,
+                                                   rocblas_float_complex* ds,
+                                                   const rocblas_int incds,
+                                                   const rocblas_stride strideDS,
+                                                   rocblas_float_complex* dl,
+                                                   const rocblas_int incdl,
+                                                   const rocblas_stride strideDL,
+                                                   rocblas_float_complex* d,
+                                                   const rocblas_int incd,
+                                                   const rocblas_stride strideD,
+                                                   rocblas_float_complex* du,
+                                                   const rocblas_int incdu,
+                                                   const rocblas_stride strideDU,
+                                                   rocblas_float_complex* dw,
+                                                   const rocblas_int incdw,
+                                                   const rocblas_stride strideDW,
+                                                   rocblas_float_complex* B,
+                                                   const rocblas_int incb,
+                                                   const rocblas_int ldb,
+                                                   const rocblas_stride strideB,
+                                                   rocblas_int* info,
+                                                   const rocblas_int batch_count)
+{
+    return rocsolver_gpsv_interleaved_batched_impl<rocblas_float_complex>(
+        handle, n, nrhs, ds, incds, strideDS, dl, incdl, strideDL, d, incd, strideD, du, incdu,
+        strideDU, dw, incdw, strideDW, B, incb, ldb, strideB, info, batch_count);
+}
+
+rocblas_status rocsolver_zgpsv_interleaved_batched(rocblas_handle handle,
+                                                   const rocblas_int n,
+                                                   const rocblas_int nrhs,
+                                                   rocblas_double_complex* ds,
+                                                   const rocblas_int incds,
+                                                   const rocblas_stride strideDS,
+                                                   rocblas_double_complex* dl,
+                                                   const rocblas_int incdl,
+                                                   const rocblas_stride strideDL,
+                                                   rocblas_double_complex* d,
+                                                   const rocblas_int incd,
+                                                   const rocblas_stride strideD,
+                                                   rocblas_double_complex* du,
+                                                   const rocblas_int incdu,
+                                                   const rocblas_stride strideDU,
+                                                   rocblas_double_complex* dw,
+                                                   const rocblas_int incdw,
+                                                   const rocblas_stride strideDW,
+                                                   rocblas_double_complex* B,
+                                                   const rocblas_int incb,
+                                                   const rocblas_int ldb,
+                                                   const rocblas_stride strideB,
+                                                   rocblas_int* info,
+                                                   const rocblas_int batch_count)
+{
+    return rocsolver_gpsv_interleaved_batched_impl<rocblas_double_complex>(
+        handle, n, nrhs, ds, incds, strideDS, dl, incdl, strideDL, d, incd, strideD, du, incdu,
+        strideDU, dw, incdw, strideDW, B, incb, ldb, strideB, info, batch_count);
+}
+
+} // extern C
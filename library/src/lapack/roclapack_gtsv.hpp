@@ -0,0 +1,223 @@
+/*****************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "lapack_device_functions.hpp"
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+/** GTSV_KERNEL solves the tridiagonal system A*X = B by Gaussian elimination with partial
+    pivoting. Each thread solves one system of the batch (a lane), processing all the right-hand
+    sides at the same time. The element i of the diagonals of the system is located at
+    position i*inc of the corresponding array. **/
+template <typename T>
+ROCSOLVER_KERNEL void gtsv_kernel(const rocblas_int n,
+                                  const rocblas_int nrhs,
+                                  T* dlA,
+                                  const rocblas_int incdl,
+                                  const rocblas_stride strideDL,
+                                  T* dA,
+                                  const rocblas_int incd,
+                                  const rocblas_stride strideD,
+                                  T* duA,
+                                  const rocblas_int incdu,
+                                  const rocblas_stride strideDU,
+                                  T* BA,
+                                  const rocblas_int incb,
+                                  const rocblas_int ldb,
+                                  const rocblas_stride strideB,
+                                  rocblas_int* infoA,
+                                  const rocblas_int batch_count)
+{
+    using S = decltype(std::real(T{}));
+
+    rocblas_int bid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(bid >= batch_count)
+        return;
+
+    // batch instance
+    T* dl = dlA + bid * strideDL;
+    T* d = dA + bid * strideD;
+    T* du = duA + bid * strideDU;
+    T* B = BA + bid * strideB;
+
+    auto b = [&](rocblas_int i, rocblas_int j) -> T& { return B[i * incb + j * ldb]; };
+
+    for(rocblas_int i = 0; i < n - 1; i++)
+    {
+        T di = d[i * incd];
+        T dli = dl[i * incdl];
+        if(aabs<S>(di) >= aabs<S>(dli))
+        {
+            // no row interchange required
+            if(di == T(0))
+            {
+                infoA[bid] = i + 1;
+                return;
+            }
+            T fact = dli / di;
+            d[(i + 1) * incd] -= fact * du[i * incdu];
+            for(rocblas_int j = 0; j < nrhs; j++)
+                b(i + 1, j) -= fact * b(i, j);
+            if(i < n - 2)
+                dl[i * incdl] = 0;
+        }
+        else
+        {
+            // interchange rows i and i+1; the fill-in of the second super-diagonal of U
+            // is stored in dl
+            T fact = di / dli;
+            d[i * incd] = dli;
+            T temp = d[(i + 1) * incd];
+            d[(i + 1) * incd] = du[i * incdu] - fact * temp;
+            if(i < n - 2)
+            {
+                dl[i * incdl] = du[(i + 1) * incdu];
+                du[(i + 1) * incdu] = -fact * dl[i * incdl];
+            }
+            du[i * incdu] = temp;
+            for(rocblas_int j = 0; j < nrhs; j++)
+            {
+                temp = b(i, j);
+                b(i, j) = b(i + 1, j);
+                b(i + 1, j) = temp - fact * b(i + 1, j);
+            }
+        }
+    }
+    if(d[(n - 1) * incd] == T(0))
+    {
+        infoA[bid] = n;
+        return;
+    }
+
+    // back substitution with the upper triangular factor U
+    for(rocblas_int j = 0; j < nrhs; j++)
+    {
+        b(n - 1, j) /= d[(n - 1) * incd];
+        if(n > 1)
+            b(n - 2, j) = (b(n - 2, j) - du[(n - 2) * incdu] * b(n - 1, j)) / d[(n - 2) * incd];
+        for(rocblas_int i = n - 3; i >= 0; i--)
+            b(i, j) = (b(i, j) - du[i * incdu] * b(i + 1, j) - dl[i * incdl] * b(i + 2, j))
+                / d[i * incd];
+    }
+
+    infoA[bid] = 0;
+}
+
+template <typename T>
+rocblas_status rocsolver_gtsv_argCheck(rocblas_handle handle,
+                                       const rocblas_int n,
+                                       const rocblas_int nrhs,
+                                       T* dl,
+                                       T* d,
+                                       T* du,
+                                       T* B,
+                                       const rocblas_int ldb,
+                                       rocblas_int* info,
+                                       const rocblas_int batch_count,
+                                       const rocblas_int incdl = 1,
+                                       const rocblas_int incd = 1,
+                                       const rocblas_int incdu = 1,
+                                       const rocblas_int incb = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(n < 0 || nrhs < 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+    if(incdl < 1 || incd < 1 || incdu < 1)
+        return rocblas_status_invalid_size;
+    if(incb < 1 || ldb < incb * n)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n > 1 && !dl) || (n && !d) || (n > 1 && !du) || (n && nrhs && !B)
+       || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T>
+rocblas_status rocsolver_gtsv_template(rocblas_handle handle,
+                                       const rocblas_int n,
+                                       const rocblas_int nrhs,
+                                       T* dl,
+                                       const rocblas_int incdl,
+                                       const rocblas_stride strideDL,
+                                       T* d,
+                                       const rocblas_int incd,
+                                       const rocblas_stride strideD,
+                                       T* du,
+                                       const rocblas_int incdu,
+                                       const rocblas_stride strideDU,
+                                       T* B,
+                                       const rocblas_int incb,
+                                       const rocblas_int ldb,
+                                       const rocblas_stride strideB,
+                                       rocblas_int* info,
+                                       const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("gtsv", "n:", n, "nrhs:", nrhs, "incdl:", incdl, "incd:", incd, "incdu:", incdu,
+                    "incb:", incb, "ldb:", ldb, "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+
+    // quick return if no dimensions
+    if(n == 0)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(blocks, 1, 1), dim3(BS1, 1, 1), 0, stream, info,
+                                batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    ROCSOLVER_LAUNCH_KERNEL(gtsv_kernel<T>, dim3(blocks, 1, 1), dim3(BS1, 1, 1), 0, stream, n,
+                            nrhs, dl, incdl, strideDL, d, incd, strideD, du, incdu, strideDU, B,
+                            incb, ldb, strideB, info, batch_count);
+
+    return rocblas_status_success;
+}
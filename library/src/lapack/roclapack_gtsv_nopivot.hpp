@@ -0,0 +1,305 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_gtsv.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_handle_state.hpp"
+
+/** GTSV_NOPIVOT_THOMAS_KERNEL solves the tridiagonal system A*X = B with the Thomas algorithm
+    (Gaussian elimination without pivoting). Each thread solves one system of the batch (a lane),
+    processing all the right-hand sides at the same time. The diagonal of the upper bidiagonal
+    factor is kept in the workspace, interleaved among the lanes. The diagonals of A are not
+    modified. **/
+template <typename T>
+ROCSOLVER_KERNEL void gtsv_nopivot_thomas_kernel(const rocblas_int n,
+                                                 const rocblas_int nrhs,
+                                                 T* dlA,
+                                                 const rocblas_int incdl,
+                                                 const rocblas_stride strideDL,
+                                                 T* dA,
+                                                 const rocblas_int incd,
+                                                 const rocblas_stride strideD,
+                                                 T* duA,
+                                                 const rocblas_int incdu,
+                                                 const rocblas_stride strideDU,
+                                                 T* BA,
+                                                 const rocblas_int incb,
+                                                 const rocblas_int ldb,
+                                                 const rocblas_stride strideB,
+                                                 rocblas_int* infoA,
+                                                 const rocblas_int batch_count,
+                                                 T* work)
+{
+    rocblas_int bid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(bid >= batch_count)
+        return;
+
+    // batch instance
+    T* dl = dlA + bid * strideDL;
+    T* d = dA + bid * strideD;
+    T* du = duA + bid * strideDU;
+    T* B = BA + bid * strideB;
+    T* u = work + bid;
+
+    auto b = [&](rocblas_int i, rocblas_int j) -> T& { return B[i * incb + j * ldb]; };
+
+    // forward elimination
+    T ui = d[0];
+    if(ui == T(0))
+    {
+        infoA[bid] = 1;
+        return;
+    }
+    u[0] = ui;
+    for(rocblas_int i = 1; i < n; i++)
+    {
+        T l = dl[(i - 1) * incdl] / ui;
+        ui = d[i * incd] - l * du[(i - 1) * incdu];
+        if(ui == T(0))
+        {
+            infoA[bid] = i + 1;
+            return;
+        }
+        u[i * batch_count] = ui;
+        for(rocblas_int j = 0; j < nrhs; j++)
+            b(i, j) -= l * b(i - 1, j);
+    }
+
+    // back substitution
+    for(rocblas_int j = 0; j < nrhs; j++)
+    {
+        b(n - 1, j) /= u[(n - 1) * batch_count];
+        for(rocblas_int i = n - 2; i >= 0; i--)
+            b(i, j) = (b(i, j) - du[i * incdu] * b(i + 1, j)) / u[i * batch_count];
+    }
+
+    infoA[bid] = 0;
+}
+
+/** GTSV_NOPIVOT_PCR_KERNEL solves the tridiagonal system A*X = B with parallel cyclic reduction.
+    Each thread block solves the system for one right-hand side; after ceil(log2(n)) reduction
+    steps all the equations are decoupled. The equations are kept in the LDS (double-buffered), so
+    the diagonals of A are not modified. If a zero pivot is found, info is set to the first row
+    where it occurred, and B is not modified. **/
+template <typename T>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1)
+    gtsv_nopivot_pcr_kernel(const rocblas_int n,
+                            T* dlA,
+                            const rocblas_int incdl,
+                            const rocblas_stride strideDL,
+                            T* dA,
+                            const rocblas_int incd,
+                            const rocblas_stride strideD,
+                            T* duA,
+                            const rocblas_int incdu,
+                            const rocblas_stride strideDU,
+                            T* BA,
+                            const rocblas_int incb,
+                            const rocblas_int ldb,
+                            const rocblas_stride strideB,
+                            rocblas_int* infoA)
+{
+    rocblas_int rhs = hipBlockIdx_x;
+    rocblas_int bid = hipBlockIdx_y;
+    rocblas_int tid = hipThreadIdx_x;
+
+    // batch instance
+    T* dl = dlA + bid * strideDL;
+    T* d = dA + bid * strideD;
+    T* du = duA + bid * strideDU;
+    T* x = BA + bid * strideB + rhs * ldb;
+
+    // shared memory setup: two copies of the sub-diagonal, diagonal, super-diagonal and
+    // right-hand side of the reduced equations
+    extern __shared__ double lmem[];
+    T* a[2] = {reinterpret_cast<T*>(lmem), reinterpret_cast<T*>(lmem) + 4 * n};
+    T* bb[2] = {a[0] + n, a[1] + n};
+    T* c[2] = {a[0] + 2 * n, a[1] + 2 * n};
+    T* r[2] = {a[0] + 3 * n, a[1] + 3 * n};
+    __shared__ rocblas_int zrow;
+
+    if(tid == 0)
+        zrow = n;
+    for(rocblas_int i = tid; i < n; i += BS1)
+    {
+        a[0][i] = (i > 0) ? dl[(i - 1) * incdl] : T(0);
+        bb[0][i] = d[i * incd];
+        c[0][i] = (i < n - 1) ? du[i * incdu] : T(0);
+        r[0][i] = x[i * incb];
+    }
+    __syncthreads();
+
+    // reduction steps
+    rocblas_int p = 0;
+    for(rocblas_int s = 1; s < n; s *= 2)
+    {
+        for(rocblas_int i = tid; i < n; i += BS1)
+        {
+            T ai = 0, ci = 0;
+            T bi = bb[p][i];
+            T ri = r[p][i];
+            if(i >= s && a[p][i] != T(0))
+            {
+                if(bb[p][i - s] == T(0))
+                    atomicMin(&zrow, i - s);
+                T k = a[p][i] / bb[p][i - s];
+                ai = -a[p][i - s] * k;
+                bi -= c[p][i - s] * k;
+                ri -= r[p][i - s] * k;
+            }
+            if(i + s < n && c[p][i] != T(0))
+            {
+                if(bb[p][i + s] == T(0))
+                    atomicMin(&zrow, i + s);
+                T k = c[p][i] / bb[p][i + s];
+                ci = -c[p][i + s] * k;
+                bi -= a[p][i + s] * k;
+                ri -= r[p][i + s] * k;
+            }
+            a[1 - p][i] = ai;
+            bb[1 - p][i] = bi;
+            c[1 - p][i] = ci;
+            r[1 - p][i] = ri;
+        }
+        p = 1 - p;
+        __syncthreads();
+    }
+
+    // solve the decoupled equations
+    for(rocblas_int i = tid; i < n; i += BS1)
+    {
+        if(bb[p][i] == T(0))
+            atomicMin(&zrow, i);
+    }
+    __syncthreads();
+
+    if(zrow == n)
+    {
+        for(rocblas_int i = tid; i < n; i += BS1)
+            x[i * incb] = r[p][i] / bb[p][i];
+    }
+
+    if(rhs == 0 && tid == 0)
+        infoA[bid] = (zrow < n) ? zrow + 1 : 0;
+}
+
+/** GTSV_NOPIVOT_LDS_SIZE returns the size in bytes of the LDS required to solve a system of
+    size n with parallel cyclic reduction, or 0 if the Thomas algorithm must be used instead. If
+    the architecture is not given, the Thomas algorithm is assumed (so that enough workspace is
+    reserved). **/
+template <typename T>
+size_t rocsolver_gtsv_nopivot_lds_size(const rocblas_int n,
+                                       const rocblas_int nrhs,
+                                       const rocsolver_arch_info* arch)
+{
+    size_t size = sizeof(T) * 8 * size_t(n);
+    if(!arch || n < GTSV_PCR_SWITCHSIZE || nrhs == 0
+       || size > size_t(arch->lds_size) - sizeof(rocblas_int))
+        return 0;
+    return size;
+}
+
+template <typename T>
+void rocsolver_gtsv_nopivot_getMemorySize(const rocblas_int n,
+                                          const rocblas_int nrhs,
+                                          const rocblas_int batch_count,
+                                          size_t* size_work,
+                                          const rocsolver_arch_info* arch = nullptr)
+{
+    // if quick return, or if using parallel cyclic reduction, no need of workspace
+    if(n == 0 || batch_count == 0 || rocsolver_gtsv_nopivot_lds_size<T>(n, nrhs, arch) > 0)
+    {
+        *size_work = 0;
+        return;
+    }
+
+    // size of the diagonal of the upper bidiagonal factor
+    *size_work = sizeof(T) * n * batch_count;
+}
+
+template <typename T>
+rocblas_status rocsolver_gtsv_nopivot_template(rocblas_handle handle,
+                                               const rocblas_int n,
+                                               const rocblas_int nrhs,
+                                               T* dl,
+                                               const rocblas_int incdl,
+                                               const rocblas_stride strideDL,
+                                               T* d,
+                                               const rocblas_int incd,
+                                               const rocblas_stride strideD,
+                                               T* du,
+                                               const rocblas_int incdu,
+                                               const rocblas_stride strideDU,
+                                               T* B,
+                                               const rocblas_int incb,
+                                               const rocblas_int ldb,
+                                               const rocblas_stride strideB,
+                                               rocblas_int* info,
+                                               const rocblas_int batch_count,
+                                               T* work)
+{
+    ROCSOLVER_ENTER("gtsv_nopivot", "n:", n, "nrhs:", nrhs, "incdl:", incdl, "incd:", incd,
+                    "incdu:", incdu, "incb:", incb, "ldb:", ldb, "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+
+    // quick return if no dimensions
+    if(n == 0)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(blocks, 1, 1), dim3(BS1, 1, 1), 0, stream, info,
+                                batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    const rocsolver_arch_info arch = rocsolver_handle_state_map::get_arch(handle);
+    size_t lmemsize = rocsolver_gtsv_nopivot_lds_size<T>(n, nrhs, &arch);
+
+    if(lmemsize > 0)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(gtsv_nopivot_pcr_kernel<T>, dim3(nrhs, batch_count, 1),
+                                dim3(BS1, 1, 1), lmemsize, stream, n, dl, incdl, strideDL, d, incd,
+                                strideD, du, incdu, strideDU, B, incb, ldb, strideB, info);
+    }
+    else
+    {
+        ROCSOLVER_LAUNCH_KERNEL(gtsv_nopivot_thomas_kernel<T>, dim3(blocks, 1, 1), dim3(BS1, 1, 1),
+                                0, stream, n, nrhs, dl, incdl, strideDL, d, incd, strideD, du,
+                                incdu, strideDU, B, incb, ldb, strideB, info, batch_count, work);
+    }
+
+    return rocblas_status_success;
+}
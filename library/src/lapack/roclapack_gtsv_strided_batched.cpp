@@ -0,0 +1,161 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_gtsv.hpp"
+
+template <typename T>
+rocblas_status rocsolver_gtsv_strided_batched_impl(rocblas_handle handle,
+                                                   const rocblas_int n,
+                                                   const rocblas_int nrhs,
+                                                   T* dl,
+                                                   const rocblas_stride strideDL,
+                                                   T* d,
+                                                   const rocblas_stride strideD,
+                                                   T* du,
+                                                   const rocblas_stride strideDU,
+                                                   T* B,
+                                                   const rocblas_int ldb,
+                                                   const rocblas_stride strideB,
+                                                   rocblas_int* info,
+                                                   const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("gtsv_strided_batched", "-n", n, "--nrhs", nrhs, "--strideDL", strideDL,
+                        "--strideD", strideD, "--strideDU", strideDU, "--ldb", ldb, "--strideB",
+                        strideB, "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // the elements of each system are stored contiguously
+    rocblas_int incdl = 1;
+    rocblas_int incd = 1;
+    rocblas_int incdu = 1;
+    rocblas_int incb = 1;
+
+    // argument checking
+    rocblas_status st = rocsolver_gtsv_argCheck(handle, n, nrhs, dl, d, du, B, ldb, info,
+                                                batch_count, incdl, incd, incdu, incb);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // this function does not require memory work space
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_size_unchanged;
+
+    // execution
+    return rocsolver_gtsv_template<T>(handle, n, nrhs, dl, incdl, strideDL, d, incd, strideD, du,
+                                      incdu, strideDU, B, incb, ldb, strideB, info, batch_count);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_sgtsv_strided_batched(rocblas_handle handle,
+                                               const rocblas_int n,
+                                               const rocblas_int nrhs,
+                                               float* dl,
+                                               const rocblas_stride strideDL,
+                                               float* d,
+                                               const rocblas_stride strideD,
+                                               float* du,
+                                               const rocblas_stride strideDU,
+                                               float* B,
+                                               const rocblas_int ldb,
+                                               const rocblas_stride strideB,
+                                               rocblas_int* info,
+                                               const rocblas_int batch_count)
+{
+    return rocsolver_gtsv_strided_batched_impl<float>(handle, n, nrhs, dl, strideDL, d, strideD, du,
+                                                      strideDU, B, ldb, strideB, info, batch_count);
+}
+
+rocblas_status rocsolver_dgtsv_strided_batched(rocblas_handle handle,
+                                               const rocblas_int n,
+                                               const rocblas_int nrhs,
+                                               double* dl,
+                                               const rocblas_stride strideDL,
+                                               double* d,
+                                               const rocblas_stride strideD,
+                                               double* du,
+                                               const rocblas_stride strideDU,
+                                               double* B,
+                                               const rocblas_int ldb,
+                                               const rocblas_stride strideB,
+                                               rocblas_int* info,
+                                               const rocblas_int batch_count)
+{
+    return rocsolver_gtsv_strided_batched_impl<double>(
+        handle, n, nrhs, dl, strideDL, d, strideD, du, strideDU, B, ldb, strideB, info,
+        batch_count);
+}
+
+rocblas_status rocsolver_cgtsv_strided_batched(rocblas_handle handle,
+                                               const rocblas_int n,
+                                               const rocblas_int nrhs,
+                                               rocblas_float_complex* dl,
+                                               const rocblas_stride strideDL,
+                                               rocblas_float_complex* d,
+                                               const rocblas_stride strideD,
+                                               rocblas_float_complex* du,
+                                               const rocblas_stride strideDU,
+                                               rocblas_float_complex* B,
+                                               const rocblas_int ldb,
+                                               const rocblas_stride strideB,
+                                               rocblas_int* info,
+                                               const rocblas_int batch_count)
+{
+    return rocsolver_gtsv_strided_batched_impl<rocblas_float_complex>(
+        handle, n, nrhs, dl, strideDL, d, strideD, du, strideDU, B, ldb, strideB, info,
+        batch_count);
+}
+
+rocblas_status rocsolver_zgtsv_strided_batched(rocblas_handle handle,
+                                               const rocblas_int n,
+                                               const rocblas_int nrhs,
+                                               rocblas_double_complex* dl,
+                                               const rocblas_stride strideDL,
+                                               rocblas_double_complex* d,
+                                               const rocblas_stride strideD,
+                                               rocblas_double_complex* du,
+                                               const rocblas_stride strideDU,
+                                               rocblas_double_complex* B,
+                                               const rocblas_int ldb,
+                                               const rocblas_stride strideB,
+                                               rocblas_int* info,
+                                               const rocblas_int batch_count)
+{
+    return rocsolver_gtsv_strided_batched_impl<rocblas_double_complex>(
+        handle, n, nrhs, dl, strideDL, d, strideD, du, strideDU, B, ldb, strideB, info,
+        batch_count);
+}
+
+} // extern C
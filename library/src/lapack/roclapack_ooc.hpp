@@ -0,0 +1,853 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+
+#include "rocblas.hpp"
+#include "roclapack_getrf.hpp"
+#include "roclapack_getrs.hpp"
+#include "roclapack_potrf.hpp"
+#include "roclapack_potrs.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_handle_state.hpp"
+
+/*
+ * ===========================================================================
+ *    Out-of-core factorizations and solvers. The matrix A stays in host memory
+ *    and only column panels of OOC_BLOCKSIZE columns are kept on the device.
+ *    The factorizations are left-looking: every panel is brought to the device,
+ *    updated with all the previous (already factorized) panels, factorized with
+ *    the in-core template, and written back to the host. The previous panels are
+ *    streamed through a window of two device buffers, so that the copy of the
+ *    next one overlaps with the update with the current one. The solvers stream
+ *    the panels of the triangular factors in the same way.
+ * ===========================================================================
+ */
+
+/** OOC_COPY copies the rows x cols matrix src (with leading dimension lds) into dst (with
+    leading dimension ldd) on the given stream. **/
+template <typename T>
+hipError_t rocsolver_ooc_copy(T* dst,
+                              const size_t ldd,
+                              const T* src,
+                              const size_t lds,
+                              const rocblas_int rows,
+                              const rocblas_int cols,
+                              const hipMemcpyKind kind,
+                              hipStream_t stream)
+{
+    if(rows <= 0 || cols <= 0)
+        return hipSuccess;
+
+    return hipMemcpy2DAsync(dst, ldd * sizeof(T), src, lds * sizeof(T), rows * sizeof(T), cols,
+                            kind, stream);
+}
+
+/** OOC_PANEL_INFO adds the offset j to the npiv pivot indices of the panel that starts at row
+    j, and sets info from the info value iinfo of the panel (if no previous panel failed). **/
+template <typename I>
+ROCSOLVER_KERNEL void ooc_panel_info(I* ipiv, const I npiv, const I j, const I* iinfo, I* info)
+{
+    I tid = hipBlockIdx_x * static_cast<I>(hipBlockDim_x) + hipThreadIdx_x;
+
+    if(tid < npiv)
+        ipiv[tid] += j;
+
+    if(tid == 0 && *info == 0 && *iinfo > 0)
+        *info = *iinfo + j;
+}
+
+/** The window of two device buffers through which the column panels of a host matrix are
+    streamed. Row r of a loaded panel is stored in row r of the buffer (with leading
+    dimension ldw), so that the buffers can be addressed with the indices of the host matrix.
+    The copies are executed on two streams of the pool of the handle (streams 1 and 2; stream
+    0 is left to the look-ahead of the in-core templates), and the stream of the handle waits
+    for them only when the buffer is needed. In capture-safe mode, the copies are executed
+    in order on the stream of the handle instead, so that no streams or events of the pool
+    are used while the stream is being captured. **/
+template <typename T>
+struct rocsolver_ooc_window
+{
+    hipStream_t stream;
+    hipStream_t copy_streams[2];
+    hipEvent_t mark;
+    hipEvent_t loaded[2];
+    T* buffers[2];
+    rocblas_int ldw;
+    bool serial;
+
+    rocblas_status init(rocblas_handle handle, T* work, const rocblas_int ldw, const rocblas_int nb)
+    {
+        ROCBLAS_CHECK(rocblas_get_stream(handle, &stream));
+        serial = rocsolver_handle_state_map::capture_safe_enabled(handle);
+        if(serial)
+        {
+            copy_streams[0] = copy_streams[1] = stream;
+            mark = loaded[0] = loaded[1] = nullptr;
+        }
+        else
+        {
+            hipStream_t streams[3];
+            hipEvent_t events[4];
+            ROCBLAS_CHECK(rocsolver_handle_state_map::get_streams(handle, 3, streams, events));
+
+            copy_streams[0] = streams[1];
+            copy_streams[1] = streams[2];
+            mark = events[0];
+            loaded[0] = events[2];
+            loaded[1] = events[3];
+        }
+        buffers[0] = work;
+        buffers[1] = work + size_t(ldw) * nb;
+        this->ldw = ldw;
+        return rocblas_status_success;
+    }
+
+    // enqueues the copy of rows r0 to r1-1 of the nc columns of the host matrix A starting at
+    // column c0 into buffer b (once the work enqueued so far on the stream of the handle, which
+    // may still read the buffer or write the host matrix, is done)
+    rocblas_status load(const int b,
+                        const T* A,
+                        const rocblas_int lda,
+                        const rocblas_int r0,
+                        const rocblas_int r1,
+                        const rocblas_int c0,
+                        const rocblas_int nc)
+    {
+        if(!serial)
+        {
+            HIP_CHECK(hipEventRecord(mark, stream));
+            HIP_CHECK(hipStreamWaitEvent(copy_streams[b], mark, 0));
+        }
+        HIP_CHECK(rocsolver_ooc_copy(buffers[b] + r0, ldw, A + r0 + size_t(c0) * lda, lda, r1 - r0,
+                                     nc, hipMemcpyHostToDevice, copy_streams[b]));
+        if(!serial)
+            HIP_CHECK(hipEventRecord(loaded[b], copy_streams[b]));
+        return rocblas_status_success;
+    }
+
+    // makes the stream of the handle wait until buffer b is loaded
+    rocblas_status wait(const int b)
+    {
+        if(!serial)
+            HIP_CHECK(hipStreamWaitEvent(stream, loaded[b], 0));
+        return rocblas_status_success;
+    }
+};
+
+/** OOC_TRSM solves op(T)*X = B, where T is the lower or upper triangular part of the n-by-n
+    host matrix A and B is an n-by-nrhs device matrix, streaming the column panels of T through
+    the window. Only rows k to n-1 (lower) or 0 to k+kb-1 (upper) of the panel starting at
+    column k are transferred. **/
+template <typename T>
+rocblas_status rocsolver_ooc_trsm(rocblas_handle handle,
+                                  rocsolver_ooc_window<T>& win,
+                                  const rocblas_fill uplo,
+                                  const rocblas_operation trans,
+                                  const rocblas_diagonal diag,
+                                  const rocblas_int n,
+                                  const rocblas_int nrhs,
+                                  const T* A,
+                                  const rocblas_int lda,
+                                  T* B,
+                                  const rocblas_int ldb,
+                                  void* work1,
+                                  void* work2,
+                                  void* work3,
+                                  void* work4,
+                                  const bool optim_mem)
+{
+    const rocblas_int nb = OOC_BLOCKSIZE;
+    const rocblas_int npanels = (n - 1) / nb + 1;
+    const bool forward = ((uplo == rocblas_fill_lower) == (trans == rocblas_operation_none));
+    T one = 1;
+    T minone = -1;
+
+    // first column of the panel processed at step s
+    auto panel = [&](rocblas_int s) { return (forward ? s : npanels - 1 - s) * nb; };
+    auto load = [&](int b, rocblas_int k) {
+        rocblas_int kb = std::min(nb, n - k);
+        if(uplo == rocblas_fill_lower)
+            return win.load(b, A, lda, k, n, k, kb);
+        else
+            return win.load(b, A, lda, 0, k + kb, k, kb);
+    };
+
+    ROCBLAS_CHECK(load(0, panel(0)));
+    for(rocblas_int s = 0; s < npanels; ++s)
+    {
+        rocblas_int k = panel(s);
+        rocblas_int kb = std::min(nb, n - k);
+        int b = s % 2;
+
+        // prefetch the next panel
+        if(s + 1 < npanels)
+            ROCBLAS_CHECK(load(1 - b, panel(s + 1)));
+
+        ROCBLAS_CHECK(win.wait(b));
+        T* W = win.buffers[b];
+        rocblas_int ldw = win.ldw;
+
+        if(uplo == rocblas_fill_lower)
+        {
+            if(trans == rocblas_operation_none)
+            {
+                rocsolver_trsm_lower<false, false, T>(handle, rocblas_side_left, trans, diag, kb,
+                                                      nrhs, W, k, ldw, 0, B, k, ldb, 0, 1,
+                                                      optim_mem, work1, work2, work3, work4);
+                if(k + kb < n)
+                    ROCBLAS_CHECK(rocblasCall_gemm(handle, trans, rocblas_operation_none,
+                                                   n - k - kb, nrhs, kb, &minone, W, k + kb, ldw,
+                                                   0, B, k, ldb, 0, &one, B, k + kb, ldb, 0, 1,
+                                                   (T**)nullptr));
+            }
+            else
+            {
+                if(k + kb < n)
+                    ROCBLAS_CHECK(rocblasCall_gemm(handle, trans, rocblas_operation_none, kb, nrhs,
+                                                   n - k - kb, &minone, W, k + kb, ldw, 0, B,
+                                                   k + kb, ldb, 0, &one, B, k, ldb, 0, 1,
+                                                   (T**)nullptr));
+                rocsolver_trsm_lower<false, false, T>(handle, rocblas_side_left, trans, diag, kb,
+                                                      nrhs, W, k, ldw, 0, B, k, ldb, 0, 1,
+                                                      optim_mem, work1, work2, work3, work4);
+            }
+        }
+        else
+        {
+            if(trans == rocblas_operation_none)
+            {
+                rocsolver_trsm_upper<false, false, T>(handle, rocblas_side_left, trans, diag, kb,
+                                                      nrhs, W, k, ldw, 0, B, k, ldb, 0, 1,
+                                                      optim_mem, work1, work2, work3, work4);
+                if(k > 0)
+                    ROCBLAS_CHECK(rocblasCall_gemm(handle, trans, rocblas_operation_none, k, nrhs,
+                                                   kb, &minone, W, 0, ldw, 0, B, k, ldb, 0, &one, B,
+                                                   0, ldb, 0, 1, (T**)nullptr));
+            }
+            else
+            {
+                if(k > 0)
+                    ROCBLAS_CHECK(rocblasCall_gemm(handle, trans, rocblas_operation_none, kb, nrhs,
+                                                   k, &minone, W, 0, ldw, 0, B, 0, ldb, 0, &one, B,
+                                                   k, ldb, 0, 1, (T**)nullptr));
+                rocsolver_trsm_upper<false, false, T>(handle, rocblas_side_left, trans, diag, kb,
+                                                      nrhs, W, k, ldw, 0, B, k, ldb, 0, 1,
+                                                      optim_mem, work1, work2, work3, work4);
+            }
+        }
+    }
+
+    return rocblas_status_success;
+}
+
+/*************************************************************
+    GETRF_OOC
+*************************************************************/
+
+template <typename T>
+void rocsolver_getrf_ooc_getMemorySize(const rocblas_int m,
+                                       const rocblas_int n,
+                                       size_t* size_P,
+                                       size_t* size_W,
+                                       size_t* size_scalars,
+                                       size_t* size_work1,
+                                       size_t* size_work2,
+                                       size_t* size_work3,
+                                       size_t* size_work4,
+                                       size_t* size_pivotval,
+                                       size_t* size_pivotidx,
+                                       size_t* size_iipiv,
+                                       size_t* size_iinfo,
+                                       size_t* size_pinfo,
+                                       bool* optim_mem)
+{
+    // if quick return, no workspace is needed
+    if(m == 0 || n == 0)
+    {
+        *size_P = 0;
+        *size_W = 0;
+        *size_scalars = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_pivotval = 0;
+        *size_pivotidx = 0;
+        *size_iipiv = 0;
+        *size_iinfo = 0;
+        *size_pinfo = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    const rocblas_int mn = std::min(m, n);
+    const rocblas_int jb = std::min(rocblas_int(OOC_BLOCKSIZE), n);
+    const rocblas_int kb = std::min(rocblas_int(OOC_BLOCKSIZE), mn);
+
+    // the resident panel and the window for the previous panels
+    *size_P = sizeof(T) * m * jb;
+    *size_W = (n > OOC_BLOCKSIZE ? 2 * sizeof(T) * m * kb : 0);
+    *size_pinfo = sizeof(rocblas_int);
+
+    // requirements for calling GETRF for the first and the last panels (the largest and
+    // the smallest ones)
+    size_t s[9];
+    bool opt;
+    const rocblas_int jl = ((mn - 1) / OOC_BLOCKSIZE) * OOC_BLOCKSIZE;
+    rocsolver_getrf_getMemorySize<false, false, T>(m, jb, true, 1, size_scalars, size_work1,
+                                                   size_work2, size_work3, size_work4,
+                                                   size_pivotval, size_pivotidx, size_iipiv,
+                                                   size_iinfo, optim_mem, m);
+    rocsolver_getrf_getMemorySize<false, false, T>(m - jl, std::min(jb, n - jl), true, 1, &s[0],
+                                                   &s[1], &s[2], &s[3], &s[4], &s[5], &s[6], &s[7],
+                                                   &s[8], &opt, m);
+    *size_scalars = std::max(*size_scalars, s[0]);
+    *size_work1 = std::max(*size_work1, s[1]);
+    *size_work2 = std::max(*size_work2, s[2]);
+    *size_work3 = std::max(*size_work3, s[3]);
+    *size_work4 = std::max(*size_work4, s[4]);
+    *size_pivotval = std::max(*size_pivotval, s[5]);
+    *size_pivotidx = std::max(*size_pivotidx, s[6]);
+    *size_iipiv = std::max(*size_iipiv, s[7]);
+    *size_iinfo = std::max(*size_iinfo, s[8]);
+    *optim_mem = *optim_mem && opt;
+
+    // extra requirements for calling TRSM with the diagonal blocks of the previous panels
+    rocsolver_trsm_mem<false, false, T>(rocblas_side_left, rocblas_operation_none, kb, jb, 1,
+                                        &s[1], &s[2], &s[3], &s[4], &opt);
+    *size_work1 = std::max(*size_work1, s[1]);
+    *size_work2 = std::max(*size_work2, s[2]);
+    *size_work3 = std::max(*size_work3, s[3]);
+    *size_work4 = std::max(*size_work4, s[4]);
+    *optim_mem = *optim_mem && opt;
+}
+
+template <typename T>
+rocblas_status rocsolver_getrf_ooc_template(rocblas_handle handle,
+                                            const rocblas_int m,
+                                            const rocblas_int n,
+                                            T* A,
+                                            const rocblas_int lda,
+                                            rocblas_int* ipiv,
+                                            rocblas_int* info,
+                                            T* P,
+                                            T* W,
+                                            T* scalars,
+                                            void* work1,
+                                            void* work2,
+                                            void* work3,
+                                            void* work4,
+                                            T* pivotval,
+                                            rocblas_int* pivotidx,
+                                            rocblas_int* iipiv,
+                                            rocblas_int* iinfo,
+                                            rocblas_int* pinfo,
+                                            const bool optim_mem)
+{
+    ROCSOLVER_ENTER("getrf_ooc", "m:", m, "n:", n, "lda:", lda);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // info = 0
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(1, 1, 1), dim3(1, 1, 1), 0, stream, info, 1, 0);
+
+    // quick return
+    if(m == 0 || n == 0)
+        return rocblas_status_success;
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    T one = 1;
+    T minone = -1;
+
+    const rocblas_int nb = OOC_BLOCKSIZE;
+    const rocblas_int mn = std::min(m, n);
+    rocsolver_ooc_window<T> win;
+    ROCBLAS_CHECK(win.init(handle, W, m, std::min(nb, mn)));
+
+    for(rocblas_int j = 0; j < n; j += nb)
+    {
+        rocblas_int jb = std::min(nb, n - j);
+        rocblas_int kmax = std::min(j, mn);
+
+        // bring the panel to the device and apply the interchanges of the previous panels
+        HIP_CHECK(rocsolver_ooc_copy(P, m, A + size_t(j) * lda, lda, m, jb, hipMemcpyHostToDevice,
+                                     stream));
+        if(kmax > 0)
+        {
+            rocsolver_laswp_template<T>(handle, jb, P, 0, 1, m, 0, 1, kmax, ipiv, 0, 1, 0, 1);
+            ROCBLAS_CHECK(win.load(0, A, lda, 0, m, 0, std::min(nb, kmax)));
+        }
+
+        // update the panel with the previous panels (rows k to m-1 of each)
+        for(rocblas_int k = 0, s = 0; k < kmax; k += nb, ++s)
+        {
+            rocblas_int kb = std::min(nb, kmax - k);
+            int b = s % 2;
+
+            // prefetch the next panel
+            if(k + nb < kmax)
+                ROCBLAS_CHECK(
+                    win.load(1 - b, A, lda, k + nb, m, k + nb, std::min(nb, kmax - k - nb)));
+
+            ROCBLAS_CHECK(win.wait(b));
+            T* L = win.buffers[b];
+
+            // the host copy of the panel lacks the interchanges of the panels factorized after it
+            if(k + kb < kmax)
+                rocsolver_laswp_template<T>(handle, kb, L, 0, 1, m, 0, k + kb + 1, kmax, ipiv, 0, 1,
+                                            0, 1);
+
+            // compute the block row of U and update the rows below it
+            rocsolver_trsm_lower<false, false, T>(
+                handle, rocblas_side_left, rocblas_operation_none, rocblas_diagonal_unit, kb, jb, L,
+                k, m, 0, P, k, m, 0, 1, optim_mem, work1, work2, work3, work4);
+            if(k + kb < m)
+                ROCBLAS_CHECK(rocblasCall_gemm(handle, rocblas_operation_none,
+                                               rocblas_operation_none, m - k - kb, jb, kb, &minone,
+                                               L, k + kb, m, 0, P, k, m, 0, &one, P, k + kb, m, 0,
+                                               1, (T**)nullptr));
+        }
+
+        // factorize the panel (rows j to m-1)
+        if(j < mn)
+        {
+            rocblas_int npiv = std::min(jb, m - j);
+            ROCBLAS_CHECK(rocsolver_getrf_template<false, false, T>(
+                handle, m - j, jb, P, j, 1, m, 0, ipiv, j, 0, pinfo, 1, scalars, work1, work2,
+                work3, work4, pivotval, pivotidx, iipiv, iinfo, optim_mem, true));
+
+            ROCSOLVER_LAUNCH_KERNEL(ooc_panel_info<rocblas_int>, dim3((npiv - 1) / BS1 + 1, 1, 1),
+                                    dim3(BS1, 1, 1), 0, stream, ipiv + j, npiv, j, pinfo, info);
+        }
+
+        // write the panel back
+        HIP_CHECK(rocsolver_ooc_copy(A + size_t(j) * lda, lda, P, m, m, jb, hipMemcpyDeviceToHost,
+                                     stream));
+    }
+
+    // apply the interchanges of the later panels to the columns of L of every panel
+    // (rows k+kb to m-1, streamed through the window and written back)
+    const rocblas_int nfix = (mn - 1) / nb;
+    if(nfix > 0)
+        ROCBLAS_CHECK(win.load(0, A, lda, nb, m, 0, nb));
+    for(rocblas_int s = 0; s < nfix; ++s)
+    {
+        rocblas_int k = s * nb;
+        int b = s % 2;
+
+        if(s + 1 < nfix)
+            ROCBLAS_CHECK(win.load(1 - b, A, lda, k + 2 * nb, m, k + nb, nb));
+
+        ROCBLAS_CHECK(win.wait(b));
+        T* L = win.buffers[b];
+        rocsolver_laswp_template<T>(handle, nb, L, 0, 1, m, 0, k + nb + 1, mn, ipiv, 0, 1, 0, 1);
+        HIP_CHECK(rocsolver_ooc_copy(A + (k + nb) + size_t(k) * lda, lda, L + (k + nb), m,
+                                     m - k - nb, nb, hipMemcpyDeviceToHost, stream));
+    }
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
+
+/*************************************************************
+    POTRF_OOC
+*************************************************************/
+
+template <typename T>
+void rocsolver_potrf_ooc_getMemorySize(const rocblas_fill uplo,
+                                       const rocblas_int n,
+                                       size_t* size_P,
+                                       size_t* size_W,
+                                       size_t* size_scalars,
+                                       size_t* size_work1,
+                                       size_t* size_work2,
+                                       size_t* size_work3,
+                                       size_t* size_work4,
+                                       size_t* size_pivots,
+                                       size_t* size_iinfo,
+                                       size_t* size_pinfo,
+                                       bool* optim_mem,
+                                       const rocsolver_arch_info* arch)
+{
+    // if quick return, no workspace is needed
+    if(n == 0)
+    {
+        *size_P = 0;
+        *size_W = 0;
+        *size_scalars = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_pivots = 0;
+        *size_iinfo = 0;
+        *size_pinfo = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    const rocblas_int nb = std::min(rocblas_int(OOC_BLOCKSIZE), n);
+
+    // the resident panel and the window for the previous panels
+    *size_P = sizeof(T) * n * nb;
+    *size_W = (n > nb ? 2 * sizeof(T) * n * nb : 0);
+    *size_pinfo = sizeof(rocblas_int);
+
+    // requirements for calling POTRF for the diagonal blocks (the last one can be smaller,
+    // which may select a different algorithm)
+    size_t s[7];
+    bool opt;
+    const rocblas_int jl = n - ((n - 1) / nb) * nb;
+    rocsolver_potrf_getMemorySize<false, false, T>(nb, uplo, rocblas_int(1), size_scalars,
+                                                   size_work1, size_work2, size_work3, size_work4,
+                                                   size_pivots, size_iinfo, optim_mem, arch);
+    rocsolver_potrf_getMemorySize<false, false, T>(jl, uplo, rocblas_int(1), &s[0], &s[1], &s[2],
+                                                   &s[3], &s[4], &s[5], &s[6], &opt, arch);
+    *size_scalars = std::max(*size_scalars, s[0]);
+    *size_work1 = std::max(*size_work1, s[1]);
+    *size_work2 = std::max(*size_work2, s[2]);
+    *size_work3 = std::max(*size_work3, s[3]);
+    *size_work4 = std::max(*size_work4, s[4]);
+    *size_pivots = std::max(*size_pivots, s[5]);
+    *size_iinfo = std::max(*size_iinfo, s[6]);
+    *optim_mem = *optim_mem && opt;
+
+    // extra requirements for calling TRSM with the diagonal blocks
+    if(uplo == rocblas_fill_upper)
+        rocsolver_trsm_mem<false, false, T>(rocblas_side_left,
+                                            rocblas_operation_conjugate_transpose, nb, nb, 1, &s[1],
+                                            &s[2], &s[3], &s[4], &opt);
+    else
+        rocsolver_trsm_mem<false, false, T>(rocblas_side_right,
+                                            rocblas_operation_conjugate_transpose, n - nb, nb, 1,
+                                            &s[1], &s[2], &s[3], &s[4], &opt);
+    *size_work1 = std::max(*size_work1, s[1]);
+    *size_work2 = std::max(*size_work2, s[2]);
+    *size_work3 = std::max(*size_work3, s[3]);
+    *size_work4 = std::max(*size_work4, s[4]);
+    *optim_mem = *optim_mem && opt;
+}
+
+template <typename T, typename S>
+rocblas_status rocsolver_potrf_ooc_template(rocblas_handle handle,
+                                            const rocblas_fill uplo,
+                                            const rocblas_int n,
+                                            T* A,
+                                            const rocblas_int lda,
+                                            rocblas_int* info,
+                                            T* P,
+                                            T* W,
+                                            T* scalars,
+                                            void* work1,
+                                            void* work2,
+                                            void* work3,
+                                            void* work4,
+                                            T* pivots,
+                                            rocblas_int* iinfo,
+                                            rocblas_int* pinfo,
+                                            const bool optim_mem)
+{
+    ROCSOLVER_ENTER("potrf_ooc", "uplo:", uplo, "n:", n, "lda:", lda);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // info = 0 (starting with a positive definite matrix)
+    ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(1, 1, 1), dim3(1, 1, 1), 0, stream, info, 1, 0);
+
+    // quick return
+    if(n == 0)
+        return rocblas_status_success;
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+    T t_one = 1;
+    T t_minone = -1;
+    S s_one = 1;
+    S s_minone = -1;
+
+    const rocblas_int nb = OOC_BLOCKSIZE;
+    rocsolver_ooc_window<T> win;
+    ROCBLAS_CHECK(win.init(handle, W, n, std::min(nb, n)));
+
+    for(rocblas_int j = 0; j < n; j += nb)
+    {
+        rocblas_int jb = std::min(nb, n - j);
+
+        if(uplo == rocblas_fill_upper)
+        {
+            // bring rows 0 to j+jb-1 of the panel to the device
+            HIP_CHECK(rocsolver_ooc_copy(P, n, A + size_t(j) * lda, lda, j + jb, jb,
+                                         hipMemcpyHostToDevice, stream));
+            if(j > 0)
+                ROCBLAS_CHECK(win.load(0, A, lda, 0, nb, 0, nb));
+
+            // compute the rows of U above the diagonal block with the previous panels
+            // (rows 0 to k+nb-1 of each)
+            for(rocblas_int k = 0, s = 0; k < j; k += nb, ++s)
+            {
+                int b = s % 2;
+
+                // prefetch the next panel
+                if(k + nb < j)
+                    ROCBLAS_CHECK(win.load(1 - b, A, lda, 0, k + 2 * nb, k + nb, nb));
+
+                ROCBLAS_CHECK(win.wait(b));
+                T* U = win.buffers[b];
+
+                if(k > 0)
+                    ROCBLAS_CHECK(rocblasCall_gemm(
+                        handle, rocblas_operation_conjugate_transpose, rocblas_operation_none, nb,
+                        jb, k, &t_minone, U, 0, n, 0, P, 0, n, 0, &t_one, P, k, n, 0, 1,
+                        (T**)nullptr));
+                rocsolver_trsm_upper<false, false, T>(
+                    handle, rocblas_side_left, rocblas_operation_conjugate_transpose,
+                    rocblas_diagonal_non_unit, nb, jb, U, k, n, 0, P, k, n, 0, 1, optim_mem, work1,
+                    work2, work3, work4);
+            }
+
+            // update and factorize the diagonal block
+            if(j > 0)
+                ROCBLAS_CHECK(rocblasCall_syrk_herk<false, T>(
+                    handle, uplo, rocblas_operation_conjugate_transpose, jb, j, &s_minone, P, 0, n,
+                    0, &s_one, P, j, n, 0, 1));
+            ROCBLAS_CHECK(rocsolver_potrf_template<false, false, T, S>(
+                handle, uplo, jb, P, j, n, 0, pinfo, 1, scalars, work1, work2, work3, work4, pivots,
+                iinfo, optim_mem));
+            ROCSOLVER_LAUNCH_KERNEL(ooc_panel_info<rocblas_int>, dim3(1, 1, 1), dim3(1, 1, 1), 0,
+                                    stream, (rocblas_int*)nullptr, 0, j, pinfo, info);
+
+            // write the panel back
+            HIP_CHECK(rocsolver_ooc_copy(A + size_t(j) * lda, lda, P, n, j + jb, jb,
+                                         hipMemcpyDeviceToHost, stream));
+        }
+        else
+        {
+            // bring rows j to n-1 of the panel to the device
+            HIP_CHECK(rocsolver_ooc_copy(P + j, n, A + j + size_t(j) * lda, lda, n - j, jb,
+                                         hipMemcpyHostToDevice, stream));
+            if(j > 0)
+                ROCBLAS_CHECK(win.load(0, A, lda, j, n, 0, nb));
+
+            // update the panel with the previous panels (rows j to n-1 of each)
+            for(rocblas_int k = 0, s = 0; k < j; k += nb, ++s)
+            {
+                int b = s % 2;
+
+                // prefetch the next panel
+                if(k + nb < j)
+                    ROCBLAS_CHECK(win.load(1 - b, A, lda, j, n, k + nb, nb));
+
+                ROCBLAS_CHECK(win.wait(b));
+                T* L = win.buffers[b];
+
+                ROCBLAS_CHECK(rocblasCall_syrk_herk<false, T>(handle, uplo, rocblas_operation_none,
+                                                              jb, nb, &s_minone, L, j, n, 0, &s_one,
+                                                              P, j, n, 0, 1));
+                if(j + jb < n)
+                    ROCBLAS_CHECK(rocblasCall_gemm(
+                        handle, rocblas_operation_none, rocblas_operation_conjugate_transpose,
+                        n - j - jb, jb, nb, &t_minone, L, j + jb, n, 0, L, j, n, 0, &t_one, P,
+                        j + jb, n, 0, 1, (T**)nullptr));
+            }
+
+            // factorize the diagonal block and compute the rows of L below it
+            ROCBLAS_CHECK(rocsolver_potrf_template<false, false, T, S>(
+                handle, uplo, jb, P, j, n, 0, pinfo, 1, scalars, work1, work2, work3, work4, pivots,
+                iinfo, optim_mem));
+            ROCSOLVER_LAUNCH_KERNEL(ooc_panel_info<rocblas_int>, dim3(1, 1, 1), dim3(1, 1, 1), 0,
+                                    stream, (rocblas_int*)nullptr, 0, j, pinfo, info);
+            if(j + jb < n)
+                rocsolver_trsm_lower<false, false, T>(
+                    handle, rocblas_side_right, rocblas_operation_conjugate_transpose,
+                    rocblas_diagonal_non_unit, n - j - jb, jb, P, j, n, 0, P, j + jb, n, 0, 1,
+                    optim_mem, work1, work2, work3, work4);
+
+            // write the panel back
+            HIP_CHECK(rocsolver_ooc_copy(A + j + size_t(j) * lda, lda, P + j, n, n - j, jb,
+                                         hipMemcpyDeviceToHost, stream));
+        }
+    }
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
+
+/*************************************************************
+    GETRS_OOC and POTRS_OOC
+*************************************************************/
+
+template <typename T>
+void rocsolver_getrs_potrs_ooc_getMemorySize(const rocblas_operation trans,
+                                             const rocblas_int n,
+                                             const rocblas_int nrhs,
+                                             size_t* size_W,
+                                             size_t* size_work1,
+                                             size_t* size_work2,
+                                             size_t* size_work3,
+                                             size_t* size_work4,
+                                             bool* optim_mem)
+{
+    // if quick return, no workspace is needed
+    if(n == 0 || nrhs == 0)
+    {
+        *size_W = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *optim_mem = true;
+        return;
+    }
+
+    const rocblas_int nb = std::min(rocblas_int(OOC_BLOCKSIZE), n);
+
+    // the window for the panels of the triangular factors
+    *size_W = 2 * sizeof(T) * n * nb;
+
+    // requirements for calling TRSM with the diagonal blocks
+    rocsolver_trsm_mem<false, false, T>(rocblas_side_left, trans, nb, nrhs, 1, size_work1,
+                                        size_work2, size_work3, size_work4, optim_mem);
+}
+
+template <typename T>
+rocblas_status rocsolver_getrs_ooc_template(rocblas_handle handle,
+                                            const rocblas_operation trans,
+                                            const rocblas_int n,
+                                            const rocblas_int nrhs,
+                                            const T* A,
+                                            const rocblas_int lda,
+                                            const rocblas_int* ipiv,
+                                            T* B,
+                                            const rocblas_int ldb,
+                                            T* W,
+                                            void* work1,
+                                            void* work2,
+                                            void* work3,
+                                            void* work4,
+                                            const bool optim_mem)
+{
+    ROCSOLVER_ENTER("getrs_ooc", "trans:", trans, "n:", n, "nrhs:", nrhs, "lda:", lda,
+                    "ldb:", ldb);
+
+    // quick return
+    if(n == 0 || nrhs == 0)
+        return rocblas_status_success;
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    rocsolver_ooc_window<T> win;
+    ROCBLAS_CHECK(win.init(handle, W, n, std::min(rocblas_int(OOC_BLOCKSIZE), n)));
+
+    if(trans == rocblas_operation_none)
+    {
+        // first apply row interchanges to the right hand sides
+        rocsolver_laswp_template<T>(handle, nrhs, B, 0, 1, ldb, 0, 1, n, ipiv, 0, 1, 0, 1);
+
+        // solve L*X = B and U*X = B, overwriting B with X
+        ROCBLAS_CHECK(rocsolver_ooc_trsm(handle, win, rocblas_fill_lower, trans,
+                                         rocblas_diagonal_unit, n, nrhs, A, lda, B, ldb, work1,
+                                         work2, work3, work4, optim_mem));
+        ROCBLAS_CHECK(rocsolver_ooc_trsm(handle, win, rocblas_fill_upper, trans,
+                                         rocblas_diagonal_non_unit, n, nrhs, A, lda, B, ldb, work1,
+                                         work2, work3, work4, optim_mem));
+    }
+    else
+    {
+        // solve U'*X = B and L'*X = B (or U**H and L**H), overwriting B with X
+        ROCBLAS_CHECK(rocsolver_ooc_trsm(handle, win, rocblas_fill_upper, trans,
+                                         rocblas_diagonal_non_unit, n, nrhs, A, lda, B, ldb, work1,
+                                         work2, work3, work4, optim_mem));
+        ROCBLAS_CHECK(rocsolver_ooc_trsm(handle, win, rocblas_fill_lower, trans,
+                                         rocblas_diagonal_unit, n, nrhs, A, lda, B, ldb, work1,
+                                         work2, work3, work4, optim_mem));
+
+        // then apply row interchanges to the solution vectors
+        rocsolver_laswp_template<T>(handle, nrhs, B, 0, 1, ldb, 0, 1, n, ipiv, 0, -1, 0, 1);
+    }
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
+
+template <typename T>
+rocblas_status rocsolver_potrs_ooc_template(rocblas_handle handle,
+                                            const rocblas_fill uplo,
+                                            const rocblas_int n,
+                                            const rocblas_int nrhs,
+                                            const T* A,
+                                            const rocblas_int lda,
+                                            T* B,
+                                            const rocblas_int ldb,
+                                            T* W,
+                                            void* work1,
+                                            void* work2,
+                                            void* work3,
+                                            void* work4,
+                                            const bool optim_mem)
+{
+    ROCSOLVER_ENTER("potrs_ooc", "uplo:", uplo, "n:", n, "nrhs:", nrhs, "lda:", lda, "ldb:", ldb);
+
+    // quick return
+    if(n == 0 || nrhs == 0)
+        return rocblas_status_success;
+
+    // everything must be executed with scalars on the host
+    rocblas_pointer_mode old_mode;
+    rocblas_get_pointer_mode(handle, &old_mode);
+    rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+    rocsolver_ooc_window<T> win;
+    ROCBLAS_CHECK(win.init(handle, W, n, std::min(rocblas_int(OOC_BLOCKSIZE), n)));
+
+    // solve L*L**H*X = B or U**H*U*X = B, overwriting B with X
+    const rocblas_operation first
+        = (uplo == rocblas_fill_lower ? rocblas_operation_none
+                                      : rocblas_operation_conjugate_transpose);
+    const rocblas_operation second
+        = (uplo == rocblas_fill_lower ? rocblas_operation_conjugate_transpose
+                                      : rocblas_operation_none);
+    ROCBLAS_CHECK(rocsolver_ooc_trsm(handle, win, uplo, first, rocblas_diagonal_non_unit, n, nrhs,
+                                     A, lda, B, ldb, work1, work2, work3, work4, optim_mem));
+    ROCBLAS_CHECK(rocsolver_ooc_trsm(handle, win, uplo, second, rocblas_diagonal_non_unit, n, nrhs,
+                                     A, lda, B, ldb, work1, work2, work3, work4, optim_mem));
+
+    rocblas_set_pointer_mode(handle, old_mode);
+    return rocblas_status_success;
+}
@@ -0,0 +1,253 @@
+/*****************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "lapack_device_functions.hpp"
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_handle_state.hpp"
+
+/** PBTRF_KERNEL computes the Cholesky factorization of one Hermitian positive definite band
+    matrix per thread block. The (kd+1)-by-(kd+1) window of the band affected by each step is
+    kept in the LDS (if use_lds is true), reusing its columns circularly as the factorization
+    advances; the columns leaving the window are written back to global memory. Otherwise,
+    the kernel works directly on the band storage in global memory. **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BAND_BLOCKSIZE)
+    pbtrf_kernel(const rocblas_fill uplo,
+                 const rocblas_int n,
+                 const rocblas_int kd,
+                 U AA,
+                 const rocblas_int shiftA,
+                 const rocblas_int lda,
+                 const rocblas_stride strideA,
+                 rocblas_int* infoA,
+                 const bool use_lds)
+{
+    rocblas_int bid = hipBlockIdx_x;
+    rocblas_int tid = hipThreadIdx_x;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+
+    // shared memory setup
+    extern __shared__ double lmem[];
+    T* W = reinterpret_cast<T*>(lmem);
+
+    // element (i,c) of the matrix is stored in position kd+i-c (upper) or i-c (lower)
+    // of column c
+    const bool upper = (uplo == rocblas_fill_upper);
+    const rocblas_int nw = kd + 1;
+    const rocblas_int diag = upper ? kd : 0;
+
+    // returns the position of column c of the band in the window
+    auto col = [&](rocblas_int c) { return use_lds ? W + (c % nw) * nw : A + c * lda; };
+
+    // returns the position of element (i,c) in the window
+    auto elem = [&](rocblas_int i, rocblas_int c) { return col(c) + diag + i - c; };
+
+    // brings column c into the window
+    auto load_col = [&](rocblas_int c) {
+        T* w = col(c);
+        for(rocblas_int r = tid; r < nw; r += BAND_BLOCKSIZE)
+        {
+            rocblas_int i = r - diag + c;
+            if(i >= 0 && i < n)
+                w[r] = A[r + c * lda];
+        }
+    };
+
+    // writes column c of the window back to global memory
+    auto store_col = [&](rocblas_int c) {
+        T* w = col(c);
+        for(rocblas_int r = tid; r < nw; r += BAND_BLOCKSIZE)
+        {
+            rocblas_int i = r - diag + c;
+            if(i >= 0 && i < n)
+                A[r + c * lda] = w[r];
+        }
+    };
+
+    if(use_lds)
+    {
+        for(rocblas_int c = 0; c < std::min(nw, n); c++)
+            load_col(c);
+        __syncthreads();
+    }
+
+    rocblas_int j = 0;
+    rocblas_int myinfo = 0;
+
+    for(; j < n; j++)
+    {
+        T* wj = elem(j, j);
+
+        // compute the diagonal element and check for positive definiteness
+        auto ajj = std::real(*wj);
+        if(ajj <= 0)
+        {
+            myinfo = j + 1; // use fortran 1-based index
+            break;
+        }
+        ajj = sqrt(ajj);
+        __syncthreads();
+
+        if(tid == 0)
+            *wj = ajj;
+
+        // compute the elements of the j-th row of U (or column of L)
+        rocblas_int kn = std::min(kd, n - 1 - j);
+        for(rocblas_int i = tid; i < kn; i += BAND_BLOCKSIZE)
+        {
+            T* a = upper ? elem(j, j + 1 + i) : elem(j + 1 + i, j);
+            *a = *a / ajj;
+        }
+        __syncthreads();
+
+        // update trailing part of the window
+        for(rocblas_int k = tid; k < kn * kn; k += BAND_BLOCKSIZE)
+        {
+            rocblas_int r = j + 1 + k % kn;
+            rocblas_int c = j + 1 + k / kn;
+            if(upper && r <= c)
+                *elem(r, c) -= conj(*elem(j, r)) * *elem(j, c);
+            else if(!upper && r >= c)
+                *elem(r, c) -= *elem(r, j) * conj(*elem(c, j));
+        }
+        __syncthreads();
+
+        // slide the window: column j is final and column j+kd+1 is brought in
+        if(use_lds)
+        {
+            store_col(j);
+            if(j + nw < n)
+            {
+                __syncthreads();
+                load_col(j + nw);
+            }
+            __syncthreads();
+        }
+    }
+
+    // write back the columns remaining in the window
+    if(use_lds)
+    {
+        for(rocblas_int c = j; c < std::min(j + nw, n); c++)
+            store_col(c);
+    }
+
+    if(tid == 0)
+        infoA[bid] = myinfo;
+}
+
+/** PBTRF_LDS_SIZE returns the size in bytes of the window of the band kept in the LDS by
+    PBTRF_KERNEL, or 0 if it does not fit in the LDS of the given architecture. **/
+template <typename T>
+size_t rocsolver_pbtrf_lds_size(const rocblas_int kd, const rocsolver_arch_info& arch)
+{
+    size_t size = sizeof(T) * size_t(kd + 1) * (kd + 1);
+    return (size <= size_t(arch.lds_size)) ? size : 0;
+}
+
+template <typename T>
+rocblas_status rocsolver_pbtrf_argCheck(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        const rocblas_int kd,
+                                        const rocblas_int lda,
+                                        T A,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    if(n < 0 || kd < 0 || lda < kd + 1 || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !A) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_pbtrf_template(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        const rocblas_int kd,
+                                        U A,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("pbtrf", "uplo:", uplo, "n:", n, "kd:", kd, "shiftA:", shiftA, "lda:", lda,
+                    "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // quick return if no dimensions
+    if(n == 0)
+    {
+        rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(blocks, 1, 1), dim3(BS1, 1, 1), 0, stream, info,
+                                batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    // the window is kept in the LDS when it fits
+    const rocsolver_arch_info arch = rocsolver_handle_state_map::get_arch(handle);
+    size_t lmemsize = rocsolver_pbtrf_lds_size<T>(kd, arch);
+
+    ROCSOLVER_LAUNCH_KERNEL(pbtrf_kernel<T>, dim3(batch_count, 1, 1), dim3(BAND_BLOCKSIZE, 1, 1),
+                            lmemsize, stream, uplo, n, kd, A, shiftA, lda, strideA, info,
+                            lmemsize > 0);
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,124 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_pbtrf.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_pbtrf_batched_impl(rocblas_handle handle,
+                                            const rocblas_fill uplo,
+                                            const rocblas_int n,
+                                            const rocblas_int kd,
+                                            U A,
+                                            const rocblas_int lda,
+                                            rocblas_int* info,
+                                            const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("pbtrf_batched", "--uplo", uplo, "-n", n, "--kd", kd, "--lda", lda,
+                        "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_pbtrf_argCheck(handle, uplo, n, kd, lda, A, info, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // working with unshifted arrays
+    rocblas_int shiftA = 0;
+
+    // batched execution
+    rocblas_stride strideA = 0;
+
+    // this function does not require memory work space
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_size_unchanged;
+
+    // execution
+    return rocsolver_pbtrf_template<T>(handle, uplo, n, kd, A, shiftA, lda, strideA, info,
+                                       batch_count);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_spbtrf_batched(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        const rocblas_int kd,
+                                        float* const A[],
+                                        const rocblas_int lda,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver_pbtrf_batched_impl<float>(handle, uplo, n, kd, A, lda, info, batch_count);
+}
+
+rocblas_status rocsolver_dpbtrf_batched(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        const rocblas_int kd,
+                                        double* const A[],
+                                        const rocblas_int lda,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver_pbtrf_batched_impl<double>(handle, uplo, n, kd, A, lda, info, batch_count);
+}
+
+rocblas_status rocsolver_cpbtrf_batched(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        const rocblas_int kd,
+                                        rocblas_float_complex* const A[],
+                                        const rocblas_int lda,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver_pbtrf_batched_impl<rocblas_float_complex>(handle, uplo, n, kd, A, lda, info,
+                                                               batch_count);
+}
+
+rocblas_status rocsolver_zpbtrf_batched(rocblas_handle handle,
+                                        const rocblas_fill uplo,
+                                        const rocblas_int n,
+                                        const rocblas_int kd,
+                                        rocblas_double_complex* const A[],
+                                        const rocblas_int lda,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count)
+{
+    return rocsolver_pbtrf_batched_impl<rocblas_double_complex>(handle, uplo, n, kd, A, lda, info,
+                                                                batch_count);
+}
+
+} // extern C
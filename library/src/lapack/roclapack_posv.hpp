@@ -81,10 +81,11 @@ void rocsolver_posv_getMemorySize(const rocblas_int n,
                                   size_t* size_work4,
                                   size_t* size_pivots_savedB,
                                   size_t* size_iinfo,
-                                  bool* optim_mem)
+                                  bool* optim_mem,
+                                  const rocsolver_arch_info* arch = nullptr)
 {
-    // if quick return, no workspace is needed
-    if(n == 0 || nrhs == 0 || batch_count == 0)
+    // if quick return or using the small-size kernel, no workspace is needed
+    if(n == 0 || nrhs == 0 || batch_count == 0 || rocsolver_potf2_use_small<T>(n, arch))
     {
         *size_scalars = 0;
         *size_work1 = 0;
@@ -150,6 +151,13 @@ rocblas_status rocsolver_posv_template(rocblas_handle handle,
     if(batch_count == 0)
         return rocblas_status_success;
 
+    // small-size case: factorize and solve in a single kernel
+    // (the kernel sets info, and B is only updated if A is positive definite)
+    const rocsolver_arch_info arch = rocsolver_handle_state_map::get_arch(handle);
+    if(n > 0 && nrhs > 0 && rocsolver_potf2_use_small<T>(n, &arch))
+        return posv_run_small<T>(handle, uplo, n, nrhs, A, shiftA, lda, strideA, B, shiftB, ldb,
+                                 strideB, info, batch_count);
+
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
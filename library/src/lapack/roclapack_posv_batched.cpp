@@ -69,12 +69,15 @@ rocblas_status rocsolver_posv_batched_impl(rocblas_handle handle,
     size_t size_work1, size_work2, size_work3, size_work4;
     // extra requirements for calling POTRF and to copy B
     size_t size_pivots_savedB, size_iinfo;
+    // (the selection of the kernels depends on the device architecture)
+    const rocsolver_arch_info arch = rocsolver_handle_state_map::get_arch(handle);
     rocsolver_posv_getMemorySize<true, false, T>(n, nrhs, uplo, batch_count, &size_scalars,
                                                  &size_work1, &size_work2, &size_work3, &size_work4,
-                                                 &size_pivots_savedB, &size_iinfo, &optim_mem);
+                                                 &size_pivots_savedB, &size_iinfo, &optim_mem,
+                                                 &arch);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work1, size_work2,
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_scalars, size_work1, size_work2,
                                                       size_work3, size_work4, size_pivots_savedB,
                                                       size_iinfo);
 
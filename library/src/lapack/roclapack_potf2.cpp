@@ -59,10 +59,13 @@ rocblas_status rocsolver_potf2_impl(rocblas_handle handle,
     size_t size_work;
     // size to store pivots in intermediate computations
     size_t size_pivots;
-    rocsolver_potf2_getMemorySize<T>(n, batch_count, &size_scalars, &size_work, &size_pivots);
+    // (the selection of the kernels depends on the device architecture)
+    const rocsolver_arch_info arch = rocsolver_handle_state_map::get_arch(handle);
+    rocsolver_potf2_getMemorySize<T>(n, batch_count, &size_scalars, &size_work, &size_pivots,
+                                     &arch);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work, size_pivots);
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_scalars, size_work, size_pivots);
 
     // memory workspace allocation
     void *scalars, *work, *pivots;
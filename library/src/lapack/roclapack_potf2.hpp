@@ -35,16 +35,17 @@
 #include "auxiliary/rocauxiliary_lacgv.hpp"
 #include "rocblas.hpp"
 #include "rocsolver/rocsolver.h"
+#include "rocsolver_handle_state.hpp"
 #include "rocsolver_run_specialized_kernels.hpp"
 
-template <typename T, typename U, std::enable_if_t<!rocblas_is_complex<T>, int> = 0>
+template <typename T, typename I, typename U, std::enable_if_t<!rocblas_is_complex<T>, int> = 0>
 ROCSOLVER_KERNEL void sqrtDiagOnward(U A,
-                                     const rocblas_int shiftA,
-                                     const rocblas_int strideA,
+                                     const rocblas_stride shiftA,
+                                     const rocblas_stride strideA,
                                      const size_t loc,
-                                     const rocblas_int j,
+                                     const I j,
                                      T* res,
-                                     rocblas_int* info)
+                                     I* info)
 {
     int id = hipBlockIdx_x;
 
@@ -68,14 +69,14 @@ ROCSOLVER_KERNEL void sqrtDiagOnward(U A,
     }
 }
 
-template <typename T, typename U, std::enable_if_t<rocblas_is_complex<T>, int> = 0>
+template <typename T, typename I, typename U, std::enable_if_t<rocblas_is_complex<T>, int> = 0>
 ROCSOLVER_KERNEL void sqrtDiagOnward(U A,
-                                     const rocblas_int shiftA,
-                                     const rocblas_int strideA,
+                                     const rocblas_stride shiftA,
+                                     const rocblas_stride strideA,
                                      const size_t loc,
-                                     const rocblas_int j,
+                                     const I j,
                                      T* res,
-                                     rocblas_int* info)
+                                     I* info)
 {
     int id = hipBlockIdx_x;
 
@@ -99,12 +100,23 @@ ROCSOLVER_KERNEL void sqrtDiagOnward(U A,
     }
 }
 
-template <typename T>
-void rocsolver_potf2_getMemorySize(const rocblas_int n,
-                                   const rocblas_int batch_count,
+/** POTF2_USE_SMALL returns true if the n-by-n matrix can be factorized with the specialized
+    kernel, which keeps the packed triangular part of the matrix in the LDS. If the architecture
+    is not given, the general algorithm is assumed (so that enough workspace is reserved). **/
+template <typename T, typename I>
+bool rocsolver_potf2_use_small(const I n, const rocsolver_arch_info* arch)
+{
+    return arch && n <= POTF2_MAX_SMALL_SIZE(T)
+        && sizeof(T) * n * (n + 1) / 2 <= size_t(arch->lds_size);
+}
+
+template <typename T, typename I>
+void rocsolver_potf2_getMemorySize(const I n,
+                                   const I batch_count,
                                    size_t* size_scalars,
                                    size_t* size_work,
-                                   size_t* size_pivots)
+                                   size_t* size_pivots,
+                                   const rocsolver_arch_info* arch = nullptr)
 {
     // if quick return no need of workspace
     if(n == 0 || batch_count == 0)
@@ -118,7 +130,7 @@ void rocsolver_potf2_getMemorySize(const rocblas_int n,
     // size of scalars (constants)
     *size_scalars = sizeof(T) * 3;
 
-    if(n <= POTF2_MAX_SMALL_SIZE(T))
+    if(rocsolver_potf2_use_small<T>(n, arch))
     {
         *size_work = 0;
         *size_pivots = 0;
@@ -134,14 +146,14 @@ void rocsolver_potf2_getMemorySize(const rocblas_int n,
     *size_pivots = sizeof(T) * batch_count;
 }
 
-template <typename T>
+template <typename T, typename I>
 rocblas_status rocsolver_potf2_potrf_argCheck(rocblas_handle handle,
                                               const rocblas_fill uplo,
-                                              const rocblas_int n,
-                                              const rocblas_int lda,
+                                              const I n,
+                                              const I lda,
                                               T A,
-                                              rocblas_int* info,
-                                              const rocblas_int batch_count = 1)
+                                              I* info,
+                                              const I batch_count = 1)
 {
     // order is important for unit tests:
 
@@ -164,19 +176,20 @@ rocblas_status rocsolver_potf2_potrf_argCheck(rocblas_handle handle,
     return rocblas_status_continue;
 }
 
-template <typename T, typename U, bool COMPLEX = rocblas_is_complex<T>>
+template <typename T, typename I, typename U, bool COMPLEX = rocblas_is_complex<T>>
 rocblas_status rocsolver_potf2_template(rocblas_handle handle,
                                         const rocblas_fill uplo,
-                                        const rocblas_int n,
+                                        const I n,
                                         U A,
-                                        const rocblas_int shiftA,
-                                        const rocblas_int lda,
+                                        const rocblas_stride shiftA,
+                                        const I lda,
                                         const rocblas_stride strideA,
-                                        rocblas_int* info,
-                                        const rocblas_int batch_count,
+                                        I* info,
+                                        const I batch_count,
                                         T* scalars,
                                         T* work,
-                                        T* pivots)
+                                        T* pivots,
+                                        const I* skip = nullptr)
 {
     ROCSOLVER_ENTER("potf2", "uplo:", uplo, "n:", n, "shiftA:", shiftA, "lda:", lda,
                     "bc:", batch_count);
@@ -188,7 +201,7 @@ rocblas_status rocsolver_potf2_template(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+    I blocksReset = (batch_count - 1) / BS1 + 1;
     dim3 gridReset(blocksReset, 1, 1);
     dim3 threads(BS1, 1, 1);
 
@@ -204,12 +217,13 @@ rocblas_status rocsolver_potf2_template(rocblas_handle handle,
     rocblas_get_pointer_mode(handle, &old_mode);
     rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device);
 
-    if(n <= POTRF_BLOCKSIZE(T))
+    const rocsolver_arch_info arch = rocsolver_handle_state_map::get_arch(handle);
+    if(rocsolver_potf2_use_small<T>(n, &arch))
     {
         // ----------------------
         // use specialized kernel
         // ----------------------
-        potf2_run_small<T>(handle, uplo, n, A, shiftA, lda, strideA, info, batch_count);
+        potf2_run_small<T, I>(handle, uplo, n, A, shiftA, lda, strideA, info, batch_count, skip);
     }
     else
     {
@@ -220,15 +234,16 @@ rocblas_status rocsolver_potf2_template(rocblas_handle handle,
         if(uplo == rocblas_fill_upper)
         {
             // Compute the Cholesky factorization A = U'*U.
-            for(rocblas_int j = 0; j < n; ++j)
+            for(I j = 0; j < n; ++j)
             {
                 // Compute U(J,J) and test for non-positive-definiteness.
                 rocblasCall_dot<COMPLEX, T>(handle, j, A, shiftA + idx2D(0, j, lda), 1, strideA, A,
                                             shiftA + idx2D(0, j, lda), 1, strideA, batch_count,
                                             pivots, work);
 
-                ROCSOLVER_LAUNCH_KERNEL(sqrtDiagOnward<T>, dim3(batch_count), dim3(1), 0, stream, A,
-                                        shiftA, strideA, idx2D(j, j, lda), j, pivots, info);
+                ROCSOLVER_LAUNCH_KERNEL((sqrtDiagOnward<T, I>), dim3(batch_count), dim3(1), 0,
+                                        stream, A, shiftA, strideA, idx2D(j, j, lda), j, pivots,
+                                        info);
 
                 // Compute elements J+1:N of row J
                 if(j < n - 1)
@@ -255,15 +270,16 @@ rocblas_status rocsolver_potf2_template(rocblas_handle handle,
         else
         {
             // Compute the Cholesky factorization A = L'*L.
-            for(rocblas_int j = 0; j < n; ++j)
+            for(I j = 0; j < n; ++j)
             {
                 // Compute L(J,J) and test for non-positive-definiteness.
                 rocblasCall_dot<COMPLEX, T>(handle, j, A, shiftA + idx2D(j, 0, lda), lda, strideA,
                                             A, shiftA + idx2D(j, 0, lda), lda, strideA, batch_count,
                                             pivots, work);
 
-                ROCSOLVER_LAUNCH_KERNEL(sqrtDiagOnward<T>, dim3(batch_count), dim3(1), 0, stream, A,
-                                        shiftA, strideA, idx2D(j, j, lda), j, pivots, info);
+                ROCSOLVER_LAUNCH_KERNEL((sqrtDiagOnward<T, I>), dim3(batch_count), dim3(1), 0,
+                                        stream, A, shiftA, strideA, idx2D(j, j, lda), j, pivots,
+                                        info);
 
                 // Compute elements J+1:N of column J
                 if(j < n - 1)
@@ -283,7 +299,7 @@ rocblas_status rocsolver_potf2_template(rocblas_handle handle,
                                                     strideA, batch_count);
 
                     rocblasCall_scal<T>(handle, n - j - 1, pivots, 1, A,
-                                        shiftA + idx2D(j + 1, j, lda), 1, strideA, batch_count);
+                                        shiftA + idx2D(j + 1, j, lda), I(1), strideA, batch_count);
                 }
             }
         }
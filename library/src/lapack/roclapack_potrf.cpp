@@ -27,13 +27,13 @@
 
 #include "roclapack_potrf.hpp"
 
-template <typename T, typename U>
+template <typename T, typename I, typename U>
 rocblas_status rocsolver_potrf_impl(rocblas_handle handle,
                                     const rocblas_fill uplo,
-                                    const rocblas_int n,
+                                    const I n,
                                     U A,
-                                    const rocblas_int lda,
-                                    rocblas_int* info)
+                                    const I lda,
+                                    I* info)
 {
     ROCSOLVER_ENTER_TOP("potrf", "--uplo", uplo, "-n", n, "--lda", lda);
 
@@ -48,11 +48,11 @@ rocblas_status rocsolver_potrf_impl(rocblas_handle handle,
         return st;
 
     // working with unshifted arrays
-    rocblas_int shiftA = 0;
+    rocblas_stride shiftA = 0;
 
     // normal (non-batched non-strided) execution
     rocblas_stride strideA = 0;
-    rocblas_int batch_count = 1;
+    I batch_count = 1;
 
     // memory workspace sizes:
     // size for constants in rocblas calls
@@ -64,12 +64,17 @@ rocblas_status rocsolver_potrf_impl(rocblas_handle handle,
     size_t size_pivots;
     // size to store info about positiveness of each subblock
     size_t size_iinfo;
-    rocsolver_potrf_getMemorySize<false, false, T>(n, uplo, batch_count, &size_scalars, &size_work1,
-                                                   &size_work2, &size_work3, &size_work4,
-                                                   &size_pivots, &size_iinfo, &optim_mem);
+    // (the selection of the kernels depends on the device architecture)
+    const rocsolver_arch_info arch = rocsolver_handle_state_map::get_arch(handle);
+    const rocsolver_alg_mode mode
+        = rocsolver_handle_state_map::alg_mode(handle, rocsolver_function_potrf);
+    // (the workspace covers every mode, in case it changes after a size query)
+    rocsolver_potrf_getMemorySize_any_mode<false, false, T>(
+        n, uplo, batch_count, &size_scalars, &size_work1, &size_work2, &size_work3, &size_work4,
+        &size_pivots, &size_iinfo, &optim_mem, &arch, mode);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work1, size_work2,
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_scalars, size_work1, size_work2,
                                                       size_work3, size_work4, size_pivots,
                                                       size_iinfo);
 
@@ -94,7 +99,7 @@ rocblas_status rocsolver_potrf_impl(rocblas_handle handle,
     // execution
     return rocsolver_potrf_template<false, false, T, S>(
         handle, uplo, n, A, shiftA, lda, strideA, info, batch_count, (T*)scalars, work1, work2,
-        work3, work4, (T*)pivots, (rocblas_int*)iinfo, optim_mem);
+        work3, work4, (T*)pivots, (I*)iinfo, optim_mem, mode);
 }
 
 /*
@@ -144,4 +149,44 @@ rocblas_status rocsolver_zpotrf(rocblas_handle handle,
 {
     return rocsolver_potrf_impl<rocblas_double_complex>(handle, uplo, n, A, lda, info);
 }
+
+rocblas_status rocsolver_spotrf_64(rocblas_handle handle,
+                                   const rocblas_fill uplo,
+                                   const int64_t n,
+                                   float* A,
+                                   const int64_t lda,
+                                   int64_t* info)
+{
+    return rocsolver_potrf_impl<float>(handle, uplo, n, A, lda, info);
+}
+
+rocblas_status rocsolver_dpotrf_64(rocblas_handle handle,
+                                   const rocblas_fill uplo,
+                                   const int64_t n,
+                                   double* A,
+                                   const int64_t lda,
+                                   int64_t* info)
+{
+    return rocsolver_potrf_impl<double>(handle, uplo, n, A, lda, info);
+}
+
+rocblas_status rocsolver_cpotrf_64(rocblas_handle handle,
+                                   const rocblas_fill uplo,
+                                   const int64_t n,
+                                   rocblas_float_complex* A,
+                                   const int64_t lda,
+                                   int64_t* info)
+{
+    return rocsolver_potrf_impl<rocblas_float_complex>(handle, uplo, n, A, lda, info);
+}
+
+rocblas_status rocsolver_zpotrf_64(rocblas_handle handle,
+                                   const rocblas_fill uplo,
+                                   const int64_t n,
+                                   rocblas_double_complex* A,
+                                   const int64_t lda,
+                                   int64_t* info)
+{
+    return rocsolver_potrf_impl<rocblas_double_complex>(handle, uplo, n, A, lda, info);
+}
 }
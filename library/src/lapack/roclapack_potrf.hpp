@@ -35,43 +35,355 @@
 #include "rocblas.hpp"
 #include "roclapack_potf2.hpp"
 #include "rocsolver/rocsolver.h"
+#include "rocsolver_handle_state.hpp"
 #include "rocsolver_run_specialized_kernels.hpp"
 
-static rocblas_int get_lds_size()
+template <typename I>
+ROCSOLVER_KERNEL void chk_positive(I* iinfo, I* info, const I j, const I batch_count)
 {
-    rocblas_int const default_lds_size = 64 * 1024;
+    I id = hipBlockIdx_x * static_cast<I>(hipBlockDim_x) + hipThreadIdx_x;
 
-    int lds_size = 0;
-    int deviceId = 0;
-    auto istat_device = hipGetDevice(&deviceId);
-    if(istat_device != hipSuccess)
+    if(id < batch_count && info[id] == 0 && iinfo[id] > 0)
+        info[id] = iinfo[id] + j;
+}
+
+/** Returns the info values of the problems whose diagonal blocks are not factorized anymore
+    (those already found not positive definite) if early abort is enabled for the handle,
+    or null otherwise. **/
+template <typename I>
+const I* potrf_skip(rocblas_handle handle, const I* info)
+{
+    return rocsolver_handle_state_map::early_abort_enabled(handle) ? info : nullptr;
+}
+
+/** Factorizes the jb x jb diagonal block at shiftA, which starts at column j of the matrix, and
+    updates info with the problems found not to be positive definite. (iinfo is reset by
+    potf2.) **/
+template <typename T, typename I, typename U>
+void potrf_factor_diag(rocblas_handle handle,
+                       const rocblas_fill uplo,
+                       const I j,
+                       const I jb,
+                       U A,
+                       const rocblas_stride shiftA,
+                       const I lda,
+                       const rocblas_stride strideA,
+                       I* info,
+                       const I batch_count,
+                       T* scalars,
+                       void* work1,
+                       T* pivots,
+                       I* iinfo,
+                       const I* skip)
+{
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    I blocksReset = (batch_count - 1) / BS1 + 1;
+    dim3 gridReset(blocksReset, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    rocsolver_potf2_template<T>(handle, uplo, jb, A, shiftA, lda, strideA, iinfo, batch_count,
+                                scalars, (T*)work1, pivots, skip);
+    ROCSOLVER_LAUNCH_KERNEL(chk_positive<I>, gridReset, threads, 0, stream, iinfo, info, j,
+                            batch_count);
+}
+
+/*************************************************************
+    Persistent tile-DAG kernel
+*************************************************************/
+
+/** POTRF_PERSISTENT_TASK decodes the index t of a task of the tile DAG of a matrix with nt
+    tile columns. The tasks of step k are enumerated in order: the factorization of the diagonal
+    tile (k,k), the triangular solves of the tiles (i,k) with i > k, and the updates of the
+    trailing tiles (i,j) with i >= j > k, column by column. On return, i == j == k identifies a
+    factorization, j == k < i a triangular solve, and j > k an update. **/
+__device__ void potrf_persistent_task(rocblas_int t,
+                                      const rocblas_int nt,
+                                      rocblas_int& k,
+                                      rocblas_int& i,
+                                      rocblas_int& j)
+{
+    k = 0;
+    rocblas_int m = nt - 1;
+    while(t >= 1 + m + m * (m + 1) / 2)
     {
-        return (default_lds_size);
-    };
-    auto const attr = hipDeviceAttributeMaxSharedMemoryPerBlock;
-    auto istat_attr = hipDeviceGetAttribute(&lds_size, attr, deviceId);
-    if(istat_attr != hipSuccess)
+        t -= 1 + m + m * (m + 1) / 2;
+        k++;
+        m--;
+    }
+
+    if(t <= m)
     {
-        return (default_lds_size);
-    };
+        i = k + t;
+        j = k;
+    }
+    else
+    {
+        t -= m + 1;
+        j = k + 1;
+        while(t >= nt - j)
+        {
+            t -= nt - j;
+            j++;
+        }
+        i = j + t;
+    }
+}
+
+/** POTRF_PERSISTENT_WAIT spins until the dependency counter cnt reaches the value v **/
+__device__ void potrf_persistent_wait(rocblas_int* cnt, const rocblas_int v)
+{
+    while(atomicAdd(cnt, 0) < v)
+        ;
+}
+
+/** POTRF_PERSISTENT_LOAD copies the mi x mj tile with top-left element (i0,j0) of the lower
+    triangular factor L into the shared array tile (with leading dimension NB). When uplo is upper,
+    L is the conjugate transpose of the upper triangular part of A. **/
+template <rocblas_int NB, typename T>
+__device__ void potrf_persistent_load(const rocblas_fill uplo,
+                                      const rocblas_int mi,
+                                      const rocblas_int mj,
+                                      T* A,
+                                      const rocblas_stride lda,
+                                      const rocblas_int i0,
+                                      const rocblas_int j0,
+                                      T* tile)
+{
+    const bool lower = (uplo == rocblas_fill_lower);
+    for(rocblas_int s = hipThreadIdx_y; s < NB; s += hipBlockDim_y)
+    {
+        // consecutive threads access consecutive elements of A
+        rocblas_int r = lower ? hipThreadIdx_x : s;
+        rocblas_int c = lower ? s : hipThreadIdx_x;
+        if(r < mi && c < mj)
+            tile[r + c * NB]
+                = lower ? A[(i0 + r) + (j0 + c) * lda] : conj(A[(j0 + c) + (i0 + r) * lda]);
+    }
+}
 
-    return (lds_size);
+/** POTRF_PERSISTENT_STORE is the inverse of POTRF_PERSISTENT_LOAD. If diag is true, only the
+    lower triangular part of the tile is written back. **/
+template <rocblas_int NB, typename T>
+__device__ void potrf_persistent_store(const rocblas_fill uplo,
+                                       const rocblas_int mi,
+                                       const rocblas_int mj,
+                                       T* A,
+                                       const rocblas_stride lda,
+                                       const rocblas_int i0,
+                                       const rocblas_int j0,
+                                       T* tile,
+                                       const bool diag)
+{
+    const bool lower = (uplo == rocblas_fill_lower);
+    for(rocblas_int s = hipThreadIdx_y; s < NB; s += hipBlockDim_y)
+    {
+        rocblas_int r = lower ? hipThreadIdx_x : s;
+        rocblas_int c = lower ? s : hipThreadIdx_x;
+        if(r < mi && c < mj && (!diag || r >= c))
+        {
+            if(lower)
+                A[(i0 + r) + (j0 + c) * lda] = tile[r + c * NB];
+            else
+                A[(j0 + c) + (i0 + r) * lda] = conj(tile[r + c * NB]);
+        }
+    }
 }
 
-template <typename U>
-ROCSOLVER_KERNEL void
-    chk_positive(rocblas_int* iinfo, rocblas_int* info, int j, rocblas_int batch_count)
+/** POTRF_PERSISTENT_KERNEL computes the Cholesky factorization of a single matrix with a fixed
+    number of thread-blocks that dequeue the tasks of the tile DAG in topological order.
+    Before executing a task, the block waits until the counters of the tiles involved indicate that
+    all the preceding operations on them have completed; the counter of the tile (i,j) is increased
+    after each update, and once more after its factorization or triangular solve. As every task only
+    depends on tasks with lower indices, which have already been dequeued by running blocks, the
+    kernel cannot deadlock regardless of the number of resident blocks.
+
+    The work array must be initialized to zero. It contains the head of the task queue, the step
+    at which the matrix was found not to be positive definite (plus one), and the nt x nt tile
+    counters. Tasks of later steps are skipped once a diagonal tile fails to factorize. **/
+template <typename T, typename I, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(POTRF_PERSISTENT_TILE * POTRF_PERSISTENT_TILE / 4)
+    potrf_persistent_kernel(const rocblas_fill uplo,
+                            const I n,
+                            U AA,
+                            const rocblas_stride shiftA,
+                            const I lda,
+                            const rocblas_stride strideA,
+                            I* info,
+                            rocblas_int* work)
 {
-    int id = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    using S = decltype(std::real(T{}));
+    constexpr rocblas_int NB = POTRF_PERSISTENT_TILE;
 
-    if(id < batch_count && info[id] == 0 && iinfo[id] > 0)
-        info[id] = iinfo[id] + j;
+    const rocblas_int tx = hipThreadIdx_x;
+    const rocblas_int ty = hipThreadIdx_y;
+    const rocblas_int dy = hipBlockDim_y;
+    const rocblas_int tid = tx + ty * NB;
+    const bool lower = (uplo == rocblas_fill_lower);
+
+    // batch_count = 1
+    T* A = load_ptr_batch<T>(AA, 0, shiftA, strideA);
+
+    const rocblas_int nt = (n - 1) / NB + 1;
+    const rocblas_int ntasks = nt + nt * (nt - 1) / 2 + (nt - 1) * nt * (nt + 1) / 6;
+    rocblas_int* next = work;
+    rocblas_int* failed = work + 1;
+    rocblas_int* cnt = work + 2;
+
+    // shared memory setup
+    extern __shared__ double lmem[];
+    T* tA = reinterpret_cast<T*>(lmem);
+    T* tB = tA + NB * NB;
+    __shared__ rocblas_int task, skip;
+
+    while(true)
+    {
+        if(tid == 0)
+            task = atomicAdd(next, 1);
+        __syncthreads();
+        const rocblas_int t = task;
+        if(t >= ntasks)
+            break;
+
+        rocblas_int k, i, j;
+        potrf_persistent_task(t, nt, k, i, j);
+        const rocblas_int mi = std::min(I(NB), n - i * NB);
+        const rocblas_int mj = std::min(I(NB), n - j * NB);
+
+        // wait for the dependencies of the task
+        if(tid == 0)
+        {
+            potrf_persistent_wait(cnt + i + j * nt, k);
+            if(j == k && i > k)
+                potrf_persistent_wait(cnt + k + k * nt, k + 1);
+            if(j > k)
+            {
+                potrf_persistent_wait(cnt + i + k * nt, k + 1);
+                potrf_persistent_wait(cnt + j + k * nt, k + 1);
+            }
+            __threadfence();
+            skip = atomicAdd(failed, 0);
+            skip = (skip > 0 && k >= skip);
+        }
+        __syncthreads();
+
+        if(!skip && i == k)
+        {
+            // factorize the diagonal tile
+            potrf_persistent_load<NB>(uplo, mi, mi, A, lda, k * NB, k * NB, tA);
+            __syncthreads();
+
+            for(rocblas_int c = 0; c < mi; c++)
+            {
+                S akk = std::real(tA[c + c * NB]);
+                if(akk <= 0 || std::isnan(akk))
+                {
+                    if(tid == 0)
+                    {
+                        *info = k * NB + c + 1;
+                        *failed = k + 1;
+                    }
+                    break;
+                }
+
+                // all threads must have read akk before it is overwritten
+                akk = std::sqrt(akk);
+                __syncthreads();
+                if(ty == 0 && tx >= c && tx < mi)
+                    tA[tx + c * NB] = (tx == c) ? T(akk) : tA[tx + c * NB] / akk;
+                __syncthreads();
+
+                for(rocblas_int q = c + 1 + ty; q < mi; q += dy)
+                {
+                    if(tx >= q && tx < mi)
+                        tA[tx + q * NB] -= tA[tx + c * NB] * conj(tA[q + c * NB]);
+                }
+                __syncthreads();
+            }
+
+            potrf_persistent_store<NB>(uplo, mi, mi, A, lda, k * NB, k * NB, tA, true);
+        }
+        else if(!skip && j == k)
+        {
+            // triangular solve X * L(k,k)' = A(i,k)
+            potrf_persistent_load<NB>(uplo, NB, NB, A, lda, k * NB, k * NB, tA);
+            potrf_persistent_load<NB>(uplo, mi, NB, A, lda, i * NB, k * NB, tB);
+            __syncthreads();
+
+            for(rocblas_int c = 0; c < NB; c++)
+            {
+                if(ty == 0 && tx < mi)
+                    tB[tx + c * NB] = tB[tx + c * NB] / conj(tA[c + c * NB]);
+                __syncthreads();
+
+                for(rocblas_int q = c + 1 + ty; q < NB; q += dy)
+                {
+                    if(tx < mi)
+                        tB[tx + q * NB] -= tB[tx + c * NB] * conj(tA[q + c * NB]);
+                }
+                __syncthreads();
+            }
+
+            potrf_persistent_store<NB>(uplo, mi, NB, A, lda, i * NB, k * NB, tB, false);
+        }
+        else if(!skip)
+        {
+            // trailing update A(i,j) = A(i,j) - L(i,k) * L(j,k)'
+            potrf_persistent_load<NB>(uplo, mi, NB, A, lda, i * NB, k * NB, tA);
+            potrf_persistent_load<NB>(uplo, mj, NB, A, lda, j * NB, k * NB, tB);
+            __syncthreads();
+
+            for(rocblas_int s = ty; s < NB; s += dy)
+            {
+                rocblas_int r = lower ? tx : s;
+                rocblas_int c = lower ? s : tx;
+                if(r < mi && c < mj && (i != j || r >= c))
+                {
+                    T sum = 0;
+                    for(rocblas_int p = 0; p < NB; p++)
+                        sum += tA[r + p * NB] * conj(tB[c + p * NB]);
+
+                    if(lower)
+                        A[(i * NB + r) + (j * NB + c) * rocblas_stride(lda)] -= sum;
+                    else
+                        A[(j * NB + c) + (i * NB + r) * rocblas_stride(lda)] -= conj(sum);
+                }
+            }
+        }
+
+        // release the tile
+        __threadfence();
+        __syncthreads();
+        if(tid == 0)
+            atomicAdd(cnt + i + j * nt, 1);
+    }
 }
 
-template <bool BATCHED, bool STRIDED, typename T>
-void rocsolver_potrf_getMemorySize(const rocblas_int n,
+/** Returns true if POTRF uses the persistent kernel for the given size. The persistent mode
+    forces it for any single matrix whose tasks can be numbered with 32-bit integers. **/
+template <typename T, typename I>
+bool rocsolver_potrf_use_persistent(const I n,
+                                    const I batch_count,
+                                    const rocsolver_alg_mode mode = rocsolver_alg_mode_default)
+{
+    if(batch_count != 1 || n <= POTRF_POTF2_SWITCHSIZE(T))
+        return false;
+
+    if(mode == rocsolver_alg_mode_persistent)
+    {
+        int64_t nt = (int64_t(n) - 1) / POTRF_PERSISTENT_TILE + 1;
+        return nt * nt * (nt + 6) / 6 < INT_MAX;
+    }
+
+    return mode == rocsolver_alg_mode_default && n >= POTRF_PERSISTENT_MIN_SIZE
+        && n <= POTRF_PERSISTENT_MAX_SIZE;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename I>
+void rocsolver_potrf_getMemorySize(const I n,
                                    const rocblas_fill uplo,
-                                   const rocblas_int batch_count,
+                                   const I batch_count,
                                    size_t* size_scalars,
                                    size_t* size_work1,
                                    size_t* size_work2,
@@ -79,7 +391,9 @@ void rocsolver_potrf_getMemorySize(const rocblas_int n,
                                    size_t* size_work4,
                                    size_t* size_pivots,
                                    size_t* size_iinfo,
-                                   bool* optim_mem)
+                                   bool* optim_mem,
+                                   const rocsolver_arch_info* arch = nullptr,
+                                   const rocsolver_alg_mode mode = rocsolver_alg_mode_default)
 {
     // if quick return no need of workspace
     if(n == 0 || batch_count == 0)
@@ -95,27 +409,71 @@ void rocsolver_potrf_getMemorySize(const rocblas_int n,
         return;
     }
 
-    rocblas_int nb = POTRF_BLOCKSIZE(T);
-    if(n <= POTRF_POTF2_SWITCHSIZE(T))
+    I nb = POTRF_BLOCKSIZE(T);
+    if(rocsolver_potrf_use_persistent<T>(n, batch_count, mode))
+    {
+        // size of the task queue head, the failure flag and the tile counters
+        // of the persistent kernel
+        rocblas_int nt = (n - 1) / POTRF_PERSISTENT_TILE + 1;
+        *size_scalars = 0;
+        *size_work1 = 0;
+        *size_work2 = 0;
+        *size_work3 = 0;
+        *size_work4 = 0;
+        *size_pivots = 0;
+        *size_iinfo = sizeof(rocblas_int) * (2 + nt * nt);
+        *optim_mem = true;
+    }
+    else if(n <= POTRF_POTF2_SWITCHSIZE(T))
     {
         // requirements for calling a single POTF2
-        rocsolver_potf2_getMemorySize<T>(n, batch_count, size_scalars, size_work1, size_pivots);
+        rocsolver_potf2_getMemorySize<T>(n, batch_count, size_scalars, size_work1, size_pivots,
+                                         arch);
         *size_work2 = 0;
         *size_work3 = 0;
         *size_work4 = 0;
         *size_iinfo = 0;
         *optim_mem = true;
     }
+    else if(POTRF_RECURSIVE || mode == rocsolver_alg_mode_recursive)
+    {
+        // the largest trsm is executed at the first level of the recursion
+        I n1 = n / 2;
+        I jb = std::min(n, I(POTRF_RECURSIVE_MINSIZE(T)));
+        size_t s1, s2;
+
+        // size to store info about positiveness of each subblock
+        *size_iinfo = sizeof(I) * batch_count;
+
+        // requirements for calling POTF2 for the base cases
+        rocsolver_potf2_getMemorySize<T>(jb, batch_count, size_scalars, &s1, size_pivots, arch);
+
+        // extra requirements for calling TRSM
+        if(uplo == rocblas_fill_upper)
+        {
+            rocsolver_trsm_mem<BATCHED, STRIDED, T>(
+                rocblas_side_left, rocblas_operation_conjugate_transpose, n1, n - n1, batch_count,
+                &s2, size_work2, size_work3, size_work4, optim_mem);
+        }
+        else
+        {
+            rocsolver_trsm_mem<BATCHED, STRIDED, T>(
+                rocblas_side_right, rocblas_operation_conjugate_transpose, n - n1, n1, batch_count,
+                &s2, size_work2, size_work3, size_work4, optim_mem);
+        }
+
+        *size_work1 = std::max(s1, s2);
+    }
     else
     {
-        rocblas_int jb = nb;
+        I jb = nb;
         size_t s1, s2;
 
         // size to store info about positiveness of each subblock
-        *size_iinfo = sizeof(rocblas_int) * batch_count;
+        *size_iinfo = sizeof(I) * batch_count;
 
         // requirements for calling POTF2 for the subblocks
-        rocsolver_potf2_getMemorySize<T>(jb, batch_count, size_scalars, &s1, size_pivots);
+        rocsolver_potf2_getMemorySize<T>(jb, batch_count, size_scalars, &s1, size_pivots, arch);
 
         // extra requirements for calling TRSM
         if(uplo == rocblas_fill_upper)
@@ -135,24 +493,359 @@ void rocsolver_potrf_getMemorySize(const rocblas_int n,
     }
 }
 
-template <bool BATCHED, bool STRIDED, typename T, typename S, typename U>
+/** POTRF_GETMEMORYSIZE_ANY_MODE returns the workspace of POTRF as the maximum over all the
+    algorithms that can be selected with rocsolver_set_alg_mode, so that the sizes obtained
+    in a device memory size query remain valid if the mode of the handle changes before the
+    execution. optim_mem is the one of the given mode (the algorithm that will run). **/
+template <bool BATCHED, bool STRIDED, typename T, typename I>
+void rocsolver_potrf_getMemorySize_any_mode(const I n,
+                                            const rocblas_fill uplo,
+                                            const I batch_count,
+                                            size_t* size_scalars,
+                                            size_t* size_work1,
+                                            size_t* size_work2,
+                                            size_t* size_work3,
+                                            size_t* size_work4,
+                                            size_t* size_pivots,
+                                            size_t* size_iinfo,
+                                            bool* optim_mem,
+                                            const rocsolver_arch_info* arch,
+                                            const rocsolver_alg_mode mode)
+{
+    rocsolver_potrf_getMemorySize<BATCHED, STRIDED, T>(n, uplo, batch_count, size_scalars,
+                                                       size_work1, size_work2, size_work3,
+                                                       size_work4, size_pivots, size_iinfo,
+                                                       optim_mem, arch, mode);
+
+    size_t* sizes[] = {size_scalars, size_work1, size_work2, size_work3,
+                       size_work4,   size_pivots, size_iinfo};
+    for(rocsolver_alg_mode other : {rocsolver_alg_mode_default, rocsolver_alg_mode_recursive,
+                                    rocsolver_alg_mode_persistent})
+    {
+        if(other == mode)
+            continue;
+
+        size_t s[7];
+        bool unused;
+        rocsolver_potrf_getMemorySize<BATCHED, STRIDED, T>(n, uplo, batch_count, &s[0], &s[1],
+                                                           &s[2], &s[3], &s[4], &s[5], &s[6],
+                                                           &unused, arch, other);
+        for(int i = 0; i < 7; ++i)
+            *sizes[i] = std::max(*sizes[i], s[i]);
+    }
+}
+
+/** POTRF_SYRK_HERK computes the trailing update C = C - A' * A (upper) or
+    C = C - A * A' (lower), where C is the n-by-n diagonal block at shiftC and A is the
+    k-by-n (upper) or n-by-k (lower) block at shiftA. When the matrix is too large for the
+    32-bit rocBLAS interface, the update is split into column strips and chunks of k
+    small enough to be addressed with 32-bit indices. **/
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename I, typename U>
+rocblas_status potrf_syrk_herk(rocblas_handle handle,
+                               const rocblas_fill uplo,
+                               const I n,
+                               const I k,
+                               U A,
+                               const rocblas_stride shiftA,
+                               const rocblas_stride shiftC,
+                               const I lda,
+                               const rocblas_stride strideA,
+                               const I batch_count)
+{
+    if(n == 0 || k == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    // constants for rocblas functions calls
+    T t_one = 1;
+    T t_minone = -1;
+    S s_one = 1;
+    S s_minone = -1;
+
+    const bool is_32bit = (!std::is_same<I, int64_t>::value
+                           || (lda * std::max(n, k) < INT_MAX && batch_count < INT_MAX));
+    if(is_32bit)
+    {
+        if(uplo == rocblas_fill_upper)
+            return rocblasCall_syrk_herk<BATCHED, T>(
+                handle, uplo, rocblas_operation_conjugate_transpose, n, k, &s_minone, A, shiftA,
+                lda, strideA, &s_one, A, shiftC, lda, strideA, batch_count);
+        else
+            return rocblasCall_syrk_herk<BATCHED, T>(handle, uplo, rocblas_operation_none, n, k,
+                                                     &s_minone, A, shiftA, lda, strideA, &s_one, A,
+                                                     shiftC, lda, strideA, batch_count);
+    }
+
+    if(lda >= INT_MAX || batch_count >= INT_MAX)
+        return rocblas_status_not_implemented;
+
+    // every call below touches at most w columns of the matrix
+    const I w = std::max(I(1), I((INT_MAX - 1) / lda));
+
+    for(I kk = 0; kk < k; kk += w)
+    {
+        I kb = std::min(k - kk, w);
+        for(I j = 0; j < n; j += w)
+        {
+            I jb = std::min(n - j, w);
+            if(uplo == rocblas_fill_upper)
+            {
+                ROCBLAS_CHECK(rocblasCall_syrk_herk<BATCHED, T>(
+                    handle, uplo, rocblas_operation_conjugate_transpose, jb, kb, &s_minone, A,
+                    shiftA + idx2D(kk, j, lda), lda, strideA, &s_one, A, shiftC + idx2D(j, j, lda),
+                    lda, strideA, batch_count));
+                if(j > 0)
+                    ROCBLAS_CHECK(rocblasCall_gemm(
+                        handle, rocblas_operation_conjugate_transpose, rocblas_operation_none, j,
+                        jb, kb, &t_minone, A, shiftA + idx2D(kk, 0, lda), lda, strideA, A,
+                        shiftA + idx2D(kk, j, lda), lda, strideA, &t_one, A,
+                        shiftC + idx2D(0, j, lda), lda, strideA, batch_count, (T**)nullptr));
+            }
+            else
+            {
+                ROCBLAS_CHECK(rocblasCall_syrk_herk<BATCHED, T>(
+                    handle, uplo, rocblas_operation_none, jb, kb, &s_minone, A,
+                    shiftA + idx2D(j, kk, lda), lda, strideA, &s_one, A, shiftC + idx2D(j, j, lda),
+                    lda, strideA, batch_count));
+                if(j + jb < n)
+                    ROCBLAS_CHECK(rocblasCall_gemm(
+                        handle, rocblas_operation_none, rocblas_operation_conjugate_transpose,
+                        n - j - jb, jb, kb, &t_minone, A, shiftA + idx2D(j + jb, kk, lda), lda,
+                        strideA, A, shiftA + idx2D(j, kk, lda), lda, strideA, &t_one, A,
+                        shiftC + idx2D(j + jb, j, lda), lda, strideA, batch_count, (T**)nullptr));
+            }
+        }
+    }
+
+    return rocblas_status_success;
+}
+
+/** This is the recursive implementation of the Cholesky factorization. The matrix
+    is split in halves until the diagonal blocks have no more than POTRF_RECURSIVE_MINSIZE
+    columns; these are factorized with POTF2. The off-diagonal and trailing blocks are
+    updated with TRSM and SYRK/HERK. **/
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename I, typename U>
+rocblas_status potrf_recursive(rocblas_handle handle,
+                               const rocblas_fill uplo,
+                               const I n,
+                               U A,
+                               const rocblas_stride shiftA,
+                               const I lda,
+                               const rocblas_stride strideA,
+                               I* info,
+                               const I batch_count,
+                               T* scalars,
+                               void* work1,
+                               void* work2,
+                               void* work3,
+                               void* work4,
+                               T* pivots,
+                               I* iinfo,
+                               const bool optim_mem,
+                               const I j)
+{
+    if(n <= POTRF_RECURSIVE_MINSIZE(T))
+    {
+        // base case: factorize diagonal block and test for non-positive-definiteness
+        potrf_factor_diag<T>(handle, uplo, j, n, A, shiftA, lda, strideA, info, batch_count,
+                             scalars, work1, pivots, iinfo, potrf_skip(handle, info));
+
+        return rocblas_status_success;
+    }
+
+    I n1 = n / 2;
+    I n2 = n - n1;
+
+    // factorize leading diagonal block
+    potrf_recursive<BATCHED, STRIDED, T, S>(handle, uplo, n1, A, shiftA, lda, strideA, info,
+                                            batch_count, scalars, work1, work2, work3, work4,
+                                            pivots, iinfo, optim_mem, j);
+
+    if(uplo == rocblas_fill_upper)
+    {
+        // update off-diagonal and trailing blocks
+        rocsolver_trsm_upper<BATCHED, STRIDED, T>(
+            handle, rocblas_side_left, rocblas_operation_conjugate_transpose,
+            rocblas_diagonal_non_unit, n1, n2, A, shiftA, lda, strideA, A,
+            shiftA + idx2D(0, n1, lda), lda, strideA, batch_count, optim_mem, work1, work2, work3,
+            work4);
+
+        potrf_syrk_herk<BATCHED, STRIDED, T, S>(handle, uplo, n2, n1, A,
+                                                shiftA + idx2D(0, n1, lda),
+                                                shiftA + idx2D(n1, n1, lda), lda, strideA,
+                                                batch_count);
+    }
+    else
+    {
+        // update off-diagonal and trailing blocks
+        rocsolver_trsm_lower<BATCHED, STRIDED, T>(
+            handle, rocblas_side_right, rocblas_operation_conjugate_transpose,
+            rocblas_diagonal_non_unit, n2, n1, A, shiftA, lda, strideA, A,
+            shiftA + idx2D(n1, 0, lda), lda, strideA, batch_count, optim_mem, work1, work2, work3,
+            work4);
+
+        potrf_syrk_herk<BATCHED, STRIDED, T, S>(handle, uplo, n2, n1, A,
+                                                shiftA + idx2D(n1, 0, lda),
+                                                shiftA + idx2D(n1, n1, lda), lda, strideA,
+                                                batch_count);
+    }
+
+    // factorize trailing diagonal block
+    potrf_recursive<BATCHED, STRIDED, T, S>(handle, uplo, n2, A, shiftA + idx2D(n1, n1, lda), lda,
+                                            strideA, info, batch_count, scalars, work1, work2,
+                                            work3, work4, pivots, iinfo, optim_mem, j + n1);
+
+    return rocblas_status_success;
+}
+
+/** This is the look-ahead implementation of the blocked Cholesky factorization.
+    The next block column (or row) is updated first; then its diagonal block is
+    factorized and the corresponding panel is solved on the secondary stream while
+    the rest of the trailing matrix is updated on the main stream. **/
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename I, typename U>
+rocblas_status potrf_lookahead(rocblas_handle handle,
+                               rocsolver_lookahead& la,
+                               const rocblas_fill uplo,
+                               const I n,
+                               U A,
+                               const rocblas_stride shiftA,
+                               const I lda,
+                               const rocblas_stride strideA,
+                               I* info,
+                               const I batch_count,
+                               T* scalars,
+                               void* work1,
+                               void* work2,
+                               void* work3,
+                               void* work4,
+                               T* pivots,
+                               I* iinfo,
+                               const bool optim_mem)
+{
+    // constants for rocblas functions calls
+    T t_one = 1;
+    T t_minone = -1;
+    S s_one = 1;
+    S s_minone = -1;
+
+    I nb = POTRF_BLOCKSIZE(T);
+    I jb, jbn, nextpiv, nn;
+    const I* skip = potrf_skip(handle, info);
+
+    // factorizes the diagonal block starting at k and solves the corresponding panel
+    auto factor_panel = [&](I k, I kb) {
+        potrf_factor_diag<T>(handle, uplo, k, kb, A, shiftA + idx2D(k, k, lda), lda, strideA, info,
+                             batch_count, scalars, work1, pivots, iinfo, skip);
+
+        if(k + kb < n)
+        {
+            if(uplo == rocblas_fill_upper)
+                rocsolver_trsm_upper<BATCHED, STRIDED, T>(
+                    handle, rocblas_side_left, rocblas_operation_conjugate_transpose,
+                    rocblas_diagonal_non_unit, kb, (n - k - kb), A, shiftA + idx2D(k, k, lda), lda,
+                    strideA, A, shiftA + idx2D(k, k + kb, lda), lda, strideA, batch_count,
+                    optim_mem, work1, work2, work3, work4);
+            else
+                rocsolver_trsm_lower<BATCHED, STRIDED, T>(
+                    handle, rocblas_side_right, rocblas_operation_conjugate_transpose,
+                    rocblas_diagonal_non_unit, (n - k - kb), kb, A, shiftA + idx2D(k, k, lda), lda,
+                    strideA, A, shiftA + idx2D(k + kb, k, lda), lda, strideA, batch_count,
+                    optim_mem, work1, work2, work3, work4);
+        }
+    };
+
+    // factorize first block column (or row)
+    factor_panel(0, std::min(n, nb));
+
+    for(I j = 0; j < n; j += nb)
+    {
+        jb = std::min(n - j, nb);
+        nextpiv = j + jb; //position for the matrix update
+        nn = n - nextpiv; //size for the matrix update
+        if(nn <= 0)
+            break;
+        jbn = std::min(nn, nb);
+
+        // update the next block column (or row)
+        if(uplo == rocblas_fill_upper)
+        {
+            rocblasCall_syrk_herk<BATCHED, T>(
+                handle, uplo, rocblas_operation_conjugate_transpose, jbn, jb, &s_minone, A,
+                shiftA + idx2D(j, nextpiv, lda), lda, strideA, &s_one, A,
+                shiftA + idx2D(nextpiv, nextpiv, lda), lda, strideA, batch_count);
+            if(nn > jbn)
+                rocblasCall_gemm(handle, rocblas_operation_conjugate_transpose,
+                                 rocblas_operation_none, jbn, nn - jbn, jb, &t_minone, A,
+                                 shiftA + idx2D(j, nextpiv, lda), lda, strideA, A,
+                                 shiftA + idx2D(j, nextpiv + jbn, lda), lda, strideA, &t_one, A,
+                                 shiftA + idx2D(nextpiv, nextpiv + jbn, lda), lda, strideA,
+                                 batch_count, (T**)nullptr);
+        }
+        else
+        {
+            rocblasCall_syrk_herk<BATCHED, T>(handle, uplo, rocblas_operation_none, jbn, jb,
+                                              &s_minone, A, shiftA + idx2D(nextpiv, j, lda), lda,
+                                              strideA, &s_one, A,
+                                              shiftA + idx2D(nextpiv, nextpiv, lda), lda, strideA,
+                                              batch_count);
+            if(nn > jbn)
+                rocblasCall_gemm(handle, rocblas_operation_none,
+                                 rocblas_operation_conjugate_transpose, nn - jbn, jbn, jb,
+                                 &t_minone, A, shiftA + idx2D(nextpiv + jbn, j, lda), lda, strideA,
+                                 A, shiftA + idx2D(nextpiv, j, lda), lda, strideA, &t_one, A,
+                                 shiftA + idx2D(nextpiv + jbn, nextpiv, lda), lda, strideA,
+                                 batch_count, (T**)nullptr);
+        }
+
+        if(nn > jbn)
+            ROCBLAS_CHECK(la.fork());
+
+        // factorize next block column (or row) (on the secondary stream if
+        // there is remaining work to overlap with)
+        {
+            rocsolver_stream_guard guard(handle, nn > jbn ? la.side_stream : la.main_stream);
+            factor_panel(nextpiv, jbn);
+        }
+
+        if(nn > jbn)
+        {
+            // update rest of the trailing submatrix
+            if(uplo == rocblas_fill_upper)
+                rocblasCall_syrk_herk<BATCHED, T>(
+                    handle, uplo, rocblas_operation_conjugate_transpose, nn - jbn, jb, &s_minone,
+                    A, shiftA + idx2D(j, nextpiv + jbn, lda), lda, strideA, &s_one, A,
+                    shiftA + idx2D(nextpiv + jbn, nextpiv + jbn, lda), lda, strideA, batch_count);
+            else
+                rocblasCall_syrk_herk<BATCHED, T>(
+                    handle, uplo, rocblas_operation_none, nn - jbn, jb, &s_minone, A,
+                    shiftA + idx2D(nextpiv + jbn, j, lda), lda, strideA, &s_one, A,
+                    shiftA + idx2D(nextpiv + jbn, nextpiv + jbn, lda), lda, strideA, batch_count);
+
+            ROCBLAS_CHECK(la.join());
+        }
+    }
+
+    return rocblas_status_success;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename S, typename I, typename U>
 rocblas_status rocsolver_potrf_template(rocblas_handle handle,
                                         const rocblas_fill uplo,
-                                        const rocblas_int n,
+                                        const I n,
                                         U A,
-                                        const rocblas_int shiftA,
-                                        const rocblas_int lda,
+                                        const rocblas_stride shiftA,
+                                        const I lda,
                                         const rocblas_stride strideA,
-                                        rocblas_int* info,
-                                        const rocblas_int batch_count,
+                                        I* info,
+                                        const I batch_count,
                                         T* scalars,
                                         void* work1,
                                         void* work2,
                                         void* work3,
                                         void* work4,
                                         T* pivots,
-                                        rocblas_int* iinfo,
-                                        bool optim_mem)
+                                        I* iinfo,
+                                        bool optim_mem,
+                                        const rocsolver_alg_mode mode = rocsolver_alg_mode_default)
 {
     ROCSOLVER_ENTER("potrf", "uplo:", uplo, "n:", n, "shiftA:", shiftA, "lda:", lda,
                     "bc:", batch_count);
@@ -164,7 +857,7 @@ rocblas_status rocsolver_potrf_template(rocblas_handle handle,
     hipStream_t stream;
     rocblas_get_stream(handle, &stream);
 
-    rocblas_int blocksReset = (batch_count - 1) / BS1 + 1;
+    I blocksReset = (batch_count - 1) / BS1 + 1;
     dim3 gridReset(blocksReset, 1, 1);
     dim3 threads(BS1, 1, 1);
 
@@ -175,6 +868,25 @@ rocblas_status rocsolver_potrf_template(rocblas_handle handle,
     if(n == 0)
         return rocblas_status_success;
 
+    // for mid-sized single matrices (or if selected for the handle), use the persistent
+    // kernel to avoid a host round trip per block column
+    if(rocsolver_potrf_use_persistent<T>(n, batch_count, mode))
+    {
+        rocblas_int nb = POTRF_PERSISTENT_TILE;
+        rocblas_int nt = (n - 1) / nb + 1;
+        HIP_CHECK(hipMemsetAsync(iinfo, 0, sizeof(rocblas_int) * (2 + nt * nt), stream));
+
+        // one thread-block per compute unit, but no more than the number of tiles
+        const rocsolver_arch_info arch = rocsolver_handle_state_map::get_arch(handle);
+        rocblas_int blocks = std::min(std::max(arch.cu_count, 1), nt * (nt + 1) / 2);
+        size_t lmemsize = 2 * nb * nb * sizeof(T);
+
+        ROCSOLVER_LAUNCH_KERNEL((potrf_persistent_kernel<T>), dim3(blocks, 1, 1),
+                                dim3(nb, nb / 4, 1), lmemsize, stream, uplo, n, A, shiftA, lda,
+                                strideA, info, (rocblas_int*)iinfo);
+        return rocblas_status_success;
+    }
+
     // everything must be executed with scalars on the host
     rocblas_pointer_mode old_mode;
     rocblas_get_pointer_mode(handle, &old_mode);
@@ -182,17 +894,71 @@ rocblas_status rocsolver_potrf_template(rocblas_handle handle,
 
     // if the matrix is small, use the unblocked (BLAS-levelII) variant of the
     // algorithm
-    rocblas_int nb = POTRF_BLOCKSIZE(T);
+    I nb = POTRF_BLOCKSIZE(T);
     if(n <= POTRF_POTF2_SWITCHSIZE(T))
         return rocsolver_potf2_template<T>(handle, uplo, n, A, shiftA, lda, strideA, info,
                                            batch_count, scalars, (T*)work1, pivots);
 
-    // constants for rocblas functions calls
-    T t_one = 1;
-    S s_one = 1;
-    S s_minone = -1;
+    // use the recursive algorithm if enabled at build time or selected for the handle
+    if(POTRF_RECURSIVE || mode == rocsolver_alg_mode_recursive)
+    {
+        potrf_recursive<BATCHED, STRIDED, T, S>(handle, uplo, n, A, shiftA, lda, strideA, info,
+                                                batch_count, scalars, work1, work2, work3, work4,
+                                                pivots, iinfo, optim_mem, I(0));
 
-    rocblas_int jb, j = 0;
+        rocblas_set_pointer_mode(handle, old_mode);
+        return rocblas_status_success;
+    }
+
+    // use look-ahead if enabled for the handle (only when the matrix can be addressed
+    // with 32-bit indices)
+    const bool is_32bit = (!std::is_same<I, int64_t>::value
+                           || (lda * n < INT_MAX && batch_count < INT_MAX));
+    if(is_32bit)
+    {
+        rocsolver_lookahead la(handle);
+        if(la.enabled)
+        {
+            rocblas_status status = potrf_lookahead<BATCHED, STRIDED, T, S>(
+                handle, la, uplo, n, A, shiftA, lda, strideA, info, batch_count, scalars, work1,
+                work2, work3, work4, pivots, iinfo, optim_mem);
+
+            rocblas_set_pointer_mode(handle, old_mode);
+            return status;
+        }
+    }
+
+    I jb, j = 0;
+    const I* skip = potrf_skip(handle, info);
+
+    // for moderate sizes and large batches, use the left-looking algorithm, so that the update
+    // and the triangular solve of each block row (column) are done by the fused panel-apply
+    // kernel (which also skips the matrices found not to be positive definite)
+    if((BATCHED || STRIDED) && rocsolver_use_panel_apply<T>(handle, n, nb, batch_count))
+    {
+        for(j = 0; j < n; j += nb)
+        {
+            jb = std::min(n - j, nb);
+
+            // update the diagonal block with the previous block rows (columns)
+            if(j > 0)
+                rocsolver_potrf_panel_apply<BATCHED, STRIDED, T>(handle, uplo, j, jb, j, jb, A,
+                                                                 shiftA, lda, strideA, info,
+                                                                 batch_count);
+
+            // factor the diagonal block and test for non-positive-definiteness
+            potrf_factor_diag<T>(handle, uplo, j, jb, A, shiftA + idx2D(j, j, lda), lda, strideA,
+                                 info, batch_count, scalars, work1, pivots, iinfo, skip);
+
+            // update and solve the rest of the block row (column)
+            rocsolver_potrf_panel_apply<BATCHED, STRIDED, T>(handle, uplo, j, jb, j + jb,
+                                                             n - j - jb, A, shiftA, lda, strideA,
+                                                             info, batch_count);
+        }
+
+        rocblas_set_pointer_mode(handle, old_mode);
+        return rocblas_status_success;
+    }
 
     // (TODO: When the matrix is detected to be non positive definite, we need to
     //  prevent TRSM and HERK to modify further the input matrix; ideally with no
@@ -205,13 +971,8 @@ rocblas_status rocsolver_potrf_template(rocblas_handle handle,
         {
             // Factor diagonal and subdiagonal blocks
             jb = std::min(n - j, nb); // number of columns in the block
-            ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, iinfo, batch_count, 0);
-            rocsolver_potf2_template<T>(handle, uplo, jb, A, shiftA + idx2D(j, j, lda), lda,
-                                        strideA, iinfo, batch_count, scalars, (T*)work1, pivots);
-
-            // test for non-positive-definiteness.
-            ROCSOLVER_LAUNCH_KERNEL(chk_positive<U>, gridReset, threads, 0, stream, iinfo, info, j,
-                                    batch_count);
+            potrf_factor_diag<T>(handle, uplo, j, jb, A, shiftA + idx2D(j, j, lda), lda, strideA,
+                                 info, batch_count, scalars, work1, pivots, iinfo, skip);
 
             if(j + jb < n)
             {
@@ -222,9 +983,8 @@ rocblas_status rocsolver_potrf_template(rocblas_handle handle,
                     strideA, A, shiftA + idx2D(j, j + jb, lda), lda, strideA, batch_count,
                     optim_mem, work1, work2, work3, work4);
 
-                rocblasCall_syrk_herk<BATCHED, T>(
-                    handle, uplo, rocblas_operation_conjugate_transpose, n - j - jb, jb, &s_minone,
-                    A, shiftA + idx2D(j, j + jb, lda), lda, strideA, &s_one, A,
+                potrf_syrk_herk<BATCHED, STRIDED, T, S>(
+                    handle, uplo, n - j - jb, jb, A, shiftA + idx2D(j, j + jb, lda),
                     shiftA + idx2D(j + jb, j + jb, lda), lda, strideA, batch_count);
             }
             j += nb;
@@ -237,13 +997,8 @@ rocblas_status rocsolver_potrf_template(rocblas_handle handle,
         {
             // Factor diagonal and subdiagonal blocks
             jb = std::min(n - j, nb); // number of columns in the block
-            ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, iinfo, batch_count, 0);
-            rocsolver_potf2_template<T>(handle, uplo, jb, A, shiftA + idx2D(j, j, lda), lda,
-                                        strideA, iinfo, batch_count, scalars, (T*)work1, pivots);
-
-            // test for non-positive-definiteness.
-            ROCSOLVER_LAUNCH_KERNEL(chk_positive<U>, gridReset, threads, 0, stream, iinfo, info, j,
-                                    batch_count);
+            potrf_factor_diag<T>(handle, uplo, j, jb, A, shiftA + idx2D(j, j, lda), lda, strideA,
+                                 info, batch_count, scalars, work1, pivots, iinfo, skip);
 
             if(j + jb < n)
             {
@@ -254,9 +1009,8 @@ rocblas_status rocsolver_potrf_template(rocblas_handle handle,
                     strideA, A, shiftA + idx2D(j + jb, j, lda), lda, strideA, batch_count,
                     optim_mem, work1, work2, work3, work4);
 
-                rocblasCall_syrk_herk<BATCHED, T>(
-                    handle, uplo, rocblas_operation_none, n - j - jb, jb, &s_minone, A,
-                    shiftA + idx2D(j + jb, j, lda), lda, strideA, &s_one, A,
+                potrf_syrk_herk<BATCHED, STRIDED, T, S>(
+                    handle, uplo, n - j - jb, jb, A, shiftA + idx2D(j + jb, j, lda),
                     shiftA + idx2D(j + jb, j + jb, lda), lda, strideA, batch_count);
             }
             j += nb;
@@ -266,10 +1020,8 @@ rocblas_status rocsolver_potrf_template(rocblas_handle handle,
     // factor last block
     if(j < n)
     {
-        rocsolver_potf2_template<T>(handle, uplo, n - j, A, shiftA + idx2D(j, j, lda), lda, strideA,
-                                    iinfo, batch_count, scalars, (T*)work1, pivots);
-        ROCSOLVER_LAUNCH_KERNEL(chk_positive<U>, gridReset, threads, 0, stream, iinfo, info, j,
-                                batch_count);
+        potrf_factor_diag<T>(handle, uplo, j, n - j, A, shiftA + idx2D(j, j, lda), lda, strideA,
+                             info, batch_count, scalars, work1, pivots, iinfo, skip);
     }
 
     rocblas_set_pointer_mode(handle, old_mode);
@@ -26,15 +26,16 @@
  * *************************************************************************/
 
 #include "roclapack_potrf.hpp"
+#include "rocsolver_info_summary.hpp"
 
-template <typename T, typename U>
+template <typename T, typename I, typename U>
 rocblas_status rocsolver_potrf_batched_impl(rocblas_handle handle,
                                             const rocblas_fill uplo,
-                                            const rocblas_int n,
+                                            const I n,
                                             U A,
-                                            const rocblas_int lda,
-                                            rocblas_int* info,
-                                            const rocblas_int batch_count)
+                                            const I lda,
+                                            I* info,
+                                            const I batch_count)
 {
     ROCSOLVER_ENTER_TOP("potrf_batched", "--uplo", uplo, "-n", n, "--lda", lda, "--batch_count",
                         batch_count);
@@ -49,8 +50,13 @@ rocblas_status rocsolver_potrf_batched_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    // the aggregated info values must fit in the summary array
+    st = rocsolver_info_summary_argCheck(handle, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
     // working with unshifted arrays
-    rocblas_int shiftA = 0;
+    rocblas_stride shiftA = 0;
 
     // batched execution
     rocblas_stride strideA = 0;
@@ -65,12 +71,17 @@ rocblas_status rocsolver_potrf_batched_impl(rocblas_handle handle,
     size_t size_pivots;
     // size to store info about positiveness of each subblock
     size_t size_iinfo;
-    rocsolver_potrf_getMemorySize<true, false, T>(n, uplo, batch_count, &size_scalars, &size_work1,
-                                                  &size_work2, &size_work3, &size_work4,
-                                                  &size_pivots, &size_iinfo, &optim_mem);
+    // (the selection of the kernels depends on the device architecture)
+    const rocsolver_arch_info arch = rocsolver_handle_state_map::get_arch(handle);
+    const rocsolver_alg_mode mode
+        = rocsolver_handle_state_map::alg_mode(handle, rocsolver_function_potrf);
+    // (the workspace covers every mode, in case it changes after a size query)
+    rocsolver_potrf_getMemorySize_any_mode<true, false, T>(
+        n, uplo, batch_count, &size_scalars, &size_work1, &size_work2, &size_work3, &size_work4,
+        &size_pivots, &size_iinfo, &optim_mem, &arch, mode);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work1, size_work2,
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_scalars, size_work1, size_work2,
                                                       size_work3, size_work4, size_pivots,
                                                       size_iinfo);
 
@@ -93,9 +104,14 @@ rocblas_status rocsolver_potrf_batched_impl(rocblas_handle handle,
         init_scalars(handle, (T*)scalars);
 
     // execution
-    return rocsolver_potrf_template<true, false, T, S>(
+    st = rocsolver_potrf_template<true, false, T, S>(
         handle, uplo, n, A, shiftA, lda, strideA, info, batch_count, (T*)scalars, work1, work2,
-        work3, work4, (T*)pivots, (rocblas_int*)iinfo, optim_mem);
+        work3, work4, (T*)pivots, (I*)iinfo, optim_mem, mode);
+    if(st != rocblas_status_success)
+        return st;
+
+    // aggregate the info values of the batch
+    return rocsolver_info_summary(handle, info, batch_count);
 }
 
 /*
@@ -151,4 +167,50 @@ rocblas_status rocsolver_zpotrf_batched(rocblas_handle handle,
     return rocsolver_potrf_batched_impl<rocblas_double_complex>(handle, uplo, n, A, lda, info,
                                                                 batch_count);
 }
+
+rocblas_status rocsolver_spotrf_batched_64(rocblas_handle handle,
+                                           const rocblas_fill uplo,
+                                           const int64_t n,
+                                           float* const A[],
+                                           const int64_t lda,
+                                           int64_t* info,
+                                           const int64_t batch_count)
+{
+    return rocsolver_potrf_batched_impl<float>(handle, uplo, n, A, lda, info, batch_count);
+}
+
+rocblas_status rocsolver_dpotrf_batched_64(rocblas_handle handle,
+                                           const rocblas_fill uplo,
+                                           const int64_t n,
+                                           double* const A[],
+                                           const int64_t lda,
+                                           int64_t* info,
+                                           const int64_t batch_count)
+{
+    return rocsolver_potrf_batched_impl<double>(handle, uplo, n, A, lda, info, batch_count);
+}
+
+rocblas_status rocsolver_cpotrf_batched_64(rocblas_handle handle,
+                                           const rocblas_fill uplo,
+                                           const int64_t n,
+                                           rocblas_float_complex* const A[],
+                                           const int64_t lda,
+                                           int64_t* info,
+                                           const int64_t batch_count)
+{
+    return rocsolver_potrf_batched_impl<rocblas_float_complex>(handle, uplo, n, A, lda, info,
+                                                               batch_count);
+}
+
+rocblas_status rocsolver_zpotrf_batched_64(rocblas_handle handle,
+                                           const rocblas_fill uplo,
+                                           const int64_t n,
+                                           rocblas_double_complex* const A[],
+                                           const int64_t lda,
+                                           int64_t* info,
+                                           const int64_t batch_count)
+{
+    return rocsolver_potrf_batched_impl<rocblas_double_complex>(handle, uplo, n, A, lda, info,
+                                                                batch_count);
+}
 }
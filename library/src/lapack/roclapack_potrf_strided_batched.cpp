@@ -26,16 +26,17 @@
  * *************************************************************************/
 
 #include "roclapack_potrf.hpp"
+#include "rocsolver_info_summary.hpp"
 
-template <typename T, typename U>
+template <typename T, typename I, typename U>
 rocblas_status rocsolver_potrf_strided_batched_impl(rocblas_handle handle,
                                                     const rocblas_fill uplo,
-                                                    const rocblas_int n,
+                                                    const I n,
                                                     U A,
-                                                    const rocblas_int lda,
+                                                    const I lda,
                                                     const rocblas_stride strideA,
-                                                    rocblas_int* info,
-                                                    const rocblas_int batch_count)
+                                                    I* info,
+                                                    const I batch_count)
 {
     ROCSOLVER_ENTER_TOP("potrf_strided_batched", "--uplo", uplo, "-n", n, "--lda", lda, "--strideA",
                         strideA, "--batch_count", batch_count);
@@ -50,8 +51,13 @@ rocblas_status rocsolver_potrf_strided_batched_impl(rocblas_handle handle,
     if(st != rocblas_status_continue)
         return st;
 
+    // the aggregated info values must fit in the summary array
+    st = rocsolver_info_summary_argCheck(handle, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
     // working with unshifted arrays
-    rocblas_int shiftA = 0;
+    rocblas_stride shiftA = 0;
 
     // memory workspace sizes:
     // size for constants in rocblas calls
@@ -63,12 +69,17 @@ rocblas_status rocsolver_potrf_strided_batched_impl(rocblas_handle handle,
     size_t size_pivots;
     // size to store info about positiveness of each subblock
     size_t size_iinfo;
-    rocsolver_potrf_getMemorySize<false, true, T>(n, uplo, batch_count, &size_scalars, &size_work1,
-                                                  &size_work2, &size_work3, &size_work4,
-                                                  &size_pivots, &size_iinfo, &optim_mem);
+    // (the selection of the kernels depends on the device architecture)
+    const rocsolver_arch_info arch = rocsolver_handle_state_map::get_arch(handle);
+    const rocsolver_alg_mode mode
+        = rocsolver_handle_state_map::alg_mode(handle, rocsolver_function_potrf);
+    // (the workspace covers every mode, in case it changes after a size query)
+    rocsolver_potrf_getMemorySize_any_mode<false, true, T>(
+        n, uplo, batch_count, &size_scalars, &size_work1, &size_work2, &size_work3, &size_work4,
+        &size_pivots, &size_iinfo, &optim_mem, &arch, mode);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work1, size_work2,
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_scalars, size_work1, size_work2,
                                                       size_work3, size_work4, size_pivots,
                                                       size_iinfo);
 
@@ -91,9 +102,14 @@ rocblas_status rocsolver_potrf_strided_batched_impl(rocblas_handle handle,
         init_scalars(handle, (T*)scalars);
 
     // execution
-    return rocsolver_potrf_template<false, true, T, S>(
+    st = rocsolver_potrf_template<false, true, T, S>(
         handle, uplo, n, A, shiftA, lda, strideA, info, batch_count, (T*)scalars, work1, work2,
-        work3, work4, (T*)pivots, (rocblas_int*)iinfo, optim_mem);
+        work3, work4, (T*)pivots, (I*)iinfo, optim_mem, mode);
+    if(st != rocblas_status_success)
+        return st;
+
+    // aggregate the info values of the batch
+    return rocsolver_info_summary(handle, info, batch_count);
 }
 
 /*
@@ -155,4 +171,56 @@ rocblas_status rocsolver_zpotrf_strided_batched(rocblas_handle handle,
     return rocsolver_potrf_strided_batched_impl<rocblas_double_complex>(handle, uplo, n, A, lda,
                                                                         strideA, info, batch_count);
 }
+
+rocblas_status rocsolver_spotrf_strided_batched_64(rocblas_handle handle,
+                                                   const rocblas_fill uplo,
+                                                   const int64_t n,
+                                                   float* A,
+                                                   const int64_t lda,
+                                                   const rocblas_stride strideA,
+                                                   int64_t* info,
+                                                   const int64_t batch_count)
+{
+    return rocsolver_potrf_strided_batched_impl<float>(handle, uplo, n, A, lda, strideA, info,
+                                                       batch_count);
+}
+
+rocblas_status rocsolver_dpotrf_strided_batched_64(rocblas_handle handle,
+                                                   const rocblas_fill uplo,
+                                                   const int64_t n,
+                                                   double* A,
+                                                   const int64_t lda,
+                                                   const rocblas_stride strideA,
+                                                   int64_t* info,
+                                                   const int64_t batch_count)
+{
+    return rocsolver_potrf_strided_batched_impl<double>(handle, uplo, n, A, lda, strideA, info,
+                                                        batch_count);
+}
+
+rocblas_status rocsolver_cpotrf_strided_batched_64(rocblas_handle handle,
+                                                   const rocblas_fill uplo,
+                                                   const int64_t n,
+                                                   rocblas_float_complex* A,
+                                                   const int64_t lda,
+                                                   const rocblas_stride strideA,
+                                                   int64_t* info,
+                                                   const int64_t batch_count)
+{
+    return rocsolver_potrf_strided_batched_impl<rocblas_float_complex>(handle, uplo, n, A, lda,
+                                                                       strideA, info, batch_count);
+}
+
+rocblas_status rocsolver_zpotrf_strided_batched_64(rocblas_handle handle,
+                                                   const rocblas_fill uplo,
+                                                   const int64_t n,
+                                                   rocblas_double_complex* A,
+                                                   const int64_t lda,
+                                                   const rocblas_stride strideA,
+                                                   int64_t* info,
+                                                   const int64_t batch_count)
+{
+    return rocsolver_potrf_strided_batched_impl<rocblas_double_complex>(handle, uplo, n, A, lda,
+                                                                        strideA, info, batch_count);
+}
 }
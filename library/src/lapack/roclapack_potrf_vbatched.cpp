@@ -0,0 +1,189 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+#include "roclapack_vbatched.hpp"
+
+template <typename T, typename U>
+rocblas_status rocsolver_potrf_vbatched_impl(rocblas_handle handle,
+                                             const rocblas_fill uplo,
+                                             const rocblas_int* n,
+                                             U A,
+                                             const rocblas_int* lda,
+                                             rocblas_int* info,
+                                             const rocblas_int max_n,
+                                             const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("potrf_vbatched", "--uplo", uplo, "--max_n", max_n, "--batch_count",
+                        batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st
+        = rocsolver_potrf_vbatched_argCheck(handle, uplo, n, lda, A, info, max_n, batch_count);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // memory workspace sizes:
+    // size for constants in rocblas calls
+    size_t size_scalars;
+    // size of reusable workspace (and for calling TRSM)
+    size_t size_work[4];
+    // extra requirements for calling POTF2
+    size_t size_pivots;
+    // size to store info about positiveness of each subblock
+    size_t size_iinfo;
+    // size to sort the problems, store their order and the pointers to the matrices of a group
+    size_t size_sort, size_order, size_Aarr;
+    // size to store the info values of a group
+    size_t size_ginfo;
+    // size to pad the matrices of a group
+    size_t size_pad;
+    // (the selection of the kernels depends on the device architecture)
+    const rocsolver_arch_info arch = rocsolver_handle_state_map::get_arch(handle);
+    rocsolver_potrf_vbatched_getMemorySize<T>(
+        max_n, uplo, batch_count, &size_scalars, &size_work[0], &size_work[1], &size_work[2],
+        &size_work[3], &size_pivots, &size_iinfo, &size_sort, &size_order, &size_Aarr,
+        &size_ginfo, &size_pad, &arch);
+
+    if(rocblas_is_device_memory_size_query(handle))
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(
+            handle, size_scalars, size_work[0], size_work[1], size_work[2], size_work[3],
+            size_pivots, size_iinfo, size_sort, size_order, size_Aarr, size_ginfo, size_pad);
+
+    // quick return
+    if(batch_count == 0)
+        return rocsolver_info_summary(handle, info, batch_count);
+
+    // memory workspace allocation
+    void *scalars, *work1, *work2, *work3, *work4, *pivots, *iinfo;
+    void *sort, *order, *Aarr, *ginfo, *pad;
+    rocblas_device_malloc mem(handle, size_scalars, size_work[0], size_work[1], size_work[2],
+                              size_work[3], size_pivots, size_iinfo, size_sort, size_order,
+                              size_Aarr, size_ginfo, size_pad);
+
+    if(!mem)
+        return rocblas_status_memory_error;
+
+    scalars = mem[0];
+    work1 = mem[1];
+    work2 = mem[2];
+    work3 = mem[3];
+    work4 = mem[4];
+    pivots = mem[5];
+    iinfo = mem[6];
+    sort = mem[7];
+    order = mem[8];
+    Aarr = mem[9];
+    ginfo = mem[10];
+    pad = mem[11];
+    if(size_scalars > 0)
+        init_scalars(handle, (T*)scalars);
+
+    // group the problems by size class
+    rocsolver_vbatched_groups<2> groups;
+    st = rocsolver_vbatched_sort<T, 2, 1>(
+        handle, batch_count, {n, lda},
+        [&](const std::array<rocblas_int, 2>& d) {
+            return d[0] < 0 || d[0] > max_n || d[1] < d[0] || d[1] < 1;
+        },
+        sort, (rocblas_int*)order, groups);
+    if(st != rocblas_status_success)
+        return st;
+
+    // execution
+    st = rocsolver_potrf_vbatched_template<T>(
+        handle, uplo, n, A, lda, info, groups, (T*)scalars, work1, work2, work3, work4,
+        (T*)pivots, (rocblas_int*)iinfo, (rocblas_int*)order, (T**)Aarr, (rocblas_int*)ginfo,
+        (T*)pad, size_work, size_pad, &arch);
+    if(st != rocblas_status_success)
+        return st;
+
+    // aggregate the info values of the batch
+    return rocsolver_info_summary(handle, info, batch_count);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_spotrf_vbatched(rocblas_handle handle,
+                                         const rocblas_fill uplo,
+                                         const rocblas_int* n,
+                                         float* const A[],
+                                         const rocblas_int* lda,
+                                         rocblas_int* info,
+                                         const rocblas_int max_n,
+                                         const rocblas_int batch_count)
+{
+    return rocsolver_potrf_vbatched_impl<float>(handle, uplo, n, A, lda, info, max_n, batch_count);
+}
+
+rocblas_status rocsolver_dpotrf_vbatched(rocblas_handle handle,
+                                         const rocblas_fill uplo,
+                                         const rocblas_int* n,
+                                         double* const A[],
+                                         const rocblas_int* lda,
+                                         rocblas_int* info,
+                                         const rocblas_int max_n,
+                                         const rocblas_int batch_count)
+{
+    return rocsolver_potrf_vbatched_impl<double>(handle, uplo, n, A, lda, info, max_n,
+                                                 batch_count);
+}
+
+rocblas_status rocsolver_cpotrf_vbatched(rocblas_handle handle,
+                                         const rocblas_fill uplo,
+                                         const rocblas_int* n,
+                                         rocblas_float_complex* const A[],
+                                         const rocblas_int* lda,
+                                         rocblas_int* info,
+                                         const rocblas_int max_n,
+                                         const rocblas_int batch_count)
+{
+    return rocsolver_potrf_vbatched_impl<rocblas_float_complex>(handle, uplo, n, A, lda, info,
+                                                                max_n, batch_count);
+}
+
+rocblas_status rocsolver_zpotrf_vbatched(rocblas_handle handle,
+                                         const rocblas_fill uplo,
+                                         const rocblas_int* n,
+                                         rocblas_double_complex* const A[],
+                                         const rocblas_int* lda,
+                                         rocblas_int* info,
+                                         const rocblas_int max_n,
+                                         const rocblas_int batch_count)
+{
+    return rocsolver_potrf_vbatched_impl<rocblas_double_complex>(handle, uplo, n, A, lda, info,
+                                                                 max_n, batch_count);
+}
+
+} // extern C
@@ -27,15 +27,15 @@
 
 #include "roclapack_potrs.hpp"
 
-template <typename T>
+template <typename T, typename I>
 rocblas_status rocsolver_potrs_impl(rocblas_handle handle,
                                     const rocblas_fill uplo,
-                                    const rocblas_int n,
-                                    const rocblas_int nrhs,
+                                    const I n,
+                                    const I nrhs,
                                     T* A,
-                                    const rocblas_int lda,
+                                    const I lda,
                                     T* B,
-                                    const rocblas_int ldb)
+                                    const I ldb)
 {
     ROCSOLVER_ENTER_TOP("potrs", "--uplo", uplo, "-n", n, "--nrhs", nrhs, "--lda", lda, "--ldb", ldb);
 
@@ -48,13 +48,13 @@ rocblas_status rocsolver_potrs_impl(rocblas_handle handle,
         return st;
 
     // working with unshifted arrays
-    rocblas_int shiftA = 0;
-    rocblas_int shiftB = 0;
+    rocblas_stride shiftA = 0;
+    rocblas_stride shiftB = 0;
 
     // normal (non-batched non-strided) execution
     rocblas_stride strideA = 0;
     rocblas_stride strideB = 0;
-    rocblas_int batch_count = 1;
+    I batch_count = 1;
 
     // memory workspace sizes:
     // size of workspace (for calling TRSM)
@@ -64,7 +64,7 @@ rocblas_status rocsolver_potrs_impl(rocblas_handle handle,
                                                    &size_work3, &size_work4, &optim_mem);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_work1, size_work2, size_work3,
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_work1, size_work2, size_work3,
                                                       size_work4);
 
     // memory workspace allocation
@@ -138,3 +138,51 @@ extern "C" rocblas_status rocsolver_zpotrs(rocblas_handle handle,
 {
     return rocsolver_potrs_impl<rocblas_double_complex>(handle, uplo, n, nrhs, A, lda, B, ldb);
 }
+
+extern "C" rocblas_status rocsolver_spotrs_64(rocblas_handle handle,
+                                              const rocblas_fill uplo,
+                                              const int64_t n,
+                                              const int64_t nrhs,
+                                              float* A,
+                                              const int64_t lda,
+                                              float* B,
+                                              const int64_t ldb)
+{
+    return rocsolver_potrs_impl<float>(handle, uplo, n, nrhs, A, lda, B, ldb);
+}
+
+extern "C" rocblas_status rocsolver_dpotrs_64(rocblas_handle handle,
+                                              const rocblas_fill uplo,
+                                              const int64_t n,
+                                              const int64_t nrhs,
+                                              double* A,
+                                              const int64_t lda,
+                                              double* B,
+                                              const int64_t ldb)
+{
+    return rocsolver_potrs_impl<double>(handle, uplo, n, nrhs, A, lda, B, ldb);
+}
+
+extern "C" rocblas_status rocsolver_cpotrs_64(rocblas_handle handle,
+                                              const rocblas_fill uplo,
+                                              const int64_t n,
+                                              const int64_t nrhs,
+                                              rocblas_float_complex* A,
+                                              const int64_t lda,
+                                              rocblas_float_complex* B,
+                                              const int64_t ldb)
+{
+    return rocsolver_potrs_impl<rocblas_float_complex>(handle, uplo, n, nrhs, A, lda, B, ldb);
+}
+
+extern "C" rocblas_status rocsolver_zpotrs_64(rocblas_handle handle,
+                                              const rocblas_fill uplo,
+                                              const int64_t n,
+                                              const int64_t nrhs,
+                                              rocblas_double_complex* A,
+                                              const int64_t lda,
+                                              rocblas_double_complex* B,
+                                              const int64_t ldb)
+{
+    return rocsolver_potrs_impl<rocblas_double_complex>(handle, uplo, n, nrhs, A, lda, B, ldb);
+}
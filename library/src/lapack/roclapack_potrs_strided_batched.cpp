@@ -27,18 +27,18 @@
 
 #include "roclapack_potrs.hpp"
 
-template <typename T, typename U>
+template <typename T, typename I, typename U>
 rocblas_status rocsolver_potrs_strided_batched_impl(rocblas_handle handle,
                                                     const rocblas_fill uplo,
-                                                    const rocblas_int n,
-                                                    const rocblas_int nrhs,
+                                                    const I n,
+                                                    const I nrhs,
                                                     U A,
-                                                    const rocblas_int lda,
+                                                    const I lda,
                                                     const rocblas_stride strideA,
                                                     U B,
-                                                    const rocblas_int ldb,
+                                                    const I ldb,
                                                     const rocblas_stride strideB,
-                                                    const rocblas_int batch_count)
+                                                    const I batch_count)
 {
     ROCSOLVER_ENTER_TOP("potrs_strided_batched", "--uplo", uplo, "-n", n, "--nrhs", nrhs, "--lda",
                         lda, "--strideA", strideA, "--ldb", ldb, "--strideB", strideB,
@@ -53,8 +53,8 @@ rocblas_status rocsolver_potrs_strided_batched_impl(rocblas_handle handle,
         return st;
 
     // working with unshifted arrays
-    rocblas_int shiftA = 0;
-    rocblas_int shiftB = 0;
+    rocblas_stride shiftA = 0;
+    rocblas_stride shiftB = 0;
 
     // memory workspace sizes:
     // size of workspace (for calling TRSM)
@@ -64,7 +64,7 @@ rocblas_status rocsolver_potrs_strided_batched_impl(rocblas_handle handle,
                                                   &size_work3, &size_work4, &optim_mem);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_work1, size_work2, size_work3,
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_work1, size_work2, size_work3,
                                                       size_work4);
 
     // memory workspace allocation
@@ -154,3 +154,67 @@ extern "C" rocblas_status rocsolver_zpotrs_strided_batched(rocblas_handle handle
     return rocsolver_potrs_strided_batched_impl<rocblas_double_complex>(
         handle, uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, batch_count);
 }
+
+extern "C" rocblas_status rocsolver_spotrs_strided_batched_64(rocblas_handle handle,
+                                                              const rocblas_fill uplo,
+                                                              const int64_t n,
+                                                              const int64_t nrhs,
+                                                              float* A,
+                                                              const int64_t lda,
+                                                              const rocblas_stride strideA,
+                                                              float* B,
+                                                              const int64_t ldb,
+                                                              const rocblas_stride strideB,
+                                                              const int64_t batch_count)
+{
+    return rocsolver_potrs_strided_batched_impl<float>(handle, uplo, n, nrhs, A, lda, strideA, B,
+                                                       ldb, strideB, batch_count);
+}
+
+extern "C" rocblas_status rocsolver_dpotrs_strided_batched_64(rocblas_handle handle,
+                                                              const rocblas_fill uplo,
+                                                              const int64_t n,
+                                                              const int64_t nrhs,
+                                                              double* A,
+                                                              const int64_t lda,
+                                                              const rocblas_stride strideA,
+                                                              double* B,
+                                                              const int64_t ldb,
+                                                              const rocblas_stride strideB,
+                                                              const int64_t batch_count)
+{
+    return rocsolver_potrs_strided_batched_impl<double>(handle, uplo, n, nrhs, A, lda, strideA, B,
+                                                        ldb, strideB, batch_count);
+}
+
+extern "C" rocblas_status rocsolver_cpotrs_strided_batched_64(rocblas_handle handle,
+                                                              const rocblas_fill uplo,
+                                                              const int64_t n,
+                                                              const int64_t nrhs,
+                                                              rocblas_float_complex* A,
+                                                              const int64_t lda,
+                                                              const rocblas_stride strideA,
+                                                              rocblas_float_complex* B,
+                                                              const int64_t ldb,
+                                                              const rocblas_stride strideB,
+                                                              const int64_t batch_count)
+{
+    return rocsolver_potrs_strided_batched_impl<rocblas_float_complex>(
+        handle, uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, batch_count);
+}
+
+extern "C" rocblas_status rocsolver_zpotrs_strided_batched_64(rocblas_handle handle,
+                                                              const rocblas_fill uplo,
+                                                              const int64_t n,
+                                                              const int64_t nrhs,
+                                                              rocblas_double_complex* A,
+                                                              const int64_t lda,
+                                                              const rocblas_stride strideA,
+                                                              rocblas_double_complex* B,
+                                                              const int64_t ldb,
+                                                              const rocblas_stride strideB,
+                                                              const int64_t batch_count)
+{
+    return rocsolver_potrs_strided_batched_impl<rocblas_double_complex>(
+        handle, uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, batch_count);
+}
@@ -0,0 +1,108 @@
+/*****************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocblas.hpp"
+#include "roclapack_pttrf.hpp"
+#include "roclapack_pttrs.hpp"
+#include "rocsolver/rocsolver.h"
+
+template <typename T, typename S>
+rocblas_status rocsolver_ptsv_argCheck(rocblas_handle handle,
+                                       const rocblas_int n,
+                                       const rocblas_int nrhs,
+                                       S* D,
+                                       T* E,
+                                       T* B,
+                                       const rocblas_int ldb,
+                                       rocblas_int* info,
+                                       const rocblas_int batch_count,
+                                       const rocblas_int incd = 1,
+                                       const rocblas_int ince = 1,
+                                       const rocblas_int incb = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(n < 0 || nrhs < 0 || batch_count < 0 || incd < 1 || ince < 1)
+        return rocblas_status_invalid_size;
+    if(incb < 1 || ldb < incb * n)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !D) || (n > 1 && !E) || (n && nrhs && !B) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename S>
+rocblas_status rocsolver_ptsv_template(rocblas_handle handle,
+                                       const rocblas_int n,
+                                       const rocblas_int nrhs,
+                                       S* D,
+                                       const rocblas_int incd,
+                                       const rocblas_stride strideD,
+                                       T* E,
+                                       const rocblas_int ince,
+                                       const rocblas_stride strideE,
+                                       T* B,
+                                       const rocblas_int incb,
+                                       const rocblas_int ldb,
+                                       const rocblas_stride strideB,
+                                       rocblas_int* info,
+                                       const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("ptsv", "n:", n, "nrhs:", nrhs, "incd:", incd, "ince:", ince, "incb:", incb,
+                    "ldb:", ldb, "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    // compute the factorization A = L*D*L'
+    rocsolver_pttrf_template<T>(handle, n, D, incd, strideD, E, ince, strideE, info, batch_count);
+
+    // solve the system, skipping the matrices that are not positive definite
+    rocsolver_pttrs_template<T>(handle, n, nrhs, D, incd, strideD, E, ince, strideE, B, incb, ldb,
+                                strideB, batch_count, info);
+
+    return rocblas_status_success;
+}
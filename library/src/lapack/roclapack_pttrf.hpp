@@ -0,0 +1,145 @@
+/*****************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "lapack_device_functions.hpp"
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+/** PTTRF_KERNEL computes the factorization A = L*D*L' of a symmetric/hermitian positive definite
+    tridiagonal matrix. Each thread factorizes one matrix of the batch (a lane). The element i of
+    the diagonal and sub-diagonal of the matrix is located at position i*inc of the corresponding
+    array. **/
+template <typename T, typename S>
+ROCSOLVER_KERNEL void pttrf_kernel(const rocblas_int n,
+                                   S* DA,
+                                   const rocblas_int incd,
+                                   const rocblas_stride strideD,
+                                   T* EA,
+                                   const rocblas_int ince,
+                                   const rocblas_stride strideE,
+                                   rocblas_int* infoA,
+                                   const rocblas_int batch_count)
+{
+    rocblas_int bid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(bid >= batch_count)
+        return;
+
+    // batch instance
+    S* D = DA + bid * strideD;
+    T* E = EA + bid * strideE;
+
+    S di = D[0];
+    for(rocblas_int i = 0; i < n - 1; i++)
+    {
+        if(di <= 0)
+        {
+            infoA[bid] = i + 1;
+            return;
+        }
+        T ei = E[i * ince];
+        T li = ei / di;
+        E[i * ince] = li;
+        di = D[(i + 1) * incd] - std::real(li * conj(ei));
+        D[(i + 1) * incd] = di;
+    }
+
+    infoA[bid] = (di <= 0) ? n : 0;
+}
+
+template <typename T, typename S>
+rocblas_status rocsolver_pttrf_argCheck(rocblas_handle handle,
+                                        const rocblas_int n,
+                                        S* D,
+                                        T* E,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count,
+                                        const rocblas_int incd = 1,
+                                        const rocblas_int ince = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(n < 0 || batch_count < 0 || incd < 1 || ince < 1)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !D) || (n > 1 && !E) || (batch_count && !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename S>
+rocblas_status rocsolver_pttrf_template(rocblas_handle handle,
+                                        const rocblas_int n,
+                                        S* D,
+                                        const rocblas_int incd,
+                                        const rocblas_stride strideD,
+                                        T* E,
+                                        const rocblas_int ince,
+                                        const rocblas_stride strideE,
+                                        rocblas_int* info,
+                                        const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("pttrf", "n:", n, "incd:", incd, "ince:", ince, "bc:", batch_count);
+
+    // quick return if zero instances in batch
+    if(batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+
+    // quick return if no dimensions
+    if(n == 0)
+    {
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(blocks, 1, 1), dim3(BS1, 1, 1), 0, stream, info,
+                                batch_count, 0);
+        return rocblas_status_success;
+    }
+
+    ROCSOLVER_LAUNCH_KERNEL(pttrf_kernel<T>, dim3(blocks, 1, 1), dim3(BS1, 1, 1), 0, stream, n, D,
+                            incd, strideD, E, ince, strideE, info, batch_count);
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,130 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_pttrf.hpp"
+
+template <typename T, typename S>
+rocblas_status rocsolver_pttrf_interleaved_batched_impl(rocblas_handle handle,
+                                                        const rocblas_int n,
+                                                        S* D,
+                                                        const rocblas_int incd,
+                                                        const rocblas_stride strideD,
+                                                        T* E,
+                                                        const rocblas_int ince,
+                                                        const rocblas_stride strideE,
+                                                        rocblas_int* info,
+                                                        const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("pttrf_interleaved_batched", "-n", n, "--incd", incd, "--strideD", strideD,
+                        "--ince", ince, "--strideE", strideE, "--batch_count", batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // argument checking
+    rocblas_status st = rocsolver_pttrf_argCheck(handle, n, D, E, info, batch_count, incd, ince);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // this function does not require memory work space
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_size_unchanged;
+
+    // execution
+    return rocsolver_pttrf_template<T>(handle, n, D, incd, strideD, E, ince, strideE, info,
+                                       batch_count);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_spttrf_interleaved_batched(rocblas_handle handle,
+                                                    const rocblas_int n,
+                                                    float* D,
+                                                    const rocblas_int incd,
+                                                    const rocblas_stride strideD,
+                                                    float* E,
+                                                    const rocblas_int ince,
+                                                    const rocblas_stride strideE,
+                                                    rocblas_int* info,
+                                                    const rocblas_int batch_count)
+{
+    return rocsolver_pttrf_interleaved_batched_impl<float>(handle, n, D, incd, strideD, E, ince,
+                                                           strideE, info, batch_count);
+}
+
+rocblas_status rocsolver_dpttrf_interleaved_batched(rocblas_handle handle,
+                                                    const rocblas_int n,
+                                                    double* D,
+                                                    const rocblas_int incd,
+                                                    const rocblas_stride strideD,
+                                                    double* E,
+                                                    const rocblas_int ince,
+                                                    const rocblas_stride strideE,
+                                                    rocblas_int* info,
+                                                    const rocblas_int batch_count)
+{
+    return rocsolver_pttrf_interleaved_batched_impl<double>(handle, n, D, incd, strideD, E, ince,
+                                                            strideE, info, batch_count);
+}
+
+rocblas_status rocsolver_cpttrf_interleaved_batched(rocblas_handle handle,
+                                                    const rocblas_int n,
+                                                    float* D,
+                                                    const rocblas_int incd,
+                                                    const rocblas_stride strideD,
+                                                    rocblas_float_complex* E,
+                                                    const rocblas_int ince,
+                                                    const rocblas_stride strideE,
+                                                    rocblas_int* info,
+                                                    const rocblas_int batch_count)
+{
+    return rocsolver_pttrf_interleaved_batched_impl<rocblas_float_complex>(
+        handle, n, D, incd, strideD, E, ince, strideE, info, batch_count);
+}
+
+rocblas_status rocsolver_zpttrf_interleaved_batched(rocblas_handle handle,
+                                                    const rocblas_int n,
+                                                    double* D,
+                                                    const rocblas_int incd,
+                                                    const rocblas_stride strideD,
+                                                    rocblas_double_complex* E,
+                                                    const rocblas_int ince,
+                                                    const rocblas_stride strideE,
+                                                    rocblas_int* info,
+                                                    const rocblas_int batch_count)
+{
+    return rocsolver_pttrf_interleaved_batched_impl<rocblas_double_complex>(
+        handle, n, D, incd, strideD, E, ince, strideE, info, batch_count);
+}
+
+} // extern C
@@ -0,0 +1,155 @@
+/*****************************************************************************
+ * Derived from the BSD3-licensed
+ * LAPACK routine (version 3.7.0) --
+ *     Univ. of Tennessee, Univ. of California Berkeley,
+ *     Univ. of Colorado Denver and NAG Ltd..
+ *     December 2016
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "lapack_device_functions.hpp"
+#include "rocblas.hpp"
+#include "rocsolver/rocsolver.h"
+
+/** PTTRS_KERNEL solves A*X = B using the factorization A = L*D*L' computed by PTTRF. Each thread
+    solves the system of one matrix of the batch for one right-hand side. If info is not null,
+    the instances with info != 0 (matrices that are not positive definite) are skipped. **/
+template <typename T, typename S>
+ROCSOLVER_KERNEL void pttrs_kernel(const rocblas_int n,
+                                   S* DA,
+                                   const rocblas_int incd,
+                                   const rocblas_stride strideD,
+                                   T* EA,
+                                   const rocblas_int ince,
+                                   const rocblas_stride strideE,
+                                   T* BA,
+                                   const rocblas_int incb,
+                                   const rocblas_int ldb,
+                                   const rocblas_stride strideB,
+                                   const rocblas_int* info,
+                                   const rocblas_int batch_count)
+{
+    rocblas_int bid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int rhs = hipBlockIdx_y;
+    if(bid >= batch_count)
+        return;
+    if(info && info[bid] != 0)
+        return;
+
+    // batch instance
+    S* D = DA + bid * strideD;
+    T* E = EA + bid * strideE;
+    T* x = BA + bid * strideB + rhs * ldb;
+
+    // solve L*Y = B, overwriting B with Y
+    T xi = x[0];
+    for(rocblas_int i = 1; i < n; i++)
+    {
+        xi = x[i * incb] - xi * E[(i - 1) * ince];
+        x[i * incb] = xi;
+    }
+
+    // solve D*L'*X = Y, overwriting B with X
+    xi = xi / D[(n - 1) * incd];
+    x[(n - 1) * incb] = xi;
+    for(rocblas_int i = n - 2; i >= 0; i--)
+    {
+        xi = x[i * incb] / D[i * incd] - xi * conj(E[i * ince]);
+        x[i * incb] = xi;
+    }
+}
+
+template <typename T, typename S>
+rocblas_status rocsolver_pttrs_argCheck(rocblas_handle handle,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        S* D,
+                                        T* E,
+                                        T* B,
+                                        const rocblas_int ldb,
+                                        const rocblas_int batch_count,
+                                        const rocblas_int incd = 1,
+                                        const rocblas_int ince = 1,
+                                        const rocblas_int incb = 1)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    if(n < 0 || nrhs < 0 || batch_count < 0 || incd < 1 || ince < 1)
+        return rocblas_status_invalid_size;
+    if(incb < 1 || ldb < incb * n)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if((n && !D) || (n > 1 && !E) || (n && nrhs && !B))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+template <typename T, typename S>
+rocblas_status rocsolver_pttrs_template(rocblas_handle handle,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        S* D,
+                                        const rocblas_int incd,
+                                        const rocblas_stride strideD,
+                                        T* E,
+                                        const rocblas_int ince,
+                                        const rocblas_stride strideE,
+                                        T* B,
+                                        const rocblas_int incb,
+                                        const rocblas_int ldb,
+                                        const rocblas_stride strideB,
+                                        const rocblas_int batch_count,
+                                        const rocblas_int* info = nullptr)
+{
+    ROCSOLVER_ENTER("pttrs", "n:", n, "nrhs:", nrhs, "incd:", incd, "ince:", ince, "incb:", incb,
+                    "ldb:", ldb, "bc:", batch_count);
+
+    // quick return
+    if(n == 0 || nrhs == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+    ROCSOLVER_LAUNCH_KERNEL(pttrs_kernel<T>, dim3(blocks, nrhs, 1), dim3(BS1, 1, 1), 0, stream, n,
+                            D, incd, strideD, E, ince, strideE, B, incb, ldb, strideB, info,
+                            batch_count);
+
+    return rocblas_status_success;
+}
@@ -0,0 +1,142 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#include "roclapack_pttrs.hpp"
+
+template <typename T, typename S>
+rocblas_status rocsolver_pttrs_strided_batched_impl(rocblas_handle handle,
+                                                    const rocblas_int n,
+                                                    const rocblas_int nrhs,
+                                                    S* D,
+                                                    const rocblas_stride strideD,
+                                                    T* E,
+                                                    const rocblas_stride strideE,
+                                                    T* B,
+                                                    const rocblas_int ldb,
+                                                    const rocblas_stride strideB,
+                                                    const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER_TOP("pttrs_strided_batched", "-n", n, "--nrhs", nrhs, "--strideD", strideD,
+                        "--strideE", strideE, "--ldb", ldb, "--strideB", strideB, "--batch_count",
+                        batch_count);
+
+    if(!handle)
+        return rocblas_status_invalid_handle;
+
+    // the elements of each system are stored contiguously
+    rocblas_int incd = 1;
+    rocblas_int ince = 1;
+    rocblas_int incb = 1;
+
+    // argument checking
+    rocblas_status st = rocsolver_pttrs_argCheck(handle, n, nrhs, D, E, B, ldb, batch_count, incd,
+                                                 ince, incb);
+    if(st != rocblas_status_continue)
+        return st;
+
+    // this function does not require memory work space
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_size_unchanged;
+
+    // execution
+    return rocsolver_pttrs_template<T>(handle, n, nrhs, D, incd, strideD, E, ince, strideE, B, incb,
+                                       ldb, strideB, batch_count);
+}
+
+/*
+ * ===========================================================================
+ *    C wrapper
+ * ===========================================================================
+ */
+
+extern "C" {
+
+rocblas_status rocsolver_spttrs_strided_batched(rocblas_handle handle,
+                                                const rocblas_int n,
+                                                const rocblas_int nrhs,
+                                                float* D,
+                                                const rocblas_stride strideD,
+                                                float* E,
+                                                const rocblas_stride strideE,
+                                                float* B,
+                                                const rocblas_int ldb,
+                                                const rocblas_stride strideB,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_pttrs_strided_batched_impl<float>(handle, n, nrhs, D, strideD, E, strideE, B,
+                                                       ldb, strideB, batch_count);
+}
+
+rocblas_status rocsolver_dpttrs_strided_batched(rocblas_handle handle,
+                                                const rocblas_int n,
+                                                const rocblas_int nrhs,
+                                                double* D,
+                                                const rocblas_stride strideD,
+                                                double* E,
+                                                const rocblas_stride strideE,
+                                                double* B,
+                                                const rocblas_int ldb,
+                                                const rocblas_stride strideB,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_pttrs_strided_batched_impl<double>(handle, n, nrhs, D, strideD, E, strideE, B,
+                                                        ldb, strideB, batch_count);
+}
+
+rocblas_status rocsolver_cpttrs_strided_batched(rocblas_handle handle,
+                                                const rocblas_int n,
+                                                const rocblas_int nrhs,
+                                                float* D,
+                                                const rocblas_stride strideD,
+                                                rocblas_float_complex* E,
+                                                const rocblas_stride strideE,
+                                                rocblas_float_complex* B,
+                                                const rocblas_int ldb,
+                                                const rocblas_stride strideB,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_pttrs_strided_batched_impl<rocblas_float_complex>(
+        handle, n, nrhs, D, strideD, E, strideE, B, ldb, strideB, batch_count);
+}
+
+rocblas_status rocsolver_zpttrs_strided_batched(rocblas_handle handle,
+                                                const rocblas_int n,
+                                                const rocblas_int nrhs,
+                                                double* D,
+                                                const rocblas_stride strideD,
+                                                rocblas_double_complex* E,
+                                                const rocblas_stride strideE,
+                                                rocblas_double_complex* B,
+                                                const rocblas_int ldb,
+                                                const rocblas_stride strideB,
+                                                const rocblas_int batch_count)
+{
+    return rocsolver_pttrs_strided_batched_impl<rocblas_double_complex>(
+        handle, n, nrhs, D, strideD, E, strideE, B, ldb, strideB, batch_count);
+}
+
+} // extern C
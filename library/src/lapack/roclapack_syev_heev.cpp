@@ -75,7 +75,7 @@ rocblas_status rocsolver_syev_heev_impl(rocblas_handle handle,
                                                    &size_tmptau_trfact, &size_tau, &size_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work_stack,
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_scalars, size_work_stack,
                                                       size_Abyx_norms_tmptr, size_tmptau_trfact,
                                                       size_tau, size_workArr);
 
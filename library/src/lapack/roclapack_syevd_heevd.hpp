@@ -39,6 +39,8 @@
 #include "roclapack_syev_heev.hpp"
 #include "roclapack_sytrd_hetrd.hpp"
 #include "rocsolver/rocsolver.h"
+#include "rocsolver_handle_state.hpp"
+#include "rocsolver_workspace_breakdown.hpp"
 
 /** Helper to calculate workspace sizes **/
 template <bool BATCHED, typename T, typename S>
@@ -80,16 +82,25 @@ void rocsolver_syevd_heevd_getMemorySize(const rocblas_evect evect,
     // requirements for tridiagonalization (sytrd/hetrd)
     rocsolver_sytrd_hetrd_getMemorySize<BATCHED, T>(n, batch_count, size_scalars, &w11, &w21, &t1,
                                                     &unused);
+    rocsolver_workspace_breakdown::record_subcall(
+        "sytrd_hetrd", {{"work1", w11}, {"work2", w21}, {"tmptau_W", t1}});
 
     if(evect == rocblas_evect_original)
     {
         // extra requirements for computing eigenvalues and vectors (stedc)
         rocsolver_stedc_getMemorySize<BATCHED, T, S>(rocblas_evect_tridiagonal, n, batch_count, &w12,
                                                      &w22, &w31, size_tmpz, size_splits, &unused);
+        rocsolver_workspace_breakdown::record_subcall("stedc", {{"work1", w12},
+                                                                {"work2", w22},
+                                                                {"work3", w31},
+                                                                {"tmpz", *size_tmpz},
+                                                                {"splits", *size_splits}});
 
         // extra requirements for ormtr/unmtr
         rocsolver_ormtr_unmtr_getMemorySize<BATCHED, T>(rocblas_side_left, uplo, n, n, batch_count,
                                                         &unused, &w13, &w23, &w32, &unused);
+        rocsolver_workspace_breakdown::record_subcall(
+            "ormtr_unmtr", {{"work1", w13}, {"work2", w23}, {"work3", w32}});
 
         *size_work3 = std::max(w31, w32);
     }
@@ -97,6 +108,7 @@ void rocsolver_syevd_heevd_getMemorySize(const rocblas_evect evect,
     {
         // extra requirements for computing only the eigenvalues (sterf)
         rocsolver_sterf_getMemorySize<T>(n, batch_count, &w12);
+        rocsolver_workspace_breakdown::record_subcall("sterf", {{"work1", w12}});
 
         *size_work3 = 0;
         *size_tmpz = 0;
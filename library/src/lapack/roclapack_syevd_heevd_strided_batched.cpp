@@ -79,10 +79,33 @@ rocblas_status rocsolver_syevd_heevd_strided_batched_impl(rocblas_handle handle,
         &size_tmpz, &size_splits, &size_tmptau_W, &size_tau, &size_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work1, size_work2,
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_scalars, size_work1, size_work2,
                                                       size_work3, size_tmpz, size_splits,
                                                       size_tmptau_W, size_tau, size_workArr);
 
+    // budgeted execution: if the workspace exceeds the budget set for the handle,
+    // the batch is split in chunks
+    rocblas_int chunk = batch_count;
+    size_t budget = rocsolver_handle_state_map::workspace_budget(handle);
+    if(budget > 0
+       && rocsolver_workspace_size({size_scalars, size_work1, size_work2, size_work3, size_tmpz,
+                                    size_splits, size_tmptau_W, size_tau, size_workArr})
+           > budget)
+    {
+        auto chunk_size = [&](rocblas_int bc) {
+            rocsolver_syevd_heevd_getMemorySize<false, T, S>(
+                evect, uplo, n, bc, &size_scalars, &size_work1, &size_work2, &size_work3,
+                &size_tmpz, &size_splits, &size_tmptau_W, &size_tau, &size_workArr);
+            return rocsolver_workspace_size({size_scalars, size_work1, size_work2, size_work3,
+                                             size_tmpz, size_splits, size_tmptau_W, size_tau,
+                                             size_workArr});
+        };
+        chunk = rocsolver_plan_batch_chunk(budget, batch_count, chunk_size);
+        if(chunk == 0)
+            return rocblas_status_memory_error;
+        chunk_size(chunk);
+    }
+
     // memory workspace allocation
     void *scalars, *work1, *work2, *work3, *tmpz, *splits, *tmptau_W, *tau, *workArr;
     rocblas_device_malloc mem(handle, size_scalars, size_work1, size_work2, size_work3, size_tmpz,
@@ -104,10 +127,18 @@ rocblas_status rocsolver_syevd_heevd_strided_batched_impl(rocblas_handle handle,
         init_scalars(handle, (T*)scalars);
 
     // execution
-    return rocsolver_syevd_heevd_template<false, true, T>(
-        handle, evect, uplo, n, A, shiftA, lda, strideA, D, strideD, E, strideE, info, batch_count,
-        (T*)scalars, work1, work2, work3, (S*)tmpz, (rocblas_int*)splits, (T*)tmptau_W, (T*)tau,
-        (T**)workArr);
+    for(rocblas_int b = 0; b < batch_count; b += chunk)
+    {
+        st = rocsolver_syevd_heevd_template<false, true, T>(
+            handle, evect, uplo, n, A + b * strideA, shiftA, lda, strideA, D + b * strideD, strideD,
+            E + b * strideE, strideE, info + b, std::min(chunk, batch_count - b), (T*)scalars,
+            work1, work2, work3, (S*)tmpz, (rocblas_int*)splits, (T*)tmptau_W, (T*)tau,
+            (T**)workArr);
+        if(st != rocblas_status_success)
+            return st;
+    }
+
+    return rocblas_status_success;
 }
 
 /*
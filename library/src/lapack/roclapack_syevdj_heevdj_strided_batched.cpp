@@ -81,7 +81,7 @@ rocblas_status rocsolver_syevdj_heevdj_strided_batched_impl(rocblas_handle handl
         &size_workSplits, &size_work1, &size_work2, &size_work3, &size_work4, &size_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(
             handle, size_scalars, size_workE, size_workTau, size_workVec, size_workSplits,
             size_work1, size_work2, size_work3, size_work4, size_workArr);
 
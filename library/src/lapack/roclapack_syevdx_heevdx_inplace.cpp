@@ -33,6 +33,10 @@
  *    exists to provide a syevdx/heevdx method with a signature identical to
  *    the cuSOLVER implementation, for use exclusively in hipSOLVER.
  *
+ *    The number of eigenvalues is returned in host memory (and the stream is
+ *    synchronized), unless capture-safe mode is enabled for the handle, in
+ *    which case nev must point to device memory.
+ *
  *    TODO: The current implementation is based on syevx. It will need to be
  *    updated to syevdx at a later date.
  * ===========================================================================
@@ -90,7 +94,7 @@ rocblas_status rocsolver_syevdx_heevdx_inplace_impl(rocblas_handle handle,
         &size_tau, &size_nev, &size_nsplit_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work1, size_work2,
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_scalars, size_work1, size_work2,
                                                       size_work3, size_work4, size_work5, size_work6,
                                                       size_D, size_E, size_iblock, size_isplit_map,
                                                       size_tau, size_nev, size_nsplit_workArr);
@@ -39,6 +39,7 @@
 #include "roclapack_syevx_heevx.hpp"
 #include "roclapack_sytrd_hetrd.hpp"
 #include "rocsolver/rocsolver.h"
+#include "rocsolver_handle_state.hpp"
 
 /** Argument checking **/
 template <typename T, typename S>
@@ -234,7 +235,12 @@ rocblas_status rocsolver_syevdx_heevdx_inplace_template(rocblas_handle handle,
         dim3 threads(BS1, 1, 1);
         ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, info, batch_count, 0);
 
-        memset(h_nev, 0, sizeof(rocblas_int) * batch_count);
+        // (in capture-safe mode, nev is on the device)
+        if(rocsolver_handle_state_map::capture_safe_enabled(handle))
+            ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, h_nev, batch_count,
+                                    0);
+        else
+            memset(h_nev, 0, sizeof(rocblas_int) * batch_count);
         return rocblas_status_success;
     }
 
@@ -287,8 +293,14 @@ rocblas_status rocsolver_syevdx_heevdx_inplace_template(rocblas_handle handle,
                                 A, shiftA, lda, strideA, (rocblas_int*)nullptr, 0, info, isplit_map);
     }
 
-    // copy nev from device to host
-    if(h_nev)
+    // copy nev from device to host (in capture-safe mode, nev is on the device and the
+    // stream is not synchronized)
+    if(h_nev && rocsolver_handle_state_map::capture_safe_enabled(handle))
+    {
+        HIP_CHECK(hipMemcpyAsync(h_nev, d_nev, sizeof(rocblas_int) * batch_count,
+                                 hipMemcpyDeviceToDevice, stream));
+    }
+    else if(h_nev)
     {
         HIP_CHECK(hipMemcpyAsync(h_nev, d_nev, sizeof(rocblas_int) * batch_count,
                                  hipMemcpyDeviceToHost, stream));
@@ -72,7 +72,7 @@ rocblas_status rocsolver_syevj_heevj_impl(rocblas_handle handle,
                                                      &size_completed);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_Acpy, size_J, size_norms,
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_Acpy, size_J, size_norms,
                                                       size_top, size_bottom, size_completed);
 
     // memory workspace allocation
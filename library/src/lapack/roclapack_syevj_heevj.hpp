@@ -38,6 +38,7 @@
 #include "rocblas.hpp"
 #include "roclapack_syev_heev.hpp"
 #include "rocsolver/rocsolver.h"
+#include "rocsolver_handle_state.hpp"
 
 /************** Kernels and device functions for small size*******************/
 /*****************************************************************************/
@@ -453,7 +454,8 @@ ROCSOLVER_KERNEL void __launch_bounds__(SYEVJ_BDIM) syevj_small_kernel(const roc
 /*****************************************************************************/
 
 /** SYEVJ_INIT copies A to Acpy, calculates the residual norm of the matrix, and
-    initializes the top/bottom pairs.
+    initializes the top/bottom pairs. The instances that have not converged are pushed
+    into the queue (which must have been reset).
 
     Call this kernel with batch_count groups in y, and any number of threads in x. **/
 template <typename T, typename S, typename U>
@@ -471,7 +473,8 @@ ROCSOLVER_KERNEL void syevj_init(const rocblas_evect evect,
                                  S* norms,
                                  rocblas_int* top,
                                  rocblas_int* bottom,
-                                 rocblas_int* completed)
+                                 rocblas_int* completed,
+                                 rocblas_int* queue)
 {
     rocblas_int tid = hipThreadIdx_x;
     rocblas_int bid = hipBlockIdx_y;
@@ -567,6 +570,8 @@ ROCSOLVER_KERNEL void syevj_init(const rocblas_evect evect,
             completed[bid + 1] = 1;
             atomicAdd(completed, 1);
         }
+        else
+            rocsolver_queue_push(queue, bid);
     }
 
     // initialize top/bottom pairs
@@ -586,9 +591,10 @@ ROCSOLVER_KERNEL void syevj_init(const rocblas_evect evect,
     in parallel, so long as the rotations do not conflict between threads. We use top/bottom pairs
     to obtain i's and j's that do not conflict, and cycle them to cover all off-diagonal indices.
 
-    Call this kernel with batch_count blocks in z, and BS2 / 2 threads in x and y. Each thread block
-    will work on a separate diagonal block; for a matrix consisting of b * b blocks, use b thread
-    blocks in x. **/
+    Call this kernel with any number of blocks in z (see rocsolver_queue_groups), and BS2 / 2
+    threads in x and y. Each thread block will work on a separate diagonal block; for a matrix
+    consisting of b * b blocks, use b thread blocks in x. The blocks in z loop over the batch
+    instances in the queue. **/
 template <typename T, typename S, typename U>
 ROCSOLVER_KERNEL void syevj_diag_kernel(const rocblas_int n,
                                         U AA,
@@ -597,15 +603,10 @@ ROCSOLVER_KERNEL void syevj_diag_kernel(const rocblas_int n,
                                         const rocblas_stride strideA,
                                         const S eps,
                                         T* JA,
-                                        rocblas_int* completed)
+                                        const rocblas_int* queue)
 {
     rocblas_int tix = hipThreadIdx_x;
     rocblas_int tiy = hipThreadIdx_y;
-    rocblas_int bid = hipBlockIdx_z;
-    rocblas_int jid = bid * hipGridDim_x + hipBlockIdx_x;
-
-    if(completed[bid + 1])
-        return;
 
     rocblas_int nb_max = 2 * hipBlockDim_x;
     rocblas_int offset = hipBlockIdx_x * nb_max;
@@ -614,21 +615,18 @@ ROCSOLVER_KERNEL void syevj_diag_kernel(const rocblas_int n,
     S c, mag, f, g, r, s;
     T s1, s2, aij, temp1, temp2;
     rocblas_int i, j, k;
-    rocblas_int xx1 = 2 * tix, xx2 = xx1 + 1;
+    rocblas_int xx1, xx2;
     rocblas_int yy1 = 2 * tiy, yy2 = yy1 + 1;
-    rocblas_int x1 = xx1 + offset, x2 = x1 + 1;
+    rocblas_int x1 = 2 * tix + offset, x2 = x1 + 1;
     rocblas_int y1 = yy1 + offset, y2 = y1 + 1;
 
     rocblas_int half_n = (n - 1) / 2 + 1;
     rocblas_int nb = std::min(2 * half_n - offset, nb_max);
     rocblas_int half_nb = nb / 2;
 
-    if(tix >= half_nb || tiy >= half_nb)
-        return;
-
-    // array pointers
-    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
-    T* J = (JA ? JA + (jid * nb_max * nb_max) : nullptr);
+    // threads outside of the block only take part in the barriers, as every thread of the
+    // group must reach every __syncthreads() in each iteration of the queue loop
+    const bool valid = (tix < half_nb && tiy < half_nb);
 
     // shared memory
     extern __shared__ double lmem[];
@@ -637,145 +635,164 @@ ROCSOLVER_KERNEL void syevj_diag_kernel(const rocblas_int n,
     rocblas_int* sh_top = reinterpret_cast<rocblas_int*>(sh_sines + half_nb);
     rocblas_int* sh_bottom = sh_top + half_nb;
 
-    // initialize J to the identity
-    if(J)
-    {
-        J[xx1 + yy1 * nb_max] = (xx1 == yy1 ? 1 : 0);
-        J[xx1 + yy2 * nb_max] = 0;
-        J[xx2 + yy1 * nb_max] = 0;
-        J[xx2 + yy2 * nb_max] = (xx2 == yy2 ? 1 : 0);
-    }
+    S small_num = get_safemin<S>() / eps;
 
-    // initialize top/bottom
-    if(tiy == 0)
+    // process the queued instances (those that have not converged yet)
+    for(rocblas_int q = hipBlockIdx_z; q < rocsolver_queue_size(queue); q += hipGridDim_z)
     {
-        sh_top[tix] = x1;
-        sh_bottom[tix] = x2;
-    }
+        rocblas_int bid = rocsolver_queue_entry(queue, q);
+        rocblas_int jid = bid * hipGridDim_x + hipBlockIdx_x;
+        xx1 = 2 * tix;
+        xx2 = xx1 + 1;
 
-    S small_num = get_safemin<S>() / eps;
+        // array pointers
+        T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+        T* J = (JA ? JA + (jid * nb_max * nb_max) : nullptr);
 
-    // for each off-diagonal element (indexed using top/bottom pairs), calculate the Jacobi rotation and apply it to A
-    i = x1;
-    j = x2;
-    for(k = 0; k < nb - 1; k++)
-    {
-        if(tiy == 0 && i < n && j < n)
+        // initialize J to the identity
+        if(valid && J)
+        {
+            J[xx1 + yy1 * nb_max] = (xx1 == yy1 ? 1 : 0);
+            J[xx1 + yy2 * nb_max] = 0;
+            J[xx2 + yy1 * nb_max] = 0;
+            J[xx2 + yy2 * nb_max] = (xx2 == yy2 ? 1 : 0);
+        }
+
+        // initialize top/bottom
+        if(valid && tiy == 0)
         {
-            aij = A[i + j * lda];
-            mag = std::abs(aij);
+            sh_top[tix] = x1;
+            sh_bottom[tix] = x2;
+        }
 
-            // calculate rotation J
-            if(mag * mag < small_num)
+        // for each off-diagonal element (indexed using top/bottom pairs), calculate the Jacobi
+        // rotation and apply it to A
+        i = x1;
+        j = x2;
+        for(k = 0; k < nb - 1; k++)
+        {
+            if(valid && tiy == 0 && i < n && j < n)
             {
-                c = 1;
-                s1 = 0;
+                aij = A[i + j * lda];
+                mag = std::abs(aij);
+
+                // calculate rotation J
+                if(mag * mag < small_num)
+                {
+                    c = 1;
+                    s1 = 0;
+                }
+                else
+                {
+                    g = 2 * mag;
+                    f = std::real(A[j + j * lda] - A[i + i * lda]);
+                    f += (f < 0) ? -std::hypot(f, g) : std::hypot(f, g);
+                    lartg(f, g, c, s, r);
+                    s1 = s * aij / mag;
+                }
+
+                sh_cosines[tix] = c;
+                sh_sines[tix] = s1;
             }
-            else
+            __syncthreads();
+
+            if(valid && i < n && j < n)
             {
-                g = 2 * mag;
-                f = std::real(A[j + j * lda] - A[i + i * lda]);
-                f += (f < 0) ? -std::hypot(f, g) : std::hypot(f, g);
-                lartg(f, g, c, s, r);
-                s1 = s * aij / mag;
-            }
+                c = sh_cosines[tix];
+                s1 = sh_sines[tix];
+                s2 = conj(s1);
 
-            sh_cosines[tix] = c;
-            sh_sines[tix] = s1;
-        }
-        __syncthreads();
+                // store J row-wise
+                if(J)
+                {
+                    xx1 = i - offset;
+                    xx2 = j - offset;
+                    temp1 = J[xx1 + yy1 * nb_max];
+                    temp2 = J[xx2 + yy1 * nb_max];
+                    J[xx1 + yy1 * nb_max] = c * temp1 + s2 * temp2;
+                    J[xx2 + yy1 * nb_max] = -s1 * temp1 + c * temp2;
+
+                    if(y2 < n)
+                    {
+                        temp1 = J[xx1 + yy2 * nb_max];
+                        temp2 = J[xx2 + yy2 * nb_max];
+                        J[xx1 + yy2 * nb_max] = c * temp1 + s2 * temp2;
+                        J[xx2 + yy2 * nb_max] = -s1 * temp1 + c * temp2;
+                    }
+                }
 
-        if(i < n && j < n)
-        {
-            c = sh_cosines[tix];
-            s1 = sh_sines[tix];
-            s2 = conj(s1);
+                // apply J from the right
+                temp1 = A[y1 + i * lda];
+                temp2 = A[y1 + j * lda];
+                A[y1 + i * lda] = c * temp1 + s2 * temp2;
+                A[y1 + j * lda] = -s1 * temp1 + c * temp2;
+
+                if(y2 < n)
+                {
+                    temp1 = A[y2 + i * lda];
+                    temp2 = A[y2 + j * lda];
+                    A[y2 + i * lda] = c * temp1 + s2 * temp2;
+                    A[y2 + j * lda] = -s1 * temp1 + c * temp2;
+                }
+            }
+            __syncthreads();
 
-            // store J row-wise
-            if(J)
+            if(valid && i < n && j < n)
             {
-                xx1 = i - offset;
-                xx2 = j - offset;
-                temp1 = J[xx1 + yy1 * nb_max];
-                temp2 = J[xx2 + yy1 * nb_max];
-                J[xx1 + yy1 * nb_max] = c * temp1 + s2 * temp2;
-                J[xx2 + yy1 * nb_max] = -s1 * temp1 + c * temp2;
+                // apply J' from the left
+                temp1 = A[i + y1 * lda];
+                temp2 = A[j + y1 * lda];
+                A[i + y1 * lda] = c * temp1 + s1 * temp2;
+                A[j + y1 * lda] = -s2 * temp1 + c * temp2;
 
                 if(y2 < n)
                 {
-                    temp1 = J[xx1 + yy2 * nb_max];
-                    temp2 = J[xx2 + yy2 * nb_max];
-                    J[xx1 + yy2 * nb_max] = c * temp1 + s2 * temp2;
-                    J[xx2 + yy2 * nb_max] = -s1 * temp1 + c * temp2;
+                    temp1 = A[i + y2 * lda];
+                    temp2 = A[j + y2 * lda];
+                    A[i + y2 * lda] = c * temp1 + s1 * temp2;
+                    A[j + y2 * lda] = -s2 * temp1 + c * temp2;
                 }
             }
+            __syncthreads();
 
-            // apply J from the right
-            temp1 = A[y1 + i * lda];
-            temp2 = A[y1 + j * lda];
-            A[y1 + i * lda] = c * temp1 + s2 * temp2;
-            A[y1 + j * lda] = -s1 * temp1 + c * temp2;
-
-            if(y2 < n)
+            if(valid && tiy == 0 && i < n && j < n)
             {
-                temp1 = A[y2 + i * lda];
-                temp2 = A[y2 + j * lda];
-                A[y2 + i * lda] = c * temp1 + s2 * temp2;
-                A[y2 + j * lda] = -s1 * temp1 + c * temp2;
+                // round aij and aji to zero
+                A[i + j * lda] = 0;
+                A[j + i * lda] = 0;
             }
-        }
-        __syncthreads();
 
-        if(i < n && j < n)
-        {
-            // apply J' from the left
-            temp1 = A[i + y1 * lda];
-            temp2 = A[j + y1 * lda];
-            A[i + y1 * lda] = c * temp1 + s1 * temp2;
-            A[j + y1 * lda] = -s2 * temp1 + c * temp2;
-
-            if(y2 < n)
+            // cycle top/bottom pairs
+            if(valid)
             {
-                temp1 = A[i + y2 * lda];
-                temp2 = A[j + y2 * lda];
-                A[i + y2 * lda] = c * temp1 + s1 * temp2;
-                A[j + y2 * lda] = -s2 * temp1 + c * temp2;
+                if(tix == 1)
+                    i = sh_bottom[0];
+                else if(tix > 1)
+                    i = sh_top[tix - 1];
+                if(tix == half_nb - 1)
+                    j = sh_top[half_nb - 1];
+                else
+                    j = sh_bottom[tix + 1];
             }
-        }
-        __syncthreads();
+            __syncthreads();
 
-        if(tiy == 0 && i < n && j < n)
-        {
-            // round aij and aji to zero
-            A[i + j * lda] = 0;
-            A[j + i * lda] = 0;
+            if(valid && tiy == 0)
+            {
+                sh_top[tix] = i;
+                sh_bottom[tix] = j;
+            }
         }
-
-        // cycle top/bottom pairs
-        if(tix == 1)
-            i = sh_bottom[0];
-        else if(tix > 1)
-            i = sh_top[tix - 1];
-        if(tix == half_nb - 1)
-            j = sh_top[half_nb - 1];
-        else
-            j = sh_bottom[tix + 1];
         __syncthreads();
-
-        if(tiy == 0)
-        {
-            sh_top[tix] = i;
-            sh_bottom[tix] = j;
-        }
     }
 }
 
 /** SYEVJ_DIAG_ROTATE rotates off-diagonal blocks of size nb <= BS2 using the rotations calculated
     by SYEVJ_DIAG_KERNEL.
 
-    Call this kernel with batch_count groups in z, and BS2 threads in x and y. Each thread group
-    will work on a separate off-diagonal block; for a matrix consisting of b * b blocks, use b groups
-    in x and b - 1 groups in y. **/
+    Call this kernel with any number of groups in z (see rocsolver_queue_groups), and BS2 threads
+    in x and y. Each thread group will work on a separate off-diagonal block; for a matrix
+    consisting of b * b blocks, use b groups in x and b - 1 groups in y. The groups in z loop over
+    the batch instances in the queue. **/
 template <bool APPLY_LEFT, typename T, typename S, typename U>
 ROCSOLVER_KERNEL void syevj_diag_rotate(const bool skip_block,
                                         const rocblas_int n,
@@ -784,17 +801,14 @@ ROCSOLVER_KERNEL void syevj_diag_rotate(const bool skip_block,
                                         const rocblas_int lda,
                                         const rocblas_stride strideA,
                                         T* JA,
-                                        rocblas_int* completed)
+                                        const rocblas_int* queue)
 {
     rocblas_int tix = hipThreadIdx_x;
     rocblas_int tiy = hipThreadIdx_y;
     rocblas_int bix = hipBlockIdx_x;
     rocblas_int biy = hipBlockIdx_y;
-    rocblas_int bid = hipBlockIdx_z;
-    rocblas_int jid = bid * hipGridDim_x + bix;
 
-    if(completed[bid + 1])
-        return;
+    // (the whole group leaves, so no barrier is reached by only part of it)
     if(skip_block && bix == biy)
         return;
 
@@ -810,29 +824,44 @@ ROCSOLVER_KERNEL void syevj_diag_rotate(const bool skip_block,
 
     rocblas_int nb = std::min(n - offsetx, nb_max);
 
-    if(x >= n || y >= n)
-        return;
-
-    // array pointers
-    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
-    T* J = JA + (jid * nb_max * nb_max);
+    // threads outside of the matrix only take part in the barriers
+    const bool valid = (x < n && y < n);
 
-    // apply J to the current block
-    if(!APPLY_LEFT)
-    {
-        temp = 0;
-        for(k = 0; k < nb; k++)
-            temp += J[tix + k * nb_max] * A[y + (k + offsetx) * lda];
-        __syncthreads();
-        A[y + x * lda] = temp;
-    }
-    else
+    // process the queued instances (those that have not converged yet)
+    for(rocblas_int q = hipBlockIdx_z; q < rocsolver_queue_size(queue); q += hipGridDim_z)
     {
-        temp = 0;
-        for(k = 0; k < nb; k++)
-            temp += conj(J[tix + k * nb_max]) * A[(k + offsetx) + y * lda];
-        __syncthreads();
-        A[x + y * lda] = temp;
+        rocblas_int bid = rocsolver_queue_entry(queue, q);
+        rocblas_int jid = bid * hipGridDim_x + bix;
+
+        // array pointers
+        T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+        T* J = JA + (jid * nb_max * nb_max);
+
+        // apply J to the current block
+        if(!APPLY_LEFT)
+        {
+            temp = 0;
+            if(valid)
+            {
+                for(k = 0; k < nb; k++)
+                    temp += J[tix + k * nb_max] * A[y + (k + offsetx) * lda];
+            }
+            __syncthreads();
+            if(valid)
+                A[y + x * lda] = temp;
+        }
+        else
+        {
+            temp = 0;
+            if(valid)
+            {
+                for(k = 0; k < nb; k++)
+                    temp += conj(J[tix + k * nb_max]) * A[(k + offsetx) + y * lda];
+            }
+            __syncthreads();
+            if(valid)
+                A[x + y * lda] = temp;
+        }
     }
 }
 
@@ -847,8 +876,9 @@ ROCSOLVER_KERNEL void syevj_diag_rotate(const bool skip_block,
     rotations do not conflict between thread groups. We use block-level top/bottom pairs
     to obtain off-diagonal block indices that do not conflict.
 
-    Call this kernel with batch_count groups in z, and BS2 threads in x and y. Each thread group
-    will work on four matrix blocks; for a matrix consisting of b * b blocks, use b / 2 groups in x. **/
+    Call this kernel with any number of groups in z (see rocsolver_queue_groups), and BS2 threads
+    in x and y. Each thread group will work on four matrix blocks; for a matrix consisting of b * b
+    blocks, use b / 2 groups in x. The groups in z loop over the batch instances in the queue. **/
 template <typename T, typename S, typename U>
 ROCSOLVER_KERNEL void syevj_offd_kernel(const rocblas_int blocks,
                                         const rocblas_int n,
@@ -860,16 +890,12 @@ ROCSOLVER_KERNEL void syevj_offd_kernel(const rocblas_int blocks,
                                         T* JA,
                                         rocblas_int* top,
                                         rocblas_int* bottom,
-                                        rocblas_int* completed)
+                                        const rocblas_int* queue)
 {
     rocblas_int tix = hipThreadIdx_x;
     rocblas_int tiy = hipThreadIdx_y;
-    rocblas_int bid = hipBlockIdx_z;
-    rocblas_int jid = bid * hipGridDim_x + hipBlockIdx_x;
-
-    if(completed[bid + 1])
-        return;
 
+    // (the whole group leaves, so no barrier is reached by only part of it)
     rocblas_int i = top[hipBlockIdx_x];
     rocblas_int j = bottom[hipBlockIdx_x];
     if(i >= blocks || j >= blocks)
@@ -886,138 +912,150 @@ ROCSOLVER_KERNEL void syevj_offd_kernel(const rocblas_int blocks,
     S c, mag, f, g, r, s;
     T s1, s2, aij, temp1, temp2;
     rocblas_int k;
-    rocblas_int xx1 = tix, xx2 = tix + nb_max;
+    rocblas_int xx1, xx2;
     rocblas_int yy1 = tiy, yy2 = tiy + nb_max;
     rocblas_int x1 = tix + offseti, x2 = tix + offsetj;
     rocblas_int y1 = tiy + offseti, y2 = tiy + offsetj;
 
-    if(y1 >= n)
-        return;
-
-    // array pointers
-    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
-    T* J = (JA ? JA + (jid * 4 * nb_max * nb_max) : nullptr);
+    // threads outside of the matrix only take part in the barriers, as every thread of the
+    // group must reach every __syncthreads() in each iteration of the queue loop
+    const bool valid = (y1 < n);
 
     // shared memory
     extern __shared__ double lmem[];
     S* sh_cosines = reinterpret_cast<S*>(lmem);
     T* sh_sines = reinterpret_cast<T*>(sh_cosines + nb_max);
 
-    // initialize J to the identity
-    if(J)
-    {
-        J[xx1 + yy1 * ldj] = (xx1 == yy1 ? 1 : 0);
-        J[xx1 + yy2 * ldj] = 0;
-        J[xx2 + yy1 * ldj] = 0;
-        J[xx2 + yy2 * ldj] = (xx2 == yy2 ? 1 : 0);
-    }
-
     S small_num = get_safemin<S>() / eps;
 
-    // for each element, calculate the Jacobi rotation and apply it to A
-    for(k = 0; k < nb_max; k++)
+    // process the queued instances (those that have not converged yet)
+    for(rocblas_int q = hipBlockIdx_z; q < rocsolver_queue_size(queue); q += hipGridDim_z)
     {
-        // get element indices
-        i = x1;
-        j = (tix + k) % nb_max + offsetj;
+        rocblas_int bid = rocsolver_queue_entry(queue, q);
+        rocblas_int jid = bid * hipGridDim_x + hipBlockIdx_x;
+        xx1 = tix;
+        xx2 = tix + nb_max;
+
+        // array pointers
+        T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+        T* J = (JA ? JA + (jid * 4 * nb_max * nb_max) : nullptr);
 
-        if(tiy == 0 && i < n && j < n)
+        // initialize J to the identity
+        if(valid && J)
         {
-            aij = A[i + j * lda];
-            mag = std::abs(aij);
+            J[xx1 + yy1 * ldj] = (xx1 == yy1 ? 1 : 0);
+            J[xx1 + yy2 * ldj] = 0;
+            J[xx2 + yy1 * ldj] = 0;
+            J[xx2 + yy2 * ldj] = (xx2 == yy2 ? 1 : 0);
+        }
 
-            // calculate rotation J
-            if(mag * mag < small_num)
-            {
-                c = 1;
-                s1 = 0;
-            }
-            else
+        // for each element, calculate the Jacobi rotation and apply it to A
+        for(k = 0; k < nb_max; k++)
+        {
+            // get element indices
+            i = x1;
+            j = (tix + k) % nb_max + offsetj;
+
+            if(valid && tiy == 0 && i < n && j < n)
             {
-                g = 2 * mag;
-                f = std::real(A[j + j * lda] - A[i + i * lda]);
-                f += (f < 0) ? -std::hypot(f, g) : std::hypot(f, g);
-                lartg(f, g, c, s, r);
-                s1 = s * aij / mag;
-            }
+                aij = A[i + j * lda];
+                mag = std::abs(aij);
 
-            sh_cosines[tix] = c;
-            sh_sines[tix] = s1;
-        }
-        __syncthreads();
+                // calculate rotation J
+                if(mag * mag < small_num)
+                {
+                    c = 1;
+                    s1 = 0;
+                }
+                else
+                {
+                    g = 2 * mag;
+                    f = std::real(A[j + j * lda] - A[i + i * lda]);
+                    f += (f < 0) ? -std::hypot(f, g) : std::hypot(f, g);
+                    lartg(f, g, c, s, r);
+                    s1 = s * aij / mag;
+                }
 
-        if(i < n && j < n)
-        {
-            c = sh_cosines[tix];
-            s1 = sh_sines[tix];
-            s2 = conj(s1);
+                sh_cosines[tix] = c;
+                sh_sines[tix] = s1;
+            }
+            __syncthreads();
 
-            // store J row-wise
-            if(J)
+            if(valid && i < n && j < n)
             {
-                xx1 = i - offseti;
-                xx2 = j - offsetj + nb_max;
-                temp1 = J[xx1 + yy1 * ldj];
-                temp2 = J[xx2 + yy1 * ldj];
-                J[xx1 + yy1 * ldj] = c * temp1 + s2 * temp2;
-                J[xx2 + yy1 * ldj] = -s1 * temp1 + c * temp2;
+                c = sh_cosines[tix];
+                s1 = sh_sines[tix];
+                s2 = conj(s1);
+
+                // store J row-wise
+                if(J)
+                {
+                    xx1 = i - offseti;
+                    xx2 = j - offsetj + nb_max;
+                    temp1 = J[xx1 + yy1 * ldj];
+                    temp2 = J[xx2 + yy1 * ldj];
+                    J[xx1 + yy1 * ldj] = c * temp1 + s2 * temp2;
+                    J[xx2 + yy1 * ldj] = -s1 * temp1 + c * temp2;
+
+                    if(y2 < n)
+                    {
+                        temp1 = J[xx1 + yy2 * ldj];
+                        temp2 = J[xx2 + yy2 * ldj];
+                        J[xx1 + yy2 * ldj] = c * temp1 + s2 * temp2;
+                        J[xx2 + yy2 * ldj] = -s1 * temp1 + c * temp2;
+                    }
+                }
+
+                // apply J from the right
+                temp1 = A[y1 + i * lda];
+                temp2 = A[y1 + j * lda];
+                A[y1 + i * lda] = c * temp1 + s2 * temp2;
+                A[y1 + j * lda] = -s1 * temp1 + c * temp2;
 
                 if(y2 < n)
                 {
-                    temp1 = J[xx1 + yy2 * ldj];
-                    temp2 = J[xx2 + yy2 * ldj];
-                    J[xx1 + yy2 * ldj] = c * temp1 + s2 * temp2;
-                    J[xx2 + yy2 * ldj] = -s1 * temp1 + c * temp2;
+                    temp1 = A[y2 + i * lda];
+                    temp2 = A[y2 + j * lda];
+                    A[y2 + i * lda] = c * temp1 + s2 * temp2;
+                    A[y2 + j * lda] = -s1 * temp1 + c * temp2;
                 }
             }
+            __syncthreads();
 
-            // apply J from the right
-            temp1 = A[y1 + i * lda];
-            temp2 = A[y1 + j * lda];
-            A[y1 + i * lda] = c * temp1 + s2 * temp2;
-            A[y1 + j * lda] = -s1 * temp1 + c * temp2;
-
-            if(y2 < n)
+            if(valid && i < n && j < n)
             {
-                temp1 = A[y2 + i * lda];
-                temp2 = A[y2 + j * lda];
-                A[y2 + i * lda] = c * temp1 + s2 * temp2;
-                A[y2 + j * lda] = -s1 * temp1 + c * temp2;
-            }
-        }
-        __syncthreads();
+                // apply J' from the left
+                temp1 = A[i + y1 * lda];
+                temp2 = A[j + y1 * lda];
+                A[i + y1 * lda] = c * temp1 + s1 * temp2;
+                A[j + y1 * lda] = -s2 * temp1 + c * temp2;
 
-        if(i < n && j < n)
-        {
-            // apply J' from the left
-            temp1 = A[i + y1 * lda];
-            temp2 = A[j + y1 * lda];
-            A[i + y1 * lda] = c * temp1 + s1 * temp2;
-            A[j + y1 * lda] = -s2 * temp1 + c * temp2;
+                if(y2 < n)
+                {
+                    temp1 = A[i + y2 * lda];
+                    temp2 = A[j + y2 * lda];
+                    A[i + y2 * lda] = c * temp1 + s1 * temp2;
+                    A[j + y2 * lda] = -s2 * temp1 + c * temp2;
+                }
+            }
+            __syncthreads();
 
-            if(y2 < n)
+            if(valid && tiy == 0 && j < n)
             {
-                temp1 = A[i + y2 * lda];
-                temp2 = A[j + y2 * lda];
-                A[i + y2 * lda] = c * temp1 + s1 * temp2;
-                A[j + y2 * lda] = -s2 * temp1 + c * temp2;
+                // round aij and aji to zero
+                A[i + j * lda] = 0;
+                A[j + i * lda] = 0;
             }
         }
         __syncthreads();
-
-        if(tiy == 0 && j < n)
-        {
-            // round aij and aji to zero
-            A[i + j * lda] = 0;
-            A[j + i * lda] = 0;
-        }
     }
 }
 
 /** SYEVJ_OFFD_ROTATE rotates off-diagonal blocks using the rotations calculated by SYEVJ_OFFD_KERNEL.
 
-    Call this kernel with batch_count groups in z, 2*BS2 threads in x and BS2/2 threads in y.
-    For a matrix consisting of b * b blocks, use b / 2 groups in x and 2(b - 2) groups in y. **/
+    Call this kernel with any number of groups in z (see rocsolver_queue_groups), 2*BS2 threads in
+    x and BS2/2 threads in y. For a matrix consisting of b * b blocks, use b / 2 groups in x and
+    2(b - 2) groups in y. The groups in z loop over the batch instances in the queue. **/
 template <bool APPLY_LEFT, typename T, typename S, typename U>
 ROCSOLVER_KERNEL void syevj_offd_rotate(const bool skip_block,
                                         const rocblas_int blocks,
@@ -1029,18 +1067,14 @@ ROCSOLVER_KERNEL void syevj_offd_rotate(const bool skip_block,
                                         T* JA,
                                         rocblas_int* top,
                                         rocblas_int* bottom,
-                                        rocblas_int* completed)
+                                        const rocblas_int* queue)
 {
     rocblas_int tix = hipThreadIdx_x;
     rocblas_int tiy = hipThreadIdx_y;
     rocblas_int bix = hipBlockIdx_x;
     rocblas_int biy = hipBlockIdx_y;
-    rocblas_int bid = hipBlockIdx_z;
-    rocblas_int jid = bid * hipGridDim_x + hipBlockIdx_x;
-
-    if(completed[bid + 1])
-        return;
 
+    // (the whole group leaves, so no barrier is reached by only part of it)
     rocblas_int i = top[bix];
     rocblas_int j = bottom[bix];
     if(i >= blocks || j >= blocks)
@@ -1065,33 +1099,48 @@ ROCSOLVER_KERNEL void syevj_offd_rotate(const bool skip_block,
 
     rocblas_int nb = std::min(n - offsetj, nb_max);
 
-    if(x >= n || y >= n)
-        return;
-
-    // array pointers
-    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
-    T* J = JA + (jid * 4 * nb_max * nb_max);
+    // threads outside of the matrix only take part in the barriers
+    const bool valid = (x < n && y < n);
 
-    // apply J to the current block
-    if(!APPLY_LEFT)
-    {
-        temp = 0;
-        for(k = 0; k < nb_max; k++)
-            temp += J[tix + k * ldj] * A[y + (k + offseti) * lda];
-        for(k = 0; k < nb; k++)
-            temp += J[tix + (k + nb_max) * ldj] * A[y + (k + offsetj) * lda];
-        __syncthreads();
-        A[y + x * lda] = temp;
-    }
-    else
+    // process the queued instances (those that have not converged yet)
+    for(rocblas_int q = hipBlockIdx_z; q < rocsolver_queue_size(queue); q += hipGridDim_z)
     {
-        temp = 0;
-        for(k = 0; k < nb_max; k++)
-            temp += conj(J[tix + k * ldj]) * A[(k + offseti) + y * lda];
-        for(k = 0; k < nb; k++)
-            temp += conj(J[tix + (k + nb_max) * ldj]) * A[(k + offsetj) + y * lda];
-        __syncthreads();
-        A[x + y * lda] = temp;
+        rocblas_int bid = rocsolver_queue_entry(queue, q);
+        rocblas_int jid = bid * hipGridDim_x + bix;
+
+        // array pointers
+        T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+        T* J = JA + (jid * 4 * nb_max * nb_max);
+
+        // apply J to the current block
+        if(!APPLY_LEFT)
+        {
+            temp = 0;
+            if(valid)
+            {
+                for(k = 0; k < nb_max; k++)
+                    temp += J[tix + k * ldj] * A[y + (k + offseti) * lda];
+                for(k = 0; k < nb; k++)
+                    temp += J[tix + (k + nb_max) * ldj] * A[y + (k + offsetj) * lda];
+            }
+            __syncthreads();
+            if(valid)
+                A[y + x * lda] = temp;
+        }
+        else
+        {
+            temp = 0;
+            if(valid)
+            {
+                for(k = 0; k < nb_max; k++)
+                    temp += conj(J[tix + k * ldj]) * A[(k + offseti) + y * lda];
+                for(k = 0; k < nb; k++)
+                    temp += conj(J[tix + (k + nb_max) * ldj]) * A[(k + offsetj) + y * lda];
+            }
+            __syncthreads();
+            if(valid)
+                A[x + y * lda] = temp;
+        }
     }
 }
 
@@ -1153,54 +1202,63 @@ ROCSOLVER_KERNEL void
     }
 }
 
-/** SYEVJ_CALC_NORM calculates the residual norm of the matrix.
+/** SYEVJ_CALC_NORM calculates the residual norm of the matrix, and pushes the instances that
+    have not converged yet into the queue of the next sweep (next_queue must have been reset).
 
-    Call this kernel with batch_count groups in y, and any number of threads in x. **/
+    Call this kernel with any number of groups in y (see rocsolver_queue_groups), and any number
+    of threads in x. The groups in y loop over the batch instances in the queue. **/
 template <typename T, typename S>
 ROCSOLVER_KERNEL void syevj_calc_norm(const rocblas_int n,
                                       const rocblas_int sweeps,
                                       S* residual,
                                       T* AcpyA,
                                       S* norms,
-                                      rocblas_int* completed)
+                                      rocblas_int* completed,
+                                      const rocblas_int* queue,
+                                      rocblas_int* next_queue)
 {
     rocblas_int tid = hipThreadIdx_x;
-    rocblas_int bid = hipBlockIdx_y;
     rocblas_int dimx = hipBlockDim_x;
 
-    if(completed[bid + 1])
-        return;
-
     // local variables
     rocblas_int i, j;
 
-    // array pointers
-    T* Acpy = AcpyA + bid * n * n;
-
     // shared memory
     extern __shared__ double lmem[];
     S* sh_res = reinterpret_cast<S*>(lmem);
 
-    S local_res = 0;
-    for(i = tid; i < n; i += dimx)
+    // process the queued instances (those that had not converged before this sweep)
+    for(rocblas_int q = hipBlockIdx_y; q < rocsolver_queue_size(queue); q += hipGridDim_y)
     {
-        for(j = 0; j < i; j++)
-            local_res += 2 * std::norm(Acpy[i + j * n]);
-    }
-    sh_res[tid] = local_res;
-    __syncthreads();
+        rocblas_int bid = rocsolver_queue_entry(queue, q);
 
-    if(tid == 0)
-    {
-        for(i = 1; i < std::min(n, dimx); i++)
-            local_res += sh_res[i];
+        // array pointers
+        T* Acpy = AcpyA + bid * n * n;
 
-        residual[bid] = local_res;
-        if(local_res < norms[bid])
+        S local_res = 0;
+        for(i = tid; i < n; i += dimx)
         {
-            completed[bid + 1] = sweeps + 1;
-            atomicAdd(completed, 1);
+            for(j = 0; j < i; j++)
+                local_res += 2 * std::norm(Acpy[i + j * n]);
         }
+        sh_res[tid] = local_res;
+        __syncthreads();
+
+        if(tid == 0)
+        {
+            for(i = 1; i < std::min(n, dimx); i++)
+                local_res += sh_res[i];
+
+            residual[bid] = local_res;
+            if(local_res < norms[bid])
+            {
+                completed[bid + 1] = sweeps + 1;
+                atomicAdd(completed, 1);
+            }
+            else
+                rocsolver_queue_push(next_queue, bid);
+        }
+        __syncthreads();
     }
 }
 
@@ -1354,8 +1412,9 @@ void rocsolver_syevj_heevj_getMemorySize(const rocblas_evect evect,
     *size_top = sizeof(rocblas_int) * half_blocks * batch_count;
     *size_bottom = sizeof(rocblas_int) * half_blocks * batch_count;
 
-    // size of temporary workspace to indicate problem completion
-    *size_completed = sizeof(rocblas_int) * (batch_count + 1);
+    // size of temporary workspace to indicate problem completion, and to hold the queues
+    // of the instances that have not converged (for the current and the next sweep)
+    *size_completed = sizeof(rocblas_int) * (batch_count + 1 + 2 * (batch_count + 2));
 }
 
 /** Argument checking **/
@@ -1422,7 +1481,8 @@ rocblas_status rocsolver_syevj_heevj_template(rocblas_handle handle,
                                               S* norms,
                                               rocblas_int* top,
                                               rocblas_int* bottom,
-                                              rocblas_int* completed)
+                                              rocblas_int* completed,
+                                              const bool host_sync = true)
 {
     ROCSOLVER_ENTER("syevj_heevj", "esort:", esort, "evect:", evect, "uplo:", uplo, "n:", n,
                     "shiftA:", shiftA, "lda:", lda, "abstol:", abstol, "max_sweeps:", max_sweeps,
@@ -1484,17 +1544,11 @@ rocblas_status rocsolver_syevj_heevj_template(rocblas_handle handle,
         // *** USE BLOCKED KERNELS ***
 
         // kernel dimensions
-        rocblas_int blocksReset = batch_count / BS1 + 1;
         rocblas_int blocks = (n - 1) / BS2 + 1;
         rocblas_int even_blocks = blocks + blocks % 2;
         rocblas_int half_blocks = even_blocks / 2;
 
-        dim3 gridReset(blocksReset, 1, 1);
         dim3 grid(1, batch_count, 1);
-        dim3 gridDK(blocks, 1, batch_count);
-        dim3 gridDR(blocks, blocks, batch_count);
-        dim3 gridOK(half_blocks, 1, batch_count);
-        dim3 gridOR(half_blocks, 2 * blocks, batch_count);
         dim3 gridPairs(1, 1, 1);
         dim3 threadsReset(BS1, 1, 1);
         dim3 threads(BS1, 1, 1);
@@ -1514,54 +1568,84 @@ rocblas_status rocsolver_syevj_heevj_template(rocblas_handle handle,
         rocblas_int h_sweeps = 0;
         rocblas_int h_completed = 0;
 
-        // set completed = 0
-        ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threadsReset, 0, stream, completed,
-                                batch_count + 1, 0);
-
-        // copy A to Acpy, set A to identity (if applicable), compute initial residual, and
-        // initialize top/bottom pairs (if applicable)
+        // in capture-safe mode, or if host_sync is false (e.g. when the batch is split across
+        // streams, so that the chunks can overlap), all the sweeps are enqueued (the queues of
+        // the later sweeps may be empty)
+        const bool check_host
+            = host_sync && !rocsolver_handle_state_map::capture_safe_enabled(handle);
+
+        // the kernels of each sweep are persistent: they only process the instances in the
+        // queue of the sweep, which holds those that have not converged yet
+        const int cu_count = rocsolver_handle_state_map::get_arch(handle).cu_count;
+        rocblas_int* queue = completed + batch_count + 1;
+        rocblas_int* next_queue = queue + batch_count + 2;
+
+        // set completed = 0 and reset the queues
+        rocblas_int size_completed = batch_count + 1 + 2 * (batch_count + 2);
+        ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3((size_completed - 1) / BS1 + 1, 1, 1),
+                                threadsReset, 0, stream, completed, size_completed, 0);
+
+        // copy A to Acpy, set A to identity (if applicable), compute initial residual,
+        // initialize top/bottom pairs (if applicable), and queue the unconverged instances
         ROCSOLVER_LAUNCH_KERNEL(syevj_init<T>, grid, threads, lmemsizeInit, stream, evect, uplo,
                                 half_blocks, n, A, shiftA, lda, strideA, atol, residual, Acpy,
-                                norms, top, bottom, completed);
+                                norms, top, bottom, completed, queue);
 
         while(h_sweeps < max_sweeps)
         {
             // if all instances in the batch have finished, exit the loop
-            HIP_CHECK(hipMemcpyAsync(&h_completed, completed, sizeof(rocblas_int),
-                                     hipMemcpyDeviceToHost, stream));
-            HIP_CHECK(hipStreamSynchronize(stream));
+            if(check_host)
+            {
+                HIP_CHECK(hipMemcpyAsync(&h_completed, completed, sizeof(rocblas_int),
+                                         hipMemcpyDeviceToHost, stream));
+                HIP_CHECK(hipStreamSynchronize(stream));
+
+                if(h_completed == batch_count)
+                    break;
+            }
 
-            if(h_completed == batch_count)
-                break;
+            // size the persistent grids to the instances that are still active. In capture-safe
+            // mode this number is not known in the host, and the grids are sized for the whole
+            // batch instead. In both cases the grids are capped at the groups that fit at once
+            // on the device (see rocsolver_queue_groups), and a group with no queued instances
+            // left returns right away, so that the sweeps enqueued after the whole batch has
+            // converged cost a bounded number of empty groups
+            rocblas_int active = (check_host ? batch_count - h_completed : batch_count);
+            dim3 gridDK(blocks, 1, rocsolver_queue_groups(active, blocks, cu_count));
+            dim3 gridDR(blocks, blocks, rocsolver_queue_groups(active, blocks * blocks, cu_count));
+            dim3 gridOK(half_blocks, 1, rocsolver_queue_groups(active, half_blocks, cu_count));
+            dim3 gridOR(half_blocks, 2 * blocks,
+                        rocsolver_queue_groups(active, 2 * blocks * half_blocks, cu_count));
+            dim3 gridNorm(1, rocsolver_queue_groups(active, 1, cu_count), 1);
 
             // decompose diagonal blocks
             ROCSOLVER_LAUNCH_KERNEL(syevj_diag_kernel<T>, gridDK, threadsDK, lmemsizeDK, stream, n,
-                                    Acpy, 0, n, n * n, eps, J, completed);
+                                    Acpy, 0, n, n * n, eps, J, queue);
 
             // apply rotations calculated by diag_kernel
             ROCSOLVER_LAUNCH_KERNEL((syevj_diag_rotate<false, T, S>), gridDR, threadsDR, lmemsizeDR,
-                                    stream, true, n, Acpy, 0, n, n * n, J, completed);
+                                    stream, true, n, Acpy, 0, n, n * n, J, queue);
             ROCSOLVER_LAUNCH_KERNEL((syevj_diag_rotate<true, T, S>), gridDR, threadsDR, lmemsizeDR,
-                                    stream, true, n, Acpy, 0, n, n * n, J, completed);
+                                    stream, true, n, Acpy, 0, n, n * n, J, queue);
 
             // update eigenvectors
             if(ev)
                 ROCSOLVER_LAUNCH_KERNEL((syevj_diag_rotate<false, T, S>), gridDR, threadsDR,
                                         lmemsizeDR, stream, false, n, A, shiftA, lda, strideA, J,
-                                        completed);
+                                        queue);
 
             if(half_blocks == 1)
             {
                 // decompose off-diagonal block
                 ROCSOLVER_LAUNCH_KERNEL((syevj_offd_kernel<T, S>), gridOK, threadsOK, lmemsizeOK,
                                         stream, blocks, n, Acpy, 0, n, n * n, eps,
-                                        (ev ? J : nullptr), top, bottom, completed);
+                                        (ev ? J : nullptr), top, bottom, queue);
 
                 // update eigenvectors
                 if(ev)
                     ROCSOLVER_LAUNCH_KERNEL((syevj_offd_rotate<false, T, S>), gridOR, threadsOR, 0,
                                             stream, false, blocks, n, A, shiftA, lda, strideA, J,
-                                            top, bottom, completed);
+                                            top, bottom, queue);
             }
             else
             {
@@ -1570,21 +1654,21 @@ rocblas_status rocsolver_syevj_heevj_template(rocblas_handle handle,
                     // decompose off-diagonal blocks, indexed by top/bottom pairs
                     ROCSOLVER_LAUNCH_KERNEL((syevj_offd_kernel<T, S>), gridOK, threadsOK,
                                             lmemsizeOK, stream, blocks, n, Acpy, 0, n, n * n, eps,
-                                            J, top, bottom, completed);
+                                            J, top, bottom, queue);
 
                     // apply rotations calculated by offd_kernel
                     ROCSOLVER_LAUNCH_KERNEL((syevj_offd_rotate<false, T, S>), gridOR, threadsOR, 0,
                                             stream, true, blocks, n, Acpy, 0, n, n * n, J, top,
-                                            bottom, completed);
+                                            bottom, queue);
                     ROCSOLVER_LAUNCH_KERNEL((syevj_offd_rotate<true, T, S>), gridOR, threadsOR, 0,
                                             stream, true, blocks, n, Acpy, 0, n, n * n, J, top,
-                                            bottom, completed);
+                                            bottom, queue);
 
                     // update eigenvectors
                     if(ev)
                         ROCSOLVER_LAUNCH_KERNEL((syevj_offd_rotate<false, T, S>), gridOR, threadsOR,
                                                 0, stream, false, blocks, n, A, shiftA, lda,
-                                                strideA, J, top, bottom, completed);
+                                                strideA, J, top, bottom, queue);
 
                     // cycle top/bottom pairs
                     ROCSOLVER_LAUNCH_KERNEL(syevj_cycle_pairs<T>, gridPairs, threads, lmemsizePairs,
@@ -1592,10 +1676,13 @@ rocblas_status rocsolver_syevj_heevj_template(rocblas_handle handle,
                 }
             }
 
-            // compute new residual
+            // compute new residual and queue the instances that have not converged yet
             h_sweeps++;
-            ROCSOLVER_LAUNCH_KERNEL(syevj_calc_norm<T>, grid, threads, lmemsizeInit, stream, n,
-                                    h_sweeps, residual, Acpy, norms, completed);
+            ROCSOLVER_LAUNCH_KERNEL(reset_info, dim3(1, 1, 1), threadsReset, 0, stream, next_queue,
+                                    2, 0);
+            ROCSOLVER_LAUNCH_KERNEL(syevj_calc_norm<T>, gridNorm, threads, lmemsizeInit, stream, n,
+                                    h_sweeps, residual, Acpy, norms, completed, queue, next_queue);
+            std::swap(queue, next_queue);
         }
 
         // set outputs and sort eigenvalues & vectors
@@ -26,6 +26,8 @@
  * *************************************************************************/
 
 #include "roclapack_syevj_heevj.hpp"
+#include "rocsolver_batch_streams.hpp"
+#include "rocsolver_info_summary.hpp"
 
 template <typename T, typename S, typename U>
 rocblas_status rocsolver_syevj_heevj_strided_batched_impl(rocblas_handle handle,
@@ -62,16 +64,27 @@ rocblas_status rocsolver_syevj_heevj_strided_batched_impl(rocblas_handle handle,
     // working with unshifted arrays
     rocblas_int shiftA = 0;
 
+    // the batch can be split across the stream pool of the handle,
+    // in which case every stream needs its own workspace
+    rocblas_int chunk = rocsolver_batch_streams_chunk(handle, batch_count, SYEVJ_SPLIT_MIN_BATCH);
+    int nstreams = rocsolver_stream_split_count(batch_count, chunk);
+
     // memory workspace sizes:
-    // size of temporary workspace
+    // size of temporary workspace (per stream)
     size_t size_Acpy, size_J, size_norms, size_top, size_bottom, size_completed;
 
-    rocsolver_syevj_heevj_getMemorySize<false, T, S>(evect, uplo, n, batch_count, &size_Acpy,
-                                                     &size_J, &size_norms, &size_top, &size_bottom,
+    rocsolver_syevj_heevj_getMemorySize<false, T, S>(evect, uplo, n, chunk, &size_Acpy, &size_J,
+                                                     &size_norms, &size_top, &size_bottom,
                                                      &size_completed);
+    size_Acpy *= nstreams;
+    size_J *= nstreams;
+    size_norms *= nstreams;
+    size_top *= nstreams;
+    size_bottom *= nstreams;
+    size_completed *= nstreams;
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_Acpy, size_J, size_norms,
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_Acpy, size_J, size_norms,
                                                       size_top, size_bottom, size_completed);
 
     // memory workspace allocation
@@ -90,10 +103,25 @@ rocblas_status rocsolver_syevj_heevj_strided_batched_impl(rocblas_handle handle,
     completed = mem[5];
 
     // execution
-    return rocsolver_syevj_heevj_template<false, true, T>(
-        handle, esort, evect, uplo, n, A, shiftA, lda, strideA, abstol, residual, max_sweeps,
-        n_sweeps, W, strideW, info, batch_count, (T*)Acpy, (T*)J, (S*)norms, (rocblas_int*)top,
-        (rocblas_int*)bottom, (rocblas_int*)completed);
+    st = rocsolver_split_batch(
+        handle, batch_count, chunk, [&](int s, rocblas_int offset, rocblas_int bc) {
+            // workspace of stream s
+            auto ws = [&](void* p, size_t size) { return (char*)p + s * (size / nstreams); };
+
+            // (the chunks only overlap if they do not synchronize with the host)
+            return rocsolver_syevj_heevj_template<false, true, T>(
+                handle, esort, evect, uplo, n, A + offset * strideA, shiftA, lda, strideA, abstol,
+                residual + offset, max_sweeps, n_sweeps + offset, W + offset * strideW, strideW,
+                info + offset, bc, (T*)ws(Acpy, size_Acpy), (T*)ws(J, size_J),
+                (S*)ws(norms, size_norms), (rocblas_int*)ws(top, size_top),
+                (rocblas_int*)ws(bottom, size_bottom), (rocblas_int*)ws(completed, size_completed),
+                nstreams == 1);
+        });
+    if(st != rocblas_status_success)
+        return st;
+
+    // aggregate the info values of the batch
+    return rocsolver_info_summary(handle, info, batch_count);
 }
 
 /*
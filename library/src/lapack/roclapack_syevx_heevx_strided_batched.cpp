@@ -86,7 +86,7 @@ rocblas_status rocsolver_syevx_heevx_strided_batched_impl(rocblas_handle handle,
         &size_tau, &size_nsplit_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(
             handle, size_scalars, size_work1, size_work2, size_work3, size_work4, size_work5,
             size_work6, size_D, size_E, size_iblock, size_isplit_map, size_tau, size_nsplit_workArr);
 
@@ -68,7 +68,7 @@ rocblas_status rocsolver_sygs2_hegs2_impl(rocblas_handle handle,
                                                   &size_store_wcs, &size_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work,
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_scalars, size_work,
                                                       size_store_wcs, size_workArr);
 
     // memory workspace allocation
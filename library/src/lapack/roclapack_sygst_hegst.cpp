@@ -70,7 +70,7 @@ rocblas_status rocsolver_sygst_hegst_impl(rocblas_handle handle,
         &size_store_wcs_invA, &size_invA_arr, &optim_mem);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work_x_temp,
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_scalars, size_work_x_temp,
                                                       size_workArr_temp_arr, size_store_wcs_invA,
                                                       size_invA_arr);
 
@@ -80,7 +80,7 @@ rocblas_status rocsolver_sygv_hegv_impl(rocblas_handle handle,
         &size_work4, &size_pivots_workArr, &size_iinfo, &optim_mem);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work1, size_work2,
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_scalars, size_work1, size_work2,
                                                       size_work3, size_work4, size_pivots_workArr,
                                                       size_iinfo);
 
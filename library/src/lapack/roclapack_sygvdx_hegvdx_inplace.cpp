@@ -32,6 +32,10 @@
  *    sygvdx/hegvdx_inplace is not intended for inclusion in the public API. It
  *    exists to provide a sygvdx/hegvdx method with a signature identical to
  *    the cuSOLVER implementation, for use exclusively in hipSOLVER.
+ *
+ *    The number of eigenvalues is returned in host memory (and the stream is
+ *    synchronized), unless capture-safe mode is enabled for the handle, in
+ *    which case nev must point to device memory.
  * ===========================================================================
  */
 
@@ -97,7 +101,7 @@ rocblas_status rocsolver_sygvdx_hegvdx_inplace_impl(rocblas_handle handle,
         &size_tau, &size_nev, &size_work7_workArr, &size_iinfo, &optim_mem);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(
             handle, size_scalars, size_work1, size_work2, size_work3, size_work4, size_work5,
             size_work6, size_D, size_E, size_iblock, size_isplit, size_tau, size_nev,
             size_work7_workArr, size_iinfo);
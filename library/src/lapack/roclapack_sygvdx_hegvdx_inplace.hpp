@@ -249,7 +249,12 @@ rocblas_status rocsolver_sygvdx_hegvdx_inplace_template(rocblas_handle handle,
     // quick return with n = 0
     if(n == 0)
     {
-        memset(h_nev, 0, sizeof(rocblas_int) * batch_count);
+        // (in capture-safe mode, nev is on the device)
+        if(rocsolver_handle_state_map::capture_safe_enabled(handle))
+            ROCSOLVER_LAUNCH_KERNEL(reset_info, gridReset, threads, 0, stream, h_nev, batch_count,
+                                    0);
+        else
+            memset(h_nev, 0, sizeof(rocblas_int) * batch_count);
         return rocblas_status_success;
     }
 
@@ -317,8 +322,14 @@ rocblas_status rocsolver_sygvdx_hegvdx_inplace_template(rocblas_handle handle,
         }
     }
 
-    // copy nev from device to host
-    if(h_nev)
+    // copy nev from device to host (in capture-safe mode, nev is on the device and the
+    // stream is not synchronized)
+    if(h_nev && rocsolver_handle_state_map::capture_safe_enabled(handle))
+    {
+        HIP_CHECK(hipMemcpyAsync(h_nev, d_nev, sizeof(rocblas_int) * batch_count,
+                                 hipMemcpyDeviceToDevice, stream));
+    }
+    else if(h_nev)
     {
         HIP_CHECK(hipMemcpyAsync(h_nev, d_nev, sizeof(rocblas_int) * batch_count,
                                  hipMemcpyDeviceToHost, stream));
@@ -71,7 +71,7 @@ rocblas_status rocsolver_sytd2_hetd2_impl(rocblas_handle handle,
                                                   &size_norms, &size_tmptau, &size_workArr);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_scalars, size_work, size_norms,
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_scalars, size_work, size_norms,
                                                       size_tmptau, size_workArr);
 
     // memory workspace allocation
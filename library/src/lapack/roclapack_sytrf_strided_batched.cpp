@@ -60,7 +60,7 @@ rocblas_status rocsolver_sytrf_strided_batched_impl(rocblas_handle handle,
     rocsolver_sytrf_getMemorySize<T>(n, batch_count, &size_work);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_work);
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_work);
 
     // memory workspace allocation
     void* work;
@@ -358,7 +358,7 @@ rocblas_status rocsolver_trtri_template(rocblas_handle handle,
         // copy result to A if info is zero
         ROCSOLVER_LAUNCH_KERNEL((copy_mat<T>), dim3(blocks, blocks, batch_count), dim3(32, 32), 0,
                                 stream, copymat_from_buffer, n, n, A, shiftA, lda, strideA, tmpcopy,
-                                info_mask(info, info_mask::negate), uplo, diag);
+                                info_mask(info, info_mask<>::negate), uplo, diag);
     }
 
     else if(blk == 1)
@@ -0,0 +1,1021 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <rocprim/rocprim.hpp>
+#include <vector>
+
+#include "rocblas.hpp"
+#include "roclapack_geqrf.hpp"
+#include "roclapack_getrf.hpp"
+#include "roclapack_getrs.hpp"
+#include "roclapack_potrf.hpp"
+#include "rocsolver/rocsolver.h"
+#include "rocsolver_handle_state.hpp"
+#include "rocsolver_info_summary.hpp"
+
+/*
+ * ===========================================================================
+ *    Variable-size batches. The problems are sorted by size class on the device,
+ *    and the sizes and the resulting order are copied to the host with a single
+ *    synchronization. Every group of problems of the same class is executed with
+ *    the batched template of the corresponding function (which selects the
+ *    small-size kernels or the blocked algorithm for the group as usual). If all
+ *    the problems of a group have the same sizes, they are processed in place;
+ *    otherwise, they are copied into the workspace, padded to the largest sizes
+ *    of the group, and processed in chunks that fit in the padding workspace.
+ *    The groups are executed one after the other and share the workspace, which
+ *    is sized from the largest sizes given on the host, so that it can be queried
+ *    without reading the sizes from the device.
+ * ===========================================================================
+ */
+
+/** A group of problems of a variable-size batch in the same size class. The problems
+    are order[offset], ..., order[offset + count - 1]. dims holds the largest of each of
+    the K sizes among the problems; if padded is false, all the problems have the same
+    sizes. **/
+template <int K>
+struct rocsolver_vbatched_group
+{
+    std::array<rocblas_int, K> dims;
+    rocblas_int offset;
+    rocblas_int count;
+    bool padded;
+};
+
+template <int K>
+using rocsolver_vbatched_groups = std::vector<rocsolver_vbatched_group<K>>;
+
+/** Returns the upper bound of the size class of dimension d. Every interval [2^k, 2^(k+1))
+    is split into VBATCHED_CLASS_SPLIT classes of the same width (dimensions smaller than
+    2 * VBATCHED_CLASS_SPLIT are classes of their own). **/
+__host__ __device__ inline int64_t rocsolver_vbatched_class(const rocblas_int d)
+{
+    if(d <= 0)
+        return 0;
+
+    int64_t width = 1;
+    while(width * 2 * VBATCHED_CLASS_SPLIT <= d)
+        width *= 2;
+    return ((d + width - 1) / width) * width;
+}
+
+/** Returns the sort key of a problem whose size class is given by dimensions d0 and d1. **/
+__host__ __device__ inline uint64_t rocsolver_vbatched_key(const rocblas_int d0,
+                                                          const rocblas_int d1)
+{
+    return (uint64_t(rocsolver_vbatched_class(d0)) << 32) | uint64_t(rocsolver_vbatched_class(d1));
+}
+
+/** VBATCHED_CLASSIFY computes the sort keys of the problems of a batch, whose size classes
+    are given by the dimensions in d0 and d1 (d1 can be null). **/
+ROCSOLVER_KERNEL void vbatched_classify(uint64_t* keys,
+                                        rocblas_int* idx,
+                                        const rocblas_int* d0,
+                                        const rocblas_int* d1,
+                                        const rocblas_int batch_count)
+{
+    rocblas_int b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(b < batch_count)
+    {
+        keys[b] = rocsolver_vbatched_key(d0[b], d1 ? d1[b] : 0);
+        idx[b] = b;
+    }
+}
+
+/** Returns the sizes of the arrays used to sort the problems of a batch: the keys (input
+    and output of the sort), the indices of the problems and the temporary storage of
+    rocPRIM. **/
+inline void rocsolver_vbatched_sort_layout(const rocblas_int batch_count,
+                                           size_t* size_keys,
+                                           size_t* size_idx,
+                                           size_t* size_temp)
+{
+    auto align = [](size_t size) { return ((size + 255) / 256) * 256; };
+
+    *size_keys = align(sizeof(uint64_t) * batch_count);
+    *size_idx = align(sizeof(rocblas_int) * batch_count);
+    *size_temp = 0;
+    if(batch_count > 0)
+        (void)rocprim::radix_sort_pairs((void*)nullptr, *size_temp, (uint64_t*)nullptr,
+                                        (uint64_t*)nullptr, (rocblas_int*)nullptr,
+                                        (rocblas_int*)nullptr, batch_count);
+}
+
+/** Returns the size of the workspace used to sort the problems of a batch. **/
+inline void rocsolver_vbatched_sort_mem(const rocblas_int batch_count, size_t* size_sort)
+{
+    size_t size_keys, size_idx, size_temp;
+    rocsolver_vbatched_sort_layout(batch_count, &size_keys, &size_idx, &size_temp);
+    *size_sort = (batch_count > 0 ? 2 * size_keys + size_idx + size_temp : 0);
+}
+
+/** Returns the size of the workspace where the problems of the groups with different sizes
+    are padded, given the number of elements of the largest padded problem. Larger groups
+    are processed in chunks. **/
+template <typename T>
+size_t rocsolver_vbatched_pad_mem(const rocblas_int batch_count, const size_t elems)
+{
+    return sizeof(T)
+        * std::min(size_t(batch_count) * elems, std::max(size_t(VBATCHED_PAD_SIZE), elems));
+}
+
+/** Returns the number of padded problems of elems elements each that fit in the padding
+    workspace. **/
+template <typename T>
+rocblas_int
+    rocsolver_vbatched_chunk(const rocblas_int count, const size_t elems, const size_t size_pad)
+{
+    if(elems == 0)
+        return count;
+
+    size_t chunk = std::min(size_t(count), size_pad / (sizeof(T) * elems));
+    return rocblas_int(std::max(chunk, size_t(1)));
+}
+
+/** Sorts the problems of a variable-size batch by size class, on the device, and groups them.
+    The size class is given by the first NC of the K arrays of sizes (NC is 1 or 2). The
+    sizes and the order of the problems are copied to the host at once, and the sizes of
+    each problem are checked with invalid. The order of the problems within the groups is
+    left in dorder. This function synchronizes the stream of the handle; thus, it fails with
+    rocblas_status_not_implemented if capture-safe mode is enabled. **/
+template <typename T, int K, int NC, typename F>
+rocblas_status rocsolver_vbatched_sort(rocblas_handle handle,
+                                       const rocblas_int batch_count,
+                                       const std::array<const rocblas_int*, K>& dsizes,
+                                       F invalid,
+                                       void* work,
+                                       rocblas_int* dorder,
+                                       rocsolver_vbatched_groups<K>& groups)
+{
+    groups.clear();
+    if(batch_count == 0)
+        return rocblas_status_success;
+    if(rocsolver_handle_state_map::capture_safe_enabled(handle))
+        return rocblas_status_not_implemented;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // sort the problems by size class
+    size_t size_keys, size_idx, size_temp;
+    rocsolver_vbatched_sort_layout(batch_count, &size_keys, &size_idx, &size_temp);
+    char* ptr = (char*)work;
+    uint64_t* keys_in = (uint64_t*)ptr;
+    uint64_t* keys_out = (uint64_t*)(ptr + size_keys);
+    rocblas_int* idx = (rocblas_int*)(ptr + 2 * size_keys);
+    void* temp = ptr + 2 * size_keys + size_idx;
+
+    ROCSOLVER_LAUNCH_KERNEL(vbatched_classify, dim3((batch_count - 1) / BS1 + 1), dim3(BS1), 0,
+                            stream, keys_in, idx, dsizes[0], NC > 1 ? dsizes[1] : nullptr,
+                            batch_count);
+    HIP_CHECK(rocprim::radix_sort_pairs(temp, size_temp, keys_in, keys_out, idx, dorder,
+                                        batch_count, 0, 64, stream));
+
+    // copy the sizes and the order to the host
+    std::vector<rocblas_int> hsizes(K * size_t(batch_count));
+    std::vector<rocblas_int> order(batch_count);
+    for(int k = 0; k < K; ++k)
+        HIP_CHECK(hipMemcpyAsync(hsizes.data() + size_t(k) * batch_count, dsizes[k],
+                                 sizeof(rocblas_int) * batch_count, hipMemcpyDeviceToHost, stream));
+    HIP_CHECK(hipMemcpyAsync(order.data(), dorder, sizeof(rocblas_int) * batch_count,
+                             hipMemcpyDeviceToHost, stream));
+    HIP_CHECK(hipStreamSynchronize(stream));
+
+    auto dims = [&](rocblas_int b) {
+        std::array<rocblas_int, K> d;
+        for(int k = 0; k < K; ++k)
+            d[k] = hsizes[size_t(k) * batch_count + b];
+        return d;
+    };
+
+    for(rocblas_int b = 0; b < batch_count; ++b)
+        if(invalid(dims(b)))
+            return rocblas_status_invalid_size;
+
+    // the problems of a group are consecutive in the order
+    uint64_t key = 0;
+    for(rocblas_int b = 0; b < batch_count; ++b)
+    {
+        std::array<rocblas_int, K> d = dims(order[b]);
+        uint64_t k = rocsolver_vbatched_key(d[0], NC > 1 ? d[1] : 0);
+        if(groups.empty() || k != key)
+        {
+            groups.push_back({d, b, 0, false});
+            key = k;
+        }
+
+        auto& g = groups.back();
+        for(int j = 0; j < K; ++j)
+        {
+            if(d[j] != g.dims[j])
+                g.padded = true;
+            g.dims[j] = std::max(g.dims[j], d[j]);
+        }
+        g.count++;
+    }
+
+    return rocblas_status_success;
+}
+
+/** VBATCHED_GATHER_PTRS collects the pointers of the problems of a group:
+    out[b] = in[order[b]]. **/
+template <typename T>
+ROCSOLVER_KERNEL void vbatched_gather_ptrs(T** out,
+                                           T* const in[],
+                                           const rocblas_int* order,
+                                           const rocblas_int count)
+{
+    rocblas_int b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(b < count)
+        out[b] = in[order[b]];
+}
+
+/** VBATCHED_PAD copies the matrices of a group into the workspace, enlarging them to the
+    mm-by-nn size of the group: W_b is A_p (with p = order[b]) in its leading m[p]-by-n[p]
+    block, and zero elsewhere, except for ones on the diagonal below the rows of A_p if diag
+    is true. The leading min(m[p], n[p]) steps of the factorizations of W_b are those of A_p,
+    and the remaining steps never pivot rows into the block of A_p.
+    Call this kernel with dim3(ceil(mm / BS2), ceil(nn / BS2), count) groups of
+    dim3(BS2, BS2) threads. **/
+template <typename T>
+ROCSOLVER_KERNEL void vbatched_pad(T* W,
+                                   const rocblas_int ldw,
+                                   const rocblas_stride strideW,
+                                   T* const A[],
+                                   const rocblas_int* m,
+                                   const rocblas_int* n,
+                                   const rocblas_int* lda,
+                                   const rocblas_int* order,
+                                   const rocblas_int mm,
+                                   const rocblas_int nn,
+                                   const bool diag)
+{
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    rocblas_int b = hipBlockIdx_z;
+
+    if(i < mm && j < nn)
+    {
+        rocblas_int p = order[b];
+        T val = (diag && i == j && i >= m[p]) ? T(1) : T(0);
+        if(i < m[p] && j < n[p])
+            val = A[p][i + size_t(lda[p]) * j];
+        W[b * strideW + i + size_t(ldw) * j] = val;
+    }
+}
+
+/** VBATCHED_UNPAD is the inverse of VBATCHED_PAD: it copies the leading m[p]-by-n[p] block
+    of W_b back to A_p. **/
+template <typename T>
+ROCSOLVER_KERNEL void vbatched_unpad(T* const A[],
+                                     const rocblas_int* m,
+                                     const rocblas_int* n,
+                                     const rocblas_int* lda,
+                                     const T* W,
+                                     const rocblas_int ldw,
+                                     const rocblas_stride strideW,
+                                     const rocblas_int* order,
+                                     const rocblas_int mm,
+                                     const rocblas_int nn)
+{
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int j = hipBlockIdx_y * hipBlockDim_y + hipThreadIdx_y;
+    rocblas_int b = hipBlockIdx_z;
+
+    if(i < mm && j < nn)
+    {
+        rocblas_int p = order[b];
+        if(i < m[p] && j < n[p])
+            A[p][i + size_t(lda[p]) * j] = W[b * strideW + i + size_t(ldw) * j];
+    }
+}
+
+/** VBATCHED_SCATTER_VEC copies the vectors of a group, stored with stride in the workspace,
+    to the arrays of the problems: out[p][i] = in[b * stride + i], with p = order[b] and
+    i < min(m[p], n[p]) <= len. Call this kernel with dim3(ceil(len / BS1), count) groups of
+    BS1 threads. **/
+template <typename T>
+ROCSOLVER_KERNEL void vbatched_scatter_vec(T* const out[],
+                                           const T* in,
+                                           const rocblas_stride stride,
+                                           const rocblas_int len,
+                                           const rocblas_int* order,
+                                           const rocblas_int* m,
+                                           const rocblas_int* n)
+{
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int b = hipBlockIdx_y;
+
+    if(i < len)
+    {
+        rocblas_int p = order[b];
+        if(i < std::min(m[p], n[p]))
+            out[p][i] = in[b * stride + i];
+    }
+}
+
+/** VBATCHED_GATHER_IPIV collects the pivot indices of the problems of a group, completed with
+    the identity permutation up to length len: out[b * stride + i] = ipiv[p][i] if i < n[p]
+    (with p = order[b]), or i + 1 otherwise. Call this kernel with
+    dim3(ceil(len / BS1), count) groups of BS1 threads. **/
+ROCSOLVER_KERNEL void vbatched_gather_ipiv(rocblas_int* out,
+                                           const rocblas_stride stride,
+                                           const rocblas_int* const ipiv[],
+                                           const rocblas_int len,
+                                           const rocblas_int* order,
+                                           const rocblas_int* n)
+{
+    rocblas_int i = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int b = hipBlockIdx_y;
+
+    if(i < len)
+    {
+        rocblas_int p = order[b];
+        out[b * stride + i] = (i < n[p] ? ipiv[p][i] : i + 1);
+    }
+}
+
+/** VBATCHED_SCATTER_INFO copies the info values of a group to the info array of the
+    batch: info[p] = in[b], with p = order[b]. Values beyond min(m[p], n[p]) come from the
+    padding and are discarded. **/
+ROCSOLVER_KERNEL void vbatched_scatter_info(rocblas_int* info,
+                                            const rocblas_int* in,
+                                            const rocblas_int* order,
+                                            const rocblas_int count,
+                                            const rocblas_int* m,
+                                            const rocblas_int* n)
+{
+    rocblas_int b = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    if(b < count)
+    {
+        rocblas_int p = order[b];
+        info[p] = (in[b] > std::min(m[p], n[p]) ? 0 : in[b]);
+    }
+}
+
+/*
+ * ===========================================================================
+ *    GETRF_VBATCHED
+ * ===========================================================================
+ */
+
+template <typename T>
+rocblas_status rocsolver_getrf_vbatched_argCheck(rocblas_handle handle,
+                                                 const rocblas_int* m,
+                                                 const rocblas_int* n,
+                                                 const rocblas_int* lda,
+                                                 T A,
+                                                 rocblas_int* const ipiv[],
+                                                 rocblas_int* info,
+                                                 const rocblas_int max_m,
+                                                 const rocblas_int max_n,
+                                                 const rocblas_int batch_count)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    // (the sizes of each problem are checked once they are read from the device)
+    if(max_m < 0 || max_n < 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if(batch_count && (!m || !n || !lda || !A || !ipiv || !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+/** Return the sizes of the different workspace arrays. The requirements of the batched
+    template are those of batch_count problems of the largest sizes. **/
+template <typename T>
+void rocsolver_getrf_vbatched_getMemorySize(const rocblas_int max_m,
+                                            const rocblas_int max_n,
+                                            const rocblas_int batch_count,
+                                            size_t* size_scalars,
+                                            size_t* size_work1,
+                                            size_t* size_work2,
+                                            size_t* size_work3,
+                                            size_t* size_work4,
+                                            size_t* size_pivotval,
+                                            size_t* size_pivotidx,
+                                            size_t* size_iipiv,
+                                            size_t* size_iinfo,
+                                            size_t* size_sort,
+                                            size_t* size_order,
+                                            size_t* size_Aarr,
+                                            size_t* size_ipivinfo,
+                                            size_t* size_pad)
+{
+    bool optim_mem;
+    rocsolver_getrf_getMemorySize<true, false, T>(
+        max_m, max_n, true, batch_count, size_scalars, size_work1, size_work2, size_work3,
+        size_work4, size_pivotval, size_pivotidx, size_iipiv, size_iinfo, &optim_mem,
+        std::max(max_m, 1));
+
+    // the pivot indices of a group are followed by its info values
+    *size_ipivinfo = sizeof(rocblas_int) * (size_t(std::min(max_m, max_n)) + 1) * batch_count;
+
+    rocsolver_vbatched_sort_mem(batch_count, size_sort);
+    *size_order = sizeof(rocblas_int) * batch_count;
+    *size_Aarr = sizeof(T*) * batch_count;
+    *size_pad = rocsolver_vbatched_pad_mem<T>(batch_count, size_t(max_m) * max_n);
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_getrf_vbatched_template(rocblas_handle handle,
+                                                 const rocblas_int* m,
+                                                 const rocblas_int* n,
+                                                 U A,
+                                                 const rocblas_int* lda,
+                                                 rocblas_int* const ipiv[],
+                                                 rocblas_int* info,
+                                                 const rocsolver_vbatched_groups<3>& groups,
+                                                 T* scalars,
+                                                 void* work1,
+                                                 void* work2,
+                                                 void* work3,
+                                                 void* work4,
+                                                 T* pivotval,
+                                                 rocblas_int* pivotidx,
+                                                 rocblas_int* iipiv,
+                                                 rocblas_int* iinfo,
+                                                 rocblas_int* order,
+                                                 T** Aarr,
+                                                 rocblas_int* ipivinfo,
+                                                 T* pad,
+                                                 const size_t* size_work,
+                                                 const size_t size_pad)
+{
+    ROCSOLVER_ENTER("getrf_vbatched", "groups:", groups.size());
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    for(auto& g : groups)
+    {
+        rocblas_int mm = g.dims[0];
+        rocblas_int nn = g.dims[1];
+        rocblas_int dim = std::min(mm, nn);
+        rocblas_int ldw = g.padded ? std::max(mm, 1) : g.dims[2];
+        rocblas_stride strideW = rocblas_stride(ldw) * nn;
+        rocblas_int chunk
+            = g.padded ? rocsolver_vbatched_chunk<T>(g.count, strideW, size_pad) : g.count;
+
+        // (the sizes are only recomputed to determine the TRSM algorithm of the group, which
+        // is the optimal one if its workspace fits)
+        size_t s[9];
+        bool optim_mem;
+        rocsolver_getrf_getMemorySize<true, false, T>(mm, nn, true, chunk, &s[0], &s[1], &s[2],
+                                                      &s[3], &s[4], &s[5], &s[6], &s[7], &s[8],
+                                                      &optim_mem, ldw);
+        optim_mem = optim_mem && s[1] <= size_work[0] && s[2] <= size_work[1]
+            && s[3] <= size_work[2] && s[4] <= size_work[3];
+
+        for(rocblas_int c = 0; c < g.count; c += chunk)
+        {
+            rocblas_int count = std::min(chunk, g.count - c);
+            rocblas_int* gorder = order + g.offset + c;
+            rocblas_int* ginfo = ipivinfo + size_t(dim) * count;
+            dim3 blocks((count - 1) / BS1 + 1);
+            dim3 grid((mm - 1) / BS2 + 1, (nn - 1) / BS2 + 1, count);
+
+            if(g.padded)
+            {
+                ROCSOLVER_LAUNCH_KERNEL((get_array<T, rocblas_int>), blocks, dim3(BS1), 0, stream,
+                                        Aarr, pad, strideW, count);
+                if(strideW > 0)
+                    ROCSOLVER_LAUNCH_KERNEL(vbatched_pad<T>, grid, dim3(BS2, BS2), 0, stream, pad,
+                                            ldw, strideW, A, m, n, lda, gorder, mm, nn, true);
+            }
+            else
+                ROCSOLVER_LAUNCH_KERNEL(vbatched_gather_ptrs<T>, blocks, dim3(BS1), 0, stream,
+                                        Aarr, A, gorder, count);
+
+            rocblas_status st = rocsolver_getrf_template<true, false, T>(
+                handle, mm, nn, Aarr, 0, 1, ldw, 0, ipivinfo, 0, dim, ginfo, count, scalars,
+                work1, work2, work3, work4, pivotval, pivotidx, iipiv, iinfo, optim_mem, true);
+            if(st != rocblas_status_success)
+                return st;
+
+            if(g.padded && strideW > 0)
+                ROCSOLVER_LAUNCH_KERNEL(vbatched_unpad<T>, grid, dim3(BS2, BS2), 0, stream, A, m,
+                                        n, lda, pad, ldw, strideW, gorder, mm, nn);
+            if(dim > 0)
+                ROCSOLVER_LAUNCH_KERNEL(vbatched_scatter_vec<rocblas_int>,
+                                        dim3((dim - 1) / BS1 + 1, count), dim3(BS1), 0, stream,
+                                        ipiv, ipivinfo, dim, dim, gorder, m, n);
+            ROCSOLVER_LAUNCH_KERNEL(vbatched_scatter_info, blocks, dim3(BS1), 0, stream, info,
+                                    ginfo, gorder, count, m, n);
+        }
+    }
+
+    return rocblas_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    POTRF_VBATCHED
+ * ===========================================================================
+ */
+
+template <typename T>
+rocblas_status rocsolver_potrf_vbatched_argCheck(rocblas_handle handle,
+                                                 const rocblas_fill uplo,
+                                                 const rocblas_int* n,
+                                                 const rocblas_int* lda,
+                                                 T A,
+                                                 rocblas_int* info,
+                                                 const rocblas_int max_n,
+                                                 const rocblas_int batch_count)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    // (the sizes of each problem are checked once they are read from the device)
+    if(max_n < 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if(batch_count && (!n || !lda || !A || !info))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+/** Return the sizes of the different workspace arrays. The requirements of the batched
+    template are those of batch_count problems of the largest size. **/
+template <typename T>
+void rocsolver_potrf_vbatched_getMemorySize(const rocblas_int max_n,
+                                            const rocblas_fill uplo,
+                                            const rocblas_int batch_count,
+                                            size_t* size_scalars,
+                                            size_t* size_work1,
+                                            size_t* size_work2,
+                                            size_t* size_work3,
+                                            size_t* size_work4,
+                                            size_t* size_pivots,
+                                            size_t* size_iinfo,
+                                            size_t* size_sort,
+                                            size_t* size_order,
+                                            size_t* size_Aarr,
+                                            size_t* size_ginfo,
+                                            size_t* size_pad,
+                                            const rocsolver_arch_info* arch)
+{
+    bool optim_mem;
+    rocsolver_potrf_getMemorySize<true, false, T>(max_n, uplo, batch_count, size_scalars,
+                                                  size_work1, size_work2, size_work3, size_work4,
+                                                  size_pivots, size_iinfo, &optim_mem, arch);
+
+    rocsolver_vbatched_sort_mem(batch_count, size_sort);
+    *size_order = sizeof(rocblas_int) * batch_count;
+    *size_Aarr = sizeof(T*) * batch_count;
+    *size_ginfo = sizeof(rocblas_int) * batch_count;
+    *size_pad = rocsolver_vbatched_pad_mem<T>(batch_count, size_t(max_n) * max_n);
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_potrf_vbatched_template(rocblas_handle handle,
+                                                 const rocblas_fill uplo,
+                                                 const rocblas_int* n,
+                                                 U A,
+                                                 const rocblas_int* lda,
+                                                 rocblas_int* info,
+                                                 const rocsolver_vbatched_groups<2>& groups,
+                                                 T* scalars,
+                                                 void* work1,
+                                                 void* work2,
+                                                 void* work3,
+                                                 void* work4,
+                                                 T* pivots,
+                                                 rocblas_int* iinfo,
+                                                 rocblas_int* order,
+                                                 T** Aarr,
+                                                 rocblas_int* ginfo,
+                                                 T* pad,
+                                                 const size_t* size_work,
+                                                 const size_t size_pad,
+                                                 const rocsolver_arch_info* arch)
+{
+    ROCSOLVER_ENTER("potrf_vbatched", "uplo:", uplo, "groups:", groups.size());
+
+    using S = decltype(std::real(T{}));
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    for(auto& g : groups)
+    {
+        rocblas_int nn = g.dims[0];
+        rocblas_int ldw = g.padded ? std::max(nn, 1) : g.dims[1];
+        rocblas_stride strideW = rocblas_stride(ldw) * nn;
+        rocblas_int chunk
+            = g.padded ? rocsolver_vbatched_chunk<T>(g.count, strideW, size_pad) : g.count;
+
+        // (the sizes are only recomputed to determine the TRSM algorithm of the group, which
+        // is the optimal one if its workspace fits)
+        size_t s[7];
+        bool optim_mem;
+        rocsolver_potrf_getMemorySize<true, false, T>(nn, uplo, chunk, &s[0], &s[1], &s[2], &s[3],
+                                                      &s[4], &s[5], &s[6], &optim_mem, arch);
+        optim_mem = optim_mem && s[1] <= size_work[0] && s[2] <= size_work[1]
+            && s[3] <= size_work[2] && s[4] <= size_work[3];
+
+        for(rocblas_int c = 0; c < g.count; c += chunk)
+        {
+            rocblas_int count = std::min(chunk, g.count - c);
+            rocblas_int* gorder = order + g.offset + c;
+            dim3 blocks((count - 1) / BS1 + 1);
+            dim3 grid((nn - 1) / BS2 + 1, (nn - 1) / BS2 + 1, count);
+
+            if(g.padded)
+            {
+                ROCSOLVER_LAUNCH_KERNEL((get_array<T, rocblas_int>), blocks, dim3(BS1), 0, stream,
+                                        Aarr, pad, strideW, count);
+                if(strideW > 0)
+                    ROCSOLVER_LAUNCH_KERNEL(vbatched_pad<T>, grid, dim3(BS2, BS2), 0, stream, pad,
+                                            ldw, strideW, A, n, n, lda, gorder, nn, nn, true);
+            }
+            else
+                ROCSOLVER_LAUNCH_KERNEL(vbatched_gather_ptrs<T>, blocks, dim3(BS1), 0, stream,
+                                        Aarr, A, gorder, count);
+
+            rocblas_status st = rocsolver_potrf_template<true, false, T, S>(
+                handle, uplo, nn, Aarr, 0, ldw, 0, ginfo, count, scalars, work1, work2, work3,
+                work4, pivots, iinfo, optim_mem);
+            if(st != rocblas_status_success)
+                return st;
+
+            if(g.padded && strideW > 0)
+                ROCSOLVER_LAUNCH_KERNEL(vbatched_unpad<T>, grid, dim3(BS2, BS2), 0, stream, A, n,
+                                        n, lda, pad, ldw, strideW, gorder, nn, nn);
+            ROCSOLVER_LAUNCH_KERNEL(vbatched_scatter_info, blocks, dim3(BS1), 0, stream, info,
+                                    ginfo, gorder, count, n, n);
+        }
+    }
+
+    return rocblas_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    GEQRF_VBATCHED
+ * ===========================================================================
+ */
+
+template <typename T, typename U>
+rocblas_status rocsolver_geqrf_vbatched_argCheck(rocblas_handle handle,
+                                                 const rocblas_int* m,
+                                                 const rocblas_int* n,
+                                                 const rocblas_int* lda,
+                                                 U A,
+                                                 T* const ipiv[],
+                                                 const rocblas_int max_m,
+                                                 const rocblas_int max_n,
+                                                 const rocblas_int batch_count)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    // N/A
+
+    // 2. invalid size
+    // (the sizes of each problem are checked once they are read from the device)
+    if(max_m < 0 || max_n < 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if(batch_count && (!m || !n || !lda || !A || !ipiv))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+/** Return the sizes of the different workspace arrays. The requirements of the batched
+    template are those of batch_count problems of the largest sizes. **/
+template <typename T>
+void rocsolver_geqrf_vbatched_getMemorySize(const rocblas_int max_m,
+                                            const rocblas_int max_n,
+                                            const rocblas_int batch_count,
+                                            size_t* size_scalars,
+                                            size_t* size_work_workArr,
+                                            size_t* size_Abyx_norms_trfact,
+                                            size_t* size_diag_tmptr,
+                                            size_t* size_workArr,
+                                            size_t* size_sort,
+                                            size_t* size_order,
+                                            size_t* size_Aarr,
+                                            size_t* size_gipiv,
+                                            size_t* size_pad)
+{
+    rocsolver_geqrf_getMemorySize<true, T>(max_m, max_n, batch_count, size_scalars,
+                                           size_work_workArr, size_Abyx_norms_trfact,
+                                           size_diag_tmptr, size_workArr);
+
+    *size_gipiv = sizeof(T) * std::min(max_m, max_n) * size_t(batch_count);
+
+    rocsolver_vbatched_sort_mem(batch_count, size_sort);
+    *size_order = sizeof(rocblas_int) * batch_count;
+    *size_Aarr = sizeof(T*) * batch_count;
+    *size_pad = rocsolver_vbatched_pad_mem<T>(batch_count, size_t(max_m) * max_n);
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_geqrf_vbatched_template(rocblas_handle handle,
+                                                 const rocblas_int* m,
+                                                 const rocblas_int* n,
+                                                 U A,
+                                                 const rocblas_int* lda,
+                                                 T* const ipiv[],
+                                                 const rocsolver_vbatched_groups<3>& groups,
+                                                 T* scalars,
+                                                 void* work_workArr,
+                                                 T* Abyx_norms_trfact,
+                                                 T* diag_tmptr,
+                                                 T** workArr,
+                                                 rocblas_int* order,
+                                                 T** Aarr,
+                                                 T* gipiv,
+                                                 T* pad,
+                                                 const size_t size_pad)
+{
+    ROCSOLVER_ENTER("geqrf_vbatched", "groups:", groups.size());
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    for(auto& g : groups)
+    {
+        rocblas_int mm = g.dims[0];
+        rocblas_int nn = g.dims[1];
+        rocblas_int dim = std::min(mm, nn);
+
+        // nothing to do for empty matrices
+        if(dim == 0)
+            continue;
+
+        rocblas_int ldw = g.padded ? mm : g.dims[2];
+        rocblas_stride strideW = rocblas_stride(ldw) * nn;
+        rocblas_int chunk
+            = g.padded ? rocsolver_vbatched_chunk<T>(g.count, strideW, size_pad) : g.count;
+
+        for(rocblas_int c = 0; c < g.count; c += chunk)
+        {
+            rocblas_int count = std::min(chunk, g.count - c);
+            rocblas_int* gorder = order + g.offset + c;
+            dim3 blocks((count - 1) / BS1 + 1);
+            dim3 grid((mm - 1) / BS2 + 1, (nn - 1) / BS2 + 1, count);
+
+            if(g.padded)
+            {
+                ROCSOLVER_LAUNCH_KERNEL((get_array<T, rocblas_int>), blocks, dim3(BS1), 0, stream,
+                                        Aarr, pad, strideW, count);
+                ROCSOLVER_LAUNCH_KERNEL(vbatched_pad<T>, grid, dim3(BS2, BS2), 0, stream, pad, ldw,
+                                        strideW, A, m, n, lda, gorder, mm, nn, true);
+            }
+            else
+                ROCSOLVER_LAUNCH_KERNEL(vbatched_gather_ptrs<T>, blocks, dim3(BS1), 0, stream,
+                                        Aarr, A, gorder, count);
+
+            rocblas_status st = rocsolver_geqrf_template<true, false, T>(
+                handle, mm, nn, Aarr, 0, ldw, 0, gipiv, dim, count, scalars, work_workArr,
+                Abyx_norms_trfact, diag_tmptr, workArr);
+            if(st != rocblas_status_success)
+                return st;
+
+            if(g.padded)
+                ROCSOLVER_LAUNCH_KERNEL(vbatched_unpad<T>, grid, dim3(BS2, BS2), 0, stream, A, m,
+                                        n, lda, pad, ldw, strideW, gorder, mm, nn);
+            ROCSOLVER_LAUNCH_KERNEL(vbatched_scatter_vec<T>, dim3((dim - 1) / BS1 + 1, count),
+                                    dim3(BS1), 0, stream, ipiv, gipiv, dim, dim, gorder, m, n);
+        }
+    }
+
+    return rocblas_status_success;
+}
+
+/*
+ * ===========================================================================
+ *    GETRS_VBATCHED
+ * ===========================================================================
+ */
+
+template <typename T>
+rocblas_status rocsolver_getrs_vbatched_argCheck(rocblas_handle handle,
+                                                 const rocblas_operation trans,
+                                                 const rocblas_int* n,
+                                                 const rocblas_int* nrhs,
+                                                 const rocblas_int* lda,
+                                                 const rocblas_int* ldb,
+                                                 T A,
+                                                 T B,
+                                                 const rocblas_int* const ipiv[],
+                                                 const rocblas_int max_n,
+                                                 const rocblas_int max_nrhs,
+                                                 const rocblas_int batch_count)
+{
+    // order is important for unit tests:
+
+    // 1. invalid/non-supported values
+    if(trans != rocblas_operation_none && trans != rocblas_operation_transpose
+       && trans != rocblas_operation_conjugate_transpose)
+        return rocblas_status_invalid_value;
+
+    // 2. invalid size
+    // (the sizes of each problem are checked once they are read from the device)
+    if(max_n < 0 || max_nrhs < 0 || batch_count < 0)
+        return rocblas_status_invalid_size;
+
+    // skip pointer check if querying memory size
+    if(rocblas_is_device_memory_size_query(handle))
+        return rocblas_status_continue;
+
+    // 3. invalid pointers
+    if(batch_count && (!n || !nrhs || !lda || !ldb || !A || !B || !ipiv))
+        return rocblas_status_invalid_pointer;
+
+    return rocblas_status_continue;
+}
+
+/** Return the sizes of the different workspace arrays. The requirements of the batched
+    template are those of batch_count problems of the largest sizes. **/
+template <typename T>
+void rocsolver_getrs_vbatched_getMemorySize(const rocblas_operation trans,
+                                            const rocblas_int max_n,
+                                            const rocblas_int max_nrhs,
+                                            const rocblas_int batch_count,
+                                            size_t* size_work1,
+                                            size_t* size_work2,
+                                            size_t* size_work3,
+                                            size_t* size_work4,
+                                            size_t* size_sort,
+                                            size_t* size_order,
+                                            size_t* size_ABarr,
+                                            size_t* size_gipiv,
+                                            size_t* size_pad)
+{
+    bool optim_mem;
+    rocsolver_getrs_getMemorySize<true, false, T>(trans, max_n, max_nrhs, batch_count, size_work1,
+                                                  size_work2, size_work3, size_work4, &optim_mem,
+                                                  std::max(max_n, 1), std::max(max_n, 1));
+
+    *size_gipiv = sizeof(rocblas_int) * max_n * size_t(batch_count);
+
+    rocsolver_vbatched_sort_mem(batch_count, size_sort);
+    *size_order = sizeof(rocblas_int) * batch_count;
+    // (pointers to A and to B)
+    *size_ABarr = sizeof(T*) * 2 * batch_count;
+    // (padded A followed by padded B)
+    *size_pad = rocsolver_vbatched_pad_mem<T>(batch_count, size_t(max_n) * (max_n + max_nrhs));
+}
+
+template <typename T, typename U>
+rocblas_status rocsolver_getrs_vbatched_template(rocblas_handle handle,
+                                                 const rocblas_operation trans,
+                                                 const rocblas_int* n,
+                                                 const rocblas_int* nrhs,
+                                                 U A,
+                                                 const rocblas_int* lda,
+                                                 const rocblas_int* const ipiv[],
+                                                 U B,
+                                                 const rocblas_int* ldb,
+                                                 const rocsolver_vbatched_groups<4>& groups,
+                                                 void* work1,
+                                                 void* work2,
+                                                 void* work3,
+                                                 void* work4,
+                                                 rocblas_int* order,
+                                                 T** ABarr,
+                                                 rocblas_int* gipiv,
+                                                 T* pad,
+                                                 const size_t* size_work,
+                                                 const size_t size_pad,
+                                                 const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("getrs_vbatched", "trans:", trans, "groups:", groups.size());
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    T** Aarr = ABarr;
+    T** Barr = ABarr + batch_count;
+
+    for(auto& g : groups)
+    {
+        rocblas_int nn = g.dims[0];
+        rocblas_int nnrhs = g.dims[1];
+
+        // nothing to do for empty systems
+        if(nn == 0 || nnrhs == 0)
+            continue;
+
+        rocblas_int ldwa = g.padded ? nn : g.dims[2];
+        rocblas_int ldwb = g.padded ? nn : g.dims[3];
+        rocblas_stride strideWA = rocblas_stride(ldwa) * nn;
+        rocblas_stride strideWB = rocblas_stride(ldwb) * nnrhs;
+        rocblas_int chunk = g.padded
+            ? rocsolver_vbatched_chunk<T>(g.count, strideWA + strideWB, size_pad)
+            : g.count;
+
+        // (the sizes are only recomputed to determine the TRSM algorithm of the group, which
+        // is the optimal one if its workspace fits)
+        size_t s[4];
+        bool optim_mem;
+        rocsolver_getrs_getMemorySize<true, false, T>(trans, nn, nnrhs, chunk, &s[0], &s[1], &s[2],
+                                                      &s[3], &optim_mem, ldwa, ldwb);
+        optim_mem = optim_mem && s[0] <= size_work[0] && s[1] <= size_work[1]
+            && s[2] <= size_work[2] && s[3] <= size_work[3];
+
+        for(rocblas_int c = 0; c < g.count; c += chunk)
+        {
+            rocblas_int count = std::min(chunk, g.count - c);
+            rocblas_int* gorder = order + g.offset + c;
+            T* padB = pad + strideWA * count;
+            dim3 blocks((count - 1) / BS1 + 1);
+            dim3 gridA((nn - 1) / BS2 + 1, (nn - 1) / BS2 + 1, count);
+            dim3 gridB((nn - 1) / BS2 + 1, (nnrhs - 1) / BS2 + 1, count);
+
+            ROCSOLVER_LAUNCH_KERNEL(vbatched_gather_ipiv, dim3((nn - 1) / BS1 + 1, count),
+                                    dim3(BS1), 0, stream, gipiv, nn, ipiv, nn, gorder, n);
+
+            if(g.padded)
+            {
+                ROCSOLVER_LAUNCH_KERNEL((get_array<T, rocblas_int>), blocks, dim3(BS1), 0, stream,
+                                        Aarr, pad, strideWA, count);
+                ROCSOLVER_LAUNCH_KERNEL((get_array<T, rocblas_int>), blocks, dim3(BS1), 0, stream,
+                                        Barr, padB, strideWB, count);
+                ROCSOLVER_LAUNCH_KERNEL(vbatched_pad<T>, gridA, dim3(BS2, BS2), 0, stream, pad,
+                                        ldwa, strideWA, A, n, n, lda, gorder, nn, nn, true);
+                ROCSOLVER_LAUNCH_KERNEL(vbatched_pad<T>, gridB, dim3(BS2, BS2), 0, stream, padB,
+                                        ldwb, strideWB, B, n, nrhs, ldb, gorder, nn, nnrhs, false);
+            }
+            else
+            {
+                ROCSOLVER_LAUNCH_KERNEL(vbatched_gather_ptrs<T>, blocks, dim3(BS1), 0, stream,
+                                        Aarr, A, gorder, count);
+                ROCSOLVER_LAUNCH_KERNEL(vbatched_gather_ptrs<T>, blocks, dim3(BS1), 0, stream,
+                                        Barr, B, gorder, count);
+            }
+
+            rocblas_status st = rocsolver_getrs_template<true, false, T>(
+                handle, trans, nn, nnrhs, Aarr, 0, 1, ldwa, 0, gipiv, nn, Barr, 0, 1, ldwb, 0,
+                count, work1, work2, work3, work4, optim_mem, true);
+            if(st != rocblas_status_success)
+                return st;
+
+            // (only the solutions are copied back)
+            if(g.padded)
+                ROCSOLVER_LAUNCH_KERNEL(vbatched_unpad<T>, gridB, dim3(BS2, BS2), 0, stream, B, n,
+                                        nrhs, ldb, padB, ldwb, strideWB, gorder, nn, nnrhs);
+        }
+    }
+
+    return rocblas_status_success;
+}
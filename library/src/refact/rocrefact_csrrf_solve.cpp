@@ -71,7 +71,7 @@ rocblas_status rocsolver_csrrf_solve_impl(rocblas_handle handle,
                                            &size_work, &size_temp);
 
     if(rocblas_is_device_memory_size_query(handle))
-        return rocblas_set_optimal_device_memory_size(handle, size_work, size_temp);
+        return ROCSOLVER_SET_OPTIMAL_DEVICE_MEM_SIZES(handle, size_work, size_temp);
 
     // memory workspace allocation
     void* work = nullptr;
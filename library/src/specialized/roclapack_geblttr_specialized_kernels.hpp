@@ -0,0 +1,432 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocsolver_run_specialized_kernels.hpp"
+
+/*************************************************************
+    Templated kernels are instantiated in separate cpp
+    files in order to improve compilation times and reduce
+    the library size.
+*************************************************************/
+
+/** geblttrf_npvt_small_kernel factorizes a whole block tridiagonal matrix
+    per thread. The diagonal block being processed is kept in registers, and
+    the rest of the blocks are streamed from global memory, so that accesses are
+    coalesced when the batch instances are interleaved. The factors are stored
+    in the same form as with the blocked algorithm. **/
+template <rocblas_int NB, typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1)
+    geblttrf_npvt_small_kernel(const rocblas_int nblocks,
+                               U AA,
+                               const rocblas_int shiftA,
+                               const rocblas_int inca,
+                               const rocblas_int lda,
+                               const rocblas_stride strideA,
+                               U BB,
+                               const rocblas_int shiftB,
+                               const rocblas_int incb,
+                               const rocblas_int ldb,
+                               const rocblas_stride strideB,
+                               U CC,
+                               const rocblas_int shiftC,
+                               const rocblas_int incc,
+                               const rocblas_int ldc,
+                               const rocblas_stride strideC,
+                               rocblas_int* infoA,
+                               const rocblas_int batch_count)
+{
+    rocblas_int bid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+
+    if(bid >= batch_count)
+        return;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    T* B = load_ptr_batch<T>(BB, bid, shiftB, strideB);
+    T* C = load_ptr_batch<T>(CC, bid, shiftC, strideC);
+
+    // block strides
+    rocblas_stride bsa = rocblas_stride(lda) * NB;
+    rocblas_stride bsb = rocblas_stride(ldb) * NB;
+    rocblas_stride bsc = rocblas_stride(ldc) * NB;
+
+    rocblas_int myinfo = 0;
+    T rB[NB * NB], a[NB], c[NB];
+
+    for(rocblas_int k = 0; k < nblocks; ++k)
+    {
+        T* Bk = B + k * bsb;
+        T* Ck = C + k * bsc;
+
+        // read diagonal block
+#pragma unroll
+        for(rocblas_int j = 0; j < NB; ++j)
+#pragma unroll
+            for(rocblas_int i = 0; i < NB; ++i)
+                rB[i + j * NB] = Bk[i * incb + j * ldb];
+
+        // update with the previous block row: B_k = B_k - A_{k-1} * C_{k-1}
+        // (C_{k-1} was already overwritten by inv(B_{k-1}) * C_{k-1})
+        if(k > 0)
+        {
+            T* Ak = A + (k - 1) * bsa;
+            T* Cp = C + (k - 1) * bsc;
+            for(rocblas_int l = 0; l < NB; ++l)
+            {
+#pragma unroll
+                for(rocblas_int i = 0; i < NB; ++i)
+                {
+                    a[i] = Ak[i * inca + l * lda];
+                    c[i] = Cp[l * incc + i * ldc];
+                }
+#pragma unroll
+                for(rocblas_int j = 0; j < NB; ++j)
+#pragma unroll
+                    for(rocblas_int i = 0; i < NB; ++i)
+                        rB[i + j * NB] -= a[i] * c[j];
+            }
+        }
+
+        // LU factorization without pivoting of the diagonal block
+#pragma unroll
+        for(rocblas_int j = 0; j < NB; ++j)
+        {
+            T pivot = rB[j + j * NB];
+            if(pivot == T(0) && myinfo == 0)
+                myinfo = k * NB + j + 1;
+            pivot = (pivot != T(0)) ? T(1) / pivot : T(0);
+
+#pragma unroll
+            for(rocblas_int i = j + 1; i < NB; ++i)
+                rB[i + j * NB] *= pivot;
+#pragma unroll
+            for(rocblas_int jj = j + 1; jj < NB; ++jj)
+#pragma unroll
+                for(rocblas_int i = j + 1; i < NB; ++i)
+                    rB[i + jj * NB] -= rB[i + j * NB] * rB[j + jj * NB];
+        }
+
+#pragma unroll
+        for(rocblas_int j = 0; j < NB; ++j)
+#pragma unroll
+            for(rocblas_int i = 0; i < NB; ++i)
+                Bk[i * incb + j * ldb] = rB[i + j * NB];
+
+        // overwrite C_k by inv(B_k) * C_k
+        if(k < nblocks - 1)
+        {
+            for(rocblas_int j = 0; j < NB; ++j)
+            {
+#pragma unroll
+                for(rocblas_int i = 0; i < NB; ++i)
+                    c[i] = Ck[i * incc + j * ldc];
+#pragma unroll
+                for(rocblas_int l = 0; l < NB; ++l)
+#pragma unroll
+                    for(rocblas_int i = l + 1; i < NB; ++i)
+                        c[i] -= rB[i + l * NB] * c[l];
+#pragma unroll
+                for(rocblas_int l = NB - 1; l >= 0; --l)
+                {
+                    c[l] = c[l] / rB[l + l * NB];
+#pragma unroll
+                    for(rocblas_int i = 0; i < l; ++i)
+                        c[i] -= rB[i + l * NB] * c[l];
+                }
+#pragma unroll
+                for(rocblas_int i = 0; i < NB; ++i)
+                    Ck[i * incc + j * ldc] = c[i];
+            }
+        }
+    }
+
+    infoA[bid] = myinfo;
+}
+
+/** geblttrs_npvt_small_kernel solves a block tridiagonal system for one
+    right-hand side per thread, using the factors computed by
+    geblttrf_npvt_small_kernel (or the blocked algorithm). **/
+template <rocblas_int NB, typename T, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1)
+    geblttrs_npvt_small_kernel(const rocblas_int nblocks,
+                               const rocblas_int nrhs,
+                               U AA,
+                               const rocblas_int shiftA,
+                               const rocblas_int inca,
+                               const rocblas_int lda,
+                               const rocblas_stride strideA,
+                               U BB,
+                               const rocblas_int shiftB,
+                               const rocblas_int incb,
+                               const rocblas_int ldb,
+                               const rocblas_stride strideB,
+                               U CC,
+                               const rocblas_int shiftC,
+                               const rocblas_int incc,
+                               const rocblas_int ldc,
+                               const rocblas_stride strideC,
+                               U XX,
+                               const rocblas_int shiftX,
+                               const rocblas_int incx,
+                               const rocblas_int ldx,
+                               const rocblas_stride strideX,
+                               const rocblas_int batch_count)
+{
+    rocblas_int bid = hipBlockIdx_x * hipBlockDim_x + hipThreadIdx_x;
+    rocblas_int j = hipBlockIdx_y;
+
+    if(bid >= batch_count)
+        return;
+
+    // batch instance
+    T* A = load_ptr_batch<T>(AA, bid, shiftA, strideA);
+    T* B = load_ptr_batch<T>(BB, bid, shiftB, strideB);
+    T* C = load_ptr_batch<T>(CC, bid, shiftC, strideC);
+    T* X = load_ptr_batch<T>(XX, bid, shiftX, strideX) + j * rocblas_stride(ldx);
+
+    // block strides
+    rocblas_stride bsa = rocblas_stride(lda) * NB;
+    rocblas_stride bsb = rocblas_stride(ldb) * NB;
+    rocblas_stride bsc = rocblas_stride(ldc) * NB;
+    rocblas_stride bsx = rocblas_stride(ldx) * nrhs;
+
+    T x[NB], y[NB];
+
+    // forward solve
+    for(rocblas_int k = 0; k < nblocks; ++k)
+    {
+        T* Bk = B + k * bsb;
+        T* Xk = X + k * bsx;
+
+#pragma unroll
+        for(rocblas_int i = 0; i < NB; ++i)
+            x[i] = Xk[i * incx];
+
+        // x_k = x_k - A_{k-1} * x_{k-1}
+        if(k > 0)
+        {
+            T* Ak = A + (k - 1) * bsa;
+#pragma unroll
+            for(rocblas_int l = 0; l < NB; ++l)
+#pragma unroll
+                for(rocblas_int i = 0; i < NB; ++i)
+                    x[i] -= Ak[i * inca + l * lda] * y[l];
+        }
+
+        // x_k = inv(B_k) * x_k
+#pragma unroll
+        for(rocblas_int l = 0; l < NB; ++l)
+#pragma unroll
+            for(rocblas_int i = l + 1; i < NB; ++i)
+                x[i] -= Bk[i * incb + l * ldb] * x[l];
+#pragma unroll
+        for(rocblas_int l = NB - 1; l >= 0; --l)
+        {
+            x[l] = x[l] / Bk[l * incb + l * ldb];
+#pragma unroll
+            for(rocblas_int i = 0; i < l; ++i)
+                x[i] -= Bk[i * incb + l * ldb] * x[l];
+        }
+
+#pragma unroll
+        for(rocblas_int i = 0; i < NB; ++i)
+        {
+            Xk[i * incx] = x[i];
+            y[i] = x[i];
+        }
+    }
+
+    // backward solve (y holds the last computed block of the solution)
+    for(rocblas_int k = nblocks - 2; k >= 0; --k)
+    {
+        T* Ck = C + k * bsc;
+        T* Xk = X + k * bsx;
+
+#pragma unroll
+        for(rocblas_int i = 0; i < NB; ++i)
+            x[i] = Xk[i * incx];
+
+        // x_k = x_k - C_k * x_{k+1}
+#pragma unroll
+        for(rocblas_int l = 0; l < NB; ++l)
+#pragma unroll
+            for(rocblas_int i = 0; i < NB; ++i)
+                x[i] -= Ck[i * incc + l * ldc] * y[l];
+
+#pragma unroll
+        for(rocblas_int i = 0; i < NB; ++i)
+        {
+            Xk[i * incx] = x[i];
+            y[i] = x[i];
+        }
+    }
+}
+
+/*************************************************************
+    Launchers of specilized kernels
+*************************************************************/
+
+template <typename T, typename U>
+rocblas_status geblttrf_npvt_run_small(rocblas_handle handle,
+                                       const rocblas_int nb,
+                                       const rocblas_int nblocks,
+                                       U A,
+                                       const rocblas_int shiftA,
+                                       const rocblas_int inca,
+                                       const rocblas_int lda,
+                                       const rocblas_stride strideA,
+                                       U B,
+                                       const rocblas_int shiftB,
+                                       const rocblas_int incb,
+                                       const rocblas_int ldb,
+                                       const rocblas_stride strideB,
+                                       U C,
+                                       const rocblas_int shiftC,
+                                       const rocblas_int incc,
+                                       const rocblas_int ldc,
+                                       const rocblas_stride strideC,
+                                       rocblas_int* info,
+                                       const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("geblttrf_npvt_kernel_small", "nb:", nb, "nblocks:", nblocks,
+                    "bc:", batch_count);
+
+#define RUN_GEBLTTRF_SMALL(NB)                                                                     \
+    ROCSOLVER_LAUNCH_KERNEL((geblttrf_npvt_small_kernel<NB, T>), grid, threads, 0, stream,         \
+                            nblocks, A, shiftA, inca, lda, strideA, B, shiftB, incb, ldb,          \
+                            strideB, C, shiftC, incc, ldc, strideC, info, batch_count)
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // one thread per batch instance
+    rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+    dim3 grid(blocks, 1, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // instantiate cases to make the block size known at compile time
+    switch(nb)
+    {
+    case 1: RUN_GEBLTTRF_SMALL(1); break;
+    case 2: RUN_GEBLTTRF_SMALL(2); break;
+    case 3: RUN_GEBLTTRF_SMALL(3); break;
+    case 4: RUN_GEBLTTRF_SMALL(4); break;
+    case 5: RUN_GEBLTTRF_SMALL(5); break;
+    case 6: RUN_GEBLTTRF_SMALL(6); break;
+    case 7: RUN_GEBLTTRF_SMALL(7); break;
+    case 8: RUN_GEBLTTRF_SMALL(8); break;
+    default: ROCSOLVER_UNREACHABLE();
+    }
+
+    return rocblas_status_success;
+}
+
+template <typename T, typename U>
+rocblas_status geblttrs_npvt_run_small(rocblas_handle handle,
+                                       const rocblas_int nb,
+                                       const rocblas_int nblocks,
+                                       const rocblas_int nrhs,
+                                       U A,
+                                       const rocblas_int shiftA,
+                                       const rocblas_int inca,
+                                       const rocblas_int lda,
+                                       const rocblas_stride strideA,
+                                       U B,
+                                       const rocblas_int shiftB,
+                                       const rocblas_int incb,
+                                       const rocblas_int ldb,
+                                       const rocblas_stride strideB,
+                                       U C,
+                                       const rocblas_int shiftC,
+                                       const rocblas_int incc,
+                                       const rocblas_int ldc,
+                                       const rocblas_stride strideC,
+                                       U X,
+                                       const rocblas_int shiftX,
+                                       const rocblas_int incx,
+                                       const rocblas_int ldx,
+                                       const rocblas_stride strideX,
+                                       const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("geblttrs_npvt_kernel_small", "nb:", nb, "nblocks:", nblocks, "nrhs:", nrhs,
+                    "bc:", batch_count);
+
+#define RUN_GEBLTTRS_SMALL(NB)                                                                     \
+    ROCSOLVER_LAUNCH_KERNEL((geblttrs_npvt_small_kernel<NB, T>), grid, threads, 0, stream,         \
+                            nblocks, nrhs, A, shiftA, inca, lda, strideA, B, shiftB, incb, ldb,    \
+                            strideB, C, shiftC, incc, ldc, strideC, X, shiftX, incx, ldx,          \
+                            strideX, batch_count)
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    // one thread per batch instance and right-hand side
+    rocblas_int blocks = (batch_count - 1) / BS1 + 1;
+    dim3 grid(blocks, nrhs, 1);
+    dim3 threads(BS1, 1, 1);
+
+    // instantiate cases to make the block size known at compile time
+    switch(nb)
+    {
+    case 1: RUN_GEBLTTRS_SMALL(1); break;
+    case 2: RUN_GEBLTTRS_SMALL(2); break;
+    case 3: RUN_GEBLTTRS_SMALL(3); break;
+    case 4: RUN_GEBLTTRS_SMALL(4); break;
+    case 5: RUN_GEBLTTRS_SMALL(5); break;
+    case 6: RUN_GEBLTTRS_SMALL(6); break;
+    case 7: RUN_GEBLTTRS_SMALL(7); break;
+    case 8: RUN_GEBLTTRS_SMALL(8); break;
+    default: ROCSOLVER_UNREACHABLE();
+    }
+
+    return rocblas_status_success;
+}
+
+/*************************************************************
+    Instantiation macros
+*************************************************************/
+
+#define INSTANTIATE_GEBLTTRF_NPVT_SMALL(T, U)                                                      \
+    template rocblas_status geblttrf_npvt_run_small<T, U>(                                         \
+        rocblas_handle handle, const rocblas_int nb, const rocblas_int nblocks, U A,               \
+        const rocblas_int shiftA, const rocblas_int inca, const rocblas_int lda,                   \
+        const rocblas_stride strideA, U B, const rocblas_int shiftB, const rocblas_int incb,       \
+        const rocblas_int ldb, const rocblas_stride strideB, U C, const rocblas_int shiftC,        \
+        const rocblas_int incc, const rocblas_int ldc, const rocblas_stride strideC,               \
+        rocblas_int* info, const rocblas_int batch_count)
+
+#define INSTANTIATE_GEBLTTRS_NPVT_SMALL(T, U)                                                      \
+    template rocblas_status geblttrs_npvt_run_small<T, U>(                                         \
+        rocblas_handle handle, const rocblas_int nb, const rocblas_int nblocks,                    \
+        const rocblas_int nrhs, U A, const rocblas_int shiftA, const rocblas_int inca,             \
+        const rocblas_int lda, const rocblas_stride strideA, U B, const rocblas_int shiftB,        \
+        const rocblas_int incb, const rocblas_int ldb, const rocblas_stride strideB, U C,          \
+        const rocblas_int shiftC, const rocblas_int incc, const rocblas_int ldc,                   \
+        const rocblas_stride strideC, U X, const rocblas_int shiftX, const rocblas_int incx,       \
+        const rocblas_int ldx, const rocblas_stride strideX, const rocblas_int batch_count)
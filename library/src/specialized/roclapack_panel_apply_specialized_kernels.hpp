@@ -0,0 +1,628 @@
+/* **************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ * *************************************************************************/
+
+#pragma once
+
+#include "rocsolver_run_specialized_kernels.hpp"
+
+/*
+ * ===========================================================================
+ *    Panel-apply kernels fuse the application of a factorized block panel to
+ *    the trailing columns of the batched blocked factorizations. Each
+ *    thread-block processes a tile of PANEL_APPLY_TILE columns of one problem
+ *    of the batch; the threads are arranged in PA_DIMX x (PANEL_APPLY_TILE /
+ *    PA_CPT) and each of them accumulates a PA_RPT x PA_CPT register tile.
+ * ===========================================================================
+ */
+
+// (PA_DIMX, PA_RPT, PA_CPT and PA_MAX_K are defined in rocsolver_run_specialized_kernels.hpp)
+#define PA_KC PANEL_APPLY_TILE // rows of the inner dimension staged in the LDS at a time
+
+static_assert(PANEL_APPLY_TILE % PA_CPT == 0 && PA_DIMX * (PANEL_APPLY_TILE / PA_CPT) <= BS1,
+              "PANEL_APPLY_TILE must be a multiple of 4 and not greater than 16");
+
+/** GETRF_PANEL_APPLY_KERNEL solves L11 * X = A12 for the jb x nn block row A12, where L11 is the
+    unit lower triangular diagonal block, and updates the trailing matrix A22 = A22 - A21 * X.
+    A points to the diagonal block of the current step.
+
+    Call this kernel with 'batch_count' groups in z, and enough groups in x to cover the 'nn'
+    columns in tiles of PANEL_APPLY_TILE columns. Size of shared memory per group should be:
+    lmemsize = jb * PANEL_APPLY_TILE * sizeof(T); **/
+template <typename T, typename I, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) getrf_panel_apply_kernel(const I mm,
+                                                                      const I nn,
+                                                                      const I jb,
+                                                                      U AA,
+                                                                      const rocblas_stride shiftA,
+                                                                      const I lda,
+                                                                      const rocblas_stride strideA)
+{
+    I bid = hipBlockIdx_z;
+    I tx = hipThreadIdx_x;
+    I ty = hipThreadIdx_y;
+    I tid = tx + ty * PA_DIMX;
+    I nthds = PA_DIMX * hipBlockDim_y;
+
+    // columns of the tile
+    I c0 = hipBlockIdx_x * PANEL_APPLY_TILE;
+    I nc = (nn - c0 < PANEL_APPLY_TILE) ? nn - c0 : PANEL_APPLY_TILE;
+
+    // batch instance
+    T* A = load_ptr_batch(AA, bid, shiftA, strideA);
+    T* A12 = A + idx2D(0, jb + c0, lda);
+    T* A21 = A + jb;
+    T* A22 = A + idx2D(jb, jb + c0, lda);
+
+    // shared mem setup
+    extern __shared__ double lmem[];
+    T* X = reinterpret_cast<T*>(lmem);
+
+    // read the tile of the block row
+    for(I e = tid; e < jb * PANEL_APPLY_TILE; e += nthds)
+    {
+        I i = e % jb;
+        I c = e / jb;
+        X[e] = (c < nc) ? A12[i + c * lda] : 0;
+    }
+    __syncthreads();
+
+    // forward substitution with the unit lower triangular block. L11 (up to PA_MAX_K x PA_MAX_K)
+    // does not fit in the LDS next to the tile of the block row, so every group reads it from
+    // global memory; as all the groups of a problem read the same columns, after the first
+    // group these reads are served by the L2 cache. The jb - 1 barriers are what it costs to
+    // keep the solve in the LDS and fused with the update, instead of a separate TRSM launch
+    // that writes X back to global memory and reads it again
+    for(I k = 0; k < jb - 1; ++k)
+    {
+        for(I e = tid; e < jb * PANEL_APPLY_TILE; e += nthds)
+        {
+            I i = e % jb;
+            I c = e / jb;
+            if(i > k)
+                X[e] -= A[i + k * lda] * X[k + c * jb];
+        }
+        __syncthreads();
+    }
+
+    // write back the solution
+    for(I e = tid; e < jb * PANEL_APPLY_TILE; e += nthds)
+    {
+        I i = e % jb;
+        I c = e / jb;
+        if(c < nc)
+            A12[i + c * lda] = X[e];
+    }
+
+    // update the trailing matrix; the solution is read from the LDS
+    T acc[PA_RPT][PA_CPT];
+    for(I r0 = 0; r0 < mm; r0 += PA_DIMX * PA_RPT)
+    {
+#pragma unroll
+        for(int p = 0; p < PA_RPT; ++p)
+#pragma unroll
+            for(int q = 0; q < PA_CPT; ++q)
+                acc[p][q] = 0;
+
+        for(I k = 0; k < jb; ++k)
+        {
+            T b[PA_CPT];
+#pragma unroll
+            for(int q = 0; q < PA_CPT; ++q)
+                b[q] = X[k + (ty * PA_CPT + q) * jb];
+
+#pragma unroll
+            for(int p = 0; p < PA_RPT; ++p)
+            {
+                I i = r0 + tx + p * PA_DIMX;
+                T a = (i < mm) ? A21[i + k * lda] : 0;
+#pragma unroll
+                for(int q = 0; q < PA_CPT; ++q)
+                    acc[p][q] += a * b[q];
+            }
+        }
+
+#pragma unroll
+        for(int p = 0; p < PA_RPT; ++p)
+        {
+            I i = r0 + tx + p * PA_DIMX;
+#pragma unroll
+            for(int q = 0; q < PA_CPT; ++q)
+            {
+                I c = ty * PA_CPT + q;
+                if(i < mm && c < nc)
+                    A22[i + c * lda] -= acc[p][q];
+            }
+        }
+    }
+}
+
+/** Returns element (r,c) of the logical upper triangular factor of POTRF (the conjugate
+    transpose of the matrix when the lower triangular part is stored). **/
+template <typename T, typename I>
+__device__ inline T potrf_pa_get(const bool is_upper, T* A, const I r, const I c, const I lda)
+{
+    return is_upper ? A[r + c * lda] : conj(A[c + r * lda]);
+}
+
+template <typename T, typename I>
+__device__ inline void
+    potrf_pa_set(const bool is_upper, T* A, const I r, const I c, const I lda, const T val)
+{
+    if(is_upper)
+        A[r + c * lda] = val;
+    else
+        A[c + r * lda] = conj(val);
+}
+
+/** POTRF_PANEL_APPLY_KERNEL executes one step of the left-looking Cholesky factorization on
+    the jb x nn block C = U(j:j+jb, cb:cb+nn) of the logical upper triangular factor U, where the
+    first j rows of U are already computed: C = C - U(0:j, j:j+jb)' * U(0:j, cb:cb+nn). If cb > j,
+    it also solves U11' * X = C, where U11 = U(j:j+jb, j:j+jb) is the factorized diagonal block.
+    If cb == j, C is the diagonal block itself and only its upper triangular part is updated.
+    When the lower triangular part is stored, U is its conjugate transpose. The problems with
+    info != 0 are skipped.
+
+    Call this kernel with 'batch_count' groups in z, and enough groups in x to cover the 'nn'
+    columns in tiles of PANEL_APPLY_TILE columns. Size of shared memory per group should be:
+    lmemsize = (jb * PANEL_APPLY_TILE + PA_KC * (jb + PANEL_APPLY_TILE)) * sizeof(T); **/
+template <typename T, typename I, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) potrf_panel_apply_kernel(const bool is_upper,
+                                                                      const I j,
+                                                                      const I jb,
+                                                                      const I cb,
+                                                                      const I nn,
+                                                                      U AA,
+                                                                      const rocblas_stride shiftA,
+                                                                      const I lda,
+                                                                      const rocblas_stride strideA,
+                                                                      const I* info)
+{
+    I bid = hipBlockIdx_z;
+    I tx = hipThreadIdx_x;
+    I ty = hipThreadIdx_y;
+    I tid = tx + ty * PA_DIMX;
+    I nthds = PA_DIMX * hipBlockDim_y;
+
+    if(info[bid] != 0)
+        return;
+
+    // columns of the tile
+    I c0 = hipBlockIdx_x * PANEL_APPLY_TILE;
+    I nc = (nn - c0 < PANEL_APPLY_TILE) ? nn - c0 : PANEL_APPLY_TILE;
+    bool diag = (cb == j);
+
+    // batch instance
+    T* A = load_ptr_batch(AA, bid, shiftA, strideA);
+
+    // shared mem setup
+    extern __shared__ double lmem[];
+    T* X = reinterpret_cast<T*>(lmem);
+    T* P = X + jb * PANEL_APPLY_TILE;
+    T* Q = P + PA_KC * jb;
+
+    // C = C - U(0:j, j:j+jb)' * U(0:j, cols), staging PA_KC rows of U at a time
+    // (the loads follow the storage order of A)
+    T acc[PA_RPT][PA_CPT];
+#pragma unroll
+    for(int p = 0; p < PA_RPT; ++p)
+#pragma unroll
+        for(int q = 0; q < PA_CPT; ++q)
+            acc[p][q] = 0;
+
+    for(I k0 = 0; k0 < j; k0 += PA_KC)
+    {
+        I kc = (j - k0 < PA_KC) ? j - k0 : PA_KC;
+
+        for(I e = tid; e < PA_KC * jb; e += nthds)
+        {
+            I kk = is_upper ? e % PA_KC : e / jb;
+            I i = is_upper ? e / PA_KC : e % jb;
+            P[kk + i * PA_KC] = (kk < kc) ? potrf_pa_get(is_upper, A, k0 + kk, j + i, lda) : 0;
+        }
+        for(I e = tid; e < PA_KC * PANEL_APPLY_TILE; e += nthds)
+        {
+            I kk = is_upper ? e % PA_KC : e / PANEL_APPLY_TILE;
+            I c = is_upper ? e / PA_KC : e % PANEL_APPLY_TILE;
+            Q[kk + c * PA_KC]
+                = (kk < kc && c < nc) ? potrf_pa_get(is_upper, A, k0 + kk, cb + c0 + c, lda) : 0;
+        }
+        __syncthreads();
+
+        for(I kk = 0; kk < kc; ++kk)
+        {
+            T b[PA_CPT];
+#pragma unroll
+            for(int q = 0; q < PA_CPT; ++q)
+                b[q] = Q[kk + (ty * PA_CPT + q) * PA_KC];
+
+#pragma unroll
+            for(int p = 0; p < PA_RPT; ++p)
+            {
+                I i = tx + p * PA_DIMX;
+                T a = (i < jb) ? conj(P[kk + i * PA_KC]) : 0;
+#pragma unroll
+                for(int q = 0; q < PA_CPT; ++q)
+                    acc[p][q] += a * b[q];
+            }
+        }
+        __syncthreads();
+    }
+
+#pragma unroll
+    for(int p = 0; p < PA_RPT; ++p)
+    {
+        I i = tx + p * PA_DIMX;
+#pragma unroll
+        for(int q = 0; q < PA_CPT; ++q)
+        {
+            I c = ty * PA_CPT + q;
+            if(i < jb)
+                X[i + c * jb]
+                    = (c < nc) ? potrf_pa_get(is_upper, A, j + i, cb + c0 + c, lda) - acc[p][q] : 0;
+        }
+    }
+    __syncthreads();
+
+    if(!diag)
+    {
+        // forward substitution with U11' (the rows of the solution are scaled by the diagonal
+        // at the end, so that row k is not modified while it is read)
+        for(I k = 0; k < jb - 1; ++k)
+        {
+            T d = conj(potrf_pa_get(is_upper, A, j + k, j + k, lda));
+            for(I e = tid; e < jb * PANEL_APPLY_TILE; e += nthds)
+            {
+                I i = e % jb;
+                I c = e / jb;
+                if(i > k)
+                {
+                    T u = conj(potrf_pa_get(is_upper, A, j + k, j + i, lda));
+                    X[e] -= u * (X[k + c * jb] / d);
+                }
+            }
+            __syncthreads();
+        }
+    }
+
+    // write back the result (only the upper triangular part of the diagonal block)
+    for(I e = tid; e < jb * PANEL_APPLY_TILE; e += nthds)
+    {
+        I i = e % jb;
+        I c = e / jb;
+        if(c < nc && (!diag || i <= c0 + c))
+        {
+            T x = diag ? X[e] : X[e] / conj(potrf_pa_get(is_upper, A, j + i, j + i, lda));
+            potrf_pa_set(is_upper, A, j + i, cb + c0 + c, lda, x);
+        }
+    }
+}
+
+/** LARFB_PANEL_APPLY_KERNEL applies the block reflector H' = I - V * F' * V' from the left to
+    the m x n matrix C, where V is the m x k unit lower trapezoidal matrix of Householder vectors
+    stored column-wise (as returned by GEQRF; the upper triangular part is not referenced), and
+    F is the k x k upper triangular factor returned by LARFT with forward direction.
+
+    Call this kernel with 'batch_count' groups in z, and enough groups in x to cover the 'n'
+    columns in tiles of PANEL_APPLY_TILE columns. Size of shared memory per group should be:
+    lmemsize = (k * PANEL_APPLY_TILE + PA_KC * (k + PANEL_APPLY_TILE)) * sizeof(T); **/
+template <typename T, typename I, typename U>
+ROCSOLVER_KERNEL void __launch_bounds__(BS1) larfb_panel_apply_kernel(const I m,
+                                                                      const I n,
+                                                                      const I k,
+                                                                      U VV,
+                                                                      const rocblas_stride shiftV,
+                                                                      const I ldv,
+                                                                      const rocblas_stride strideV,
+                                                                      T* FF,
+                                                                      const I ldf,
+                                                                      const rocblas_stride strideF,
+                                                                      U CC,
+                                                                      const rocblas_stride shiftC,
+                                                                      const I ldc,
+                                                                      const rocblas_stride strideC)
+{
+    I bid = hipBlockIdx_z;
+    I tx = hipThreadIdx_x;
+    I ty = hipThreadIdx_y;
+    I tid = tx + ty * PA_DIMX;
+    I nthds = PA_DIMX * hipBlockDim_y;
+
+    // columns of the tile
+    I c0 = hipBlockIdx_x * PANEL_APPLY_TILE;
+    I nc = (n - c0 < PANEL_APPLY_TILE) ? n - c0 : PANEL_APPLY_TILE;
+
+    // batch instance
+    T* V = load_ptr_batch(VV, bid, shiftV, strideV);
+    T* F = load_ptr_batch(FF, bid, 0, strideF);
+    T* C = load_ptr_batch(CC, bid, shiftC + idx2D(0, c0, ldc), strideC);
+
+    // shared mem setup
+    extern __shared__ double lmem[];
+    T* W = reinterpret_cast<T*>(lmem);
+    T* P = W + k * PANEL_APPLY_TILE;
+    T* Q = P + PA_KC * k;
+
+    // W = V' * C, staging PA_KC rows of V and C at a time
+    T acc[PA_RPT][PA_CPT];
+#pragma unroll
+    for(int p = 0; p < PA_RPT; ++p)
+#pragma unroll
+        for(int q = 0; q < PA_CPT; ++q)
+            acc[p][q] = 0;
+
+    for(I r0 = 0; r0 < m; r0 += PA_KC)
+    {
+        I rc = (m - r0 < PA_KC) ? m - r0 : PA_KC;
+
+        for(I e = tid; e < PA_KC * k; e += nthds)
+        {
+            I rr = e % PA_KC;
+            I i = e / PA_KC;
+            I r = r0 + rr;
+            P[e] = (rr >= rc || r < i) ? 0 : (r == i) ? 1 : V[r + i * ldv];
+        }
+        for(I e = tid; e < PA_KC * PANEL_APPLY_TILE; e += nthds)
+        {
+            I rr = e % PA_KC;
+            I c = e / PA_KC;
+            Q[e] = (rr < rc && c < nc) ? C[r0 + rr + c * ldc] : 0;
+        }
+        __syncthreads();
+
+        for(I rr = 0; rr < rc; ++rr)
+        {
+            T b[PA_CPT];
+#pragma unroll
+            for(int q = 0; q < PA_CPT; ++q)
+                b[q] = Q[rr + (ty * PA_CPT + q) * PA_KC];
+
+#pragma unroll
+            for(int p = 0; p < PA_RPT; ++p)
+            {
+                I i = tx + p * PA_DIMX;
+                T a = (i < k) ? conj(P[rr + i * PA_KC]) : 0;
+#pragma unroll
+                for(int q = 0; q < PA_CPT; ++q)
+                    acc[p][q] += a * b[q];
+            }
+        }
+        __syncthreads();
+    }
+
+#pragma unroll
+    for(int p = 0; p < PA_RPT; ++p)
+    {
+        I i = tx + p * PA_DIMX;
+#pragma unroll
+        for(int q = 0; q < PA_CPT; ++q)
+            if(i < k)
+                W[i + (ty * PA_CPT + q) * k] = acc[p][q];
+    }
+    __syncthreads();
+
+    // W = F' * W
+#pragma unroll
+    for(int p = 0; p < PA_RPT; ++p)
+    {
+        I i = tx + p * PA_DIMX;
+#pragma unroll
+        for(int q = 0; q < PA_CPT; ++q)
+        {
+            acc[p][q] = 0;
+            for(I l = 0; l <= i && i < k; ++l)
+                acc[p][q] += conj(F[l + i * ldf]) * W[l + (ty * PA_CPT + q) * k];
+        }
+    }
+    __syncthreads();
+
+#pragma unroll
+    for(int p = 0; p < PA_RPT; ++p)
+    {
+        I i = tx + p * PA_DIMX;
+#pragma unroll
+        for(int q = 0; q < PA_CPT; ++q)
+            if(i < k)
+                W[i + (ty * PA_CPT + q) * k] = acc[p][q];
+    }
+    __syncthreads();
+
+    // C = C - V * W
+    for(I r0 = 0; r0 < m; r0 += PA_DIMX * PA_RPT)
+    {
+#pragma unroll
+        for(int p = 0; p < PA_RPT; ++p)
+#pragma unroll
+            for(int q = 0; q < PA_CPT; ++q)
+                acc[p][q] = 0;
+
+        for(I l = 0; l < k; ++l)
+        {
+            T b[PA_CPT];
+#pragma unroll
+            for(int q = 0; q < PA_CPT; ++q)
+                b[q] = W[l + (ty * PA_CPT + q) * k];
+
+#pragma unroll
+            for(int p = 0; p < PA_RPT; ++p)
+            {
+                I r = r0 + tx + p * PA_DIMX;
+                T a = (r >= m || r < l) ? 0 : (r == l) ? 1 : V[r + l * ldv];
+#pragma unroll
+                for(int q = 0; q < PA_CPT; ++q)
+                    acc[p][q] += a * b[q];
+            }
+        }
+
+#pragma unroll
+        for(int p = 0; p < PA_RPT; ++p)
+        {
+            I r = r0 + tx + p * PA_DIMX;
+#pragma unroll
+            for(int q = 0; q < PA_CPT; ++q)
+            {
+                I c = ty * PA_CPT + q;
+                if(r < m && c < nc)
+                    C[r + c * ldc] -= acc[p][q];
+            }
+        }
+    }
+}
+
+/*************************************************************
+    Launchers of specialized kernels
+*************************************************************/
+
+template <bool BATCHED, bool STRIDED, typename T, typename I, typename U>
+rocblas_status rocsolver_getrf_panel_apply(rocblas_handle handle,
+                                           const I mm,
+                                           const I nn,
+                                           const I jb,
+                                           U A,
+                                           const rocblas_stride shiftA,
+                                           const I lda,
+                                           const rocblas_stride strideA,
+                                           const I batch_count)
+{
+    ROCSOLVER_ENTER("getrf_panel_apply", "mm:", mm, "nn:", nn, "jb:", jb, "shiftA:", shiftA,
+                    "lda:", lda, "bc:", batch_count);
+
+    if(nn == 0 || jb == 0 || batch_count == 0)
+        return rocblas_status_success;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    I blocks = (nn - 1) / PANEL_APPLY_TILE + 1;
+    dim3 grid(blocks, 1, batch_count);
+    dim3 threads(PA_DIMX, PANEL_APPLY_TILE / PA_CPT, 1);
+    size_t lmemsize = sizeof(T) * jb * PANEL_APPLY_TILE;
+
+    ROCSOLVER_LAUNCH_KERNEL((getrf_panel_apply_kernel<T>), grid, threads, lmemsize, stream, mm, nn,
+                            jb, A, shiftA, lda, strideA);
+
+    return rocblas_status_success;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename I, typename U>
+rocblas_status rocsolver_potrf_panel_apply(rocblas_handle handle,
+                                           const rocblas_fill uplo,
+                                           const I j,
+                                           const I jb,
+                                           const I cb,
+                                           const I nn,
+                                           U A,
+                                           const rocblas_stride shiftA,
+                                           const I lda,
+                                           const rocblas_stride strideA,
+                                           const I* info,
+                                           const I batch_count)
+{
+    ROCSOLVER_ENTER("potrf_panel_apply", "uplo:", uplo, "j:", j, "jb:", jb, "cb:", cb, "nn:", nn,
+                    "shiftA:", shiftA, "lda:", lda, "bc:", batch_count);
+
+    if(nn == 0 || jb == 0 || batch_count == 0)
+        return rocblas_status_success;
+    if(jb > PA_MAX_K)
+        return rocblas_status_not_implemented;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    I blocks = (nn - 1) / PANEL_APPLY_TILE + 1;
+    dim3 grid(blocks, 1, batch_count);
+    dim3 threads(PA_DIMX, PANEL_APPLY_TILE / PA_CPT, 1);
+    size_t lmemsize = sizeof(T) * (jb * PANEL_APPLY_TILE + PA_KC * (jb + PANEL_APPLY_TILE));
+
+    ROCSOLVER_LAUNCH_KERNEL((potrf_panel_apply_kernel<T>), grid, threads, lmemsize, stream,
+                            uplo == rocblas_fill_upper, j, jb, cb, nn, A, shiftA, lda, strideA,
+                            info);
+
+    return rocblas_status_success;
+}
+
+template <bool BATCHED, bool STRIDED, typename T, typename I, typename U>
+rocblas_status rocsolver_larfb_panel_apply(rocblas_handle handle,
+                                           const I m,
+                                           const I n,
+                                           const I k,
+                                           U V,
+                                           const rocblas_stride shiftV,
+                                           const I ldv,
+                                           const rocblas_stride strideV,
+                                           T* F,
+                                           const I ldf,
+                                           const rocblas_stride strideF,
+                                           U C,
+                                           const rocblas_stride shiftC,
+                                           const I ldc,
+                                           const rocblas_stride strideC,
+                                           const I batch_count)
+{
+    ROCSOLVER_ENTER("larfb_panel_apply", "m:", m, "n:", n, "k:", k, "shiftV:", shiftV,
+                    "ldv:", ldv, "ldf:", ldf, "shiftC:", shiftC, "ldc:", ldc, "bc:", batch_count);
+
+    if(m == 0 || n == 0 || k == 0 || batch_count == 0)
+        return rocblas_status_success;
+    if(k > PA_MAX_K)
+        return rocblas_status_not_implemented;
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    I blocks = (n - 1) / PANEL_APPLY_TILE + 1;
+    dim3 grid(blocks, 1, batch_count);
+    dim3 threads(PA_DIMX, PANEL_APPLY_TILE / PA_CPT, 1);
+    size_t lmemsize = sizeof(T) * (k * PANEL_APPLY_TILE + PA_KC * (k + PANEL_APPLY_TILE));
+
+    ROCSOLVER_LAUNCH_KERNEL((larfb_panel_apply_kernel<T>), grid, threads, lmemsize, stream, m, n,
+                            k, V, shiftV, ldv, strideV, F, ldf, strideF, C, shiftC, ldc, strideC);
+
+    return rocblas_status_success;
+}
+
+/*************************************************************
+    Instantiation macros
+*************************************************************/
+
+#define INSTANTIATE_GETRF_PANEL_APPLY(BATCHED, STRIDED, T, I, U)                                \
+    template rocblas_status rocsolver_getrf_panel_apply<BATCHED, STRIDED, T, I, U>(             \
+        rocblas_handle handle, const I mm, const I nn, const I jb, U A,                         \
+        const rocblas_stride shiftA, const I lda, const rocblas_stride strideA,                 \
+        const I batch_count)
+
+#define INSTANTIATE_POTRF_PANEL_APPLY(BATCHED, STRIDED, T, I, U)                                \
+    template rocblas_status rocsolver_potrf_panel_apply<BATCHED, STRIDED, T, I, U>(             \
+        rocblas_handle handle, const rocblas_fill uplo, const I j, const I jb, const I cb,      \
+        const I nn, U A, const rocblas_stride shiftA, const I lda, const rocblas_stride strideA, \
+        const I* info, const I batch_count)
+
+#define INSTANTIATE_LARFB_PANEL_APPLY(BATCHED, STRIDED, T, I, U)                                \
+    template rocblas_status rocsolver_larfb_panel_apply<BATCHED, STRIDED, T, I, U>(             \
+        rocblas_handle handle, const I m, const I n, const I k, U V,                            \
+        const rocblas_stride shiftV, const I ldv, const rocblas_stride strideV, T* F,           \
+        const I ldf, const rocblas_stride strideF, U C, const rocblas_stride shiftC,            \
+        const I ldc, const rocblas_stride strideC, const I batch_count)
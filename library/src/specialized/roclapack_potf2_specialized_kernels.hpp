@@ -139,7 +139,9 @@ __device__ static void potf2_simple(bool const is_upper, I const n, T* const A,
                 break;
             }
 
+            // all threads must have read akk before it is overwritten
             auto const lkk = std::sqrt(akk);
+            __syncthreads();
             if(tid == 0)
             {
                 A[kk] = lkk;
@@ -220,7 +222,9 @@ __device__ static void potf2_simple(bool const is_upper, I const n, T* const A,
                 break;
             }
 
+            // all threads must have read akk before it is overwritten
             auto const ukk = std::sqrt(akk);
+            __syncthreads();
             if(tid == 0)
             {
                 A[kk] = ukk;
@@ -266,63 +270,30 @@ __device__ static void potf2_simple(bool const is_upper, I const n, T* const A,
     }
 }
 
-/*************************************************************
-    Templated kernels are instantiated in separate cpp
-    files in order to improve compilation times and reduce
-    the library size.
-*************************************************************/
-
-template <typename T, typename U>
-ROCSOLVER_KERNEL void potf2_kernel_small(const bool is_upper,
-                                         const rocblas_int n,
-                                         U AA,
-                                         const rocblas_int shiftA,
-                                         const rocblas_int lda,
-                                         const rocblas_stride strideA,
-                                         rocblas_int* const info)
+/**
+ * ------------------------------------------------------
+ * Copy the triangular part of the n by n matrix A into
+ * the lower packed storage Ash (the upper triangular part
+ * is stored as its conjugate transpose).
+ * ------------------------------------------------------
+**/
+template <typename T, typename I>
+__device__ static void potf2_load_packed(bool const is_upper,
+                                         I const n,
+                                         T* const A,
+                                         I const lda,
+                                         T* const Ash)
 {
-    bool const is_lower = (!is_upper);
-
     auto const i_start = hipThreadIdx_x;
     auto const i_inc = hipBlockDim_x;
     auto const j_start = hipThreadIdx_y;
     auto const j_inc = hipBlockDim_y;
-    assert(hipBlockDim_z == 1);
 
-    // --------------------------------
-    // note hipGridDim_z == batch_count
-    // --------------------------------
-    auto const bid = hipBlockIdx_z;
-    assert(AA != nullptr);
-    assert(info != nullptr);
-
-    T* const A = load_ptr_batch(AA, bid, shiftA, strideA);
-    rocblas_int* const info_bid = info + bid;
-
-    assert(A != nullptr);
-
-    // -----------------------------------------
-    // assume n by n matrix will fit in LDS cache
-    // -----------------------------------------
-    extern __shared__ rocblas_int lsmem[];
-    T* Ash = reinterpret_cast<T*>(lsmem);
-
-    // --------------------------------------------------------
-    // factoring Lower triangular matrix may be slightly faster
-    // due to simpler index calculation down a column
-    // --------------------------------------------------------
-    bool const use_compute_lower = true;
-
-    // ------------------------------------
-    // copy n by n packed matrix into shared memory
-    // ------------------------------------
-    __syncthreads();
-
-    if(is_lower)
+    if(!is_upper)
     {
-        for(rocblas_int j = j_start; j < n; j += j_inc)
+        for(I j = j_start; j < n; j += j_inc)
         {
-            for(rocblas_int i = j + i_start; i < n; i += i_inc)
+            for(I i = j + i_start; i < n; i += i_inc)
             {
                 auto const ij = i + j * static_cast<int64_t>(lda);
                 auto const ij_packed = idx_lower(i, j, n);
@@ -333,34 +304,42 @@ ROCSOLVER_KERNEL void potf2_kernel_small(const bool is_upper,
     }
     else
     {
-        for(rocblas_int j = j_start; j < n; j += j_inc)
+        for(I j = j_start; j < n; j += j_inc)
         {
-            for(rocblas_int i = i_start; i <= j; i += i_inc)
+            for(I i = i_start; i <= j; i += i_inc)
             {
                 auto const ij = i + j * static_cast<int64_t>(lda);
-                auto const ij_packed = (use_compute_lower) ? idx_lower(j, i, n) : idx_upper(i, j, n);
+                auto const ij_packed = idx_lower(j, i, n);
 
-                auto const aij = A[ij];
-                Ash[ij_packed] = (use_compute_lower) ? conj(aij) : aij;
+                Ash[ij_packed] = conj(A[ij]);
             }
         }
     }
+}
 
-    __syncthreads();
-
-    bool const is_up = (use_compute_lower) ? false : is_upper;
-    potf2_simple<T>(is_up, n, Ash, info_bid);
-
-    __syncthreads();
+/**
+ * ------------------------------------------------------
+ * Copy the lower packed storage Ash back into the
+ * triangular part of the n by n matrix A.
+ * ------------------------------------------------------
+**/
+template <typename T, typename I>
+__device__ static void potf2_store_packed(bool const is_upper,
+                                          I const n,
+                                          T* const A,
+                                          I const lda,
+                                          T* const Ash)
+{
+    auto const i_start = hipThreadIdx_x;
+    auto const i_inc = hipBlockDim_x;
+    auto const j_start = hipThreadIdx_y;
+    auto const j_inc = hipBlockDim_y;
 
-    // -------------------------------------
-    // copy n by n packed matrix into global memory
-    // -------------------------------------
-    if(is_lower)
+    if(!is_upper)
     {
-        for(rocblas_int j = j_start; j < n; j += j_inc)
+        for(I j = j_start; j < n; j += j_inc)
         {
-            for(rocblas_int i = j + i_start; i < n; i += i_inc)
+            for(I i = j + i_start; i < n; i += i_inc)
             {
                 auto const ij = i + j * static_cast<int64_t>(lda);
                 auto const ij_packed = idx_lower(i, j, n);
@@ -371,36 +350,215 @@ ROCSOLVER_KERNEL void potf2_kernel_small(const bool is_upper,
     }
     else
     {
-        for(rocblas_int j = j_start; j < n; j += j_inc)
+        for(I j = j_start; j < n; j += j_inc)
         {
-            for(rocblas_int i = i_start; i <= j; i += i_inc)
+            for(I i = i_start; i <= j; i += i_inc)
             {
                 auto const ij = i + j * static_cast<int64_t>(lda);
-                auto const ij_packed = (use_compute_lower) ? idx_lower(j, i, n) : idx_upper(i, j, n);
+                auto const ij_packed = idx_lower(j, i, n);
+
+                A[ij] = conj(Ash[ij_packed]);
+            }
+        }
+    }
+}
+
+/**
+ * ------------------------------------------------------
+ * Solve L * L' * X = B, where the lower triangular factor
+ * L is in packed storage. Each column of B is processed by
+ * a row of threads of the block.
+ * ------------------------------------------------------
+**/
+template <typename T>
+__device__ static void potrs_packed(rocblas_int const n,
+                                    rocblas_int const nrhs,
+                                    T* const L,
+                                    T* const B,
+                                    rocblas_int const ldb)
+{
+    auto const i_start = hipThreadIdx_x;
+    auto const i_inc = hipBlockDim_x;
+    auto const j_start = hipThreadIdx_y;
+    auto const j_inc = hipBlockDim_y;
+
+    // all threads must reach the same barriers, so the loop over the
+    // columns of B is uniform across the block
+    for(rocblas_int jb = 0; jb < nrhs; jb += j_inc)
+    {
+        rocblas_int const j = jb + j_start;
+        bool const active = (j < nrhs);
+        T* const x = B + j * static_cast<int64_t>(ldb);
+
+        // ----------------------
+        // forward solve L * y = b
+        // ----------------------
+        for(rocblas_int k = 0; k < n; k++)
+        {
+            if(active && i_start == 0)
+                x[k] = x[k] / L[idx_lower(k, k, n)];
+            __syncthreads();
+
+            if(active)
+            {
+                auto const xk = x[k];
+                for(rocblas_int i = (k + 1) + i_start; i < n; i += i_inc)
+                    x[i] = x[i] - L[idx_lower(i, k, n)] * xk;
+            }
+            __syncthreads();
+        }
+
+        // -----------------------
+        // backward solve L' * x = y
+        // -----------------------
+        for(rocblas_int k = n - 1; k >= 0; k--)
+        {
+            if(active && i_start == 0)
+                x[k] = x[k] / L[idx_lower(k, k, n)];
+            __syncthreads();
 
-                auto const aij_packed = Ash[ij_packed];
-                A[ij] = (use_compute_lower) ? conj(aij_packed) : aij_packed;
+            if(active)
+            {
+                auto const xk = x[k];
+                for(rocblas_int i = i_start; i < k; i += i_inc)
+                    x[i] = x[i] - conj(L[idx_lower(k, i, n)]) * xk;
             }
+            __syncthreads();
         }
     }
+}
+
+/*************************************************************
+    Templated kernels are instantiated in separate cpp
+    files in order to improve compilation times and reduce
+    the library size.
+*************************************************************/
 
+template <typename T, typename I, typename U>
+ROCSOLVER_KERNEL void potf2_kernel_small(const bool is_upper,
+                                         const I n,
+                                         U AA,
+                                         const rocblas_stride shiftA,
+                                         const I lda,
+                                         const rocblas_stride strideA,
+                                         I* const info,
+                                         const I* const skip)
+{
+    assert(hipBlockDim_z == 1);
+
+    // --------------------------------
+    // note hipGridDim_z == batch_count
+    // --------------------------------
+    auto const bid = hipBlockIdx_z;
+
+    // the problems that already failed are not factorized (early abort)
+    if(skip && skip[bid] != 0)
+        return;
+    assert(AA != nullptr);
+    assert(info != nullptr);
+
+    T* const A = load_ptr_batch(AA, bid, shiftA, strideA);
+    I* const info_bid = info + bid;
+
+    assert(A != nullptr);
+
+    // -----------------------------------------
+    // assume n by n matrix will fit in LDS cache
+    // -----------------------------------------
+    extern __shared__ rocblas_int lsmem[];
+    T* Ash = reinterpret_cast<T*>(lsmem);
+
+    // ------------------------------------
+    // copy n by n packed matrix into shared memory
+    // (factoring Lower triangular matrix may be slightly faster
+    // due to simpler index calculation down a column)
+    // ------------------------------------
     __syncthreads();
+
+    potf2_load_packed<T>(is_upper, n, A, lda, Ash);
+
+    __syncthreads();
+
+    potf2_simple<T>(false, n, Ash, info_bid);
+
+    __syncthreads();
+
+    // -------------------------------------
+    // copy n by n packed matrix into global memory
+    // -------------------------------------
+    potf2_store_packed<T>(is_upper, n, A, lda, Ash);
+
+    __syncthreads();
+}
+
+/** posv_kernel_small factorizes the matrix A in the LDS (as potf2_kernel_small)
+    and, if it is positive definite, solves the system A * X = B overwriting B.
+    info is set for each batch instance (it does not need to be reset beforehand). **/
+template <typename T, typename U>
+ROCSOLVER_KERNEL void posv_kernel_small(const bool is_upper,
+                                        const rocblas_int n,
+                                        const rocblas_int nrhs,
+                                        U AA,
+                                        const rocblas_int shiftA,
+                                        const rocblas_int lda,
+                                        const rocblas_stride strideA,
+                                        U BB,
+                                        const rocblas_int shiftB,
+                                        const rocblas_int ldb,
+                                        const rocblas_stride strideB,
+                                        rocblas_int* const info)
+{
+    assert(hipBlockDim_z == 1);
+
+    // --------------------------------
+    // note hipGridDim_z == batch_count
+    // --------------------------------
+    auto const bid = hipBlockIdx_z;
+
+    T* const A = load_ptr_batch(AA, bid, shiftA, strideA);
+    T* const B = load_ptr_batch(BB, bid, shiftB, strideB);
+    rocblas_int* const info_bid = info + bid;
+
+    auto const tid = hipThreadIdx_x + hipThreadIdx_y * hipBlockDim_x;
+    if(tid == 0)
+        *info_bid = 0;
+
+    extern __shared__ rocblas_int lsmem[];
+    T* Ash = reinterpret_cast<T*>(lsmem);
+
+    potf2_load_packed<T>(is_upper, n, A, lda, Ash);
+
+    __syncthreads();
+
+    potf2_simple<T>(false, n, Ash, info_bid);
+
+    __syncthreads();
+
+    potf2_store_packed<T>(is_upper, n, A, lda, Ash);
+
+    // ---------------------------------------------
+    // B is only updated if A is positive definite
+    // (info_bid is block-uniform after the barrier)
+    // ---------------------------------------------
+    if(*info_bid == 0)
+        potrs_packed<T>(n, nrhs, Ash, B, ldb);
 }
 
 /*************************************************************
     Launchers of specilized kernels
 *************************************************************/
 
-template <typename T, typename U>
+template <typename T, typename I, typename U>
 rocblas_status potf2_run_small(rocblas_handle handle,
                                const rocblas_fill uplo,
-                               const rocblas_int n,
+                               const I n,
                                U A,
-                               const rocblas_int shiftA,
-                               const rocblas_int lda,
+                               const rocblas_stride shiftA,
+                               const I lda,
                                const rocblas_stride strideA,
-                               rocblas_int* info,
-                               const rocblas_int batch_count)
+                               I* info,
+                               const I batch_count,
+                               const I* skip)
 {
     ROCSOLVER_ENTER("potf2_kernel_small", "uplo:", uplo, "n:", n, "shiftA:", shiftA, "lda:", lda,
                     "bc:", batch_count);
@@ -411,8 +569,41 @@ rocblas_status potf2_run_small(rocblas_handle handle,
     size_t lmemsize = sizeof(T) * (n * (n + 1)) / 2;
 
     bool const is_upper = (uplo == rocblas_fill_upper);
-    ROCSOLVER_LAUNCH_KERNEL((potf2_kernel_small<T, U>), dim3(1, 1, batch_count), dim3(BS2, BS2, 1),
-                            lmemsize, stream, is_upper, n, A, shiftA, lda, strideA, info);
+    ROCSOLVER_LAUNCH_KERNEL((potf2_kernel_small<T, I, U>), dim3(1, 1, batch_count),
+                            dim3(BS2, BS2, 1), lmemsize, stream, is_upper, n, A, shiftA, lda,
+                            strideA, info, skip);
+
+    return rocblas_status_success;
+}
+
+template <typename T, typename U>
+rocblas_status posv_run_small(rocblas_handle handle,
+                              const rocblas_fill uplo,
+                              const rocblas_int n,
+                              const rocblas_int nrhs,
+                              U A,
+                              const rocblas_int shiftA,
+                              const rocblas_int lda,
+                              const rocblas_stride strideA,
+                              U B,
+                              const rocblas_int shiftB,
+                              const rocblas_int ldb,
+                              const rocblas_stride strideB,
+                              rocblas_int* info,
+                              const rocblas_int batch_count)
+{
+    ROCSOLVER_ENTER("posv_kernel_small", "uplo:", uplo, "n:", n, "nrhs:", nrhs, "shiftA:", shiftA,
+                    "lda:", lda, "shiftB:", shiftB, "ldb:", ldb, "bc:", batch_count);
+
+    hipStream_t stream;
+    rocblas_get_stream(handle, &stream);
+
+    size_t lmemsize = sizeof(T) * (n * (n + 1)) / 2;
+
+    bool const is_upper = (uplo == rocblas_fill_upper);
+    ROCSOLVER_LAUNCH_KERNEL((posv_kernel_small<T, U>), dim3(1, 1, batch_count), dim3(BS2, BS2, 1),
+                            lmemsize, stream, is_upper, n, nrhs, A, shiftA, lda, strideA, B, shiftB,
+                            ldb, strideB, info);
 
     return rocblas_status_success;
 }
@@ -421,8 +612,15 @@ rocblas_status potf2_run_small(rocblas_handle handle,
     Instantiation macros
 *************************************************************/
 
-#define INSTANTIATE_POTF2_SMALL(T, U)                                                  \
-    template rocblas_status potf2_run_small<T, U>(                                     \
-        rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n, U A,      \
-        const rocblas_int shiftA, const rocblas_int lda, const rocblas_stride strideA, \
-        rocblas_int* info, const rocblas_int batch_count)
+#define INSTANTIATE_POTF2_SMALL(T, I, U)                                                 \
+    template rocblas_status potf2_run_small<T, I, U>(                                    \
+        rocblas_handle handle, const rocblas_fill uplo, const I n, U A,                  \
+        const rocblas_stride shiftA, const I lda, const rocblas_stride strideA, I* info, \
+        const I batch_count, const I* skip)
+
+#define INSTANTIATE_POSV_SMALL(T, U)                                                        \
+    template rocblas_status posv_run_small<T, U>(                                           \
+        rocblas_handle handle, const rocblas_fill uplo, const rocblas_int n,                \
+        const rocblas_int nrhs, U A, const rocblas_int shiftA, const rocblas_int lda,       \
+        const rocblas_stride strideA, U B, const rocblas_int shiftB, const rocblas_int ldb, \
+        const rocblas_stride strideB, rocblas_int* info, const rocblas_int batch_count)
@@ -31,5 +31,12 @@
     Instantiate template methods using macros
 *************************************************************/
 
-INSTANTIATE_POTF2_SMALL(double, double*);
-INSTANTIATE_POTF2_SMALL(double, double* const*);
+INSTANTIATE_POTF2_SMALL(double, rocblas_int, double*);
+INSTANTIATE_POTF2_SMALL(double, rocblas_int, double* const*);
+
+// 64-bit APIs
+INSTANTIATE_POTF2_SMALL(double, int64_t, double*);
+INSTANTIATE_POTF2_SMALL(double, int64_t, double* const*);
+
+INSTANTIATE_POSV_SMALL(double, double*);
+INSTANTIATE_POSV_SMALL(double, double* const*);
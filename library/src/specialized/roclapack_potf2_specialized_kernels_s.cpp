@@ -31,5 +31,12 @@
     Instantiate template methods using macros
 *************************************************************/
 
-INSTANTIATE_POTF2_SMALL(float, float*);
-INSTANTIATE_POTF2_SMALL(float, float* const*);
+INSTANTIATE_POTF2_SMALL(float, rocblas_int, float*);
+INSTANTIATE_POTF2_SMALL(float, rocblas_int, float* const*);
+
+// 64-bit APIs
+INSTANTIATE_POTF2_SMALL(float, int64_t, float*);
+INSTANTIATE_POTF2_SMALL(float, int64_t, float* const*);
+
+INSTANTIATE_POSV_SMALL(float, float*);
+INSTANTIATE_POSV_SMALL(float, float* const*);
@@ -31,5 +31,12 @@
     Instantiate template methods using macros
 *************************************************************/
 
-INSTANTIATE_POTF2_SMALL(rocblas_double_complex, rocblas_double_complex*);
-INSTANTIATE_POTF2_SMALL(rocblas_double_complex, rocblas_double_complex* const*);
+INSTANTIATE_POTF2_SMALL(rocblas_double_complex, rocblas_int, rocblas_double_complex*);
+INSTANTIATE_POTF2_SMALL(rocblas_double_complex, rocblas_int, rocblas_double_complex* const*);
+
+// 64-bit APIs
+INSTANTIATE_POTF2_SMALL(rocblas_double_complex, int64_t, rocblas_double_complex*);
+INSTANTIATE_POTF2_SMALL(rocblas_double_complex, int64_t, rocblas_double_complex* const*);
+
+INSTANTIATE_POSV_SMALL(rocblas_double_complex, rocblas_double_complex*);
+INSTANTIATE_POSV_SMALL(rocblas_double_complex, rocblas_double_complex* const*);
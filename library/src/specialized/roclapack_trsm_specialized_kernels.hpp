@@ -27,6 +27,7 @@
 
 #pragma once
 
+#include "rocsolver_handle_state.hpp"
 #include "rocsolver_run_specialized_kernels.hpp"
 
 /** Constants for block size of trsm **/
@@ -728,10 +729,12 @@ rocblas_status rocsolver_trsm_mem(const rocblas_side side,
                                   const I lda,
                                   const I ldb,
                                   const I inca,
-                                  const I incb)
+                                  const I incb,
+                                  const bool lowmem)
 {
-    // always allocate all required memory for TRSM optimal performance
-    *optim_mem = true;
+    // allocate all required memory for TRSM optimal performance, unless the
+    // low-memory algorithm is requested
+    *optim_mem = !lowmem;
 
     if(inca != 1 || incb != 1)
     {
@@ -776,7 +779,7 @@ rocblas_status rocsolver_trsm_mem(const rocblas_side side,
     }
 
     return rocblasCall_trsm_mem<BATCHED, T>(side, trans, mm, n, lda, ldb, batch_count, size_work1,
-                                            size_work2, size_work3, size_work4);
+                                            size_work2, size_work3, size_work4, *optim_mem);
 }
 
 /** Internal TRSM (lower case):
@@ -849,15 +852,9 @@ rocblas_status rocsolver_trsm_lower(rocblas_handle handle,
                                 optim_mem, work1, work2, work3, work4);
     }
 
-    // TODO: Some architectures require synchronization between rocSOLVER and rocBLAS kernels; more investigation needed
-    int device;
-    HIP_CHECK(hipGetDevice(&device));
-    hipDeviceProp_t deviceProperties;
-    HIP_CHECK(hipGetDeviceProperties(&deviceProperties, device));
-    std::string deviceFullString(deviceProperties.gcnArchName);
-    std::string deviceString = deviceFullString.substr(0, deviceFullString.find(":"));
-    bool do_sync = (deviceString.find("gfx940") != std::string::npos
-                    || deviceString.find("gfx941") != std::string::npos);
+    // some architectures require synchronization between rocSOLVER and rocBLAS kernels
+    bool do_sync
+        = (rocsolver_handle_state_map::get_arch(handle).flags & rocsolver_arch_flag_blas_sync);
 
     // ****** MAIN LOOP ***********
     if(isleft)
@@ -1132,15 +1129,9 @@ rocblas_status rocsolver_trsm_upper(rocblas_handle handle,
                                 optim_mem, work1, work2, work3, work4);
     }
 
-    // TODO: Some architectures require synchronization between rocSOLVER and rocBLAS kernels; more investigation needed
-    int device;
-    HIP_CHECK(hipGetDevice(&device));
-    hipDeviceProp_t deviceProperties;
-    HIP_CHECK(hipGetDeviceProperties(&deviceProperties, device));
-    std::string deviceFullString(deviceProperties.gcnArchName);
-    std::string deviceString = deviceFullString.substr(0, deviceFullString.find(":"));
-    bool do_sync = (deviceString.find("gfx940") != std::string::npos
-                    || deviceString.find("gfx941") != std::string::npos);
+    // some architectures require synchronization between rocSOLVER and rocBLAS kernels
+    bool do_sync
+        = (rocsolver_handle_state_map::get_arch(handle).flags & rocsolver_arch_flag_blas_sync);
 
     // ****** MAIN LOOP ***********
     if(isleft)
@@ -1413,7 +1404,7 @@ inline rocblas_status rocsolver_trsm_upper(rocblas_handle handle,
         const rocblas_side side, const rocblas_operation trans, const I m, const I n,    \
         const I batch_count, size_t* size_work1, size_t* size_work2, size_t* size_work3, \
         size_t* size_work4, bool* optim_mem, bool inblocked, const I lda, const I ldb,   \
-        const I inca, const I incb)
+        const I inca, const I incb, const bool lowmem)
 #define INSTANTIATE_TRSM_LOWER(BATCHED, STRIDED, T, I, U)                                         \
     template rocblas_status rocsolver_trsm_lower<BATCHED, STRIDED, T, I, U>(                      \
         rocblas_handle handle, const rocblas_side side, const rocblas_operation trans,            \